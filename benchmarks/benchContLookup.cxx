@@ -0,0 +1,104 @@
+// Microbenchmarks for container lookups (TList, THashList, TMap, TObjArray)
+// and for TClass lookup by name.
+
+#include "TClass.h"
+#include "THashList.h"
+#include "TList.h"
+#include "TMap.h"
+#include "TNamed.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TString.h"
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+static std::vector<TString> MakeNames(Long64_t n)
+{
+   std::vector<TString> names;
+   names.reserve(n);
+   for (Long64_t i = 0; i < n; ++i)
+      names.emplace_back(TString::Format("object_%lld", i));
+   return names;
+}
+
+static void BM_TList_FindObject(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   auto names = MakeNames(n);
+   TList l;
+   l.SetOwner(true);
+   for (Long64_t i = 0; i < n; ++i)
+      l.Add(new TNamed(names[i], TString()));
+   Long64_t i = 0;
+   for (auto _ : state) {
+      benchmark::DoNotOptimize(l.FindObject(names[i % n]));
+      ++i;
+   }
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TList_FindObject)->Arg(1 << 6)->Arg(1 << 10);
+
+static void BM_THashList_FindObject(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   auto names = MakeNames(n);
+   THashList l;
+   l.SetOwner(true);
+   for (Long64_t i = 0; i < n; ++i)
+      l.Add(new TNamed(names[i], TString()));
+   Long64_t i = 0;
+   for (auto _ : state) {
+      benchmark::DoNotOptimize(l.FindObject(names[i % n]));
+      ++i;
+   }
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_THashList_FindObject)->Arg(1 << 6)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_TMap_GetValue(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   auto names = MakeNames(n);
+   TMap m;
+   m.SetOwnerKeyValue(true, true);
+   for (Long64_t i = 0; i < n; ++i)
+      m.Add(new TObjString(names[i]), new TNamed(names[i], TString()));
+   Long64_t i = 0;
+   for (auto _ : state) {
+      benchmark::DoNotOptimize(m.GetValue(names[i % n]));
+      ++i;
+   }
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TMap_GetValue)->Arg(1 << 6)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_TObjArray_Index(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   auto names = MakeNames(n);
+   TObjArray a(n);
+   a.SetOwner(true);
+   for (Long64_t i = 0; i < n; ++i)
+      a.Add(new TNamed(names[i], TString()));
+   for (auto _ : state) {
+      for (Long64_t i = 0; i < n; ++i)
+         benchmark::DoNotOptimize(a.UncheckedAt(i));
+   }
+   state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TObjArray_Index)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_TClass_GetClass(benchmark::State &state)
+{
+   // lookup of an already loaded class by name
+   for (auto _ : state) {
+      benchmark::DoNotOptimize(TClass::GetClass("TNamed"));
+      benchmark::DoNotOptimize(TClass::GetClass("TList"));
+   }
+   state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_TClass_GetClass);
+
+BENCHMARK_MAIN();
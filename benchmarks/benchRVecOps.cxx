@@ -0,0 +1,68 @@
+// Microbenchmarks for ROOT::VecOps::RVec arithmetic, masking and reductions.
+
+#include "ROOT/RVec.hxx"
+
+#include "benchmark/benchmark.h"
+
+using ROOT::RVecD;
+
+static RVecD MakeInput(Long64_t n, Double_t offset)
+{
+   RVecD v(n);
+   for (Long64_t i = 0; i < n; ++i)
+      v[i] = offset + 0.001*i;
+   return v;
+}
+
+static void BM_RVec_Arithmetic(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   RVecD v1 = MakeInput(n, 1.);
+   RVecD v2 = MakeInput(n, 2.);
+   RVecD v3 = MakeInput(n, 3.);
+   for (auto _ : state) {
+      RVecD r = v1*v2 + v3;
+      benchmark::DoNotOptimize(r.data());
+   }
+   state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_RVec_Arithmetic)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_RVec_Masking(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   RVecD v = MakeInput(n, 0.);
+   const Double_t cut = 0.0005*n;
+   for (auto _ : state) {
+      RVecD sel = v[v > cut];
+      benchmark::DoNotOptimize(sel.data());
+   }
+   state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_RVec_Masking)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_RVec_Map(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   RVecD v = MakeInput(n, 1.);
+   for (auto _ : state) {
+      RVecD r = ROOT::VecOps::Map(v, [](Double_t x) { return x*x + 1.; });
+      benchmark::DoNotOptimize(r.data());
+   }
+   state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_RVec_Map)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_RVec_Sum(benchmark::State &state)
+{
+   const Long64_t n = state.range(0);
+   RVecD v = MakeInput(n, 1.);
+   for (auto _ : state) {
+      Double_t s = ROOT::VecOps::Sum(v);
+      benchmark::DoNotOptimize(s);
+   }
+   state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_RVec_Sum)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
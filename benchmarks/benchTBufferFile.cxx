@@ -0,0 +1,75 @@
+// Microbenchmarks for TBufferFile object streaming and for the raw
+// compression round-trip used by the basket and key I/O.
+
+#include "TBufferFile.h"
+#include "TH1D.h"
+#include "TRandom3.h"
+#include "RZip.h"
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+static void FillSource(TH1D &h)
+{
+   TRandom3 rndm(1);
+   for (Int_t i = 0; i < 100000; ++i)
+      h.Fill(rndm.Gaus());
+}
+
+static void BM_TBufferFile_WriteObject(benchmark::State &state)
+{
+   TH1D h("h", "h", 1000, -5., 5.);
+   FillSource(h);
+   TBufferFile buf(TBuffer::kWrite);
+   for (auto _ : state) {
+      buf.Reset();
+      buf.WriteObject(&h);
+   }
+   state.SetBytesProcessed(state.iterations() * buf.Length());
+}
+BENCHMARK(BM_TBufferFile_WriteObject);
+
+static void BM_TBufferFile_ReadObject(benchmark::State &state)
+{
+   TH1D h("h", "h", 1000, -5., 5.);
+   FillSource(h);
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteObject(&h);
+   for (auto _ : state) {
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), false);
+      TH1D *hread = (TH1D*)rbuf.ReadObjectAny(TH1D::Class());
+      benchmark::DoNotOptimize(hread);
+      delete hread;
+   }
+   state.SetBytesProcessed(state.iterations() * wbuf.Length());
+}
+BENCHMARK(BM_TBufferFile_ReadObject);
+
+static void BM_Zip_RoundTrip(benchmark::State &state)
+{
+   // compressible payload, comparable to a basket of slowly varying doubles
+   const Int_t srcsize = 256*1024;
+   std::vector<char> src(srcsize);
+   TRandom3 rndm(1);
+   for (Int_t i = 0; i < srcsize; ++i)
+      src[i] = (char)(i/64 + rndm.Integer(4));
+   std::vector<char> zipped(srcsize + 1024);
+   std::vector<char> unzipped(srcsize);
+   const Int_t cxlevel = state.range(0);
+   for (auto _ : state) {
+      Int_t insize = srcsize;
+      Int_t outsize = zipped.size();
+      Int_t zipsize = 0;
+      R__zipMultipleAlgorithm(cxlevel, &insize, src.data(), &outsize, zipped.data(), &zipsize,
+                              ROOT::RCompressionSetting::EAlgorithm::kZLIB);
+      Int_t unzipsize = 0;
+      outsize = unzipped.size();
+      R__unzip(&zipsize, (unsigned char*)zipped.data(), &outsize, (unsigned char*)unzipped.data(), &unzipsize);
+      benchmark::DoNotOptimize(unzipsize);
+   }
+   state.SetBytesProcessed(state.iterations() * srcsize);
+}
+BENCHMARK(BM_Zip_RoundTrip)->Arg(1)->Arg(6);
+
+BENCHMARK_MAIN();
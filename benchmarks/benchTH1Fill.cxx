@@ -0,0 +1,62 @@
+// Microbenchmarks for histogram filling.
+
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TRandom3.h"
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+static void BM_TH1_Fill(benchmark::State &state)
+{
+   TH1D h("h", "h", 1000, -5., 5.);
+   TRandom3 rndm(1);
+   for (auto _ : state) {
+      for (Long64_t i = 0; i < state.range(0); ++i)
+         h.Fill(rndm.Gaus());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TH1_Fill)->Arg(1 << 12)->Arg(1 << 16);
+
+static void BM_TH1_FillWeighted(benchmark::State &state)
+{
+   TH1D h("hw", "hw", 1000, -5., 5.);
+   TRandom3 rndm(1);
+   for (auto _ : state) {
+      for (Long64_t i = 0; i < state.range(0); ++i)
+         h.Fill(rndm.Gaus(), rndm.Uniform());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TH1_FillWeighted)->Arg(1 << 12)->Arg(1 << 16);
+
+static void BM_TH1_FillN(benchmark::State &state)
+{
+   TH1D h("hn", "hn", 1000, -5., 5.);
+   TRandom3 rndm(1);
+   const Long64_t n = state.range(0);
+   std::vector<Double_t> values(n);
+   for (Long64_t i = 0; i < n; ++i)
+      values[i] = rndm.Gaus();
+   for (auto _ : state) {
+      h.FillN(n, values.data(), nullptr);
+   }
+   state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TH1_FillN)->Arg(1 << 12)->Arg(1 << 16);
+
+static void BM_TH2_Fill(benchmark::State &state)
+{
+   TH2D h("h2", "h2", 100, -5., 5., 100, -5., 5.);
+   TRandom3 rndm(1);
+   for (auto _ : state) {
+      for (Long64_t i = 0; i < state.range(0); ++i)
+         h.Fill(rndm.Gaus(), rndm.Gaus());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TH2_Fill)->Arg(1 << 12)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
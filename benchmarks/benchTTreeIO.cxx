@@ -0,0 +1,69 @@
+// Microbenchmarks for TTree fill and read throughput, using a TMemFile so
+// that only the in-memory I/O path is measured.
+
+#include "TMemFile.h"
+#include "TTree.h"
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+static void BM_TTree_Fill(benchmark::State &state)
+{
+   const Long64_t nentries = state.range(0);
+   for (auto _ : state) {
+      TMemFile f("benchtree.root", "RECREATE");
+      TTree t("t", "t");
+      Double_t px = 0., py = 0.;
+      std::vector<Double_t> vec;
+      t.Branch("px", &px);
+      t.Branch("py", &py);
+      t.Branch("vec", &vec);
+      for (Long64_t i = 0; i < nentries; ++i) {
+         px = 0.0001*i;
+         py = 1. - px;
+         vec.assign(i % 10 + 1, px);
+         t.Fill();
+      }
+      t.Write();
+      benchmark::DoNotOptimize(t.GetEntries());
+   }
+   state.SetItemsProcessed(state.iterations() * nentries);
+}
+BENCHMARK(BM_TTree_Fill)->Arg(1 << 14)->Arg(1 << 17);
+
+static void BM_TTree_Read(benchmark::State &state)
+{
+   const Long64_t nentries = state.range(0);
+   TMemFile f("benchtree.root", "RECREATE");
+   TTree t("t", "t");
+   Double_t px = 0., py = 0.;
+   std::vector<Double_t> vec;
+   t.Branch("px", &px);
+   t.Branch("py", &py);
+   t.Branch("vec", &vec);
+   for (Long64_t i = 0; i < nentries; ++i) {
+      px = 0.0001*i;
+      py = 1. - px;
+      vec.assign(i % 10 + 1, px);
+      t.Fill();
+   }
+   t.Write();
+
+   std::vector<Double_t> *vecread = nullptr;
+   t.SetBranchAddress("px", &px);
+   t.SetBranchAddress("py", &py);
+   t.SetBranchAddress("vec", &vecread);
+   for (auto _ : state) {
+      Double_t sum = 0.;
+      for (Long64_t i = 0; i < nentries; ++i) {
+         t.GetEntry(i);
+         sum += px + py;
+      }
+      benchmark::DoNotOptimize(sum);
+   }
+   state.SetItemsProcessed(state.iterations() * nentries);
+}
+BENCHMARK(BM_TTree_Read)->Arg(1 << 14)->Arg(1 << 17);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+# Compare two sets of Google Benchmark JSON result files, as produced by the
+# 'run-benchmarks' build target, e.g.
+#
+#   ./compare_benchmarks.py build-before/benchmarks build-after/benchmarks
+#
+# Either argument can also be a single JSON file. Prints per-benchmark CPU
+# times and their ratio; a ratio below 1 means the second set is faster.
+
+import argparse
+import json
+import os
+import sys
+
+
+def load_results(path):
+    """Return {benchmark name: cpu_time in ns} from a JSON file or a directory of them."""
+    if os.path.isdir(path):
+        files = sorted(
+            os.path.join(path, f) for f in os.listdir(path) if f.endswith(".json")
+        )
+    else:
+        files = [path]
+    results = {}
+    for fname in files:
+        with open(fname) as f:
+            data = json.load(f)
+        unit_scale = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+        for b in data.get("benchmarks", []):
+            if b.get("run_type") == "aggregate":
+                continue
+            results[b["name"]] = b["cpu_time"] * unit_scale.get(b.get("time_unit", "ns"), 1.0)
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("before", help="baseline JSON file or directory")
+    parser.add_argument("after", help="new JSON file or directory")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="only flag changes larger than this fraction (default 0.05)",
+    )
+    args = parser.parse_args()
+
+    before = load_results(args.before)
+    after = load_results(args.after)
+    common = sorted(set(before) & set(after))
+    if not common:
+        print("no common benchmarks between the two result sets", file=sys.stderr)
+        return 1
+
+    namewidth = max(len(n) for n in common)
+    print(f"{'benchmark':<{namewidth}}  {'before[ns]':>14}  {'after[ns]':>14}  {'ratio':>7}")
+    nflagged = 0
+    for name in common:
+        ratio = after[name] / before[name] if before[name] else float("inf")
+        flag = ""
+        if ratio > 1 + args.threshold:
+            flag = "  SLOWER"
+            nflagged += 1
+        elif ratio < 1 - args.threshold:
+            flag = "  faster"
+        print(f"{name:<{namewidth}}  {before[name]:>14.1f}  {after[name]:>14.1f}  {ratio:>7.3f}{flag}")
+
+    only_before = sorted(set(before) - set(after))
+    only_after = sorted(set(after) - set(before))
+    if only_before:
+        print("\nonly in baseline:", ", ".join(only_before))
+    if only_after:
+        print("\nonly in new results:", ", ".join(only_after))
+    return 1 if nflagged else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
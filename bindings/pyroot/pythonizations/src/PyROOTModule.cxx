@@ -168,6 +168,10 @@ static PyMethodDef gPyROOTMethods[] = {
     (char *)"Register a custom executor that is a reference to an existing executor"},
    {(char *)"PyObjRefCounterAsStdAny", (PyCFunction)PyROOT::PyObjRefCounterAsStdAny, METH_VARARGS,
     (char *)"Wrap a reference count to any Python object in a std::any for resource management in C++"},
+   {(char *)"RVecAdoptBuffer", (PyCFunction)PyROOT::RVecAdoptBuffer, METH_VARARGS,
+    (char *)"Construct an RVec adopting the memory of a Python buffer without copying"},
+   {(char *)"RVecAsMemoryView", (PyCFunction)PyROOT::RVecAsMemoryView, METH_VARARGS,
+    (char *)"Expose the data of an RVec as a Python memoryview without copying"},
    {NULL, NULL, 0, NULL}};
 
 struct module_state {
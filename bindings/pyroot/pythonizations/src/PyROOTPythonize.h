@@ -29,6 +29,9 @@ PyObject *AddTObjectEqNePyz(PyObject *self, PyObject *args);
 
 PyObject *CPPInstanceExpand(PyObject *self, PyObject *args);
 
+PyObject *RVecAdoptBuffer(PyObject *self, PyObject *args);
+PyObject *RVecAsMemoryView(PyObject *self, PyObject *args);
+
 } // namespace PyROOT
 
 #endif // !PYROOT_PYTHONIZE_H
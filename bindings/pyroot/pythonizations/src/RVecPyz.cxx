@@ -0,0 +1,125 @@
+// Author: PyROOT team
+
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Bindings
+#include "PyROOTPythonize.h"
+
+// Cppyy
+#include "CPyCppyy/API.h"
+
+// ROOT
+#include "ROOT/RVec.hxx"
+
+namespace {
+
+// Wrap a memory-adopting RVec around the given buffer and hand it to Python
+template <typename T>
+PyObject *MakeAdoptingRVec(void *data, Py_ssize_t nelem, const char *klass)
+{
+   auto *vec = new ROOT::RVec<T>(reinterpret_cast<T *>(data), nelem);
+   return CPyCppyy::Instance_FromVoidPtr(vec, klass, /*python_owns=*/true);
+}
+
+// Expose the contiguous data of an RVec proxy as a writable memoryview
+template <typename T>
+PyObject *MakeRVecView(void *ptr)
+{
+   auto *vec = reinterpret_cast<ROOT::RVec<T> *>(ptr);
+   return PyMemoryView_FromMemory(reinterpret_cast<char *>(vec->data()),
+                                  static_cast<Py_ssize_t>(vec->size() * sizeof(T)), PyBUF_WRITE);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Construct an RVec adopting the memory of a Python buffer
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args [0] An object implementing the buffer protocol with
+///                 C-contiguous data of a fundamental type (e.g. a NumPy
+///                 array or an array.array).
+///
+/// Creates an RVec of the matching fundamental type in memory-adoption mode,
+/// i.e. a view on the buffer without copying or per-element conversion. The
+/// caller must keep the buffer-exporting object alive for as long as the
+/// returned RVec (or anything derived from it by reference) is in use.
+PyObject *PyROOT::RVecAdoptBuffer(PyObject * /*self*/, PyObject *args)
+{
+   PyObject *obj = nullptr;
+   if (!PyArg_ParseTuple(args, "O:RVecAdoptBuffer", &obj))
+      return nullptr;
+
+   Py_buffer view;
+   if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+      return nullptr;
+
+   const char *fmt = view.format ? view.format : "B";
+   const Py_ssize_t n = view.itemsize > 0 ? view.len / view.itemsize : 0;
+   void *data = view.buf;
+
+   PyObject *result = nullptr;
+   switch (fmt[0]) {
+   case 'b': result = MakeAdoptingRVec<signed char>(data, n, "ROOT::VecOps::RVec<signed char>"); break;
+   case 'B': result = MakeAdoptingRVec<unsigned char>(data, n, "ROOT::VecOps::RVec<unsigned char>"); break;
+   case 'h': result = MakeAdoptingRVec<short>(data, n, "ROOT::VecOps::RVec<short>"); break;
+   case 'H': result = MakeAdoptingRVec<unsigned short>(data, n, "ROOT::VecOps::RVec<unsigned short>"); break;
+   case 'i': result = MakeAdoptingRVec<int>(data, n, "ROOT::VecOps::RVec<int>"); break;
+   case 'I': result = MakeAdoptingRVec<unsigned int>(data, n, "ROOT::VecOps::RVec<unsigned int>"); break;
+   case 'l': result = MakeAdoptingRVec<long>(data, n, "ROOT::VecOps::RVec<long>"); break;
+   case 'L': result = MakeAdoptingRVec<unsigned long>(data, n, "ROOT::VecOps::RVec<unsigned long>"); break;
+   case 'q': result = MakeAdoptingRVec<long long>(data, n, "ROOT::VecOps::RVec<long long>"); break;
+   case 'Q': result = MakeAdoptingRVec<unsigned long long>(data, n, "ROOT::VecOps::RVec<unsigned long long>"); break;
+   case 'f': result = MakeAdoptingRVec<float>(data, n, "ROOT::VecOps::RVec<float>"); break;
+   case 'd': result = MakeAdoptingRVec<double>(data, n, "ROOT::VecOps::RVec<double>"); break;
+   default: PyErr_Format(PyExc_TypeError, "cannot adopt buffer of format '%s' as an RVec", fmt);
+   }
+
+   PyBuffer_Release(&view);
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Expose the data of an RVec as a Python memoryview without copying
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args [0] Proxy of the RVec object.
+///                 [1] Buffer-protocol format character of the element type
+///                 (e.g. "d" for RVec<double>).
+///
+/// Returns a writable memoryview on the contiguous data of the RVec, without
+/// copying and without per-element boxing. The view does not own the data:
+/// the RVec proxy must be kept alive for as long as the view is in use.
+PyObject *PyROOT::RVecAsMemoryView(PyObject * /*self*/, PyObject *args)
+{
+   PyObject *proxy = nullptr;
+   const char *fmt = nullptr;
+   if (!PyArg_ParseTuple(args, "Os:RVecAsMemoryView", &proxy, &fmt))
+      return nullptr;
+
+   void *ptr = CPyCppyy::Instance_AsVoidPtr(proxy);
+   if (!ptr) {
+      PyErr_SetString(PyExc_TypeError, "RVecAsMemoryView expects a cppyy proxy of an RVec");
+      return nullptr;
+   }
+
+   switch (fmt[0]) {
+   case 'b': return MakeRVecView<signed char>(ptr);
+   case 'B': return MakeRVecView<unsigned char>(ptr);
+   case 'h': return MakeRVecView<short>(ptr);
+   case 'H': return MakeRVecView<unsigned short>(ptr);
+   case 'i': return MakeRVecView<int>(ptr);
+   case 'I': return MakeRVecView<unsigned int>(ptr);
+   case 'l': return MakeRVecView<long>(ptr);
+   case 'L': return MakeRVecView<unsigned long>(ptr);
+   case 'q': return MakeRVecView<long long>(ptr);
+   case 'Q': return MakeRVecView<unsigned long long>(ptr);
+   case 'f': return MakeRVecView<float>(ptr);
+   case 'd': return MakeRVecView<double>(ptr);
+   default: PyErr_Format(PyExc_TypeError, "unsupported RVec element format '%s'", fmt); return nullptr;
+   }
+}
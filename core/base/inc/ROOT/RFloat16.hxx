@@ -146,6 +146,41 @@ inline float HalfToFloat(std::uint16_t value)
    return out;
 #endif
 }
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Convert an IEEE single-precision float to brain float (bfloat16).
+///
+/// The conversion keeps the 8 exponent bits of the float and truncates the mantissa to 7 bits,
+/// rounding to nearest with ties to even. NaN payloads are quieted so they cannot round to infinity.
+///
+/// \param[in] value The single-precision value to convert
+///
+/// \return The converted bfloat16 value
+inline std::uint16_t FloatToBFloat16(float value)
+{
+   std::uint32_t fbits;
+   std::memcpy(&fbits, &value, sizeof(float));
+   if ((fbits & 0x7FFFFFFF) > 0x7F800000)
+      return static_cast<std::uint16_t>((fbits >> 16) | 0x0040);
+   fbits += 0x7FFF + ((fbits >> 16) & 1);
+   return static_cast<std::uint16_t>(fbits >> 16);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Convert a brain float (bfloat16) to IEEE single-precision.
+///
+/// Every bfloat16 value is exactly representable as a float; the conversion just
+/// restores the truncated mantissa bits as zeros.
+///
+/// \param[in] value The bfloat16 value to convert
+///
+/// \return The converted single-precision value
+inline float BFloat16ToFloat(std::uint16_t value)
+{
+   const std::uint32_t fbits = static_cast<std::uint32_t>(value) << 16;
+   float out;
+   std::memcpy(&out, &fbits, sizeof(float));
+   return out;
+}
 } // namespace Internal
 } // namespace ROOT
 
@@ -0,0 +1,165 @@
+/// \file ROOT/RPerfStats.hxx
+/// \ingroup Base
+/// \date 2026-08-28
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPerfStats
+#define ROOT_RPerfStats
+
+#include <ROOT/RConfig.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace ROOT {
+
+class RPerfStats;
+
+// clang-format off
+/**
+\class ROOT::RPerfCounter
+\ingroup Base
+\brief An always-on, sharded performance counter with a name and a unit
+
+Increments go to one of a fixed number of cache-line-padded shards, selected
+by a per-thread index, with relaxed atomic adds: concurrent writers from
+different threads do not contend, so the counter can stay enabled on hot
+paths. Reads sum all shards and are therefore comparatively expensive; they
+are meant for monitoring, not for control flow.
+
+Counters are created through RPerfStats::RegisterCounter() and live for the
+duration of the process, so subsystems can keep raw references to them.
+*/
+// clang-format on
+class RPerfCounter {
+   friend class RPerfStats;
+
+private:
+   /// Number of shards; power of two so the thread index can be masked.
+   static constexpr unsigned kNShards = 64;
+
+   struct alignas(64) Shard_t {
+      std::atomic<std::int64_t> fValue{0};
+   };
+
+   std::string fName;
+   std::string fUnit;
+   std::string fDescription;
+   Shard_t fShards[kNShards];
+
+   /// Index of the calling thread into the shard array; threads are assigned
+   /// round-robin on first use.
+   static unsigned ThisShard();
+
+public:
+   RPerfCounter(std::string_view name, std::string_view unit, std::string_view desc)
+      : fName(name), fUnit(unit), fDescription(desc)
+   {
+   }
+   RPerfCounter(const RPerfCounter &) = delete;
+   RPerfCounter &operator=(const RPerfCounter &) = delete;
+
+   const std::string &GetName() const { return fName; }
+   const std::string &GetUnit() const { return fUnit; }
+   const std::string &GetDescription() const { return fDescription; }
+
+   R__ALWAYS_INLINE void Inc() { Add(1); }
+   R__ALWAYS_INLINE void Add(std::int64_t delta)
+   {
+      fShards[ThisShard()].fValue.fetch_add(delta, std::memory_order_relaxed);
+   }
+   /// Sum of all shards; walks kNShards atomics, do not call on hot paths.
+   std::int64_t GetValue() const;
+};
+
+// clang-format off
+/**
+\class ROOT::RPerfTimer
+\ingroup Base
+\brief Adds the wall-clock nanoseconds between construction and destruction to a counter
+
+Uses RAII as a stop watch, in the manner of RNTupleTimer; the target counter
+is expected to have unit "ns".
+*/
+// clang-format on
+class RPerfTimer {
+private:
+   using Clock_t = std::chrono::steady_clock;
+
+   RPerfCounter &fCounter;
+   Clock_t::time_point fStartTime;
+
+public:
+   explicit RPerfTimer(RPerfCounter &counter) : fCounter(counter), fStartTime(Clock_t::now()) {}
+   ~RPerfTimer()
+   {
+      fCounter.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - fStartTime).count());
+   }
+   RPerfTimer(const RPerfTimer &) = delete;
+   RPerfTimer &operator=(const RPerfTimer &) = delete;
+};
+
+// clang-format off
+/**
+\class ROOT::RPerfStats
+\ingroup Base
+\brief Process-wide registry of RPerfCounter objects
+
+Subsystems register their counters once, typically into a function-local
+static reference:
+~~~ {.cpp}
+static auto &bytesRead =
+   ROOT::RPerfStats::Instance().RegisterCounter("io.bytesRead", "B", "bytes read from storage");
+bytesRead.Add(len);
+~~~
+Counter names are hierarchical with '.' as separator, following the
+RNTupleMetrics convention. The registry owns the counters and never deletes
+them, so references stay valid for the lifetime of the process.
+
+The aggregated values can be printed or serialized as JSON with Print() and
+ToJSON(); the JSON form is suitable for live monitoring, e.g. served through
+a THttpServer command that invokes ToJSON().
+*/
+// clang-format on
+class RPerfStats {
+private:
+   /// Protects registration and lookup; reads of the counter values themselves are lock-free.
+   mutable std::mutex fMutex;
+   /// Deque for stable counter addresses across registrations.
+   std::deque<RPerfCounter> fCounters;
+
+   RPerfStats() = default;
+   RPerfStats(const RPerfStats &) = delete;
+   RPerfStats &operator=(const RPerfStats &) = delete;
+
+public:
+   static RPerfStats &Instance();
+
+   /// Returns the counter registered under `name`, creating it on first use.
+   /// If the counter already exists, `unit` and `desc` are ignored.
+   RPerfCounter &RegisterCounter(std::string_view name, std::string_view unit, std::string_view desc);
+   /// Returns the counter registered under `name` or nullptr if there is none.
+   const RPerfCounter *GetCounter(std::string_view name) const;
+
+   /// One `name|unit|description|value` line per counter.
+   void Print(std::ostream &output) const;
+   /// All counters as a JSON array of {name, unit, description, value} objects.
+   std::string ToJSON() const;
+};
+
+} // namespace ROOT
+
+#endif
@@ -180,6 +180,7 @@ public:
    static  void        AddDirectory(Bool_t add=kTRUE);
    static  Bool_t      AddDirectoryStatus();
    virtual void        Append(TObject *obj, Bool_t replace = kFALSE);
+   virtual void        Append(TObject *const *objs, Int_t n, Bool_t replace = kFALSE);
    /// Append object to this directory. \see Append(TObject*, Bool_t)
    virtual void        Add(TObject *obj, Bool_t replace = kFALSE) { Append(obj,replace); }
    virtual Int_t       AppendKey(TKey *) {return 0;}
@@ -337,48 +338,55 @@ namespace Internal {
    /// used by `auto` in that case is `TDirectory*` rather than the `Internal`
    /// type `TDirectoryAtomicAdapter`.
    struct TDirectoryAtomicAdapter {
-      // The shared pointer's lifetime is that of the thread creating this object
-      // (with the default constructor)
-      TDirectory::SharedGDirectory_t &fValue;
-
-      TDirectoryAtomicAdapter() : fValue(TDirectory::GetSharedLocalCurrentDirectory()) {}
+      /// Return this thread's atomic gDirectory slot. The shared pointer
+      /// holding the slot lives as long as the thread, so its address is
+      /// resolved only once per thread and then cached, avoiding the function
+      /// call and shared pointer indirection on every use of `gDirectory`.
+      static std::atomic<TDirectory *> &CurrentSlot()
+      {
+         thread_local std::atomic<TDirectory *> &slot = *TDirectory::GetSharedLocalCurrentDirectory().get();
+         return slot;
+      }
 
       template <typename T>
       explicit operator T*() const {
-         return (T *)fValue->load();
+         return (T *)CurrentSlot().load();
       }
 
       operator TDirectory*() const {
-         return fValue->load();
+         return CurrentSlot().load();
       }
 
-      operator bool() const { return fValue->load() != nullptr; }
+      operator bool() const { return CurrentSlot().load() != nullptr; }
 
       bool operator==(const TDirectory *other) const {
-         return fValue->load() == other;
+         return CurrentSlot().load() == other;
       }
 
       bool operator!=(const TDirectory *other) const {
-         return fValue->load() != other;
+         return CurrentSlot().load() != other;
       }
 
       bool operator==(TDirectory *other) const {
-         return fValue->load() == other;
+         return CurrentSlot().load() == other;
       }
 
       bool operator!=(TDirectory *other) const {
-         return fValue->load() != other;
+         return CurrentSlot().load() != other;
       }
 
       TDirectory *operator=(TDirectory *newvalue) {
+         // The assignment must go through the shared pointer: the new current
+         // directory registers it to be able to reset the slot on deletion.
+         TDirectory::SharedGDirectory_t &value = TDirectory::GetSharedLocalCurrentDirectory();
          if (newvalue) {
-            newvalue->RegisterGDirectory(fValue);
+            newvalue->RegisterGDirectory(value);
          }
-         fValue->exchange(newvalue);
+         value->exchange(newvalue);
          return newvalue;
       }
 
-      TDirectory *operator->() const { return fValue->load(); }
+      TDirectory *operator->() const { return CurrentSlot().load(); }
    };
 } // Internal
 } // ROOT
@@ -52,6 +52,7 @@ public:
    virtual void       SetAction(const char *name);
    virtual void       SetAction(TObject *parent);
 
+   static Int_t       GetObjects(const TRef *refs, Int_t nrefs, TObject **objects);
    static void        SetObject(TObject *obj);
    static void        SetStaticObject(TObject *obj);
    static Int_t       AddExec(const char *name);
@@ -66,6 +66,9 @@ public:
    static void           ObjectDealloc(void *vp, size_t size);
    static void           ObjectDealloc(void *vp, void *ptr);
 
+   static void           PushObjectArena(size_t capacity);
+   static void           PopObjectArena();
+
    static void EnterStat(size_t size, void *p);
    static void RemoveStat(void *p);
    static void PrintStatistics();
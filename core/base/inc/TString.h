@@ -356,6 +356,11 @@ public:
    TString     &Append(const TString &s);
    TString     &Append(const TString &s, Ssiz_t n);
    TString     &Append(char c, Ssiz_t rep = 1);   // Append c rep times
+   TString     &AppendFormatted(const char *fmt, ...)
+#if defined(__GNUC__)
+   __attribute__((format(printf, 2, 3)))   /* 1 is the this pointer */
+#endif
+   ;
    Int_t        Atoi() const;
    Long64_t     Atoll() const;
    Double_t     Atof() const;
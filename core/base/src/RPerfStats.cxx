@@ -0,0 +1,100 @@
+/// \file RPerfStats.cxx
+/// \ingroup Base
+/// \date 2026-08-28
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RPerfStats.hxx>
+
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Threads get consecutive shard indices on first use; with more threads than
+/// shards, several threads share a shard and their relaxed adds interleave,
+/// which is still correct, merely slightly more contended.
+
+unsigned ROOT::RPerfCounter::ThisShard()
+{
+   static std::atomic<unsigned> nextIndex{0};
+   thread_local unsigned shard = nextIndex.fetch_add(1, std::memory_order_relaxed) % kNShards;
+   return shard;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::int64_t ROOT::RPerfCounter::GetValue() const
+{
+   std::int64_t sum = 0;
+   for (const auto &shard : fShards)
+      sum += shard.fValue.load(std::memory_order_relaxed);
+   return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::RPerfStats &ROOT::RPerfStats::Instance()
+{
+   static RPerfStats instance;
+   return instance;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::RPerfCounter &ROOT::RPerfStats::RegisterCounter(std::string_view name, std::string_view unit,
+                                                      std::string_view desc)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (auto &counter : fCounters) {
+      if (counter.fName == name)
+         return counter;
+   }
+   return fCounters.emplace_back(name, unit, desc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const ROOT::RPerfCounter *ROOT::RPerfStats::GetCounter(std::string_view name) const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (const auto &counter : fCounters) {
+      if (counter.fName == name)
+         return &counter;
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ROOT::RPerfStats::Print(std::ostream &output) const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (const auto &counter : fCounters) {
+      output << counter.GetName() << '|' << counter.GetUnit() << '|' << counter.GetDescription() << '|'
+             << counter.GetValue() << '\n';
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::string ROOT::RPerfStats::ToJSON() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   std::ostringstream output;
+   output << '[';
+   bool first = true;
+   for (const auto &counter : fCounters) {
+      if (!first)
+         output << ',';
+      first = false;
+      output << "{\"name\":\"" << counter.GetName() << "\",\"unit\":\"" << counter.GetUnit()
+             << "\",\"description\":\"" << counter.GetDescription() << "\",\"value\":" << counter.GetValue() << '}';
+   }
+   output << ']';
+   return output.str();
+}
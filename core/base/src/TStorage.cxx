@@ -32,6 +32,8 @@ and statistics gathering in the system.
 
 #include <stdlib.h>
 
+#include <vector>
+
 #include "TROOT.h"
 #include "TObjectTable.h"
 #include "TError.h"
@@ -281,15 +283,92 @@ Int_t *TStorage::ReAllocInt(Int_t *ovp, size_t size, size_t oldsize)
    return vp;
 }
 
+namespace {
+
+/// A bump allocator block pushed by TStorage::PushObjectArena(); owned by the
+/// calling thread.
+struct ObjectArena_t {
+   char   *fStart;    // block obtained from global operator new
+   size_t  fCapacity; // block size in bytes
+   size_t  fUsed;     // offset of the first free byte
+};
+
+/// Stack of active arenas of the calling thread; ObjectAlloc carves from the
+/// innermost one.
+thread_local std::vector<ObjectArena_t> gObjectArenas;
+
+/// Whether vp points into one of the calling thread's active arenas.
+bool IsInObjectArena(void *vp)
+{
+   for (const auto &arena : gObjectArenas) {
+      if (vp >= arena.fStart && vp < arena.fStart + arena.fUsed)
+         return true;
+   }
+   return false;
+}
+
+} // unnamed namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Push a per-thread memory arena of `capacity` bytes. Until the matching
+/// PopObjectArena(), TObject allocations made by this thread through
+/// TObject::operator new() are carved from the arena with a bump pointer and
+/// their individual deletes become no-ops, so a framework can release all of
+/// an event's transient objects in O(1) by popping the arena.
+///
+/// The caller must ensure that no object allocated from the arena outlives
+/// the pop and that such objects are deleted (or simply dropped) by the same
+/// thread: a delete from another thread would not recognize the pointer as
+/// arena-backed and hand it to global operator delete. Objects whose
+/// destructors have side effects (e.g. kMustCleanup) still need to be
+/// destructed before the pop. Allocations that do not fit in the remaining
+/// capacity fall back to global operator new and are deleted normally.
+/// Arenas nest; allocations always come from the innermost one.
+
+void TStorage::PushObjectArena(size_t capacity)
+{
+   gObjectArenas.push_back({static_cast<char *>(::operator new(capacity)), capacity, 0});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the calling thread's innermost object arena and all allocations
+/// carved from it, see PushObjectArena().
+
+void TStorage::PopObjectArena()
+{
+   if (gObjectArenas.empty()) {
+      ::Error("TStorage::PopObjectArena", "no active object arena on this thread");
+      return;
+   }
+   ::operator delete(gObjectArenas.back().fStart);
+   gObjectArenas.pop_back();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Used to allocate a TObject on the heap (via TObject::operator new()).
 /// Directly after this routine one can call (in the TObject ctor)
 /// TStorage::FilledByObjectAlloc() to find out if the just created object is on
 /// the heap.  This technique is necessary as there is one stack per thread
 /// and we can not rely on comparison with the current stack memory position.
+///
+/// If the calling thread has an active arena (see PushObjectArena()) with
+/// enough remaining capacity, the object is carved from it instead; the
+/// kObjectAllocMemValue pattern is written either way, so the kIsOnHeap
+/// bookkeeping in the TObject constructor is unaffected.
 
 void *TStorage::ObjectAlloc(size_t sz)
 {
+   if (!gObjectArenas.empty()) {
+      auto &arena = gObjectArenas.back();
+      constexpr size_t kAlignMask = alignof(std::max_align_t) - 1;
+      size_t offset = (arena.fUsed + kAlignMask) & ~kAlignMask;
+      if (offset + sz <= arena.fCapacity) {
+         void *space = arena.fStart + offset;
+         arena.fUsed = offset + sz;
+         memset(space, kObjectAllocMemValue, sz);
+         return space;
+      }
+   }
    void* space =  ::operator new(sz);
    memset(space, kObjectAllocMemValue, sz);
    return space;
@@ -321,6 +400,8 @@ void *TStorage::ObjectAlloc(size_t , void *vp)
 
 void TStorage::ObjectDealloc(void *vp)
 {
+   if (R__unlikely(!gObjectArenas.empty()) && IsInObjectArena(vp))
+      return;
 
    ::operator delete(vp);
 }
@@ -339,6 +420,9 @@ void TStorage::ObjectDealloc(void *vp, void *ptr)
 
 void TStorage::ObjectDealloc(void *vp, size_t size)
 {
+   if (R__unlikely(!gObjectArenas.empty()) && IsInObjectArena(vp))
+      return;
+
    ::operator delete(vp, size);
 }
 
@@ -38,6 +38,7 @@ as a TString, construct a TString from it, eg:
 #include <ROOT/RConfig.hxx>
 #include <stdlib.h>
 #include <ctype.h>
+#include <charconv>
 #include <list>
 #include <algorithm>
 
@@ -2304,28 +2305,96 @@ TObjArray *TString::Tokenize(const TString &delim) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Formats a string using a printf style format descriptor.
-/// Existing string contents will be overwritten.
+/// Format `fmt` into a per-thread buffer which is reused from call to call and
+/// return it, setting `len` to the length of the result. The returned pointer
+/// stays valid until the next call from the same thread. Trivial descriptors
+/// (plain text, a single string or integer conversion) are handled directly,
+/// skipping the full vsnprintf pass.
 
-void TString::FormImp(const char *fmt, va_list ap)
+static const char *FormatIntoArena(const char *fmt, va_list ap, Ssiz_t &len)
 {
-   Ssiz_t buflen = 20 + 20 * strlen(fmt);    // pick a number, any strictly positive number
-   buflen = Clobber(buflen); // Update buflen, as Clobber clamps length to MaxSize (if Fatal does not abort)
+   TTHREAD_TLS(char*) arena(nullptr);
+   TTHREAD_TLS(int) arenaSize(0);
+
+   if (!arena || arenaSize > 65536) {
+      // (Re)create the arena, dropping an oversized one left by a huge result.
+      delete [] arena;
+      arenaSize = 256;
+      arena = new char[arenaSize];
+   }
+
+   auto copyToArena = [&](const char *s, Ssiz_t slen) {
+      if (slen >= arenaSize) {
+         delete [] arena;
+         arenaSize = slen + 1;
+         arena = new char[arenaSize];
+      }
+      memcpy(arena, s, slen + 1);
+      len = slen;
+      return arena;
+   };
+
+   const char *pct = strchr(fmt, '%');
+   if (!pct) {
+      // No conversion at all, the format is the result.
+      return copyToArena(fmt, strlen(fmt));
+   }
+   if (pct == fmt && fmt[1] == 's' && fmt[2] == '\0') {
+      const char *s = va_arg(ap, const char *);
+      if (!s)
+         s = "(null)"; // what vsnprintf would have printed
+      return copyToArena(s, strlen(s));
+   }
+   if (pct == fmt) {
+      // Single plain integer conversion: format with to_chars.
+      Long64_t sval = 0;
+      ULong64_t uval = 0;
+      int kind = 0; // 1: signed, 2: unsigned
+      if ((fmt[1] == 'd' || fmt[1] == 'i') && !fmt[2]) {
+         sval = va_arg(ap, int);
+         kind = 1;
+      } else if (fmt[1] == 'u' && !fmt[2]) {
+         uval = va_arg(ap, unsigned int);
+         kind = 2;
+      } else if (fmt[1] == 'l') {
+         if ((fmt[2] == 'd' || fmt[2] == 'i') && !fmt[3]) {
+            sval = va_arg(ap, long);
+            kind = 1;
+         } else if (fmt[2] == 'u' && !fmt[3]) {
+            uval = va_arg(ap, unsigned long);
+            kind = 2;
+         } else if (fmt[2] == 'l') {
+            if ((fmt[3] == 'd' || fmt[3] == 'i') && !fmt[4]) {
+               sval = va_arg(ap, long long);
+               kind = 1;
+            } else if (fmt[3] == 'u' && !fmt[4]) {
+               uval = va_arg(ap, unsigned long long);
+               kind = 2;
+            }
+         }
+      }
+      if (kind) {
+         auto res = (kind == 1) ? std::to_chars(arena, arena + arenaSize - 1, sval)
+                                : std::to_chars(arena, arena + arenaSize - 1, uval);
+         *res.ptr = '\0';
+         len = res.ptr - arena;
+         return arena;
+      }
+   }
 
    va_list sap;
    R__VA_COPY(sap, ap);
 
    int n, vc = 0;
 again:
-   n = vsnprintf(GetPointer(), buflen, fmt, ap);
+   n = vsnprintf(arena, arenaSize, fmt, ap);
    // old vsnprintf's return -1 if string is truncated new ones return
    // total number of characters that would have been written
-   if (n == -1 || n >= buflen) {
-      if (n == -1)
-         buflen *= 2;
-      else
-         buflen = n+1;
-      buflen = Clobber(buflen);
+   if (n == -1 || n >= arenaSize) {
+      int newSize = (n == -1) ? 2 * arenaSize : n + 1;
+      delete [] arena;
+      arena = new char[newSize];
+      arenaSize = newSize;
       va_end(ap);
       R__VA_COPY(ap, sap);
       vc = 1;
@@ -2335,7 +2404,26 @@ again:
    if (vc)
       va_end(ap);
 
-   SetSize(strlen(Data()));
+   len = strlen(arena);
+   return arena;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Formats a string using a printf style format descriptor.
+/// Existing string contents will be overwritten.
+
+void TString::FormImp(const char *fmt, va_list ap)
+{
+   Ssiz_t len = 0;
+   const char *buf = FormatIntoArena(fmt, ap, len);
+   Ssiz_t cap = Clobber(len); // Clobber clamps the length to MaxSize (if Fatal does not abort)
+   if (len > cap)
+      len = cap;
+   char *data = GetPointer();
+   if (len > 0)
+      memcpy(data, buf, len);
+   data[len] = '\0';
+   SetSize(len);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2385,6 +2473,23 @@ TString TString::Format(const char *va_(fmt), ...)
    return str;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Append a string formatted with a printf style format descriptor to the
+/// existing contents, without creating an intermediate TString.
+/// ~~~ {.cpp}
+///   path.AppendFormatted("/%s.%d", name, cycle);
+/// ~~~
+
+TString &TString::AppendFormatted(const char *va_(fmt), ...)
+{
+   va_list ap;
+   va_start(ap, va_(fmt));
+   Ssiz_t len = 0;
+   const char *buf = FormatIntoArena(va_(fmt), ap, len);
+   va_end(ap);
+   return Append(buf, len);
+}
+
 //---- Global String Handling Functions ----------------------------------------
 
 ////////////////////////////////////////////////////////////////////////////////
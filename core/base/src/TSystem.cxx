@@ -41,6 +41,7 @@ allows a simple partial implementation for new OS'es.
 #include "TUrl.h"
 #include "TVirtualMutex.h"
 #include "TVersionCheck.h"
+#include "TMD5.h"
 #include "compiledata.h"
 #include "RConfigure.h"
 #include "THashList.h"
@@ -2425,6 +2426,25 @@ int TSystem::SendRaw(int, const void *, int, int)
    return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Send the content of several buffers in order. Platforms with
+/// scatter-gather support override this with a single gathered write; the
+/// generic implementation sends the buffers one by one through SendRaw().
+/// Returns the total number of bytes sent or the SendRaw() error code of the
+/// first failing buffer.
+
+int TSystem::SendRawV(int sock, const void *const *buffers, const int *lengths, int nbufs, int flag)
+{
+   int total = 0;
+   for (int i = 0; i < nbufs; i++) {
+      int nsent = SendRaw(sock, buffers[i], lengths[i], flag);
+      if (nsent < 0)
+         return nsent;
+      total += nsent;
+   }
+   return total;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Receive a buffer headed by a length indicator.
 
@@ -2579,6 +2599,76 @@ static void R__AddPath(TString &target, const TString &path) {
 }
 #endif
 
+// Variable recording, in the ACLiC dependency file, the combined checksum of
+// the script and its dependencies (see R__DependencyFilesChecksum).
+static const char *hash_var_prefix = "__ROOTBUILDHASH=";
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute a combined MD5 checksum of all the files listed in an ACLiC
+/// dependency file.  Tokens that are not readable files (the target, the
+/// `__ROOTBUILDVERSION=`/`__ROOTBUILDHASH=` variables and their values) are
+/// skipped, so the result only depends on the content of the script and of
+/// the headers it includes.  Returns an empty string if the dependency file
+/// cannot be read.
+
+static TString R__DependencyFilesChecksum(const TString &depfilename)
+{
+   FILE *depfile = fopen(depfilename.Data(), "r");
+   if (!depfile)
+      return "";
+
+   TMD5 combined;
+   Int_t sz = 256;
+   char *line = new char[sz];
+   line[0] = 0;
+
+   int c;
+   Int_t current = 0;
+   Int_t nested = 0;
+   while ((c = fgetc(depfile)) != EOF) {
+      if (c == '#') {
+         // skip comment
+         while ((c = fgetc(depfile)) != EOF) {
+            if (c == '\n') {
+               break;
+            }
+         }
+         continue;
+      }
+      if (isspace(c) && !nested) {
+         if (current && line[current - 1] != ':' && line[current - 1] != '=') {
+            line[current] = 0;
+
+            UChar_t digest[16];
+            if (TMD5::FileChecksum(line, digest) == 0) {
+               combined.Update(digest, 16);
+            }
+         }
+         current = 0;
+         line[0] = 0;
+      } else {
+         if (current == sz - 1) {
+            sz = 2 * sz;
+            char *newline = new char[sz];
+            memcpy(newline, line, current);
+            delete[] line;
+            line = newline;
+         }
+         if (c == '"')
+            nested = !nested;
+         else {
+            line[current] = c;
+            current++;
+         }
+      }
+   }
+   delete[] line;
+   fclose(depfile);
+
+   combined.Final();
+   return combined.AsString();
+}
+
 static void R__WriteDependencyFile(const TString & build_loc, const TString &depfilename, const TString &filename, const TString &library, const TString &libname,
                                    const TString &extension, const char *version_var_prefix, const TString &includes, const TString &defines, const TString &incPath)
 {
@@ -2709,6 +2799,21 @@ static void R__WriteDependencyFile(const TString & build_loc, const TString &dep
    if (depbuilt) depbuilt = !gSystem->Exec(adddictdep);
    if (depbuilt) depbuilt = !gSystem->Exec(addversiondep);
 
+   if (depbuilt) {
+      // Record the combined checksum of the script and its dependencies, so
+      // that a library distributed together with its dependency file can be
+      // recognized as up to date even when copying reset the file timestamps
+      // (see ACLiC.HashInvalidation in TSystem::CompileMacro).
+      TString depshash = R__DependencyFilesChecksum(depfilename);
+      if (depshash.Length()) {
+         TString addhashdep("echo ");
+         addhashdep += libname + hash_var_prefix + " \"" + depshash + "\" >> \"" + depfilename + "\"";
+         if (gDebug > 4)
+            ::Info("ACLiC", "%s", addhashdep.Data());
+         depbuilt = !gSystem->Exec(addhashdep);
+      }
+   }
+
    if (!depbuilt) {
       ::Warning("ACLiC","Failed to generate the dependency file for %s",
                 library.Data());
@@ -2796,6 +2901,21 @@ static void R__WriteDependencyFile(const TString & build_loc, const TString &dep
 /// if it does not exist yet or the macro file is newer than the shared
 /// library.
 ///
+/// The out-of-date check is based on file modification times, which breaks
+/// down when a library built once is distributed (together with its
+/// dependency file) to other nodes: copying resets the timestamps and every
+/// job recompiles.  Setting in the .rootrc
+/// ~~~ {.cpp}
+/// ACLiC.HashInvalidation: 1
+/// ~~~
+/// makes ACLiC double check a timestamp-based out-of-date verdict against
+/// the checksum of the script and its dependencies recorded in the
+/// dependency file at build time, so that a pre-staged, unmodified library
+/// is loaded as is (with no compilation or JIT involved).  To pre-stage a
+/// macro on worker nodes, build it once with `ACLiC.BuildDir` pointing to
+/// the directory to distribute and ship both the library and the matching
+/// `.d` file.
+///
 /// Of course the + and ++ notation is supported in similar way for .x and .L.
 ///
 /// Through the function TSystem::SetMakeSharedLib(), the user will be able to
@@ -3159,12 +3279,20 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
    AssignAndDelete( depfilename, ConcatFileName(depdir, BaseName(libname_noext)) );
    depfilename += "_" + extension + ".d";
 
+   // When enabled, an out-of-date verdict based on file timestamps is double
+   // checked against the checksum of the script and its dependencies recorded
+   // in the dependency file: libraries pre-staged on a worker node keep their
+   // validity even though copying reset the timestamps.
+   Bool_t useBuildHash = gEnv->GetValue("ACLiC.HashInvalidation", 0) != 0;
+   Bool_t depRegenerated = kFALSE;
+
    if ( !recompile ) {
 
       Long_t lib_time, file_time;
 
       if ((gSystem->GetPathInfo( library, nullptr, (Long_t*)nullptr, nullptr, &lib_time ) != 0) ||
-          (gSystem->GetPathInfo( expFileName, nullptr, (Long_t*)nullptr, nullptr, &file_time ) == 0 &&
+          (!useBuildHash &&
+           gSystem->GetPathInfo( expFileName, nullptr, (Long_t*)nullptr, nullptr, &file_time ) == 0 &&
           (lib_time < file_time))) {
 
          // the library does not exist or is older than the script.
@@ -3180,6 +3308,10 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
                depfilename += "_" + extension + ".d";
             }
             R__WriteDependencyFile(build_loc, depfilename, filename_fullpath, library, libname, extension, version_var_prefix, includes, defines, incPath);
+            // A dependency file generated now records the checksum of the
+            // current sources, not of the ones the library was built from:
+            // it must not be used to veto a timestamp-based rebuild.
+            depRegenerated = kTRUE;
          }
       }
 
@@ -3196,6 +3328,7 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
          } else {
 
             TString version_var = libname + version_var_prefix;
+            TString hash_var = libname + hash_var_prefix;
 
             Int_t sz = 256;
             char *line = new char[sz];
@@ -3205,6 +3338,9 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
             Int_t current = 0;
             Int_t nested = 0;
             Bool_t hasversion = false;
+            Bool_t hashash = false;
+            Bool_t badversion = kFALSE;
+            TString dephash;
 
             while ((c = fgetc(depfile)) != EOF) {
                if (c=='#') {
@@ -3222,6 +3358,12 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
                   hasversion = kTRUE;
                   line[0] = 0;
                   current = 0;
+               } else if (current && line[current-1]=='=' && strncmp(hash_var.Data(),line,current)==0) {
+
+                  // The next word will be the dependency checksum.
+                  hashash = kTRUE;
+                  line[0] = 0;
+                  current = 0;
                } else if (isspace(c) && !nested) {
                   if (current) {
                      if (line[current-1]!=':') {
@@ -3230,8 +3372,11 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
 
                         Long_t filetime;
                         if (hasversion) {
-                           modified |= strcmp(ROOT_RELEASE,line)!=0;
+                           badversion |= strcmp(ROOT_RELEASE,line)!=0;
                            hasversion = kFALSE;
+                        } else if (hashash) {
+                           dephash = line;
+                           hashash = kFALSE;
                         } else if ( gSystem->GetPathInfo( line, nullptr, (Long_t*)nullptr, nullptr, &filetime ) == 0 ) {
                            modified |= ( lib_time <= filetime );
                         }
@@ -3256,6 +3401,15 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
             }
             delete [] line;
             fclose(depfile);
+
+            if (modified && !badversion && useBuildHash && !depRegenerated && dephash.Length()) {
+               // The timestamps claim the library is out of date, but they
+               // may only reflect when the files were staged to this node:
+               // trust the content checksum recorded at build time instead.
+               if (dephash == R__DependencyFilesChecksum(depfilename))
+                  modified = kFALSE;
+            }
+            modified |= badversion;
             recompile = modified;
 
          }
@@ -2,6 +2,8 @@
 
 #include "TClass.h"
 #include "TInterpreter.h"
+#include "TNamed.h"
+#include "TRef.h"
 #include "TStreamerElement.h"
 #include "TVirtualStreamerInfo.h"
 
@@ -44,4 +46,24 @@ TEST(TRef, Exec)
    EXPECT_EQ(1, se2->GetExecID());
    EXPECT_EQ(0, se3->GetExecID());
    EXPECT_EQ(0, se4->GetExecID());
+}
+
+TEST(TRef, BatchResolve)
+{
+   TNamed a("a", "a"), b("b", "b"), c("c", "c");
+   TRef refs[4];
+   refs[0] = &a;
+   refs[1] = &b;
+   refs[2] = &c;
+   // refs[3] stays unset
+
+   TObject *objects[4];
+   EXPECT_EQ(3, TRef::GetObjects(refs, 4, objects));
+   EXPECT_EQ(&a, objects[0]);
+   EXPECT_EQ(&b, objects[1]);
+   EXPECT_EQ(&c, objects[2]);
+   EXPECT_EQ(nullptr, objects[3]);
+
+   // single-reference path resolves out of the in-memory table as well
+   EXPECT_EQ(&b, refs[1].GetObject());
 }
\ No newline at end of file
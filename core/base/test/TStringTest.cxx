@@ -15,3 +15,25 @@ TEST(TString, Basics)
    ROOT_EXPECT_ERROR(a.Append("s", -5), "TString::Replace", "Negative number of replacement characters!");
    EXPECT_STREQ("test", a);
 }
+
+TEST(TString, Format)
+{
+   // Plain text, single conversion fast paths and the general printf path.
+   EXPECT_STREQ("just text", TString::Format("just text"));
+   EXPECT_STREQ("a string", TString::Format("%s", "a string"));
+   EXPECT_STREQ("-42", TString::Format("%d", -42));
+   EXPECT_STREQ("18446744073709551615", TString::Format("%llu", 18446744073709551615ULL));
+   EXPECT_STREQ("x=1 y=2.50 z=abc", TString::Format("x=%d y=%.2f z=%s", 1, 2.5, "abc"));
+   // A result larger than the initial formatting buffer.
+   TString longText('a', 5000);
+   EXPECT_EQ(5000 + 2, TString::Format("<%s>", longText.Data()).Length());
+}
+
+TEST(TString, AppendFormatted)
+{
+   TString path("/tmp");
+   path.AppendFormatted("/%s.%d", "hsimple", 7);
+   EXPECT_STREQ("/tmp/hsimple.7", path);
+   path.AppendFormatted(".bak");
+   EXPECT_STREQ("/tmp/hsimple.7.bak", path);
+}
@@ -24,13 +24,29 @@
 
 #include "TObjArray.h"
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 class TClass;
 
 class TClonesArray : public TObjArray {
 
 protected:
+   struct Slab_t {
+      std::shared_ptr<char> fMem; ///< Bulk-allocated storage for several elements
+      std::size_t           fBytes = 0; ///< Size of the slab in bytes
+   };
+
    TClass       *fClass;       //!Pointer to the class of the elements
    TObjArray    *fKeep;        //!Saved copies of pointers to objects
+   std::vector<Slab_t> fSlabs; //!Slabs of bulk-allocated element storage (see EnsureConstructed)
+   mutable Char_t fCanBypassDtor{-1}; //!Whether elements allow skipping their dtor; -1 not yet determined
+
+   Bool_t           CanBypassDestructor() const;
+   void             EnsureConstructed(Int_t n);
+   Bool_t           IsInSlab(const TObject *obj) const;
+   void             ReleaseElement(TObject *obj);
 
 public:
    enum EStatusBits {
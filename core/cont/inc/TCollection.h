@@ -148,6 +148,8 @@ protected:
 
    TString   fName;               //name of the collection
    Int_t     fSize;               //number of elements in collection
+   ROOT::TVirtualRWMutex *fRWLockImp{nullptr}; //! Dedicated lock used instead of the global one, see UseDedicatedRWLock
+   Bool_t    fOwnsRWLockImp{kFALSE}; //! True if this collection owns (and deletes) fRWLockImp
 
    TCollection() : fName(), fSize(0) { }
 
@@ -206,6 +208,8 @@ public:
    void               SetName(const char *name) { fName = name; }
    virtual void       SetOwner(Bool_t enable = kTRUE);
    virtual bool       UseRWLock(Bool_t enable = true);
+   bool               UseRWLock(ROOT::TVirtualRWMutex *lock);
+   virtual bool       UseDedicatedRWLock();
    Int_t              Write(const char *name = nullptr, Int_t option = 0, Int_t bufsize = 0) override;
    Int_t              Write(const char *name = nullptr, Int_t option = 0, Int_t bufsize = 0) const override;
 
@@ -357,7 +361,7 @@ using TRangeStaticCast = TRangeCast<T, false>;
 template <typename T>
 using TRangeDynCast = ROOT::Detail::TRangeCast<T, true>;
 
-#define R__COLL_COND_MUTEX(mutex) this->IsUsingRWLock() ? mutex : nullptr
+#define R__COLL_COND_MUTEX(mutex) this->IsUsingRWLock() ? (this->fRWLockImp ? this->fRWLockImp : mutex) : nullptr
 
 #define R__COLLECTION_READ_LOCKGUARD(mutex) ::ROOT::TReadLockGuard _R__UNIQUE_(R__readguard)(R__COLL_COND_MUTEX(mutex))
 #define R__COLLECTION_READ_LOCKGUARD_NAMED(name,mutex) ::ROOT::TReadLockGuard _NAME2_(R__readguard,name)(R__COLL_COND_MUTEX(mutex))
@@ -365,6 +369,17 @@ using TRangeDynCast = ROOT::Detail::TRangeCast<T, true>;
 #define R__COLLECTION_WRITE_LOCKGUARD(mutex) ::ROOT::TWriteLockGuard _R__UNIQUE_(R__readguard)(R__COLL_COND_MUTEX(mutex))
 #define R__COLLECTION_WRITE_LOCKGUARD_NAMED(name,mutex) ::ROOT::TWriteLockGuard _NAME2_(R__readguard,name)(R__COLL_COND_MUTEX(mutex))
 
+// Variant for operations that may run arbitrary user code (e.g. element
+// destructors during Delete/Clear) while the collection lock is held.
+// When a dedicated lock is in use, the global lock is acquired first so the
+// lock ordering stays global -> dedicated and such call-outs, which may take
+// the global lock themselves, cannot dead-lock against a thread holding the
+// global lock while accessing this collection. When no dedicated lock is in
+// use this reduces to a recursive acquisition of the global lock.
+#define R__COLLECTION_WRITE_LOCKGUARD_CALLOUT(mutex) \
+   ::ROOT::TWriteLockGuard _R__UNIQUE_(R__outerguard)(this->IsUsingRWLock() && this->fRWLockImp ? mutex : nullptr); \
+   R__COLLECTION_WRITE_LOCKGUARD(mutex)
+
 //---- R__FOR_EACH macro -------------------------------------------------------
 
 // Macro to loop over all elements of a list of type "type" while executing
@@ -54,6 +54,7 @@ public:
    const TList *GetListForObject(const char *name) const;
    const TList *GetListForObject(const TObject *obj) const;
 
+   void       AddAll(const TCollection *col) override;
    void       AddFirst(TObject *obj) override;
    void       AddFirst(TObject *obj, Option_t *opt) override;
    void       AddLast(TObject *obj) override;
@@ -67,7 +68,9 @@ public:
    void       Rehash(Int_t newCapacity);
    TObject   *Remove(TObject *obj) override;
    TObject   *Remove(TObjLink *lnk) override;
+   using TCollection::UseRWLock;
    bool       UseRWLock(Bool_t enable = true) override;
+   bool       UseDedicatedRWLock() override;
 
    ClassDefOverride(THashList,0)  //Doubly linked list with hashtable for lookup
 };
@@ -25,6 +25,8 @@
 #include "TClassRef.h"
 #include "TDataType.h"
 
+#include <vector>
+
 // Macro indicating the version of the Collection Proxy interface followed
 // by this ROOT build (See also Reflex/Builder/CollectionProxy.h).
 #define ROOT_COLLECTIONPROXY_VERSION 3
@@ -182,6 +184,47 @@ public:
    /// Return the current number of elements in the container
    virtual UInt_t Size() const = 0;
 
+   /// If the proxied container stores its values contiguously in memory (e.g. `std::vector` of a non-bool,
+   /// non-pointer type), set `data` to the address of the first element and return the number of elements.
+   /// Return -1 if no such guarantee can be given; generic proxies make none, derived classes with knowledge of
+   /// the container layout should override this function.
+   virtual Long64_t GetContiguousData(void *&data)
+   {
+      data = nullptr;
+      return -1;
+   }
+
+   /// For a container whose value type is itself a collection, e.g. `std::vector<std::vector<float>>`, fill
+   /// `innerData` with the address of each inner collection's contiguous payload and `offsets` with the cumulative
+   /// element counts (`Size() + 1` entries, starting at 0), in a single pass over the outer container.
+   /// Return false if the inner collections do not store their values contiguously (see `GetContiguousData()`) or
+   /// if the value type is not a collection; in that case the contents of `innerData` and `offsets` are undefined.
+   virtual Bool_t GetNestedData(std::vector<void *> &innerData, std::vector<UInt_t> &offsets)
+   {
+      innerData.clear();
+      offsets.clear();
+      TClass *valueClass = GetValueClass();
+      TVirtualCollectionProxy *inner = valueClass ? valueClass->GetCollectionProxy() : nullptr;
+      if (!inner || HasPointers())
+         return kFALSE;
+      const UInt_t siz = Size();
+      innerData.reserve(siz);
+      offsets.reserve(siz + 1);
+      offsets.push_back(0);
+      UInt_t total = 0;
+      for (UInt_t i = 0; i < siz; ++i) {
+         TPushPop pushPop(inner, At(i));
+         void *data = nullptr;
+         const Long64_t n = inner->GetContiguousData(data);
+         if (n < 0)
+            return kFALSE;
+         innerData.push_back(data);
+         total += (UInt_t)n;
+         offsets.push_back(total);
+      }
+      return kTRUE;
+   }
+
    /// Allocates space for storing at least `n` elements.  This function returns a pointer to the actual object on
    /// which insertions should take place.  For associative collections, this function returns a pointer to a temporary
    /// buffer known as the staging area.  If the insertion happened in a staging area (i.e. the returned pointer !=
@@ -127,10 +127,14 @@ When investigating misuse of TClonesArray, please make sure of the following:
 
 #include "TError.h"
 #include "TROOT.h"
+#include "TBaseClass.h"
 #include "TBuffer.h"
 #include "TClass.h"
+#include "TDataMember.h"
 #include "TObject.h"
 #include "TObjectTable.h"
+#include "TVirtualStreamerInfo.h"
+#include "TStreamerElement.h"
 #include "snprintf.h"
 
 #include <cstdlib>
@@ -258,10 +262,11 @@ TClonesArray& TClonesArray::operator=(const TClonesArray& tc)
 
    for (i = 0; i < fSize; i++)
       if (fKeep->fCont[i]) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseElement(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
          fCont[i] = nullptr;
       }
+   fSlabs.clear();
 
    BypassStreamer(kTRUE);
 
@@ -282,7 +287,7 @@ TClonesArray::~TClonesArray()
 {
    if (fKeep) {
       for (Int_t i = 0; i < fKeep->fSize; i++) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseElement(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
       }
    }
@@ -326,6 +331,135 @@ void TClonesArray::BypassStreamer(Bool_t bypass)
       ResetBit(kBypassStreamer);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the destructor of the elements can be bypassed: a compiled
+/// class with no user provided destructor, whose only base class is TObject
+/// and whose data members - including the transient ones, which never appear
+/// in the streamer info - are all of fundamental types, enums or raw pointers
+/// (or fixed size arrays thereof), i.e. types a compiler generated destructor
+/// does nothing for. For such a class the destructor only resets the
+/// kNotDeleted bit, which Delete() exploits to avoid one virtual destructor
+/// dispatch per element. The verdict is computed once and cached.
+
+Bool_t TClonesArray::CanBypassDestructor() const
+{
+   if (fCanBypassDtor != -1)
+      return fCanBypassDtor == 1;
+
+   fCanBypassDtor = 0;
+   if (!fClass || fClass->GetState() != TClass::kHasTClassInit)
+      return kFALSE;
+   if (fClass->ClassProperty() & kClassHasExplicitDtor)
+      return kFALSE;
+
+   TList *bases = fClass->GetListOfBases();
+   if (bases) {
+      TIter nextBase(bases);
+      TBaseClass *base;
+      while ((base = (TBaseClass *)nextBase())) {
+         if (base->GetClassPointer() != TObject::Class())
+            return kFALSE;
+      }
+   }
+
+   // Scan the real data members rather than the streamer elements: transient
+   // members do not make it into the streamer info, but their destructors run
+   // all the same.
+   TList *members = fClass->GetListOfDataMembers();
+   if (!members)
+      return kFALSE;
+   TIter nextMember(members);
+   TDataMember *member;
+   while ((member = (TDataMember *)nextMember())) {
+      if (member->Property() & kIsStatic)
+         continue;
+      if (member->IsBasic() || member->IsEnum())
+         continue;
+      // a compiler generated destructor does not release raw pointers, so
+      // bypassing it keeps the same (absent) cleanup
+      if (member->IsaPointer())
+         continue;
+      // anything of class type (std::string, containers, nested objects, ...)
+      // may have a non-trivial destructor
+      return kFALSE;
+   }
+
+   fCanBypassDtor = 1;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make sure the first n entries of fKeep hold constructed objects and
+/// publish them in fCont. The memory for the missing elements is carved in
+/// bulk from a single slab allocation instead of one heap allocation per
+/// element. The slab is owned (shared, see AbsorbObjects) by the array and
+/// released only when the last array referencing it is destroyed.
+
+void TClonesArray::EnsureConstructed(Int_t n)
+{
+   Int_t nmissing = 0;
+   for (Int_t i = 0; i < n; i++)
+      if (!fKeep->fCont[i])
+         nmissing++;
+
+   char *slot = nullptr;
+   Int_t elsize = fClass->Size();
+   if (nmissing > 1 && elsize > 0) {
+      std::size_t bytes = (std::size_t)nmissing * elsize;
+      std::shared_ptr<char> mem((char *)::operator new(bytes), [](char *p) { ::operator delete(p); });
+      fSlabs.push_back({mem, bytes});
+      slot = mem.get();
+   }
+
+   for (Int_t i = 0; i < n; i++) {
+      if (!fKeep->fCont[i]) {
+         if (slot) {
+            fKeep->fCont[i] = (TObject *)fClass->New(slot);
+            slot += elsize;
+         } else {
+            fKeep->fCont[i] = (TObject *)fClass->New();
+         }
+      } else if (fKeep->fCont[i]->IsDestructed()) {
+         // The object has been deleted (or never initialized)
+         fClass->New(fKeep->fCont[i]);
+      }
+      fCont[i] = fKeep->fCont[i];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the object's storage was carved from one of the slabs.
+
+Bool_t TClonesArray::IsInSlab(const TObject *obj) const
+{
+   const char *p = (const char *)obj;
+   for (const auto &slab : fSlabs)
+      if (p >= slab.fMem.get() && p < slab.fMem.get() + slab.fBytes)
+         return kTRUE;
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release one kept element, calling its destructor if it has not been called
+/// yet. Elements carved from a slab only get their destructor called: their
+/// storage belongs to the slab and is released with it.
+
+void TClonesArray::ReleaseElement(TObject *obj)
+{
+   if (obj && IsInSlab(obj)) {
+      if (!obj->IsDestructed()) {
+         if (fClass->GetState() == TClass::kEmulated)
+            fClass->Destructor(obj, kTRUE);
+         else
+            obj->~TObject();
+      } else if (TObject::GetObjectStat() && gObjectTable) {
+         gObjectTable->RemoveQuietly(obj);
+      }
+      return;
+   }
+   R__ReleaseMemory(fClass, obj);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Remove empty slots from array.
 
@@ -451,7 +585,20 @@ void TClonesArray::Clear(Option_t *option)
 
 void TClonesArray::Delete(Option_t *)
 {
-   if (fClass->GetState() == TClass::kEmulated)
+   if (CanBypassDestructor() && !TObject::GetObjectStat() && !ROOT::Internal::DeleteChangesMemory()) {
+      // The element destructors would only reset the kNotDeleted bit (no
+      // member owns resources), so mark the objects destructed wholesale
+      // instead of dispatching a virtual destructor call per element.
+      for (Int_t i = 0; i < fSize; i++) {
+         TObject *obj = fCont[i];
+         if (obj && !obj->IsDestructed()) {
+            if (obj->TestBit(kMustCleanup))
+               obj->~TObject(); // needs the RecursiveRemove call-out
+            else
+               obj->fBits &= ~kNotDeleted;
+         }
+      }
+   } else if (fClass->GetState() == TClass::kEmulated)
    {
       // In case of emulated class, we can not use the delete operator
       // directly, it would use the wrong destructor.
@@ -494,7 +641,7 @@ void TClonesArray::Expand(Int_t newSize)
       // Expand() will shrink correctly
       for (int i = newSize; i < fSize; i++)
          if (fKeep->fCont[i]) {
-            R__ReleaseMemory(fClass,fKeep->fCont[i]);
+            ReleaseElement(fKeep->fCont[i]);
             fKeep->fCont[i] = nullptr;
          }
    }
@@ -524,20 +671,11 @@ void TClonesArray::ExpandCreate(Int_t n)
    if (n > fSize)
       Expand(TMath::Max(n, GrowBy(fSize)));
 
-   Int_t i;
-   for (i = 0; i < n; i++) {
-      if (!fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
-      } else if (fKeep->fCont[i]->IsDestructed()) {
-         // The object has been deleted (or never initialized)
-         fClass->New(fKeep->fCont[i]);
-      }
-      fCont[i] = fKeep->fCont[i];
-   }
+   EnsureConstructed(n);
 
-   for (i = n; i < fSize; i++)
+   for (Int_t i = n; i < fSize; i++)
       if (fKeep->fCont[i]) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseElement(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
          fCont[i] = nullptr;
       }
@@ -557,20 +695,11 @@ void TClonesArray::ExpandCreate(Int_t n)
 
 void TClonesArray::ExpandCreateFast(Int_t n)
 {
-   Int_t oldSize = fKeep->GetSize();
    if (n > fSize)
       Expand(TMath::Max(n, GrowBy(fSize)));
 
-   Int_t i;
-   for (i = 0; i < n; i++) {
-      if (i >= oldSize || !fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
-      } else if (fKeep->fCont[i]->IsDestructed()) {
-         // The object has been deleted (or never initialized)
-         fClass->New(fKeep->fCont[i]);
-      }
-      fCont[i] = fKeep->fCont[i];
-   }
+   EnsureConstructed(n);
+
    if (fLast >= n) {
       memset(fCont + n, 0, (fLast - n + 1) * sizeof(TObject*));
    }
@@ -669,6 +798,7 @@ void TClonesArray::SetClass(const TClass *cl, Int_t s)
       return;
    }
    fClass = (TClass*)cl;
+   fCanBypassDtor = -1;
    if (!fClass) {
       MakeZombie();
       Error("SetClass", "called with a null pointer");
@@ -793,6 +923,7 @@ void TClonesArray::Streamer(TBuffer &b)
          // If fClass' name is different from classv, the user has intentionally changed
          // the target class, so we must not override it.
          fClass = cl;
+         fCanBypassDtor = -1;
          //this case may happen when switching from an emulated class to the real class
          //may not be an error. fClass may point to a deleted object
          //Error("Streamer", "expecting objects of type %s, finding objects"
@@ -810,16 +941,7 @@ void TClonesArray::Streamer(TBuffer &b)
 
       //TStreamerInfo *sinfo = fClass->GetStreamerInfo(clv);
       if (CanBypassStreamer() && !b.TestBit(TBuffer::kCannotHandleMemberWiseStreaming)) {
-         for (Int_t i = 0; i < nobjects; i++) {
-            if (!fKeep->fCont[i]) {
-               fKeep->fCont[i] = (TObject*)fClass->New();
-            } else if (fKeep->fCont[i]->IsDestructed()) {
-               // The object has been deleted (or never initialized)
-               fClass->New(fKeep->fCont[i]);
-            }
-
-            fCont[i] = fKeep->fCont[i];
-         }
+         EnsureConstructed(nobjects);
          if (clv < 8 && classv == "TF1") {
             // To allow backward compatibility of TClonesArray of v5 TF1 objects
             // that were stored member-wise.
@@ -1034,12 +1156,25 @@ void TClonesArray::AbsorbObjects(TClonesArray *tc, Int_t idx1, Int_t idx2)
    for (Int_t i = idx1; i <= idx2; i++) {
       Int_t newindex = oldSize+i -idx1;
       fCont[newindex] = tc->fCont[i];
-      R__ReleaseMemory(fClass,fKeep->fCont[newindex]);
+      ReleaseElement(fKeep->fCont[newindex]);
       (*fKeep)[newindex] = (*(tc->fKeep))[i];
       tc->fCont[i] = nullptr;
       (*(tc->fKeep))[i] = nullptr;
    }
 
+   // The absorbed objects may have their storage in tc's slabs; share the
+   // ownership of those slabs so the storage outlives tc.
+   for (const auto &slab : tc->fSlabs) {
+      Bool_t known = kFALSE;
+      for (const auto &mine : fSlabs)
+         if (mine.fMem == slab.fMem) {
+            known = kTRUE;
+            break;
+         }
+      if (!known)
+         fSlabs.push_back(slab);
+   }
+
    // cleanup
    for (Int_t i = idx2+1; i < tc->GetEntriesFast(); i++) {
       tc->fCont[i-(idx2-idx1+1)] = tc->fCont[i];
@@ -218,6 +218,9 @@ TCollection::~TCollection()
 {
    // Required since we overload TObject::Hash.
    ROOT::CallRecursiveRemoveIfNeeded(*this);
+
+   if (fOwnsRWLockImp)
+      delete fRWLockImp;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -800,6 +803,53 @@ bool TCollection::UseRWLock(Bool_t enable)
    return prev;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set this collection to use the given RW lock, which it does not own,
+/// instead of the global `ROOT::gCoreMutex` upon access. Passing `nullptr`
+/// reverts to the global lock. Return the previous state of the lock usage.
+///
+/// See UseDedicatedRWLock for the constraints that apply when a collection is
+/// no longer guarded by the global lock.
+
+bool TCollection::UseRWLock(ROOT::TVirtualRWMutex *lock)
+{
+   if (fOwnsRWLockImp && fRWLockImp != lock)
+      delete fRWLockImp;
+   fRWLockImp = lock;
+   fOwnsRWLockImp = kFALSE;
+   return UseRWLock(lock != nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set this collection to use its own, dedicated RW lock upon access instead
+/// of the global `ROOT::gCoreMutex`, making it thread safe without serializing
+/// against every other lock-protected collection in the process. Return the
+/// previous state of the lock usage.
+///
+/// Concurrent Add/FindObject/Remove on two collections with dedicated locks
+/// (e.g. the lists of objects of two distinct TDirectory) then proceed in
+/// parallel, while operations on the same collection still synchronize
+/// through its own lock.
+///
+/// This is an opt-in: it must only be used for collections whose elements
+/// implement Hash(), name comparison and IsEqual() without taking the global
+/// lock (true for TNamed and TObject), and that are not iterated by outside
+/// code relying on the global lock for protection; such code must instead
+/// synchronize through the collection's member functions.
+///
+/// The dedicated lock is created through `ROOT::gCoreMutex`, so this has no
+/// effect (beyond enabling the kUseRWLock bit) before ROOT::EnableThreadSafety
+/// has been called.
+
+bool TCollection::UseDedicatedRWLock()
+{
+   if (!fRWLockImp && ROOT::gCoreMutex) {
+      fRWLockImp = ROOT::gCoreMutex->Factory(kTRUE);
+      fOwnsRWLockImp = kTRUE;
+   }
+   return UseRWLock(kTRUE);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy a TIter. This involves allocating a new TIterator of the right
 /// sub class and assigning it with the original.
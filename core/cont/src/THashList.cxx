@@ -63,6 +63,17 @@ THashList::~THashList()
    SafeDelete(fTable);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add all objects from collection col to this collection. The write lock is
+/// taken once for the whole bulk instead of once per added object.
+
+void THashList::AddAll(const TCollection *col)
+{
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   TCollection::AddAll(col);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add object at the beginning of the list.
 
@@ -188,7 +199,7 @@ Float_t THashList::AverageCollisions() const
 
 void THashList::Clear(Option_t *option)
 {
-   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   R__COLLECTION_WRITE_LOCKGUARD_CALLOUT(ROOT::gCoreMutex);
 
    fTable->Clear("nodelete");  // clear table so not more lookups
    if (IsOwner())
@@ -206,7 +217,7 @@ void THashList::Clear(Option_t *option)
 
 void THashList::Delete(Option_t *option)
 {
-   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   R__COLLECTION_WRITE_LOCKGUARD_CALLOUT(ROOT::gCoreMutex);
 
    Bool_t slow = option ? (!strcmp(option, "slow") ? kTRUE : kFALSE) : kFALSE;
 
@@ -411,3 +422,18 @@ bool THashList::UseRWLock(Bool_t enable)
    fTable->UseRWLock(enable);
    return TCollection::UseRWLock(enable);
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set this collection to use its own, dedicated RW lock upon access instead
+/// of the global `ROOT::gCoreMutex`. Return the previous state.
+///
+/// The underlying hash table shares the list's lock, so list and table stay
+/// consistent under a single acquisition. See TCollection::UseDedicatedRWLock
+/// for the constraints that apply.
+
+bool THashList::UseDedicatedRWLock()
+{
+   bool prev = TCollection::UseDedicatedRWLock();
+   fTable->UseRWLock(fRWLockImp);
+   return prev;
+}
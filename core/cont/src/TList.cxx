@@ -399,7 +399,7 @@ TObject *TList::Before(const TObject *obj) const
 
 void TList::Clear(Option_t *option)
 {
-   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   R__COLLECTION_WRITE_LOCKGUARD_CALLOUT(ROOT::gCoreMutex);
    R__COLLECTION_WRITE_GUARD();
 
    Bool_t nodel = option ? (!strcmp(option, "nodelete") ? kTRUE : kFALSE) : kFALSE;
@@ -467,7 +467,7 @@ void TList::Clear(Option_t *option)
 
 void TList::Delete(Option_t *option)
 {
-   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   R__COLLECTION_WRITE_LOCKGUARD_CALLOUT(ROOT::gCoreMutex);
    R__COLLECTION_WRITE_GUARD();
 
    Bool_t slow = option ? (!strcmp(option, "slow") ? kTRUE : kFALSE) : kFALSE;
@@ -367,7 +367,7 @@ void TObjArray::Delete(Option_t * /* opt */)
    // from using Draw to Paint) but the structure might still exist elsewhere
    // so we keep this comment here.
 
-   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   R__COLLECTION_WRITE_LOCKGUARD_CALLOUT(ROOT::gCoreMutex);
 
    // Since we set fCont[i] only after the deletion is completed, we do not
    // lose the connection and thus do not need to take any special action.
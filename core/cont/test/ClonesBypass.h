@@ -0,0 +1,39 @@
+/**
+ * Test classes for the TClonesArray destructor bypass
+ * (TClonesArray::CanBypassDestructor).
+ */
+
+#ifndef ROOT_ClonesBypass
+#define ROOT_ClonesBypass
+
+#include "TObject.h"
+
+// Counts destructor executions so that tests can verify whether the element
+// destructors were bypassed.
+struct ClonesBypassCounter {
+   static inline int fgDestroyed = 0;
+   ~ClonesBypassCounter() { ++fgDestroyed; }
+};
+
+// Only fundamental members and no user provided destructor: the destructor
+// of the elements may be bypassed by TClonesArray::Delete.
+class ClonesBypassPlain : public TObject {
+public:
+   Int_t fA = 0;
+   Double_t fB[3] = {0., 0., 0.};
+
+   ClassDefOverride(ClonesBypassPlain, 1)
+};
+
+// Identical on disk, but with a transient member whose destructor is not
+// trivial: the bypass must be refused even though the member never appears in
+// the streamer info.
+class ClonesBypassTransient : public TObject {
+public:
+   Int_t fA = 0;
+   ClonesBypassCounter fScratch; //! transient member with a non-trivial destructor
+
+   ClassDefOverride(ClonesBypassTransient, 1)
+};
+
+#endif
@@ -0,0 +1,10 @@
+#ifdef __CLING__
+
+#pragma link off all globals;
+#pragma link off all classes;
+#pragma link off all functions;
+
+#pragma link C++ class ClonesBypassPlain+;
+#pragma link C++ class ClonesBypassTransient+;
+
+#endif
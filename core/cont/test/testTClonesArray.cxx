@@ -0,0 +1,31 @@
+#include "gtest/gtest.h"
+
+#include "TClonesArray.h"
+
+#include "ClonesBypass.h"
+
+TEST(TClonesArray, DeleteBypassableElements)
+{
+   TClonesArray arr("ClonesBypassPlain", 8);
+   for (int i = 0; i < 8; ++i)
+      arr.ConstructedAt(i);
+   EXPECT_EQ(8, arr.GetEntriesFast());
+   arr.Delete();
+   EXPECT_EQ(0, arr.GetEntriesFast());
+}
+
+// A transient member with a non-trivial destructor must force Delete to run
+// the real destructors: bypassing them would leak the member's resources.
+TEST(TClonesArray, DeleteRunsDtorForTransientMember)
+{
+   ClonesBypassCounter::fgDestroyed = 0;
+   {
+      TClonesArray arr("ClonesBypassTransient", 8);
+      for (int i = 0; i < 8; ++i)
+         arr.ConstructedAt(i);
+      arr.Delete();
+      EXPECT_EQ(8, ClonesBypassCounter::fgDestroyed);
+   }
+   // the destructors must not run a second time when the array goes away
+   EXPECT_EQ(8, ClonesBypassCounter::fgDestroyed);
+}
@@ -2647,7 +2647,8 @@ int FinalizeStreamerInfoWriting(cling::Interpreter &interp, bool writeEmptyRootP
 
 int GenerateFullDict(std::ostream &dictStream, std::string dictName, cling::Interpreter &interp, RScanner &scan,
                      const ROOT::TMetaUtils::RConstructorTypes &ctorTypes, bool isSplit, bool isGenreflex,
-                     bool isSelXML, bool writeEmptyRootPCM)
+                     bool isSelXML, bool writeEmptyRootPCM,
+                     const std::vector<std::ostream *> &classCodeShards = {})
 {
    ROOT::TMetaUtils::TNormalizedCtxt normCtxt(interp.getLookupHelper());
 
@@ -2756,15 +2757,21 @@ int GenerateFullDict(std::ostream &dictStream, std::string dictName, cling::Inte
          EmitStreamerInfo(selClass.GetNormalizedName());
       }
    }
-   // Loop to write all the ClassCode
+   // Loop to write all the ClassCode. When shard streams are provided the
+   // classes are distributed over them round robin in selection order, which
+   // keeps the generated code deterministic while allowing the shards to be
+   // compiled in parallel.
+   unsigned int shardIndex = 0;
    for (auto const &selClass : scan.fSelectedClasses) {
+      std::ostream &classCodeStream =
+         classCodeShards.empty() ? dictStream : *classCodeShards[shardIndex++ % classCodeShards.size()];
       // The "isGenreflex" parameter allows the distinction between
       // genreflex and rootcling only for the treatment of collections which
       // are data members. To preserve the behaviour of the original
       // genreflex and rootcling tools, if the selection is performed with
       // genreflex, data members with collection type do not trigger the
       // selection of the collection type
-      ROOT::TMetaUtils::WriteClassCode(&CallWriteStreamer, selClass, interp, normCtxt, dictStream, ctorTypes,
+      ROOT::TMetaUtils::WriteClassCode(&CallWriteStreamer, selClass, interp, normCtxt, classCodeStream, ctorTypes,
                                        isGenreflex);
    }
 
@@ -2998,11 +3005,14 @@ private:
 /// Transform name of dictionary
 
 std::ostream *CreateStreamPtrForSplitDict(const std::string &dictpathname,
-      tempFileNamesCatalog &tmpCatalog)
+      tempFileNamesCatalog &tmpCatalog, unsigned int shard = 0)
 {
    std::string splitDictName(tmpCatalog.getFileName(dictpathname));
    const size_t dotPos = splitDictName.find_last_of(".");
-   splitDictName.insert(dotPos, "_classdef");
+   std::string suffix("_classdef");
+   if (shard > 0)
+      suffix += "_" + std::to_string(shard);
+   splitDictName.insert(dotPos, suffix);
    tmpCatalog.addFileName(splitDictName);
    return new std::ofstream(splitDictName.c_str());
 }
@@ -3762,6 +3772,14 @@ gOptSplit("split",
          llvm::cl::desc("Split the dictionary into two parts: one containing the IO (ClassDef)\
 information and another the interactivity support."),
          llvm::cl::cat(gRootclingOptions));
+static llvm::cl::opt<unsigned int>
+gOptSplitShards("split-shards",
+         llvm::cl::desc("With -split, distribute the per-class IO code over the given number of\
+ compilation units (<dict>_classdef.cxx, <dict>_classdef_1.cxx, ...) so they can be compiled in\
+ parallel. The classes are assigned to the shards round robin in selection order, so the\
+ generated code is deterministic."),
+         llvm::cl::init(1),
+         llvm::cl::cat(gRootclingOptions));
 static llvm::cl::opt<bool>
 gOptNoDictSelection("noDictSelection",
                    llvm::cl::Hidden,
@@ -4663,12 +4681,23 @@ int RootClingMain(int argc,
    std::ostream &dictStream = (!gOptDictionaryFileName.empty()) ? fileout : std::cout;
    bool isACLiC = gOptDictionaryFileName.getValue().find("_ACLiC_dict") != std::string::npos;
 
-   // Now generate a second stream for the split dictionary if it is necessary
+   // Now generate a second stream for the split dictionary if it is necessary,
+   // plus the additional class-code shards when requested.
+   std::vector<std::ostream *> shardStreams;
+   std::vector<std::unique_ptr<std::ostream>> shardDeleters;
+   if (gOptSplitShards > 1 && !gOptSplit)
+      ROOT::TMetaUtils::Warning(nullptr, "-split-shards is only effective together with -split, ignoring it.\n");
    if (gOptSplit) {
       splitDictStream = CreateStreamPtrForSplitDict(gOptDictionaryFileName.getValue(), tmpCatalog);
       splitDeleter.reset(splitDictStream);
+      shardStreams.push_back(splitDictStream);
+      for (unsigned int shard = 1; shard < gOptSplitShards; ++shard) {
+         shardStreams.push_back(CreateStreamPtrForSplitDict(gOptDictionaryFileName.getValue(), tmpCatalog, shard));
+         shardDeleters.emplace_back(shardStreams.back());
+      }
    } else {
       splitDictStream = &dictStream;
+      shardStreams.push_back(splitDictStream);
    }
 
    size_t dh = main_dictname.rfind('.');
@@ -4681,14 +4710,16 @@ int RootClingMain(int argc,
 
    CreateDictHeader(dictStream, main_dictname);
    if (gOptSplit)
-      CreateDictHeader(*splitDictStream, main_dictname);
+      for (std::ostream *shardStream : shardStreams)
+         CreateDictHeader(*shardStream, main_dictname);
 
    if (!gOptNoGlobalUsingStd) {
       // ACLiC'ed macros might rely on `using namespace std` in front of user headers
       if (isACLiC) {
          AddNamespaceSTDdeclaration(dictStream);
          if (gOptSplit) {
-            AddNamespaceSTDdeclaration(*splitDictStream);
+            for (std::ostream *shardStream : shardStreams)
+               AddNamespaceSTDdeclaration(*shardStream);
          }
       }
    }
@@ -4905,14 +4936,16 @@ int RootClingMain(int argc,
    if (!gOptGeneratePCH) {
       GenerateNecessaryIncludes(dictStream, includeForSource, extraIncludes);
       if (gOptSplit) {
-         GenerateNecessaryIncludes(*splitDictStream, includeForSource, extraIncludes);
+         for (std::ostream *shardStream : shardStreams)
+            GenerateNecessaryIncludes(*shardStream, includeForSource, extraIncludes);
       }
       if (!gOptNoGlobalUsingStd) {
          // ACLiC'ed macros might have relied on `using namespace std` in front of user headers
          if (!isACLiC) {
             AddNamespaceSTDdeclaration(dictStream);
             if (gOptSplit) {
-               AddNamespaceSTDdeclaration(*splitDictStream);
+               for (std::ostream *shardStream : shardStreams)
+                  AddNamespaceSTDdeclaration(*shardStream);
             }
          }
       }
@@ -4933,7 +4966,8 @@ int RootClingMain(int argc,
       AddNamespaceSTDdeclaration(dictStream);
 
       if (gOptSplit && splitDictStream) {
-         AddNamespaceSTDdeclaration(*splitDictStream);
+         for (std::ostream *shardStream : shardStreams)
+            AddNamespaceSTDdeclaration(*shardStream);
       }
    }
 
@@ -4948,7 +4982,9 @@ int RootClingMain(int argc,
       }
    } else {
       rootclingRetCode += GenerateFullDict(*splitDictStream, modGen.GetDictionaryName(), interp, scan, constructorTypes,
-                                           gOptSplit, isGenreflex, isSelXML, gOptWriteEmptyRootPCM);
+                                           gOptSplit, isGenreflex, isSelXML, gOptWriteEmptyRootPCM,
+                                           gOptSplit && shardStreams.size() > 1 ? shardStreams
+                                                                                : std::vector<std::ostream *>{});
    }
 
    if (rootclingRetCode != 0) {
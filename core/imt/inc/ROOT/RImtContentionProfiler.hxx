@@ -0,0 +1,97 @@
+// Author: The ROOT Team
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RImtContentionProfiler
+#define ROOT_RImtContentionProfiler
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/// An opt-in profiler for wait times in ROOT's implicit multi-threading.
+///
+/// When implicit multi-threading underperforms, the cause is usually invisible
+/// to the user: threads spinning for a processing slot, tasks blocked waiting
+/// for others, or lock contention. When enabled, the instrumented wait points
+/// record per-thread histograms of their wait times, and a flame-style JSON
+/// report is written when the global task arena is torn down, so I/O
+/// starvation can be told apart from contention without external tooling.
+///
+/// The profiler is off by default and the instrumented code paths only check
+/// an atomic flag in that case. It can be enabled programmatically with
+/// Enable(), or by setting the environment variable
+/// `ROOT_IMT_CONTENTION_PROFILE` to the path of the report file before the
+/// task arena is created.
+class RImtContentionProfiler {
+public:
+   /// The instrumented wait categories.
+   enum class EWaitCategory {
+      kSlotStack = 0,    ///< busy-waiting for a processing slot in RSlotStack::GetSlot()
+      kTaskGroupWait,    ///< blocked in TTaskGroup::Wait() until submitted tasks complete
+      kNCategories
+   };
+
+   /// Number of power-of-two wait time buckets; the last bucket collects all longer waits.
+   static constexpr unsigned kNBuckets = 40;
+
+   /// Enables the profiler. If a report path is given, the report is also written
+   /// there when the global task arena is torn down.
+   static void Enable(const std::string &reportPath = "");
+   static void Disable();
+   static bool IsEnabled() { return fgEnabled.load(std::memory_order_relaxed); }
+
+   /// Records a wait of the given duration; called from the instrumented wait points.
+   static void RecordWait(EWaitCategory category, std::uint64_t ns);
+
+   /// Writes the aggregated per-thread wait histograms as flame-style JSON
+   /// (nested `name`/`value`/`children` nodes, values in nanoseconds).
+   static void WriteReport(std::ostream &out);
+
+   /// Writes the report to the path passed to Enable(), if any. Called on task arena teardown.
+   static void WriteReportToFile();
+
+private:
+   static std::atomic<bool> fgEnabled;
+};
+
+/// A RAII helper to record the duration of a wait in RImtContentionProfiler.
+/// The clock is only sampled when the profiler is enabled.
+class RImtScopedWaitTimer {
+   const RImtContentionProfiler::EWaitCategory fCategory;
+   const bool fActive;
+   std::chrono::steady_clock::time_point fStart;
+
+public:
+   RImtScopedWaitTimer(RImtContentionProfiler::EWaitCategory category)
+      : fCategory(category), fActive(RImtContentionProfiler::IsEnabled())
+   {
+      if (fActive)
+         fStart = std::chrono::steady_clock::now();
+   }
+   ~RImtScopedWaitTimer()
+   {
+      if (fActive) {
+         const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - fStart);
+         RImtContentionProfiler::RecordWait(fCategory, ns.count());
+      }
+   }
+   RImtScopedWaitTimer(const RImtScopedWaitTimer &) = delete;
+   RImtScopedWaitTimer &operator=(const RImtScopedWaitTimer &) = delete;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -20,10 +20,16 @@ namespace Internal {
 /// A thread-safe list of N indexes (0 to size - 1).
 /// RSlotStack can be used to atomically assign a "processing slot" number to
 /// each thread in multi-threaded applications.
+/// A thread that acquired a slot before preferentially gets the same slot
+/// again, so the per-slot state tied to the slot number (readers, caches,
+/// partial results) tends to stay on the core, and hence the NUMA domain,
+/// that last touched it.
 /// When there are no more slots available, the thread busy-waits for a slot.
 /// This case should be avoided by the scheduler.
 class RSlotStack {
-   struct alignas(8) AtomicWrapper {
+   // One cache line per slot to avoid false sharing between threads spinning
+   // on different slots.
+   struct alignas(64) AtomicWrapper {
       std::atomic_bool fAtomic{false};
       AtomicWrapper() = default;
       ~AtomicWrapper() = default;
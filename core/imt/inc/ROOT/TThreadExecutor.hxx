@@ -110,6 +110,19 @@ namespace ROOT {
 
       unsigned GetPoolSize() const;
 
+      /// Timing statistics of the last auto-chunked execution, see SetAutoChunking.
+      struct ChunkingStats {
+         unsigned fSampleSize = 0;        ///< Number of tasks executed and timed during the sampling phase
+         double fSampleTime = 0.;         ///< Wall-clock seconds spent in the sampling phase
+         unsigned fChunkSize = 0;         ///< Number of tasks per chunk chosen by the auto-tuner
+         unsigned fNChunks = 0;           ///< Number of chunks the remaining work was divided in
+         std::vector<double> fChunkTimes; ///< Wall-clock seconds taken by each executed chunk
+      };
+
+      void SetAutoChunking(bool enable = true) { fAutoChunking = enable; }
+      bool IsAutoChunking() const { return fAutoChunking; }
+      const ChunkingStats &GetAutoChunkingStats() const { return fStats; }
+
    private:
       // Implementation of the Map functions declared in the parent class (TExecutorCRTP)
       //
@@ -124,6 +137,7 @@ namespace ROOT {
 
       // Functions that interface with the parallel library used as a backend
       void   ParallelFor(unsigned start, unsigned end, unsigned step, const std::function<void(unsigned int i)> &f);
+      void   ParallelForAutoChunked(unsigned start, unsigned end, const std::function<void(unsigned int i)> &f);
       double ParallelReduce(const std::vector<double> &objs, const std::function<double(double a, double b)> &redfunc);
       float  ParallelReduce(const std::vector<float> &objs, const std::function<float(float a, float b)> &redfunc);
       template<class T, class R>
@@ -131,6 +145,10 @@ namespace ROOT {
 
       /// Pointer to the TBB task arena wrapper
       std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> fTaskArenaW = nullptr;
+      /// Whether per-index executions are partitioned by the auto-tuner, see SetAutoChunking
+      bool fAutoChunking = false;
+      /// Timing statistics of the last auto-chunked execution
+      ChunkingStats fStats;
    };
 
    /************ TEMPLATE METHODS IMPLEMENTATION ******************/
@@ -0,0 +1,153 @@
+// Author: The ROOT Team
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RImtContentionProfiler.hxx>
+
+#include <array>
+#include <bit>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using ROOT::Internal::RImtContentionProfiler;
+
+constexpr std::array<const char *, static_cast<unsigned>(RImtContentionProfiler::EWaitCategory::kNCategories)>
+   kCategoryNames = {"slotstack", "taskgroup-wait"};
+
+/// Wait time histogram of one category in one thread. The counters are relaxed
+/// atomics so the report can be written while worker threads are still running.
+struct RWaitHistogram {
+   std::array<std::atomic<std::uint64_t>, RImtContentionProfiler::kNBuckets> fCounts{};
+   std::atomic<std::uint64_t> fNWaits{};
+   std::atomic<std::uint64_t> fTotalNs{};
+};
+
+struct RThreadRecord {
+   std::string fThreadId;
+   std::array<RWaitHistogram, static_cast<unsigned>(RImtContentionProfiler::EWaitCategory::kNCategories)> fHistograms;
+};
+
+/// Owns the per-thread records; records outlive their threads so the report
+/// covers threads that already exited. Leaked to stay valid in static destructors.
+struct RProfileRegistry {
+   std::mutex fMutex;
+   std::vector<std::unique_ptr<RThreadRecord>> fThreadRecords;
+   std::string fReportPath;
+
+   static RProfileRegistry &Instance()
+   {
+      static RProfileRegistry &instance = *new RProfileRegistry();
+      return instance;
+   }
+};
+
+RThreadRecord &GetThreadRecord()
+{
+   thread_local RThreadRecord *record = [] {
+      auto newRecord = std::make_unique<RThreadRecord>();
+      std::ostringstream id;
+      id << std::this_thread::get_id();
+      newRecord->fThreadId = id.str();
+      auto &registry = RProfileRegistry::Instance();
+      const std::lock_guard<std::mutex> lock(registry.fMutex);
+      registry.fThreadRecords.emplace_back(std::move(newRecord));
+      return registry.fThreadRecords.back().get();
+   }();
+   return *record;
+}
+
+} // anonymous namespace
+
+std::atomic<bool> ROOT::Internal::RImtContentionProfiler::fgEnabled{false};
+
+void ROOT::Internal::RImtContentionProfiler::Enable(const std::string &reportPath)
+{
+   auto &registry = RProfileRegistry::Instance();
+   {
+      const std::lock_guard<std::mutex> lock(registry.fMutex);
+      if (!reportPath.empty())
+         registry.fReportPath = reportPath;
+   }
+   fgEnabled.store(true, std::memory_order_relaxed);
+}
+
+void ROOT::Internal::RImtContentionProfiler::Disable()
+{
+   fgEnabled.store(false, std::memory_order_relaxed);
+}
+
+void ROOT::Internal::RImtContentionProfiler::RecordWait(EWaitCategory category, std::uint64_t ns)
+{
+   auto &histogram = GetThreadRecord().fHistograms[static_cast<unsigned>(category)];
+   const unsigned bucket = std::min(static_cast<unsigned>(std::bit_width(ns)), kNBuckets - 1);
+   histogram.fCounts[bucket].fetch_add(1, std::memory_order_relaxed);
+   histogram.fNWaits.fetch_add(1, std::memory_order_relaxed);
+   histogram.fTotalNs.fetch_add(ns, std::memory_order_relaxed);
+}
+
+void ROOT::Internal::RImtContentionProfiler::WriteReport(std::ostream &out)
+{
+   auto &registry = RProfileRegistry::Instance();
+   const std::lock_guard<std::mutex> lock(registry.fMutex);
+
+   out << "{\"name\":\"imt-contention\",\"children\":[";
+   for (unsigned c = 0; c < kCategoryNames.size(); ++c) {
+      if (c > 0)
+         out << ",";
+      out << "{\"name\":\"" << kCategoryNames[c] << "\",\"children\":[";
+      bool firstThread = true;
+      for (const auto &record : registry.fThreadRecords) {
+         const auto &histogram = record->fHistograms[c];
+         if (histogram.fNWaits.load(std::memory_order_relaxed) == 0)
+            continue;
+         if (!firstThread)
+            out << ",";
+         firstThread = false;
+         out << "{\"name\":\"thread-" << record->fThreadId << "\",\"value\":"
+             << histogram.fTotalNs.load(std::memory_order_relaxed)
+             << ",\"nWaits\":" << histogram.fNWaits.load(std::memory_order_relaxed) << ",\"histogramNs\":{";
+         bool firstBucket = true;
+         for (unsigned b = 0; b < kNBuckets; ++b) {
+            const auto count = histogram.fCounts[b].load(std::memory_order_relaxed);
+            if (count == 0)
+               continue;
+            if (!firstBucket)
+               out << ",";
+            firstBucket = false;
+            // The key is the upper edge of the power-of-two bucket, in nanoseconds
+            out << "\"" << (std::uint64_t(1) << b) << "\":" << count;
+         }
+         out << "}}";
+      }
+      out << "]}";
+   }
+   out << "]}\n";
+}
+
+void ROOT::Internal::RImtContentionProfiler::WriteReportToFile()
+{
+   std::string path;
+   {
+      auto &registry = RProfileRegistry::Instance();
+      const std::lock_guard<std::mutex> lock(registry.fMutex);
+      path = registry.fReportPath;
+   }
+   if (path.empty())
+      return;
+   std::ofstream out(path);
+   if (out)
+      WriteReport(out);
+}
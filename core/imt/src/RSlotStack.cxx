@@ -9,7 +9,9 @@
  *************************************************************************/
 
 #include <ROOT/RSlotStack.hxx>
+#include <ROOT/RImtContentionProfiler.hxx>
 
+#include <chrono>
 #include <stdexcept>
 #include <string>
 
@@ -27,13 +29,35 @@ void ROOT::Internal::RSlotStack::ReturnSlot(unsigned int slot)
 
 unsigned int ROOT::Internal::RSlotStack::GetSlot()
 {
+   // The slot this thread acquired last, across all RSlotStack instances. It is only a hint: it is bounds-checked and
+   // raced for like any other slot, so a stale value from another (or a destroyed) slot stack is harmless.
+   static thread_local unsigned int tLastSlot = 0u;
+
+   // Time the busy-wait for the contention profiler, starting only after a full
+   // scan found no free slot: the uncontended fast path stays unperturbed.
+   bool timingWait = false;
+   std::chrono::steady_clock::time_point waitStart;
+
    while (true) {
+      // First try to reacquire the slot this thread used last, to keep the per-slot state (readers, caches, partial
+      // results) warm in the caches and on the NUMA domain of this thread's core.
       for (unsigned int i = 0; i < fSlots.size(); ++i) {
+         const unsigned int slot = (tLastSlot + i) % fSlots.size();
          // test if a slot is available (assigned == false)
          bool expectedState = false;
-         if (fSlots[i].fAtomic.compare_exchange_strong(expectedState, true)) {
-            return i;
+         if (fSlots[slot].fAtomic.compare_exchange_strong(expectedState, true)) {
+            if (timingWait) {
+               const auto ns =
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - waitStart);
+               RImtContentionProfiler::RecordWait(RImtContentionProfiler::EWaitCategory::kSlotStack, ns.count());
+            }
+            tLastSlot = slot;
+            return slot;
          }
       }
+      if (!timingWait && RImtContentionProfiler::IsEnabled()) {
+         timingWait = true;
+         waitStart = std::chrono::steady_clock::now();
+      }
    }
 }
@@ -2,6 +2,7 @@
 #define TBB_USE_CAPTURED_EXCEPTION 0
 
 #include "ROOT/RTaskArena.hxx"
+#include "ROOT/RImtContentionProfiler.hxx"
 #include "ROpaqueTaskArena.hxx"
 #include "TError.h"
 #include "TROOT.h"
@@ -106,6 +107,8 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
    fTBBArena->initialize(maxConcurrency);
    fNWorkers = maxConcurrency;
    ROOT::EnableThreadSafety();
+   if (const char *profilePath = gSystem->Getenv("ROOT_IMT_CONTENTION_PROFILE"))
+      RImtContentionProfiler::Enable(profilePath);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -120,11 +123,15 @@ RTaskArenaWrapper::RTaskArenaWrapper(RTaskArenaWrapper::Attach)
    fTBBArena->initialize(tbb::task_arena::attach{});
    fNWorkers = fTBBArena->max_concurrency();
    ROOT::EnableThreadSafety();
+   if (const char *profilePath = gSystem->Getenv("ROOT_IMT_CONTENTION_PROFILE"))
+      RImtContentionProfiler::Enable(profilePath);
 }
 
 RTaskArenaWrapper::~RTaskArenaWrapper()
 {
    fNWorkers = 0u;
+   if (RImtContentionProfiler::IsEnabled())
+      RImtContentionProfiler::WriteReportToFile();
 }
 
 unsigned RTaskArenaWrapper::fNWorkers = 0u;
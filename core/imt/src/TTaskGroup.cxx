@@ -12,6 +12,7 @@
 #include "RConfigure.h"
 
 #include "ROOT/TTaskGroup.hxx"
+#include "ROOT/RImtContentionProfiler.hxx"
 
 #ifdef R__USE_IMT
 #include "TROOT.h"
@@ -134,6 +135,8 @@ void TTaskGroup::Run(const std::function<void(void)> &closure)
 void TTaskGroup::Wait()
 {
 #ifdef R__USE_IMT
+   ROOT::Internal::RImtScopedWaitTimer waitTimer(
+      ROOT::Internal::RImtContentionProfiler::EWaitCategory::kTaskGroupWait);
    ExecuteInIsolation([&] { CastToTG(fTaskContainer)->wait(); });
 #endif
 }
@@ -3,6 +3,10 @@
 
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROpaqueTaskArena.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #if !defined(_MSC_VER)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -167,6 +171,10 @@ void TThreadExecutor::ParallelFor(unsigned start, unsigned end, unsigned step,
               " Proceeding with %zu threads this time",
               tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
    }
+   if (fAutoChunking && step == 1 && end > start + 1) {
+      ParallelForAutoChunked(start, end, f);
+      return;
+   }
    fTaskArenaW->Access().execute([&] {
       tbb::this_task_arena::isolate([&] {
          tbb::parallel_for(start, end, step, f);
@@ -174,6 +182,77 @@ void TThreadExecutor::ParallelFor(unsigned start, unsigned end, unsigned step,
    });
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// \brief Execute a function in parallel over the indices of a loop, choosing
+/// the chunk size from the measured duration of the first tasks.
+///
+/// A first batch of one task per worker is executed with unit granularity and
+/// timed; from the estimated per-task duration a chunk size is derived that
+/// amortizes the scheduling overhead while keeping several chunks per worker
+/// available for load balancing through work stealing. The sampling time, the
+/// chosen chunk size and the wall-clock duration of every chunk are recorded
+/// and can be inspected afterwards through GetAutoChunkingStats().
+///
+/// \param start Start index of the loop.
+/// \param end End index of the loop.
+/// \param f function to execute.
+void TThreadExecutor::ParallelForAutoChunked(unsigned start, unsigned end,
+                                             const std::function<void(unsigned int i)> &f)
+{
+   using Clock_t = std::chrono::steady_clock;
+
+   const unsigned nTasks = end - start;
+   const unsigned nWorkers = std::max(1u, GetPoolSize());
+
+   // Sampling phase: one task per worker, timed to estimate the task duration.
+   const unsigned sample = std::min(nTasks, nWorkers);
+   auto t0 = Clock_t::now();
+   fTaskArenaW->Access().execute([&] {
+      tbb::this_task_arena::isolate([&] {
+         tbb::parallel_for(start, start + sample, 1u, f);
+      });
+   });
+   const double sampleTime = std::chrono::duration<double>(Clock_t::now() - t0).count();
+
+   fStats = {};
+   fStats.fSampleSize = sample;
+   fStats.fSampleTime = sampleTime;
+   fStats.fChunkSize = 1;
+
+   const unsigned remaining = nTasks - sample;
+   if (remaining == 0)
+      return;
+
+   // Aim for chunks of ~2 ms so the per-chunk scheduling overhead is
+   // amortized, while keeping at least a few chunks per worker so stolen work
+   // rebalances uneven task durations.
+   constexpr double kTargetChunkSeconds = 2e-3;
+   const double perTask = sampleTime / sample;
+   unsigned chunkSize = remaining;
+   if (perTask > 0.)
+      chunkSize = static_cast<unsigned>(std::min<double>(kTargetChunkSeconds / perTask, remaining));
+   const unsigned maxChunkSize = std::max(1u, remaining / (4 * nWorkers));
+   chunkSize = std::max(1u, std::min(chunkSize, maxChunkSize));
+   fStats.fChunkSize = chunkSize;
+
+   std::mutex statsMutex;
+   auto body = [&](const tbb::blocked_range<unsigned> &range) {
+      auto c0 = Clock_t::now();
+      for (unsigned i = range.begin(); i != range.end(); ++i)
+         f(i);
+      const double chunkTime = std::chrono::duration<double>(Clock_t::now() - c0).count();
+      std::lock_guard<std::mutex> lock(statsMutex);
+      fStats.fChunkTimes.push_back(chunkTime);
+   };
+   fTaskArenaW->Access().execute([&] {
+      tbb::this_task_arena::isolate([&] {
+         tbb::parallel_for(tbb::blocked_range<unsigned>(start + sample, end, chunkSize), body,
+                           tbb::simple_partitioner());
+      });
+   });
+   fStats.fNChunks = fStats.fChunkTimes.size();
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// \brief "Reduce" in parallel an std::vector<double> into a single double value
 ///
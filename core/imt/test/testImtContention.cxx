@@ -0,0 +1,67 @@
+#include "ROOT/RImtContentionProfiler.hxx"
+#include "ROOT/RSlotStack.hxx"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using ROOT::Internal::RImtContentionProfiler;
+
+TEST(ImtContentionProfiler, DisabledByDefault)
+{
+   EXPECT_FALSE(RImtContentionProfiler::IsEnabled());
+}
+
+TEST(ImtContentionProfiler, RecordAndReport)
+{
+   RImtContentionProfiler::Enable();
+
+   RImtContentionProfiler::RecordWait(RImtContentionProfiler::EWaitCategory::kSlotStack, 1000);
+   RImtContentionProfiler::RecordWait(RImtContentionProfiler::EWaitCategory::kSlotStack, 2000);
+   RImtContentionProfiler::RecordWait(RImtContentionProfiler::EWaitCategory::kTaskGroupWait, 500);
+
+   std::stringstream report;
+   RImtContentionProfiler::WriteReport(report);
+   RImtContentionProfiler::Disable();
+
+   const auto json = report.str();
+   EXPECT_NE(std::string::npos, json.find("\"imt-contention\""));
+   EXPECT_NE(std::string::npos, json.find("\"slotstack\""));
+   EXPECT_NE(std::string::npos, json.find("\"taskgroup-wait\""));
+   EXPECT_NE(std::string::npos, json.find("\"nWaits\""));
+   EXPECT_NE(std::string::npos, json.find("\"histogramNs\""));
+}
+
+TEST(ImtContentionProfiler, ContendedSlotStack)
+{
+   RImtContentionProfiler::Enable();
+
+   // One slot shared by two threads forces the loser of each acquisition into
+   // the instrumented busy-wait path.
+   ROOT::Internal::RSlotStack slotStack(1u);
+   std::atomic<bool> go{false};
+   auto work = [&]() {
+      while (!go)
+         ;
+      for (int i = 0; i < 1000; ++i) {
+         ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
+         EXPECT_EQ(0u, slotRAII.fSlot);
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < 2; ++i)
+      threads.emplace_back(work);
+   go = true;
+   for (auto &t : threads)
+      t.join();
+
+   std::stringstream report;
+   RImtContentionProfiler::WriteReport(report);
+   RImtContentionProfiler::Disable();
+
+   EXPECT_NE(std::string::npos, report.str().find("\"slotstack\""));
+}
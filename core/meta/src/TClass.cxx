@@ -97,6 +97,7 @@ In order to access the name of a class within the ROOT type system, the method T
 #include <typeinfo>
 #include <cmath>
 #include <cassert>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -167,6 +168,26 @@ namespace {
      }
    };
 
+   // Per-thread cache of class name lookups that already resolved to a loaded
+   // class. TClass::GetClass is called very frequently from collection proxies
+   // and the I/O subsystem during multi-threaded event loops, and even the read
+   // side of the ROOT read-write lock serializes threads at high core counts.
+   // Lookups recorded here are served without taking any lock; the caches of
+   // all threads are invalidated by bumping the shared generation counter
+   // whenever a class is unloaded or deleted.
+   std::atomic<ULong64_t> gClassNameCacheGeneration{0};
+
+   struct ClassNameCache_t {
+      std::unordered_map<std::string, TClass *> fMap;
+      ULong64_t fGeneration = 0;
+   };
+
+   ClassNameCache_t &GetThreadClassNameCache()
+   {
+      thread_local ClassNameCache_t cache;
+      return cache;
+   }
+
 }
 
 std::atomic<Int_t> TClass::fgClassCount;
@@ -1753,6 +1774,9 @@ TClass::~TClass()
 {
    R__LOCKGUARD(gInterpreterMutex);
 
+   // Invalidate the per-thread lookup caches before the pointer goes stale.
+   gClassNameCacheGeneration.fetch_add(1, std::memory_order_release);
+
    // Remove from the typedef hashtables.
    if (fgClassTypedefHash && TestBit (kHasNameMapNode)) {
       TString resolvedThis = TClassEdit::ResolveTypedef (GetName(), kTRUE);
@@ -3092,6 +3116,21 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Lock-free fast path: repeated lookups of a name that already resolved to
+   // a loaded class are served from a per-thread cache without taking the
+   // read-write lock. The cache is dropped when the generation counter shows
+   // that a class was unloaded or deleted since it was filled.
+   auto &nameCache = GetThreadClassNameCache();
+   ULong64_t nameCacheGen = gClassNameCacheGeneration.load(std::memory_order_acquire);
+   if (nameCache.fGeneration != nameCacheGen) {
+      nameCache.fMap.clear();
+      nameCache.fGeneration = nameCacheGen;
+   } else {
+      auto cached = nameCache.fMap.find(name);
+      if (cached != nameCache.fMap.end())
+         return cached->second;
+   }
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
@@ -3099,8 +3138,11 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
-   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading)))
+   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) {
+      if (cl->IsLoaded() && !cl->TestBit(kUnloading) && nameCache.fMap.size() < 10000)
+         nameCache.fMap.emplace(name, cl);
       return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -6468,6 +6510,9 @@ void TClass::SetUnloaded()
    }
    SetBit(kUnloading);
 
+   // Invalidate the per-thread lookup caches, they may resolve to this class.
+   gClassNameCacheGeneration.fetch_add(1, std::memory_order_release);
+
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
       Fatal("SetUnloaded","The TClass for %s is being unloaded when in state %d\n",
@@ -121,6 +121,7 @@ clang/LLVM technology.
 #include "llvm/IR/Module.h"
 
 #include "llvm/Support/DynamicLibrary.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
@@ -1916,6 +1917,25 @@ void TCling::LoadPCM(std::string pcmFileNameFullPath)
       Fatal("LoadPCM", "The file %s is not a ROOT as was expected\n", pcmFileName.Data());
       return;
    }
+
+   // Map the rdict read-only instead of reading it through TFile: the kernel
+   // shares the mapped pages between all jobs loading the same PCM on a node
+   // and only makes private copies on write. The mappings are kept for the
+   // lifetime of the process, like the pending rdicts above, since module
+   // files are never unloaded.
+   auto pcmBuffer = llvm::MemoryBuffer::getFile(pcmFileNameFullPath, /*IsText*/ false,
+                                                /*RequiresNullTerminator*/ false);
+   if (pcmBuffer) {
+      static std::vector<std::unique_ptr<llvm::MemoryBuffer>> sMappedRdicts;
+      sMappedRdicts.emplace_back(std::move(*pcmBuffer));
+      llvm::MemoryBuffer &buf = *sMappedRdicts.back();
+      TMemFile::ZeroCopyView_t range{buf.getBufferStart(), buf.getBufferSize()};
+      std::string RDictFileOpts = pcmFileNameFullPath + "?filetype=pcm";
+      TMemFile pcmMemFile(RDictFileOpts.c_str(), range);
+      LoadPCMImpl(pcmMemFile);
+      return;
+   }
+
    TFile pcmFile(pcmFileName + "?filetype=pcm", "READ");
    LoadPCMImpl(pcmFile);
 }
@@ -3196,7 +3216,9 @@ static Bool_t s_IsLibraryLoaded(const char* libname, cling::Interpreter* fInterp
 
 Bool_t TCling::IsLibraryLoaded(const char* libname) const
 {
-   R__LOCKGUARD(gInterpreterMutex);
+   // A shared read lock is enough: the query only consults the list of loaded
+   // libraries and any concurrent load holds the exclusive lock.
+   R__READ_LOCKGUARD(ROOT::gCoreMutex);
    return s_IsLibraryLoaded(libname, GetInterpreterImpl());
 }
 
@@ -3205,6 +3227,10 @@ Bool_t TCling::IsLibraryLoaded(const char* libname) const
 // FIXME: We need to be able to support lazy loading of pcm generated by ACLiC.
 Bool_t TCling::HasPCMForLibrary(const char *libname) const
 {
+   // Reading the module map may run concurrently with a module load holding
+   // the exclusive lock.
+   R__READ_LOCKGUARD(ROOT::gCoreMutex);
+
    llvm::StringRef ModuleName(libname);
    ModuleName = llvm::sys::path::stem(ModuleName);
    ModuleName.consume_front("lib");
@@ -5796,6 +5822,13 @@ namespace {
 /// In case of error -1 is returned, 0 otherwise.
 /// The interpreter uses this information to automatically load the shared
 /// library for a class (autoload mechanism), see the AutoLoad() methods below.
+///
+/// When the ROOT_ROOTMAP_CACHE environment variable points to a writable file
+/// location, the content of all rootmap files found in the dynamic load path
+/// is aggregated there together with their time stamps and sizes; subsequent
+/// startups with an unchanged load path read that single file instead of
+/// parsing every rootmap individually. This noticeably reduces the startup
+/// time of short batch jobs on distributed file systems.
 
 Int_t TCling::LoadLibraryMap(const char* rootmapfile)
 {
@@ -5823,6 +5856,10 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
    TString ldpath = gSystem->GetDynamicPath();
    if (ldpath != fRootmapLoadPath) {
       fRootmapLoadPath = ldpath;
+      // First collect the rootmap files found in the load path; they are then
+      // either parsed one by one or replaced by an up-to-date aggregate cache.
+      std::vector<std::pair<TString, TString>> rootmapEntries; // (file name, full path)
+      std::unordered_set<std::string> seenRootmaps;
 #ifdef WIN32
       TObjArray* paths = ldpath.Tokenize(";");
 #else
@@ -5853,19 +5890,12 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
                      TString p;
                      p = d + "/" + f;
                      if (!gSystem->AccessPathName(p, kReadPermission)) {
-                        if (!fRootmapFiles->FindObject(f) && f != ".rootmap") {
+                        if (!fRootmapFiles->FindObject(f) && f != ".rootmap" &&
+                            seenRootmaps.insert(f.Data()).second) {
                            if (gDebug > 4) {
                               Info("LoadLibraryMap", "   rootmap file: %s", p.Data());
                            }
-                           Int_t ret = ReadRootmapFile(p, &uniqueString);
-
-                           if (ret == 0)
-                              fRootmapFiles->Add(new TNamed(gSystem->BaseName(f), p.Data()));
-                           if (ret == -3) {
-                              // old format
-                              fMapfile->ReadFile(p, kEnvGlobal);
-                              fRootmapFiles->Add(new TNamed(f, p));
-                           }
+                           rootmapEntries.emplace_back(f, p);
                         }
                         // else {
                         //    fprintf(stderr,"Reject %s because %s is already there\n",p.Data(),f.Data());
@@ -5887,6 +5917,86 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
          }
       }
       delete paths;
+
+      // Optional aggregate cache of the rootmap files, enabled by pointing the
+      // ROOT_ROOTMAP_CACHE environment variable to a cache file location. The
+      // cache header records the ROOT version, the load path and the
+      // (mtime, size) of every rootmap file found; when it matches, a single
+      // sequential read replaces the parsing of hundreds of small files. Any
+      // change in the load path or in a rootmap file produces a different
+      // header, so the cache is rebuilt automatically.
+      const char *cachePath = gSystem->Getenv("ROOT_ROOTMAP_CACHE");
+      TString cacheHeader;
+      if (cachePath && *cachePath) {
+         cacheHeader.Form("# rootmap cache %s\n# ldpath %s\n", gROOT->GetVersion(), ldpath.Data());
+         for (auto &entry : rootmapEntries) {
+            FileStat_t stat;
+            if (gSystem->GetPathInfo(entry.second, stat) == 0)
+               cacheHeader += TString::Format("# file %lld %lld %s\n", (Long64_t)stat.fMtime,
+                                              (Long64_t)stat.fSize, entry.second.Data());
+         }
+         cacheHeader += "# end\n";
+      }
+      Bool_t parsedFromCache = kFALSE;
+      if (cacheHeader.Length()) {
+         std::ifstream cacheIn(cachePath, std::ios::binary);
+         if (cacheIn) {
+            std::string onDisk(cacheHeader.Length(), '\0');
+            cacheIn.read(&onDisk[0], cacheHeader.Length());
+            if (cacheIn.gcount() == cacheHeader.Length() && onDisk == cacheHeader.Data()) {
+               cacheIn.close();
+               if (ReadRootmapFile(cachePath, &uniqueString) == 0) {
+                  for (auto &entry : rootmapEntries)
+                     fRootmapFiles->Add(new TNamed(entry.first, entry.second));
+                  parsedFromCache = kTRUE;
+                  if (gDebug > 3)
+                     Info("LoadLibraryMap", "rootmap cache hit: %s", cachePath);
+               }
+            }
+         }
+      }
+      if (!parsedFromCache) {
+         Bool_t cacheable = cacheHeader.Length() > 0;
+         std::string aggregate;
+         for (auto &entry : rootmapEntries) {
+            const TString &f = entry.first;
+            const TString &p = entry.second;
+            Int_t ret = ReadRootmapFile(p, &uniqueString);
+            if (ret == 0) {
+               fRootmapFiles->Add(new TNamed(gSystem->BaseName(f), p.Data()));
+               if (cacheable && requiresRootMap(p)) {
+                  std::ifstream in(p.Data(), std::ios::binary);
+                  std::ostringstream content;
+                  content << in.rdbuf();
+                  std::string bytes = content.str();
+                  // An unterminated forward declaration section would swallow
+                  // the beginning of the next file in the aggregate.
+                  auto decls = bytes.find("{ decls }");
+                  if (decls != std::string::npos && bytes.find("\n[", decls) == std::string::npos)
+                     cacheable = kFALSE;
+                  aggregate += bytes;
+                  if (!bytes.empty() && bytes.back() != '\n')
+                     aggregate += '\n';
+               }
+            }
+            if (ret == -3) {
+               // old format, not representable in the aggregate cache
+               fMapfile->ReadFile(p, kEnvGlobal);
+               fRootmapFiles->Add(new TNamed(f, p));
+               cacheable = kFALSE;
+            }
+         }
+         if (cacheable) {
+            TString tmpPath = TString::Format("%s.%d.tmp", cachePath, gSystem->GetPid());
+            std::ofstream cacheOut(tmpPath.Data(), std::ios::binary);
+            if (cacheOut) {
+               cacheOut << cacheHeader.Data() << aggregate;
+               cacheOut.close();
+               if (!cacheOut || gSystem->Rename(tmpPath, cachePath) != 0)
+                  gSystem->Unlink(tmpPath);
+            }
+         }
+      }
       if (fMapfile->GetTable() && !fMapfile->GetTable()->GetEntries()) {
          return -1;
       }
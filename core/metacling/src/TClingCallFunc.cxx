@@ -70,6 +70,8 @@ C++ interpreter and the Clang C++ compiler, not CINT.
 #include <map>
 #include <string>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 using namespace ROOT;
 using namespace clang;
@@ -1024,11 +1026,61 @@ tcling_callfunc_Wrapper_t TClingCallFunc::make_wrapper()
 
    if (get_wrapper_code(wrapper_name, wrapper) == 0) return nullptr;
 
+   //
+   //  Batch the wrappers of the sibling overloads into the same compilation:
+   //  a first-call storm (e.g. PyROOT probing overloads one after the other)
+   //  then pays the parse, module emission and JIT finalization once per
+   //  overload set instead of once per signature.
+   //
+   static constexpr unsigned kMaxBatchedWrappers = 16;
+   std::vector<std::pair<const Decl *, std::string>> batch;
+   string batchcode;
+   if (const FunctionDecl *FD = GetDecl()) {
+      for (auto *result : FD->getDeclContext()->lookup(FD->getDeclName())) {
+         const auto *sibling = dyn_cast<FunctionDecl>(result);
+         if (!sibling || sibling == FD)
+            continue;
+         if (sibling->getDescribedFunctionTemplate() || sibling->isDeleted() || sibling->isLateTemplateParsed())
+            continue;
+         if (gWrapperStore.find(sibling) != gWrapperStore.end())
+            continue;
+         TClingMethodInfo sibling_info(fInterp, sibling);
+         TClingCallFunc sibling_func(sibling_info);
+         string sibling_name;
+         string sibling_code;
+         // The sibling compilation is speculative; keep expected failures
+         // (e.g. dependent signatures) silent.
+         Int_t oldIgnoreLevel = gErrorIgnoreLevel;
+         gErrorIgnoreLevel = kFatal;
+         int ok = sibling_func.get_wrapper_code(sibling_name, sibling_code);
+         gErrorIgnoreLevel = oldIgnoreLevel;
+         if (ok == 0)
+            continue;
+         batch.emplace_back(sibling_func.GetFunctionOrShadowDecl(), sibling_name);
+         batchcode += '\n';
+         batchcode += sibling_code;
+         if (batch.size() >= kMaxBatchedWrappers)
+            break;
+      }
+   }
+
    //fprintf(stderr, "%s\n", wrapper.c_str());
    //
    //  Compile the wrapper code.
    //
-   void *F = compile_wrapper(wrapper_name, wrapper);
+   void *F = nullptr;
+   if (!batch.empty()) {
+      F = compile_wrapper(wrapper_name, wrapper + batchcode);
+      if (F) {
+         for (auto &sibling : batch) {
+            if (void *sibF = fInterp->getAddressOfGlobal(sibling.second))
+               gWrapperStore.insert(make_pair(sibling.first, sibF));
+         }
+      }
+      // On failure fall through and compile the requested wrapper alone.
+   }
+   if (!F)
+      F = compile_wrapper(wrapper_name, wrapper);
    if (F) {
       gWrapperStore.insert(make_pair(D, F));
    } else {
@@ -33,6 +33,11 @@ public:
    std::unique_ptr<StateDelta> Rewind(const State &earlierState) override;
    void Apply(std::unique_ptr<StateDelta> &&delta) override;
 
+   // Contention statistics of the underlying lock, see TReentrantRWLock.
+   size_t GetReadContentionCount() const { return fMutexImp.GetReadContentionCount(); }
+   size_t GetWriteContentionCount() const { return fMutexImp.GetWriteContentionCount(); }
+   size_t GetWriteLockCount() const { return fMutexImp.GetWriteLockCount(); }
+
    ClassDefInlineOverride(TRWMutexImp,0)  // Concrete RW mutex lock class
 };
 
@@ -106,8 +106,10 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
       // Wait for writers, if any
       if (fWriter && fRecurseCounts.IsNotCurrentWriter(local)) {
          auto readerCount = fRecurseCounts.GetLocalReadersCount(local);
-         if (readerCount == 0)
+         if (readerCount == 0) {
+            fReadContention.fetch_add(1, std::memory_order_relaxed);
             fCond.wait(lock, [this] { return !fWriter; });
+         }
          // else
          //   There is a writer **but** we have outstanding readers
          //   locks, this must mean that the writer is actually
@@ -170,6 +172,9 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
 {
    ++fWriterReservation;
 
+   fWriteLockCount.fetch_add(1, std::memory_order_relaxed);
+   bool contended = false;
+
    std::unique_lock<MutexT> lock(fMutex);
 
    auto local = fRecurseCounts.GetLocal();
@@ -182,6 +187,7 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
 
    // Wait for other writers, if any
    if (fWriter && fRecurseCounts.IsNotCurrentWriter(local)) {
+      contended = true;
       if (readerCount && fReaders == 0) {
          // we decrease fReaders to zero, let's wake up the
          // other writer.
@@ -199,8 +205,13 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
    };
 
    // Wait for remaining readers
+   if (fReaders != 0)
+      contended = true;
    fCond.wait(lock, [this] { return fReaders == 0; });
 
+   if (contended)
+      fWriteContention.fetch_add(1, std::memory_order_relaxed);
+
    // Restore this thread's reader lock(s)
    fReaders += readerCount;
 
@@ -288,6 +288,10 @@ private:
 
    RecurseCountsT fRecurseCounts;        ///<! Trackers for re-entry in the lock by the same thread.
 
+   std::atomic<size_t> fReadContention{0};  ///<! Read acquisitions that had to wait for a writer
+   std::atomic<size_t> fWriteContention{0}; ///<! Write acquisitions that had to wait for readers or another writer
+   std::atomic<size_t> fWriteLockCount{0};  ///<! Total number of write acquisitions
+
    // size_t fWriteRecurse;                ///<! Number of re-entry in the lock by the same thread.
 
    // std::thread::id fWriterThread; ///<! Holder of the write lock
@@ -308,6 +312,14 @@ public:
    TVirtualRWMutex::Hint_t *WriteLock();
    void WriteUnLock(TVirtualRWMutex::Hint_t *);
 
+   ////////////////////////////////////////////////////////////////////////
+   /// Lock-contention statistics: the number of read and write acquisitions
+   /// that had to wait for the lock, and the total number of write
+   /// acquisitions. Relaxed counters meant for locating lock hotspots.
+   size_t GetReadContentionCount() const { return fReadContention.load(std::memory_order_relaxed); }
+   size_t GetWriteContentionCount() const { return fWriteContention.load(std::memory_order_relaxed); }
+   size_t GetWriteLockCount() const { return fWriteLockCount.load(std::memory_order_relaxed); }
+
    std::unique_ptr<State> GetStateBefore();
    std::unique_ptr<StateDelta> Rewind(const State &earlierState);
    void Apply(std::unique_ptr<StateDelta> &&delta);
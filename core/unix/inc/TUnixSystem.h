@@ -205,6 +205,7 @@ public:
    void              CloseConnection(int sock, Bool_t force = kFALSE) override;
    int               RecvRaw(int sock, void *buffer, int length, int flag) override;
    int               SendRaw(int sock, const void *buffer, int length, int flag) override;
+   int               SendRawV(int sock, const void *const *buffers, const int *lengths, int nbufs, int flag) override;
    int               RecvBuf(int sock, void *buffer, int length) override;
    int               SendBuf(int sock, const void *buffer, int length) override;
    int               SetSockOpt(int sock, int option, int val) override;
@@ -19,6 +19,16 @@
 
 extern "C" unsigned long R__crc32(unsigned long crc, const unsigned char *buf, unsigned int len);
 
+/* CRC-32C (Castagnoli polynomial); uses the SSE4.2 / ARMv8 CRC instructions when the
+   CPU has them and a table-driven implementation otherwise. Start with crc = 0 and
+   pass the previous return value to checksum a stream incrementally. */
+extern "C" unsigned long R__crc32c(unsigned long crc, const unsigned char *buf, unsigned int len);
+
+/* As R__crc32c, but copies buf to tgt in the same pass so the data is only
+   touched once. tgt and buf must not overlap. */
+extern "C" unsigned long R__crc32c_copy(unsigned long crc, unsigned char *tgt, const unsigned char *buf,
+                                        unsigned int len);
+
 extern "C" unsigned long R__memcompress(char *tgt, unsigned long tgtsize, char *src, unsigned long srcsize);
 
 extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
@@ -1,8 +1,10 @@
 #include <Compression.h>
 #include <RZip.h>
+#include <ZipZSTD.h>
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <memory>
 
 static void testZipBufferSizes(ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm)
@@ -68,3 +70,62 @@ TEST(RZip, ZipBufferSizesZSTD)
 {
    testZipBufferSizes(ROOT::RCompressionSetting::EAlgorithm::kZSTD);
 }
+
+// The ZSTD worker-thread and long-range-matching knobs tune the encoder only:
+// frames produced with them enabled must decompress like any other ZS frame.
+TEST(RZip, ZSTDTunedRoundTrip)
+{
+   static constexpr size_t BufferSize = 64 * 1024;
+   std::unique_ptr<char[]> source(new char[BufferSize]);
+   std::unique_ptr<char[]> compressed(new char[BufferSize]);
+   std::unique_ptr<char[]> restored(new char[BufferSize]);
+   for (size_t i = 0; i < BufferSize; i++)
+      source[i] = static_cast<char>((i / 512) % 7);
+
+   R__SetZSTDWorkers(2);
+   R__SetZSTDLongRangeMatching(1);
+   EXPECT_EQ(R__GetZSTDWorkers(), 2);
+   EXPECT_EQ(R__GetZSTDLongRangeMatching(), 1);
+
+   int srcsize = static_cast<int>(BufferSize);
+   int tgtsize = static_cast<int>(BufferSize);
+   int irep = 0;
+   R__zipMultipleAlgorithm(5, &srcsize, source.get(), &tgtsize, compressed.get(), &irep,
+                           ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+   ASSERT_GT(irep, 0);
+
+   int zipsize = irep;
+   int unzipsize = static_cast<int>(BufferSize);
+   irep = 0;
+   R__unzip(&zipsize, reinterpret_cast<unsigned char *>(compressed.get()), &unzipsize,
+            reinterpret_cast<unsigned char *>(restored.get()), &irep);
+   ASSERT_EQ(irep, static_cast<int>(BufferSize));
+   EXPECT_EQ(memcmp(source.get(), restored.get(), BufferSize), 0);
+
+   R__SetZSTDWorkers(0);
+   R__SetZSTDLongRangeMatching(0);
+}
+
+// CRC-32C known-answer vector ("123456789" -> 0xE3069283), incremental chunking,
+// and the fused checksum+copy pass; exercises whichever of the hardware or
+// software implementations the host dispatches to.
+TEST(RZip, CRC32C)
+{
+   const unsigned char *check = reinterpret_cast<const unsigned char *>("123456789");
+   EXPECT_EQ(R__crc32c(0, check, 9), 0xE3069283UL);
+
+   static constexpr size_t BufferSize = 64 * 1024 + 5; // odd tail exercises the bytewise loop
+   std::unique_ptr<unsigned char[]> source(new unsigned char[BufferSize]);
+   std::unique_ptr<unsigned char[]> copy(new unsigned char[BufferSize]);
+   for (size_t i = 0; i < BufferSize; i++)
+      source[i] = static_cast<unsigned char>(i * 131 + 17);
+
+   unsigned long oneShot = R__crc32c(0, source.get(), BufferSize);
+   unsigned long chunked = R__crc32c(0, source.get(), 1000);
+   chunked = R__crc32c(chunked, source.get() + 1000, BufferSize - 1000);
+   EXPECT_EQ(chunked, oneShot);
+
+   unsigned long copied = R__crc32c_copy(0, copy.get(), source.get(), BufferSize);
+   EXPECT_EQ(copied, oneShot);
+   EXPECT_EQ(memcmp(source.get(), copy.get(), BufferSize), 0);
+}
@@ -17,6 +17,17 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+/* Number of worker threads used inside each ZSTD compression call (0 = compress
+ * on the calling thread, the default).  Workers only affect the encoder; the
+ * produced frames stay readable by any ZSTD decompressor. */
+void R__SetZSTDWorkers(int nworkers);
+int R__GetZSTDWorkers(void);
+
+/* Enable/disable long-distance matching for ZSTD compression (off by default).
+ * Improves ratios on buffers with far-apart repetitions at some memory cost. */
+void R__SetZSTDLongRangeMatching(int enable);
+int R__GetZSTDLongRangeMatching(void);
 #ifdef __cplusplus
 }
 #endif
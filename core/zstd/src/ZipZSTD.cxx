@@ -22,17 +22,54 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
+// Encoder tuning knobs; both only change how the frame is produced, never its
+// on-disk format, so tuned files stay readable by any ZSTD decompressor.
+static int gZSTDWorkers = 0;
+static int gZSTDLongRangeMatching = 0;
+
+void R__SetZSTDWorkers(int nworkers)
+{
+    gZSTDWorkers = (nworkers > 0) ? nworkers : 0;
+}
+
+int R__GetZSTDWorkers(void)
+{
+    return gZSTDWorkers;
+}
+
+void R__SetZSTDLongRangeMatching(int enable)
+{
+    gZSTDLongRangeMatching = enable ? 1 : 0;
+}
+
+int R__GetZSTDLongRangeMatching(void)
+{
+    return gZSTDLongRangeMatching;
+}
+
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
+    // Reuse one compression context per thread: context creation allocates the
+    // full workspace, which dominates the cost of compressing small baskets.
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    thread_local Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
+    ZSTD_CCtx_reset(fCtx.get(), ZSTD_reset_session_and_parameters);
+    ZSTD_CCtx_setParameter(fCtx.get(), ZSTD_c_compressionLevel, 2*cxlevel);
+    if (gZSTDWorkers > 0) {
+        // Ignored (with an error we do not need to act on) when the ZSTD build
+        // has no multi-threading support; compression then stays synchronous.
+        ZSTD_CCtx_setParameter(fCtx.get(), ZSTD_c_nbWorkers, gZSTDWorkers);
+    }
+    if (gZSTDLongRangeMatching) {
+        ZSTD_CCtx_setParameter(fCtx.get(), ZSTD_c_enableLongDistanceMatching, 1);
+    }
+
+    size_t retval = ZSTD_compress2(fCtx.get(),
                                         &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+                                        src, static_cast<size_t>(*srcsize));
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -61,7 +98,7 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    thread_local Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
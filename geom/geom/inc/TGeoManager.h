@@ -109,6 +109,7 @@ private:
    TObjArray *fNodes;           //-> current branch of nodes
    TObjArray *fOverlaps;        //-> list of geometrical overlaps
    TObjArray *fRegions;         //-> list of regions
+   TObjArray *fDirtyVolumes;    //! volumes modified after closing, updated by CloseGeometryIncremental()
    UChar_t *fBits;              //! bits used for voxelization
    // Map of navigator arrays per thread
    typedef std::map<std::thread::id, TGeoNavigatorArray *> NavigatorsMap_t;
@@ -298,6 +299,8 @@ public:
    //--- geometry building
    void BuildDefaultMaterials();
    void CloseGeometry(Option_t *option = "d");
+   void CloseGeometryIncremental(Option_t *option = "");
+   void MarkVolumeDirty(TGeoVolume *vol);
    Bool_t IsClosed() const { return fClosed; }
    TGeoVolume *MakeArb8(const char *name, TGeoMedium *medium, Double_t dz, Double_t *vertices = nullptr);
    TGeoVolume *MakeBox(const char *name, TGeoMedium *medium, Double_t dx, Double_t dy, Double_t dz);
@@ -38,6 +38,12 @@ protected:
    Int_t GetTouchedCluster(Int_t start, Double_t *point, Int_t *check_list, Int_t ncheck, Int_t *result);
    TGeoNode *CrossDivisionCell();
    void SafetyOverlaps();
+   Double_t ComputeSafety(Bool_t inside);
+   TGeoNode *SearchNodeWithRelocationCache();
+   Int_t SafetySlot(const TGeoVolume *vol, const Double_t *local) const;
+   Double_t GetSafetyEstimateFromCache(const TGeoVolume *vol, const Double_t *local) const;
+   void StoreSafetyInCache(TGeoVolume *vol, const Double_t *local, Double_t safety);
+   void ClearNavigationCaches();
 
 private:
    Double_t fStep;               //! step to be done from current point and direction
@@ -51,6 +57,27 @@ private:
    Double_t fLastPoint[3];       //! last point for which safety was computed
    Double_t fLastPWSaftyPnt[3];  //! last point for which parallel world safety was "evaluated"
    Double_t fLastPWSafety{-1};   //! last safety returned from parallel world (negative if invalid)
+
+   enum { kNRelocCache = 8,    // number of slots in the relocation cache
+          kNSafetyCache = 64 } // number of slots in the safety memoization table
+      ;
+   struct RelocEntry_t {
+      TGeoCacheState *fState{nullptr}; //! stored path snapshot
+      TGeoNode *fNode{nullptr};        //! deepest node of the stored path
+      TGeoHMatrix *fMatrix{nullptr};   //! global matrix of that node
+   };
+   struct SafetyEntry_t {
+      TGeoVolume *fVolume{nullptr};       //! volume the safety belongs to
+      Double_t fPoint[3] = {0., 0., 0.};  //! local point the safety was computed at
+      Double_t fSafety{-1.};              //! computed safety (negative if slot empty)
+   };
+   RelocEntry_t fRelocCache[kNRelocCache];    //! cache of last visited locations for fast relocation
+   SafetyEntry_t fSafetyCache[kNSafetyCache]; //! per-volume safety memoization table
+   Int_t fRelocNext{0};                       //! next relocation cache slot to be reused
+   ULong64_t fNSafetyCalls{0};                //! number of safety queries eligible for memoization
+   ULong64_t fNSafetyHits{0};                 //! number of safety queries served from the cache
+   ULong64_t fNRelocCalls{0};                 //! number of relocations probing the cache
+   ULong64_t fNRelocHits{0};                  //! number of relocations resolved from the cache
    Int_t fThreadId;              //! thread id for this navigator
    Int_t fLevel;                 //! current geometry level;
    Int_t fNmany;                 //! number of overlapping nodes on current branch
@@ -84,6 +111,8 @@ private:
    TString fPath;                //! path to current node
 
    static Bool_t fgUsePWSafetyCaching; //! global mode is caching enabled for parallel world safety calls
+   static Bool_t fgUseNavigationCaching; //! global mode enabling the relocation cache and safety memoization
+   static Double_t fgSafetyCacheGrain;   //! position quantization grain for the safety memoization key
 
 public:
    TGeoNavigator();
@@ -108,6 +137,9 @@ public:
    TGeoNode *FindNextBoundary(Double_t stepmax = TGeoShape::Big(), const char *path = "", Bool_t frombdr = kFALSE);
    TGeoNode *FindNextDaughterBoundary(Double_t *point, Double_t *dir, Int_t &idaughter, Bool_t compmatrix = kFALSE);
    TGeoNode *FindNextBoundaryAndStep(Double_t stepmax = TGeoShape::Big(), Bool_t compsafe = kFALSE);
+   Int_t FindNextBoundaryBundle(Int_t ntracks, const Double_t *x, const Double_t *y, const Double_t *z,
+                                const Double_t *dirx, const Double_t *diry, const Double_t *dirz, Double_t *steps,
+                                TGeoNode **nextnodes = nullptr, Double_t stepmax = TGeoShape::Big());
    TGeoNode *FindNode(Bool_t safe_start = kTRUE);
    TGeoNode *FindNode(Double_t x, Double_t y, Double_t z);
    Double_t *FindNormal(Bool_t forward = kTRUE);
@@ -231,6 +263,17 @@ public:
    static void SetPWSafetyCaching(Bool_t b) { fgUsePWSafetyCaching = b; }
    static Bool_t IsPWSafetyCaching() { return fgUsePWSafetyCaching; }
 
+   // enable/disable the relocation cache and the per-volume safety memoization
+   static void SetNavigationCaching(Bool_t b) { fgUseNavigationCaching = b; }
+   static Bool_t IsNavigationCaching() { return fgUseNavigationCaching; }
+   static void SetSafetyCacheGrain(Double_t grain);
+   // navigation cache statistics
+   ULong64_t GetSafetyCacheCalls() const { return fNSafetyCalls; }
+   ULong64_t GetSafetyCacheHits() const { return fNSafetyHits; }
+   ULong64_t GetRelocationCacheCalls() const { return fNRelocCalls; }
+   ULong64_t GetRelocationCacheHits() const { return fNRelocHits; }
+   void PrintCacheStatistics() const;
+
    //--- point/vector reference frame conversion
    void LocalToMaster(const Double_t *local, Double_t *master) const { fCache->LocalToMaster(local, master); }
    void LocalToMasterVect(const Double_t *local, Double_t *master) const { fCache->LocalToMasterVect(local, master); }
@@ -12,7 +12,9 @@
 #ifndef ROOT_TGeoTessellated
 #define ROOT_TGeoTessellated
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include "TGeoVector3.h"
 #include "TGeoTypedefs.h"
 #include "TGeoBBox.h"
@@ -59,6 +61,17 @@ public:
    using Vertex_t = Tessellated::Vertex_t;
 
 private:
+   // Node of the bounding-volume hierarchy over the facets. Inner nodes reference
+   // their children, leaves reference a contiguous range in the facet index array.
+   struct BVHNode_t {
+      double fMin[3] = {0, 0, 0}; // Lower corner of the node bounding box
+      double fMax[3] = {0, 0, 0}; // Upper corner of the node bounding box
+      int fLeft = -1;             // Index of the left child (inner nodes only)
+      int fRight = -1;            // Index of the right child (inner nodes only)
+      int fFirst = 0;             // First entry in the facet index array (leaves only)
+      int fNfacets = 0;           // Number of facets in the leaf (zero for inner nodes)
+   };
+
    int fNfacets = 0;                // Number of facets
    int fNvert = 0;                  // Number of vertices
    int fNseg = 0;                   // Number of segments
@@ -67,10 +80,19 @@ private:
    std::vector<Vertex_t> fVertices; // List of vertices
    std::vector<TGeoFacet> fFacets;  // List of facets
    std::multimap<long, int> fVerticesMap; //! Temporary map used to deduplicate vertices
+   mutable std::vector<BVHNode_t> fBVHNodes; //! BVH nodes over the facets
+   mutable std::vector<int> fBVHIndices;     //! Facet indices grouped per BVH leaf
+   mutable std::atomic<bool> fBVHReady{false}; //! True once the BVH is usable
+   mutable std::mutex fBVHMutex;             //! Protects the lazy BVH construction
 
    TGeoTessellated(const TGeoTessellated &) = delete;
    TGeoTessellated &operator=(const TGeoTessellated &) = delete;
 
+   void EnsureBVH() const;
+   void BuildBVH() const;
+   double DistToFacets(const double *point, const double *dir, double tmin, double tmax) const;
+   double SafetyToFacets(const double *point, int &ifacet) const;
+
 public:
    // constructors
    TGeoTessellated() {}
@@ -100,6 +122,13 @@ public:
    const TGeoFacet &GetFacet(int i) const { return fFacets[i]; }
    const Vertex_t &GetVertex(int i) const { return fVertices[i]; }
 
+   Bool_t Contains(const Double_t *point) const override;
+   void ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm) const override;
+   Double_t DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact = 1, Double_t step = TGeoShape::Big(),
+                           Double_t *safe = nullptr) const override;
+   Double_t DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact = 1,
+                            Double_t step = TGeoShape::Big(), Double_t *safe = nullptr) const override;
+   Double_t Safety(const Double_t *point, Bool_t in = kTRUE) const override;
    int DistancetoPrimitive(int, int) override { return 99999; }
    const TBuffer3D &GetBuffer3D(int reqSections, Bool_t localFrame) const override;
    void GetMeshNumbers(int &nvert, int &nsegs, int &npols) const override;
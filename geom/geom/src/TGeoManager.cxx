@@ -239,6 +239,11 @@ in order to enhance rays.
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 #include "TROOT.h"
 #include "TGeoManager.h"
@@ -282,6 +287,8 @@ in order to enhance rays.
 #include "TQObject.h"
 #include "TMath.h"
 #include "TEnv.h"
+#include "TMD5.h"
+#include "TSystem.h"
 #include "TGeoParallelWorld.h"
 #include "TGeoRegion.h"
 #include "TGDMLMatrix.h"
@@ -335,6 +342,7 @@ TGeoManager::TGeoManager()
       fNodes = nullptr;
       fOverlaps = nullptr;
       fRegions = nullptr;
+      fDirtyVolumes = nullptr;
       fNNodes = 0;
       fMaxVisNodes = 10000;
       fVolumes = nullptr;
@@ -448,6 +456,7 @@ void TGeoManager::Init()
    fNodes = new TObjArray(30);
    fOverlaps = new TObjArray(256);
    fRegions = new TObjArray(256);
+   fDirtyVolumes = nullptr;
    fNNodes = 0;
    fMaxVisNodes = 10000;
    fVolumes = new TObjArray(256);
@@ -534,6 +543,7 @@ TGeoManager::~TGeoManager()
       fRegions->Delete();
       SafeDelete(fRegions);
    }
+   SafeDelete(fDirtyVolumes); // does not own its content
    if (fMaterials) {
       fMaterials->Delete();
       SafeDelete(fMaterials);
@@ -1603,6 +1613,76 @@ void TGeoManager::CloseGeometry(Option_t *option)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Register a volume whose content changed after the geometry was closed. The
+/// volume will have its voxelization and overlap checks redone by the next call
+/// to CloseGeometryIncremental(). Called automatically when adding, removing or
+/// replacing daughter nodes in a closed geometry; it only needs to be called
+/// explicitly for edits bypassing the TGeoVolume interface.
+
+void TGeoManager::MarkVolumeDirty(TGeoVolume *vol)
+{
+   if (!vol || !fClosed)
+      return;
+   if (!fDirtyVolumes)
+      fDirtyVolumes = new TObjArray(256);
+   if (!fDirtyVolumes->FindObject(vol))
+      fDirtyVolumes->Add(vol);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Update a closed geometry after structural changes, rebuilding only what the
+/// changes invalidated. The volumes modified since closing (via AddNode(),
+/// RemoveNode(), ReplaceNode() or registered with MarkVolumeDirty()) get their
+/// nodes re-sorted, their voxelization rebuilt and their overlaps re-checked,
+/// then the node counts, the navigation caches and the physical nodes are
+/// refreshed. The cost scales with the number of modified volumes instead of
+/// the full geometry, which makes localized updates in long-lived sessions
+/// possible without a complete re-close. Supports the same "i" option as
+/// CloseGeometry() for node id arrays, and falls back to CloseGeometry(option)
+/// if the geometry was not closed yet.
+
+void TGeoManager::CloseGeometryIncremental(Option_t *option)
+{
+   if (!fClosed) {
+      CloseGeometry(option);
+      return;
+   }
+   if (!fDirtyVolumes || !fDirtyVolumes->GetEntriesFast())
+      return;
+   TString opt(option);
+   opt.ToLower();
+   Bool_t nodeid = opt.Contains("i");
+   if (fgVerboseLevel > 0)
+      Info("CloseGeometryIncremental", "Updating %d modified volume(s)...", fDirtyVolumes->GetEntriesFast());
+   TGeoVolume *vol;
+   TIter next(fDirtyVolumes);
+   while ((vol = (TGeoVolume *)next())) {
+      vol->SortNodes();
+      vol->Voxelize("ALL");
+      vol->FindOverlaps();
+   }
+   fDirtyVolumes->Clear();
+   fNNodes = CountNodes();
+   fNLevel = fMasterVolume->CountNodes(1, 3) + 1;
+   if (fNLevel < 30)
+      fNLevel = 100;
+   CountLevels();
+   // Navigation caches are sized for the depth and id's of the old geometry - rebuild them
+   Int_t nnavigators = GetListOfNavigators()->GetEntriesFast();
+   for (Int_t i = 0; i < nnavigators; i++) {
+      TGeoNavigator *nav = (TGeoNavigator *)GetListOfNavigators()->At(i);
+      nav->ResetAll();
+      nav->GetCache()->BuildInfoBranch();
+      if (nodeid && !nav->GetCache()->HasIdArray())
+         nav->GetCache()->BuildIdArray();
+   }
+   RefreshPhysicalNodes(kFALSE);
+   if (fgVerboseLevel > 0)
+      Info("CloseGeometryIncremental", "%i nodes/ %i volume UID's in %s", fNNodes, fUniqueVolumes->GetEntriesFast() - 1,
+           GetTitle());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Clear the list of overlaps.
 
@@ -3158,6 +3238,10 @@ void TGeoManager::RestoreMasterVolume()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Voxelize all non-divided volumes.
+/// When implicit multi-threading is enabled, the voxel structures of the
+/// volumes are built in parallel: voxelization only writes data owned by the
+/// voxelized volume, except for volumes involving assemblies, whose shared
+/// shape bounding boxes are recomputed and which are therefore kept serial.
 
 void TGeoManager::Voxelize(Option_t *option)
 {
@@ -3167,6 +3251,33 @@ void TGeoManager::Voxelize(Option_t *option)
       Info("Voxelize", "Voxelizing...");
    //   Int_t nentries = fVolumes->GetSize();
    TIter next(fVolumes);
+#ifdef R__USE_IMT
+   if (!fStreamVoxels && ROOT::IsImplicitMTEnabled()) {
+      std::vector<TGeoVolume *> parallel, serial;
+      while ((vol = (TGeoVolume *)next())) {
+         if (!fIsGeomReading)
+            vol->SortNodes();
+         Bool_t hasAssembly = vol->IsAssembly();
+         Int_t nd = vol->GetNdaughters();
+         for (Int_t i = 0; (i < nd) && !hasAssembly; i++)
+            hasAssembly = vol->GetNode(i)->GetVolume()->IsAssembly();
+         if (hasAssembly)
+            serial.push_back(vol);
+         else
+            parallel.push_back(vol);
+      }
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([option](TGeoVolume *v) { v->Voxelize(option); }, parallel);
+      for (auto *v : serial)
+         v->Voxelize(option);
+      if (!fIsGeomReading) {
+         next.Reset();
+         while ((vol = (TGeoVolume *)next()))
+            vol->FindOverlaps();
+      }
+      return;
+   }
+#endif
    while ((vol = (TGeoVolume *)next())) {
       if (!fIsGeomReading)
          vol->SortNodes();
@@ -4119,6 +4230,10 @@ void TGeoManager::SetVerboseLevel(Int_t vl)
 ///    is imported executing some python scripts in $ROOTSYS/gdml.
 ///    NOTE that to use this option, the PYTHONPATH must be defined like
 ///      export PYTHONPATH=$ROOTSYS/lib:$ROOTSYS/gdml
+///    If the resource Geom.GDMLCacheDir points to a writable directory, the
+///    closed geometry is also exported there as a ROOT file keyed by the
+///    checksum of the GDML content; subsequent imports of the unchanged file
+///    are served from the cache without parsing.
 ///
 ///  - Case 2: root file (.root) or root/xml file (.xml)
 ///    Import in memory from filename the geometry with key=name.
@@ -4127,6 +4242,28 @@ void TGeoManager::SetVerboseLevel(Int_t vl)
 /// Note that this function deletes the current gGeoManager (if one)
 /// before importing the new object.
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Name of the binary cache file for a GDML geometry, keyed by the checksum
+/// of the GDML content. Returns an empty string when caching is disabled
+/// (no Geom.GDMLCacheDir configured) or the file cannot be digested.
+
+TString GDMLCacheFileName(const char *filename)
+{
+   const char *dir = gEnv ? gEnv->GetValue("Geom.GDMLCacheDir", "") : "";
+   if (!dir[0])
+      return "";
+   TMD5 *md5 = TMD5::FileChecksum(filename);
+   if (!md5)
+      return "";
+   TString cachefile = TString::Format("%s/%s.%s.root", dir, gSystem->BaseName(filename), md5->AsString());
+   delete md5;
+   return cachefile;
+}
+
+} // namespace
+
 TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_t * /*option*/)
 {
    if (fgLock) {
@@ -4143,6 +4280,16 @@ TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_
    gGeoManager = nullptr;
 
    if (strstr(filename, ".gdml")) {
+      // reload the closed geometry from the binary cache when the GDML content
+      // is unchanged, skipping the parsing and construction altogether
+      TString cachefile = GDMLCacheFileName(filename);
+      if (!cachefile.IsNull() && !gSystem->AccessPathName(cachefile, kReadPermission)) {
+         if (fgVerboseLevel > 0)
+            ::Info("TGeoManager::Import", "Reading geometry from GDML cache file: %s", cachefile.Data());
+         TGeoManager *cached = Import(cachefile);
+         if (cached)
+            return cached;
+      }
       // import from a gdml file
       new TGeoManager("GDMLImport", "Geometry imported from GDML");
       TString cmd = TString::Format("TGDMLParse::StartGDML(\"%s\")", filename);
@@ -4156,6 +4303,8 @@ TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_
          gGeoManager->SetTopVolume(world);
          gGeoManager->CloseGeometry();
          gGeoManager->DefaultColors();
+         if (!cachefile.IsNull())
+            gGeoManager->Export(cachefile);
       }
    } else {
       // import from a root file
@@ -43,11 +43,16 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TGeoParallelWorld.h"
 #include "TGeoPhysicalNode.h"
 
+#include <algorithm>
+#include <vector>
+
 static Double_t gTolerance = TGeoShape::Tolerance();
 const char *kGeoOutsidePath = " ";
 const Int_t kN3 = 3 * sizeof(Double_t);
 
 Bool_t TGeoNavigator::fgUsePWSafetyCaching = kFALSE;
+Bool_t TGeoNavigator::fgUseNavigationCaching = kFALSE;
+Double_t TGeoNavigator::fgSafetyCacheGrain = 1.;
 
 ClassImp(TGeoNavigator);
 
@@ -168,6 +173,7 @@ TGeoNavigator::TGeoNavigator(TGeoManager *geom)
 
 TGeoNavigator::~TGeoNavigator()
 {
+   ClearNavigationCaches();
    if (fCache)
       delete fCache;
    if (fBackupState)
@@ -1537,6 +1543,70 @@ TGeoNode *TGeoNavigator::FindNextBoundaryAndStep(Double_t stepmax, Bool_t compsa
    return CrossBoundaryAndLocate(kTRUE, current);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the distance to the next boundary for a bundle of tracks given as
+/// separate coordinate and direction component arrays. The tracks are first
+/// located, then processed grouped by current volume: consecutive tracks hit
+/// the same-location fast path of the search and reuse the shape data already
+/// in cache, and tracks contained in leaf volumes are intersected directly
+/// with the volume shape without the full boundary search. On output steps[i]
+/// holds the distance to the next boundary of track i limited to stepmax and,
+/// if nextnodes is provided, nextnodes[i] the node to be crossed (nullptr if
+/// no boundary closer than stepmax). The navigator is left in the state of
+/// the last processed track. Returns the number of tracks with a boundary
+/// within stepmax.
+
+Int_t TGeoNavigator::FindNextBoundaryBundle(Int_t ntracks, const Double_t *x, const Double_t *y, const Double_t *z,
+                                            const Double_t *dirx, const Double_t *diry, const Double_t *dirz,
+                                            Double_t *steps, TGeoNode **nextnodes, Double_t stepmax)
+{
+   std::vector<Int_t> index(ntracks);
+   std::vector<TGeoVolume *> volumes(ntracks);
+   // locate all tracks and record their current volume
+   for (Int_t i = 0; i < ntracks; i++) {
+      SetCurrentPoint(x[i], y[i], z[i]);
+      FindNode();
+      volumes[i] = fIsOutside ? nullptr : GetCurrentVolume();
+      index[i] = i;
+   }
+   // process tracks sharing a volume together
+   std::sort(index.begin(), index.end(), [&volumes](Int_t a, Int_t b) { return volumes[a] < volumes[b]; });
+   Int_t nfound = 0;
+   Double_t local[3], ldir[3], safe;
+   const Bool_t havePW = fGeometry->IsParallelWorldNav();
+   for (Int_t k = 0; k < ntracks; k++) {
+      Int_t i = index[k];
+      SetCurrentPoint(x[i], y[i], z[i]);
+      SetCurrentDirection(dirx[i], diry[i], dirz[i]);
+      FindNode();
+      TGeoVolume *vol = volumes[i];
+      if (vol && !fIsOutside && !fCurrentNode->GetNdaughters() && !fNmany && !fCurrentOverlapping && !havePW) {
+         // contained in a leaf volume: the next boundary is its exit surface
+         fGlobalMatrix->MasterToLocal(fPoint, local);
+         fGlobalMatrix->MasterToLocalVect(fDirection, ldir);
+         Double_t snext = vol->GetShape()->DistFromInside(local, ldir, 3, stepmax, &safe);
+         if (snext < stepmax - gTolerance) {
+            steps[i] = snext;
+            if (nextnodes)
+               nextnodes[i] = fCurrentNode;
+            nfound++;
+         } else {
+            steps[i] = stepmax;
+            if (nextnodes)
+               nextnodes[i] = nullptr;
+         }
+         continue;
+      }
+      FindNextBoundary(stepmax);
+      steps[i] = fStep;
+      if (nextnodes)
+         nextnodes[i] = fNextNode;
+      if (fNextNode && fStep < stepmax - gTolerance)
+         nfound++;
+   }
+   return nfound;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns deepest node containing current point.
 
@@ -1550,7 +1620,7 @@ TGeoNode *TGeoNavigator::FindNode(Bool_t safe_start)
    fStartSafe = safe_start;
    fIsSameLocation = kTRUE;
    TGeoNode *last = fCurrentNode;
-   TGeoNode *found = SearchNode();
+   TGeoNode *found = SearchNodeWithRelocationCache();
    if (found != last) {
       fIsSameLocation = kFALSE;
    } else {
@@ -1576,7 +1646,7 @@ TGeoNode *TGeoNavigator::FindNode(Double_t x, Double_t y, Double_t z)
    fStartSafe = kTRUE;
    fIsSameLocation = kTRUE;
    TGeoNode *last = fCurrentNode;
-   TGeoNode *found = SearchNode();
+   TGeoNode *found = SearchNodeWithRelocationCache();
    if (found != last) {
       fIsSameLocation = kFALSE;
    } else {
@@ -1586,6 +1656,51 @@ TGeoNode *TGeoNavigator::FindNode(Double_t x, Double_t y, Double_t z)
    return found;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Search the node containing the current point, probing first the cache of
+/// last visited locations. A cached path whose deepest node contains the
+/// point is restored and the search continues downwards from there instead
+/// of re-descending the full hierarchy from the top.
+
+TGeoNode *TGeoNavigator::SearchNodeWithRelocationCache()
+{
+   if (!fgUseNavigationCaching || fIsOutside || !fCache)
+      return SearchNode();
+   fNRelocCalls++;
+   Double_t local[3];
+   for (Int_t i = 0; i < kNRelocCache; i++) {
+      RelocEntry_t &entry = fRelocCache[i];
+      if (!entry.fNode)
+         continue;
+      entry.fMatrix->MasterToLocal(fPoint, local);
+      if (!entry.fNode->GetVolume()->Contains(local))
+         continue;
+      // restore the stored path, then continue the search downwards from there
+      fCurrentOverlapping = fCache->RestoreState(fNmany, entry.fState);
+      fCurrentNode = fCache->GetNode();
+      fGlobalMatrix = fCache->GetCurrentMatrix();
+      fLevel = fCache->GetLevel();
+      fNRelocHits++;
+      return SearchNode(kTRUE);
+   }
+   TGeoNode *found = SearchNode();
+   // remember the new location only if its branch has no overlapping nodes, so
+   // that a restored path cannot hide a higher priority overlapping candidate
+   if (found && !fIsOutside && !fNmany && !fCurrentOverlapping) {
+      RelocEntry_t &entry = fRelocCache[fRelocNext];
+      fRelocNext = (fRelocNext + 1) % kNRelocCache;
+      if (!entry.fState) {
+         Int_t nlevel = fGeometry->GetMaxLevel();
+         entry.fState = new TGeoCacheState(((nlevel > 0) ? nlevel : 100) + 1);
+         entry.fMatrix = new TGeoHMatrix();
+      }
+      entry.fState->SetState(fLevel, 0, fNmany, fCurrentOverlapping);
+      entry.fMatrix->CopyFrom(fGlobalMatrix);
+      entry.fNode = found;
+   }
+   return found;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes fast normal to next crossed boundary, assuming that the current point
 /// is close enough to the boundary. Works only after calling FindNextBoundary.
@@ -1682,11 +1797,96 @@ double TGeoNavigator::GetPWSafety(Double_t cpoint[3], Double_t saf_max)
    return newsafety;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the position quantization grain used to key the safety memoization
+/// table. Should be of the order of the typical distance between consecutive
+/// safety queries, in the units of the geometry.
+
+void TGeoNavigator::SetSafetyCacheGrain(Double_t grain)
+{
+   if (grain > 0)
+      fgSafetyCacheGrain = grain;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the memoization table slot for a given volume and quantized local
+/// position.
+
+Int_t TGeoNavigator::SafetySlot(const TGeoVolume *vol, const Double_t *local) const
+{
+   ULong64_t hash = (ULong64_t)(ULongptr_t)vol >> 4;
+   for (Int_t i = 0; i < 3; i++) {
+      Long64_t q = (Long64_t)TMath::Floor(local[i] / fgSafetyCacheGrain);
+      hash = (hash ^ (ULong64_t)q) * 0x100000001b3ULL;
+   }
+   return (Int_t)(hash % kNSafetyCache);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check if a safety value memoized for this volume can still be used for the
+/// given local position. Return negative value if no valid cache entry.
+
+Double_t TGeoNavigator::GetSafetyEstimateFromCache(const TGeoVolume *vol, const Double_t *local) const
+{
+   const SafetyEntry_t &entry = fSafetyCache[SafetySlot(vol, local)];
+   if (entry.fVolume != vol || entry.fSafety < TGeoShape::Tolerance())
+      return -1.;
+   const auto d0 = entry.fPoint[0] - local[0];
+   const auto d1 = entry.fPoint[1] - local[1];
+   const auto d2 = entry.fPoint[2] - local[2];
+   const auto d_sq = d0 * d0 + d1 * d1 + d2 * d2;
+   // the cached value remains a lower bound only within its own safety sphere
+   if (d_sq >= (entry.fSafety * entry.fSafety))
+      return -1.;
+   return entry.fSafety - TMath::Sqrt(d_sq);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Memoize a computed safety value for the given volume and local position.
+
+void TGeoNavigator::StoreSafetyInCache(TGeoVolume *vol, const Double_t *local, Double_t safety)
+{
+   SafetyEntry_t &entry = fSafetyCache[SafetySlot(vol, local)];
+   entry.fVolume = vol;
+   entry.fPoint[0] = local[0];
+   entry.fPoint[1] = local[1];
+   entry.fPoint[2] = local[2];
+   entry.fSafety = safety;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute safe distance from the current point. This represent the distance
-/// from POINT to the closest boundary.
+/// from POINT to the closest boundary. When navigation caching is enabled,
+/// queries made inside the same volume at nearby local positions are served
+/// from the memoization table by shrinking a previously computed safety with
+/// the distance to its evaluation point.
 
 Double_t TGeoNavigator::Safety(Bool_t inside)
+{
+   if (!fgUseNavigationCaching || inside || fIsOnBoundary || fIsOutside || fNmany || fCurrentOverlapping ||
+       fGeometry->IsParallelWorldNav())
+      return ComputeSafety(inside);
+   fNSafetyCalls++;
+   Double_t local[3];
+   fGlobalMatrix->MasterToLocal(fPoint, local);
+   TGeoVolume *vol = fCurrentNode->GetVolume();
+   Double_t estimate = GetSafetyEstimateFromCache(vol, local);
+   if (estimate > gTolerance) {
+      fNSafetyHits++;
+      fSafety = estimate;
+      return fSafety;
+   }
+   Double_t safety = ComputeSafety(inside);
+   if (!fIsOnBoundary && safety > gTolerance)
+      StoreSafetyInCache(vol, local, safety);
+   return safety;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Full computation of the safe distance from the current point, bypassing
+/// the memoization table.
+
+Double_t TGeoNavigator::ComputeSafety(Bool_t inside)
 {
    if (fIsOnBoundary) {
       fSafety = 0;
@@ -2702,6 +2902,42 @@ void TGeoNavigator::TopToMaster(const Double_t *top, Double_t *master) const
    fCurrentMatrix->LocalToMaster(top, master);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Invalidate the relocation cache and the safety memoization table. The
+/// stored path snapshots reference matrices owned by the node cache, so this
+/// must be called whenever the node cache is rebuilt. Statistics counters are
+/// preserved.
+
+void TGeoNavigator::ClearNavigationCaches()
+{
+   for (Int_t i = 0; i < kNRelocCache; i++) {
+      delete fRelocCache[i].fState;
+      delete fRelocCache[i].fMatrix;
+      fRelocCache[i].fState = nullptr;
+      fRelocCache[i].fMatrix = nullptr;
+      fRelocCache[i].fNode = nullptr;
+   }
+   fRelocNext = 0;
+   for (Int_t i = 0; i < kNSafetyCache; i++) {
+      fSafetyCache[i].fVolume = nullptr;
+      fSafetyCache[i].fSafety = -1.;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print hit statistics of the relocation cache and of the safety
+/// memoization table.
+
+void TGeoNavigator::PrintCacheStatistics() const
+{
+   Double_t fsafe = fNSafetyCalls ? 100. * fNSafetyHits / fNSafetyCalls : 0.;
+   Double_t freloc = fNRelocCalls ? 100. * fNRelocHits / fNRelocCalls : 0.;
+   Info("PrintCacheStatistics", "safety memoization: %llu hits / %llu calls (%.1f%%)", (unsigned long long)fNSafetyHits,
+        (unsigned long long)fNSafetyCalls, fsafe);
+   Info("PrintCacheStatistics", "relocation cache:   %llu hits / %llu calls (%.1f%%)", (unsigned long long)fNRelocHits,
+        (unsigned long long)fNRelocCalls, freloc);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset the navigator.
 
@@ -2726,6 +2962,7 @@ void TGeoNavigator::ResetAll()
    fLastNode = nullptr;
    fNextNode = nullptr;
    fPath = "";
+   ClearNavigationCaches();
    if (fCache) {
       Bool_t dummy = fCache->IsDummy();
       Bool_t nodeid = fCache->HasIdArray();
@@ -14,8 +14,10 @@
 \ingroup Geometry_classes
 
 Tessellated solid class. It is composed by a set of planar faces having triangular or
-quadrilateral shape. The class does not provide navigation functionality, it just wraps the data
-for the composing faces.
+quadrilateral shape. For closed bodies the class provides navigation (Contains, distance
+and safety queries) accelerated by a bounding-volume hierarchy over the facets, so that
+CAD-imported shapes with hundreds of thousands of facets can be used in tracking. Open
+face sets keep the bounding-box behavior inherited from TGeoBBox.
 */
 
 #include <iostream>
@@ -30,13 +32,131 @@ for the composing faces.
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <array>
+#include <functional>
+#include <numeric>
 #include <vector>
 
 ClassImp(TGeoTessellated);
 
 using Vertex_t = Tessellated::Vertex_t;
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from a point to an axis-aligned box (zero if inside)
+
+double PointBoxDist2(const double *point, const double *bmin, const double *bmax)
+{
+   double dist2 = 0.;
+   for (int i = 0; i < 3; ++i) {
+      double d = 0.;
+      if (point[i] < bmin[i])
+         d = bmin[i] - point[i];
+      else if (point[i] > bmax[i])
+         d = point[i] - bmax[i];
+      dist2 += d * d;
+   }
+   return dist2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Ray/axis-aligned box crossing test with the slab method. Returns true when
+/// the box is crossed within [0, tmax].
+
+bool RayBoxIntersect(const double *point, const double *invdir, const double *bmin, const double *bmax, double tmax)
+{
+   double t0 = 0., t1 = tmax;
+   for (int i = 0; i < 3; ++i) {
+      double tn = (bmin[i] - point[i]) * invdir[i];
+      double tf = (bmax[i] - point[i]) * invdir[i];
+      if (tn > tf)
+         std::swap(tn, tf);
+      if (tn > t0)
+         t0 = tn;
+      if (tf < t1)
+         t1 = tf;
+      if (t0 > t1)
+         return false;
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Ray/triangle intersection (Moller-Trumbore). Returns the signed distance
+/// along the ray, or Big() when the triangle plane is parallel or the
+/// intersection falls outside the triangle.
+
+double RayTriangleDist(const double *point, const double *dir, const Vertex_t &v0, const Vertex_t &v1,
+                       const Vertex_t &v2)
+{
+   constexpr double kTolerance = 1.e-10;
+   const Vertex_t e1 = v1 - v0;
+   const Vertex_t e2 = v2 - v0;
+   const Vertex_t d(dir[0], dir[1], dir[2]);
+   const Vertex_t pvec = Vertex_t::Cross(d, e2);
+   const double det = e1.Dot(pvec);
+   if (TMath::Abs(det) < 1.e-20)
+      return TGeoShape::Big();
+   const double invdet = 1. / det;
+   const Vertex_t tvec = Vertex_t(point[0], point[1], point[2]) - v0;
+   const double u = tvec.Dot(pvec) * invdet;
+   if (u < -kTolerance || u > 1. + kTolerance)
+      return TGeoShape::Big();
+   const Vertex_t qvec = Vertex_t::Cross(tvec, e1);
+   const double v = d.Dot(qvec) * invdet;
+   if (v < -kTolerance || u + v > 1. + kTolerance)
+      return TGeoShape::Big();
+   return e2.Dot(qvec) * invdet;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from a point to a triangle, handling all Voronoi regions
+
+double PointTriangleDist2(const Vertex_t &p, const Vertex_t &a, const Vertex_t &b, const Vertex_t &c)
+{
+   const Vertex_t ab = b - a;
+   const Vertex_t ac = c - a;
+   const Vertex_t ap = p - a;
+   const double d1 = ab.Dot(ap);
+   const double d2 = ac.Dot(ap);
+   if (d1 <= 0. && d2 <= 0.)
+      return ap.Mag2(); // region of vertex a
+   const Vertex_t bp = p - b;
+   const double d3 = ab.Dot(bp);
+   const double d4 = ac.Dot(bp);
+   if (d3 >= 0. && d4 <= d3)
+      return bp.Mag2(); // region of vertex b
+   const double vc = d1 * d4 - d3 * d2;
+   if (vc <= 0. && d1 >= 0. && d3 <= 0.) {
+      const double v = d1 / (d1 - d3);
+      return (ap - v * ab).Mag2(); // region of edge ab
+   }
+   const Vertex_t cp = p - c;
+   const double d5 = ab.Dot(cp);
+   const double d6 = ac.Dot(cp);
+   if (d6 >= 0. && d5 <= d6)
+      return cp.Mag2(); // region of vertex c
+   const double vb = d5 * d2 - d1 * d6;
+   if (vb <= 0. && d2 >= 0. && d6 <= 0.) {
+      const double w = d2 / (d2 - d6);
+      return (ap - w * ac).Mag2(); // region of edge ac
+   }
+   const double va = d3 * d6 - d5 * d4;
+   if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) {
+      const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+      return (bp - w * (c - b)).Mag2(); // region of edge bc
+   }
+   // projection falls inside the triangle
+   const double denom = 1. / (va + vb + vc);
+   const double v = vb * denom;
+   const double w = vc * denom;
+   return (ap - v * ab - w * ac).Mag2();
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compact consecutive equal vertices
 
@@ -329,14 +449,15 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
    std::multimap<long, int>().swap(fVerticesMap);
 
    if (fVertices.size() > 0) {
-      if (!check)
-         return;
-
-      // Check facets
-      for (auto i = 0; i < fNfacets; ++i)
-         FacetCheck(i);
+      if (check) {
+         // Check facets
+         for (auto i = 0; i < fNfacets; ++i)
+            FacetCheck(i);
 
-      fClosedBody = CheckClosure(fixFlipped, verbose);
+         fClosedBody = CheckClosure(fixFlipped, verbose);
+      }
+      // Build the facet BVH used by the navigation interface
+      EnsureBVH();
    }
 }
 
@@ -429,6 +550,322 @@ void TGeoTessellated::ComputeBBox()
       fOrigin[i] = 0.5 * (vmax[i] + vmin[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the bounding-volume hierarchy over the facets, if not done already.
+/// The BVH is transient and reconstructed on first use for shapes read back
+/// from a file.
+
+void TGeoTessellated::EnsureBVH() const
+{
+   if (fBVHReady.load(std::memory_order_acquire))
+      return;
+   std::lock_guard<std::mutex> guard(fBVHMutex);
+   if (fBVHReady.load(std::memory_order_relaxed))
+      return;
+   BuildBVH();
+   fBVHReady.store(true, std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Construct a BVH over the facets by recursive median split of the facet
+/// centroids along the largest axis. The tree is balanced by construction, so
+/// traversal stacks are bounded by twice the tree depth.
+
+void TGeoTessellated::BuildBVH() const
+{
+   constexpr int kLeafSize = 4;
+   fBVHNodes.clear();
+   fBVHIndices.clear();
+   const int nfacets = fFacets.size();
+   if (nfacets == 0 || fVertices.empty())
+      return;
+
+   // Per-facet bounding boxes and centroids
+   std::vector<double> boxes(6 * nfacets);
+   std::vector<Vertex_t> centroids(nfacets);
+   for (int i = 0; i < nfacets; ++i) {
+      const auto &facet = fFacets[i];
+      double *bmin = &boxes[6 * i];
+      double *bmax = bmin + 3;
+      bmin[0] = bmin[1] = bmin[2] = TGeoShape::Big();
+      bmax[0] = bmax[1] = bmax[2] = -TGeoShape::Big();
+      Vertex_t centroid;
+      for (int iv = 0; iv < facet.GetNvert(); ++iv) {
+         const auto &vert = fVertices[facet[iv]];
+         for (int j = 0; j < 3; ++j) {
+            bmin[j] = TMath::Min(bmin[j], vert[j]);
+            bmax[j] = TMath::Max(bmax[j], vert[j]);
+         }
+         centroid += vert;
+      }
+      centroid *= 1. / facet.GetNvert();
+      centroids[i] = centroid;
+   }
+
+   fBVHIndices.resize(nfacets);
+   std::iota(fBVHIndices.begin(), fBVHIndices.end(), 0);
+   fBVHNodes.reserve(2 * (nfacets / kLeafSize + 1));
+
+   std::function<int(int, int)> build = [&](int first, int count) -> int {
+      const int inode = fBVHNodes.size();
+      fBVHNodes.emplace_back();
+      // Bounding box of the facets in this node
+      double bmin[3] = {TGeoShape::Big(), TGeoShape::Big(), TGeoShape::Big()};
+      double bmax[3] = {-TGeoShape::Big(), -TGeoShape::Big(), -TGeoShape::Big()};
+      for (int i = first; i < first + count; ++i) {
+         const double *fbox = &boxes[6 * fBVHIndices[i]];
+         for (int j = 0; j < 3; ++j) {
+            bmin[j] = TMath::Min(bmin[j], fbox[j]);
+            bmax[j] = TMath::Max(bmax[j], fbox[3 + j]);
+         }
+      }
+      // Split along the largest extent of the centroid bounds
+      double cmin[3] = {TGeoShape::Big(), TGeoShape::Big(), TGeoShape::Big()};
+      double cmax[3] = {-TGeoShape::Big(), -TGeoShape::Big(), -TGeoShape::Big()};
+      for (int i = first; i < first + count; ++i) {
+         const auto &centroid = centroids[fBVHIndices[i]];
+         for (int j = 0; j < 3; ++j) {
+            cmin[j] = TMath::Min(cmin[j], centroid[j]);
+            cmax[j] = TMath::Max(cmax[j], centroid[j]);
+         }
+      }
+      int axis = 0;
+      for (int j = 1; j < 3; ++j) {
+         if (cmax[j] - cmin[j] > cmax[axis] - cmin[axis])
+            axis = j;
+      }
+      const bool leaf = count <= kLeafSize || cmax[axis] - cmin[axis] < TGeoShape::Tolerance();
+      int left = -1, right = -1;
+      if (!leaf) {
+         const int mid = first + count / 2;
+         std::nth_element(fBVHIndices.begin() + first, fBVHIndices.begin() + mid, fBVHIndices.begin() + first + count,
+                          [&](int a, int b) { return centroids[a][axis] < centroids[b][axis]; });
+         left = build(first, mid - first);
+         right = build(mid, first + count - mid);
+      }
+      // Re-access by index: the recursion may have reallocated the node vector
+      auto &node = fBVHNodes[inode];
+      for (int j = 0; j < 3; ++j) {
+         node.fMin[j] = bmin[j];
+         node.fMax[j] = bmax[j];
+      }
+      if (leaf) {
+         node.fFirst = first;
+         node.fNfacets = count;
+      } else {
+         node.fLeft = left;
+         node.fRight = right;
+      }
+      return inode;
+   };
+   build(0, nfacets);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance to the nearest facet crossed by the ray, restricted to the
+/// interval [tmin, tmax]. Returns Big() when no facet is crossed.
+
+double TGeoTessellated::DistToFacets(const double *point, const double *dir, double tmin, double tmax) const
+{
+   double invdir[3];
+   for (int i = 0; i < 3; ++i)
+      invdir[i] = 1. / (dir[i] != 0. ? dir[i] : 1.e-30);
+   double best = TGeoShape::Big();
+   int stack[64];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0) {
+      const auto &node = fBVHNodes[stack[--nstack]];
+      if (!RayBoxIntersect(point, invdir, node.fMin, node.fMax, TMath::Min(best, tmax)))
+         continue;
+      if (node.fNfacets > 0) {
+         for (int i = 0; i < node.fNfacets; ++i) {
+            const auto &facet = fFacets[fBVHIndices[node.fFirst + i]];
+            const auto &v0 = fVertices[facet[0]];
+            double t = RayTriangleDist(point, dir, v0, fVertices[facet[1]], fVertices[facet[2]]);
+            if (t >= tmin && t <= tmax && t < best)
+               best = t;
+            if (facet.GetNvert() == 4) {
+               t = RayTriangleDist(point, dir, v0, fVertices[facet[2]], fVertices[facet[3]]);
+               if (t >= tmin && t <= tmax && t < best)
+                  best = t;
+            }
+         }
+      } else {
+         stack[nstack++] = node.fLeft;
+         stack[nstack++] = node.fRight;
+      }
+   }
+   return best;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance to the facet closest to the point, also returning its index
+
+double TGeoTessellated::SafetyToFacets(const double *point, int &ifacet) const
+{
+   const Vertex_t p(point[0], point[1], point[2]);
+   double best2 = TGeoShape::Big();
+   ifacet = -1;
+   int stack[64];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0) {
+      const auto &node = fBVHNodes[stack[--nstack]];
+      if (PointBoxDist2(point, node.fMin, node.fMax) >= best2)
+         continue;
+      if (node.fNfacets > 0) {
+         for (int i = 0; i < node.fNfacets; ++i) {
+            const int ind = fBVHIndices[node.fFirst + i];
+            const auto &facet = fFacets[ind];
+            const auto &v0 = fVertices[facet[0]];
+            double dist2 = PointTriangleDist2(p, v0, fVertices[facet[1]], fVertices[facet[2]]);
+            if (facet.GetNvert() == 4)
+               dist2 = TMath::Min(dist2, PointTriangleDist2(p, v0, fVertices[facet[2]], fVertices[facet[3]]));
+            if (dist2 < best2) {
+               best2 = dist2;
+               ifacet = ind;
+            }
+         }
+      } else {
+         stack[nstack++] = node.fLeft;
+         stack[nstack++] = node.fRight;
+      }
+   }
+   return TMath::Sqrt(best2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if point is inside this shape. Closed bodies count the parity of facet
+/// crossings along a fixed ray; open face sets keep the bounding-box answer.
+
+Bool_t TGeoTessellated::Contains(const Double_t *point) const
+{
+   if (!TGeoBBox::Contains(point))
+      return kFALSE;
+   if (!fClosedBody || fFacets.empty() || fVertices.empty())
+      return kTRUE;
+   EnsureBVH();
+   // The test direction stays away from the coordinate axes so that rays
+   // rarely graze the axis-aligned edges typical for CAD meshes.
+   constexpr double dir[3] = {0.357406744337, 0.625376483357, 0.693736194587};
+   double invdir[3];
+   for (int i = 0; i < 3; ++i)
+      invdir[i] = 1. / dir[i];
+   int ncross = 0;
+   int stack[64];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0) {
+      const auto &node = fBVHNodes[stack[--nstack]];
+      if (!RayBoxIntersect(point, invdir, node.fMin, node.fMax, TGeoShape::Big()))
+         continue;
+      if (node.fNfacets > 0) {
+         for (int i = 0; i < node.fNfacets; ++i) {
+            const auto &facet = fFacets[fBVHIndices[node.fFirst + i]];
+            const auto &v0 = fVertices[facet[0]];
+            double t = RayTriangleDist(point, dir, v0, fVertices[facet[1]], fVertices[facet[2]]);
+            if (t > TGeoShape::Tolerance() && t < TGeoShape::Big())
+               ncross++;
+            if (facet.GetNvert() == 4) {
+               t = RayTriangleDist(point, dir, v0, fVertices[facet[2]], fVertices[facet[3]]);
+               if (t > TGeoShape::Tolerance() && t < TGeoShape::Big())
+                  ncross++;
+            }
+         }
+      } else {
+         stack[nstack++] = node.fLeft;
+         stack[nstack++] = node.fRight;
+      }
+   }
+   return (ncross % 2) == 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute normal to the facet closest to the point, oriented along dir
+
+void TGeoTessellated::ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm) const
+{
+   if (!fClosedBody || fFacets.empty() || fVertices.empty()) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   EnsureBVH();
+   int ifacet = -1;
+   SafetyToFacets(point, ifacet);
+   bool degenerated = true;
+   Vertex_t normal;
+   if (ifacet >= 0)
+      normal = FacetComputeNormal(ifacet, degenerated);
+   if (degenerated) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   normal.CopyTo(norm);
+   if (norm[0] * dir[0] + norm[1] * dir[1] + norm[2] * dir[2] < 0) {
+      norm[0] = -norm[0];
+      norm[1] = -norm[1];
+      norm[2] = -norm[2];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from inside point to surface of the tessellated shape
+
+Double_t TGeoTessellated::DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                         Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kTRUE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   if (!fClosedBody || fFacets.empty() || fVertices.empty())
+      return TGeoBBox::DistFromInside(point, dir, 3, step);
+   EnsureBVH();
+   const double snxt = DistToFacets(point, dir, TGeoShape::Tolerance(), TGeoShape::Big());
+   // No facet ahead means the point is on the surface leaving the shape
+   return (snxt == TGeoShape::Big()) ? 0. : snxt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from outside point to surface of the tessellated shape
+
+Double_t TGeoTessellated::DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                          Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kFALSE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   if (!fClosedBody || fFacets.empty() || fVertices.empty())
+      return TGeoBBox::DistFromOutside(point, dir, 3, step);
+   // Quick rejection on the bounding box
+   const double sdist = TGeoBBox::DistFromOutside(point, dir, fDX, fDY, fDZ, fOrigin, step);
+   if (sdist >= step)
+      return TGeoShape::Big();
+   EnsureBVH();
+   const double snxt = DistToFacets(point, dir, -TGeoShape::Tolerance(), step);
+   return (snxt == TGeoShape::Big()) ? TGeoShape::Big() : TMath::Max(snxt, 0.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute closest distance from point to the facets of this shape
+
+Double_t TGeoTessellated::Safety(const Double_t *point, Bool_t in) const
+{
+   if (!fClosedBody || fFacets.empty() || fVertices.empty())
+      return TGeoBBox::Safety(point, in);
+   EnsureBVH();
+   int ifacet = -1;
+   return SafetyToFacets(point, ifacet);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns numbers of vertices, segments and polygons composing the shape mesh.
 
@@ -1009,6 +1009,10 @@ TGeoNode *TGeoVolume::AddNode(TGeoVolume *vol, Int_t copy_no, TGeoMatrix *mat, O
    node->SetNumber(copy_no);
    fRefCount++;
    vol->Grab();
+   if (fVoxels)
+      fVoxels->SetNeedRebuild();
+   if (fGeoManager && fGeoManager->IsClosed())
+      fGeoManager->MarkVolumeDirty(this);
    return node;
 }
 
@@ -1036,6 +1040,10 @@ void TGeoVolume::AddNodeOffset(TGeoVolume *vol, Int_t copy_no, Double_t offset,
    node->SetName(name);
    node->SetNumber(copy_no + 1);
    vol->Grab();
+   if (fVoxels)
+      fVoxels->SetNeedRebuild();
+   if (fGeoManager && fGeoManager->IsClosed())
+      fGeoManager->MarkVolumeDirty(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1086,6 +1094,10 @@ void TGeoVolume::AddNodeOverlap(TGeoVolume *vol, Int_t copy_no, TGeoMatrix *mat,
    if (vol->GetMedium() == fMedium)
       node->SetVirtual();
    vol->Grab();
+   if (fVoxels)
+      fVoxels->SetNeedRebuild();
+   if (fGeoManager && fGeoManager->IsClosed())
+      fGeoManager->MarkVolumeDirty(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2260,6 +2272,8 @@ void TGeoVolume::RemoveNode(TGeoNode *node)
       fVoxels->SetNeedRebuild();
    if (IsAssembly())
       fShape->ComputeBBox();
+   if (fGeoManager && fGeoManager->IsClosed())
+      fGeoManager->MarkVolumeDirty(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2314,6 +2328,8 @@ TGeoNode *TGeoVolume::ReplaceNode(TGeoNode *nodeorig, TGeoShape *newshape, TGeoM
       fVoxels->SetNeedRebuild();
    if (IsAssembly())
       fShape->ComputeBBox();
+   if (fGeoManager && fGeoManager->IsClosed())
+      fGeoManager->MarkVolumeDirty(this);
    return newnode;
 }
 
@@ -31,6 +31,76 @@ Full description with examples and pictures
 #include "TGeoManager.h"
 #include "TGeoStateInfo.h"
 
+#include <cstring>
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Index of the lowest set bit of a non-zero 64-bit word
+
+inline Int_t FirstSetBit(ULong64_t word)
+{
+#ifdef _MSC_VER
+   unsigned long idx = 0;
+   _BitScanForward64(&idx, word);
+   return (Int_t)idx;
+#else
+   return (Int_t)__builtin_ctzll(word);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load up to 8 mask bytes starting at byte `pos` into a word whose bit j
+/// corresponds to candidate (pos << 3) + j, so the set candidates can be
+/// extracted with FirstSetBit instead of testing all 8*nbytes bits one by one
+
+inline ULong64_t LoadMaskWord(const UChar_t *array, Int_t nbytes, Int_t pos)
+{
+   Int_t n = nbytes - pos;
+   if (n > 8)
+      n = 8;
+   ULong64_t word = 0;
+#ifdef R__BYTESWAP
+   memcpy(&word, array + pos, n);
+#else
+   // big endian: a plain load would reorder the bytes
+   for (Int_t i = 0; i < n; i++)
+      word |= (ULong64_t)array[pos + i] << (8 * i);
+#endif
+   return word;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write back up to 8 mask bytes starting at byte `pos`, using the same byte
+/// ordering as LoadMaskWord
+
+inline void StoreMaskWord(UChar_t *array, Int_t nbytes, Int_t pos, ULong64_t word)
+{
+   Int_t n = nbytes - pos;
+   if (n > 8)
+      n = 8;
+#ifdef R__BYTESWAP
+   memcpy(array + pos, &word, n);
+#else
+   for (Int_t i = 0; i < n; i++)
+      array[pos + i] = (UChar_t)(word >> (8 * i));
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// OR up to 8 mask bytes starting at byte `pos` into the array
+
+inline void OrMaskWord(UChar_t *array, Int_t nbytes, Int_t pos, ULong64_t word)
+{
+   Int_t n = nbytes - pos;
+   if (n > 8)
+      n = 8;
+   for (Int_t i = 0; i < n; i++)
+      array[pos + i] |= (UChar_t)(word >> (8 * i));
+}
+
+} // namespace
+
 ClassImp(TGeoVoxelFinder);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1502,25 +1572,15 @@ Bool_t TGeoVoxelFinder::Intersect(Int_t n1, UChar_t *array1, Int_t &nf, Int_t *r
    Int_t nd = fVolume->GetNdaughters(); // also number of bits to scan
    nf = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   Int_t current_byte;
-   Int_t current_bit;
-   UChar_t byte;
-   Bool_t ibreak = kFALSE;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = array1[current_byte];
-      if (!byte)
-         continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            result[nf++] = (current_byte << 3) + current_bit;
-            if (nf == n1) {
-               ibreak = kTRUE;
-               break;
-            }
-         }
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = LoadMaskWord(array1, nbytes, pos);
+      Int_t base = pos << 3;
+      while (word) {
+         result[nf++] = base + FirstSetBit(word);
+         if (nf == n1)
+            return kTRUE;
+         word &= word - 1;
       }
-      if (ibreak)
-         return kTRUE;
    }
    return kTRUE;
 }
@@ -1543,27 +1603,15 @@ Bool_t TGeoVoxelFinder::IntersectAndStore(Int_t n1, UChar_t *array1, TGeoStateIn
       return kTRUE;
    }
    memcpy(td.fVoxBits1, array1, nbytes * sizeof(UChar_t));
-   Int_t current_byte;
-   Int_t current_bit;
-   UChar_t byte;
-   Bool_t ibreak = kFALSE;
-   Int_t icand;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = array1[current_byte];
-      icand = current_byte << 3;
-      if (!byte)
-         continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            td.fVoxCheckList[td.fVoxNcandidates++] = icand + current_bit;
-            if (td.fVoxNcandidates == n1) {
-               ibreak = kTRUE;
-               break;
-            }
-         }
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = LoadMaskWord(array1, nbytes, pos);
+      Int_t base = pos << 3;
+      while (word) {
+         td.fVoxCheckList[td.fVoxNcandidates++] = base + FirstSetBit(word);
+         if (td.fVoxNcandidates == n1)
+            return kTRUE;
+         word &= word - 1;
       }
-      if (ibreak)
-         return kTRUE;
    }
    return kTRUE;
 }
@@ -1578,27 +1626,21 @@ Bool_t TGeoVoxelFinder::Union(Int_t n1, UChar_t *array1, TGeoStateInfo &td)
                                         //   UChar_t *bits = gGeoManager->GetBits();
    td.fVoxNcandidates = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   Int_t current_byte;
-   Int_t current_bit;
-   UChar_t byte;
-   Bool_t ibreak = kFALSE;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      //      printf("   byte %i : bits=%i array=%i\n", current_byte, bits[current_byte], array1[current_byte]);
-      byte = (~td.fVoxBits1[current_byte]) & array1[current_byte];
-      if (!byte)
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = ~LoadMaskWord(td.fVoxBits1, nbytes, pos) & LoadMaskWord(array1, nbytes, pos);
+      if (!word)
          continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            td.fVoxCheckList[td.fVoxNcandidates++] = (current_byte << 3) + current_bit;
-            if (td.fVoxNcandidates == n1) {
-               ibreak = kTRUE;
-               break;
-            }
+      Int_t base = pos << 3;
+      for (ULong64_t scan = word; scan; scan &= scan - 1) {
+         Int_t bit = FirstSetBit(scan);
+         td.fVoxCheckList[td.fVoxNcandidates++] = base + bit;
+         if (td.fVoxNcandidates == n1) {
+            // mark only the bytes scanned so far, like the byte-wise loop did
+            OrMaskWord(td.fVoxBits1, pos + 1 + (bit >> 3), pos, word);
+            return kTRUE;
          }
       }
-      td.fVoxBits1[current_byte] |= byte;
-      if (ibreak)
-         return kTRUE;
+      OrMaskWord(td.fVoxBits1, nbytes, pos, word);
    }
    return (td.fVoxNcandidates > 0);
 }
@@ -1613,19 +1655,15 @@ Bool_t TGeoVoxelFinder::Union(Int_t /*n1*/, UChar_t *array1, Int_t /*n2*/, UChar
                                         //   UChar_t *bits = gGeoManager->GetBits();
    td.fVoxNcandidates = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   Int_t current_byte;
-   Int_t current_bit;
-   UChar_t byte;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = (~td.fVoxBits1[current_byte]) & (array1[current_byte] & array2[current_byte]);
-      if (!byte)
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = ~LoadMaskWord(td.fVoxBits1, nbytes, pos) &
+                       (LoadMaskWord(array1, nbytes, pos) & LoadMaskWord(array2, nbytes, pos));
+      if (!word)
          continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            td.fVoxCheckList[td.fVoxNcandidates++] = (current_byte << 3) + current_bit;
-         }
-      }
-      td.fVoxBits1[current_byte] |= byte;
+      Int_t base = pos << 3;
+      for (ULong64_t scan = word; scan; scan &= scan - 1)
+         td.fVoxCheckList[td.fVoxNcandidates++] = base + FirstSetBit(scan);
+      OrMaskWord(td.fVoxBits1, nbytes, pos, word);
    }
    return (td.fVoxNcandidates > 0);
 }
@@ -1642,19 +1680,16 @@ Bool_t TGeoVoxelFinder::Union(Int_t /*n1*/, UChar_t *array1, Int_t /*n2*/, UChar
                                         //   UChar_t *bits = gGeoManager->GetBits();
    td.fVoxNcandidates = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   Int_t current_byte;
-   Int_t current_bit;
-   UChar_t byte;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = (~td.fVoxBits1[current_byte]) & (array1[current_byte] & array2[current_byte] & array3[current_byte]);
-      if (!byte)
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = ~LoadMaskWord(td.fVoxBits1, nbytes, pos) &
+                       (LoadMaskWord(array1, nbytes, pos) & LoadMaskWord(array2, nbytes, pos) &
+                        LoadMaskWord(array3, nbytes, pos));
+      if (!word)
          continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            td.fVoxCheckList[td.fVoxNcandidates++] = (current_byte << 3) + current_bit;
-         }
-      }
-      td.fVoxBits1[current_byte] |= byte;
+      Int_t base = pos << 3;
+      for (ULong64_t scan = word; scan; scan &= scan - 1)
+         td.fVoxCheckList[td.fVoxNcandidates++] = base + FirstSetBit(scan);
+      OrMaskWord(td.fVoxBits1, nbytes, pos, word);
    }
    return (td.fVoxNcandidates > 0);
 }
@@ -1667,25 +1702,15 @@ Bool_t TGeoVoxelFinder::Intersect(Int_t n1, UChar_t *array1, Int_t n2, UChar_t *
    Int_t nd = fVolume->GetNdaughters(); // also number of bits to scan
    nf = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   Int_t current_byte;
-   Int_t current_bit;
-   UChar_t byte;
-   Bool_t ibreak = kFALSE;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = array1[current_byte] & array2[current_byte];
-      if (!byte)
-         continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            result[nf++] = (current_byte << 3) + current_bit;
-            if ((nf == n1) || (nf == n2)) {
-               ibreak = kTRUE;
-               break;
-            }
-         }
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = LoadMaskWord(array1, nbytes, pos) & LoadMaskWord(array2, nbytes, pos);
+      Int_t base = pos << 3;
+      while (word) {
+         result[nf++] = base + FirstSetBit(word);
+         if ((nf == n1) || (nf == n2))
+            return kTRUE;
+         word &= word - 1;
       }
-      if (ibreak)
-         return kTRUE;
    }
    return (nf > 0);
 }
@@ -1700,22 +1725,12 @@ TGeoVoxelFinder::IntersectAndStore(Int_t /*n1*/, UChar_t *array1, Int_t /*n2*/,
                                         //   UChar_t *bits = gGeoManager->GetBits();
    td.fVoxNcandidates = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   //   memset(bits, 0, nbytes*sizeof(UChar_t));
-   Int_t current_byte;
-   Int_t current_bit;
-   Int_t icand;
-   UChar_t byte;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = array1[current_byte] & array2[current_byte];
-      icand = current_byte << 3;
-      td.fVoxBits1[current_byte] = byte;
-      if (!byte)
-         continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            td.fVoxCheckList[td.fVoxNcandidates++] = icand + current_bit;
-         }
-      }
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = LoadMaskWord(array1, nbytes, pos) & LoadMaskWord(array2, nbytes, pos);
+      StoreMaskWord(td.fVoxBits1, nbytes, pos, word);
+      Int_t base = pos << 3;
+      for (ULong64_t scan = word; scan; scan &= scan - 1)
+         td.fVoxCheckList[td.fVoxNcandidates++] = base + FirstSetBit(scan);
    }
    return (td.fVoxNcandidates > 0);
 }
@@ -1729,25 +1744,16 @@ Bool_t TGeoVoxelFinder::Intersect(Int_t n1, UChar_t *array1, Int_t n2, UChar_t *
    Int_t nd = fVolume->GetNdaughters(); // also number of bits to scan
    nf = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   Int_t current_byte;
-   Int_t current_bit;
-   UChar_t byte;
-   Bool_t ibreak = kFALSE;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = array1[current_byte] & array2[current_byte] & array3[current_byte];
-      if (!byte)
-         continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            result[nf++] = (current_byte << 3) + current_bit;
-            if ((nf == n1) || (nf == n2) || (nf == n3)) {
-               ibreak = kTRUE;
-               break;
-            }
-         }
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = LoadMaskWord(array1, nbytes, pos) & LoadMaskWord(array2, nbytes, pos) &
+                       LoadMaskWord(array3, nbytes, pos);
+      Int_t base = pos << 3;
+      while (word) {
+         result[nf++] = base + FirstSetBit(word);
+         if ((nf == n1) || (nf == n2) || (nf == n3))
+            return kTRUE;
+         word &= word - 1;
       }
-      if (ibreak)
-         return kTRUE;
    }
    return (nf > 0);
 }
@@ -1762,22 +1768,13 @@ Bool_t TGeoVoxelFinder::IntersectAndStore(Int_t /*n1*/, UChar_t *array1, Int_t /
                                         //   UChar_t *bits = gGeoManager->GetBits();
    td.fVoxNcandidates = 0;
    Int_t nbytes = 1 + ((nd - 1) >> 3);
-   //   memset(bits, 0, nbytes*sizeof(UChar_t));
-   Int_t current_byte;
-   Int_t current_bit;
-   Int_t icand;
-   UChar_t byte;
-   for (current_byte = 0; current_byte < nbytes; current_byte++) {
-      byte = array1[current_byte] & array2[current_byte] & array3[current_byte];
-      icand = current_byte << 3;
-      td.fVoxBits1[current_byte] = byte;
-      if (!byte)
-         continue;
-      for (current_bit = 0; current_bit < 8; current_bit++) {
-         if (byte & (1 << current_bit)) {
-            td.fVoxCheckList[td.fVoxNcandidates++] = icand + current_bit;
-         }
-      }
+   for (Int_t pos = 0; pos < nbytes; pos += 8) {
+      ULong64_t word = LoadMaskWord(array1, nbytes, pos) & LoadMaskWord(array2, nbytes, pos) &
+                       LoadMaskWord(array3, nbytes, pos);
+      StoreMaskWord(td.fVoxBits1, nbytes, pos, word);
+      Int_t base = pos << 3;
+      for (ULong64_t scan = word; scan; scan &= scan - 1)
+         td.fVoxCheckList[td.fVoxNcandidates++] = base + FirstSetBit(scan);
    }
    return (td.fVoxNcandidates > 0);
 }
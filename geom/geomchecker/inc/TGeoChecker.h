@@ -49,6 +49,7 @@ private:
    TGeoNode *fSelectedNode;  //! Selected node for overlap checking
    Int_t fNchecks;           //! Number of checks for current volume
    Int_t fNmeshPoints;       //! Number of points on mesh to be checked
+   Bool_t fParallel;         //! Worker instance of a parallel overlap scan
                              // methods
    void CleanPoints(Double_t *points, Int_t &numPoints) const;
    Int_t NChecksPerVolume(TGeoVolume *vol);
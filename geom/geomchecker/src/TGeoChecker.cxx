@@ -81,13 +81,85 @@ volume by material sampling. Accepts as input the desired precision.
 #include "TBuffer3D.h"
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
+#include "TROOT.h"
 
 #include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 // statics and globals
 
 ClassImp(TGeoChecker);
 
+namespace {
+
+std::mutex gOverlapMutex; // protects the overlap list of the manager
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register an overlap with the manager. Concurrent workers of a parallel
+/// overlap check stream their results through this single entry point.
+
+void RegisterOverlap(TGeoManager *geom, TGeoOverlap *nodeovlp)
+{
+   std::lock_guard<std::mutex> guard(gOverlapMutex);
+   geom->AddOverlap(nodeovlp);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Conservative broad-phase test for two positioned shapes using their bounding
+/// boxes. The corners of the second box are transformed into the frame of the
+/// first and their axis-aligned extent is compared to the extent of the first
+/// box enlarged by the shape tolerance. Returns kFALSE only if an overlap of
+/// the two shapes is excluded.
+
+Bool_t BoxesOverlapping(const TGeoBBox *box1, const TGeoMatrix *mat1, const TGeoBBox *box2, const TGeoMatrix *mat2)
+{
+   Double_t corner[3], master[3], local[3];
+   Double_t cmin[3], cmax[3];
+   for (Int_t i = 0; i < 3; i++) {
+      cmin[i] = TGeoShape::Big();
+      cmax[i] = -TGeoShape::Big();
+   }
+   const Double_t *orig2 = box2->GetOrigin();
+   for (Int_t ic = 0; ic < 8; ic++) {
+      corner[0] = orig2[0] + ((ic & 1) ? box2->GetDX() : -box2->GetDX());
+      corner[1] = orig2[1] + ((ic & 2) ? box2->GetDY() : -box2->GetDY());
+      corner[2] = orig2[2] + ((ic & 4) ? box2->GetDZ() : -box2->GetDZ());
+      mat2->LocalToMaster(corner, master);
+      mat1->MasterToLocal(master, local);
+      for (Int_t i = 0; i < 3; i++) {
+         cmin[i] = TMath::Min(cmin[i], local[i]);
+         cmax[i] = TMath::Max(cmax[i], local[i]);
+      }
+   }
+   const Double_t *orig1 = box1->GetOrigin();
+   Double_t dbox1[3] = {box1->GetDX(), box1->GetDY(), box1->GetDZ()};
+   Double_t tolerance = TGeoShape::Tolerance();
+   for (Int_t i = 0; i < 3; i++) {
+      if (cmax[i] < orig1[i] - dbox1[i] - tolerance || cmin[i] > orig1[i] + dbox1[i] + tolerance)
+         return kFALSE;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A pair of positioned volume candidates to be checked for overlap/extrusion.
+
+struct CheckItem_t {
+   TString fName;     // name of the overlap candidate
+   TGeoVolume *fVol1; // first volume
+   TGeoVolume *fVol2; // second volume
+   TGeoHMatrix fMat1; // global matrix of first volume
+   TGeoHMatrix fMat2; // global matrix of second volume
+   Bool_t fIsOvlp;    // kTRUE for overlap check, kFALSE for extrusion check
+};
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor
 
@@ -104,7 +176,8 @@ TGeoChecker::TGeoChecker()
      fTimer(nullptr),
      fSelectedNode(nullptr),
      fNchecks(0),
-     fNmeshPoints(1000)
+     fNmeshPoints(1000),
+     fParallel(kFALSE)
 {
 }
 
@@ -124,7 +197,8 @@ TGeoChecker::TGeoChecker(TGeoManager *geom)
      fTimer(nullptr),
      fSelectedNode(nullptr),
      fNchecks(0),
-     fNmeshPoints(1000)
+     fNmeshPoints(1000),
+     fParallel(kFALSE)
 {
    fBuff1 = new TBuffer3D(TBuffer3DTypes::kGeneric, 500, 3 * 500, 0, 0, 0, 0);
    fBuff2 = new TBuffer3D(TBuffer3DTypes::kGeneric, 500, 3 * 500, 0, 0, 0, 0);
@@ -1017,6 +1091,10 @@ TGeoOverlap *TGeoChecker::MakeCheckOverlap(const char *name, TGeoVolume *vol1, T
       return nullptr;
    if (dynamic_cast<TGeoTessellated *>(vol1->GetShape()) || dynamic_cast<TGeoTessellated *>(vol2->GetShape()))
       return nullptr;
+   // Broad-phase rejection: skip the mesh test if the bounding boxes cannot touch.
+   if (isovlp &&
+       !BoxesOverlapping((TGeoBBox *)vol1->GetShape(), mat1, (TGeoBBox *)vol2->GetShape(), mat2))
+      return nullptr;
    Int_t numPoints1 = fBuff1->NbPnts();
    Int_t numSegs1 = fBuff1->NbSegs();
    Int_t numPols1 = fBuff1->NbPols();
@@ -1033,7 +1111,8 @@ TGeoOverlap *TGeoChecker::MakeCheckOverlap(const char *name, TGeoVolume *vol1, T
    Double_t tolerance = TGeoShape::Tolerance();
    TGeoShape *shape1 = vol1->GetShape();
    TGeoShape *shape2 = vol2->GetShape();
-   OpProgress("refresh", 0, 0, nullptr, kFALSE, kTRUE);
+   if (!fParallel)
+      OpProgress("refresh", 0, 0, nullptr, kFALSE, kTRUE);
    shape1->GetMeshNumbers(numPoints1, numSegs1, numPols1);
    if (fBuff1->fID != (TObject *)shape1) {
       // Fill first buffer.
@@ -1088,7 +1167,7 @@ TGeoOverlap *TGeoChecker::MakeCheckOverlap(const char *name, TGeoVolume *vol1, T
                isextrusion = kTRUE;
                nodeovlp = new TGeoOverlap(name, vol1, vol2, mat1, mat2, kFALSE, safety);
                nodeovlp->SetNextPoint(point[0], point[1], point[2]);
-               fGeoManager->AddOverlap(nodeovlp);
+               RegisterOverlap(fGeoManager, nodeovlp);
             } else {
                if (safety > nodeovlp->GetOverlap())
                   nodeovlp->SetOverlap(safety);
@@ -1120,7 +1199,7 @@ TGeoOverlap *TGeoChecker::MakeCheckOverlap(const char *name, TGeoVolume *vol1, T
                isextrusion = kTRUE;
                nodeovlp = new TGeoOverlap(name, vol1, vol2, mat1, mat2, kFALSE, safety);
                nodeovlp->SetNextPoint(point[0], point[1], point[2]);
-               fGeoManager->AddOverlap(nodeovlp);
+               RegisterOverlap(fGeoManager, nodeovlp);
             } else {
                if (safety > nodeovlp->GetOverlap())
                   nodeovlp->SetOverlap(safety);
@@ -1150,7 +1229,7 @@ TGeoOverlap *TGeoChecker::MakeCheckOverlap(const char *name, TGeoVolume *vol1, T
             isoverlapping = kTRUE;
             nodeovlp = new TGeoOverlap(name, vol1, vol2, mat1, mat2, kTRUE, safety);
             nodeovlp->SetNextPoint(point[0], point[1], point[2]);
-            fGeoManager->AddOverlap(nodeovlp);
+            RegisterOverlap(fGeoManager, nodeovlp);
          } else {
             if (safety > nodeovlp->GetOverlap())
                nodeovlp->SetOverlap(safety);
@@ -1176,7 +1255,7 @@ TGeoOverlap *TGeoChecker::MakeCheckOverlap(const char *name, TGeoVolume *vol1, T
             isoverlapping = kTRUE;
             nodeovlp = new TGeoOverlap(name, vol1, vol2, mat1, mat2, kTRUE, safety);
             nodeovlp->SetNextPoint(point[0], point[1], point[2]);
-            fGeoManager->AddOverlap(nodeovlp);
+            RegisterOverlap(fGeoManager, nodeovlp);
          } else {
             if (safety > nodeovlp->GetOverlap())
                nodeovlp->SetOverlap(safety);
@@ -1302,7 +1381,7 @@ void TGeoChecker::CheckOverlapsBySampling(TGeoVolume *vol, Double_t ovlp, Int_t
                TString::Format("Volume %s: node %s overlapping %s", vol->GetName(), name1.Data(), name2.Data()),
                node1->GetVolume(), node2->GetVolume(), &mat1, &mat2, kTRUE, safe);
             flags[nd * id1 + id0] = nodeovlp;
-            fGeoManager->AddOverlap(nodeovlp);
+            RegisterOverlap(fGeoManager, nodeovlp);
          }
          // Max 100 points per marker
          if (nodeovlp->GetPolyMarker()->GetN() < 100)
@@ -1448,13 +1527,60 @@ void TGeoChecker::CheckOverlaps(const TGeoVolume *vol, Double_t ovlp, Option_t *
       CheckOverlapsBySampling((TGeoVolume *)vol, ovlp, npoints);
       return;
    }
+   // Candidate pairs are first collected, then checked in a separate pass that
+   // can be distributed on the implicit MT pool.
+   std::vector<CheckItem_t> items;
+   auto addCheck = [&items](const char *name, TGeoVolume *vol1, TGeoVolume *vol2, const TGeoMatrix *mat1,
+                            const TGeoMatrix *mat2, Bool_t isovlp) {
+      items.emplace_back();
+      CheckItem_t &item = items.back();
+      item.fName = name;
+      item.fVol1 = vol1;
+      item.fVol2 = vol2;
+      item.fMat1 = mat1;
+      item.fMat2 = mat2;
+      item.fIsOvlp = isovlp;
+   };
+   auto runChecks = [this, ovlp, &items]() {
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && items.size() > 1) {
+         // Slice the work in contiguous chunks, each processed by a worker
+         // checker owning private mesh buffers. Results are streamed to the
+         // manager as they are found.
+         UInt_t nitems = items.size();
+         UInt_t nchunks = TMath::Min(nitems, 4 * ROOT::GetThreadPoolSize());
+         std::vector<UInt_t> chunks(nchunks);
+         for (UInt_t i = 0; i < nchunks; i++)
+            chunks[i] = i;
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(
+            [&](UInt_t ichunk) {
+               TGeoChecker worker(fGeoManager);
+               worker.fNmeshPoints = fNmeshPoints;
+               worker.fParallel = kTRUE;
+               UInt_t first = ichunk * nitems / nchunks;
+               UInt_t last = (ichunk + 1) * nitems / nchunks;
+               for (UInt_t i = first; i < last; i++) {
+                  CheckItem_t &item = items[i];
+                  worker.MakeCheckOverlap(item.fName, item.fVol1, item.fVol2, &item.fMat1, &item.fMat2, item.fIsOvlp,
+                                          ovlp);
+               }
+            },
+            chunks);
+         items.clear();
+         return;
+      }
+#endif
+      for (auto &item : items)
+         MakeCheckOverlap(item.fName, item.fVol1, item.fVol2, &item.fMat1, &item.fMat2, item.fIsOvlp, ovlp);
+      items.clear();
+   };
    Bool_t is_assembly = vol->IsAssembly();
    TGeoIterator next1((TGeoVolume *)vol);
    TGeoIterator next2((TGeoVolume *)vol);
    TString path;
    // first, test if daughters extrude their container
    TGeoNode *node, *nodecheck;
-   TGeoChecker *checker = (TGeoChecker *)this;
 
    //   TGeoOverlap *nodeovlp = 0;
    UInt_t id;
@@ -1486,20 +1612,22 @@ void TGeoChecker::CheckOverlaps(const TGeoVolume *vol, Double_t ovlp, Option_t *
                }
             }
             next1.GetPath(path);
-            checker->MakeCheckOverlap(TString::Format("%s extruded by: %s", vol->GetName(), path.Data()),
-                                      (TGeoVolume *)vol, node->GetVolume(), gGeoIdentity,
-                                      (TGeoMatrix *)next1.GetCurrentMatrix(), kFALSE, ovlp);
+            addCheck(TString::Format("%s extruded by: %s", vol->GetName(), path.Data()), (TGeoVolume *)vol,
+                     node->GetVolume(), gGeoIdentity, next1.GetCurrentMatrix(), kFALSE);
             next1.Skip();
          }
       }
    }
 
    // now check if the daughters overlap with each other
-   if (nd < 2)
+   if (nd < 2) {
+      runChecks();
       return;
+   }
    TGeoVoxelFinder *vox = vol->GetVoxels();
    if (!vox) {
       Warning("CheckOverlaps", "Volume %s with %i daughters but not voxelized", vol->GetName(), nd);
+      runChecks();
       return;
    }
    if (vox->NeedRebuild()) {
@@ -1582,10 +1710,9 @@ void TGeoChecker::CheckOverlaps(const TGeoVolume *vol, Double_t ovlp, Option_t *
                            next2.GetPath(path1);
                            hmat2 = node02->GetMatrix();
                            hmat2 *= *next2.GetCurrentMatrix();
-                           checker->MakeCheckOverlap(TString::Format("%s/%s overlapping %s/%s", vol->GetName(),
-                                                                     path.Data(), vol->GetName(), path1.Data()),
-                                                     node->GetVolume(), node1->GetVolume(), &hmat1, &hmat2, kTRUE,
-                                                     ovlp);
+                           addCheck(TString::Format("%s/%s overlapping %s/%s", vol->GetName(), path.Data(),
+                                                    vol->GetName(), path1.Data()),
+                                    node->GetVolume(), node1->GetVolume(), &hmat1, &hmat2, kTRUE);
                            next2.Skip();
                         }
                      }
@@ -1611,10 +1738,9 @@ void TGeoChecker::CheckOverlaps(const TGeoVolume *vol, Double_t ovlp, Option_t *
                            }
                         }
                      }
-                     checker->MakeCheckOverlap(TString::Format("%s/%s overlapping %s/%s", vol->GetName(), path.Data(),
-                                                               vol->GetName(), path1.Data()),
-                                               node->GetVolume(), node02->GetVolume(), &hmat1, node02->GetMatrix(),
-                                               kTRUE, ovlp);
+                     addCheck(TString::Format("%s/%s overlapping %s/%s", vol->GetName(), path.Data(), vol->GetName(),
+                                              path1.Data()),
+                              node->GetVolume(), node02->GetVolume(), &hmat1, node02->GetMatrix(), kTRUE);
                   }
                   next1.Skip();
                }
@@ -1649,10 +1775,9 @@ void TGeoChecker::CheckOverlaps(const TGeoVolume *vol, Double_t ovlp, Option_t *
                      next2.GetPath(path1);
                      hmat2 = node02->GetMatrix();
                      hmat2 *= *next2.GetCurrentMatrix();
-                     checker->MakeCheckOverlap(TString::Format("%s/%s overlapping %s/%s", vol->GetName(), path.Data(),
-                                                               vol->GetName(), path1.Data()),
-                                               node01->GetVolume(), node1->GetVolume(), node01->GetMatrix(), &hmat2,
-                                               kTRUE, ovlp);
+                     addCheck(TString::Format("%s/%s overlapping %s/%s", vol->GetName(), path.Data(), vol->GetName(),
+                                              path1.Data()),
+                              node01->GetVolume(), node1->GetVolume(), node01->GetMatrix(), &hmat2, kTRUE);
                      next2.Skip();
                   }
                }
@@ -1660,14 +1785,15 @@ void TGeoChecker::CheckOverlaps(const TGeoVolume *vol, Double_t ovlp, Option_t *
                // node1 also not assembly
                if (fSelectedNode && (fSelectedNode != node01) && (fSelectedNode != node02))
                   continue;
-               checker->MakeCheckOverlap(
+               addCheck(
                   TString::Format("%s/%s overlapping %s/%s", vol->GetName(), path.Data(), vol->GetName(), path1.Data()),
-                  node01->GetVolume(), node02->GetVolume(), node01->GetMatrix(), node02->GetMatrix(), kTRUE, ovlp);
+                  node01->GetVolume(), node02->GetVolume(), node01->GetMatrix(), node02->GetMatrix(), kTRUE);
             }
          }
       }
       node01->SetOverlaps(nullptr, 0);
    }
+   runChecks();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <TGeoShape.h>
+#include <TGeoTessellated.h>
+
+/**
+   Test the BVH-backed navigation interface of TGeoTessellated on a closed
+   tessellated cube, comparing against the analytic answers for a box
+   \author Andrei Gheata
+*/
+TEST(Geometry, TessellatedNavigation)
+{
+   using Vertex_t = TGeoTessellated::Vertex_t;
+
+   // Unit cube [-1, 1]^3 described by six quadrilateral facets. The closure
+   // check fixes any inconsistent winding relative to the first facet.
+   auto tsl = new TGeoTessellated("tsl_cube", 6);
+   tsl->AddFacet(Vertex_t(-1, -1, -1), Vertex_t(-1, 1, -1), Vertex_t(1, 1, -1), Vertex_t(1, -1, -1));
+   tsl->AddFacet(Vertex_t(-1, -1, 1), Vertex_t(1, -1, 1), Vertex_t(1, 1, 1), Vertex_t(-1, 1, 1));
+   tsl->AddFacet(Vertex_t(-1, -1, -1), Vertex_t(1, -1, -1), Vertex_t(1, -1, 1), Vertex_t(-1, -1, 1));
+   tsl->AddFacet(Vertex_t(-1, 1, -1), Vertex_t(-1, 1, 1), Vertex_t(1, 1, 1), Vertex_t(1, 1, -1));
+   tsl->AddFacet(Vertex_t(-1, -1, -1), Vertex_t(-1, -1, 1), Vertex_t(-1, 1, 1), Vertex_t(-1, 1, -1));
+   tsl->AddFacet(Vertex_t(1, -1, -1), Vertex_t(1, 1, -1), Vertex_t(1, 1, 1), Vertex_t(1, -1, 1));
+   EXPECT_TRUE(tsl->IsClosedBody());
+
+   // Containment
+   double inside[3] = {0.3, -0.2, 0.5};
+   double outside[3] = {1.5, 0., 0.};
+   EXPECT_TRUE(tsl->Contains(inside));
+   EXPECT_FALSE(tsl->Contains(outside));
+
+   // Distances along the x axis
+   double start[3] = {-2., 0.2, 0.3};
+   double dir[3] = {1., 0., 0.};
+   EXPECT_NEAR(tsl->DistFromOutside(start, dir), 1., 1.e-9);
+   double origin[3] = {0., 0., 0.};
+   EXPECT_NEAR(tsl->DistFromInside(origin, dir), 1., 1.e-9);
+
+   // A ray missing the cube
+   double miss[3] = {-2., 1.5, 0.};
+   EXPECT_GE(tsl->DistFromOutside(miss, dir), TGeoShape::Big());
+
+   // Safety from the center and from outside
+   EXPECT_NEAR(tsl->Safety(origin, kTRUE), 1., 1.e-9);
+   double above[3] = {0., 0., 3.};
+   EXPECT_NEAR(tsl->Safety(above, kFALSE), 2., 1.e-9);
+
+   // Normal on the +x face points along the track direction
+   double onface[3] = {1., 0.2, 0.2};
+   double norm[3];
+   tsl->ComputeNormal(onface, dir, norm);
+   EXPECT_NEAR(norm[0], 1., 1.e-9);
+   EXPECT_NEAR(norm[1], 0., 1.e-9);
+   EXPECT_NEAR(norm[2], 0., 1.e-9);
+
+   delete tsl;
+}
@@ -19,6 +19,7 @@
 class TCanvasImp;
 class TContextMenu;
 class TControlBar;
+class TTimer;
 
 class TCanvas : public TPad {
 
@@ -62,6 +63,9 @@ protected:
    Bool_t        fUseGL;           ///<! True when rendering is with GL
    Bool_t        fDrawn;           ///<! Set to True when the Draw method is called
    Bool_t        fUpdated;         ///<! Set to True when Update method was called
+   Bool_t        fDeferUpdate;     ///<! True when updates are coalesced through the event loop
+   Bool_t        fUpdatePending;   ///<! True when a deferred update is scheduled
+   TTimer       *fUpdateTimer;     ///<! Single-shot timer running the deferred updates
    //
    TVirtualPadPainter *fPainter;   ///<! Canvas (pad) painter.
 
@@ -165,6 +169,7 @@ public:
    virtual void      GetCanvasPar(Int_t &wtopx, Int_t &wtopy, UInt_t &ww, UInt_t &wh)
                      {wtopx=GetWindowTopX(); wtopy=fWindowTopY; ww=fWindowWidth; wh=fWindowHeight;}
    virtual void      HandleInput(EEventType button, Int_t x, Int_t y);
+   Bool_t            HandleTimer(TTimer *timer) override;
    Bool_t            HasMenuBar() const { return TestBit(kMenuBar); }
    virtual void      HighlightConnect(const char *slot);
    void              Iconify();
@@ -196,6 +201,8 @@ public:
    void              SaveSource(const char *filename="", Option_t *option="");
    void              SavePrimitive(std::ostream &out, Option_t *option = "") override;
    void              SetCursor(ECursor cursor) override;
+   void              SetDeferUpdate(Bool_t defer = kTRUE);
+   Bool_t            GetDeferUpdate() const { return fDeferUpdate; }
    void              SetDoubleBuffer(Int_t mode=1) override;
    void              SetName(const char *name="") override;
    void              SetFixedAspectRatio(Bool_t fixed = kTRUE) override;  // *TOGGLE*
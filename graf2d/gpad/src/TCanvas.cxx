@@ -44,12 +44,18 @@
 #include "TH1.h"
 #include "TGraph.h"
 #include "TMath.h"
+#include "TTimer.h"
 #include "TView.h"
 #include "strlcpy.h"
 #include "snprintf.h"
 
 #include "TVirtualMutex.h"
 
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 class TCanvasInit {
 public:
    TCanvasInit() { TApplication::NeedGraphicsLibs(); }
@@ -201,6 +207,9 @@ void TCanvas::Constructor()
    fCanvasImp = nullptr;
    fBatch     = kTRUE;
    fUpdating  = kFALSE;
+   fDeferUpdate   = kFALSE;
+   fUpdatePending = kFALSE;
+   fUpdateTimer   = nullptr;
 
    fContextMenu   = nullptr;
    fSelected      = nullptr;
@@ -565,6 +574,9 @@ void TCanvas::Init()
 
    fDISPLAY         = "$DISPLAY";
    fUpdating        = kFALSE;
+   fDeferUpdate     = kFALSE;
+   fUpdatePending   = kFALSE;
+   fUpdateTimer     = nullptr;
    fRetained        = kTRUE;
    fSelected        = nullptr;
    fClickSelected   = nullptr;
@@ -702,6 +714,10 @@ void TCanvas::Destructor()
 
    if (ROOT::Detail::HasBeenDeleted(this)) return;
 
+   if (fUpdateTimer) {
+      fUpdateTimer->TurnOff();
+      SafeDelete(fUpdateTimer);
+   }
    SafeDelete(fContextMenu);
    if (!gPad) return;
 
@@ -1970,6 +1986,49 @@ void TCanvas::SetCursor(ECursor cursor)
       gVirtualX->SetCursor(fCanvasID, cursor);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable deferred (coalesced) canvas updates.
+///
+/// When enabled, Update() does not repaint synchronously. Instead the first
+/// request schedules a single-shot timer and all further requests are
+/// absorbed until the timer fires from the event loop and performs one
+/// repaint. With expensive pads (e.g. graphs with millions of points) this
+/// keeps event handlers responsive: they pay for at most one repaint per
+/// event-loop iteration instead of one per Update() call.
+///
+/// The mode requires a running event loop (TApplication::Run() or periodic
+/// calls to TSystem::ProcessEvents()), otherwise deferred updates are never
+/// flushed. Disabling the mode flushes a pending update immediately.
+
+void TCanvas::SetDeferUpdate(Bool_t defer)
+{
+   fDeferUpdate = defer;
+   if (!defer && fUpdatePending) {
+      fUpdatePending = kFALSE;
+      if (fUpdateTimer)
+         fUpdateTimer->TurnOff();
+      Update();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Handle the single-shot timer scheduled by Update() in deferred mode.
+
+Bool_t TCanvas::HandleTimer(TTimer *timer)
+{
+   if (timer == fUpdateTimer) {
+      if (fUpdatePending) {
+         fUpdatePending = kFALSE;
+         Bool_t deferSave = fDeferUpdate;
+         fDeferUpdate = kFALSE;
+         Update();
+         fDeferUpdate = deferSave;
+      }
+      return kTRUE;
+   }
+   return TPad::HandleTimer(timer);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set Double Buffer On/Off.
 
@@ -2496,6 +2555,19 @@ void TCanvas::Update()
 
    if (fPixmapID == -1) return;
 
+   if (fDeferUpdate) {
+      // Coalesce repeated update requests into a single repaint executed from
+      // the event loop, so interactive handlers are not blocked by repeated
+      // expensive repaints. See SetDeferUpdate().
+      if (!fUpdatePending) {
+         fUpdatePending = kTRUE;
+         if (!fUpdateTimer)
+            fUpdateTimer = new TTimer(this, 0, kTRUE);
+         fUpdateTimer->Start(0, kTRUE);
+      }
+      return;
+   }
+
    static const union CastFromFuncToVoidPtr_t {
       CastFromFuncToVoidPtr_t(): fFuncPtr(ROOT_TCanvas_Update) {}
       void (*fFuncPtr)(void*);
@@ -2650,7 +2722,11 @@ void TCanvas::DeleteCanvasPainter()
 /// In this case images: "image000.png", "image001.png", "image002.png" will be created.
 /// If pattern is not provided - it will be automatically inserted before extension except PDF and ROOT files.
 /// In last case PDF or ROOT file will contain all pads.
-/// Parameter option only used when output into PDF/PS files
+/// Parameter option only used when output into PDF/PS files, with one exception:
+/// when producing one image file per pad in batch mode on POSIX systems, option may
+/// contain "workers=N" to rasterize the images in N parallel worker processes -
+/// the image rasterizer keeps per-process state, so independent pads can be
+/// rendered concurrently this way while a single process stays single-threaded.
 /// If TCanvas::SaveAll() called without arguments - all existing canvases will be stored in allcanvases.pdf file.
 
 Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, Option_t *option)
@@ -2758,7 +2834,7 @@ Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, O
       return !isError;
    }
 
-   for (unsigned n = 0; n < pads.size(); ++n) {
+   auto saveImage = [&](unsigned n) {
       TString fn = TString::Format(fname.Data(), (int) n);
       gSystem->ExpandPathName(fn);
       if (fn.IsNull()) {
@@ -2767,7 +2843,55 @@ Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, O
       }
 
       pads[n]->SaveAs(fn.Data());
+   };
+
+#ifndef _WIN32
+   // Optionally rasterize the independent images in parallel worker processes.
+   // Only done in batch mode, where image production is a pure in-memory
+   // rasterization without a connection to the graphics system, so a forked
+   // child can safely render its share of the pads.
+   Int_t nWorkers = 0;
+   if (option && *option) {
+      TString sopt = option;
+      sopt.ToLower();
+      auto widx = sopt.Index("workers=");
+      if (widx != kNPOS)
+         nWorkers = TString(sopt(widx + 8, sopt.Length() - widx - 8)).Atoi();
+   }
+   if (nWorkers > 1 && pads.size() > 1 && gROOT->IsBatch()) {
+      if (nWorkers > (Int_t) pads.size())
+         nWorkers = pads.size();
+
+      std::vector<pid_t> children;
+      for (Int_t w = 0; w < nWorkers; ++w) {
+         pid_t pid = fork();
+         if (pid == 0) {
+            for (unsigned n = w; n < pads.size(); n += nWorkers)
+               saveImage(n);
+            // skip any ROOT teardown in the worker
+            _exit(0);
+         } else if (pid > 0) {
+            children.emplace_back(pid);
+         } else {
+            ::Warning("TCanvas::SaveAll", "Failure to fork image worker - producing remaining images serially");
+            for (unsigned n = w; n < pads.size(); n += nWorkers)
+               saveImage(n);
+            break;
+         }
+      }
+
+      Bool_t allOk = kTRUE;
+      for (auto pid : children) {
+         int status = 0;
+         if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            allOk = kFALSE;
+      }
+      return allOk;
    }
+#endif
+
+   for (unsigned n = 0; n < pads.size(); ++n)
+      saveImage(n);
 
    return kTRUE;
 
@@ -88,6 +88,8 @@ protected:
 
    Int_t CheckLatexSyntax(TString &text) ;
 
+   static Int_t fgLayoutCacheSize; ///< Maximum number of entries in the layout cache (0 = disabled)
+
 public:
    // TLatex status bits
    enum {
@@ -114,6 +116,8 @@ public:
    void             SavePrimitive(std::ostream &out, Option_t *option = "") override;
    virtual void     SetIndiceSize(Double_t factorSize);
    virtual void     SetLimitIndiceSize(Int_t limitFactorSize);
+   static void      SetLayoutCacheSize(Int_t size = 1024);
+   static Int_t     GetLayoutCacheSize();
 
    ClassDefOverride(TLatex,2)  //The Latex-style text processor class
 };
@@ -14,6 +14,9 @@
 #include <ctime>
 #include <cmath>
 #include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -1273,18 +1276,50 @@ void TGaxis::PaintAxis(Double_t xmin, Double_t ymin, Double_t xmax, Double_t yma
    }
    if (!optionNoopt || optionInt ) {
 
+// The optimized divisions depend only on the axis range, the requested numbers
+// of divisions and the options, so they are kept in a small process wide cache
+// with least recently used eviction. In monitoring applications repainting pads
+// with unchanged ranges this skips the whole binning optimisation; a range or
+// attribute change simply produces a new key.
+
+      struct TickLayout_t {
+         std::string fKey;
+         Double_t fBinLow, fBinHigh, fBinWidth, fBinLow2, fBinHigh2, fBinWidth2, fBinLow3, fBinHigh3, fBinWidth3;
+         Int_t fNbins, fNb2, fNb3;
+      };
+      static std::list<TickLayout_t> tickLru; // most recently used first
+      static std::unordered_map<std::string, std::list<TickLayout_t>::iterator> tickIndex;
+      const Int_t tickCacheSize = 128;
+
+      char tickKeyBuf[160];
+      snprintf(tickKeyBuf, sizeof(tickKeyBuf), "%.17g|%.17g|%d|%d|%d|%d|%d|%d|%s",
+               wmin, wmax, n1a, n2a, n3a, optionInt, optionNoopt, fFunction ? 1 : 0, fChopt.Data());
+      std::string tickKey = tickKeyBuf;
+      Bool_t tickCached = kFALSE;
+      auto tickHit = tickIndex.find(tickKey);
+      if (tickHit != tickIndex.end()) {
+         tickLru.splice(tickLru.begin(), tickLru, tickHit->second);
+         const TickLayout_t &tl = *tickHit->second;
+         binLow  = tl.fBinLow;  binHigh  = tl.fBinHigh;  binWidth  = tl.fBinWidth;  nbins = tl.fNbins;
+         binLow2 = tl.fBinLow2; binHigh2 = tl.fBinHigh2; binWidth2 = tl.fBinWidth2; nb2   = tl.fNb2;
+         binLow3 = tl.fBinLow3; binHigh3 = tl.fBinHigh3; binWidth3 = tl.fBinWidth3; nb3   = tl.fNb3;
+         tickCached = kTRUE;
+      }
+
 // Primary divisions optimisation
 // When integer labelling is required, Optimize is invoked first
 // and only if the result is not an integer labelling, AdjustBinSize is invoked.
 
-      THLimitsFinder::Optimize(wmin,wmax,n1a,binLow,binHigh,nbins,binWidth,fChopt.Data());
-      if (optionInt) {
-         if (binLow != Double_t(int(binLow)) || binWidth != Double_t(int(binWidth))) {
-            AdjustBinSize(wmin,wmax,n1a,binLow,binHigh,nbins,binWidth);
+      if (!tickCached) {
+         THLimitsFinder::Optimize(wmin,wmax,n1a,binLow,binHigh,nbins,binWidth,fChopt.Data());
+         if (optionInt) {
+            if (binLow != Double_t(int(binLow)) || binWidth != Double_t(int(binWidth))) {
+               AdjustBinSize(wmin,wmax,n1a,binLow,binHigh,nbins,binWidth);
+            }
          }
+         if ((wmin-binLow)  > epsilon) { binLow  += binWidth; nbins--; }
+         if ((binHigh-wmax) > epsilon) { binHigh -= binWidth; nbins--; }
       }
-      if ((wmin-binLow)  > epsilon) { binLow  += binWidth; nbins--; }
-      if ((binHigh-wmax) > epsilon) { binHigh -= binWidth; nbins--; }
       if (xmax == xmin) {
          rtyw  = (ymax-ymin)/(wmax-wmin);
          xxmin = xmin;
@@ -1318,15 +1353,24 @@ void TGaxis::PaintAxis(Double_t xmin, Double_t ymin, Double_t xmax, Double_t yma
       }
 
 // Secondary divisions optimisation
-      nb2 = n2a;
-      if (!optionNoopt && n2a > 1 && binWidth > 0) {
-         THLimitsFinder::Optimize(wmin,wmin+binWidth,n2a,binLow2,binHigh2,nb2,binWidth2,fChopt.Data());
-      }
+      if (!tickCached) {
+         nb2 = n2a;
+         if (!optionNoopt && n2a > 1 && binWidth > 0) {
+            THLimitsFinder::Optimize(wmin,wmin+binWidth,n2a,binLow2,binHigh2,nb2,binWidth2,fChopt.Data());
+         }
 
 // Tertiary divisions optimisation
-      nb3 = n3a;
-      if (!optionNoopt && n3a > 1 && binWidth2 > 0) {
-         THLimitsFinder::Optimize(binLow2,binLow2+binWidth2,n3a,binLow3,binHigh3,nb3,binWidth3,fChopt.Data());
+         nb3 = n3a;
+         if (!optionNoopt && n3a > 1 && binWidth2 > 0) {
+            THLimitsFinder::Optimize(binLow2,binLow2+binWidth2,n3a,binLow3,binHigh3,nb3,binWidth3,fChopt.Data());
+         }
+         tickLru.push_front({tickKey, binLow, binHigh, binWidth, binLow2, binHigh2, binWidth2,
+                             binLow3, binHigh3, binWidth3, nbins, nb2, nb3});
+         tickIndex[tickKey] = tickLru.begin();
+         while ((Int_t)tickLru.size() > tickCacheSize) {
+            tickIndex.erase(tickLru.back().fKey);
+            tickLru.pop_back();
+         }
       }
       n1aold = n1a;
       nn1old = nn1;
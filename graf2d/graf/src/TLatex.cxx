@@ -10,6 +10,9 @@
  *************************************************************************/
 
 #include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
 #include "TROOT.h"
 #include "TLatex.h"
 #include "TMathText.h"
@@ -21,6 +24,8 @@
 
 const Double_t kPI = TMath::Pi();
 
+Int_t TLatex::fgLayoutCacheSize = 1024;
+
 ClassImp(TLatex);
 
 /** \class TLatex
@@ -2523,6 +2528,18 @@ Int_t TLatex::CheckLatexSyntax(TString &text)
 
 TLatex::TLatexFormSize TLatex::FirstParse(Double_t angle, Double_t size, const Char_t *text)
 {
+   // Cache of measured layouts, shared per process. The sizes computed by Anal1
+   // are in pixels, so the key includes the pad pixel scale in addition to the
+   // text and its attributes. Painting is done in the main thread only, like all
+   // TVirtualX based graphics, so no locking is needed.
+   struct LayoutCacheEntry_t {
+      std::string fKey;
+      TLatexFormSize fSize;
+      std::vector<TLatexFormSize> fTabs;
+   };
+   static std::list<LayoutCacheEntry_t> lruList; // most recently used first
+   static std::unordered_map<std::string, std::list<LayoutCacheEntry_t>::iterator> lruIndex;
+
    fTabSize.reserve(100); // ensure 100 entries before memory reallocation required
    fShow       = kFALSE;
    fOriginSize = size;
@@ -2539,7 +2556,37 @@ TLatex::TLatexFormSize TLatex::FirstParse(Double_t angle, Double_t size, const C
    Short_t halign = fTextAlign/10;
    Short_t valign = fTextAlign - 10*halign;
 
-   TLatexFormSize fs = Anal1(spec,text,strlen(text));
+   std::string key;
+   if (fgLayoutCacheSize > 0) {
+      Char_t attr[96];
+      snprintf(attr, sizeof(attr), "|%zu|%d|%g|%g|%g|%d|%g", strlen(text),
+               spec.fFont, spec.fSize, fFactorSize, fFactorPos, fLimitFactorSize, GetHeight());
+      key.reserve(strlen(text) + strlen(attr));
+      key  = text;
+      key += attr;
+   } else if (!lruList.empty()) {
+      lruList.clear();
+      lruIndex.clear();
+   }
+
+   TLatexFormSize fs;
+   auto hit = key.empty() ? lruIndex.end() : lruIndex.find(key);
+   if (hit != lruIndex.end()) {
+      lruList.splice(lruList.begin(), lruList, hit->second);
+      fs = hit->second->fSize;
+      fTabSize.insert(fTabSize.end(), hit->second->fTabs.begin(), hit->second->fTabs.end());
+   } else {
+      std::size_t tab0 = fTabSize.size();
+      fs = Anal1(spec,text,strlen(text));
+      if (!key.empty() && !fError) {
+         lruList.push_front({key, fs, std::vector<TLatexFormSize>(fTabSize.begin()+tab0, fTabSize.end())});
+         lruIndex[key] = lruList.begin();
+         while ((Int_t)lruList.size() > fgLayoutCacheSize) {
+            lruIndex.erase(lruList.back().fKey);
+            lruList.pop_back();
+         }
+      }
+   }
 
    SetTextSize(size);
    SetTextAngle(angle);
@@ -2741,3 +2788,29 @@ void TLatex::SetLimitIndiceSize(Int_t limitFactorSize)
 {
    fLimitFactorSize = limitFactorSize;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of entries in the formula layout cache.
+///
+/// Before a formula can be painted its size must be measured, which requires a
+/// full parse of the text. The result of that measurement pass only depends on
+/// the text, its attributes and the pad pixel size, so it is kept in a
+/// process wide cache with least recently used eviction. Repainting a canvas
+/// whose labels did not change then skips the measurement pass entirely.
+/// The painting pass itself is always executed.
+///
+/// The default cache size is 1024 formulae. Setting `size` to 0 disables the
+/// cache and drops its current content.
+
+void TLatex::SetLayoutCacheSize(Int_t size)
+{
+   fgLayoutCacheSize = size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum number of entries in the formula layout cache.
+
+Int_t TLatex::GetLayoutCacheSize()
+{
+   return fgLayoutCacheSize;
+}
@@ -99,6 +99,8 @@ public:
 
    int GetBinarySize() { return (SizeV() + SizeN() + SizeT()) * sizeof(float) + SizeI() * sizeof(int); }
 
+   ULong64_t CalcContentHash() const;
+
    int Write(char *msg, int maxlen);
 
    static void CalcTextureSize(int nel, int align, int &sx, int &sy);
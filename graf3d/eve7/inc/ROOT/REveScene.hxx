@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 namespace ROOT {
 namespace Experimental {
@@ -76,6 +77,10 @@ protected:
    std::vector<char> fOutputBinary;       ///<!
    Int_t fTotalBinarySize;                ///<!
 
+   // Content hashes of render data held by the subscribed clients, used to
+   // suppress retransmission of unchanged binary payloads (fSmartRefresh).
+   std::unordered_map<ElementId_t, ULong64_t> fRenderDataHashes; ///<!
+
    std::vector<SceneCommand> fCommands;   ///<!
 
    bool fMandatory{true};
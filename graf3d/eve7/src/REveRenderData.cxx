@@ -70,6 +70,35 @@ int REveRenderData::Write(char *msg, int maxlen)
    return off;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/// Calculate a hash of the render-data content, including the render function and the
+/// transformation matrix. Used by scenes to detect unchanged payloads so clients can
+/// reuse buffers they already hold instead of receiving them again.
+
+ULong64_t REveRenderData::CalcContentHash() const
+{
+   // FNV-1a over the byte images of the buffers.
+   ULong64_t hash = 0xcbf29ce484222325ULL;
+
+   auto mix = [&](const void *buf, std::size_t len) {
+      const unsigned char *b = static_cast<const unsigned char *>(buf);
+      for (std::size_t i = 0; i < len; ++i)
+         hash = (hash ^ b[i]) * 0x100000001b3ULL;
+   };
+
+   mix(fRnrFunc.data(), fRnrFunc.size());
+   if (!fMatrix.empty())
+      mix(&fMatrix[0], fMatrix.size() * sizeof(float));
+   if (!fVertexBuffer.empty())
+      mix(&fVertexBuffer[0], fVertexBuffer.size() * sizeof(float));
+   if (!fNormalBuffer.empty())
+      mix(&fNormalBuffer[0], fNormalBuffer.size() * sizeof(float));
+   if (!fIndexBuffer.empty())
+      mix(&fIndexBuffer[0], fIndexBuffer.size() * sizeof(int));
+
+   return hash;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /// Set transformation matrix
 
@@ -140,6 +140,7 @@ void REveScene::StreamElements()
 
    fElsWithBinaryData.clear();
    fTotalBinarySize = 0;
+   fRenderDataHashes.clear();
 
    nlohmann::json jarr = nlohmann::json::array();
 
@@ -175,6 +176,8 @@ void REveScene::StreamElements()
    {
       auto rd_size = e->fRenderData->Write(&fOutputBinary[off], fOutputBinary.size() - off);
       off += rd_size;
+      if (fSmartRefresh)
+         fRenderDataHashes[e->GetElementId()] = e->fRenderData->CalcContentHash();
    }
    assert(off == fTotalBinarySize);
 
@@ -245,8 +248,10 @@ void REveScene::StreamRepresentationChanges()
    jhdr["fSceneId"] = fElementId;
 
    jhdr["removedElements"] = nlohmann::json::array();
-   for (auto &re : fRemovedElements)
+   for (auto &re : fRemovedElements) {
       jhdr["removedElements"].push_back(re);
+      fRenderDataHashes.erase(re);
+   }
 
    jhdr["numRepresentationChanged"] = fChangedElements.size();
 
@@ -271,8 +276,26 @@ void REveScene::StreamRepresentationChanges()
          Int_t rd_size = el->WriteCoreJson(jobj, fTotalBinarySize);
          if (rd_size) {
             assert (rd_size % 4 == 0);
-            fTotalBinarySize += rd_size;
-            fElsWithBinaryData.push_back(el);
+
+            // Suppress retransmission of an unchanged binary payload -- the
+            // subscribers already hold it and are told to reuse their buffers.
+            Bool_t rd_cached = kFALSE;
+            if (fSmartRefresh) {
+               ULong64_t hash = el->fRenderData->CalcContentHash();
+               auto ins = fRenderDataHashes.insert({el->GetElementId(), hash});
+               if (!ins.second) {
+                  if (ins.first->second == hash && !(bits & kCBElementAdded))
+                     rd_cached = kTRUE;
+                  else
+                     ins.first->second = hash;
+               }
+            }
+            if (rd_cached) {
+               jobj["render_data"]["rd_cached"] = true;
+            } else {
+               fTotalBinarySize += rd_size;
+               fElsWithBinaryData.push_back(el);
+            }
          }
       }
       else
@@ -41,10 +41,17 @@ class RBrowserData {
 
    std::vector<std::pair<Browsable::RElementPath_t, std::shared_ptr<Browsable::RElement>>> fCache; ///<! already requested elements
 
+   /** Lightweight description of single child, used when full items cannot be kept in memory */
+   struct RChildInfo {
+      std::string name;      ///<! child name as provided by iterator
+      bool folder{false};    ///<! if child may have its own childs
+   };
+
    Browsable::RElementPath_t fLastPath;                  ///<! path to last used element
    std::shared_ptr<Browsable::RElement> fLastElement;    ///<! last element used in request
    std::vector<std::unique_ptr<Browsable::RItem>> fLastItems; ///<! created browser items - used in requests
-   bool fLastAllChilds{false};                           ///<! if all chlds were extracted
+   bool fLastAllChilds{false};                           ///<! if full items were created for all chlds
+   std::vector<RChildInfo> fLastIndex;                   ///<! names index of all childs, used when too many for full items
    std::vector<const Browsable::RItem *> fLastSortedItems;   ///<! sorted child items, used in requests
    std::string fLastSortMethod;                          ///<! last sort method
    bool fLastSortReverse{false};                         ///<! last request reverse order
@@ -54,6 +61,8 @@ class RBrowserData {
 
    bool ProcessBrowserRequest(const RBrowserRequest &request, RBrowserReply &reply);
 
+   bool ProcessIndexedRequest(const RBrowserRequest &request, RBrowserReply &reply);
+
 public:
    RBrowserData();
 
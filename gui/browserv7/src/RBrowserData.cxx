@@ -27,7 +27,9 @@
 #include "TEnv.h"
 
 #include <algorithm>
+#include <numeric>
 #include <regex>
+#include <unordered_map>
 
 using namespace ROOT;
 using namespace std::string_literals;
@@ -141,6 +143,7 @@ void RBrowserData::ResetLastRequestData(bool with_element)
    fLastSortedItems.clear();
    fLastSortMethod.clear();
    fLastItems.clear();
+   fLastIndex.clear();
    if (with_element) {
       fLastPath.clear();
       fLastElement.reset();
@@ -189,25 +192,44 @@ bool RBrowserData::ProcessBrowserRequest(const RBrowserRequest &request, RBrowse
       ResetLastRequestData(false);
    }
 
+   // maximal number of childs for which full items are created and kept in memory,
+   // more childs are handled via lightweight names index with items created only for visible part
+   static const int maxEagerItems = 10000;
+
    // when request childs, always try to make elements
-   if (fLastItems.empty()) {
+   if (fLastItems.empty() && fLastIndex.empty()) {
 
       auto iter = fLastElement->GetChildsIter();
 
       if (!iter) return false;
-      int id = 0;
       fLastAllChilds = true;
 
-      while (iter->Next() && fLastAllChilds) {
-         fLastItems.emplace_back(iter->CreateItem());
-         if (id++ > 10000)
+      while (iter->Next()) {
+         if (fLastAllChilds) {
+            fLastItems.emplace_back(iter->CreateItem());
+            if ((int) fLastItems.size() <= maxEagerItems)
+               continue;
+            // too many childs - convert into names index and continue without items creation
             fLastAllChilds = false;
+            fLastIndex.reserve(fLastItems.size() + 1024);
+            for (auto &item : fLastItems)
+               fLastIndex.emplace_back(RChildInfo{item->GetName(), item->IsFolder()});
+            fLastItems.clear();
+         } else {
+            auto iname = iter->GetItemName();
+            if (iname.empty())
+               iname = "<empty>";
+            fLastIndex.emplace_back(RChildInfo{iname, iter->CanItemHaveChilds()});
+         }
       }
 
       fLastSortedItems.clear();
       fLastSortMethod.clear();
    }
 
+   if (!fLastAllChilds)
+      return ProcessIndexedRequest(request, reply);
+
    // create sorted array
    if ((fLastSortedItems.size() != fLastItems.size()) ||
        (fLastSortMethod != request.sort) ||
@@ -263,6 +285,96 @@ bool RBrowserData::ProcessBrowserRequest(const RBrowserRequest &request, RBrowse
    return true;
 }
 
+/////////////////////////////////////////////////////////////////////////
+/// Process browser request using names index only
+/// Used when element has too many childs to create full items for all of them.
+/// Sorting, filtering and counting is performed on the index while full items
+/// are created only for the visible part of the childs - this keeps memory
+/// of the browsing session bounded and lets regex search cover all childs
+
+bool RBrowserData::ProcessIndexedRequest(const RBrowserRequest &request, RBrowserReply &reply)
+{
+   // order of childs, by default folders moved to the begin
+   std::vector<int> order(fLastIndex.size());
+   std::iota(order.begin(), order.end(), 0);
+
+   if (request.sort.empty()) {
+      std::stable_partition(order.begin(), order.end(), [this](int indx) { return fLastIndex[indx].folder; });
+   } else if (request.sort != "unsorted") {
+      // attributes like size or modification time are not available in the index,
+      // sort by name as generic RItem::Compare does
+      std::sort(order.begin(), order.end(), [this](int a, int b) {
+         if (fLastIndex[a].folder != fLastIndex[b].folder)
+            return fLastIndex[a].folder;
+         return fLastIndex[a].name < fLastIndex[b].name;
+      });
+   }
+
+   if (request.reverse)
+      std::reverse(order.begin(), order.end());
+
+   const std::regex expr(request.regex);
+
+   // detect hidden entries by name - same rule as in RSysFileItem::IsHidden
+   auto is_hidden = [](const std::string &n) {
+      if (n.empty() || (n[0] != '.'))
+         return false;
+      return (n != ".") && (n != "..");
+   };
+
+   // select childs which appear in requested window
+   std::vector<int> window;
+   int id = 0;
+   for (auto indx : order) {
+      auto &info = fLastIndex[indx];
+
+      if (!request.hidden && is_hidden(info.name))
+         continue;
+
+      if (!request.regex.empty() && !info.folder && !std::regex_match(info.name, expr))
+         continue;
+
+      if ((id >= request.first) && ((request.number == 0) || (id < request.first + request.number)))
+         window.emplace_back(indx);
+
+      id++;
+   }
+
+   // create items only for selected childs, scanning iterator once in original order
+   fLastItems.clear();
+   fLastSortedItems.clear();
+   fLastSortMethod.clear();
+
+   auto seq = window;
+   std::sort(seq.begin(), seq.end());
+
+   std::unordered_map<int, const Browsable::RItem *> created;
+
+   auto iter = fLastElement->GetChildsIter();
+   if (!iter) return false;
+
+   int pos = -1;
+   size_t k = 0;
+   while ((k < seq.size()) && iter->Next()) {
+      if (++pos < seq[k])
+         continue;
+      fLastItems.emplace_back(iter->CreateItem());
+      created[pos] = fLastItems.back().get();
+      k++;
+   }
+
+   for (auto indx : window) {
+      auto entry = created.find(indx);
+      if (entry != created.end())
+         reply.nodes.emplace_back(entry->second);
+   }
+
+   reply.first = request.first;
+   reply.nchilds = id; // total number of childs
+
+   return true;
+}
+
 /////////////////////////////////////////////////////////////////////////
 /// Process browser request, returns string with JSON of RBrowserReply data
 
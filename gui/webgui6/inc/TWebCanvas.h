@@ -24,6 +24,7 @@
 #include <queue>
 #include <functional>
 #include <map>
+#include <chrono>
 
 class TPad;
 class TPadWebSnapshot;
@@ -60,6 +61,7 @@ protected:
       Long64_t fSendVersion{0};        ///<! canvas version send to the client
       Long64_t fDrawVersion{0};        ///<! canvas version drawn (confirmed) by client
       UInt_t fLastSendHash{0};         ///<! hash of last send draw message, avoid looping
+      std::chrono::steady_clock::time_point fNextSendTm; ///<! earliest time when next snapshot can be send, used to limit update rate
       std::map<std::string, std::string> fCtrl; ///<! different ctrl parameters which can be send at once
       std::queue<std::string> fSend;   ///<! send queue, processed after sending draw data
 
@@ -97,6 +99,7 @@ protected:
    Int_t fPaletteDelivery{1};      ///<! colors palette delivery 0:never, 1:once, 2:always, 3:per subpad
    Int_t fPrimitivesMerge{100};    ///<! number of PS primitives, which will be merged together
    Int_t fJsonComp{0};             ///<! compression factor for messages send to the client
+   Int_t fMaxUpdateRate{0};        ///<! maximal rate of snapshots send to the client (per second), 0 - no limit
    Bool_t fCanCreateObjects{kTRUE}; ///<! indicates if canvas allowed to create extra objects for interactive painting
    Bool_t fLongerPolling{kFALSE};  ///<! when true, make longer polling in blocking operations
    Bool_t fProcessingData{kFALSE}; ///<! flag used to prevent blocking methods when process data is invoked
@@ -256,6 +259,9 @@ public:
    void SetAsyncMode(Bool_t on = kTRUE) { fAsyncMode = on; }
    Bool_t IsAsyncMode() const { return fAsyncMode; }
 
+   void SetMaxUpdateRate(Int_t rate) { fMaxUpdateRate = rate > 0 ? rate : 0; }
+   Int_t GetMaxUpdateRate() const { return fMaxUpdateRate; }
+
    Bool_t IsFixedSize() const { return fFixedSize; }
 
    static void SetCustomScripts(const std::string &src);
@@ -112,6 +112,7 @@ Following settings parameters can be useful for TWebCanvas:
      WebGui.StyleDelivery:    1     provide gStyle object to JSROOT client (default - 1)
      WebGui.PaletteDelivery:  1     provide color palette to JSROOT client (default - 1)
      WebGui.TF1UseSave:       1     used saved values for function drawing: 0 - off, 1 - if client fail to evaluate function, 2 - always (default - 1)
+     WebGui.CanvasMaxUpdateRate: 0  maximal rate of canvas snapshots send to the client (per second), bursts of modifications are coalesced into single update, 0 - no limit (default - 0)
 
 TWebCanvas is used by default in interactive ROOT session. To use web-based canvas in batch mode for image
 generation, one should explicitly specify `--web` option when starting ROOT:
@@ -202,6 +203,7 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fTF1UseSave = gEnv->GetValue("WebGui.TF1UseSave", (Int_t) 1);
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   SetMaxUpdateRate(gEnv->GetValue("WebGui.CanvasMaxUpdateRate", 0));
 
    fWebConn.emplace_back(0); // add special connection which only used to perform updates
 
@@ -1279,6 +1281,13 @@ Bool_t TWebCanvas::CheckDataToSend(unsigned connid)
             conn.fSend.pop();
          } else if ((conn.fCheckedVersion < fCanvVersion) && (conn.fSendVersion == conn.fDrawVersion)) {
 
+            if (!conn.is_batch() && (fMaxUpdateRate > 0)) {
+               auto now = std::chrono::steady_clock::now();
+               if (now < conn.fNextSendTm)
+                  break; // too early, timer will try again - burst of modifications coalesced into single snapshot
+               conn.fNextSendTm = now + std::chrono::milliseconds(1000 / fMaxUpdateRate);
+            }
+
             buf = "SNAP6:"s + std::to_string(fCanvVersion) + ":"s;
 
             TCanvasWebSnapshot holder(IsReadOnly(), true, false); // readonly, set ids, batchmode
@@ -1912,6 +1921,12 @@ Bool_t TWebCanvas::ProcessData(unsigned connid, const std::string &arg)
       // trigger reload of canvas data
       fWebConn[indx].reset();
 
+   } else if (arg.compare(0, 10, "FRAMERATE:") == 0) {
+
+      // client requests maximal rate of canvas updates (per second), 0 - no limit
+      if (is_main_connection)
+         SetMaxUpdateRate(std::stoi(cdata + 10));
+
    } else if (arg.compare(0, 5, "SAVE:") == 0) {
 
       // save image produced by the client side - like png or svg
@@ -60,6 +60,8 @@
 #pragma link C++ class TH1D+;
 #pragma link C++ class TH1F+;
 #pragma link C++ class TH1S+;
+#pragma link C++ class TH1US+;
+#pragma link C++ class TH1UI+;
 #pragma link C++ class TH1I+;
 #pragma link C++ class TH1K+;
 #pragma link C++ class TH1L+;
@@ -84,6 +86,7 @@
 #pragma link C++ class TH3I+;
 #pragma link C++ class TH3L+;
 #pragma link C++ class THLimitsFinder+;
+#pragma link C++ class THShardedFill;
 #pragma link C++ class THnBase+;
 #pragma link C++ class THnIter+;
 #pragma link C++ class TNDArray+;
@@ -143,6 +146,7 @@
 #pragma link C++ class THnT<ULong_t>+;
 #pragma link C++ class THnT<UInt_t>+;
 #pragma link C++ class THnT<UShort_t>+;
+#pragma link C++ class THnHash+;
 #pragma link C++ class THnSparse+;
 #pragma link C++ class THnSparseT<TArrayD>+;
 #pragma link C++ class THnSparseT<TArrayF>+;
@@ -228,6 +232,20 @@
 #pragma link C++ function operator*(TH1S&, TH1S&);
 #pragma link C++ function operator/(TH1S&, TH1S&);
 
+#pragma link C++ function operator*(Float_t,TH1US&);
+#pragma link C++ function operator*(TH1US&, Float_t);
+#pragma link C++ function operator+(TH1US&, TH1US&);
+#pragma link C++ function operator-(TH1US&, TH1US&);
+#pragma link C++ function operator*(TH1US&, TH1US&);
+#pragma link C++ function operator/(TH1US&, TH1US&);
+
+#pragma link C++ function operator*(Float_t,TH1UI&);
+#pragma link C++ function operator*(TH1UI&, Float_t);
+#pragma link C++ function operator+(TH1UI&, TH1UI&);
+#pragma link C++ function operator-(TH1UI&, TH1UI&);
+#pragma link C++ function operator*(TH1UI&, TH1UI&);
+#pragma link C++ function operator/(TH1UI&, TH1UI&);
+
 #pragma link C++ function operator*(Float_t,TH1I&);
 #pragma link C++ function operator*(TH1I&, Float_t);
 #pragma link C++ function operator+(TH1I&, TH1I&);
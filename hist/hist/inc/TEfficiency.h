@@ -103,6 +103,8 @@ public:
       void          Draw(Option_t* opt = "") override;
       void  ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
       void          Fill(Bool_t bPassed,Double_t x,Double_t y=0,Double_t z=0);
+      void          FillN(Int_t ntimes,const Bool_t *bPassed,const Double_t *x,const Double_t *y=nullptr,
+                          const Double_t *z=nullptr,const Double_t *w=nullptr);
       void          FillWeighted(Bool_t bPassed,Double_t weight,Double_t x,Double_t y=0,Double_t z=0);
       Int_t         FindFixBin(Double_t x,Double_t y=0,Double_t z=0) const;
       TFitResultPtr Fit(TF1* f1,Option_t* opt="");
@@ -117,6 +119,9 @@ public:
       Double_t      GetEfficiency(Int_t bin) const;
       Double_t      GetEfficiencyErrorLow(Int_t bin) const;
       Double_t      GetEfficiencyErrorUp(Int_t bin) const;
+      void          GetEfficiencyWithError(Int_t bin,Double_t &eff,Double_t &effErrLow,Double_t &effErrUp) const;
+      void          GetEfficiencyArrays(std::vector<Double_t> &eff,std::vector<Double_t> &effErrLow,
+                                        std::vector<Double_t> &effErrUp) const;
       Int_t         GetGlobalBin(Int_t binx,Int_t biny=0,Int_t binz=0) const;
       TGraphAsymmErrors*   GetPaintedGraph() const { return fPaintGraph; }
       TGraph2DAsymmErrors*   GetPaintedGraph2D() const { return fPaintGraph2D; }
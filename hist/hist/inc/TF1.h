@@ -228,6 +228,8 @@ protected:
    std::vector<Double_t>    fAlpha;                 ///<! Array alpha. for each bin in x the deconvolution r of fIntegral
    std::vector<Double_t>    fBeta;                  ///<! Array beta.  is approximated by x = alpha +beta*r *gamma*r**2
    std::vector<Double_t>    fGamma;                 ///<! Array gamma.
+   std::vector<Double_t>    fGridX;                 ///<! X values of the cached grid evaluations (see EvalGrid)
+   std::vector<std::vector<Double_t>> fGridCache;   ///<! Cached grid results: fNpar parameter values followed by the function values
    TObject     *fParent{nullptr};                   ///<! Parent object hooking this function (if one)
    TH1         *fHistogram{nullptr};                ///<! Pointer to histogram used for visualisation
    std::unique_ptr<TMethodCall> fMethodCall;        ///<! Pointer to MethodCall in case of interpreted function
@@ -409,6 +411,7 @@ public:
    //template <class T> T Eval(T x, T y = 0, T z = 0, T t = 0) const;
    virtual Double_t EvalPar(const Double_t *x, const Double_t *params = nullptr);
    template <class T> T EvalPar(const T *x, const Double_t *params = nullptr);
+   virtual void     EvalGrid(const Double_t *x, Double_t *y, Int_t n, const Double_t *params = nullptr);
    virtual Double_t operator()(Double_t x, Double_t y = 0, Double_t z = 0, Double_t t = 0) const;
    template <class T> T operator()(const T *x, const Double_t *params = nullptr);
    Double_t EvalUncertainty(Double_t x, const TMatrixDSym *covMatrix = nullptr) const;
@@ -52,6 +52,11 @@ public:
    Double_t  ComputeZ(Double_t x, Double_t y) { return fDelaunay.Interpolate(x,y); }
    void      FindAllTriangles() { fDelaunay.FindAllTriangles(); }
 
+   /// write the triangulation to a binary cache file (see ROOT::Math::Delaunay2D::SaveTriangulation)
+   Bool_t    SaveTriangulation(const char *fileName) { return fDelaunay.SaveTriangulation(fileName); }
+   /// restore a triangulation written by SaveTriangulation for the same graph points
+   Bool_t    LoadTriangulation(const char *fileName) { return fDelaunay.LoadTriangulation(fileName); }
+
    TGraph2D *GetGraph2D() const {return fGraph2D;}
    Double_t  GetMarginBinsContent() const {return fDelaunay.ZOuterValue();}
    Int_t     GetNdt() const {return fDelaunay.NumberOfTriangles(); }
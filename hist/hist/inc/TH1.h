@@ -49,6 +49,7 @@
 #include <type_traits>
 #include <array>
 #include <numeric>
+#include <vector>
 
 class TF1;
 class TH1D;
@@ -144,6 +145,7 @@ public:
    };
 
    friend class TH1Merger;
+   friend class THShardedFill;
 
 protected:
     Int_t         fNcells;          ///<  Number of bins(1D), cells (2D) +U/Overflows
@@ -437,6 +439,7 @@ public:
    static  void     AddDirectory(Bool_t add=kTRUE);
    static  Bool_t   AddDirectoryStatus();
            void     Browse(TBrowser *b) override;
+   static  void     BulkSetDirectory(const std::vector<TH1 *> &hists, TDirectory *dir);
    virtual Bool_t   CanExtendAllAxes() const;
    virtual Double_t Chi2Test(const TH1* h2, Option_t *option = "UU", Double_t *res = nullptr) const;
    virtual Double_t Chi2TestX(const TH1* h2, Double_t &chi2, Int_t &ndf, Int_t &igood,Option_t *option = "UU",  Double_t *res = nullptr) const;
@@ -793,6 +796,49 @@ TH1S operator/(const TH1S &h1, const TH1S &h2);
 
 //________________________________________________________________________
 
+class TH1US : public TH1, public TArrayS {
+
+public:
+   TH1US();
+   TH1US(const char *name,const char *title,Int_t nbinsx,Double_t xlow,Double_t xup);
+   TH1US(const char *name,const char *title,Int_t nbinsx,const Float_t  *xbins);
+   TH1US(const char *name,const char *title,Int_t nbinsx,const Double_t *xbins);
+   TH1US(const TH1US &h1us);
+   TH1US& operator=(const TH1US &h1);
+   ~TH1US() override;
+
+   void     AddBinContent(Int_t bin) override;
+   void     AddBinContent(Int_t bin, Double_t w) override;
+   void     Copy(TObject &hnew) const override;
+   void     Reset(Option_t *option="") override;
+   void     SetBinsLength(Int_t n=-1) override;
+
+   ClassDefOverride(TH1US,1)  //1-Dim histograms (one unsigned short per channel)
+
+   friend  TH1US    operator*(Double_t c1, const TH1US &h1);
+   friend  TH1US    operator*(const TH1US &h1, Double_t c1);
+   friend  TH1US    operator+(const TH1US &h1, const TH1US &h2);
+   friend  TH1US    operator-(const TH1US &h1, const TH1US &h2);
+   friend  TH1US    operator*(const TH1US &h1, const TH1US &h2);
+   friend  TH1US    operator/(const TH1US &h1, const TH1US &h2);
+
+protected:
+   // The shorts of the TArrayS hold the bit patterns of unsigned counts, so
+   // the existing TArrayS streamer round-trips them unchanged.
+   Double_t RetrieveBinContent(Int_t bin) const override { return Double_t (UShort_t(fArray[bin])); }
+   void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = Short_t (UShort_t(content)); }
+};
+
+TH1US operator*(Double_t c1, const TH1US &h1);
+inline
+TH1US operator*(const TH1US &h1, Double_t c1) {return operator*(c1,h1);}
+TH1US operator+(const TH1US &h1, const TH1US &h2);
+TH1US operator-(const TH1US &h1, const TH1US &h2);
+TH1US operator*(const TH1US &h1, const TH1US &h2);
+TH1US operator/(const TH1US &h1, const TH1US &h2);
+
+//________________________________________________________________________
+
 class TH1I: public TH1, public TArrayI {
 
 public:
@@ -834,6 +880,49 @@ TH1I operator/(const TH1I &h1, const TH1I &h2);
 
 //________________________________________________________________________
 
+class TH1UI: public TH1, public TArrayI {
+
+public:
+   TH1UI();
+   TH1UI(const char *name,const char *title,Int_t nbinsx,Double_t xlow,Double_t xup);
+   TH1UI(const char *name,const char *title,Int_t nbinsx,const Float_t  *xbins);
+   TH1UI(const char *name,const char *title,Int_t nbinsx,const Double_t *xbins);
+   TH1UI(const TH1UI &h1ui);
+   TH1UI& operator=(const TH1UI &h1);
+   ~TH1UI() override;
+
+   void     AddBinContent(Int_t bin) override;
+   void     AddBinContent(Int_t bin, Double_t w) override;
+   void     Copy(TObject &hnew) const override;
+   void     Reset(Option_t *option="") override;
+   void     SetBinsLength(Int_t n=-1) override;
+
+   ClassDefOverride(TH1UI,1)  //1-Dim histograms (one unsigned 32 bit integer per channel)
+
+   friend  TH1UI    operator*(Double_t c1, const TH1UI &h1);
+   friend  TH1UI    operator*(const TH1UI &h1, Double_t c1);
+   friend  TH1UI    operator+(const TH1UI &h1, const TH1UI &h2);
+   friend  TH1UI    operator-(const TH1UI &h1, const TH1UI &h2);
+   friend  TH1UI    operator*(const TH1UI &h1, const TH1UI &h2);
+   friend  TH1UI    operator/(const TH1UI &h1, const TH1UI &h2);
+
+protected:
+   // The ints of the TArrayI hold the bit patterns of unsigned counts, so
+   // the existing TArrayI streamer round-trips them unchanged.
+   Double_t RetrieveBinContent(Int_t bin) const override { return Double_t (UInt_t(fArray[bin])); }
+   void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = Int_t (UInt_t(content)); }
+};
+
+TH1UI operator*(Double_t c1, const TH1UI &h1);
+inline
+TH1UI operator*(const TH1UI &h1, Double_t c1) {return operator*(c1,h1);}
+TH1UI operator+(const TH1UI &h1, const TH1UI &h2);
+TH1UI operator-(const TH1UI &h1, const TH1UI &h2);
+TH1UI operator*(const TH1UI &h1, const TH1UI &h2);
+TH1UI operator/(const TH1UI &h1, const TH1UI &h2);
+
+//________________________________________________________________________
+
 class TH1L: public TH1, public TArrayL64 {
 
 public:
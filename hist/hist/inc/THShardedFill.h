@@ -0,0 +1,90 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THShardedFill
+#define ROOT_THShardedFill
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// THShardedFill                                                        //
+//                                                                      //
+// Concurrent filling of a single, shared histogram through per-thread  //
+// shards of (bin, weight) pairs which are scattered into the bin       //
+// contents in batches under striped locks. Unlike per-thread histogram //
+// copies (ROOT::TThreadedObject) the memory cost per thread is one     //
+// small fill buffer, independent of the number of bins.                //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class TH1;
+
+class THShardedFill {
+
+public:
+   class TShard {
+      friend class THShardedFill;
+
+   private:
+      THShardedFill *fParent;                         ///< filler this shard belongs to
+      std::vector<std::pair<Int_t, Double_t>> fBatch; ///< pending (global bin, weight) pairs
+      Double_t fStats[7];                             ///< pending sums: w, w2, wx, wx2, wy, wy2, wxy
+      Long64_t fNfills = 0;                           ///< pending number of fills
+      Bool_t fHasWeights = kFALSE;                    ///< a pending weight differs from one
+
+      TShard(THShardedFill *parent);
+
+   public:
+      void Fill(Double_t x, Double_t w = 1.);
+      void Fill2D(Double_t x, Double_t y, Double_t w = 1.);
+      void Flush();
+   };
+
+private:
+   TH1 &fHist;                                             ///< histogram being filled
+   Int_t fNcells;                                          ///< number of cells of fHist
+   UInt_t fNstripes;                                       ///< number of bin-range lock stripes
+   UInt_t fBufferSize;                                     ///< shard capacity before an automatic flush
+   Bool_t fStatOverflows;                                  ///< whether over/underflow enter the statistics
+   Bool_t fValid = kTRUE;                                  ///< false if the histogram is unsupported; fills are rejected
+   std::unique_ptr<std::mutex[]> fStripes;                 ///< one lock per contiguous bin range
+   std::mutex fStatsMutex;                                 ///< protects statistics, entries and Sumw2 activation
+   std::mutex fShardsMutex;                                ///< protects the shard registry
+   std::map<std::thread::id, std::unique_ptr<TShard>> fShards; ///< one shard per filling thread
+
+   UInt_t Stripe(Int_t bin) const { return (UInt_t)((ULong64_t)bin * fNstripes / fNcells); }
+   void ScatterBatch(TShard &shard);
+
+public:
+   THShardedFill(TH1 &hist, UInt_t nstripes = 8, UInt_t buffersize = 2048);
+   ~THShardedFill();
+
+   THShardedFill(const THShardedFill &) = delete;
+   THShardedFill &operator=(const THShardedFill &) = delete;
+
+   TShard *GetShard();
+   void Fill(Double_t x, Double_t w = 1.) { GetShard()->Fill(x, w); }
+   void Fill2D(Double_t x, Double_t y, Double_t w = 1.) { GetShard()->Fill2D(x, y, w); }
+   void Flush();
+   TH1 &GetHistogram() { return fHist; }
+   Bool_t IsValid() const { return fValid; }
+
+   ClassDefNV(THShardedFill, 0) // Sharded concurrent histogram filling
+};
+
+#endif
@@ -0,0 +1,114 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THnHash
+#define ROOT_THnHash
+
+/*************************************************************************
+
+ THnHash: sparse n-dimensional histogram with flat open-addressing
+ storage, a drop-in alternative to THnSparse for histograms with many
+ filled bins.
+
+*************************************************************************/
+
+#include "THnBase.h"
+
+#include <vector>
+
+class THnHash: public THnBase {
+ private:
+   Int_t      fChunkSize = 1024 * 16;            ///< Number of entries for each content chunk
+   Long64_t   fFilledBins = 0;                   ///< Number of filled bins
+   std::vector<Int_t> fShift;                    ///< Bit offset of each dimension inside the packed key
+   std::vector<ULong64_t> fKeys;                 ///< Packed coordinates of each filled bin, in fill order
+   std::vector<std::vector<Double_t>> fContent;  ///< Chunked bin content, indexed by bin / fChunkSize
+   std::vector<std::vector<Double_t>> fSumw2;    ///< Chunked sum of squared weights; empty if not calculated
+   std::vector<Long64_t> fTable;                 ///<! Open-addressing table holding bin index + 1; 0 is empty
+   ULong64_t  fTableMask = 0;                    ///<! Size of fTable minus one (power of two capacity)
+   std::vector<Int_t> fCoordBuf;                 ///<! Scratch coordinates for the GetBin() overloads
+
+   THnHash(const THnHash&) = delete;
+   THnHash& operator=(const THnHash&) = delete;
+
+ protected:
+   ULong64_t PackCoord(const Int_t* coord) const;
+   void UnpackKey(ULong64_t key, Int_t* coord) const;
+   Long64_t GetBinIndexForKey(ULong64_t key, Bool_t allocate);
+   void GrowTable(ULong64_t newSize);
+   void FillTable();
+
+   /// Increment the bin content of "bin" by "w".
+   void FillBin(Long64_t bin, Double_t w) override {
+      if (bin < 0) return;
+      fContent[bin / fChunkSize][bin % fChunkSize] += w;
+      if (!fSumw2.empty())
+         fSumw2[bin / fChunkSize][bin % fChunkSize] += w * w;
+      FillBinBase(w);
+   }
+   void InitStorage(Int_t* nbins, Int_t chunkSize) override;
+   void Reserve(Long64_t nbins) override;
+
+ public:
+   THnHash() {}
+   THnHash(const char* name, const char* title, Int_t dim,
+           const Int_t* nbins, const Double_t* xmin = nullptr, const Double_t* xmax = nullptr,
+           Int_t chunksize = 1024 * 16);
+   THnHash(const char* name, const char* title,
+           const std::vector<TAxis>& axes,
+           Int_t chunksize = 1024 * 16);
+
+   ~THnHash() override;
+
+   Int_t GetChunkSize() const { return fChunkSize; }
+
+   ROOT::Internal::THnBaseBinIter* CreateIter(Bool_t respectAxisRange) const override;
+
+   Long64_t GetNbins() const override { return fFilledBins; }
+   void SetFilledBins(Long64_t nbins) override { fFilledBins = nbins; }
+
+   Long64_t GetBin(const Int_t* idx) const override { return const_cast<THnHash*>(this)->GetBin(idx, kFALSE); }
+   Long64_t GetBin(const Double_t* x) const override { return const_cast<THnHash*>(this)->GetBin(x, kFALSE); }
+   Long64_t GetBin(const char* name[]) const override { return const_cast<THnHash*>(this)->GetBin(name, kFALSE); }
+   Long64_t GetBin(const Int_t* idx, Bool_t allocate = kTRUE) override;
+   Long64_t GetBin(const Double_t* x, Bool_t allocate = kTRUE) override;
+   Long64_t GetBin(const char* name[], Bool_t allocate = kTRUE) override;
+
+   /// Forwards to THnBase::SetBinContent().
+   /// Non-virtual, CINT-compatible replacement of a using declaration.
+   void SetBinContent(const Int_t* idx, Double_t v) {
+      THnBase::SetBinContent(idx, v);
+   }
+   void SetBinContent(Long64_t bin, Double_t v) override;
+   void SetBinError2(Long64_t bin, Double_t e2) override;
+
+   /// Forwards to THnBase::AddBinContent().
+   /// Non-virtual, CINT-compatible replacement of a using declaration.
+   void AddBinContent(const Int_t* idx, Double_t v = 1.) {
+      THnBase::AddBinContent(idx, v);
+   }
+   void AddBinContent(Long64_t bin, Double_t v = 1.) override;
+   void AddBinError2(Long64_t bin, Double_t e2) override;
+
+   /// Forwards to THnBase::GetBinContent() overload.
+   /// Non-virtual, CINT-compatible replacement of a using declaration.
+   Double_t GetBinContent(const Int_t *idx) const {
+      return THnBase::GetBinContent(idx);
+   }
+   Double_t GetBinContent(Long64_t bin, Int_t* idx = nullptr) const override;
+   Double_t GetBinError2(Long64_t linidx) const override;
+
+   void Reset(Option_t* option = "") override;
+   void Sumw2() override;
+
+   ClassDefOverride(THnHash, 1); // Sparse n-dimensional histogram with open-addressing hash storage
+};
+
+#endif //  ROOT_THnHash
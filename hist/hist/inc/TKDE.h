@@ -123,6 +123,7 @@ public:
    void SetUseBinsNEvents(UInt_t nEvents);
    void SetTuneFactor(Double_t rho);
    void SetRange(Double_t xMin, Double_t xMax); ///< By default computed from the data
+   void SetEvalTolerance(Double_t tol);         ///< Enable approximate (truncated) kernel sums with the given relative tolerance. A value of zero (the default) evaluates the full sums
 
    void Draw(const Option_t* option = "") override;
 
@@ -130,6 +131,7 @@ public:
    Double_t operator()(const Double_t* x, const Double_t* p = nullptr) const;  // Needed for creating TF1
 
    Double_t GetValue(Double_t x) const { return (*this)(x); }
+   std::vector<Double_t> GetValues(UInt_t npoints, Double_t xMin = 1.0, Double_t xMax = 0.0) const;
    Double_t GetError(Double_t x) const;
 
    Double_t GetBias(Double_t x) const;
@@ -164,6 +166,7 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      Double_t fMaxWeight;            ///< Largest kernel weight, defines the support window for truncated evaluation
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
@@ -222,6 +225,8 @@ private:
 
    Double_t fWeightSize;               ///< Caches the weight size
 
+   Double_t fEvalTolerance;            ///< Relative tolerance for truncating the kernel sums (0 = exact evaluation)
+
    std::vector<Double_t> fCanonicalBandwidths;
    std::vector<Double_t> fKernelSigmas2;
 
@@ -298,7 +303,7 @@ private:
    TF1* GetPDFUpperConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
    TF1* GetPDFLowerConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
 
-   ClassDefOverride(TKDE, 3) // One dimensional semi-parametric Kernel Density Estimation
+   ClassDefOverride(TKDE, 4) // One dimensional semi-parametric Kernel Density Estimation
 
 };
 
@@ -26,6 +26,9 @@
 #include "TError.h"
 #include "Math/BrentMinimizer1D.h"
 #include "Math/WrappedFunction.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 //custom headers
 #include "TEfficiency.h"
@@ -1741,9 +1744,8 @@ void TEfficiency::FillGraph2D(TGraph2DAsymmErrors * graph, Option_t * opt) const
          double yup = fTotalHistogram->GetYaxis()->GetBinWidth(j+1) - ylow;
 
          int ibin = GetGlobalBin(i+1,j+1);
-         double z = GetEfficiency(ibin);
-         double zlow = GetEfficiencyErrorLow(ibin);
-         double zup = GetEfficiencyErrorUp(ibin);
+         double z, zlow, zup;
+         GetEfficiencyWithError(ibin,z,zlow,zup);
          // in the case the graph already existed and extra points have been added
          if (ipoint >= graph->GetN() ) {
             graph->SetPoint(ipoint,x,y,z);
@@ -1834,11 +1836,9 @@ void TEfficiency::FillGraph(TGraphAsymmErrors * graph, Option_t * opt) const
    for (Int_t i = 0; i < npoints; ++i) {
       if (!plot0Bins && fTotalHistogram->GetBinContent(i+1) == 0 )    continue;
       x = fTotalHistogram->GetBinCenter(i+1);
-      y = GetEfficiency(i+1);
       xlow = fTotalHistogram->GetBinCenter(i+1) - fTotalHistogram->GetBinLowEdge(i+1);
       xup = fTotalHistogram->GetBinWidth(i+1) - xlow;
-      ylow = GetEfficiencyErrorLow(i+1);
-      yup = GetEfficiencyErrorUp(i+1);
+      GetEfficiencyWithError(i+1,y,ylow,yup);
       // in the case the graph already existed and extra points have been added
       if (j >= graph->GetN() ) {
          graph->SetPoint(j,x,y);
@@ -2482,6 +2482,78 @@ void TEfficiency::Fill(Bool_t bPassed,Double_t x,Double_t y,Double_t z)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// This function is used for filling the two histograms with a whole batch of
+/// events at once.
+///
+/// \param[in] ntimes number of events in the arrays
+/// \param[in] bPassed array of flags whether the event passed the selection
+/// \param[in] x array of x-values
+/// \param[in] y array of y-values (use default=nullptr for 1-D efficiencies)
+/// \param[in] z array of z-values (use default=nullptr for 2-D or 1-D efficiencies)
+/// \param[in] w array of event weights (use default=nullptr for unweighted events)
+///
+/// Filling a batch is equivalent to calling Fill() (or FillWeighted() if `w` is
+/// given) once per event, but passes the values on to TH1::FillN / TH2::FillN
+/// where available. Like FillWeighted(), this function will call
+/// SetUseWeightedEvents() if weights are given and it was not called by the
+/// user before.
+
+void TEfficiency::FillN(Int_t ntimes,const Bool_t *bPassed,const Double_t *x,const Double_t *y,
+                        const Double_t *z,const Double_t *w)
+{
+   const Int_t dim = GetDimension();
+   if(dim > 1 && !y) {
+      Error("FillN","no y-values given for a %d-dimensional efficiency",dim);
+      return;
+   }
+   if(dim > 2 && !z) {
+      Error("FillN","no z-values given for a %d-dimensional efficiency",dim);
+      return;
+   }
+
+   if(w && !TestBit(kUseWeights))
+      SetUseWeightedEvents();
+
+   // compact the passed events into contiguous arrays for TH1::FillN / TH2::FillN
+   std::vector<Double_t> passedX, passedY, passedW;
+   passedX.reserve(ntimes);
+   if(dim > 1)
+      passedY.reserve(ntimes);
+   if(w)
+      passedW.reserve(ntimes);
+   for (Int_t i = 0; i < ntimes; ++i) {
+      if(!bPassed[i])
+         continue;
+      passedX.push_back(x[i]);
+      if(dim > 1)
+         passedY.push_back(y[i]);
+      if(w)
+         passedW.push_back(w[i]);
+   }
+   const Int_t nPassed = static_cast<Int_t>(passedX.size());
+   const Double_t *pw = w ? passedW.data() : nullptr;
+
+   switch(dim) {
+      case 1:
+         fTotalHistogram->FillN(ntimes,x,w);
+         fPassedHistogram->FillN(nPassed,passedX.data(),pw);
+         break;
+      case 2:
+         ((TH2*)(fTotalHistogram))->FillN(ntimes,x,y,w);
+         ((TH2*)(fPassedHistogram))->FillN(nPassed,passedX.data(),passedY.data(),pw);
+         break;
+      case 3:
+         // TH3 has no FillN
+         for (Int_t i = 0; i < ntimes; ++i) {
+            ((TH3*)(fTotalHistogram))->Fill(x[i],y[i],z[i],w ? w[i] : 1.);
+            if(bPassed[i])
+               ((TH3*)(fPassedHistogram))->Fill(x[i],y[i],z[i],w ? w[i] : 1.);
+         }
+         break;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///This function is used for filling the two histograms with a weight.
 ///
@@ -2735,72 +2807,9 @@ Double_t TEfficiency::GetEfficiency(Int_t bin) const
 
 Double_t TEfficiency::GetEfficiencyErrorLow(Int_t bin) const
 {
-   Double_t total = fTotalHistogram->GetBinContent(bin);
-   Double_t passed = fPassedHistogram->GetBinContent(bin);
-
-   Double_t eff = GetEfficiency(bin);
-
-   // check whether weights have been used
-   if(TestBit(kUseWeights))
-   {
-      Double_t tw =  fTotalHistogram->GetBinContent(bin);
-      Double_t tw2 = fTotalHistogram->GetSumw2()->At(bin);
-      Double_t pw =  fPassedHistogram->GetBinContent(bin);
-      Double_t pw2 = fPassedHistogram->GetSumw2()->At(bin);
-
-      if(TestBit(kIsBayesian))
-      {
-         Double_t alpha = TestBit(kUseBinPrior) ? GetBetaAlpha(bin) : GetBetaAlpha();
-         Double_t beta  = TestBit(kUseBinPrior) ? GetBetaBeta(bin)  : GetBetaBeta();
-
-         if (tw2 <= 0) return 0;
-
-         // tw/tw2 renormalize the weights
-         Double_t norm = tw/tw2;
-         Double_t aa =  pw * norm + alpha;
-         Double_t bb =  (tw - pw) * norm + beta;
-         Double_t low = 0;
-         Double_t upper = 1;
-         if(TestBit(kShortestInterval)) {
-            TEfficiency::BetaShortestInterval(fConfLevel,aa,bb,low,upper);
-         }
-         else {
-            low = TEfficiency::BetaCentralInterval(fConfLevel,aa,bb,false);
-         }
-
-         return eff - low;
-      }
-      else
-      {
-         if(fStatisticOption != kFNormal)
-         {
-            Warning("GetEfficiencyErrorLow","frequentist confidence intervals for weights are only supported by the normal approximation");
-            Info("GetEfficiencyErrorLow","setting statistic option to kFNormal");
-            const_cast<TEfficiency*>(this)->SetStatisticOption(kFNormal);
-         }
-
-         Double_t variance = ( pw2 * (1. - 2 * eff) + tw2 * eff *eff ) / ( tw * tw) ;
-         Double_t sigma = sqrt(variance);
-
-         Double_t prob = 0.5 * (1.- fConfLevel);
-         Double_t delta = ROOT::Math::normal_quantile_c(prob, sigma);
-
-         // avoid to return errors which makes eff-err < 0
-         return (eff - delta < 0) ? eff : delta;
-      }
-   }
-   else
-   {
-      if(TestBit(kIsBayesian))
-      {
-         // parameters for the beta prior distribution
-         Double_t alpha = TestBit(kUseBinPrior) ? GetBetaAlpha(bin) : GetBetaAlpha();
-         Double_t beta  = TestBit(kUseBinPrior) ? GetBetaBeta(bin)  : GetBetaBeta();
-         return (eff - Bayesian(total,passed,fConfLevel,alpha,beta,false,TestBit(kShortestInterval)));
-      }
-      else
-         return (eff - fBoundary(total,passed,fConfLevel,false));
-   }
+   Double_t eff, effErrLow, effErrUp;
+   GetEfficiencyWithError(bin, eff, effErrLow, effErrUp);
+   return effErrLow;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2814,11 +2823,31 @@ Double_t TEfficiency::GetEfficiencyErrorLow(Int_t bin) const
 ///       normal approximation are supported.
 
 Double_t TEfficiency::GetEfficiencyErrorUp(Int_t bin) const
+{
+   Double_t eff, effErrLow, effErrUp;
+   GetEfficiencyWithError(bin, eff, effErrLow, effErrUp);
+   return effErrUp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the efficiency and both errors on the efficiency in the given
+/// global bin in one go.
+///
+/// Equivalent to calling GetEfficiency(), GetEfficiencyErrorLow() and
+/// GetEfficiencyErrorUp() for the bin, but the confidence interval is
+/// computed only once.
+///
+/// Note: If the histograms are filled with weights, only bayesian methods and the
+///       normal approximation are supported.
+
+void TEfficiency::GetEfficiencyWithError(Int_t bin,Double_t &eff,Double_t &effErrLow,Double_t &effErrUp) const
 {
    Double_t total = fTotalHistogram->GetBinContent(bin);
    Double_t passed = fPassedHistogram->GetBinContent(bin);
 
-   Double_t eff = GetEfficiency(bin);
+   eff = GetEfficiency(bin);
+   effErrLow = 0;
+   effErrUp = 0;
 
    // check whether weights have been used
    if(TestBit(kUseWeights))
@@ -2833,7 +2862,7 @@ Double_t TEfficiency::GetEfficiencyErrorUp(Int_t bin) const
          Double_t alpha = TestBit(kUseBinPrior) ? GetBetaAlpha(bin) : GetBetaAlpha();
          Double_t beta  = TestBit(kUseBinPrior) ? GetBetaBeta(bin)  : GetBetaBeta();
 
-         if (tw2 <= 0) return 0;
+         if (tw2 <= 0) return;
 
          // tw/tw2 renormalize the weights
          Double_t norm = tw/tw2;
@@ -2845,17 +2874,19 @@ Double_t TEfficiency::GetEfficiencyErrorUp(Int_t bin) const
             TEfficiency::BetaShortestInterval(fConfLevel,aa,bb,low,upper);
          }
          else {
+            low = TEfficiency::BetaCentralInterval(fConfLevel,aa,bb,false);
             upper = TEfficiency::BetaCentralInterval(fConfLevel,aa,bb,true);
          }
 
-         return upper - eff;
+         effErrLow = eff - low;
+         effErrUp = upper - eff;
       }
       else
       {
          if(fStatisticOption != kFNormal)
          {
-            Warning("GetEfficiencyErrorUp","frequentist confidence intervals for weights are only supported by the normal approximation");
-            Info("GetEfficiencyErrorUp","setting statistic option to kFNormal");
+            Warning("GetEfficiencyWithError","frequentist confidence intervals for weights are only supported by the normal approximation");
+            Info("GetEfficiencyWithError","setting statistic option to kFNormal");
             const_cast<TEfficiency*>(this)->SetStatisticOption(kFNormal);
          }
 
@@ -2865,7 +2896,9 @@ Double_t TEfficiency::GetEfficiencyErrorUp(Int_t bin) const
          Double_t prob = 0.5 * (1.- fConfLevel);
          Double_t delta = ROOT::Math::normal_quantile_c(prob, sigma);
 
-         return (eff + delta > 1) ? 1.-eff : delta;
+         // avoid to return errors which makes eff-err < 0 or eff+err > 1
+         effErrLow = (eff - delta < 0) ? eff : delta;
+         effErrUp = (eff + delta > 1) ? 1.-eff : delta;
       }
    }
    else
@@ -2875,13 +2908,69 @@ Double_t TEfficiency::GetEfficiencyErrorUp(Int_t bin) const
          // parameters for the beta prior distribution
          Double_t alpha = TestBit(kUseBinPrior) ? GetBetaAlpha(bin) : GetBetaAlpha();
          Double_t beta  = TestBit(kUseBinPrior) ? GetBetaBeta(bin)  : GetBetaBeta();
-         return (Bayesian(total,passed,fConfLevel,alpha,beta,true,TestBit(kShortestInterval)) - eff);
+         effErrLow = eff - Bayesian(total,passed,fConfLevel,alpha,beta,false,TestBit(kShortestInterval));
+         effErrUp = Bayesian(total,passed,fConfLevel,alpha,beta,true,TestBit(kShortestInterval)) - eff;
       }
       else
-         return fBoundary(total,passed,fConfLevel,true) - eff;
+      {
+         effErrLow = eff - fBoundary(total,passed,fConfLevel,false);
+         effErrUp = fBoundary(total,passed,fConfLevel,true) - eff;
+      }
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the efficiency and both errors on the efficiency for all global
+/// bins at once.
+///
+/// The vectors are resized to the number of cells of the underlying
+/// histograms (see TH1::GetNcells()) and are indexed by the global bin number.
+/// Since the confidence intervals of the bins are independent of each other,
+/// the computation is split across the implicit multi-threading pool if
+/// ROOT::EnableImplicitMT() has been called. This is considerably faster than
+/// calling GetEfficiencyErrorLow() and GetEfficiencyErrorUp() bin by bin,
+/// especially for the bayesian and Clopper-Pearson intervals, which require
+/// a quantile search per bin.
+
+void TEfficiency::GetEfficiencyArrays(std::vector<Double_t> &eff,std::vector<Double_t> &effErrLow,
+                                      std::vector<Double_t> &effErrUp) const
+{
+   const Int_t ncells = fTotalHistogram->GetNcells();
+   eff.resize(ncells);
+   effErrLow.resize(ncells);
+   effErrUp.resize(ncells);
+
+   // normalize the statistic option up front such that the per-bin computation
+   // does not modify it from concurrent tasks
+   if (TestBit(kUseWeights) && !TestBit(kIsBayesian) && fStatisticOption != kFNormal) {
+      Warning("GetEfficiencyArrays","frequentist confidence intervals for weights are only supported by the normal approximation");
+      Info("GetEfficiencyArrays","setting statistic option to kFNormal");
+      const_cast<TEfficiency*>(this)->SetStatisticOption(kFNormal);
+   }
+
+   auto computeRange = [this, &eff, &effErrLow, &effErrUp](Int_t begin, Int_t end) {
+      for (Int_t bin = begin; bin < end; ++bin)
+         GetEfficiencyWithError(bin, eff[bin], effErrLow[bin], effErrUp[bin]);
+   };
+
+#ifdef R__USE_IMT
+   // the interval computation is orders of magnitude more expensive per bin than plain
+   // bin arithmetic, so parallelism pays off already for moderate numbers of bins
+   constexpr Int_t kBinsPerTask = 256;
+   if (ROOT::IsImplicitMTEnabled() && ncells > kBinsPerTask) {
+      std::vector<std::pair<Int_t, Int_t>> ranges;
+      ranges.reserve((ncells + kBinsPerTask - 1) / kBinsPerTask);
+      for (Int_t begin = 0; begin < ncells; begin += kBinsPerTask)
+         ranges.emplace_back(begin, TMath::Min(ncells, begin + kBinsPerTask));
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&computeRange](const std::pair<Int_t, Int_t> &range) { computeRange(range.first, range.second); },
+                   ranges);
+      return;
+   }
+#endif
+   computeRange(0, ncells);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the global bin number which can be used as argument for the
 /// following functions:
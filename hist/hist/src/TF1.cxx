@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include "strlcpy.h"
@@ -1530,6 +1531,86 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function on a grid of n points in one call.
+///
+/// Fills `y[i] = EvalPar(&x[i], params)` for i in [0, n). Only valid for
+/// one-dimensional functions. For vectorized formula-based functions (see
+/// SetVectorized) the grid is processed in SIMD lanes through TFormula's
+/// vectorization support instead of point by point.
+///
+/// For plain formula-based functions the results are cached together with the
+/// parameter values they were computed with: minimizer line searches evaluate
+/// the same x-grid at a small set of recurring parameter points, and a call
+/// with an already-seen parameter set is served from the cache without
+/// re-evaluating the formula. The cache keeps the four most recently used
+/// parameter sets and is flushed whenever the grid changes or Update() is
+/// called. Functor-based, interpreted and normalized functions are evaluated
+/// directly every time since their result is not a pure function of
+/// (x, params).
+
+void TF1::EvalGrid(const Double_t *x, Double_t *y, Int_t n, const Double_t *params)
+{
+   if (n <= 0 || !x || !y)
+      return;
+   if (fNdim > 1) {
+      Error("EvalGrid", "Only valid for one-dimensional functions (fNdim = %d)", fNdim);
+      return;
+   }
+   const Double_t *pars = params;
+   if (!pars)
+      pars = (fType == EFType::kFormula) ? fFormula->GetParameters() : fParams->GetParameters();
+
+   // only plain formulas are guaranteed deterministic in (x, params)
+   const Bool_t useCache = (fType == EFType::kFormula) && fFormula && !fNormalized && fNpar > 0;
+   if (useCache) {
+      if ((Int_t)fGridX.size() != n || !std::equal(fGridX.begin(), fGridX.end(), x)) {
+         // new grid: the previous results do not apply
+         fGridX.assign(x, x + n);
+         fGridCache.clear();
+      } else {
+         for (auto it = fGridCache.begin(); it != fGridCache.end(); ++it) {
+            if (std::equal(it->begin(), it->begin() + fNpar, pars)) {
+               std::copy(it->begin() + fNpar, it->end(), y);
+               if (it + 1 != fGridCache.end())
+                  std::rotate(it, it + 1, fGridCache.end()); // keep the most recently used entry last
+               return;
+            }
+         }
+      }
+   }
+
+#ifdef R__HAS_VECCORE
+   if (fType == EFType::kFormula && fFormula && fFormula->IsVectorized() && !fNormalized) {
+      const Int_t vecSize = vecCore::VectorSize<ROOT::Double_v>();
+      Int_t i = 0;
+      for (; i + vecSize <= n; i += vecSize) {
+         ROOT::Double_v xv;
+         vecCore::Load<ROOT::Double_v>(xv, &x[i]);
+         ROOT::Double_v yv = fFormula->EvalParVec(&xv, pars);
+         vecCore::Store<ROOT::Double_v>(yv, &y[i]);
+      }
+      for (; i < n; ++i)
+         y[i] = EvalPar(&x[i], pars);
+   } else
+#endif
+   {
+      for (Int_t i = 0; i < n; ++i)
+         y[i] = EvalPar(&x[i], pars);
+   }
+
+   if (useCache) {
+      constexpr std::size_t kGridCacheSlots = 4;
+      if (fGridCache.size() >= kGridCacheSlots)
+         fGridCache.erase(fGridCache.begin());
+      std::vector<Double_t> entry;
+      entry.reserve(fNpar + n);
+      entry.insert(entry.end(), pars, pars + fNpar);
+      entry.insert(entry.end(), y, y + n);
+      fGridCache.push_back(std::move(entry));
+   }
+}
+
 /// Evaluate the uncertainty of the function at location x due to the parameter
 /// uncertainties. If covMatrix is nullptr, assumes uncorrelated uncertainties,
 /// otherwise the input covariance matrix (e.g. from a fit performed with
@@ -3666,6 +3747,9 @@ void TF1::Update()
       fBeta.clear();
       fGamma.clear();
    }
+   // cached grid evaluations (see EvalGrid) are no longer trustworthy
+   fGridX.clear();
+   fGridCache.clear();
    if (fNormalized) {
       // need to compute the integral of the not-normalized function
       fNormalized = false;
@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cctype>
 #include <climits>
@@ -22,6 +23,8 @@
 #include <fstream>
 #include <limits>
 #include <iomanip>
+#include <utility>
+#include <vector>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -58,6 +61,10 @@
 
 #include "TH1Merger.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 /** \addtogroup Histograms
 @{
 \class TH1C
@@ -111,7 +118,9 @@ ROOT supports the following histogram types:
   - 1-D histograms:
       - TH1C : histograms with one byte per channel.   Maximum bin content = 127
       - TH1S : histograms with one short per channel.  Maximum bin content = 32767
+      - TH1US : histograms with one unsigned short per channel. Maximum bin content = 65535
       - TH1I : histograms with one int per channel.    Maximum bin content = INT_MAX (\ref intmax "*")
+      - TH1UI : histograms with one unsigned int per channel. Maximum bin content = 4294967295
       - TH1L : histograms with one long64 per channel. Maximum bin content = LLONG_MAX (\ref llongmax "**")
       - TH1F : histograms with one float per channel.  Maximum precision 7 digits, maximum integer bin content = +/-16777216 (\ref floatmax "***")
       - TH1D : histograms with one double per channel. Maximum precision 14 digits, maximum integer bin content = +/-9007199254740992 (\ref doublemax "****")
@@ -597,6 +606,50 @@ extern void H1LeastSquareSeqnd(Int_t n, Double_t *a, Int_t idim, Int_t &ifail, I
 
 ClassImp(TH1);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Apply `func(beginBin, endBin)` to all cells of a histogram, splitting the
+/// work across the implicit multi-threading pool when it is enabled and the
+/// histogram is large enough to amortize the task scheduling overhead.
+/// Used by the bulk bin arithmetic (Add, Divide, Multiply, Scale); the
+/// functors must only touch bins inside the range they are handed.
+
+template <typename F>
+static void BinRangeApply(Int_t ncells, F func)
+{
+#ifdef R__USE_IMT
+   constexpr Int_t kBinsPerTask = 65536;
+   if (ROOT::IsImplicitMTEnabled() && ncells > kBinsPerTask) {
+      std::vector<std::pair<Int_t, Int_t>> ranges;
+      ranges.reserve((ncells + kBinsPerTask - 1) / kBinsPerTask);
+      for (Int_t begin = 0; begin < ncells; begin += kBinsPerTask)
+         ranges.emplace_back(begin, std::min(ncells, begin + kBinsPerTask));
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&func](const std::pair<Int_t, Int_t> &range) { func(range.first, range.second); }, ranges);
+      return;
+   }
+#endif
+   func(0, ncells);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the bin content array of a histogram whose cells are plain
+/// Double_t values (TH1D, TH2D, TH3D), or nullptr. The array lets the bulk
+/// arithmetic kernels bypass the virtual per-bin accessors so the compiler
+/// can vectorize them. Profiles derive from the same classes but store
+/// weighted sums in the array, so they are matched by exact class.
+
+static Double_t *DoubleBinArray(TH1 &h)
+{
+   if (h.IsA() == TH1D::Class() || h.IsA() == TH2D::Class() || h.IsA() == TH3D::Class())
+      return dynamic_cast<TArrayD &>(h).GetArray();
+   return nullptr;
+}
+
+static const Double_t *DoubleBinArray(const TH1 &h)
+{
+   return DoubleBinArray(const_cast<TH1 &>(h));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Histogram default constructor.
 
@@ -995,9 +1048,9 @@ Bool_t TH1::Add(const TH1 *h1, Double_t c1)
    Double_t c1sq = c1 * c1;
    Double_t factsq = factor * factor;
 
-   for (Int_t bin = 0; bin < fNcells; ++bin) {
+   if (this->TestBit(kIsAverage) && h1->TestBit(kIsAverage)) {
       //special case where histograms have the kIsAverage bit set
-      if (this->TestBit(kIsAverage) && h1->TestBit(kIsAverage)) {
+      for (Int_t bin = 0; bin < fNcells; ++bin) {
          Double_t y1 = h1->RetrieveBinContent(bin);
          Double_t y2 = this->RetrieveBinContent(bin);
          Double_t e1sq = h1->GetBinErrorSqUnchecked(bin);
@@ -1032,10 +1085,33 @@ Bool_t TH1::Add(const TH1 *h1, Double_t c1)
             if (err2 < 1.E-200) err2 = 0;  // to remove arbitrary value when e1=0 AND e2=0
             fSumw2.fArray[bin] = err2;
          }
-      } else { // normal case of addition between histograms
-         AddBinContent(bin, c1 * factor * h1->RetrieveBinContent(bin));
-         if (fSumw2.fN) fSumw2.fArray[bin] += c1sq * factsq * h1->GetBinErrorSqUnchecked(bin);
       }
+   } else { // normal case of addition between histograms
+      const Double_t k = c1 * factor;
+      const Double_t ksq = c1sq * factsq;
+      Double_t *tgt = DoubleBinArray(*this);
+      const Double_t *src = DoubleBinArray(*h1);
+      BinRangeApply(fNcells, [&](Int_t begin, Int_t end) {
+         if (tgt && src) {
+            // contiguous Double_t bins: plain array kernel the compiler can vectorize
+            for (Int_t bin = begin; bin < end; ++bin)
+               tgt[bin] += k * src[bin];
+         } else {
+            for (Int_t bin = begin; bin < end; ++bin)
+               AddBinContent(bin, k * h1->RetrieveBinContent(bin));
+         }
+         if (fSumw2.fN) {
+            Double_t *esq = fSumw2.fArray;
+            if (h1->fSumw2.fN) {
+               const Double_t *e1sq = h1->fSumw2.fArray;
+               for (Int_t bin = begin; bin < end; ++bin)
+                  esq[bin] += ksq * e1sq[bin];
+            } else {
+               for (Int_t bin = begin; bin < end; ++bin)
+                  esq[bin] += ksq * h1->GetBinErrorSqUnchecked(bin);
+            }
+         }
+      });
    }
 
    // update statistics (do here to avoid changes by SetBinContent)
@@ -1226,14 +1302,26 @@ Bool_t TH1::Add(const TH1 *h1, const TH1 *h2, Double_t c1, Double_t c2)
          }
       }
    } else { // case of simple histogram addition
-      Double_t c1sq = c1 * c1;
-      Double_t c2sq = c2 * c2;
-      for (Int_t i = 0; i < fNcells; ++i) { // Loop on cells (bins including underflows/overflows)
-         UpdateBinContent(i, c1 * h1->RetrieveBinContent(i) + c2 * h2->RetrieveBinContent(i));
+      const Double_t c1sq = c1 * c1;
+      const Double_t c2sq = c2 * c2;
+      Double_t *tgt = DoubleBinArray(*this);
+      const Double_t *src1 = DoubleBinArray(*h1);
+      const Double_t *src2 = DoubleBinArray(*h2);
+      BinRangeApply(fNcells, [&](Int_t begin, Int_t end) {
+         if (tgt && src1 && src2) {
+            // contiguous Double_t bins: fused multiply-add the compiler can vectorize
+            for (Int_t i = begin; i < end; ++i)
+               tgt[i] = c1 * src1[i] + c2 * src2[i];
+         } else {
+            for (Int_t i = begin; i < end; ++i)
+               UpdateBinContent(i, c1 * h1->RetrieveBinContent(i) + c2 * h2->RetrieveBinContent(i));
+         }
          if (fSumw2.fN) {
-            fSumw2.fArray[i] = c1sq * h1->GetBinErrorSqUnchecked(i) + c2sq * h2->GetBinErrorSqUnchecked(i);
+            Double_t *esq = fSumw2.fArray;
+            for (Int_t i = begin; i < end; ++i)
+               esq[i] = c1sq * h1->GetBinErrorSqUnchecked(i) + c2sq * h2->GetBinErrorSqUnchecked(i);
          }
-      }
+      });
    }
 
    if (resetStats)  {
@@ -2556,10 +2644,19 @@ Double_t TH1::ComputeIntegral(Bool_t onlyPositive)
 /// including underflow and overflow (fNCells)
 /// the last value integral[fNCells] is set to the number of entries of
 /// the histogram
+/// The cached array is recomputed when the number of entries has changed
+/// since it was filled, so repeated integral or quantile queries between
+/// fill batches reuse the same cumulative sums (see also GetQuantiles and
+/// GetRandom, which apply the same staleness check).
 
 Double_t *TH1::GetIntegral()
 {
-   if (!fIntegral) ComputeIntegral();
+   if (!fIntegral) {
+      ComputeIntegral();
+   } else {
+      const Int_t nbins = GetNbinsX() * GetNbinsY() * GetNbinsZ();
+      if (fIntegral[nbins + 1] != fEntries) ComputeIntegral();
+   }
    return fIntegral;
 }
 
@@ -2897,18 +2994,20 @@ Bool_t TH1::Divide(const TH1 *h1)
    if (fSumw2.fN == 0 && h1->GetSumw2N() != 0) Sumw2();
 
    //   - Loop on bins (including underflows/overflows)
-   for (Int_t i = 0; i < fNcells; ++i) {
-      Double_t c0 = RetrieveBinContent(i);
-      Double_t c1 = h1->RetrieveBinContent(i);
-      if (c1) UpdateBinContent(i, c0 / c1);
-      else UpdateBinContent(i, 0);
-
-      if(fSumw2.fN) {
-         if (c1 == 0) { fSumw2.fArray[i] = 0; continue; }
-         Double_t c1sq = c1 * c1;
-         fSumw2.fArray[i] = (GetBinErrorSqUnchecked(i) * c1sq + h1->GetBinErrorSqUnchecked(i) * c0 * c0) / (c1sq * c1sq);
+   BinRangeApply(fNcells, [&](Int_t begin, Int_t end) {
+      for (Int_t i = begin; i < end; ++i) {
+         Double_t c0 = RetrieveBinContent(i);
+         Double_t c1 = h1->RetrieveBinContent(i);
+         if (c1) UpdateBinContent(i, c0 / c1);
+         else UpdateBinContent(i, 0);
+
+         if(fSumw2.fN) {
+            if (c1 == 0) { fSumw2.fArray[i] = 0; continue; }
+            Double_t c1sq = c1 * c1;
+            fSumw2.fArray[i] = (GetBinErrorSqUnchecked(i) * c1sq + h1->GetBinErrorSqUnchecked(i) * c0 * c0) / (c1sq * c1sq);
+         }
       }
-   }
+   });
    ResetStats();
    return kTRUE;
 }
@@ -2969,36 +3068,38 @@ Bool_t TH1::Divide(const TH1 *h1, const TH1 *h2, Double_t c1, Double_t c2, Optio
    SetMaximum();
 
    //   - Loop on bins (including underflows/overflows)
-   for (Int_t i = 0; i < fNcells; ++i) {
-      Double_t b1 = h1->RetrieveBinContent(i);
-      Double_t b2 = h2->RetrieveBinContent(i);
-      if (b2) UpdateBinContent(i, c1 * b1 / (c2 * b2));
-      else UpdateBinContent(i, 0);
-
-      if (fSumw2.fN) {
-         if (b2 == 0) { fSumw2.fArray[i] = 0; continue; }
-         Double_t b1sq = b1 * b1; Double_t b2sq = b2 * b2;
-         Double_t c1sq = c1 * c1; Double_t c2sq = c2 * c2;
-         Double_t e1sq = h1->GetBinErrorSqUnchecked(i);
-         Double_t e2sq = h2->GetBinErrorSqUnchecked(i);
-         if (binomial) {
-            if (b1 != b2) {
-               // in the case of binomial statistics c1 and c2 must be 1 otherwise it does not make sense
-               // c1 and c2 are ignored
-               //fSumw2.fArray[bin] = TMath::Abs(w*(1-w)/(c2*b2));//this is the formula in Hbook/Hoper1
-               //fSumw2.fArray[bin] = TMath::Abs(w*(1-w)/b2);     // old formula from G. Flucke
-               // formula which works also for weighted histogram (see http://root-forum.cern.ch/viewtopic.php?t=3753 )
-               fSumw2.fArray[i] = TMath::Abs( ( (1. - 2.* b1 / b2) * e1sq  + b1sq * e2sq / b2sq ) / b2sq );
+   BinRangeApply(fNcells, [&](Int_t begin, Int_t end) {
+      for (Int_t i = begin; i < end; ++i) {
+         Double_t b1 = h1->RetrieveBinContent(i);
+         Double_t b2 = h2->RetrieveBinContent(i);
+         if (b2) UpdateBinContent(i, c1 * b1 / (c2 * b2));
+         else UpdateBinContent(i, 0);
+
+         if (fSumw2.fN) {
+            if (b2 == 0) { fSumw2.fArray[i] = 0; continue; }
+            Double_t b1sq = b1 * b1; Double_t b2sq = b2 * b2;
+            Double_t c1sq = c1 * c1; Double_t c2sq = c2 * c2;
+            Double_t e1sq = h1->GetBinErrorSqUnchecked(i);
+            Double_t e2sq = h2->GetBinErrorSqUnchecked(i);
+            if (binomial) {
+               if (b1 != b2) {
+                  // in the case of binomial statistics c1 and c2 must be 1 otherwise it does not make sense
+                  // c1 and c2 are ignored
+                  //fSumw2.fArray[bin] = TMath::Abs(w*(1-w)/(c2*b2));//this is the formula in Hbook/Hoper1
+                  //fSumw2.fArray[bin] = TMath::Abs(w*(1-w)/b2);     // old formula from G. Flucke
+                  // formula which works also for weighted histogram (see http://root-forum.cern.ch/viewtopic.php?t=3753 )
+                  fSumw2.fArray[i] = TMath::Abs( ( (1. - 2.* b1 / b2) * e1sq  + b1sq * e2sq / b2sq ) / b2sq );
+               } else {
+                  //in case b1=b2 error is zero
+                  //use  TGraphAsymmErrors::BayesDivide for getting the asymmetric error not equal to zero
+                  fSumw2.fArray[i] = 0;
+               }
             } else {
-               //in case b1=b2 error is zero
-               //use  TGraphAsymmErrors::BayesDivide for getting the asymmetric error not equal to zero
-               fSumw2.fArray[i] = 0;
+               fSumw2.fArray[i] = c1sq * c2sq * (e1sq * b2sq + e2sq * b1sq) / (c2sq * c2sq * b2sq * b2sq);
             }
-         } else {
-            fSumw2.fArray[i] = c1sq * c2sq * (e1sq * b2sq + e2sq * b1sq) / (c2sq * c2sq * b2sq * b2sq);
          }
       }
-   }
+   });
    ResetStats();
    if (binomial)
       // in case of binomial division use denominator for number of entries
@@ -3452,6 +3553,96 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
    ntimes *= stride;
+
+   // Fast path for a plain numeric axis whose binning cannot change while we
+   // fill: compute the bins for a whole chunk of values before touching the
+   // bin contents. For variable-width axes the lookup is a branchless
+   // lower_bound over the bin edges with four searches in flight, so the
+   // dependent loads of independent searches overlap instead of serializing
+   // one binary search per value as TAxis::FindBin does.
+   if (!fXaxis.GetLabels() && !fXaxis.CanExtend()) {
+      const Double_t xmin = fXaxis.GetXmin();
+      const Double_t xmax = fXaxis.GetXmax();
+      const TArrayD *xbins = fXaxis.GetXbins();
+      const Double_t *edges = xbins->fN ? xbins->fArray : nullptr;
+      const Int_t nedges = nbins + 1;
+      const Bool_t statOverflows = GetStatOverflowsBehaviour();
+      constexpr Int_t kChunk = 256;
+      Int_t bins[kChunk];
+      const Int_t nvals = ntimes / stride;
+      for (Int_t first = 0; first < nvals; first += kChunk) {
+         const Int_t n = TMath::Min(kChunk, nvals - first);
+         if (!edges) {
+            for (Int_t j = 0; j < n; ++j) {
+               const Double_t v = x[(first + j) * stride];
+               if (v < xmin) {
+                  bins[j] = 0;
+               } else if (!(v < xmax)) { // catches NaN as overflow, as FindBin does
+                  bins[j] = nbins + 1;
+               } else {
+                  const Double_t width = (xmax - xmin) / nbins;
+                  const Int_t approxBin = (v - xmin) / width;
+                  bins[j] = 1 + approxBin - (v < xmin + width * approxBin) + (xmin + width * (approxBin + 1) <= v);
+               }
+            }
+         } else {
+            Int_t j = 0;
+            for (; j + 4 <= n; j += 4) {
+               const Double_t v0 = x[(first + j) * stride];
+               const Double_t v1 = x[(first + j + 1) * stride];
+               const Double_t v2 = x[(first + j + 2) * stride];
+               const Double_t v3 = x[(first + j + 3) * stride];
+               Int_t b0 = 0, b1 = 0, b2 = 0, b3 = 0;
+               for (Int_t len = nedges; len > 1;) {
+                  const Int_t half = len >> 1;
+                  b0 += (edges[b0 + half] <= v0) ? half : 0;
+                  b1 += (edges[b1 + half] <= v1) ? half : 0;
+                  b2 += (edges[b2 + half] <= v2) ? half : 0;
+                  b3 += (edges[b3 + half] <= v3) ? half : 0;
+                  len -= half;
+               }
+               // edges[0] == xmin, so under/overflow reduce to boundary checks
+               bins[j]     = (v0 < xmin) ? 0 : (!(v0 < xmax) ? nbins + 1 : b0 + 1);
+               bins[j + 1] = (v1 < xmin) ? 0 : (!(v1 < xmax) ? nbins + 1 : b1 + 1);
+               bins[j + 2] = (v2 < xmin) ? 0 : (!(v2 < xmax) ? nbins + 1 : b2 + 1);
+               bins[j + 3] = (v3 < xmin) ? 0 : (!(v3 < xmax) ? nbins + 1 : b3 + 1);
+            }
+            for (; j < n; ++j) {
+               const Double_t v = x[(first + j) * stride];
+               if (v < xmin)
+                  bins[j] = 0;
+               else if (!(v < xmax))
+                  bins[j] = nbins + 1;
+               else
+                  bins[j] = 1 + TMath::BinarySearch(nedges, edges, v);
+            }
+         }
+         if (w && !fSumw2.fN && !TestBit(TH1::kIsNotW)) {
+            for (Int_t j = 0; j < n; ++j) {
+               if (w[(first + j) * stride] != 1.0) {
+                  Sumw2();
+                  break;
+               }
+            }
+         }
+         for (Int_t j = 0; j < n; ++j) {
+            bin = bins[j];
+            const Double_t v = x[(first + j) * stride];
+            if (w) ww = w[(first + j) * stride];
+            if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+            AddBinContent(bin, ww);
+            if (bin == 0 || bin > nbins) {
+               if (!statOverflows) continue;
+            }
+            fTsumw   += ww;
+            fTsumw2  += ww*ww;
+            fTsumwx  += ww*v;
+            fTsumwx2 += ww*v*v;
+         }
+      }
+      return;
+   }
+
    for (i=0;i<ntimes;i+=stride) {
       bin =fXaxis.FindBin(x[i]);
       if (bin <0) continue;
@@ -6135,14 +6326,16 @@ Bool_t TH1::Multiply(const TH1 *h1)
    SetMaximum();
 
    //   - Loop on bins (including underflows/overflows)
-   for (Int_t i = 0; i < fNcells; ++i) {
-      Double_t c0 = RetrieveBinContent(i);
-      Double_t c1 = h1->RetrieveBinContent(i);
-      UpdateBinContent(i, c0 * c1);
-      if (fSumw2.fN) {
-         fSumw2.fArray[i] = GetBinErrorSqUnchecked(i) * c1 * c1 + h1->GetBinErrorSqUnchecked(i) * c0 * c0;
+   BinRangeApply(fNcells, [&](Int_t begin, Int_t end) {
+      for (Int_t i = begin; i < end; ++i) {
+         Double_t c0 = RetrieveBinContent(i);
+         Double_t c1 = h1->RetrieveBinContent(i);
+         UpdateBinContent(i, c0 * c1);
+         if (fSumw2.fN) {
+            fSumw2.fArray[i] = GetBinErrorSqUnchecked(i) * c1 * c1 + h1->GetBinErrorSqUnchecked(i) * c0 * c0;
+         }
       }
-   }
+   });
    ResetStats();
    return kTRUE;
 }
@@ -6189,15 +6382,17 @@ Bool_t TH1::Multiply(const TH1 *h1, const TH1 *h2, Double_t c1, Double_t c2, Opt
    SetMaximum();
 
    //   - Loop on bins (including underflows/overflows)
-   Double_t c1sq = c1 * c1; Double_t c2sq = c2 * c2;
-   for (Int_t i = 0; i < fNcells; ++i) {
-      Double_t b1 = h1->RetrieveBinContent(i);
-      Double_t b2 = h2->RetrieveBinContent(i);
-      UpdateBinContent(i, c1 * b1 * c2 * b2);
-      if (fSumw2.fN) {
-         fSumw2.fArray[i] = c1sq * c2sq * (h1->GetBinErrorSqUnchecked(i) * b2 * b2 + h2->GetBinErrorSqUnchecked(i) * b1 * b1);
+   const Double_t c1sq = c1 * c1; const Double_t c2sq = c2 * c2;
+   BinRangeApply(fNcells, [&](Int_t begin, Int_t end) {
+      for (Int_t i = begin; i < end; ++i) {
+         Double_t b1 = h1->RetrieveBinContent(i);
+         Double_t b2 = h2->RetrieveBinContent(i);
+         UpdateBinContent(i, c1 * b1 * c2 * b2);
+         if (fSumw2.fN) {
+            fSumw2.fArray[i] = c1sq * c2sq * (h1->GetBinErrorSqUnchecked(i) * b2 * b2 + h2->GetBinErrorSqUnchecked(i) * b1 * b1);
+         }
       }
-   }
+   });
    ResetStats();
    return kTRUE;
 }
@@ -6648,8 +6843,18 @@ void TH1::Scale(Double_t c1, Option_t *option)
    if (opt.Contains("width")) Add(this, this, c1, -1);
    else {
       if (fBuffer) BufferEmpty(1);
-      for(Int_t i = 0; i < fNcells; ++i) UpdateBinContent(i, c1 * RetrieveBinContent(i));
-      if (fSumw2.fN) for(Int_t i = 0; i < fNcells; ++i) fSumw2.fArray[i] *= (c1 * c1); // update errors
+      Double_t *tgt = DoubleBinArray(*this);
+      const Double_t c1sq = c1 * c1;
+      BinRangeApply(fNcells, [&](Int_t begin, Int_t end) {
+         if (tgt) {
+            // contiguous Double_t bins: plain array kernel the compiler can vectorize
+            for (Int_t i = begin; i < end; ++i) tgt[i] *= c1;
+         } else {
+            for (Int_t i = begin; i < end; ++i) UpdateBinContent(i, c1 * RetrieveBinContent(i));
+         }
+         if (fSumw2.fN)
+            for (Int_t i = begin; i < end; ++i) fSumw2.fArray[i] *= c1sq; // update errors
+      });
       // update global histograms statistics
       Double_t s[kNstat] = {0};
       GetStats(s);
@@ -8976,6 +9181,36 @@ void TH1::SetDirectory(TDirectory *dir)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Move all histograms in hists to the directory dir in a single registration
+/// transaction.
+///
+/// Equivalent to calling `h->SetDirectory(dir)` on every histogram, but the
+/// target directory's list of objects is grown under one lock acquisition,
+/// which is considerably cheaper when booking many histograms, in particular
+/// from several threads at once. A typical use is to book the histograms with
+/// `TH1::AddDirectory(kFALSE)` in effect and register them in bulk afterwards.
+/// A null dir only detaches the histograms from their current directory.
+
+void TH1::BulkSetDirectory(const std::vector<TH1 *> &hists, TDirectory *dir)
+{
+   std::vector<TObject *> batch;
+   batch.reserve(hists.size());
+   for (TH1 *h : hists) {
+      if (!h || h->fDirectory == dir)
+         continue;
+      if (h->fDirectory)
+         h->fDirectory->Remove(h);
+      h->fDirectory = dir;
+      if (dir) {
+         h->fFunctions->UseRWLock();
+         batch.push_back(h);
+      }
+   }
+   if (dir && !batch.empty())
+      dir->Append(batch.data(), (Int_t)batch.size());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Replace bin errors by values in array error.
 
@@ -9841,6 +10076,197 @@ TH1S operator/(const TH1S &h1, const TH1S &h2)
    return hnew;
 }
 
+//______________________________________________________________________________
+//                     TH1US methods
+// TH1US : histograms with one unsigned short per channel. Maximum bin content = 65535
+// The counts are stored as the bit patterns of the shorts in the TArrayS base,
+// so the existing TArrayS streamer round-trips them unchanged.
+//______________________________________________________________________________
+
+ClassImp(TH1US);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor.
+
+TH1US::TH1US()
+{
+   fDimension = 1;
+   SetBinsLength(3);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a 1-Dim histogram with fix bins of type unsigned short
+/// (see TH1::TH1 for explanation of parameters)
+
+TH1US::TH1US(const char *name,const char *title,Int_t nbins,Double_t xlow,Double_t xup)
+: TH1(name,title,nbins,xlow,xup)
+{
+   fDimension = 1;
+   TArrayS::Set(fNcells);
+
+   if (xlow >= xup) SetBuffer(fgBufferSize);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a 1-Dim histogram with variable bins of type unsigned short
+/// (see TH1::TH1 for explanation of parameters)
+
+TH1US::TH1US(const char *name,const char *title,Int_t nbins,const Float_t *xbins)
+: TH1(name,title,nbins,xbins)
+{
+   fDimension = 1;
+   TArrayS::Set(fNcells);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a 1-Dim histogram with variable bins of type unsigned short
+/// (see TH1::TH1 for explanation of parameters)
+
+TH1US::TH1US(const char *name,const char *title,Int_t nbins,const Double_t *xbins)
+: TH1(name,title,nbins,xbins)
+{
+   fDimension = 1;
+   TArrayS::Set(fNcells);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor.
+
+TH1US::~TH1US()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy constructor.
+/// The list of functions is not copied. (Use Clone() if needed)
+
+TH1US::TH1US(const TH1US &h1us) : TH1(), TArrayS()
+{
+   h1us.TH1US::Copy(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment bin content by 1.
+/// The content saturates at 65535 instead of overflowing.
+/// Passing an out-of-range bin leads to undefined behavior
+
+void TH1US::AddBinContent(Int_t bin)
+{
+   const UShort_t val = UShort_t(fArray[bin]);
+   if (val < 65535) fArray[bin] = Short_t(val + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment bin content by w.
+/// \warning The value of w is cast to `Long64_t` before being added.
+/// The content is clamped to the range [0, 65535].
+/// Passing an out-of-range bin leads to undefined behavior
+
+void TH1US::AddBinContent(Int_t bin, Double_t w)
+{
+   Long64_t newval = Long64_t(UShort_t(fArray[bin])) + Long64_t(w);
+   if (newval < 0) newval = 0;
+   if (newval > 65535) newval = 65535;
+   fArray[bin] = Short_t(UShort_t(newval));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy this to newth1
+
+void TH1US::Copy(TObject &newth1) const
+{
+   TH1::Copy(newth1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reset.
+
+void TH1US::Reset(Option_t *option)
+{
+   TH1::Reset(option);
+   TArrayS::Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set total number of bins including under/overflow
+/// Reallocate bin contents array
+
+void TH1US::SetBinsLength(Int_t n)
+{
+   if (n < 0) n = fXaxis.GetNbins() + 2;
+   fNcells = n;
+   TArrayS::Set(n);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator =
+
+TH1US& TH1US::operator=(const TH1US &h1)
+{
+   if (this != &h1)
+      h1.TH1US::Copy(*this);
+   return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator *
+
+TH1US operator*(Double_t c1, const TH1US &h1)
+{
+   TH1US hnew = h1;
+   hnew.Scale(c1);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator +
+
+TH1US operator+(const TH1US &h1, const TH1US &h2)
+{
+   TH1US hnew = h1;
+   hnew.Add(&h2,1);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator -
+
+TH1US operator-(const TH1US &h1, const TH1US &h2)
+{
+   TH1US hnew = h1;
+   hnew.Add(&h2,-1);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator *
+
+TH1US operator*(const TH1US &h1, const TH1US &h2)
+{
+   TH1US hnew = h1;
+   hnew.Multiply(&h2);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator /
+
+TH1US operator/(const TH1US &h1, const TH1US &h2)
+{
+   TH1US hnew = h1;
+   hnew.Divide(&h2);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
 //______________________________________________________________________________
 //                     TH1I methods
 // TH1I : histograms with one int per channel.    Maximum bin content = 2147483647
@@ -10029,6 +10455,197 @@ TH1I operator/(const TH1I &h1, const TH1I &h2)
    return hnew;
 }
 
+//______________________________________________________________________________
+//                     TH1UI methods
+// TH1UI : histograms with one unsigned int per channel. Maximum bin content = 4294967295
+// The counts are stored as the bit patterns of the ints in the TArrayI base,
+// so the existing TArrayI streamer round-trips them unchanged.
+//______________________________________________________________________________
+
+ClassImp(TH1UI);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor.
+
+TH1UI::TH1UI()
+{
+   fDimension = 1;
+   SetBinsLength(3);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a 1-Dim histogram with fix bins of type unsigned integer
+/// (see TH1::TH1 for explanation of parameters)
+
+TH1UI::TH1UI(const char *name,const char *title,Int_t nbins,Double_t xlow,Double_t xup)
+: TH1(name,title,nbins,xlow,xup)
+{
+   fDimension = 1;
+   TArrayI::Set(fNcells);
+
+   if (xlow >= xup) SetBuffer(fgBufferSize);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a 1-Dim histogram with variable bins of type unsigned integer
+/// (see TH1::TH1 for explanation of parameters)
+
+TH1UI::TH1UI(const char *name,const char *title,Int_t nbins,const Float_t *xbins)
+: TH1(name,title,nbins,xbins)
+{
+   fDimension = 1;
+   TArrayI::Set(fNcells);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a 1-Dim histogram with variable bins of type unsigned integer
+/// (see TH1::TH1 for explanation of parameters)
+
+TH1UI::TH1UI(const char *name,const char *title,Int_t nbins,const Double_t *xbins)
+: TH1(name,title,nbins,xbins)
+{
+   fDimension = 1;
+   TArrayI::Set(fNcells);
+   if (fgDefaultSumw2) Sumw2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor.
+
+TH1UI::~TH1UI()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy constructor.
+/// The list of functions is not copied. (Use Clone() if needed)
+
+TH1UI::TH1UI(const TH1UI &h1ui) : TH1(), TArrayI()
+{
+   h1ui.TH1UI::Copy(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment bin content by 1.
+/// The content saturates at 4294967295 instead of overflowing.
+/// Passing an out-of-range bin leads to undefined behavior
+
+void TH1UI::AddBinContent(Int_t bin)
+{
+   const UInt_t val = UInt_t(fArray[bin]);
+   if (val < 4294967295u) fArray[bin] = Int_t(val + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment bin content by w.
+/// \warning The value of w is cast to `Long64_t` before being added.
+/// The content is clamped to the range [0, 4294967295].
+/// Passing an out-of-range bin leads to undefined behavior
+
+void TH1UI::AddBinContent(Int_t bin, Double_t w)
+{
+   Long64_t newval = Long64_t(UInt_t(fArray[bin])) + Long64_t(w);
+   if (newval < 0) newval = 0;
+   if (newval > 4294967295ll) newval = 4294967295ll;
+   fArray[bin] = Int_t(UInt_t(newval));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy this to newth1
+
+void TH1UI::Copy(TObject &newth1) const
+{
+   TH1::Copy(newth1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reset.
+
+void TH1UI::Reset(Option_t *option)
+{
+   TH1::Reset(option);
+   TArrayI::Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set total number of bins including under/overflow
+/// Reallocate bin contents array
+
+void TH1UI::SetBinsLength(Int_t n)
+{
+   if (n < 0) n = fXaxis.GetNbins() + 2;
+   fNcells = n;
+   TArrayI::Set(n);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator =
+
+TH1UI& TH1UI::operator=(const TH1UI &h1)
+{
+   if (this != &h1)
+      h1.TH1UI::Copy(*this);
+   return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator *
+
+TH1UI operator*(Double_t c1, const TH1UI &h1)
+{
+   TH1UI hnew = h1;
+   hnew.Scale(c1);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator +
+
+TH1UI operator+(const TH1UI &h1, const TH1UI &h2)
+{
+   TH1UI hnew = h1;
+   hnew.Add(&h2,1);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator -
+
+TH1UI operator-(const TH1UI &h1, const TH1UI &h2)
+{
+   TH1UI hnew = h1;
+   hnew.Add(&h2,-1);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator *
+
+TH1UI operator*(const TH1UI &h1, const TH1UI &h2)
+{
+   TH1UI hnew = h1;
+   hnew.Multiply(&h2);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Operator /
+
+TH1UI operator/(const TH1UI &h1, const TH1UI &h2)
+{
+   TH1UI hnew = h1;
+   hnew.Divide(&h2);
+   hnew.SetDirectory(nullptr);
+   return hnew;
+}
+
 //______________________________________________________________________________
 //                     TH1L methods
 // TH1L : histograms with one long64 per channel.    Maximum bin content = 9223372036854775807
@@ -0,0 +1,270 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class THShardedFill
+    \ingroup Histograms
+Fill one shared histogram from many threads without per-thread copies.
+
+Every filling thread owns a small shard which records (bin, weight) pairs
+and the running statistics sums. When a shard reaches its capacity it is
+scattered into the shared bin array: the pending pairs are sorted by bin
+and added under striped locks, each stripe guarding a contiguous range of
+bins, so shards working on different regions of the histogram do not
+contend. The memory cost per thread is the shard buffer, independent of
+the number of bins, which is what makes this preferable to
+ROOT::TThreadedObject copies for large sets of histograms.
+
+The intended use mirrors TThreadedObject: obtain the calling thread's
+shard once, fill through it in the hot loop, and call
+THShardedFill::Flush() (done automatically on destruction) before the
+histogram is drawn, written or otherwise read:
+
+~~~{.cpp}
+   TH1D h("h", "h", 1000, 0., 1.);
+   THShardedFill sharded(h);
+   auto work = [&sharded](const std::vector<double> &vals) {
+      auto shard = sharded.GetShard();
+      for (auto v : vals)
+         shard->Fill(v);
+   };
+   // ... run work on several threads ...
+   sharded.Flush();
+~~~
+
+The filled histogram accumulates the same multiset of (bin, weight)
+contributions as serial TH1::Fill calls, but in batch order rather than
+fill order. Bin contents, errors and the statistics sums can therefore
+differ from a serial reference by floating-point rounding of the
+reordered summation (and between runs, depending on how the scatters
+interleave); the number of entries and unit-weight counts are exact.
+
+Axes with labels or automatic extension are not supported: the bin
+numbering must stay fixed while shards hold bin indices. Such histograms
+are rejected by the constructor: IsValid() returns false and all fills
+are ignored.
+*/
+
+#include "THShardedFill.h"
+
+#include "TError.h"
+#include "TH1.h"
+#include "TH2.h"
+
+#include <algorithm>
+
+ClassImp(THShardedFill);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare concurrent filling of `hist`. `nstripes` is the number of locks
+/// striped over the bin range and `buffersize` the number of pending fills a
+/// shard accumulates before it is scattered into the bin contents.
+
+THShardedFill::THShardedFill(TH1 &hist, UInt_t nstripes, UInt_t buffersize)
+   : fHist(hist), fNcells(hist.GetNcells()), fNstripes(std::max(nstripes, 1u)),
+     fBufferSize(std::max(buffersize, 1u)), fStatOverflows(hist.GetStatOverflowsBehaviour())
+{
+   if (fNstripes > (UInt_t)fNcells)
+      fNstripes = fNcells;
+   fStripes.reset(new std::mutex[fNstripes]);
+   if (fHist.fBuffer)
+      fHist.BufferEmpty(1);
+   if (fHist.GetXaxis()->GetLabels() || (fHist.GetDimension() > 1 && fHist.GetYaxis()->GetLabels())) {
+      ::Error("THShardedFill", "axes of %s have labels, the bin numbering must stay fixed", fHist.GetName());
+      fValid = kFALSE;
+   }
+   if (fHist.GetXaxis()->CanExtend() || (fHist.GetDimension() > 1 && fHist.GetYaxis()->CanExtend())) {
+      ::Error("THShardedFill", "axes of %s are extendable, the bin numbering must stay fixed", fHist.GetName());
+      fValid = kFALSE;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Scatter whatever the shards still hold into the histogram.
+
+THShardedFill::~THShardedFill()
+{
+   Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the shard of the calling thread, creating it on first use. The
+/// lookup takes a lock: cache the returned pointer outside the fill loop.
+
+THShardedFill::TShard *THShardedFill::GetShard()
+{
+   const auto tid = std::this_thread::get_id();
+   std::lock_guard<std::mutex> lg(fShardsMutex);
+   auto &shard = fShards[tid];
+   if (!shard)
+      shard.reset(new TShard(this));
+   return shard.get();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Scatter the pending fills of every shard. Must not run concurrently with
+/// fills on other threads: call it once the filling phase is over, before the
+/// histogram is read.
+
+void THShardedFill::Flush()
+{
+   std::lock_guard<std::mutex> lg(fShardsMutex);
+   for (auto &entry : fShards)
+      ScatterBatch(*entry.second);
+}
+
+THShardedFill::TShard::TShard(THShardedFill *parent) : fParent(parent)
+{
+   fBatch.reserve(parent->fBufferSize);
+   std::fill(std::begin(fStats), std::end(fStats), 0.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record one fill of a 1-d histogram. Only the calling thread may use this
+/// shard.
+
+void THShardedFill::TShard::Fill(Double_t x, Double_t w)
+{
+   if (!fParent->fValid)
+      return;
+   TH1 &h = fParent->fHist;
+   const Int_t bin = h.GetXaxis()->FindFixBin(x);
+   fBatch.emplace_back(bin, w);
+   ++fNfills;
+   if (w != 1.0)
+      fHasWeights = kTRUE;
+   const Bool_t inrange = bin > 0 && bin <= h.GetXaxis()->GetNbins();
+   if (inrange || fParent->fStatOverflows) {
+      fStats[0] += w;
+      fStats[1] += w * w;
+      fStats[2] += w * x;
+      fStats[3] += w * x * x;
+   }
+   if (fBatch.size() >= fParent->fBufferSize)
+      Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record one fill of a 2-d histogram. Only the calling thread may use this
+/// shard.
+
+void THShardedFill::TShard::Fill2D(Double_t x, Double_t y, Double_t w)
+{
+   if (!fParent->fValid)
+      return;
+   TH1 &h = fParent->fHist;
+   if (h.GetDimension() != 2) {
+      ::Error("THShardedFill::TShard::Fill2D", "histogram %s is not 2-dimensional", h.GetName());
+      return;
+   }
+   const Int_t binx = h.GetXaxis()->FindFixBin(x);
+   const Int_t biny = h.GetYaxis()->FindFixBin(y);
+   const Int_t bin = binx + (h.GetXaxis()->GetNbins() + 2) * biny;
+   fBatch.emplace_back(bin, w);
+   ++fNfills;
+   if (w != 1.0)
+      fHasWeights = kTRUE;
+   const Bool_t inx = binx > 0 && binx <= h.GetXaxis()->GetNbins();
+   const Bool_t iny = biny > 0 && biny <= h.GetYaxis()->GetNbins();
+   if ((inx && iny) || fParent->fStatOverflows) {
+      fStats[0] += w;
+      fStats[1] += w * w;
+      fStats[2] += w * x;
+      fStats[3] += w * x * x;
+      fStats[4] += w * y;
+      fStats[5] += w * y * y;
+      fStats[6] += w * x * y;
+   }
+   if (fBatch.size() >= fParent->fBufferSize)
+      Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Scatter this shard's pending fills into the histogram.
+
+void THShardedFill::TShard::Flush()
+{
+   fParent->ScatterBatch(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the shard's pending (bin, weight) pairs to the bin contents under the
+/// stripe locks and fold its statistics sums into the histogram.
+
+void THShardedFill::ScatterBatch(TShard &shard)
+{
+   if (!fValid || !shard.fNfills)
+      return;
+
+   // A weight different from one seen for the first time: create the Sumw2
+   // array from the current contents with every stripe held, so no other
+   // shard is scattering meanwhile. All fills scattered so far carried unit
+   // weights, which makes the contents the correct squared sums. Since the
+   // activation only ever happens with all stripes held, reading the Sumw2
+   // state under any single stripe lock is race-free.
+   if (shard.fHasWeights && !fHist.TestBit(TH1::kIsNotW)) {
+      std::unique_lock<std::mutex> first(fStripes[0]);
+      if (!fHist.GetSumw2N()) {
+         first.unlock();
+         std::vector<std::unique_lock<std::mutex>> all;
+         all.reserve(fNstripes);
+         for (UInt_t s = 0; s < fNstripes; ++s)
+            all.emplace_back(fStripes[s]);
+         if (!fHist.GetSumw2N())
+            fHist.Sumw2();
+      }
+   }
+
+   std::sort(shard.fBatch.begin(), shard.fBatch.end(),
+             [](const std::pair<Int_t, Double_t> &a, const std::pair<Int_t, Double_t> &b) {
+                return a.first < b.first;
+             });
+
+   Int_t current = -1;
+   std::unique_lock<std::mutex> lock;
+   Double_t *sumw2 = nullptr;
+   for (const auto &entry : shard.fBatch) {
+      const Int_t stripe = (Int_t)Stripe(entry.first);
+      if (stripe != current) {
+         if (lock.owns_lock())
+            lock.unlock();
+         lock = std::unique_lock<std::mutex>(fStripes[stripe]);
+         current = stripe;
+         // Sumw2 can be activated by another shard between our per-stripe
+         // sections (activation holds all stripes), so the state must be
+         // re-read each time a stripe lock is (re-)acquired: it is stable
+         // only while we hold one.
+         sumw2 = fHist.GetSumw2N() > 0 ? fHist.GetSumw2()->fArray : nullptr;
+      }
+      fHist.AddBinContent(entry.first, entry.second);
+      if (sumw2)
+         sumw2[entry.first] += entry.second * entry.second;
+   }
+   if (lock.owns_lock())
+      lock.unlock();
+
+   {
+      std::lock_guard<std::mutex> lg(fStatsMutex);
+      fHist.fTsumw += shard.fStats[0];
+      fHist.fTsumw2 += shard.fStats[1];
+      fHist.fTsumwx += shard.fStats[2];
+      fHist.fTsumwx2 += shard.fStats[3];
+      if (auto *h2 = dynamic_cast<TH2 *>(&fHist)) {
+         h2->fTsumwy += shard.fStats[4];
+         h2->fTsumwy2 += shard.fStats[5];
+         h2->fTsumwxy += shard.fStats[6];
+      }
+      fHist.fEntries += shard.fNfills;
+   }
+
+   shard.fBatch.clear();
+   std::fill(std::begin(shard.fStats), std::end(shard.fStats), 0.);
+   shard.fNfills = 0;
+   shard.fHasWeights = kFALSE;
+}
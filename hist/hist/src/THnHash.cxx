@@ -0,0 +1,418 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THnHash.h"
+
+#include "TAxis.h"
+#include "TError.h"
+#include "TMath.h"
+
+#include <cstring>
+
+namespace {
+
+   /// Iterate over the filled bins of a THnHash in fill order.
+   class THnHashBinIter: public ROOT::Internal::THnBaseBinIter {
+   public:
+      THnHashBinIter(Bool_t respectAxisRange, const THnHash* hist):
+         ROOT::Internal::THnBaseBinIter(respectAxisRange), fHist(hist),
+         fNbins(hist->GetNbins()), fIndex(-1) {
+         fCoord = new Int_t[hist->GetNdimensions()];
+         fCoord[0] = -1;
+      }
+      ~THnHashBinIter() override { delete [] fCoord; }
+
+      Int_t GetCoord(Int_t dim) const override {
+         if (fCoord[0] == -1)
+            fHist->GetBinContent(fIndex, fCoord);
+         return fCoord[dim];
+      }
+
+      Long64_t Next(Int_t* coord = nullptr) override {
+         if (!fHist) return -1;
+         fCoord[0] = -1;
+         Int_t* useCoordBuf = fCoord;
+         if (coord) {
+            useCoordBuf = coord;
+            coord[0] = -1;
+         }
+         do {
+            ++fIndex;
+            if (fIndex >= fNbins) {
+               fHist = nullptr;
+               return -1;
+            }
+            if (RespectsAxisRange())
+               fHist->GetBinContent(fIndex, useCoordBuf);
+         } while (RespectsAxisRange()
+                  && !fHist->IsInRange(useCoordBuf)
+                  && (fHaveSkippedBin = kTRUE /* assignment! */));
+         if (coord && coord[0] == -1) {
+            if (fCoord[0] == -1)
+               fHist->GetBinContent(fIndex, coord);
+            else
+               memcpy(coord, fCoord, fHist->GetNdimensions() * sizeof(Int_t));
+         }
+         return fIndex;
+      }
+
+   private:
+      THnHashBinIter(const THnHashBinIter&) = delete;
+      THnHashBinIter& operator=(const THnHashBinIter&) = delete;
+
+      const THnHash* fHist;
+      Int_t* fCoord;   // coord buffer for fIndex; fCoord[0] == -1 if not yet calculated
+      Long64_t fNbins; // number of bins to iterate over
+      Long64_t fIndex; // current bin index
+   };
+
+   /// Finalizer of the splitmix64 generator: a cheap, well-mixing 64 bit hash.
+   inline ULong64_t HashKey(ULong64_t key)
+   {
+      key ^= key >> 30;
+      key *= 0xbf58476d1ce4e5b9ULL;
+      key ^= key >> 27;
+      key *= 0x94d049bb133111ebULL;
+      key ^= key >> 31;
+      return key;
+   }
+
+} // anonymous namespace
+
+
+/** \class THnHash
+    \ingroup Hist
+
+Sparse n-dimensional histogram with flat open-addressing storage.
+
+THnHash fills the same role as THnSparse, but stores its filled bins in a
+flat, open-addressing hash table keyed by the bin coordinates packed into
+one 64 bit word, instead of THnSparse's per-chunk coordinate buffers
+behind a TExMap of hashes with collision chains. A bin lookup is one hash
+and a short linear probe over a contiguous array, with no pointer chasing
+and no per-bin heap objects; the overhead per filled bin is the packed
+key, the table slot and the content itself. Bin content lives in chunked
+arenas so the bin indices handed out (fill order, as for THnSparse) stay
+valid while the table grows.
+
+The bin coordinates of one tuple must fit a 64 bit key:
+the sum over all dimensions of ceil(log2(nbins + 2)) may not exceed 64,
+e.g. ten dimensions of up to 62 bins each. Use THnSparse when they do not.
+
+THnHash derives from THnBase like THn and THnSparse, so projections,
+Add/Merge/Scale/Divide, fitting and the THnIter interface work unchanged.
+Bin content is held as Double_t.
+*/
+
+ClassImp(THnHash);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Construct a THnHash with "dim" dimensions,
+/// with chunksize as the size of the content chunks.
+/// "nbins" holds the number of bins for each dimension;
+/// "xmin" and "xmax" the minimal and maximal value for each dimension.
+/// The arrays "xmin" and "xmax" can be NULL; in that case SetBinEdges()
+/// must be called for each dimension.
+
+THnHash::THnHash(const char* name, const char* title, Int_t dim,
+                 const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
+                 Int_t chunksize):
+   THnBase(name, title, dim, nbins, xmin, xmax)
+{
+   InitStorage(const_cast<Int_t*>(nbins), chunksize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Construct a THnHash with chunksize as the size of the content chunks.
+/// "axes" is a vector of TAxis, its size sets the number of dimensions.
+
+THnHash::THnHash(const char* name, const char* title,
+                 const std::vector<TAxis>& axes,
+                 Int_t chunksize):
+   THnBase(name, title, axes)
+{
+   const size_t dim = axes.size();
+   std::vector<Int_t> nbins(dim);
+   for (size_t i = 0; i < dim; ++i)
+      nbins[i] = axes.at(i).GetNbins();
+   InitStorage(nbins.data(), chunksize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destruct a THnHash
+
+THnHash::~THnHash() = default;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Initialize the storage of a histogram created via Init()
+
+void THnHash::InitStorage(Int_t* nbins, Int_t chunkSize)
+{
+   fChunkSize = chunkSize > 0 ? chunkSize : 1024 * 16;
+   fShift.resize(fNdimensions);
+   Int_t bits = 0;
+   for (Int_t d = 0; d < fNdimensions; ++d) {
+      fShift[d] = bits;
+      // coordinates run from 0 (underflow) to nbins + 1 (overflow)
+      Int_t need = 1;
+      while ((1LL << need) < (Long64_t)nbins[d] + 2)
+         ++need;
+      bits += need;
+   }
+   if (bits > 64) {
+      Error("InitStorage",
+            "coordinates of %d dimensions need %d bits and do not fit a 64 bit key; use THnSparse instead",
+            fNdimensions, bits);
+      fShift.clear();
+   }
+   fCoordBuf.resize(fNdimensions);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pack the bin coordinates into the 64 bit key.
+
+ULong64_t THnHash::PackCoord(const Int_t* coord) const
+{
+   ULong64_t key = 0;
+   for (Int_t d = 0; d < fNdimensions; ++d)
+      key |= ((ULong64_t)(UInt_t)coord[d]) << fShift[d];
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Restore the bin coordinates from the 64 bit key.
+
+void THnHash::UnpackKey(ULong64_t key, Int_t* coord) const
+{
+   for (Int_t d = fNdimensions - 1; d >= 0; --d) {
+      coord[d] = (Int_t)(key >> fShift[d]);
+      key &= ((ULong64_t)1 << fShift[d]) - 1;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rehash the table to the given power-of-two size.
+
+void THnHash::GrowTable(ULong64_t newSize)
+{
+   fTable.assign(newSize, 0);
+   fTableMask = newSize - 1;
+   for (Long64_t idx = 0; idx < fFilledBins; ++idx) {
+      ULong64_t slot = HashKey(fKeys[idx]) & fTableMask;
+      while (fTable[slot])
+         slot = (slot + 1) & fTableMask;
+      fTable[slot] = idx + 1;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// We have been streamed (or copied); rebuild the transient table.
+
+void THnHash::FillTable()
+{
+   ULong64_t size = 1024;
+   while (3 * size < 4 * (ULong64_t)(fFilledBins + 1))
+      size *= 2;
+   GrowTable(size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make room for nbins filled bins: pre-size the table so the insertions do
+/// not rehash.
+
+void THnHash::Reserve(Long64_t nbins)
+{
+   fKeys.reserve(nbins);
+   ULong64_t size = fTable.empty() ? 1024 : fTableMask + 1;
+   while (3 * size < 4 * (ULong64_t)(nbins + 1))
+      size *= 2;
+   if (fTable.empty() || size != fTableMask + 1)
+      GrowTable(size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the bin with the given packed coordinates.
+/// If it doesn't exist then return -1, or allocate a new bin if allocate is set.
+
+Long64_t THnHash::GetBinIndexForKey(ULong64_t key, Bool_t allocate)
+{
+   if (fShift.empty())
+      return -1;
+   if (fTable.empty())
+      FillTable();
+   ULong64_t slot = HashKey(key) & fTableMask;
+   while (fTable[slot]) {
+      const Long64_t idx = fTable[slot] - 1;
+      if (fKeys[idx] == key)
+         return idx;
+      slot = (slot + 1) & fTableMask;
+   }
+   if (!allocate)
+      return -1;
+
+   const Long64_t idx = fFilledBins++;
+   fKeys.push_back(key);
+   if (idx % fChunkSize == 0) {
+      fContent.emplace_back(fChunkSize, 0.);
+      if (GetCalculateErrors())
+         fSumw2.emplace_back(fChunkSize, 0.);
+   }
+   fTable[slot] = idx + 1;
+   // grow at 3/4 load
+   if (4 * (ULong64_t)fFilledBins > 3 * (fTableMask + 1))
+      GrowTable(2 * (fTableMask + 1));
+   return idx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the bin index for the n dimensional tuple x,
+/// allocate one if it doesn't exist yet and "allocate" is true.
+
+Long64_t THnHash::GetBin(const Double_t* x, Bool_t allocate /* = kTRUE */)
+{
+   if ((Int_t)fCoordBuf.size() < fNdimensions)
+      fCoordBuf.resize(fNdimensions); // transient, not restored by streaming
+   for (Int_t i = 0; i < fNdimensions; ++i)
+      fCoordBuf[i] = GetAxis(i)->FindBin(x[i]);
+   return GetBinIndexForKey(PackCoord(fCoordBuf.data()), allocate);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the bin index for the n dimensional tuple addressed by "name",
+/// allocate one if it doesn't exist yet and "allocate" is true.
+
+Long64_t THnHash::GetBin(const char* name[], Bool_t allocate /* = kTRUE */)
+{
+   if ((Int_t)fCoordBuf.size() < fNdimensions)
+      fCoordBuf.resize(fNdimensions);
+   for (Int_t i = 0; i < fNdimensions; ++i)
+      fCoordBuf[i] = GetAxis(i)->FindBin(name[i]);
+   return GetBinIndexForKey(PackCoord(fCoordBuf.data()), allocate);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the bin index for the n dimensional coordinates coord,
+/// allocate one if it doesn't exist yet and "allocate" is true.
+
+Long64_t THnHash::GetBin(const Int_t* coord, Bool_t allocate /*= kTRUE*/)
+{
+   return GetBinIndexForKey(PackCoord(coord), allocate);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the content of the filled bin number "idx".
+/// If coord is non-null, it will contain the bin's coordinates for each axis
+/// that correspond to the bin.
+
+Double_t THnHash::GetBinContent(Long64_t idx, Int_t* coord /* = 0 */) const
+{
+   if (idx >= 0 && idx < fFilledBins) {
+      if (coord)
+         UnpackKey(fKeys[idx], coord);
+      return fContent[idx / fChunkSize][idx % fChunkSize];
+   }
+   if (coord)
+      memset(coord, -1, sizeof(Int_t) * fNdimensions);
+   return 0.;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get square of the error of bin addressed by linidx as
+/// \f$\sum weight^{2}\f$
+/// If errors are not enabled (via Sumw2() or CalculateErrors())
+/// return contents.
+
+Double_t THnHash::GetBinError2(Long64_t linidx) const
+{
+   if (!GetCalculateErrors())
+      return GetBinContent(linidx);
+   if (linidx < 0 || linidx >= fFilledBins)
+      return 0.;
+   return fSumw2[linidx / fChunkSize][linidx % fChunkSize];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create an iterator over all filled bins of a THnHash.
+/// Use THnIter instead.
+
+ROOT::Internal::THnBaseBinIter* THnHash::CreateIter(Bool_t respectAxisRange) const
+{
+   return new THnHashBinIter(respectAxisRange, this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set content of bin with index "bin" to "v"
+
+void THnHash::SetBinContent(Long64_t bin, Double_t v)
+{
+   if (bin < 0 || bin >= fFilledBins)
+      return;
+   fContent[bin / fChunkSize][bin % fChunkSize] = v;
+   ++fEntries;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set error of bin with index "bin" to "e", enable errors if needed
+
+void THnHash::SetBinError2(Long64_t bin, Double_t e2)
+{
+   if (!GetCalculateErrors())
+      Sumw2();
+   if (bin < 0 || bin >= fFilledBins)
+      return;
+   fSumw2[bin / fChunkSize][bin % fChunkSize] = e2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add "v" to the content of bin with index "bin"
+
+void THnHash::AddBinContent(Long64_t bin, Double_t v)
+{
+   if (bin < 0 || bin >= fFilledBins)
+      return;
+   fContent[bin / fChunkSize][bin % fChunkSize] += v;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add "e2" to error of bin with index "bin", enable errors if needed
+
+void THnHash::AddBinError2(Long64_t bin, Double_t e2)
+{
+   if (!GetCalculateErrors())
+      Sumw2();
+   if (bin < 0 || bin >= fFilledBins)
+      return;
+   fSumw2[bin / fChunkSize][bin % fChunkSize] += e2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable calculation of errors
+
+void THnHash::Sumw2()
+{
+   if (GetCalculateErrors())
+      return;
+   fTsumw2 = 0.;
+   fSumw2 = fContent; // squared sums of the unit weights filled so far
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Clear the histogram
+
+void THnHash::Reset(Option_t *option /*= ""*/)
+{
+   fFilledBins = 0;
+   fKeys.clear();
+   fContent.clear();
+   fSumw2.clear();
+   fTable.clear();
+   fTableMask = 0;
+   ResetBase(option);
+}
@@ -43,6 +43,10 @@
 #include "TH1.h"
 #include "TVirtualPad.h"
 #include "TKDE.h"
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ClassImp(TKDE);
 
@@ -70,7 +74,7 @@ TKDE::TKDE() :
    fUseBins(false), fNewData(false), fUseMinMaxFromData(false),
    fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0),
    fMean(0.),fSigma(0.), fSigmaRob(0.), fXMin(0.), fXMax(0.),
-   fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0)
+   fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0), fEvalTolerance(0.)
 {
 }
 
@@ -111,6 +115,7 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fAdaptiveBandwidthFactor = 1.;
    fRho = rho;
    fWeightSize = 0;
+   fEvalTolerance = 0;
    fCanonicalBandwidths = std::vector<Double_t>(kTotalKernels, 0.0);
    fKernelSigmas2 = std::vector<Double_t>(kTotalKernels, -1.0);
    fSettedOptions = std::vector<Bool_t>(4, kFALSE);
@@ -389,6 +394,22 @@ void TKDE::SetRange(Double_t xMin, Double_t xMax) {
    fKernel.reset();
 }
 
+void TKDE::SetEvalTolerance(Double_t tol) {
+   // Sets the relative tolerance used to truncate the kernel sums when evaluating the density.
+   // Data points whose kernel contribution relative to the kernel peak is below the tolerance are
+   // skipped, turning each evaluation from a scan of the full data set into a scan of a window
+   // around the evaluation point. The truncation requires sorted data and is therefore applied only
+   // in the binned mode and when no boundary asymmetry (mirroring) correction is used; in all other
+   // configurations the full sums are evaluated.
+   // For the finite-support internal kernels (Epanechnikov, Biweight, CosineArch) any non-zero
+   // tolerance gives exact results. A value of zero (the default) disables the truncation.
+   if (tol < 0) {
+      Error("SetEvalTolerance", "Tolerance cannot be negative! Present tolerance value remains the same.");
+      return;
+   }
+   fEvalTolerance = tol;
+}
+
 // private methods
 
 void TKDE::SetUseBins() {
@@ -756,6 +777,45 @@ Double_t TKDE::operator()(Double_t x) const {
    return (*fKernel)(x);
 }
 
+std::vector<Double_t> TKDE::GetValues(UInt_t npoints, Double_t xMin, Double_t xMax) const {
+   // Returns the kernel density estimate evaluated on a grid of npoints equidistant points covering
+   // the given range (the data range when xMin >= xMax, the defaults). The grid points are
+   // independent and are evaluated in parallel when implicit multi-threading is enabled.
+   std::vector<Double_t> values(npoints);
+   if (npoints == 0) return values;
+   if (xMin >= xMax) { xMin = fXMin; xMax = fXMax; }
+   if (fNewData) (const_cast<TKDE*>(this))->InitFromNewData();
+   if (!fKernel) {
+      (const_cast<TKDE*>(this))->ReInit();
+      // in case of failed re-initialization
+      if (!fKernel) {
+         values.assign(npoints, TMath::QuietNaN());
+         return values;
+      }
+   }
+   Double_t dx = (npoints > 1) ? (xMax - xMin) / (npoints - 1) : 0.;
+   auto evalRange = [&](UInt_t begin, UInt_t end) {
+      for (UInt_t i = begin; i < end; ++i)
+         values[i] = (*fKernel)(xMin + i * dx);
+   };
+#ifdef R__USE_IMT
+   // each point is a full kernel sum, so already short grids amortize the task overhead
+   constexpr UInt_t kPointsPerTask = 64;
+   if (ROOT::IsImplicitMTEnabled() && npoints > kPointsPerTask) {
+      std::vector<std::pair<UInt_t, UInt_t>> ranges;
+      ranges.reserve((npoints + kPointsPerTask - 1) / kPointsPerTask);
+      for (UInt_t begin = 0; begin < npoints; begin += kPointsPerTask)
+         ranges.emplace_back(begin, std::min(npoints, begin + kPointsPerTask));
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&evalRange](const std::pair<UInt_t, UInt_t> &range) { evalRange(range.first, range.second); },
+                   ranges);
+      return values;
+   }
+#endif
+   evalRange(0, npoints);
+   return values;
+}
+
 Double_t TKDE::GetMean() const {
    // return the mean of the data
    if (fNewData) (const_cast<TKDE*>(this))->InitFromNewData();
@@ -778,7 +838,8 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 // Internal class constructor
 fKDE(kde),
 fNWeights(kde->fData.size()),
-fWeights(1, weight)
+fWeights(1, weight),
+fMaxWeight(weight)
 {}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
@@ -816,6 +877,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    fWeights.resize(n);
    transform(weights.begin(), weights.end(), fWeights.begin(),
              std::bind(std::multiplies<Double_t>(), std::placeholders::_1, fKDE->fAdaptiveBandwidthFactor));
+   fMaxWeight = *std::max_element(fWeights.begin(), fWeights.end());
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
 }
 
@@ -1031,7 +1093,23 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
    // in case of non-adaptive fWeights is a vector of size 1
    Bool_t hasAdaptiveWeights = (fWeights.size() == n);
    Double_t invWeight = (!hasAdaptiveWeights) ? 1. / fWeights[0] : 0;
-   for (UInt_t i = 0; i < n; ++i) {
+   // approximate evaluation: sum only the data points whose contribution can exceed the requested
+   // tolerance. The binned data are sorted, so the window can be found with a binary search.
+   // The conservative window uses the largest bandwidth, hence every skipped contribution is below
+   // tolerance also for adaptive weights. Not used with the asymmetry (mirroring) corrections since
+   // the reflected points fall outside the window.
+   UInt_t iFirst = 0;
+   UInt_t iLast = n;
+   if (fKDE->fEvalTolerance > 0 && fKDE->fUseBins && !fKDE->fAsymLeft && !fKDE->fAsymRight &&
+       fKDE->fKernelType != kUserDefined && fMaxWeight > 0) {
+      // the non-Gaussian internal kernels vanish for |t| >= 1; the Gaussian kernel drops below
+      // tolerance times its peak value for |t| > sqrt(-2 log(tol))
+      Double_t tCut = (fKDE->fKernelType == kGaussian) ? std::sqrt(std::max(0., -2. * std::log(fKDE->fEvalTolerance))) : 1.0;
+      Double_t xCut = tCut * fMaxWeight;
+      iFirst = std::lower_bound(fKDE->fData.begin(), fKDE->fData.end(), x - xCut) - fKDE->fData.begin();
+      iLast = std::upper_bound(fKDE->fData.begin() + iFirst, fKDE->fData.end(), x + xCut) - fKDE->fData.begin();
+   }
+   for (UInt_t i = iFirst; i < iLast; ++i) {
       Double_t binCount = (useCount) ? fKDE->fBinCount[i] : 1.0;
       // uncommenting following line slows down so keep computation for
       // zero bincounts
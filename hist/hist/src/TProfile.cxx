@@ -793,29 +793,49 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
          return;
    }
 
+   // hoist the loop-invariant decisions and accumulate the global statistics
+   // in locals, so the loop body only touches the per-bin accumulator arrays
+   const Bool_t checkRange = (fYmin != fYmax);
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   // enable the storage of the sum of squares of weights upfront if any
+   // weight differs from unity, instead of testing entry by entry
+   // (must be done before accumulating the entries)
+   if (w && !fBinSumw2.fN && !TestBit(TH1::kIsNotW)) {
+      for (i=ifirst;i<ntimes;i+=stride) {
+         if (w[i] != 1.0) { Sumw2(); break; }
+      }
+   }
+   Double_t entries = 0;
+   Double_t tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0, tsumwy = 0, tsumwy2 = 0;
    for (i=ifirst;i<ntimes;i+=stride) {
-      if (fYmin != fYmax) {
+      if (checkRange) {
          if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
       }
 
       Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
-      fEntries++;
+      entries++;
       bin =fXaxis.FindBin(x[i]);
       AddBinContent(bin, u*y[i]);
       fSumw2.fArray[bin] += u*y[i]*y[i];
-      if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
       if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
       fBinEntries.fArray[bin] += u;
       if (bin == 0 || bin > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         if (!statOverflows) continue;
       }
-      fTsumw   += u;
-      fTsumw2  += u*u;
-      fTsumwx  += u*x[i];
-      fTsumwx2 += u*x[i]*x[i];
-      fTsumwy  += u*y[i];
-      fTsumwy2 += u*y[i]*y[i];
-   }
+      tsumw   += u;
+      tsumw2  += u*u;
+      tsumwx  += u*x[i];
+      tsumwx2 += u*x[i]*x[i];
+      tsumwy  += u*y[i];
+      tsumwy2 += u*y[i]*y[i];
+   }
+   fEntries += entries;
+   fTsumw   += tsumw;
+   fTsumw2  += tsumw2;
+   fTsumwx  += tsumwx;
+   fTsumwx2 += tsumwx2;
+   fTsumwy  += tsumwy;
+   fTsumwy2 += tsumwy2;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
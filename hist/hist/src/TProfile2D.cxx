@@ -685,6 +685,91 @@ Int_t TProfile2D::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
    fTsumwz2 += u * z * z;
    return bin;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a 2-D Profile histogram with weights.
+///
+/// Bulk counterpart of Fill(x,y,z,w): processes `ntimes` entries in one call,
+/// evaluating the loop-invariant decisions once and accumulating the global
+/// statistics in locals, so the loop body only touches the per-bin
+/// accumulator arrays. If `w` is a null pointer all entries have weight 1.
+
+void TProfile2D::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride)
+{
+   Int_t bin, binx, biny, i;
+   ntimes *= stride;
+   Int_t ifirst = 0;
+   //If a buffer is activated, fill buffer
+   if (fBuffer) {
+      for (i = 0; i < ntimes; i += stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         if (w) BufferFill(x[i], y[i], z[i], w[i]);
+         else   BufferFill(x[i], y[i], z[i], 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && fBuffer == nullptr)
+         ifirst = i; // start from i
+      else
+         return;
+   }
+
+   const Bool_t checkRange = (fZmin != fZmax);
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   // enable the storage of the sum of squares of weights upfront if any
+   // weight differs from unity, instead of testing entry by entry
+   // (must be done before accumulating the entries)
+   if (w && !fBinSumw2.fN && !TestBit(TH1::kIsNotW)) {
+      for (i = ifirst; i < ntimes; i += stride) {
+         if (w[i] != 1.0) { Sumw2(); break; }
+      }
+   }
+   Double_t entries = 0;
+   Double_t tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0, tsumwy = 0, tsumwy2 = 0;
+   Double_t tsumwxy = 0, tsumwz = 0, tsumwz2 = 0;
+   for (i = ifirst; i < ntimes; i += stride) {
+      if (checkRange) {
+         if (z[i] < fZmin || z[i] > fZmax || TMath::IsNaN(z[i])) continue;
+      }
+
+      Double_t u = (w) ? w[i] : 1;
+      entries++;
+      binx = fXaxis.FindBin(x[i]);
+      biny = fYaxis.FindBin(y[i]);
+      if (binx < 0 || biny < 0) continue;
+      bin = biny * (fXaxis.GetNbins() + 2) + binx;
+      AddBinContent(bin, u * z[i]);
+      fSumw2.fArray[bin] += u * z[i] * z[i];
+      if (fBinSumw2.fN) fBinSumw2.fArray[bin] += u * u;
+      fBinEntries.fArray[bin] += u;
+
+      if (binx == 0 || binx > fXaxis.GetNbins()) {
+         if (!statOverflows) continue;
+      }
+      if (biny == 0 || biny > fYaxis.GetNbins()) {
+         if (!statOverflows) continue;
+      }
+      tsumw += u;
+      tsumw2 += u * u;
+      tsumwx += u * x[i];
+      tsumwx2 += u * x[i] * x[i];
+      tsumwy += u * y[i];
+      tsumwy2 += u * y[i] * y[i];
+      tsumwxy += u * x[i] * y[i];
+      tsumwz += u * z[i];
+      tsumwz2 += u * z[i] * z[i];
+   }
+   fEntries += entries;
+   fTsumw += tsumw;
+   fTsumw2 += tsumw2;
+   fTsumwx += tsumwx;
+   fTsumwx2 += tsumwx2;
+   fTsumwy += tsumwy;
+   fTsumwy2 += tsumwy2;
+   fTsumwxy += tsumwxy;
+   fTsumwz += tsumwz;
+   fTsumwz2 += tsumwz2;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill a Profile2D histogram (no weights).
 
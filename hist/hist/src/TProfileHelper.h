@@ -117,11 +117,16 @@ Bool_t TProfileHelper::Add(T* p, const TH1 *h1,  const TH1 *h2, Double_t c1, Dou
    // if p1 has not the sum of weight squared/bin stored use just the sum of weights
    if (ew1 == nullptr) ew1 = en1;
    if (ew2 == nullptr) ew2 = en2;
+   // the check on fBinSumw2 is hoisted out of the loop so that each
+   // accumulator array is combined in a tight loop the compiler can vectorize
    for (Int_t bin = 0; bin < p->fN; bin++) {
       p->fArray[bin]             = c1*cu1[bin] + c2*cu2[bin];
       p->fSumw2.fArray[bin]      = ac1*er1[bin] + ac2*er2[bin];
       p->fBinEntries.fArray[bin] = ac1*en1[bin] + ac2*en2[bin];
-      if (p->fBinSumw2.fN ) p->fBinSumw2.fArray[bin]  = ac1*ac1*ew1[bin] + ac2*ac2*ew2[bin];
+   }
+   if (p->fBinSumw2.fN) {
+      for (Int_t bin = 0; bin < p->fN; bin++)
+         p->fBinSumw2.fArray[bin] = ac1*ac1*ew1[bin] + ac2*ac2*ew2[bin];
    }
    return kTRUE;
 }
@@ -5,6 +5,8 @@
 #include "Math/QuantFuncMathCore.h"
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -400,3 +402,75 @@ TEST(TFEfficiency, ConsistencyWithTGraph)
 {
    testConsistencyWithTGraph();
 }
+
+TEST(TFEfficiency, FillN)
+{
+   gRandom->SetSeed(222);
+
+   const int nevents = 1000;
+   auto passed = std::make_unique<Bool_t[]>(nevents); // N.B. std::vector<Bool_t> has no data()
+   std::vector<Double_t> x(nevents), y(nevents), w(nevents);
+   for (int i = 0; i < nevents; ++i) {
+      x[i] = gRandom->Uniform(0., 10.);
+      y[i] = gRandom->Uniform(0., 10.);
+      w[i] = gRandom->Uniform(0.5, 1.5);
+      passed[i] = gRandom->Rndm() < 0.7;
+   }
+
+   // 1-dimensional, unweighted
+   TEfficiency bulk1("bulk1", "bulk1", 20, 0., 10.);
+   TEfficiency single1("single1", "single1", 20, 0., 10.);
+   bulk1.FillN(nevents, passed.get(), x.data());
+   for (int i = 0; i < nevents; ++i)
+      single1.Fill(passed[i], x[i]);
+   for (int bin = 0; bin < bulk1.GetTotalHistogram()->GetNcells(); ++bin) {
+      EXPECT_EQ(single1.GetTotalHistogram()->GetBinContent(bin), bulk1.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_EQ(single1.GetPassedHistogram()->GetBinContent(bin), bulk1.GetPassedHistogram()->GetBinContent(bin));
+   }
+
+   // 2-dimensional, weighted
+   TEfficiency bulk2("bulk2", "bulk2", 10, 0., 10., 10, 0., 10.);
+   TEfficiency single2("single2", "single2", 10, 0., 10., 10, 0., 10.);
+   bulk2.FillN(nevents, passed.get(), x.data(), y.data(), nullptr, w.data());
+   for (int i = 0; i < nevents; ++i)
+      single2.FillWeighted(passed[i], w[i], x[i], y[i]);
+   for (int bin = 0; bin < bulk2.GetTotalHistogram()->GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(single2.GetTotalHistogram()->GetBinContent(bin), bulk2.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(single2.GetPassedHistogram()->GetBinContent(bin),
+                       bulk2.GetPassedHistogram()->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(single2.GetTotalHistogram()->GetSumw2()->At(bin), bulk2.GetTotalHistogram()->GetSumw2()->At(bin));
+   }
+}
+
+TEST(TFEfficiency, BulkIntervals)
+{
+   gRandom->SetSeed(333);
+
+   TEfficiency eff("effbulk", "effbulk", 50, 0., 10.);
+   for (int i = 0; i < 5000; ++i) {
+      double x = gRandom->Uniform(0., 10.);
+      eff.Fill(gRandom->Rndm() < 0.1 * x, x);
+   }
+
+   const TEfficiency::EStatOption options[] = {TEfficiency::kFCP, TEfficiency::kFNormal, TEfficiency::kFWilson,
+                                               TEfficiency::kBUniform, TEfficiency::kBJeffrey};
+   for (auto statOpt : options) {
+      eff.SetStatisticOption(statOpt);
+
+      std::vector<Double_t> effVals, errLow, errUp;
+      eff.GetEfficiencyArrays(effVals, errLow, errUp);
+      ASSERT_EQ(static_cast<std::size_t>(eff.GetTotalHistogram()->GetNcells()), effVals.size());
+
+      for (int bin = 0; bin < eff.GetTotalHistogram()->GetNcells(); ++bin) {
+         EXPECT_DOUBLE_EQ(eff.GetEfficiency(bin), effVals[bin]);
+         EXPECT_DOUBLE_EQ(eff.GetEfficiencyErrorLow(bin), errLow[bin]);
+         EXPECT_DOUBLE_EQ(eff.GetEfficiencyErrorUp(bin), errUp[bin]);
+
+         Double_t e, el, eu;
+         eff.GetEfficiencyWithError(bin, e, el, eu);
+         EXPECT_DOUBLE_EQ(effVals[bin], e);
+         EXPECT_DOUBLE_EQ(errLow[bin], el);
+         EXPECT_DOUBLE_EQ(errUp[bin], eu);
+      }
+   }
+}
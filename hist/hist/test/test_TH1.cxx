@@ -5,6 +5,7 @@
 #include "TH3.h"
 #include "TH1F.h"
 #include "THLimitsFinder.h"
+#include "TROOT.h"
 
 #include <cmath>
 #include <cstddef>
@@ -299,3 +300,148 @@ TEST(TH1, SetBufferedSumw2)
    EXPECT_FLOAT_EQ(h1.GetBinContent(1), Entries * Weight);
    EXPECT_FLOAT_EQ(h1.GetBinError(1), std::sqrt(Entries * Weight * Weight));
 }
+
+// FillN takes a batched bin-lookup path for non-extendable numeric axes;
+// it must produce bit-identical contents and statistics to per-value Fill,
+// for both fixed and variable bin widths, including under/overflow and weights.
+TEST(TH1, FillNBatched)
+{
+   std::mt19937 gen(7352);
+   std::uniform_real_distribution<double> dis(-1., 11.); // spills past both axis ends
+   std::uniform_real_distribution<double> wdis(0.5, 2.);
+
+   constexpr int n = 1000;
+   std::vector<double> x(n), w(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = dis(gen);
+      w[i] = wdis(gen);
+   }
+
+   std::vector<double> edges{0., 0.5, 0.7, 1.3, 2., 4.5, 4.6, 7., 8.5, 10.};
+   TH1D hVar("hVar", "variable bins", edges.size() - 1, edges.data());
+   TH1D hVarRef("hVarRef", "variable bins", edges.size() - 1, edges.data());
+   TH1D hFix("hFix", "fixed bins", 25, 0., 10.);
+   TH1D hFixRef("hFixRef", "fixed bins", 25, 0., 10.);
+
+   hVar.FillN(n, x.data(), w.data());
+   hFix.FillN(n, x.data(), nullptr);
+   for (int i = 0; i < n; ++i) {
+      hVarRef.Fill(x[i], w[i]);
+      hFixRef.Fill(x[i]);
+   }
+
+   for (int bin = 0; bin <= hVar.GetNbinsX() + 1; ++bin) {
+      EXPECT_DOUBLE_EQ(hVar.GetBinContent(bin), hVarRef.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_DOUBLE_EQ(hVar.GetBinError(bin), hVarRef.GetBinError(bin)) << "bin " << bin;
+   }
+   for (int bin = 0; bin <= hFix.GetNbinsX() + 1; ++bin)
+      EXPECT_DOUBLE_EQ(hFix.GetBinContent(bin), hFixRef.GetBinContent(bin)) << "bin " << bin;
+
+   EXPECT_DOUBLE_EQ(hVar.GetEntries(), hVarRef.GetEntries());
+   double stats[4], statsRef[4];
+   hVar.GetStats(stats);
+   hVarRef.GetStats(statsRef);
+   for (int k = 0; k < 4; ++k)
+      EXPECT_DOUBLE_EQ(stats[k], statsRef[k]) << "stat " << k;
+   hFix.GetStats(stats);
+   hFixRef.GetStats(statsRef);
+   for (int k = 0; k < 4; ++k)
+      EXPECT_DOUBLE_EQ(stats[k], statsRef[k]) << "stat " << k;
+}
+
+// Bulk bin arithmetic: Add/Divide/Scale must give the same result through
+// the vectorized TH1D array kernels and through the generic virtual-accessor
+// path (TH1F), also when the loops run on the implicit MT pool.
+TEST(TH1, BulkArithmetic)
+{
+   ROOT::EnableImplicitMT(2);
+
+   // large enough to exceed the per-task chunk of the parallel bin loops
+   const Int_t nbins = 100000;
+   TH1D ha("bulk_ha", "a", nbins, 0., 1.);
+   TH1D hb("bulk_hb", "b", nbins, 0., 1.);
+   TH1F haf("bulk_haf", "af", nbins, 0., 1.);
+   ha.Sumw2();
+   hb.Sumw2();
+   haf.Sumw2();
+   for (Int_t i = 0; i <= nbins + 1; ++i) {
+      const Double_t a = 1. + 0.001 * (i % 97);
+      const Double_t b = (i % 13 == 0) ? 0. : 2. + 0.01 * (i % 31); // include empty bins
+      ha.SetBinContent(i, a);
+      ha.SetBinError(i, 0.1 + 0.001 * (i % 11));
+      hb.SetBinContent(i, b);
+      hb.SetBinError(i, 0.2 + 0.001 * (i % 7));
+      haf.SetBinContent(i, a);
+      haf.SetBinError(i, 0.1 + 0.001 * (i % 11));
+   }
+
+   // this += c1 * h1, Double_t fast path and generic path
+   TH1D hsum(ha);
+   hsum.Add(&hb, 2.5);
+   TH1F hsumf(haf);
+   hsumf.Add(&hb, 2.5);
+   for (Int_t i = 0; i <= nbins + 1; ++i) {
+      const Double_t expected = ha.GetBinContent(i) + 2.5 * hb.GetBinContent(i);
+      const Double_t expectedE2 = ha.GetBinError(i) * ha.GetBinError(i) +
+                                  6.25 * hb.GetBinError(i) * hb.GetBinError(i);
+      EXPECT_DOUBLE_EQ(hsum.GetBinContent(i), expected) << "bin " << i;
+      EXPECT_DOUBLE_EQ(hsum.GetBinError(i) * hsum.GetBinError(i), expectedE2) << "bin " << i;
+      EXPECT_FLOAT_EQ(hsumf.GetBinContent(i), Float_t(expected)) << "bin " << i;
+   }
+
+   // this = c1*h1 + c2*h2 (fused multiply-add form)
+   TH1D hfma("bulk_fma", "fma", nbins, 0., 1.);
+   hfma.Sumw2();
+   hfma.Add(&ha, &hb, 0.5, -1.5);
+   for (Int_t i = 0; i <= nbins + 1; ++i) {
+      EXPECT_DOUBLE_EQ(hfma.GetBinContent(i), 0.5 * ha.GetBinContent(i) - 1.5 * hb.GetBinContent(i))
+         << "bin " << i;
+   }
+
+   // this = h1 / h2 with error propagation, including empty denominator bins
+   TH1D hdiv(ha);
+   hdiv.Divide(&ha, &hb);
+   for (Int_t i = 0; i <= nbins + 1; ++i) {
+      const Double_t a = ha.GetBinContent(i), b = hb.GetBinContent(i);
+      if (b == 0.) {
+         EXPECT_DOUBLE_EQ(hdiv.GetBinContent(i), 0.) << "bin " << i;
+         EXPECT_DOUBLE_EQ(hdiv.GetBinError(i), 0.) << "bin " << i;
+      } else {
+         const Double_t ea2 = ha.GetBinError(i) * ha.GetBinError(i);
+         const Double_t eb2 = hb.GetBinError(i) * hb.GetBinError(i);
+         EXPECT_DOUBLE_EQ(hdiv.GetBinContent(i), a / b) << "bin " << i;
+         EXPECT_DOUBLE_EQ(hdiv.GetBinError(i) * hdiv.GetBinError(i),
+                          (ea2 * b * b + eb2 * a * a) / (b * b * b * b))
+            << "bin " << i;
+      }
+   }
+
+   // in-place scaling
+   TH1D hscale(ha);
+   hscale.Scale(3.);
+   for (Int_t i = 0; i <= nbins + 1; ++i) {
+      EXPECT_DOUBLE_EQ(hscale.GetBinContent(i), 3. * ha.GetBinContent(i)) << "bin " << i;
+      EXPECT_DOUBLE_EQ(hscale.GetBinError(i), 3. * ha.GetBinError(i)) << "bin " << i;
+   }
+
+   ROOT::DisableImplicitMT();
+}
+
+// GetIntegral must refresh its cached cumulative sums once the histogram has
+// been filled again, like GetQuantiles and GetRandom already do.
+TEST(TH1, IntegralCacheInvalidation)
+{
+   TH1D h("int_cache", "h", 4, 0., 4.);
+   h.Fill(0.5);
+   h.Fill(1.5);
+   const Double_t *integral = h.GetIntegral();
+   EXPECT_DOUBLE_EQ(integral[1], 0.5);
+   EXPECT_DOUBLE_EQ(integral[2], 1.0);
+
+   // another fill batch: the cache is stale and must be recomputed
+   h.Fill(3.5);
+   h.Fill(3.5);
+   integral = h.GetIntegral();
+   EXPECT_DOUBLE_EQ(integral[1], 0.25);
+   EXPECT_DOUBLE_EQ(integral[4], 1.0);
+}
@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+
+#include "TH1.h"
+
+// Tests for the unsigned bin storage types TH1US and TH1UI
+
+TEST(TH1US, FillAndRetrieve)
+{
+   TH1US h("h", "h", 10, 0., 10.);
+   for (int i = 0; i < 70000; ++i)
+      h.Fill(0.5);
+   h.Fill(1.5);
+
+   // Counts above the short range are representable, saturating at 65535
+   EXPECT_DOUBLE_EQ(65535., h.GetBinContent(1));
+   EXPECT_DOUBLE_EQ(1., h.GetBinContent(2));
+   EXPECT_DOUBLE_EQ(0., h.GetBinContent(3));
+}
+
+TEST(TH1US, SetBinContent)
+{
+   TH1US h("h", "h", 10, 0., 10.);
+   h.SetBinContent(1, 40000.);
+   EXPECT_DOUBLE_EQ(40000., h.GetBinContent(1));
+}
+
+TEST(TH1US, AddBinContentClamped)
+{
+   TH1US h("h", "h", 10, 0., 10.);
+   h.AddBinContent(1, 100000.);
+   EXPECT_DOUBLE_EQ(65535., h.GetBinContent(1));
+   h.AddBinContent(1, -100000.);
+   EXPECT_DOUBLE_EQ(0., h.GetBinContent(1));
+}
+
+TEST(TH1US, AddHistograms)
+{
+   TH1US h1("h1", "h1", 10, 0., 10.);
+   TH1US h2("h2", "h2", 10, 0., 10.);
+   h1.SetBinContent(1, 40000.);
+   h2.SetBinContent(1, 20000.);
+   h1.Add(&h2);
+   EXPECT_DOUBLE_EQ(60000., h1.GetBinContent(1));
+}
+
+TEST(TH1UI, FillAndRetrieve)
+{
+   TH1UI h("h", "h", 10, 0., 10.);
+   // Contents above INT_MAX are representable
+   h.SetBinContent(1, 3000000000.);
+   EXPECT_DOUBLE_EQ(3000000000., h.GetBinContent(1));
+
+   h.Fill(1.5);
+   EXPECT_DOUBLE_EQ(1., h.GetBinContent(2));
+}
+
+TEST(TH1UI, AddBinContentClamped)
+{
+   TH1UI h("h", "h", 10, 0., 10.);
+   h.AddBinContent(1, 5000000000.);
+   EXPECT_DOUBLE_EQ(4294967295., h.GetBinContent(1));
+   h.AddBinContent(1, -5000000000.);
+   EXPECT_DOUBLE_EQ(0., h.GetBinContent(1));
+}
+
+TEST(TH1UI, AddHistograms)
+{
+   TH1UI h1("h1", "h1", 10, 0., 10.);
+   TH1UI h2("h2", "h2", 10, 0., 10.);
+   h1.SetBinContent(1, 2000000000.);
+   h2.SetBinContent(1, 2000000000.);
+   h1.Add(&h2);
+   EXPECT_DOUBLE_EQ(4000000000., h1.GetBinContent(1));
+}
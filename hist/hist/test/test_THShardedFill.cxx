@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+
+#include "TH1D.h"
+#include "TH2D.h"
+#include "THShardedFill.h"
+
+#include <ROOT/TestSupport.hxx>
+
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Concurrent sharded filling accumulates the same multiset of fills as serial
+// Fill calls, but in a different order: bin contents are added batch by batch
+// and the statistics are folded in as per-batch partial sums. Contents, errors
+// and statistics therefore agree with the serial reference only up to
+// floating-point rounding from reordered summation, while the number of
+// entries and unit-weight counts are exact.
+static constexpr double kSumTolerance = 1e-11; // relative, ~few hundred ULPs
+
+TEST(THShardedFill, MatchesSerialFill1D)
+{
+   constexpr int nThreads = 4;
+   constexpr int nPerThread = 20000;
+
+   std::vector<std::vector<std::pair<double, double>>> data(nThreads);
+   for (int t = 0; t < nThreads; ++t) {
+      std::mt19937 gen(1000 + t);
+      std::uniform_real_distribution<double> dis(-1., 11.); // spills past the axis
+      std::uniform_real_distribution<double> wdis(0.5, 2.);
+      for (int i = 0; i < nPerThread; ++i)
+         data[t].emplace_back(dis(gen), wdis(gen));
+   }
+
+   TH1D h("h", "sharded", 100, 0., 10.);
+   TH1D href("href", "reference", 100, 0., 10.);
+
+   {
+      THShardedFill sharded(h, 8, 512); // small buffer to force many scatters
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nThreads; ++t) {
+         threads.emplace_back([&sharded, &data, t]() {
+            auto shard = sharded.GetShard();
+            for (const auto &p : data[t])
+               shard->Fill(p.first, p.second);
+         });
+      }
+      for (auto &th : threads)
+         th.join();
+   } // destructor flushes
+
+   for (int t = 0; t < nThreads; ++t)
+      for (const auto &p : data[t])
+         href.Fill(p.first, p.second);
+
+   EXPECT_DOUBLE_EQ(h.GetEntries(), href.GetEntries());
+   for (int bin = 0; bin <= h.GetNbinsX() + 1; ++bin) {
+      EXPECT_NEAR(h.GetBinContent(bin), href.GetBinContent(bin), kSumTolerance * std::abs(href.GetBinContent(bin)))
+         << "bin " << bin;
+      EXPECT_NEAR(h.GetBinError(bin), href.GetBinError(bin), kSumTolerance * std::abs(href.GetBinError(bin)))
+         << "bin " << bin;
+   }
+   double stats[4], statsRef[4];
+   h.GetStats(stats);
+   href.GetStats(statsRef);
+   for (int k = 0; k < 4; ++k)
+      EXPECT_NEAR(stats[k], statsRef[k], kSumTolerance * std::abs(statsRef[k])) << "stat " << k;
+}
+
+TEST(THShardedFill, MatchesSerialFill2D)
+{
+   constexpr int nThreads = 4;
+   constexpr int nPerThread = 10000;
+
+   std::vector<std::vector<std::pair<double, double>>> data(nThreads);
+   for (int t = 0; t < nThreads; ++t) {
+      std::mt19937 gen(2000 + t);
+      std::uniform_real_distribution<double> dis(-1., 6.);
+      for (int i = 0; i < nPerThread; ++i)
+         data[t].emplace_back(dis(gen), dis(gen));
+   }
+
+   TH2D h("h2", "sharded", 40, 0., 5., 40, 0., 5.);
+   TH2D href("h2ref", "reference", 40, 0., 5., 40, 0., 5.);
+
+   {
+      THShardedFill sharded(h, 16, 256);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nThreads; ++t) {
+         threads.emplace_back([&sharded, &data, t]() {
+            auto shard = sharded.GetShard();
+            for (const auto &p : data[t])
+               shard->Fill2D(p.first, p.second);
+         });
+      }
+      for (auto &th : threads)
+         th.join();
+      sharded.Flush();
+   }
+
+   for (int t = 0; t < nThreads; ++t)
+      for (const auto &p : data[t])
+         href.Fill(p.first, p.second);
+
+   EXPECT_DOUBLE_EQ(h.GetEntries(), href.GetEntries());
+   // unit-weight counts are integers and must be exact even after reordering
+   for (int bin = 0; bin < h.GetNcells(); ++bin)
+      EXPECT_DOUBLE_EQ(h.GetBinContent(bin), href.GetBinContent(bin)) << "bin " << bin;
+   double stats[7], statsRef[7];
+   h.GetStats(stats);
+   href.GetStats(statsRef);
+   for (int k = 0; k < 7; ++k)
+      EXPECT_NEAR(stats[k], statsRef[k], kSumTolerance * std::abs(statsRef[k])) << "stat " << k;
+}
+
+// Histograms whose bin numbering can change must be rejected up front, not
+// merely warned about.
+TEST(THShardedFill, RejectsExtendableAxes)
+{
+   ROOT::TestSupport::CheckDiagsRAII diags;
+   diags.requiredDiag(kError, "THShardedFill", "are extendable", /*matchFullMessage=*/false);
+
+   TH1D h("hext", "extendable", 10, 0., 1.);
+   h.SetCanExtend(TH1::kAllAxes);
+   THShardedFill sharded(h);
+   EXPECT_FALSE(sharded.IsValid());
+   sharded.Fill(0.5);
+   sharded.Flush();
+   EXPECT_DOUBLE_EQ(0., h.GetEntries());
+}
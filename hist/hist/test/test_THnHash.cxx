@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+
+#include "THnHash.h"
+#include "THnSparse.h"
+#include "TH1D.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+// THnHash must behave exactly like THnSparseD for the same sequence of fills:
+// same filled-bin count, same per-coordinate contents and errors, same
+// entries, weight sums and projections.
+TEST(THnHash, MatchesTHnSparse)
+{
+   const Int_t nbins[3] = {20, 30, 40};
+   const Double_t xmin[3] = {0., -5., 10.};
+   const Double_t xmax[3] = {10., 5., 20.};
+
+   THnHash hash("hash", "hash", 3, nbins, xmin, xmax);
+   THnSparseD sparse("sparse", "sparse", 3, nbins, xmin, xmax);
+   hash.Sumw2();
+   sparse.Sumw2();
+
+   std::mt19937 gen(99);
+   std::uniform_real_distribution<double> d0(-1., 11.); // includes under/overflow
+   std::uniform_real_distribution<double> d1(-6., 6.);
+   std::uniform_real_distribution<double> d2(9., 21.);
+   std::uniform_real_distribution<double> wdis(0.5, 2.);
+
+   for (int i = 0; i < 50000; ++i) {
+      const Double_t x[3] = {d0(gen), d1(gen), d2(gen)};
+      const Double_t w = wdis(gen);
+      hash.Fill(x, w);
+      sparse.Fill(x, w);
+   }
+
+   ASSERT_EQ(hash.GetNbins(), sparse.GetNbins());
+   EXPECT_DOUBLE_EQ(hash.GetEntries(), sparse.GetEntries());
+   EXPECT_DOUBLE_EQ(hash.GetSumw(), sparse.GetSumw());
+   EXPECT_DOUBLE_EQ(hash.GetSumw2(), sparse.GetSumw2());
+
+   // compare by coordinates: the two classes number their bins independently
+   Int_t coord[3];
+   std::unique_ptr<THnIter> it(new THnIter(&hash));
+   Long64_t bin;
+   while ((bin = it->Next(coord)) >= 0) {
+      const Double_t content = hash.GetBinContent(bin);
+      const Long64_t sbin = sparse.GetBin(coord);
+      ASSERT_GE(sbin, 0) << "bin missing in THnSparse";
+      EXPECT_DOUBLE_EQ(content, sparse.GetBinContent(sbin));
+      EXPECT_DOUBLE_EQ(hash.GetBinError2(bin), sparse.GetBinError2(sbin));
+   }
+
+   std::unique_ptr<TH1D> projHash(hash.Projection(1));
+   std::unique_ptr<TH1D> projSparse(sparse.Projection(1));
+   for (Int_t i = 0; i <= projHash->GetNbinsX() + 1; ++i)
+      EXPECT_DOUBLE_EQ(projHash->GetBinContent(i), projSparse->GetBinContent(i)) << "bin " << i;
+}
+
+// Lookup without allocation, Add and Reset.
+TEST(THnHash, BinOpsAndAdd)
+{
+   const Int_t nbins[2] = {10, 10};
+   const Double_t xmin[2] = {0., 0.};
+   const Double_t xmax[2] = {1., 1.};
+
+   THnHash h1("h1", "h1", 2, nbins, xmin, xmax);
+   THnHash h2("h2", "h2", 2, nbins, xmin, xmax);
+
+   const Double_t x[2] = {0.25, 0.75};
+   h1.Fill(x, 2.);
+   h2.Fill(x, 3.);
+   const Double_t y[2] = {0.85, 0.15};
+   h2.Fill(y);
+
+   const Int_t idx[2] = {3, 8}; // 0.25 -> bin 3, 0.75 -> bin 8
+   Long64_t bin = h1.GetBin(idx);
+   ASSERT_GE(bin, 0);
+   EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), 2.);
+   const Int_t missing[2] = {1, 1};
+   EXPECT_EQ(static_cast<const THnHash &>(h1).GetBin(missing), -1);
+
+   h1.Add(&h2);
+   EXPECT_EQ(h1.GetNbins(), 2);
+   EXPECT_DOUBLE_EQ(h1.GetBinContent(h1.GetBin(idx)), 5.);
+
+   h1.Reset();
+   EXPECT_EQ(h1.GetNbins(), 0);
+   EXPECT_DOUBLE_EQ(h1.GetEntries(), 0.);
+}
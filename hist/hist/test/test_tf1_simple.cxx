@@ -7,6 +7,7 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <vector>
 
 template<typename T>
 std::unique_ptr<T> SerialiseDeserialise(const T &f)
@@ -46,4 +47,42 @@ TEST(TF1, PersistentNumber)
 
    res = h.Fit(f1_d.get(), "SQN");
    EXPECT_EQ(0, res->Status());
-}
\ No newline at end of file
+}
+TEST(TF1, EvalGrid)
+{
+   TF1 f("evalgrid_f", "[0]*exp(-0.5*((x-[1])/[2])^2)", -5., 5.);
+   f.SetParameters(2., 0.5, 1.2);
+
+   const int n = 128;
+   std::vector<double> x(n), y(n), yref(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = -5. + 10. * i / (n - 1);
+      yref[i] = f.Eval(x[i]);
+   }
+
+   // bulk evaluation with the stored parameters
+   f.EvalGrid(x.data(), y.data(), n);
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(y[i], yref[i]) << "point " << i;
+
+   // explicit parameters, repeated call (second one is served from the cache)
+   const double pars[3] = {1., -0.5, 0.7};
+   std::vector<double> y1(n), y2(n);
+   f.EvalGrid(x.data(), y1.data(), n, pars);
+   f.EvalGrid(x.data(), y2.data(), n, pars);
+   for (int i = 0; i < n; ++i) {
+      EXPECT_DOUBLE_EQ(y1[i], f.EvalPar(&x[i], pars)) << "point " << i;
+      EXPECT_DOUBLE_EQ(y2[i], y1[i]) << "point " << i;
+   }
+
+   // the cache must distinguish parameter sets and grids
+   const double pars3[3] = {3., 0., 1.};
+   f.EvalGrid(x.data(), y.data(), n, pars3);
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(y[i], f.EvalPar(&x[i], pars3)) << "point " << i;
+
+   std::vector<double> xs(x.begin(), x.begin() + 16);
+   f.EvalGrid(xs.data(), y.data(), 16, pars3);
+   for (int i = 0; i < 16; ++i)
+      EXPECT_DOUBLE_EQ(y[i], f.EvalPar(&xs[i], pars3)) << "point " << i;
+}
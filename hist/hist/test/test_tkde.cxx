@@ -505,3 +505,64 @@ TEST(TKDE, tkde_fill_empty) // ROOT #7808
     for (unsigned int i = 0; i < 100; i++) { kde->Fill(r.Gaus(2,1)); }
     EXPECT_NEAR(kde->GetValue(2), 0.487581, 1e-1); // Worked on ROOT <= v6.16, failed from 6.18 until this test with result "nan"
 }
+
+/// Truncated (approximate) evaluation tests
+/// The truncated sums must agree with the full sums within the requested tolerance
+TEST(TKDE, tkde_eval_tolerance)
+{
+   TestKDE t;
+   t.binned = true;
+   t.adaptive = true;
+   t.makePlot = false;
+   auto kde = t.Create();
+
+   std::vector<double> exact(t.xtest.size());
+   for (size_t i = 0; i < t.xtest.size(); ++i)
+      exact[i] = (*kde)(t.xtest[i]);
+
+   kde->SetEvalTolerance(1.E-10);
+   for (size_t i = 0; i < t.xtest.size(); ++i)
+      EXPECT_NEAR(exact[i], (*kde)(t.xtest[i]), 1.E-8);
+
+   // disabling the truncation restores the exact evaluation
+   kde->SetEvalTolerance(0.);
+   for (size_t i = 0; i < t.xtest.size(); ++i)
+      EXPECT_DOUBLE_EQ(exact[i], (*kde)(t.xtest[i]));
+   delete kde;
+
+   // the finite-support kernels are truncated exactly for any tolerance
+   TestKDE t2;
+   t2.binned = true;
+   t2.makePlot = false;
+   auto kde2 = t2.Create();
+   kde2->SetKernelType(TKDE::kEpanechnikov);
+   std::vector<double> exact2(t2.xtest.size());
+   for (size_t i = 0; i < t2.xtest.size(); ++i)
+      exact2[i] = (*kde2)(t2.xtest[i]);
+   kde2->SetEvalTolerance(1.E-3);
+   for (size_t i = 0; i < t2.xtest.size(); ++i)
+      EXPECT_DOUBLE_EQ(exact2[i], (*kde2)(t2.xtest[i]));
+   delete kde2;
+}
+
+/// The grid evaluation must return the same values as the pointwise evaluation
+TEST(TKDE, tkde_grid_values)
+{
+   TestKDE t;
+   t.makePlot = false;
+   auto kde = t.Create();
+
+   unsigned int npoints = 201;
+   auto values = kde->GetValues(npoints, 0., 20.);
+   ASSERT_EQ(values.size(), npoints);
+   for (unsigned int i = 0; i < npoints; ++i) {
+      double x = 0. + i * 20. / (npoints - 1);
+      EXPECT_DOUBLE_EQ(values[i], (*kde)(x));
+   }
+
+   // default range is the data range
+   auto valuesDefault = kde->GetValues(npoints);
+   for (unsigned int i = 0; i < npoints; ++i)
+      EXPECT_DOUBLE_EQ(valuesDefault[i], values[i]);
+   delete kde;
+}
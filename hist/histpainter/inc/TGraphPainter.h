@@ -61,10 +61,16 @@ public:
    void           SetHighlight(TGraph *theGraph) override;
    void           Smooth(TGraph *theGraph, Int_t npoints, Double_t *x, Double_t *y, Int_t drawtype);
    static void    SetMaxPointsPerLine(Int_t maxp=50);
+   static void    SetLineDecimation(Int_t threshold=100000);
+   static Int_t   GetLineDecimation();
 
 protected:
 
+   Bool_t         DecimateLine(Int_t npoints, const Double_t *x, const Double_t *y,
+                               std::vector<Double_t> &xDec, std::vector<Double_t> &yDec);
+
    static Int_t   fgMaxPointsPerLine;  ///< Number of points per chunks' line when drawing a graph.
+   static Int_t   fgLineDecimation;    ///< Point count above which dense line graphs are decimated per pixel column (0 = off).
 
    std::vector<Double_t> gxwork, gywork, gxworkl, gyworkl; ///< Internal buffers for coordinates. Used for graphs painting.
 
@@ -60,6 +60,8 @@ protected:
    std::unique_ptr<TPie> fPie;                    ///< Pointer to a TPie in case of option PIE
    std::vector<Double_t> fXbuf;                   ///< X buffer coordinates
    std::vector<Double_t> fYbuf;                   ///< Y buffer coordinates
+   std::vector<Double_t> fXline;                  ///< Reusable X vertex buffer for the 1D paint paths
+   std::vector<Double_t> fYline;                  ///< Reusable Y vertex buffer for the 1D paint paths
    Int_t                 fNcuts;                  ///< Number of graphical cuts
    Int_t                 fCutsOpt[kMaxCuts];      ///< Sign of each cut
    TCutG                *fCuts[kMaxCuts];         ///< Pointers to graphical cuts
@@ -42,6 +42,7 @@
 #include <memory>
 
 Int_t TGraphPainter::fgMaxPointsPerLine = 50;
+Int_t TGraphPainter::fgLineDecimation = 100000;
 
 static Int_t    gHighlightPoint  = -1;         // highlight point of graph
 static TGraph  *gHighlightGraph  = nullptr;    // pointer to graph with highlight point
@@ -1442,6 +1443,17 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
    theGraph->TAttFill::Modify();
    theGraph->TAttMarker::Modify();
 
+   // For very dense graphs drawn as a plain polyline, keep only the points
+   // that can influence the rendering (at most four per pixel column). See
+   // SetLineDecimation().
+   std::vector<Double_t> xDec, yDec;
+   if (optionLine && !optionFill && !optionCurve && !optionStar && !optionMark &&
+       !optionBar && !optionE && !optionR && DecimateLine(npoints, x, y, xDec, yDec)) {
+      x = xDec.data();
+      y = yDec.data();
+      npoints = (Int_t)xDec.size();
+   }
+
    // Draw the graph with a polyline or a fill area
    gxwork.resize(2*npoints+10);
    gywork.resize(2*npoints+10);
@@ -5397,3 +5409,108 @@ void TGraphPainter::SetMaxPointsPerLine(Int_t maxp)
    fgMaxPointsPerLine = maxp;
    if (maxp < 50) fgMaxPointsPerLine = 50;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to set the point count above which graphs painted with the
+/// "L" option only are decimated to at most four points (first, minimum,
+/// maximum, last) per pixel column before painting. For a one pixel wide line
+/// the decimated rendering is identical to the exact one, while the number of
+/// points sent to the graphics backend stays proportional to the pad width
+/// instead of the graph size. Decimation is only applied to graphs whose x
+/// values are sorted in increasing order. `threshold = 0` disables it.
+
+void TGraphPainter::SetLineDecimation(Int_t threshold)
+{
+   fgLineDecimation = threshold;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function returning the line decimation threshold,
+/// see SetLineDecimation().
+
+Int_t TGraphPainter::GetLineDecimation()
+{
+   return fgLineDecimation;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce a dense polyline to at most four points (first, minimum, maximum,
+/// last) per pixel column of the current pad. Returns kFALSE, leaving the
+/// output vectors untouched, when decimation is disabled, would not pay off,
+/// or cannot be applied because the x values are not sorted.
+
+Bool_t TGraphPainter::DecimateLine(Int_t npoints, const Double_t *x, const Double_t *y,
+                                   std::vector<Double_t> &xDec, std::vector<Double_t> &yDec)
+{
+   if (fgLineDecimation <= 0 || npoints < fgLineDecimation)
+      return kFALSE;
+
+   const Int_t wpix = TMath::Abs(gPad->UtoPixel(1.) - gPad->UtoPixel(0.));
+   if (wpix <= 0 || npoints <= 4 * (wpix + 2))
+      return kFALSE;
+
+   // Map user x to pixel columns with a single linear transformation. On a
+   // log pad the pad coordinates are the log of the user coordinates.
+   const Bool_t logx = gPad->GetLogx();
+   const Double_t pxmin = gPad->GetUxmin();
+   const Double_t pxmax = gPad->GetUxmax();
+   if (pxmax <= pxmin)
+      return kFALSE;
+   const Double_t scale = wpix / (pxmax - pxmin);
+
+   auto columnOf = [&](Double_t xu) -> Int_t {
+      if (logx) {
+         if (xu <= 0)
+            return -1;
+         xu = TMath::Log10(xu);
+      }
+      Double_t c = (xu - pxmin) * scale;
+      // Clamp points outside the visible range into edge buckets so that
+      // off-screen stretches collapse as well
+      if (c < -1.)
+         return -1;
+      if (c > wpix)
+         return wpix + 1;
+      return (Int_t)c;
+   };
+
+   xDec.reserve(4 * (wpix + 3));
+   yDec.reserve(4 * (wpix + 3));
+
+   Int_t curCol = columnOf(x[0]);
+   Int_t iFirst = 0, iLast = 0, iMin = 0, iMax = 0;
+
+   auto emitColumn = [&]() {
+      Int_t idx[4] = {iFirst, TMath::Min(iMin, iMax), TMath::Max(iMin, iMax), iLast};
+      Int_t prev = -1;
+      for (Int_t k = 0; k < 4; ++k) {
+         if (idx[k] == prev)
+            continue;
+         xDec.push_back(x[idx[k]]);
+         yDec.push_back(y[idx[k]]);
+         prev = idx[k];
+      }
+   };
+
+   for (Int_t i = 1; i < npoints; ++i) {
+      if (x[i] < x[i - 1]) {
+         // Unsorted graph: decimation per column is not applicable
+         xDec.clear();
+         yDec.clear();
+         return kFALSE;
+      }
+      const Int_t col = columnOf(x[i]);
+      if (col != curCol) {
+         emitColumn();
+         curCol = col;
+         iFirst = iMin = iMax = i;
+      } else {
+         if (y[i] < y[iMin]) iMin = i;
+         if (y[i] > y[iMax]) iMax = i;
+      }
+      iLast = i;
+   }
+   emitColumn();
+
+   return kTRUE;
+}
@@ -6353,7 +6353,8 @@ void THistPainter::PaintErrors(Option_t *)
    static Float_t cxx[30] = {1.0,1.0,0.5,0.5,1.0,1.0,0.5,0.6,1.0,0.5,0.5,1.0,0.5,0.6,1.0,1.0,1.0,1.0,1.0,1.0,0.0,0.0,1.0,1.0,1.0,1.0,0.5,0.5,0.5,1.0};
    static Float_t cyy[30] = {1.0,1.0,1.0,1.0,1.0,1.0,1.0,1.0,1.0,0.5,0.5,1.0,1.0,1.0,1.0,1.0,1.0,1.0,1.0,1.0,0.0,0.0,1.0,1.0,1.0,1.0,0.5,0.5,0.5,1.0};
 
-   std::vector<Double_t> xline, yline;
+   // Persistent vertex buffers, reused from one Paint call to the next.
+   std::vector<Double_t> &xline = fXline, &yline = fYline;
    option0 = option1 = option2 = option3 = option4 = optionE = optionEX0 = optionI0 = 0;
    if (Hoption.Error >= 40) {Hoption.Error -=40; option0 = 1;}
    if (Int_t(Hoption.Error/10) == 2) {optionEX0 = 1; Hoption.Error -= 10;}
@@ -6882,7 +6883,9 @@ void THistPainter::PaintHist(Option_t *)
    last  = Hparam.xlast;
    nbins = last - first + 1;
 
-   std::vector<Double_t> keepx, keepy;
+   // Reuse the painter's persistent vertex buffers: at high refresh rates the
+   // per-Paint allocations dominate when the data did not change.
+   std::vector<Double_t> &keepx = fXline, &keepy = fYline;
    if (fXaxis->GetXbins()->fN) fixbin = 0;
    else                        fixbin = 1;
    if (fixbin) keepx.resize(2);
@@ -7,8 +7,18 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TROOT.h"
 #include "snprintf.h"
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 /** \class TSpectrum
     \ingroup Spectrum
     \brief Advanced Spectra Processing
@@ -350,163 +360,16 @@ void TSpectrum::SetResolution(Double_t resolution)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// This function calculates background spectrum from source spectrum.
-/// The result is placed in the vector pointed by spectrum pointer.
-/// The goal is to separate the useful information (peaks) from useless
-/// information (background).
-///
-/// - method is based on Sensitive Nonlinear Iterative Peak (SNIP) clipping
-///      algorithm.
-/// - new value in the channel "i" is calculated
-///
-/// \f[
-/// v_p(i) = min \left\{ v_{p-1}(i)^{\frac{\left[v_{p-1}(i+p)+v_{p-1}(i-p)\right]}{2}}   \right\}
-/// \f]
-///
-/// where p = 1, 2, ..., numberIterations. In fact it represents second order
-/// difference filter (-1,2,-1).
-///
-/// One can also change the
-/// direction of the change of the clipping window, the order of the clipping
-/// filter, to include smoothing, to set width of smoothing window and to include
-/// the estimation of Compton edges. On successful completion it returns 0. On
-/// error it returns pointer to the string describing error.
-///
-/// #### Parameters:
-///
-/// - spectrum: pointer to the vector of source spectrum
-/// - ssize: length of the spectrum vector
-/// - numberIterations: maximal width of clipping window,
-/// - direction:  direction of change of clipping window.
-///      Possible values: kBackIncreasingWindow, kBackDecreasingWindow
-/// - filterOrder: order of clipping filter.
-///      Possible values: kBackOrder2, kBackOrder4, kBackOrder6, kBackOrder8
-/// - smoothing: logical variable whether the smoothing operation in the
-///      estimation of background will be included.
-///      Possible values: kFALSE, kTRUE
-/// - smoothWindow: width of smoothing window.
-///      Possible values: kBackSmoothing3, kBackSmoothing5, kBackSmoothing7,
-///      kBackSmoothing9, kBackSmoothing11, kBackSmoothing13, kBackSmoothing15.
-/// - compton: logical variable whether the estimation of Compton edge will be
-///      included. Possible values: kFALSE, kTRUE.
-///
-/// #### References:
-///
-///   1. C. G Ryan et al.: SNIP, a statistics-sensitive background treatment for the
-/// quantitative analysis of PIXE spectra in geoscience applications. NIM, B34
-/// (1988), 396-402.
-///
-///   2. M. Morhac;, J. Kliman, V. Matouoek, M. Veselsky, I. Turzo:
-/// Background elimination methods for multidimensional gamma-ray spectra. NIM,
-/// A401 (1997) 113-132.
-///
-///   3. D. D. Burgess, R. J. Tervo: Background estimation for gamma-ray
-/// spectroscopy. NIM 214 (1983), 431-434.
-///
-/// ### Example 1 script Background_incr.C:
-///
-/// Example of the estimation of background for number of iterations=6.
-/// Original spectrum is shown in black color, estimated background in red color.
-///
-/// Begin_Macro(source)
-/// ../../../tutorials/legacy/spectrum/Background_incr.C
-/// End_Macro
-///
-/// ### Example 2 script Background_decr.C:
-///
-/// In Example 1. one can notice that at the edges of the peaks the estimated
-/// background goes under the peaks. An alternative approach is to decrease the
-/// clipping window from a given value numberIterations to the value of one, which
-/// is presented in this example.
-///
-/// Example of the estimation of background for numberIterations=6 using
-/// decreasing clipping window algorithm. Original spectrum is shown in black
-/// color, estimated background in red color.
-///
-/// Begin_Macro(source)
-/// ../../../tutorials/legacy/spectrum/Background_decr.C
-/// End_Macro
-///
-/// ### Example 3 script Background_width.C:
-///
-/// The question is how to choose the width of the clipping window, i.e.,
-/// numberIterations parameter. The influence of this parameter on the estimated
-/// background is illustrated in Example 3.
-///
-/// Example of the influence of clipping window width on the estimated background
-/// for numberIterations=4 (red line), 6 (orange line) 8 (green line) using decreasing
-/// clipping window algorithm.
-///
-/// in general one should set this parameter so that the value
-/// 2*numberIterations+1 was greater than the widths of preserved objects (peaks).
-///
-/// Begin_Macro(source)
-/// ../../../tutorials/legacy/spectrum/Background_width.C
-/// End_Macro
-///
-/// ### Example 4 script Background_width2.C:
-///
-/// another example for very complex spectrum is given here.
-///
-/// Example of the influence of clipping window width on the estimated background
-/// for numberIterations=10 (red line), 20 (blue line), 30 (green line) and
-/// 40 (magenta line) using decreasing clipping window algorithm.
-///
-/// Begin_Macro(source)
-/// ../../../tutorials/legacy/spectrum/Background_width2.C
-/// End_Macro
-///
-/// ### Example 5 script Background_order.C:
-///
-/// Second order difference filter removes linear (quasi-linear) background and
-/// preserves symmetrical peaks. However if the shape of the background is more
-/// complex one can employ higher-order clipping filters.
-///
-/// Example of the influence of clipping filter difference order on the estimated
-/// background for fNnumberIterations=40, 2-nd order red line, 4-th order blue line,
-/// 6-th order green line and 8-th order magenta line, and using decreasing
-/// clipping window algorithm.
-///
-/// Begin_Macro(source)
-/// ../../../tutorials/legacy/spectrum/Background_order.C
-/// End_Macro
-///
-/// ### Example 6 script Background_smooth.C:
-///
-/// The estimate of the background can be influenced by noise present in the
-/// spectrum.  We proposed the algorithm of the background estimate with
-/// simultaneous smoothing.  In the original algorithm without smoothing, the
-/// estimated background snatches the lower spikes in the noise. Consequently,
-/// the areas of peaks are biased by this error.
-///
-/// \image html TSpectrum_Background_smooth1.jpg Principle of background estimation algorithm with simultaneous smoothing.
-///
-/// Begin_Macro(source)
-/// ../../../tutorials/legacy/spectrum/Background_smooth.C
-/// End_Macro
-///
-/// ### Example 8 script Background_compton.C:
-///
-/// Sometimes it is necessary to include also the Compton edges into the estimate of
-/// the background. This example presents the synthetic spectrum
-/// with Compton edges. The background was estimated using the 8-th order filter
-/// with the estimation of the Compton edges using decreasing
-/// clipping window algorithm (numberIterations=10) with smoothing
-/// (smoothingWindow=5).
-///
-/// Example of the estimate of the background with Compton edges (red line) for
-/// numberIterations=10, 8-th order difference filter, using decreasing clipping
-/// window algorithm and smoothing (smoothingWindow=5).
-///
-/// Begin_Macro(source)
-/// ../../../tutorials/legacy/spectrum/Background_compton.C
-/// End_Macro
-
-const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
-                                          Int_t numberIterations,
-                                          Int_t direction, Int_t filterOrder,
-                                          bool smoothing, Int_t smoothWindow,
-                                          bool compton)
+/// Worker for the SNIP background estimation: same algorithm as
+/// TSpectrum::Background(Double_t*, ...) but operating on a caller-provided
+/// scratch buffer of 2*ssize doubles, so batch processing can reuse the
+/// buffer across spectra instead of reallocating it for every call.
+
+static const char *SnipBackground(Double_t *spectrum, Int_t ssize,
+                                  Int_t numberIterations,
+                                  Int_t direction, Int_t filterOrder,
+                                  bool smoothing, Int_t smoothWindow,
+                                  bool compton, Double_t *working_space)
 {
    int i, j, w, bw, b1, b2, priz;
    Double_t a, b, c, d, e, yb1, yb2, ai, av, men, b4, c4, d4, e4, b6, c6, d6, e6, f6, g6, b8, c8, d8, e8, f8, g8, h8, i8;
@@ -518,7 +381,6 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
       return "Too Large Clipping Window";
    if (smoothing == kTRUE && smoothWindow != kBackSmoothing3 && smoothWindow != kBackSmoothing5 && smoothWindow != kBackSmoothing7 && smoothWindow != kBackSmoothing9 && smoothWindow != kBackSmoothing11 && smoothWindow != kBackSmoothing13 && smoothWindow != kBackSmoothing15)
       return "Incorrect width of smoothing window";
-   Double_t *working_space = new Double_t[2 * ssize];
    for (i = 0; i < ssize; i++){
       working_space[i] = spectrum[i];
       working_space[i + ssize] = spectrum[i];
@@ -1143,7 +1005,221 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
    for (j = 0; j < ssize; j++)
       spectrum[j] = working_space[ssize + j];
-   delete[]working_space;
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// This function calculates background spectrum from source spectrum.
+/// The result is placed in the vector pointed by spectrum pointer.
+/// The goal is to separate the useful information (peaks) from useless
+/// information (background).
+///
+/// - method is based on Sensitive Nonlinear Iterative Peak (SNIP) clipping
+///      algorithm.
+/// - new value in the channel "i" is calculated
+///
+/// \f[
+/// v_p(i) = min \left\{ v_{p-1}(i)^{\frac{\left[v_{p-1}(i+p)+v_{p-1}(i-p)\right]}{2}}   \right\}
+/// \f]
+///
+/// where p = 1, 2, ..., numberIterations. In fact it represents second order
+/// difference filter (-1,2,-1).
+///
+/// One can also change the
+/// direction of the change of the clipping window, the order of the clipping
+/// filter, to include smoothing, to set width of smoothing window and to include
+/// the estimation of Compton edges. On successful completion it returns 0. On
+/// error it returns pointer to the string describing error.
+///
+/// #### Parameters:
+///
+/// - spectrum: pointer to the vector of source spectrum
+/// - ssize: length of the spectrum vector
+/// - numberIterations: maximal width of clipping window,
+/// - direction:  direction of change of clipping window.
+///      Possible values: kBackIncreasingWindow, kBackDecreasingWindow
+/// - filterOrder: order of clipping filter.
+///      Possible values: kBackOrder2, kBackOrder4, kBackOrder6, kBackOrder8
+/// - smoothing: logical variable whether the smoothing operation in the
+///      estimation of background will be included.
+///      Possible values: kFALSE, kTRUE
+/// - smoothWindow: width of smoothing window.
+///      Possible values: kBackSmoothing3, kBackSmoothing5, kBackSmoothing7,
+///      kBackSmoothing9, kBackSmoothing11, kBackSmoothing13, kBackSmoothing15.
+/// - compton: logical variable whether the estimation of Compton edge will be
+///      included. Possible values: kFALSE, kTRUE.
+///
+/// #### References:
+///
+///   1. C. G Ryan et al.: SNIP, a statistics-sensitive background treatment for the
+/// quantitative analysis of PIXE spectra in geoscience applications. NIM, B34
+/// (1988), 396-402.
+///
+///   2. M. Morhac;, J. Kliman, V. Matouoek, M. Veselsky, I. Turzo:
+/// Background elimination methods for multidimensional gamma-ray spectra. NIM,
+/// A401 (1997) 113-132.
+///
+///   3. D. D. Burgess, R. J. Tervo: Background estimation for gamma-ray
+/// spectroscopy. NIM 214 (1983), 431-434.
+///
+/// ### Example 1 script Background_incr.C:
+///
+/// Example of the estimation of background for number of iterations=6.
+/// Original spectrum is shown in black color, estimated background in red color.
+///
+/// Begin_Macro(source)
+/// ../../../tutorials/legacy/spectrum/Background_incr.C
+/// End_Macro
+///
+/// ### Example 2 script Background_decr.C:
+///
+/// In Example 1. one can notice that at the edges of the peaks the estimated
+/// background goes under the peaks. An alternative approach is to decrease the
+/// clipping window from a given value numberIterations to the value of one, which
+/// is presented in this example.
+///
+/// Example of the estimation of background for numberIterations=6 using
+/// decreasing clipping window algorithm. Original spectrum is shown in black
+/// color, estimated background in red color.
+///
+/// Begin_Macro(source)
+/// ../../../tutorials/legacy/spectrum/Background_decr.C
+/// End_Macro
+///
+/// ### Example 3 script Background_width.C:
+///
+/// The question is how to choose the width of the clipping window, i.e.,
+/// numberIterations parameter. The influence of this parameter on the estimated
+/// background is illustrated in Example 3.
+///
+/// Example of the influence of clipping window width on the estimated background
+/// for numberIterations=4 (red line), 6 (orange line) 8 (green line) using decreasing
+/// clipping window algorithm.
+///
+/// in general one should set this parameter so that the value
+/// 2*numberIterations+1 was greater than the widths of preserved objects (peaks).
+///
+/// Begin_Macro(source)
+/// ../../../tutorials/legacy/spectrum/Background_width.C
+/// End_Macro
+///
+/// ### Example 4 script Background_width2.C:
+///
+/// another example for very complex spectrum is given here.
+///
+/// Example of the influence of clipping window width on the estimated background
+/// for numberIterations=10 (red line), 20 (blue line), 30 (green line) and
+/// 40 (magenta line) using decreasing clipping window algorithm.
+///
+/// Begin_Macro(source)
+/// ../../../tutorials/legacy/spectrum/Background_width2.C
+/// End_Macro
+///
+/// ### Example 5 script Background_order.C:
+///
+/// Second order difference filter removes linear (quasi-linear) background and
+/// preserves symmetrical peaks. However if the shape of the background is more
+/// complex one can employ higher-order clipping filters.
+///
+/// Example of the influence of clipping filter difference order on the estimated
+/// background for fNnumberIterations=40, 2-nd order red line, 4-th order blue line,
+/// 6-th order green line and 8-th order magenta line, and using decreasing
+/// clipping window algorithm.
+///
+/// Begin_Macro(source)
+/// ../../../tutorials/legacy/spectrum/Background_order.C
+/// End_Macro
+///
+/// ### Example 6 script Background_smooth.C:
+///
+/// The estimate of the background can be influenced by noise present in the
+/// spectrum.  We proposed the algorithm of the background estimate with
+/// simultaneous smoothing.  In the original algorithm without smoothing, the
+/// estimated background snatches the lower spikes in the noise. Consequently,
+/// the areas of peaks are biased by this error.
+///
+/// \image html TSpectrum_Background_smooth1.jpg Principle of background estimation algorithm with simultaneous smoothing.
+///
+/// Begin_Macro(source)
+/// ../../../tutorials/legacy/spectrum/Background_smooth.C
+/// End_Macro
+///
+/// ### Example 8 script Background_compton.C:
+///
+/// Sometimes it is necessary to include also the Compton edges into the estimate of
+/// the background. This example presents the synthetic spectrum
+/// with Compton edges. The background was estimated using the 8-th order filter
+/// with the estimation of the Compton edges using decreasing
+/// clipping window algorithm (numberIterations=10) with smoothing
+/// (smoothingWindow=5).
+///
+/// Example of the estimate of the background with Compton edges (red line) for
+/// numberIterations=10, 8-th order difference filter, using decreasing clipping
+/// window algorithm and smoothing (smoothingWindow=5).
+///
+/// Begin_Macro(source)
+/// ../../../tutorials/legacy/spectrum/Background_compton.C
+/// End_Macro
+
+const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
+                                          Int_t numberIterations,
+                                          Int_t direction, Int_t filterOrder,
+                                          bool smoothing, Int_t smoothWindow,
+                                          bool compton)
+{
+   std::vector<Double_t> working_space(2 * (size_t)std::max(ssize, 0));
+   return SnipBackground(spectrum, ssize, numberIterations, direction, filterOrder,
+                         smoothing, smoothWindow, compton, working_space.data());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Estimate the background of several spectra of the same length in one call.
+///
+/// Applies the same SNIP algorithm as
+/// Background(Double_t*, Int_t, Int_t, Int_t, Int_t, bool, Int_t, bool) to each
+/// of the nSpectra arrays pointed to by spectra, replacing every spectrum by
+/// its estimated background. The scratch buffer is reused across spectra, and
+/// when implicit multi-threading is enabled (ROOT::EnableImplicitMT) the
+/// spectra are distributed over the thread pool. On successful completion it
+/// returns 0; on error it returns the error string of the failing spectrum
+/// (the parameters are shared, so either all spectra fail or none do).
+
+const char *TSpectrum::BackgroundBatch(Double_t **spectra, Int_t nSpectra,
+                                       Int_t ssize, Int_t numberIterations,
+                                       Int_t direction, Int_t filterOrder,
+                                       bool smoothing, Int_t smoothWindow,
+                                       bool compton)
+{
+   if (nSpectra <= 0 || !spectra)
+      return "Wrong Parameters";
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nSpectra > 1) {
+      std::atomic<const char *> error{nullptr};
+      std::vector<Int_t> indices(nSpectra);
+      std::iota(indices.begin(), indices.end(), 0);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](Int_t idx) {
+            thread_local std::vector<Double_t> working_space;
+            working_space.resize(2 * (size_t)std::max(ssize, 0));
+            const char *err = SnipBackground(spectra[idx], ssize, numberIterations, direction,
+                                             filterOrder, smoothing, smoothWindow, compton,
+                                             working_space.data());
+            if (err)
+               error = err;
+         },
+         indices);
+      return error;
+   }
+#endif
+   std::vector<Double_t> working_space(2 * (size_t)std::max(ssize, 0));
+   for (Int_t n = 0; n < nSpectra; ++n) {
+      const char *err = SnipBackground(spectra[n], ssize, numberIterations, direction,
+                                       filterOrder, smoothing, smoothWindow, compton,
+                                       working_space.data());
+      if (err)
+         return err;
+   }
    return nullptr;
 }
 
@@ -117,14 +117,45 @@ constraint, both x and &lambda; are determined.
 #include "TUnfold.h"
 
 #include <map>
+#include <utility>
 #include <vector>
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 //#define DEBUG
 //#define DEBUG_DETAIL
 //#define FORCE_EIGENVALUE_DECOMPOSITION
 
 ClassImp(TUnfold)
 
+////////////////////////////////////////////////////////////////////////
+/// split a row-independent kernel over chunks of matrix rows,
+/// processed in parallel when implicit multi-threading is enabled
+///
+/// \param[in] nrows number of matrix rows
+/// \param[in] func callable invoked as func(rowBegin,rowEnd)
+
+template <typename F>
+static void RowRangeApply(Int_t nrows, F func)
+{
+#ifdef R__USE_IMT
+   constexpr Int_t kRowsPerTask = 256;
+   if (ROOT::IsImplicitMTEnabled() && nrows > kRowsPerTask) {
+      std::vector<std::pair<Int_t, Int_t>> ranges;
+      ranges.reserve((nrows + kRowsPerTask - 1) / kRowsPerTask);
+      for (Int_t begin = 0; begin < nrows; begin += kRowsPerTask)
+         ranges.emplace_back(begin, TMath::Min(nrows, begin + kRowsPerTask));
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&func](const std::pair<Int_t, Int_t> &range) { func(range.first, range.second); }, ranges);
+      return;
+   }
+#endif
+   func(0, nrows);
+}
+
 TUnfold::~TUnfold(void)
 {
    // delete all data members
@@ -626,30 +657,54 @@ TMatrixDSparse *TUnfold::MultiplyMSparseMSparse(const TMatrixDSparse *a,
       Int_t *r_rows=new Int_t[nMax];
       Int_t *r_cols=new Int_t[nMax];
       Double_t *r_data=new Double_t[nMax];
-      Double_t *row_data=new Double_t[b->GetNcols()];
-      Int_t n=0;
+      Int_t ncol_b=b->GetNcols();
+      // each non-empty a-row owns a fixed slot of ncol_b entries in the
+      // output arrays, so the rows can be processed independently
+      std::vector<Int_t> slot(a->GetNrows()+1);
+      slot[0]=0;
       for (Int_t irow = 0; irow < a->GetNrows(); irow++) {
-         if(a_rows[irow+1]<=a_rows[irow]) continue;
-         // clear row data
-         for(Int_t icol=0;icol<b->GetNcols();icol++) {
-            row_data[icol]=0.0;
-         }
-         // loop over a-columns in this a-row
-         for(Int_t ia=a_rows[irow];ia<a_rows[irow+1];ia++) {
-            Int_t k=a_cols[ia];
-            // loop over b-columns in b-row k
-            for(Int_t ib=b_rows[k];ib<b_rows[k+1];ib++) {
-               row_data[b_cols[ib]] += a_data[ia]*b_data[ib];
+         slot[irow+1]=slot[irow]+
+            ((a_rows[irow+1]>a_rows[irow]) ? ncol_b : 0);
+      }
+      std::vector<Int_t> rowN(a->GetNrows(),0);
+      RowRangeApply(a->GetNrows(),[&](Int_t rowBegin,Int_t rowEnd) {
+         std::vector<Double_t> row_data(ncol_b);
+         for (Int_t irow = rowBegin; irow < rowEnd; irow++) {
+            if(a_rows[irow+1]<=a_rows[irow]) continue;
+            // clear row data
+            for(Int_t icol=0;icol<ncol_b;icol++) {
+               row_data[icol]=0.0;
             }
-         }
-         // store nonzero elements
-         for(Int_t icol=0;icol<b->GetNcols();icol++) {
-            if(row_data[icol] != 0.0) {
-               r_rows[n]=irow;
-               r_cols[n]=icol;
-               r_data[n]=row_data[icol];
-               n++;
+            // loop over a-columns in this a-row
+            for(Int_t ia=a_rows[irow];ia<a_rows[irow+1];ia++) {
+               Int_t k=a_cols[ia];
+               // loop over b-columns in b-row k
+               for(Int_t ib=b_rows[k];ib<b_rows[k+1];ib++) {
+                  row_data[b_cols[ib]] += a_data[ia]*b_data[ib];
+               }
+            }
+            // store nonzero elements in this row's slot
+            Int_t n=slot[irow];
+            for(Int_t icol=0;icol<ncol_b;icol++) {
+               if(row_data[icol] != 0.0) {
+                  r_rows[n]=irow;
+                  r_cols[n]=icol;
+                  r_data[n]=row_data[icol];
+                  n++;
+               }
             }
+            rowN[irow]=n-slot[irow];
+         }
+      });
+      // compact the per-row slots into one contiguous block; safe in
+      // place because the write position never overtakes the read position
+      Int_t n=0;
+      for (Int_t irow = 0; irow < a->GetNrows(); irow++) {
+         for(Int_t i=0;i<rowN[irow];i++) {
+            r_rows[n]=r_rows[slot[irow]+i];
+            r_cols[n]=r_cols[slot[irow]+i];
+            r_data[n]=r_data[slot[irow]+i];
+            n++;
          }
       }
       if(n>0) {
@@ -658,7 +713,6 @@ TMatrixDSparse *TUnfold::MultiplyMSparseMSparse(const TMatrixDSparse *a,
       delete[] r_rows;
       delete[] r_cols;
       delete[] r_data;
-      delete[] row_data;
    }
 
    return r;
@@ -779,20 +833,43 @@ TMatrixDSparse *TUnfold::MultiplyMSparseM(const TMatrixDSparse *a,
       Int_t *r_rows=new Int_t[nMax];
       Int_t *r_cols=new Int_t[nMax];
       Double_t *r_data=new Double_t[nMax];
-
-      Int_t n=0;
-      // fill matrix r
+      Int_t ncol_b=b->GetNcols();
+      // each non-empty a-row owns a fixed slot of ncol_b entries in the
+      // output arrays, so the rows can be processed independently
+      std::vector<Int_t> slot(a->GetNrows()+1);
+      slot[0]=0;
       for (Int_t irow = 0; irow < a->GetNrows(); irow++) {
-         if(a_rows[irow+1]-a_rows[irow]<=0) continue;
-         for(Int_t icol=0;icol<b->GetNcols();icol++) {
-            r_rows[n]=irow;
-            r_cols[n]=icol;
-            r_data[n]=0.0;
-            for(Int_t i=a_rows[irow];i<a_rows[irow+1];i++) {
-               Int_t j=a_cols[i];
-               r_data[n] += a_data[i]*(*b)(j,icol);
+         slot[irow+1]=slot[irow]+
+            ((a_rows[irow+1]>a_rows[irow]) ? ncol_b : 0);
+      }
+      std::vector<Int_t> rowN(a->GetNrows(),0);
+      // fill matrix r
+      RowRangeApply(a->GetNrows(),[&](Int_t rowBegin,Int_t rowEnd) {
+         for (Int_t irow = rowBegin; irow < rowEnd; irow++) {
+            if(a_rows[irow+1]-a_rows[irow]<=0) continue;
+            Int_t n=slot[irow];
+            for(Int_t icol=0;icol<ncol_b;icol++) {
+               r_rows[n]=irow;
+               r_cols[n]=icol;
+               r_data[n]=0.0;
+               for(Int_t i=a_rows[irow];i<a_rows[irow+1];i++) {
+                  Int_t j=a_cols[i];
+                  r_data[n] += a_data[i]*(*b)(j,icol);
+               }
+               if(r_data[n]!=0.0) n++;
             }
-            if(r_data[n]!=0.0) n++;
+            rowN[irow]=n-slot[irow];
+         }
+      });
+      // compact the per-row slots into one contiguous block; safe in
+      // place because the write position never overtakes the read position
+      Int_t n=0;
+      for (Int_t irow = 0; irow < a->GetNrows(); irow++) {
+         for(Int_t i=0;i<rowN[irow];i++) {
+            r_rows[n]=r_rows[slot[irow]+i];
+            r_cols[n]=r_cols[slot[irow]+i];
+            r_data[n]=r_data[slot[irow]+i];
+            n++;
          }
       }
       if(n>0) {
@@ -19,13 +19,19 @@
 #include <clang/Basic/TargetOptions.h>
 #include <clang/Frontend/CompilerInstance.h>
 
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/JITLink/EHFrameSupport.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
 #include <llvm/ExecutionEngine/Orc/ObjectLinkingLayer.h>
 #include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
 #include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/TargetParser/Host.h>
@@ -430,6 +436,64 @@ static SymbolMap GetListOfMacOSCompilerRTSymbols(const LLJIT& Jit) {
 }
 #endif
 
+  /// A simple on-disk cache for JITted object code, enabled by pointing the
+  /// CLING_CACHE_DIR environment variable to a (shared) directory. Entries are
+  /// keyed on a hash of the module IR, the target triple and the LLVM version,
+  /// so that processes interpreting the same code in the same order (e.g.
+  /// identical batch jobs) load the object file instead of re-running the
+  /// backend. Linking and symbol resolution still happen per process.
+  class ClingDiskObjectCache : public llvm::ObjectCache {
+  public:
+    explicit ClingDiskObjectCache(llvm::StringRef CacheDir)
+        : m_CacheDir(CacheDir.str()) {
+      llvm::sys::fs::create_directories(m_CacheDir);
+    }
+
+    void notifyObjectCompiled(const Module* M, MemoryBufferRef Obj) override {
+      const std::string CacheFile = getCacheFile(M);
+      // Write to a unique temporary file and rename it, so that concurrent
+      // processes sharing the cache directory never observe partial entries.
+      int FD;
+      llvm::SmallString<256> TmpFile;
+      if (llvm::sys::fs::createUniqueFile(CacheFile + ".tmp-%%%%%%", FD,
+                                          TmpFile))
+        return;
+      {
+        llvm::raw_fd_ostream OS(FD, /*shouldClose=*/true);
+        OS << Obj.getBuffer();
+      }
+      if (llvm::sys::fs::rename(TmpFile, CacheFile))
+        llvm::sys::fs::remove(TmpFile);
+    }
+
+    std::unique_ptr<MemoryBuffer> getObject(const Module* M) override {
+      auto Buf = MemoryBuffer::getFile(getCacheFile(M));
+      if (!Buf)
+        return nullptr;
+      return std::move(*Buf);
+    }
+
+  private:
+    std::string getCacheFile(const Module* M) const {
+      llvm::SmallString<512> IR;
+      llvm::raw_svector_ostream OS(IR);
+      M->print(OS, /*AAW=*/nullptr);
+
+      llvm::MD5 Hash;
+      Hash.update(LLVM_VERSION_STRING);
+      Hash.update(M->getTargetTriple());
+      Hash.update(IR);
+      llvm::MD5::MD5Result Result;
+      Hash.final(Result);
+
+      llvm::SmallString<256> Path(m_CacheDir);
+      llvm::sys::path::append(Path, Result.digest() + ".o");
+      return std::string(Path);
+    }
+
+    std::string m_CacheDir;
+  };
+
 #if defined(__linux__) && defined(__GLIBC__)
 static SymbolMap GetListOfLibcNonsharedSymbols(const LLJIT& Jit) {
   // Inject a number of symbols that may be in libc_nonshared.a where they are
@@ -540,9 +604,12 @@ IncrementalJIT::IncrementalJIT(
     return Layer;
   });
 
+  if (const char* CacheDir = std::getenv("CLING_CACHE_DIR"))
+    m_ObjectCache = std::make_unique<ClingDiskObjectCache>(CacheDir);
+
   Builder.setCompileFunctionCreator([&](llvm::orc::JITTargetMachineBuilder)
   -> llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
-    return std::make_unique<SimpleCompiler>(*m_TM);
+    return std::make_unique<SimpleCompiler>(*m_TM, m_ObjectCache.get());
   });
 
   char LinkerPrefix = this->m_TM->createDataLayout().getGlobalPrefix();
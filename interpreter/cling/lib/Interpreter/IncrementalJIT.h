@@ -13,6 +13,7 @@
 #include "llvm/ADT/FunctionExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/StringSet.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
 #include "llvm/ExecutionEngine/Orc/Core.h"
 #include "llvm/ExecutionEngine/Orc/ExecutorProcessControl.h"
 #include "llvm/ExecutionEngine/Orc/LLJIT.h"
@@ -128,6 +129,11 @@ private:
   // FIXME: Move TargetMachine ownership to BackendPasses
   std::unique_ptr<llvm::TargetMachine> m_TM;
 
+  /// An optional on-disk cache for JITted object code, enabled with the
+  /// CLING_CACHE_DIR environment variable. Must outlive the compiler of the
+  /// IRCompileLayer, which holds a raw pointer to it.
+  std::unique_ptr<llvm::ObjectCache> m_ObjectCache;
+
   // TODO: We only need the context for materialization. Instead of defining it
   // here we might want to pass one in on a per-module basis.
   //
@@ -12,15 +12,19 @@
 #ifndef ROOT_RRawFileUnix
 #define ROOT_RRawFileUnix
 
+#include <ROOT/RConfig.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <string_view>
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
 
+class RIoUring;
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
@@ -31,6 +35,12 @@ namespace Internal {
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes = -1;
+#ifdef R__HAS_URING
+   /// The ring used for vectored reads; lazily created on the first ReadV call and reused afterwards,
+   /// so that the prefetcher can keep many read requests in flight without paying the ring setup cost
+   /// (and the associated memlock'ed memory allocation) on every batch.
+   std::unique_ptr<RIoUring> fIoUring;
+#endif
 
 protected:
    void OpenImpl() final;
@@ -16,10 +16,13 @@
 #include "TMemFile.h"
 #include "ROOT/RConfig.hxx"
 
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <utility>
 
 namespace ROOT {
 
@@ -83,6 +86,22 @@ public:
    _R__DEPRECATED_LATER("The queuing mechanism in TBufferMerger was removed in ROOT v6.32")
    void SetAutoSave(size_t /*size*/) {}
 
+   /** Returns the maximum number of memory files that may be pending merge
+    * at any time, or zero if producers merge their own data synchronously. */
+   size_t GetMaxPendingFiles() const { return fMaxPendingFiles; }
+
+   /** Limits how many memory files may be pending merge at any time.
+    *
+    * By default (max = 0) each producer thread merges its own data while
+    * holding the merge lock, so under heavy contention all producers stall
+    * behind a single merge. When max is non-zero, producers instead hand
+    * their snapshot to a bounded pending list and one of them drains the
+    * list on behalf of the others; a producer only blocks when the list is
+    * full, which bounds the memory held in not-yet-merged snapshots.
+    * @param max Maximum number of pending memory files
+    */
+   void SetMaxPendingFiles(size_t max) { fMaxPendingFiles = max; }
+
    /** Sets the merge options. SetMergeOptions("fast") will disable
     * recompression of input data into the output if they have different
     * compression settings.
@@ -126,9 +145,15 @@ private:
 
    void Merge(TBufferMergerFile *memfile);
 
+   void MergeImpl(TBufferMergerFile *memfile);
+
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
+   std::mutex fQueueMutex;                                       //< Mutex used to lock fPending
+   std::condition_variable fCv;                                  //< Signals pending list space and completed merges
+   std::deque<std::pair<TBufferMergerFile *, bool *>> fPending;  //< Files waiting to be merged, with their done flags
+   size_t fMaxPendingFiles{0};                                   //< Maximum size of fPending; 0 merges synchronously
 };
 
 /**
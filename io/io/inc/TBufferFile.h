@@ -25,6 +25,7 @@
 #include "TBufferIO.h"
 #include "Bytes.h"
 
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -73,6 +74,8 @@ public:
    TBufferFile(TBuffer::EMode mode, Int_t bufsiz, void *buf, Bool_t adopt = kTRUE, ReAllocCharFun_t reallocfunc = nullptr);
    ~TBufferFile() override;
 
+   static std::unique_ptr<TBufferFile> AcquireFromPool(TBuffer::EMode mode, Int_t bufsiz = TBuffer::kInitialSize);
+
    Int_t      CheckByteCount(UInt_t startpos, UInt_t bcnt, const TClass *clss) override;
    Int_t      CheckByteCount(UInt_t startpos, UInt_t bcnt, const char *classname) override;
    void       SetByteCount(UInt_t cntpos, Bool_t packInVersion = kFALSE) override;
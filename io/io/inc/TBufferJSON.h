@@ -15,7 +15,9 @@
 #include "TBufferText.h"
 #include "TString.h"
 
+#include <cstddef>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,10 +50,14 @@ public:
      kSkipTypeInfo  = 100            ///< do not store typenames in JSON
    };
 
+   /// Sink which receives produced JSON in chunks during object conversion
+   using JsonSink_t = std::function<void(const char *, std::size_t)>;
+
    TBufferJSON(TBuffer::EMode mode = TBuffer::kWrite);
    ~TBufferJSON() override;
 
    void SetCompact(int level);
+   void SetOutputSink(const JsonSink_t &sink, Int_t chunk_size = 0x10000);
    void SetTypenameTag(const char *tag = "_typename");
    void SetTypeversionTag(const char *tag = nullptr);
    void SetSkipClassInfo(const TClass *cl);
@@ -65,6 +71,8 @@ public:
    ConvertToJSON(const void *obj, const TClass *cl, Int_t compact = 0, const char *member_name = nullptr);
    static TString ConvertToJSON(const void *obj, TDataMember *member, Int_t compact = 0, Int_t arraylen = -1);
 
+   static Bool_t ConvertToJSON(const void *obj, const TClass *cl, const JsonSink_t &sink, Int_t compact = 0);
+
    static Int_t ExportToFile(const char *filename, const TObject *obj, const char *option = nullptr);
    static Int_t ExportToFile(const char *filename, const void *obj, const TClass *cl, const char *option = nullptr);
 
@@ -296,6 +304,8 @@ protected:
 
    void AppendOutput(const char *line0, const char *line1 = nullptr);
 
+   void FlushSink();
+
    void JsonPushValue();
 
    template <typename T>
@@ -328,6 +338,9 @@ protected:
    TString fTypeNameTag;               ///<! JSON member used for storing class name, when empty - no class name will be stored
    TString fTypeVersionTag;            ///<! JSON member used to store class version, default empty
    std::vector<const TClass *> fSkipClasses; ///<! list of classes, which class info is not stored
+   JsonSink_t fOutputSink;             ///<!  when configured, produced JSON is delivered here in chunks
+   Int_t fSinkChunkSize{0x10000};      ///<!  accumulated output size which triggers handover to the sink
+   Bool_t fSinkFlushed{kFALSE};        ///<!  true when at least one chunk was delivered to the sink
 
    ClassDefOverride(TBufferJSON, 0) // a specialized TBuffer to only write objects into JSON format
 };
@@ -62,6 +62,7 @@ public:
    ~TDirectoryFile() override;
 
           void        Append(TObject *obj, Bool_t replace = kFALSE) override;
+          void        Append(TObject *const *objs, Int_t n, Bool_t replace = kFALSE) override;
           void        Add(TObject *obj, Bool_t replace = kFALSE) override { Append(obj,replace); }
           Int_t       AppendKey(TKey *key) override;
           void        Browse(TBrowser *b) override;
@@ -22,6 +22,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <atomic>
+#include <future>
 #include <string>
 #include <cstdint>
 
@@ -443,6 +444,7 @@ private:
    Int_t    fCompress{0};    ///< Compression level and algorithm
    Int_t    fNetOpt{0};      ///< Network options
    TFile   *fFile{nullptr};  ///< TFile instance of the file being opened
+   std::future<TFile *> fFuture; ///<! Result of an open running on the background opener service
 
    TFileOpenHandle(TFile *f) : TNamed("",""), fOpt(""), fCompress(ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault),
                                fNetOpt(0), fFile(f) { }
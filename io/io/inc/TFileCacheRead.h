@@ -29,6 +29,7 @@ protected:
 
    Long64_t       fBytesRead;        ///< Number of bytes read for this cache
    Long64_t       fBytesReadExtra;   ///< Number of extra bytes (overhead) read by the readahead buffer
+   Long64_t       fGapBytesBridged;  ///<! Gap bytes read only to coalesce neighbouring blocks into fewer requests
    Int_t          fReadCalls;        ///< Number of read calls for this cache
    Long64_t       fNoCacheBytesRead; ///< Number of bytes read by basket to fill cached tree
    Int_t          fNoCacheReadCalls; ///< Number of read calls by basket to fill cached tree
@@ -39,6 +40,7 @@ protected:
    Int_t          fNseek;            ///< Number of blocks to be prefetched
    Int_t          fNtot;             ///< Total size of prefetched blocks
    Int_t          fNb;               ///< Number of long buffers
+   Int_t          fMaxCoalescedGap;  ///<! Largest gap in bytes bridged when coalescing sorted blocks into one long buffer
    Int_t          fSeekSize;         ///< Allocated size of fSeek
    Long64_t      *fSeek;             ///<[fNseek] Position on file of buffers to be prefetched
    Long64_t      *fSeekSort;         ///<[fNseek] Position on file of buffers to be prefetched (sorted)
@@ -89,6 +91,8 @@ public:
    virtual Long64_t    GetBytesRead() const { return fBytesRead; }
    virtual Long64_t    GetNoCacheBytesRead() const { return fNoCacheBytesRead; }
    virtual Long64_t    GetBytesReadExtra() const { return fBytesReadExtra; }
+           Long64_t    GetGapBytesBridged() const { return fGapBytesBridged; } // Return the gap bytes read only to coalesce blocks.
+           Int_t       GetMaxCoalescedGap() const { return fMaxCoalescedGap; } // Return the largest gap bridged when coalescing blocks.
            TFile      *GetFile() const { return fFile; }   // Return the TFile being cached.
            Int_t       GetNseek() const { return fNseek; } // Return the number of blocks in the current cache.
            Int_t       GetNtot() const { return fNtot; }   // Return the total size of the prefetched blocks.
@@ -109,6 +113,7 @@ public:
    virtual Int_t       ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Int_t       SetBufferSize(Long64_t buffersize);
    virtual void        SetFile(TFile *file, TFile::ECacheAction action = TFile::kDisconnect);
+   virtual void        SetMaxCoalescedGap(Int_t maxgap) { fMaxCoalescedGap = maxgap > 0 ? maxgap : 0; }
    virtual void        SetSkipZip(Bool_t /*skip*/ = kTRUE) {} // This function is only used by TTreeCacheUnzip (ignore it)
    virtual void        Sort();
    virtual void        SecondSort();                          //Method used to sort and merge the chunks in the second block
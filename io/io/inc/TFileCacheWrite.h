@@ -25,6 +25,9 @@ protected:
    TFile        *fFile;           ///< Pointer to file
    char         *fBuffer;         ///< [fBufferSize] buffer of contiguous prefetched blocks
    Bool_t        fRecursive;      ///< flag to avoid recursive calls
+   Bool_t        fEagerWriteback; ///<! if true, hand each flushed range to the kernel writeback right away (local files, Linux only)
+
+   virtual void  ReleaseToDisk(Long64_t pos, Int_t len);
 
 private:
    TFileCacheWrite(const TFileCacheWrite &) = delete;            //cannot be copied
@@ -36,6 +39,8 @@ public:
    ~TFileCacheWrite() override;
    virtual Bool_t      Flush();
    virtual Int_t       GetBytesInCache() const { return fNtot; }
+           Bool_t      IsEagerWriteback() const { return fEagerWriteback; }
+   virtual void        SetEagerWriteback(Bool_t flag = kTRUE) { fEagerWriteback = flag; }
            void        Print(Option_t *option="") const override;
    virtual Int_t       ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Int_t       WriteBuffer(const char *buf, Long64_t pos, Int_t len);
@@ -60,6 +60,7 @@ protected:
    Int_t          fMaxOpenedFiles;            ///< Maximum number of files opened at the same time by the TFileMerger
    Bool_t         fLocal;                     ///< Makes local copies of merging files if True (default is kTRUE)
    Bool_t         fHistoOneGo;                ///< Merger histos in one go (default is kTRUE)
+   Bool_t         fParallelMerge{kFALSE};     ///< True if merging should be partitioned by top-level name and run on the implicit MT pool
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
@@ -69,6 +70,8 @@ protected:
    Bool_t         OpenExcessFiles();
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
    virtual Bool_t MergeRecursive(TDirectory *target, TList *sourcelist, Int_t type = kRegular | kAll);
+   Bool_t         CanMergeParallel(Int_t type) const;
+   Bool_t         MergeParallel(TDirectory *target, TList *sourcelist, Int_t type);
 
    virtual Bool_t MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
                 TFileMergeInfo &info, TString &oldkeyname, THashList &allNames, Bool_t &status, Bool_t &onlyListed,
@@ -133,6 +136,12 @@ public:
    virtual Bool_t Merge(Bool_t = kTRUE);
    virtual Bool_t PartialMerge(Int_t type = kAll | kIncremental);
    virtual void   SetFastMethod(Bool_t fast=kTRUE)  {fFastMethod = fast;}
+           /// Request that a full non-incremental merge is partitioned by top-level
+           /// name and executed concurrently on the implicit multi-threading pool.
+           /// Requires ROOT::EnableImplicitMT(); each worker reopens every input by
+           /// name, so roughly pool-size times more file descriptors are used.
+           void   SetParallelMerge(Bool_t parallel = kTRUE) { fParallelMerge = parallel; }
+           Bool_t GetParallelMerge() const { return fParallelMerge; }
            Bool_t GetNotrees() const { return fNoTrees; }
    virtual void   SetNotrees(Bool_t notrees=kFALSE) {fNoTrees = notrees;}
            void   RecursiveRemove(TObject *obj) override;
@@ -46,6 +46,13 @@ private:
    TStopwatch  fWaitTime;                   ///< time waiting to prefetch a buffer (in usec)
    Bool_t      fThreadJoined;               ///< mark if async thread was joined
    std::atomic<Bool_t> fPrefetchFinished;   ///< true if prefetching is over
+   Long64_t    fLastOffset{0};              ///< offset of the most recent observed access
+   Long64_t    fLastStride{0};              ///< stride between the two most recent observed accesses
+   Int_t       fRegimeLength{0};            ///< number of consecutive accesses following the current stride
+   Int_t       fWindow{0};                  ///< readahead window in segments, feedback controlled
+   Long64_t    fReadaheadNext{0};           ///< first position of the stride grid not yet scheduled
+   Long64_t    fReadaheadHits{0};           ///< accesses served from self-scheduled readahead
+   Long64_t    fReadaheadMisses{0};         ///< observed accesses which had to be read synchronously
 
    static TThread::VoidRtnFunc_t ThreadProc(void*);  //create a joinable worker thread
 
@@ -61,6 +68,10 @@ public:
 
    void      AddReadBlock(TFPBlock*);
    Bool_t    ReadBuffer(char*, Long64_t, Int_t);
+   Bool_t    ReadBufferNonBlocking(char*, Long64_t, Int_t);
+   void      ObserveAccess(Long64_t offset, Int_t len);
+   Long64_t  GetReadaheadHits() const { return fReadaheadHits; }
+   Long64_t  GetReadaheadMisses() const { return fReadaheadMisses; }
    void      ReadBlock(Long64_t*, Int_t*, Int_t);
    TFPBlock *CreateBlockObj(Long64_t*, Int_t*, Int_t);
 
@@ -68,6 +79,7 @@ public:
    Int_t     ThreadStart();
 
    Bool_t    SetCache(const char*);
+   TString   GetBlockPathInCache(TFPBlock*);
    Bool_t    CheckBlockInCache(char*&, TFPBlock*);
    char     *GetBlockFromCache(const char*, Int_t);
    void      SaveBlockInCache(TFPBlock*);
@@ -392,6 +392,12 @@ public:
    // Return the address of the value at index 'idx'.
    void *At(UInt_t idx) override;
 
+   // Return the element count and the address of the contiguous data block, or -1.
+   Long64_t GetContiguousData(void *&data) override;
+
+   // Bulk access to the inner buffers and offsets of a collection of collections.
+   Bool_t GetNestedData(std::vector<void *> &innerData, std::vector<UInt_t> &offsets) override;
+
    // Clear the container.
    void Clear(const char *opt = "") override;
 
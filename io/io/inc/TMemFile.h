@@ -16,6 +16,8 @@
 #include <vector>
 #include <memory>
 
+class TCollection;
+
 class TMemFile : public TFile {
 public:
    using ExternalDataPtr_t = std::shared_ptr<const std::vector<char>>;
@@ -97,6 +99,8 @@ public:
    TMemFile(const TMemFile &orig);
    ~TMemFile() override;
 
+   virtual Long64_t BulkWrite(const TCollection &objects);
+   virtual Int_t    BulkRead(TList &objects);
    virtual Long64_t CopyTo(void *to, Long64_t maxsize) const;
    virtual void     CopyTo(TBuffer &tobuf) const;
            Long64_t GetSize() const override;
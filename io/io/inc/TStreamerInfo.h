@@ -145,6 +145,8 @@ public:
    void                BuildCheck(TFile *file = nullptr, Bool_t load = kTRUE) override;
    void                BuildEmulated(TFile *file) override;
    void                BuildOld() override;
+   static void         PreBuild(TClass *cl);
+   static void         PreBuildAsync(TClass *cl);
    Bool_t              BuildFor( const TClass *cl ) override;
    void                CallShowMembers(const void* obj, TMemberInspector &insp, Bool_t isTransient) const override;
    void                Clear(Option_t * = "") override;
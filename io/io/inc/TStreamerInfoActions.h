@@ -213,6 +213,7 @@ namespace TStreamerInfoActions {
 
       void AddToOffset(Int_t delta);
       void SetMissing();
+      void FuseBasicTypeReads();
 
       TActionSequence *CreateCopy();
       static TActionSequence *CreateReadMemberWiseActions(TVirtualStreamerInfo *info, TVirtualCollectionProxy &proxy);
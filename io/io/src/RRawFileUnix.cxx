@@ -98,7 +98,11 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    thread_local bool uring_failed = false;
    if (!uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
+         // Create the ring once and keep it alive for the lifetime of the file.  Page sources issue many
+         // ReadV batches per cluster bunch; reusing the ring avoids the setup/teardown syscalls and the
+         // memlock'ed memory allocation on every call and lets consecutive batches overlap in the kernel.
+         if (!fIoUring)
+            fIoUring = std::make_unique<RIoUring>(); // throws std::runtime_error
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -109,7 +113,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         fIoUring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
@@ -120,6 +124,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
          Warning("RRawFileUnix",
               "io_uring setup failed, falling back to blocking I/O in ReadV");
          uring_failed = true;
+         fIoUring.reset();
       }
    }
 #endif
@@ -18,6 +18,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 */
 
 #include <string.h>
+#include <cstdlib>
 #include <typeinfo>
 #include <string>
 #include <limits>
@@ -115,6 +116,121 @@ TBufferFile::~TBufferFile()
 {
 }
 
+namespace {
+
+/// Reallocation routine for pooled buffers (which are malloc'ed, not new[]'ed):
+/// `realloc` lets the allocator extend large blocks in place (on Linux via
+/// mremap), so growing a buffer does not copy the bytes already written.
+/// Mirrors the TStorage::ReAllocChar contract: with oldsize the tail is
+/// zeroed, with oldsize == 0 (no copy requested) the whole block is zeroed.
+char *R__PoolReAllocChar(char *ovp, size_t size, size_t oldsize)
+{
+   char *vp = (char *)::realloc(ovp, size);
+   if (!vp) {
+      ::Fatal("R__PoolReAllocChar", "problems reallocating %ld bytes", (Long_t)size);
+      return nullptr;
+   }
+   if (size > oldsize)
+      memset(vp + oldsize, 0, size - oldsize);
+   return vp;
+}
+
+/// Per-thread pool of retired buffer allocations, so that repeatedly
+/// serializing large events reuses the same (already grown) allocation
+/// instead of starting from scratch each time.
+struct R__BufferPool {
+   enum { kMaxEntries = 4 };
+   struct Entry {
+      char  *fPtr;
+      size_t fSize;
+   };
+   Entry fEntries[kMaxEntries];
+   Int_t fCount = 0;
+
+   ~R__BufferPool()
+   {
+      for (Int_t i = 0; i < fCount; ++i)
+         ::free(fEntries[i].fPtr);
+   }
+
+   /// Hand out the largest pooled allocation (growing is what we want to
+   /// avoid), or a fresh one if the pool is empty. On return `size` is the
+   /// usable capacity of the returned block.
+   char *Acquire(size_t &size)
+   {
+      Int_t best = -1;
+      for (Int_t i = 0; i < fCount; ++i)
+         if (best < 0 || fEntries[i].fSize > fEntries[best].fSize)
+            best = i;
+      if (best >= 0) {
+         char  *ptr = fEntries[best].fPtr;
+         size_t cap = fEntries[best].fSize;
+         fEntries[best] = fEntries[--fCount];
+         if (cap >= size)
+            size = cap;
+         else
+            ptr = R__PoolReAllocChar(ptr, size, 0);
+         return ptr;
+      }
+      char *ptr = (char *)::malloc(size);
+      if (!ptr)
+         ::Fatal("R__BufferPool::Acquire", "problems allocating %ld bytes", (Long_t)size);
+      memset(ptr, 0, size);
+      return ptr;
+   }
+
+   void Release(char *ptr, size_t size)
+   {
+      if (!ptr)
+         return;
+      if (fCount < kMaxEntries)
+         fEntries[fCount++] = {ptr, size};
+      else
+         ::free(ptr);
+   }
+};
+
+R__BufferPool &GetBufferPool()
+{
+   thread_local R__BufferPool pool;
+   return pool;
+}
+
+/// A TBufferFile whose storage is borrowed from the calling thread's buffer
+/// pool and handed back on destruction. Only reachable through
+/// TBufferFile::AcquireFromPool.
+class TPooledBufferFile final : public TBufferFile {
+public:
+   TPooledBufferFile(TBuffer::EMode mode, Int_t bufsiz, char *buf)
+      : TBufferFile(mode, bufsiz, buf, kFALSE /* adopt */, R__PoolReAllocChar)
+   {
+   }
+   ~TPooledBufferFile() override { GetBufferPool().Release(Buffer(), (size_t)BufferSize()); }
+};
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create an I/O buffer whose storage comes from a per-thread pool of
+/// recycled allocations and is returned to it when the buffer is destroyed.
+///
+/// Growing such a buffer goes through `realloc`, which for large blocks
+/// typically extends the mapping in place instead of copying the bytes
+/// already streamed; together with the recycling this makes the pooled
+/// buffers suitable for serializing many large events in a row, where the
+/// reallocation and copy cost of a plain TBufferFile becomes visible.
+/// The returned buffer owns its storage for its whole lifetime: do not call
+/// SetBuffer() on it or hold on to Buffer() past its destruction.
+
+std::unique_ptr<TBufferFile> TBufferFile::AcquireFromPool(TBuffer::EMode mode, Int_t bufsiz)
+{
+   if (bufsiz < TBuffer::kMinimalSize)
+      bufsiz = TBuffer::kMinimalSize;
+   size_t size = (size_t)bufsiz;
+   char *buf = GetBufferPool().Acquire(size);
+   return std::unique_ptr<TBufferFile>(new TPooledBufferFile(mode, (Int_t)size, buf));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment level.
 
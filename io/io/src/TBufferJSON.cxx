@@ -576,6 +576,20 @@ void TBufferJSON::SetCompact(int level)
       fTypeNameTag = "_typename";
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Configures sink which will receive produced JSON in chunks
+/// Instead of collecting the complete document in one string, output is handed
+/// to the sink each time roughly chunk_size bytes have accumulated; the internal
+/// buffer is reused between chunks and never grows beyond the chunk size plus
+/// one append. With a sink configured, StoreObject() returns an empty TString.
+
+void TBufferJSON::SetOutputSink(const JsonSink_t &sink, Int_t chunk_size)
+{
+   fOutputSink = sink;
+   fSinkChunkSize = (chunk_size > 0) ? chunk_size : 0x10000;
+   fSinkFlushed = kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Configures _typename tag in JSON structures
 /// By default "_typename" field in JSON structures used to store class information
@@ -719,6 +733,16 @@ TString TBufferJSON::StoreObject(const void *obj, const TClass *cl)
       Error("StoreObject", "Can not store object into TBuffer for reading");
    }
 
+   if (fOutputSink) {
+      // Hand over the remainder; special top-level classes keep their output in
+      // fValue and never trigger intermediate flushes.
+      if (fOutBuffer.Length())
+         FlushSink();
+      else if (!fSinkFlushed && fValue.Length())
+         fOutputSink(fValue.Data(), (std::size_t)fValue.Length());
+      return TString();
+   }
+
    return fOutBuffer.Length() ? fOutBuffer : fValue;
 }
 
@@ -752,6 +776,38 @@ TString TBufferJSON::ConvertToJSON(const void *ptr, TDataMember *member, Int_t c
    return buf.JsonWriteMember(ptr, member, mcl, arraylen);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Converts object to JSON, delivering the output to the provided sink in chunks
+/// Unlike the TString-returning variants, the complete document is never held in
+/// memory: each time roughly 64 KB (or the chunk size given to SetOutputSink)
+/// have accumulated they are handed to the sink and the buffer is reused, which
+/// keeps the peak allocation independent of the object size. The sink may write
+/// the chunks to a socket, a file or an HTTP response.
+/// Returns kTRUE when conversion was performed.
+
+Bool_t TBufferJSON::ConvertToJSON(const void *obj, const TClass *cl, const JsonSink_t &sink, Int_t compact)
+{
+   if (!sink)
+      return kFALSE;
+
+   TClass *clActual = obj ? cl->GetActualClass(obj) : nullptr;
+   const void *actualStart = obj;
+   if (clActual && (clActual != cl)) {
+      actualStart = (char *)obj - clActual->GetBaseClassOffset(cl);
+   } else {
+      clActual = const_cast<TClass *>(cl);
+   }
+
+   TBufferJSON buf;
+
+   buf.SetCompact(compact);
+   buf.SetOutputSink(sink);
+
+   buf.StoreObject(actualStart, clActual);
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Convert object into JSON and store in text file
 /// Returns size of the produce file
@@ -1187,6 +1243,25 @@ void TBufferJSON::AppendOutput(const char *line0, const char *line1)
          fOutput->Append(line1);
       }
    }
+
+   // Already-appended output is never modified afterwards, therefore it can be
+   // handed to a configured sink as soon as enough of it has accumulated. Only
+   // the main buffer is flushed - redirected per-object buffers become values.
+   if (fOutputSink && (fOutput == &fOutBuffer) && (fOutBuffer.Length() >= fSinkChunkSize))
+      FlushSink();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Deliver accumulated output to the configured sink and reuse the buffer
+
+void TBufferJSON::FlushSink()
+{
+   if (!fOutputSink || !fOutBuffer.Length())
+      return;
+
+   fOutputSink(fOutBuffer.Data(), (std::size_t)fOutBuffer.Length());
+   fSinkFlushed = kTRUE;
+   fOutBuffer.Clear(); // keeps the allocation for the next chunk
 }
 
 ////////////////////////////////////////////////////////////////////////////////
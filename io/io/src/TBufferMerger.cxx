@@ -75,7 +75,45 @@ void TBufferMerger::SetMergeOptions(const TString& options)
 
 void TBufferMerger::Merge(ROOT::TBufferMergerFile *memfile)
 {
-   std::lock_guard q(fMergeMutex);
+   if (fMaxPendingFiles == 0) {
+      std::lock_guard q(fMergeMutex);
+      MergeImpl(memfile);
+      return;
+   }
+
+   // Hand the snapshot to the bounded pending list; block only when the list
+   // is full so that the memory held in unmerged snapshots stays bounded.
+   bool done = false;
+   {
+      std::unique_lock q(fQueueMutex);
+      fCv.wait(q, [this] { return fPending.size() < fMaxPendingFiles; });
+      fPending.emplace_back(memfile, &done);
+   }
+   fCv.notify_all();
+
+   // Whichever producer acquires the merge lock drains the pending list on
+   // behalf of the others; everybody else waits until its own file is merged.
+   std::unique_lock q(fQueueMutex);
+   while (!done) {
+      if (fMergeMutex.try_lock()) {
+         while (!fPending.empty()) {
+            auto item = fPending.front();
+            fPending.pop_front();
+            q.unlock();
+            MergeImpl(item.first);
+            q.lock();
+            *item.second = true;
+         }
+         fMergeMutex.unlock();
+         fCv.notify_all();
+      } else {
+         fCv.wait(q);
+      }
+   }
+}
+
+void TBufferMerger::MergeImpl(ROOT::TBufferMergerFile *memfile)
+{
    memfile->WriteStreamerInfo();
    fMerger.AddFile(memfile);
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
@@ -220,6 +220,26 @@ void TDirectoryFile::Append(TObject *obj, Bool_t replace /* = kFALSE */)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Append n objects to this directory in a single registration transaction.
+///
+/// \see TDirectory::Append(TObject *const *, Int_t, Bool_t)
+
+void TDirectoryFile::Append(TObject *const *objs, Int_t n, Bool_t replace /* = kFALSE */)
+{
+   if (!objs || n <= 0 || !fList) return;
+
+   TDirectory::Append(objs, n, replace);
+
+   if (!fMother) return;
+   if (fMother->IsA() == TMapFile::Class()) {
+      TMapFile *mfile = (TMapFile*)fMother;
+      for (Int_t i = 0; i < n; i++)
+         if (objs[i])
+            mfile->Add(objs[i]);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Insert key in the linked list of keys of this directory.
 
@@ -150,7 +150,12 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TThreadSlots.h"
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <thread>
 #include <inttypes.h>
 
 #ifdef R__FBSD
@@ -627,6 +632,10 @@ void TFile::Init(Bool_t create)
       return;
    }
 
+   // Temporary read cache used to coalesce the metadata reads of the open
+   // sequence; declared here so the zombie path below can clean it up.
+   TFileCacheRead *openCache = nullptr;
+
    if (fArchive) {
       if (fOption != "READ") {
          Error("Init", "archive %s can only be opened in read mode", GetName());
@@ -838,6 +847,17 @@ void TFile::Init(Bool_t create)
       if (gEnv->GetValue("TFile.v630forwardCompatibility", 0) == 1)
          SetBit(k630forwardCompatibility);
 
+      //*-* -------------Prefetch the top directory key list and the StreamerInfo
+      //*-* -------------record in one vectored read: both locations are known from
+      //*-* -------------the header just parsed, so a remote open pays a single
+      //*-* -------------round trip for them instead of two sequential ones.
+      if (!fCacheRead && fSeekKeys > fBEGIN && fNbytesKeys > 0 && fEND <= size &&
+          fgReadInfo && fSeekInfo > fBEGIN && fNbytesInfo > 0) {
+         openCache = new TFileCacheRead(this, fNbytesKeys + fNbytesInfo + 512);
+         openCache->Prefetch(fSeekKeys, fNbytesKeys);
+         openCache->Prefetch(fSeekInfo, fNbytesInfo);
+      }
+
       //*-* -------------Read keys of the top directory
       if (fSeekKeys > fBEGIN && fEND <= size) {
          //normal case. Recover only if file has no keys
@@ -932,9 +952,18 @@ void TFile::Init(Bool_t create)
       fProcessIDs = new TObjArray(fNProcessIDs+1);
    }
 
+   if (openCache) {
+      SetCacheRead(nullptr);
+      delete openCache;
+   }
+
    return;
 
 zombie:
+   if (openCache) {
+      SetCacheRead(nullptr);
+      delete openCache;
+   }
    if (fGlobalRegistration) {
       R__LOCKGUARD(gROOTMutex);
       gROOT->GetListOfClosedObjects()->Add(this);
@@ -4005,6 +4034,69 @@ TFile *TFile::Open(const char *url, Option_t *options, const char *ftitle,
    return f;
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process-wide service running file opens in the background for
+/// TFile::AsyncOpen. A bounded number of worker threads (configurable with
+/// TFile.AsyncOpenWorkers, default 4) consume a queue of open requests.
+/// Workers are started lazily on first use and detached; the service is
+/// intentionally leaked so that workers blocked on the queue never have to be
+/// joined during static destruction.
+
+class TAsyncOpenPool {
+public:
+   static TAsyncOpenPool &Instance()
+   {
+      static TAsyncOpenPool *pool = new TAsyncOpenPool;
+      return *pool;
+   }
+
+   std::future<TFile *> Submit(std::function<TFile *()> openFunc)
+   {
+      std::packaged_task<TFile *()> task(std::move(openFunc));
+      std::future<TFile *> result = task.get_future();
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fTasks.emplace_back(std::move(task));
+         if (fNThreads < fMaxThreads && fTasks.size() > (size_t)fIdleThreads) {
+            std::thread([this] { this->Run(); }).detach();
+            fNThreads++;
+         }
+      }
+      fCond.notify_one();
+      return result;
+   }
+
+private:
+   TAsyncOpenPool() : fMaxThreads(std::max(1, gEnv->GetValue("TFile.AsyncOpenWorkers", 4))) {}
+
+   void Run()
+   {
+      while (true) {
+         std::packaged_task<TFile *()> task;
+         {
+            std::unique_lock<std::mutex> lock(fMutex);
+            fIdleThreads++;
+            fCond.wait(lock, [this] { return !fTasks.empty(); });
+            fIdleThreads--;
+            task = std::move(fTasks.front());
+            fTasks.pop_front();
+         }
+         task();
+      }
+   }
+
+   Int_t fMaxThreads;
+   Int_t fNThreads = 0;
+   Int_t fIdleThreads = 0;
+   std::mutex fMutex;
+   std::condition_variable fCond;
+   std::deque<std::packaged_task<TFile *()>> fTasks;
+};
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Submit an asynchronous open request.
 
@@ -4023,10 +4115,14 @@ TFile *TFile::Open(const char *url, Option_t *options, const char *ftitle,
 ///
 ///     TFile::Open(const char *, ...)
 ///
-/// To be effective, the underlying TFile implementation must be able to
-/// support asynchronous open functionality. Currently, only TNetXNGFile
-/// supports it. If the functionality is not implemented, this call acts
-/// transparently by returning an handle with the arguments for the
+/// The underlying TFile implementation may support native asynchronous open
+/// functionality; currently only TNetXNGFile does. For all other protocols,
+/// when thread safety has been enabled with ROOT::EnableThreadSafety(), the
+/// standard open is run on a process-wide background opener service with a
+/// bounded number of worker threads (configurable with the
+/// TFile.AsyncOpenWorkers resource, default 4), so that the open latency is
+/// hidden behind the caller's computation. Without thread safety this call
+/// acts transparently by returning an handle with the arguments for the
 /// standard synchronous open run by TFile::Open(TFileOpenHandle *).
 /// The retuned handle will be adopted by TFile after opening completion
 /// in TFile::Open(TFileOpenHandle *); if opening is not finalized the
@@ -4105,6 +4201,17 @@ TFileOpenHandle *TFile::AsyncOpen(const char *url, Option_t *option,
       // Save the arguments in the handler, so that a standard open can be
       // attempted later on
       fh = new TFileOpenHandle(name, option, ftitle, compress, netopt);
+      // When thread safety is enabled, run the standard open on the
+      // background opener service; otherwise it will happen synchronously
+      // in TFile::Open(TFileOpenHandle *)
+      if (gGlobalMutex) {
+         TString aname(name);
+         TString aopt(option);
+         TString atitle(ftitle);
+         fh->fFuture = TAsyncOpenPool::Instance().Submit([aname, aopt, atitle, compress, netopt]() -> TFile * {
+            return TFile::Open(aname.Data(), aopt.Data(), atitle.Data(), compress, netopt);
+         });
+      }
    } else if (f) {
       // Fill the opaque handler to be use to attach the file later on
       fh = new TFileOpenHandle(f);
@@ -4137,8 +4244,11 @@ TFile *TFile::Open(TFileOpenHandle *fh)
       // Remove it from the pending list: we need to do it at this level to avoid
       // recursive calls in the standard TFile::Open
       fgAsyncOpenRequests->Remove(fh);
-      // Was asynchronous open functionality implemented?
-      if ((f = fh->GetFile()) && !(f->IsZombie())) {
+      // Was the open dispatched to the background opener service?
+      if (fh->fFuture.valid()) {
+         // Yes: block here until the background open has completed
+         f = fh->fFuture.get();
+      } else if ((f = fh->GetFile()) && !(f->IsZombie())) {
          // Yes: wait for the completion of the open phase, if needed
          Bool_t cr = (!strcmp(f->GetOption(),"CREATE") ||
                       !strcmp(f->GetOption(),"RECREATE") ||
@@ -4612,6 +4722,14 @@ TFile::EAsyncOpenStatus TFile::GetAsyncOpenStatus(const char* name)
 
 TFile::EAsyncOpenStatus TFile::GetAsyncOpenStatus(TFileOpenHandle *handle)
 {
+   if (handle && handle->fFuture.valid()) {
+      // The open is running on the background opener service. A completed
+      // open is reported as successful here; a failure surfaces when the
+      // result is retrieved with TFile::Open(TFileOpenHandle *).
+      return handle->fFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready ? TFile::kAOSSuccess
+                                                                                            : TFile::kAOSInProgress;
+   }
+
    if (handle && handle->fFile) {
       if (!handle->fFile->IsZombie())
          return handle->fFile->GetAsyncOpenStatus();
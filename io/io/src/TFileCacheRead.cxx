@@ -46,11 +46,13 @@ TFileCacheRead::TFileCacheRead() : TObject()
    fBytesRead   = 0;
    fNoCacheBytesRead = 0;
    fBytesReadExtra = 0;
+   fGapBytesBridged = 0;
    fReadCalls   = 0;
    fNoCacheReadCalls = 0;
    fNseek       = 0;
    fNtot        = 0;
    fNb          = 0;
+   fMaxCoalescedGap = 0;
    fSeekSize    = 0;
    fSeek        = 0;
    fSeekIndex   = 0;
@@ -101,11 +103,16 @@ TFileCacheRead::TFileCacheRead(TFile *file, Int_t buffersize, TObject *tree)
    fBytesRead   = 0;
    fNoCacheBytesRead = 0;
    fBytesReadExtra = 0;
+   fGapBytesBridged = 0;
    fReadCalls   = 0;
    fNoCacheReadCalls = 0;
    fNseek       = 0;
    fNtot        = 0;
    fNb          = 0;
+   // Bridging small gaps between sorted blocks trades a few extra bytes for
+   // far fewer requests; this matters most on high-latency (WAN) connections.
+   fMaxCoalescedGap = gEnv->GetValue("TFile.CacheMaxCoalescedGap", 0);
+   if (fMaxCoalescedGap < 0) fMaxCoalescedGap = 0;
    fSeekSize    = 10000;
    fSeek        = new Long64_t[fSeekSize];
    fSeekIndex   = new Int_t[fSeekSize];
@@ -335,6 +342,10 @@ void TFileCacheRead::Print(Option_t *option) const
    else
       printf("Average transaction................: No read calls yet\n");
    printf("Number of blocks in current cache..: %d, total size: %d\n",fNseek,fNtot);
+   if (fIsSorted && fNb > 0)
+      printf("Coalesced read requests............: %d, average size: %f Kbytes\n",fNb,0.001*Double_t(fNtot)/Double_t(fNb));
+   if (fMaxCoalescedGap > 0)
+      printf("Gap bytes read when coalescing.....: %lld (bridging gaps up to %d bytes)\n",fGapBytesBridged,fMaxCoalescedGap);
    if (fPrefetch){
      printf("Prefetching .......................: %lli blocks\n", fPrefetchedBlocks);
      printf("Prefetching Wait Time..............: %f seconds\n", fPrefetch->GetWaitTime() / 1e+6);
@@ -441,6 +452,14 @@ Int_t TFileCacheRead::ReadBufferExtPrefetch(char *buf, Long64_t pos, Int_t len,
       }
    }
 
+   // The range was never scheduled: try the adaptive readahead before falling
+   // back to a synchronous read, and let it observe the miss either way.
+   if (buf && fPrefetch) {
+      if (fPrefetch->ReadBufferNonBlocking(buf, pos, len))
+         return 1;
+      fPrefetch->ObserveAccess(pos, len);
+   }
+
    return 0;
 }
 
@@ -568,6 +587,12 @@ void TFileCacheRead::SetFile(TFile *file, TFile::ECacheAction action)
 ////////////////////////////////////////////////////////////////////////////////
 /// Sort buffers to be prefetched in increasing order of positions.
 /// Merge consecutive blocks if necessary.
+///
+/// Blocks separated by no more than fMaxCoalescedGap bytes (see
+/// SetMaxCoalescedGap, default 0) are also merged into a single read:
+/// the gap bytes are read into the cache buffer and ignored. On
+/// high-latency connections a modest gap tolerance can reduce the number
+/// of requests per cache fill by an order of magnitude.
 
 void TFileCacheRead::Sort()
 {
@@ -591,33 +616,43 @@ void TFileCacheRead::Sort()
       ++effectiveNseek;
    }
    fNseek = effectiveNseek;
-   if (fNtot > fBufferSizeMin) {
-      fBufferSize = fNtot + 100;
-      delete [] fBuffer;
-      fBuffer = 0;
-      // If ReadBufferAsync is not supported by this implementation
-      // it means that we are using sync primitives, hence we need the local buffer
-      if (!fAsyncReading)
-         fBuffer = new char[fBufferSize];
-   }
    fPos[0]  = fSeekSort[0];
    fLen[0]  = fSeekSortLen[0];
    fSeekPos[0] = 0;
+   Long64_t bridged = 0;
    for (i=1;i<fNseek;i++) {
       fSeekPos[i] = fSeekPos[i-1] + fSeekSortLen[i-1];
+      Long64_t gap = fSeekSort[i] - (fSeekSort[i-1]+fSeekSortLen[i-1]);
       //in the test below 16 MBytes is pure empirirical and may depend on the file system.
       //increasing this number must be done with care, as it may increase
       //the job real time (mismatch with OS buffers)
-      if ((fSeekSort[i] != fSeekSort[i-1]+fSeekSortLen[i-1]) ||
-          (fLen[nb] > 16000000)) {
+      if (gap == 0 && fLen[nb] <= 16000000) {
+         fLen[nb] += fSeekSortLen[i];
+      } else if (gap > 0 && gap <= fMaxCoalescedGap && fLen[nb] <= 16000000) {
+         // Bridge the gap: the gap bytes are read into fBuffer between the two
+         // blocks, so the buffer positions must account for them
+         fSeekPos[i] += (Int_t)gap;
+         fLen[nb] += (Int_t)gap + fSeekSortLen[i];
+         bridged += gap;
+      } else {
          nb++;
          fPos[nb] = fSeekSort[i];
          fLen[nb] = fSeekSortLen[i];
-      } else {
-         fLen[nb] += fSeekSortLen[i];
       }
    }
    fNb = nb+1;
+   fGapBytesBridged += bridged;
+   // The buffer must also hold the bridged gap bytes, hence the allocation
+   // can only be done once the merging is known
+   if (fNtot + bridged > fBufferSizeMin) {
+      fBufferSize = fNtot + bridged + 100;
+      delete [] fBuffer;
+      fBuffer = 0;
+      // If ReadBufferAsync is not supported by this implementation
+      // it means that we are using sync primitives, hence we need the local buffer
+      if (!fAsyncReading)
+         fBuffer = new char[fBufferSize];
+   }
    fIsSorted = kTRUE;
 }
 
@@ -625,7 +660,8 @@ void TFileCacheRead::Sort()
 ////////////////////////////////////////////////////////////////////////////////
 /// Sort buffers to be prefetched in increasing order of positions.
 ///
-/// Merge consecutive blocks if necessary.
+/// Merge consecutive blocks if necessary, bridging gaps of up to
+/// fMaxCoalescedGap bytes as in Sort().
 
 void TFileCacheRead::SecondSort()
 {
@@ -649,33 +685,43 @@ void TFileCacheRead::SecondSort()
       ++effectiveNseek;
    }
    fBNseek = effectiveNseek;
-   if (fBNtot > fBufferSizeMin) {
-      fBufferSize = fBNtot + 100;
-      delete [] fBuffer;
-      fBuffer = 0;
-      // If ReadBufferAsync is not supported by this implementation
-      // it means that we are using sync primitives, hence we need the local buffer
-      if (!fAsyncReading)
-         fBuffer = new char[fBufferSize];
-   }
    fBPos[0]  = fBSeekSort[0];
    fBLen[0]  = fBSeekSortLen[0];
    fBSeekPos[0] = 0;
+   Long64_t bridged = 0;
    for (i=1;i<fBNseek;i++) {
       fBSeekPos[i] = fBSeekPos[i-1] + fBSeekSortLen[i-1];
+      Long64_t gap = fBSeekSort[i] - (fBSeekSort[i-1]+fBSeekSortLen[i-1]);
       //in the test below 16 MBytes is pure empirirical and may depend on the file system.
       //increasing this number must be done with care, as it may increase
       //the job real time (mismatch with OS buffers)
-      if ((fBSeekSort[i] != fBSeekSort[i-1]+fBSeekSortLen[i-1]) ||
-         (fBLen[nb] > 16000000)) {
+      if (gap == 0 && fBLen[nb] <= 16000000) {
+         fBLen[nb] += fBSeekSortLen[i];
+      } else if (gap > 0 && gap <= fMaxCoalescedGap && fBLen[nb] <= 16000000) {
+         // Bridge the gap: the gap bytes are read into fBuffer between the two
+         // blocks, so the buffer positions must account for them
+         fBSeekPos[i] += (Int_t)gap;
+         fBLen[nb] += (Int_t)gap + fBSeekSortLen[i];
+         bridged += gap;
+      } else {
          nb++;
          fBPos[nb] = fBSeekSort[i];
          fBLen[nb] = fBSeekSortLen[i];
-      } else {
-         fBLen[nb] += fBSeekSortLen[i];
       }
    }
    fBNb = nb+1;
+   fGapBytesBridged += bridged;
+   // The buffer must also hold the bridged gap bytes, hence the allocation
+   // can only be done once the merging is known
+   if (fBNtot + bridged > fBufferSizeMin) {
+      fBufferSize = fBNtot + bridged + 100;
+      delete [] fBuffer;
+      fBuffer = 0;
+      // If ReadBufferAsync is not supported by this implementation
+      // it means that we are using sync primitives, hence we need the local buffer
+      if (!fAsyncReading)
+         fBuffer = new char[fBufferSize];
+   }
    fBIsSorted = kTRUE;
 }
 
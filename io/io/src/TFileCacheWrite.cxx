@@ -29,6 +29,10 @@ The write cache is automatically created when writing a remote file
 #include "TFile.h"
 #include "TFileCacheWrite.h"
 
+#ifdef R__LINUX
+#include <fcntl.h>
+#endif
+
 ClassImp(TFileCacheWrite);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +46,7 @@ TFileCacheWrite::TFileCacheWrite() : TObject()
    fFile        = 0;
    fBuffer      = 0;
    fRecursive   = kFALSE;
+   fEagerWriteback = kFALSE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -59,6 +64,7 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
    fNtot        = 0;
    fFile        = file;
    fRecursive   = kFALSE;
+   fEagerWriteback = kFALSE;
    fBuffer      = new char[fBufferSize];
    if (file) file->SetCacheWrite(this);
    if (gDebug > 0) Info("TFileCacheWrite","Creating a write cache with buffersize=%d bytes",buffersize);
@@ -84,10 +90,41 @@ Bool_t TFileCacheWrite::Flush()
    fRecursive = kTRUE;
    Bool_t status = fFile->WriteBuffer(fBuffer, fNtot);
    fRecursive = kFALSE;
+   if (!status && fEagerWriteback) ReleaseToDisk(fSeekStart, fNtot);
    fNtot = 0;
    return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the given byte range of the file to the kernel writeback and ask for
+/// the ranges before it to be dropped from the page cache.
+///
+/// Called after each successful flush when eager writeback has been enabled
+/// with SetEagerWriteback.  Starting the writeback of every flushed range
+/// immediately spreads the disk traffic of a large sequential write over the
+/// whole job instead of accumulating gigabytes of dirty pages that the kernel
+/// then writes back in one long stall; dropping the already flushed ranges
+/// keeps the page cache from being monopolized by data that will not be read
+/// back.  Only plain local files have a file descriptor the calls can act on,
+/// and both calls are advisory: this never affects what ends up in the file.
+
+void TFileCacheWrite::ReleaseToDisk(Long64_t pos, Int_t len)
+{
+#if defined(R__LINUX) && defined(SYNC_FILE_RANGE_WRITE)
+   if (!fFile || fFile->IsA() != TFile::Class()) return;
+   Int_t fd = fFile->GetFd();
+   if (fd < 0) return;
+   // Start asynchronous writeback of the newly flushed range ...
+   sync_file_range(fd, pos, len, SYNC_FILE_RANGE_WRITE);
+   // ... and drop the ranges flushed before it from the page cache; their
+   // writeback was started by the previous call and has normally completed
+   // by now (posix_fadvise simply keeps dirty pages).
+   if (pos > 0) posix_fadvise(fd, 0, pos, POSIX_FADV_DONTNEED);
+#else
+   (void)pos; (void)len;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print class internal structure.
 
@@ -136,6 +173,7 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
          fFile->Seek(pos); // Flush may have changed this
          if (fFile->WriteBuffer(buf,len)) return -1;  // failure
          fRecursive = kFALSE;
+         if (fEagerWriteback) ReleaseToDisk(pos, len);
          return 1;
       }
    }
@@ -52,6 +52,15 @@ to be merged, like the standalone hadd program.
 #include <cstring>
 #include <map>
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#endif
+
 ClassImp(TFileMerger);
 
 TClassRef R__TH1_Class("TH1");
@@ -938,6 +947,191 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
    return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true when the requested merge can be partitioned by top-level name
+/// and run concurrently on the implicit multi-threading pool.
+///
+/// Only the plain, non-incremental full merge is partitionable: incremental and
+/// listed merges change the per-object behaviour and delayed writes expect the
+/// caller to finish the output. Every input must be reopenable by name so each
+/// worker can use private file handles, and none may carry TProcessIDs since
+/// raw stitching cannot remap TRef process ids.
+
+Bool_t TFileMerger::CanMergeParallel(Int_t type) const
+{
+#ifdef R__USE_IMT
+   if (!fParallelMerge || !ROOT::IsImplicitMTEnabled())
+      return kFALSE;
+   if ((type & (kIncremental | kOnlyListed | kSkipListed | kDelayWrite)) || ((type & kAll) != kAll))
+      return kFALSE;
+   if (fExcessFiles.GetEntries() > 0)
+      return kFALSE;
+   TIter next(&fFileList);
+   while (auto file = (TFile *)next()) {
+      if (file->InheritsFrom(TMemFile::Class()) || !file->GetName() || !*file->GetName())
+         return kFALSE;
+      if (file->GetNProcessIDs() > 0)
+         return kFALSE;
+   }
+   return kTRUE;
+#else
+   (void)type;
+   return kFALSE;
+#endif
+}
+
+#ifdef R__USE_IMT
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy all keys of a directory hierarchy into the target without decompressing
+/// or re-streaming the records.
+
+static Bool_t R__CopyKeysRaw(TDirectory *source, TDirectory *target)
+{
+   TIter nextkey(source->GetListOfKeys());
+   while (auto key = static_cast<TKey *>(nextkey())) {
+      TClass *cl = TClass::GetClass(key->GetClassName());
+      if (cl && cl->InheritsFrom(TDirectory::Class())) {
+         TDirectory *subsource = source->GetDirectory(key->GetName());
+         if (!subsource)
+            return kFALSE;
+         TDirectory *subtarget = target->GetDirectory(key->GetName());
+         if (!subtarget)
+            subtarget = target->mkdir(key->GetName(), key->GetTitle());
+         if (!subtarget || !R__CopyKeysRaw(subsource, subtarget))
+            return kFALSE;
+      } else {
+         TKey *newkey = new TKey(target, *key, 0 /* pidoffset */);
+         target->GetFile()->SumBuffer(newkey->GetObjlen());
+         newkey->WriteFile(0);
+         if (target->GetFile()->TestBit(TFile::kWriteError))
+            return kFALSE;
+      }
+   }
+   return kTRUE;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Merge all objects concurrently, partitioning the work by top-level name.
+///
+/// Each partition is merged by a private TFileMerger on the implicit
+/// multi-threading pool: the worker reopens every source by name, stages its
+/// result in a TMemFile with the compression of the output, and selects its
+/// share of the key space through the kOnlyListed machinery. The staging files
+/// are then stitched into the target by copying the compressed records. When
+/// the layout cannot be partitioned safely, or any worker fails before the
+/// output was touched, the merge falls back to MergeRecursive.
+
+Bool_t TFileMerger::MergeParallel(TDirectory *target, TList *sourcelist, Int_t type)
+{
+#ifndef R__USE_IMT
+   return MergeRecursive(target, sourcelist, type);
+#else
+   // Collect the top-level key names of all sources; each name is the unit of
+   // work of exactly one partition.
+   std::vector<TString> names;
+   {
+      THashList seen;
+      seen.SetOwner(kTRUE);
+      TIter nextfile(sourcelist);
+      while (auto file = (TFile *)nextfile()) {
+         TIter nextkey(file->GetListOfKeys());
+         while (auto key = static_cast<TKey *>(nextkey())) {
+            if (strcmp(key->GetClassName(), "TProcessID") == 0)
+               continue;
+            if (!seen.FindObject(key->GetName())) {
+               seen.Add(new TObjString(key->GetName()));
+               names.emplace_back(key->GetName());
+            }
+         }
+      }
+   }
+
+   // The kOnlyListed selection matches "name " as substring, so names with
+   // spaces or names that are suffixes of one another could be claimed by two
+   // partitions; merge such layouts sequentially.
+   for (std::size_t i = 0; i < names.size(); ++i) {
+      if (names[i].Contains(" "))
+         return MergeRecursive(target, sourcelist, type);
+      for (std::size_t j = i + 1; j < names.size(); ++j)
+         if (names[i].EndsWith(names[j]) || names[j].EndsWith(names[i]))
+            return MergeRecursive(target, sourcelist, type);
+   }
+
+   ROOT::TThreadExecutor pool;
+   const UInt_t nTasks = std::min<UInt_t>(pool.GetPoolSize(), names.size());
+   if (nTasks < 2)
+      return MergeRecursive(target, sourcelist, type);
+
+   std::vector<TString> sources;
+   {
+      TIter nextfile(sourcelist);
+      while (auto file = (TFile *)nextfile())
+         sources.emplace_back(file->GetName());
+   }
+
+   const UInt_t perTask = (names.size() + nTasks - 1) / nTasks;
+   std::vector<std::unique_ptr<TFileMerger>> workers(nTasks);
+   std::atomic<Int_t> nerrors{0};
+
+   auto mergeTask = [&](UInt_t t) {
+      TDirectory::TContext ctx(nullptr);
+      auto &worker = workers[t];
+      worker.reset(new TFileMerger(kFALSE, fHistoOneGo));
+      worker->SetMsgPrefix(fMsgPrefix);
+      worker->SetPrintLevel(fPrintLevel);
+      worker->SetFastMethod(fFastMethod);
+      worker->SetNotrees(fNoTrees);
+      worker->SetMergeOptions(fMergeOptions);
+      worker->SetErrorBehavior(fErrBehavior);
+      if (fIOFeatures)
+         worker->SetIOFeatures(*fIOFeatures);
+      if (!worker->OutputFile(std::make_unique<TMemFile>(
+             TString::Format("%s_pmerge_%u", fOutputFilename.Data(), t).Data(), "RECREATE", "",
+             fOutputFile->GetCompressionSettings()))) {
+         ++nerrors;
+         return;
+      }
+      for (const auto &src : sources) {
+         if (!worker->AddFile(src.Data(), kFALSE)) {
+            ++nerrors;
+            return;
+         }
+      }
+      const UInt_t first = t * perTask;
+      const UInt_t last = std::min<UInt_t>(first + perTask, names.size());
+      for (UInt_t i = first; i < last; ++i)
+         worker->AddObjectNames(names[i].Data());
+      // Incremental mode keeps the staging file open and written, so its keys
+      // can be harvested below.
+      if (!worker->PartialMerge(kAll | kIncremental | kOnlyListed | (type & kKeepCompression)))
+         ++nerrors;
+   };
+   pool.Foreach(mergeTask, ROOT::TSeqU(nTasks));
+
+   if (nerrors > 0) {
+      // The output was not touched yet, a sequential merge can still succeed.
+      Warning("MergeParallel", "parallel merge failed, falling back to sequential merge");
+      return MergeRecursive(target, sourcelist, type);
+   }
+
+   // Stitch the staging files into the output in partition order.
+   Bool_t status = kTRUE;
+   for (auto &worker : workers) {
+      TFile *staging = worker ? worker->GetOutputFile() : nullptr;
+      if (!staging || !R__CopyKeysRaw(staging, target)) {
+         status = kFALSE;
+         break;
+      }
+   }
+   if (status)
+      target->SaveSelf(kTRUE);
+   return status;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge the files. If no output file was specified it will write into
 /// the file "FileMerger.root" in the working directory. Returns true
@@ -1009,7 +1203,10 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
    Bool_t result = kTRUE;
    Int_t type = in_type;
    while (result && fFileList.GetEntries()>0) {
-      result = MergeRecursive(fOutputFile, &fFileList, type);
+      if (CanMergeParallel(type))
+         result = MergeParallel(fOutputFile, &fFileList, type);
+      else
+         result = MergeRecursive(fOutputFile, &fFileList, type);
 
       // Remove local copies if there are any
       TIter next(&fFileList);
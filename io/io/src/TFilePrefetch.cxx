@@ -17,6 +17,7 @@
 #include "TVirtualMonitoring.h"
 #include "TSemaphore.h"
 #include "TFPBlock.h"
+#include "TMath.h"
 #include "strlcpy.h"
 
 #include <string>
@@ -25,9 +26,14 @@
 #include <cstdlib>
 #include <cctype>
 #include <cassert>
+#include <vector>
 
 static const int kMAX_READ_SIZE    = 2;   //maximum size of the read list of blocks
 
+static const int kStrideRegimeThreshold = 3;  //consecutive accesses with equal stride before readahead starts
+static const int kMinReadaheadWindow    = 4;  //segments scheduled when a regime is first detected
+static const int kMaxReadaheadWindow    = 64; //upper bound for the feedback-grown window
+
 inline int xtod(char c) { return (c>='0' && c<='9') ? c-'0' : ((c>='A' && c<='F') ? c-'A'+10 : ((c>='a' && c<='f') ? c-'a'+10 : 0)); }
 
 ClassImp(TFilePrefetch);
@@ -208,6 +214,93 @@ Bool_t TFilePrefetch::ReadBuffer(char* buf, Long64_t offset, Int_t len)
    return found;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return a prefetched element without waiting: when the requested range is not
+/// (yet) available the caller is expected to read it synchronously. Used to
+/// serve accesses out of the self-scheduled adaptive readahead, which has no
+/// guarantee that a given range was ever scheduled.
+
+Bool_t TFilePrefetch::ReadBufferNonBlocking(char* buf, Long64_t offset, Int_t len)
+{
+   Bool_t found = false;
+   TFPBlock* blockObj = 0;
+   Int_t index = -1;
+
+   std::lock_guard<std::mutex> lk(fMutexReadList);
+   TIter iter(fReadBlocks);
+   while ((blockObj = (TFPBlock*) iter.Next())){
+      index = -1;
+      if (BinarySearchReadList(blockObj, offset, len, &index)){
+         found = true;
+         break;
+      }
+   }
+
+   if (found){
+      char *pBuff = blockObj->GetPtrToPiece(index);
+      pBuff += (offset - blockObj->GetPos(index));
+      memcpy(buf, pBuff, len);
+      fReadaheadHits++;
+   }
+   return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Observe one access which could not be served from prefetched blocks and,
+/// when the accesses settle into a constant-stride regime (sequential scans
+/// are the stride == length special case), schedule reads ahead of the
+/// consumer. The readahead window starts small, doubles each time the regime
+/// persists long enough to need a refill and collapses as soon as the regime
+/// breaks, so a mispredicting pattern stops generating background traffic.
+/// The background reads are reported through the usual gPerfStats hook and
+/// therefore show up in TTreePerfStats like any other file read.
+
+void TFilePrefetch::ObserveAccess(Long64_t offset, Int_t len)
+{
+   fReadaheadMisses++;
+
+   Long64_t stride = offset - fLastOffset;
+   if ((len > 0) && (stride > 0) && (stride == fLastStride)) {
+      if (fRegimeLength < kStrideRegimeThreshold)
+         fRegimeLength++;
+   } else {
+      fRegimeLength = ((len > 0) && (stride > 0)) ? 1 : 0;
+      fWindow = 0;
+      fReadaheadNext = 0;
+   }
+   fLastStride = stride;
+   fLastOffset = offset;
+
+   if (fRegimeLength < kStrideRegimeThreshold)
+      return;
+
+   // Refill only when the scheduled part of the stride grid is half consumed.
+   Long64_t next = offset + stride;
+   if ((fWindow > 0) && (fReadaheadNext - next >= (Long64_t)(fWindow / 2) * stride))
+      return;
+
+   fWindow = (fWindow == 0) ? kMinReadaheadWindow : TMath::Min(2 * fWindow, kMaxReadaheadWindow);
+
+   Long64_t end = fFile->GetEND();
+   Long64_t pos = TMath::Max(next, fReadaheadNext);
+   std::vector<Long64_t> offsets;
+   std::vector<Int_t> lengths;
+   offsets.reserve(fWindow);
+   lengths.reserve(fWindow);
+   for (Int_t i = 0; (i < fWindow) && (pos < end); i++, pos += stride) {
+      Int_t seglen = len;
+      if (pos + seglen > end)
+         seglen = (Int_t)(end - pos);
+      offsets.push_back(pos);
+      lengths.push_back(seglen);
+   }
+   if (offsets.empty())
+      return;
+
+   ReadBlock(offsets.data(), lengths.data(), (Int_t)offsets.size());
+   fReadaheadNext = offsets.back() + stride;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create a TFPBlock object or recycle one and add it to the prefetchBlocks list.
 
@@ -389,6 +482,36 @@ Int_t TFilePrefetch::SumHex(const char *hex)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the path under which a block is stored in the cache directory.
+///
+/// The name digests the identity of the file (its UUID) together with the
+/// position and length of every element of the block, so that several
+/// processes pointing Cache.Directory at the same node-local location (e.g.
+/// a tmpfs mount) hit each other's cached blocks of the same file, while
+/// blocks of unrelated files can never collide.
+
+TString TFilePrefetch::GetBlockPathInCache(TFPBlock* block)
+{
+   //dir is the MD5 value modulo 16; filename is the MD5 of uuid+offsets+lens
+   TMD5 md;
+
+   TString concatStr = fFile->GetUUID().AsString();
+   md.Update((UChar_t*)concatStr.Data(), concatStr.Length());
+   for (Int_t i=0; i < block->GetNoElem(); i++){
+      concatStr.Form("%lld:%d", block->GetPos(i), block->GetLen(i));
+      md.Update((UChar_t*)concatStr.Data(), concatStr.Length());
+   }
+   md.Final();
+
+   TString fileName( md.AsString() );
+   Int_t value = SumHex(fileName) % 16;
+   TString dirName;
+   dirName.Form("%i", value);
+
+   return fPathCache + "/" + dirName + "/" + fileName;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Test if the block is in cache.
 
@@ -398,33 +521,15 @@ Bool_t TFilePrefetch::CheckBlockInCache(char*& path, TFPBlock* block)
       return false;
 
    Bool_t found = false;
-   TString fullPath(fPathCache); // path of the cached files.
 
-   Int_t value = 0;
-
-   void *fdir = gSystem->OpenDirectory(fullPath);
+   void *fdir = gSystem->OpenDirectory(fPathCache);
    if (!fdir)
-      gSystem->mkdir(fullPath);
+      gSystem->mkdir(fPathCache);
    else {
       gSystem->FreeDirectory(fdir);
    }
-   //dir is SHA1 value modulo 16; filename is the value of the SHA1(offset+len)
-   TMD5* md = new TMD5();
-
-   TString concatStr;
-   for (Int_t i=0; i < block->GetNoElem(); i++){
-      concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
-   }
 
-   md->Final();
-   TString fileName( md->AsString() );
-   value = SumHex(fileName);
-   value = value % 16;
-   TString dirName;
-   dirName.Form("%i", value);
-
-   fullPath += "/" + dirName + "/" + fileName;
+   TString fullPath = GetBlockPathInCache(block);
 
    FileStat_t stat;
    if (gSystem->GetPathInfo(fullPath, stat) == 0) {
@@ -434,7 +539,6 @@ Bool_t TFilePrefetch::CheckBlockInCache(char*& path, TFPBlock* block)
    } else
       found = false;
 
-   delete md;
    return found;
 }
 
@@ -479,51 +583,39 @@ void TFilePrefetch::SaveBlockInCache(TFPBlock* block)
    if (fPathCache == "")
       return;
 
-   //dir is SHA1 value modulo 16; filename is the value of the SHA1
-   TMD5* md = new TMD5();
+   TString fullPath = GetBlockPathInCache(block);
+   TString dirPath = gSystem->GetDirName(fullPath);
 
-   TString concatStr;
-   for(Int_t i=0; i< block->GetNoElem(); i++){
-      concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
-   }
-   md->Final();
-
-   TString fileName( md->AsString() );
-   Int_t value = SumHex(fileName);
-   value = value % 16;
-
-   TString fullPath( fPathCache );
-   TString dirName;
-   dirName.Form("%i", value);
-   fullPath += ("/" + dirName);
-
-   void *fdir = gSystem->OpenDirectory(fullPath);
+   void *fdir = gSystem->OpenDirectory(dirPath);
    if (!fdir)
-      gSystem->mkdir(fullPath);
+      gSystem->mkdir(dirPath);
    else {
       gSystem->FreeDirectory(fdir);
    }
 
-   TFile* file = 0;
-   fullPath += ("/" + fileName);
    FileStat_t stat;
    if (gSystem->GetPathInfo(fullPath, stat) == 0) {
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "update");
-   } else{
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "new");
+      // Another process sharing the cache directory already saved this block.
+      return;
    }
 
+   // Write to a process-unique temporary name and move it in place in one
+   // step, so that sibling processes sharing the cache directory never read
+   // a partially written block.
+   TString tmpPath;
+   tmpPath.Form("%s.%d?filetype=raw", fullPath.Data(), gSystem->GetPid());
+   TFile* file = TFile::Open(tmpPath, "recreate");
+
    if (file) {
       // coverity[unchecked_value] We do not print error message, have not error
       // return code and close the file anyway, not need to check the return value.
       file->WriteBuffer(block->GetBuffer(), block->GetDataSize());
       file->Close();
       delete file;
+      tmpPath.Form("%s.%d", fullPath.Data(), gSystem->GetPid());
+      if (gSystem->Rename(tmpPath, fullPath) != 0)
+         gSystem->Unlink(tmpPath);
    }
-   delete md;
 }
 
 
@@ -1134,6 +1134,81 @@ void* TGenCollectionProxy::At(UInt_t idx)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// If the proxied container stores its values contiguously (vector-like, no
+/// pointers, not vector<bool>), set 'data' to the address of the first element
+/// and return the number of elements; return -1 otherwise.
+
+Long64_t TGenCollectionProxy::GetContiguousData(void *&data)
+{
+   data = nullptr;
+   if ( fEnv && fEnv->fObject ) {
+      switch (fSTL_type) {
+      case ROOT::kSTLvector:
+         if ((*fValue).fKind == kBool_t)
+            return -1;
+         // intentional fall through
+      case ROOT::kROOTRVec: {
+         if ( fPointers )
+            return -1;
+         const UInt_t siz = TGenCollectionProxy::Size();
+         if ( siz == 0 )
+            return 0;
+         fEnv->fIdx = 0;
+         data = fEnv->fStart = fFirst.invoke(fEnv);
+         return siz;
+      }
+      default:
+         return -1;
+      }
+   }
+   Fatal("TGenCollectionProxy","GetContiguousData> Logic error - no proxy object set.");
+   return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// For a collection of collections, e.g. vector<vector<float>>, fill
+/// 'innerData' with the address of each inner container's contiguous payload
+/// and 'offsets' with the cumulative element counts, walking the outer
+/// container with its known stride instead of paying one virtual At() call
+/// per inner element.  Return false if either level is not contiguous.
+
+Bool_t TGenCollectionProxy::GetNestedData(std::vector<void *> &innerData, std::vector<UInt_t> &offsets)
+{
+   innerData.clear();
+   offsets.clear();
+   if ( !fEnv || !fEnv->fObject ) {
+      Fatal("TGenCollectionProxy","GetNestedData> Logic error - no proxy object set.");
+      return kFALSE;
+   }
+   if ( fPointers || (fSTL_type != ROOT::kSTLvector && fSTL_type != ROOT::kROOTRVec) )
+      return kFALSE;
+   TClass *valueClass = GetValueClass();
+   TVirtualCollectionProxy *inner = valueClass ? valueClass->GetCollectionProxy() : nullptr;
+   if ( !inner )
+      return kFALSE;
+   const UInt_t siz = TGenCollectionProxy::Size();
+   innerData.reserve(siz);
+   offsets.reserve(siz + 1);
+   offsets.push_back(0);
+   if ( siz == 0 )
+      return kTRUE;
+   fEnv->fIdx = 0;
+   char *outer = (char*)(fEnv->fStart = fFirst.invoke(fEnv));
+   UInt_t total = 0;
+   for ( UInt_t i = 0; i < siz; ++i ) {
+      TPushPop pushPop(inner, outer + (size_t)fValDiff*i);
+      void *data = nullptr;
+      const Long64_t n = inner->GetContiguousData(data);
+      if ( n < 0 )
+         return kFALSE;
+      innerData.push_back(data);
+      total += (UInt_t)n;
+      offsets.push_back(total);
+   }
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Clear the emulated collection.
 
@@ -26,11 +26,19 @@ only from memory.
 #include "TArrayC.h"
 #include "TKey.h"
 #include "TClass.h"
+#include "TList.h"
 #include "TVirtualMutex.h"
+#include <algorithm>
+#include <atomic>
 #include <errno.h>
 #include <stdio.h>
 #include <sys/stat.h>
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 // The following snippet is used for developer-level debugging
 #define TMemFile_TRACE
 #ifndef TMemFile_TRACE
@@ -284,6 +292,167 @@ void TMemFile::CopyTo(TBuffer &tobuf) const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write every object of the collection into this file, each as an
+/// independent key named after TObject::GetName, parallelizing the
+/// serialization and compression when implicit multi-threading is enabled.
+///
+/// With IMT enabled the objects are streamed and compressed into per-task
+/// scratch memory files and the resulting records are then copied into this
+/// file without recompression, so the expensive part of the snapshot scales
+/// with the number of cores.  Without IMT this is equivalent to calling
+/// WriteTObject for each member of the collection.  Object references across
+/// keys (TRef) are not remapped.
+///
+/// Returns the number of bytes written to the file, -1 in case of error.
+
+Long64_t TMemFile::BulkWrite(const TCollection &objects)
+{
+   if (!IsOpen() || !fWritable) {
+      Error("BulkWrite", "File %s is not writable", GetName());
+      return -1;
+   }
+
+   std::vector<TObject *> objs;
+   objs.reserve(objects.GetSize());
+   TIter next(&objects);
+   while (TObject *obj = next())
+      objs.push_back(obj);
+   if (objs.empty())
+      return 0;
+
+   Long64_t nbytes = 0;
+   Int_t nerrors = 0;
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && objs.size() > 1) {
+      ROOT::TThreadExecutor pool;
+      const size_t nTasks = std::min<size_t>(pool.GetPoolSize(), objs.size());
+      const size_t perTask = (objs.size() + nTasks - 1) / nTasks;
+      std::vector<std::unique_ptr<TMemFile>> scratch(nTasks);
+      std::atomic<Int_t> nerrpar(0);
+
+      auto serializeTask = [&](UInt_t t) {
+         TString scratchName = TString::Format("%s_bulkwrite_%u", GetName(), t);
+         scratch[t] = std::make_unique<TMemFile>(scratchName.Data(), "RECREATE", "", GetCompressionSettings());
+         const size_t last = std::min(objs.size(), (t + 1) * perTask);
+         for (size_t i = t * perTask; i < last; ++i) {
+            if (scratch[t]->WriteTObject(objs[i]) <= 0)
+               ++nerrpar;
+         }
+      };
+      pool.Foreach(serializeTask, ROOT::TSeqU(nTasks));
+      nerrors = nerrpar;
+
+      // Copy the serialized records into this file; the raw (compressed)
+      // object bytes are copied as is, only the key headers are rewritten.
+      for (auto &wfile : scratch) {
+         if (!wfile)
+            continue;
+         TIter nextkey(wfile->GetListOfKeys());
+         while (TKey *origkey = (TKey *)nextkey()) {
+            TKey *newkey = new TKey(this, *origkey, 0 /* pidoffset */);
+            SumBuffer(newkey->GetObjlen());
+            newkey->WriteFile(0);
+            if (TestBit(TFile::kWriteError))
+               return -1;
+            nbytes += newkey->GetNbytes();
+         }
+      }
+      return nerrors ? -1 : nbytes;
+   }
+#endif
+   for (auto obj : objs) {
+      Int_t n = WriteTObject(obj);
+      if (n <= 0)
+         ++nerrors;
+      else
+         nbytes += n;
+   }
+   return nerrors ? -1 : nbytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read every top level key of the file and add the resulting objects to the
+/// given list, parallelizing decompression and deserialization when implicit
+/// multi-threading is enabled.
+///
+/// The objects are appended to the list in key list order; they are not
+/// associated to any directory, so the caller owns them.  Returns the number
+/// of objects read, -1 if any key failed to be read back.
+
+Int_t TMemFile::BulkRead(TList &objects)
+{
+   std::vector<TKey *> keys;
+   {
+      TIter nextkey(GetListOfKeys());
+      while (TKey *key = (TKey *)nextkey())
+         keys.push_back(key);
+   }
+   if (keys.empty())
+      return 0;
+
+   Int_t nread = 0;
+   Int_t nerrors = 0;
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && keys.size() > 1) {
+      // First pass, serial: extract the raw record of every compressed key
+      // from the memory blocks; this is a plain copy.
+      std::vector<std::unique_ptr<char[]>> records(keys.size());
+      std::vector<TObject *> result(keys.size(), nullptr);
+      for (size_t i = 0; i < keys.size(); ++i) {
+         TKey *key = keys[i];
+         if (key->GetObjlen() > key->GetNbytes() - key->GetKeylen()) {
+            records[i].reset(new char[key->GetNbytes()]);
+            Seek(key->GetSeekKey());
+            if (ReadBuffer(records[i].get(), key->GetNbytes()))
+               records[i].reset(); // fall back to the serial read below
+         }
+      }
+      // Second pass, parallel: decompress and deserialize the records.
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](UInt_t i) {
+            if (records[i]) {
+               // Keep the restored object out of the worker's current
+               // directory; histogram-like streamers would otherwise
+               // register it concurrently.
+               TDirectory::TContext ctx(nullptr);
+               result[i] = keys[i]->ReadObjWithBuffer(records[i].get());
+            }
+         },
+         ROOT::TSeqU(keys.size()));
+      for (size_t i = 0; i < keys.size(); ++i) {
+         TObject *obj = result[i];
+         if (!obj && !records[i]) {
+            // Uncompressed keys are read directly from the memory blocks.
+            TDirectory::TContext ctx(nullptr);
+            obj = keys[i]->ReadObj();
+         }
+         if (obj) {
+            objects.Add(obj);
+            ++nread;
+         } else {
+            ++nerrors;
+         }
+      }
+      return nerrors ? -1 : nread;
+   }
+#endif
+   for (auto key : keys) {
+      TDirectory::TContext ctx(nullptr);
+      TObject *obj = key->ReadObj();
+      if (obj) {
+         objects.Add(obj);
+         ++nread;
+      } else {
+         ++nerrors;
+      }
+   }
+   return nerrors ? -1 : nread;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the current size of the memory file
 
@@ -77,6 +77,9 @@ element type.
 
 #include <memory>
 #include <array>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 std::atomic<Int_t> TStreamerInfo::fgCount{0};
 
@@ -368,6 +371,69 @@ namespace {
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the streamer infos of the given class and of all classes reachable
+/// from it through base classes, data members and collection value types.
+///
+/// The first Write of a complex event model triggers the Build chain of
+/// hundreds of classes. Calling this function ahead of time for the top-level
+/// event classes moves that cost to a chosen point of the job, or overlaps it
+/// with early event processing when run on a worker thread (see
+/// PreBuildAsync()). The per-class checksums needed at write time are filled
+/// in the same pass.
+
+void TStreamerInfo::PreBuild(TClass *cl)
+{
+   if (!cl)
+      return;
+
+   std::unordered_set<TClass *> visited;
+   std::vector<TClass *> toBuild{cl};
+   while (!toBuild.empty()) {
+      TClass *current = toBuild.back();
+      toBuild.pop_back();
+      if (!visited.insert(current).second)
+         continue;
+
+      TVirtualStreamerInfo *info = current->GetStreamerInfo();
+      current->GetCheckSum();
+      if (!info || !info->GetElements())
+         continue;
+
+      // Queue the classes this one depends on: its bases and data members
+      // (both are streamer elements) and the value types of its collections
+      for (TObject *obj : *(info->GetElements())) {
+         auto element = static_cast<TStreamerElement *>(obj);
+         TClass *elemClass = element->GetClassPointer();
+         if (!elemClass)
+            continue;
+         if (!visited.count(elemClass))
+            toBuild.push_back(elemClass);
+         TVirtualCollectionProxy *proxy = elemClass->GetCollectionProxy();
+         if (proxy && proxy->GetValueClass() && !visited.count(proxy->GetValueClass()))
+            toBuild.push_back(proxy->GetValueClass());
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run PreBuild(cl) on a detached worker thread, overlapping the
+/// streamer-info build chain with whatever the calling thread does next
+/// (typically processing the first events). Requires thread safety to have
+/// been enabled with ROOT::EnableThreadSafety(); without it the build runs
+/// synchronously in the calling thread.
+
+void TStreamerInfo::PreBuildAsync(TClass *cl)
+{
+   if (!cl)
+      return;
+   if (gGlobalMutex) {
+      std::thread([cl]() { TStreamerInfo::PreBuild(cl); }).detach();
+   } else {
+      PreBuild(cl);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Build the I/O data structure for the current class version.
 ///
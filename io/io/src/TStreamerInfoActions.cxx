@@ -247,6 +247,32 @@ namespace TStreamerInfoActions
       TConfiguration *Copy() override { return new TConfStreamerLoop(*this); };
    };
 
+   /// Configuration of a run of consecutive reads of basic members of the same
+   /// type that has been collapsed into a single action (see
+   /// TActionSequence::FuseBasicTypeReads).
+   class TConfigurationFused : public TConfiguration {
+   public:
+      std::vector<Int_t> fOffsets;    ///< Offset within the object of each member of the run.
+      Bool_t             fContiguous; ///< True when the members are laid out back to back in memory.
+
+      TConfigurationFused(const TConfiguration &first, std::vector<Int_t> &&offsets, Bool_t contiguous)
+         : TConfiguration(first), fOffsets(std::move(offsets)), fContiguous(contiguous)
+      {
+         fLength = fOffsets.size();
+      }
+
+      void AddToOffset(Int_t delta) override
+      {
+         if (fOffset != TVirtualStreamerInfo::kMissing) {
+            fOffset += delta;
+            for (auto &offset : fOffsets)
+               offset += delta;
+         }
+      }
+
+      TConfiguration *Copy() override { return new TConfigurationFused(*this); }
+   };
+
    Int_t GenericReadAction(TBuffer &buf, void *addr, const TConfiguration *config)
    {
       char *obj = (char*)addr;
@@ -270,6 +296,25 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t ReadFusedBasicType(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      // Read a run of consecutive members of the same basic type with a single
+      // action (see TActionSequence::FuseBasicTypeReads).  The on-file format
+      // of ReadFastArray and of repeated operator>> is identical for basic
+      // types in TBufferFile, but not necessarily in the text based buffers,
+      // so the bulk path is restricted to TBufferFile.
+      TConfigurationFused *conf = (TConfigurationFused*)config;
+      char *obj = (char*)addr;
+      if (conf->fContiguous && buf.IsA() == TBufferFile::Class()) {
+         buf.ReadFastArray((T*)(obj + conf->fOffsets.front()), (Int_t)conf->fOffsets.size());
+      } else {
+         for (Int_t offset : conf->fOffsets)
+            buf >> *(T*)(obj + offset);
+      }
+      return 0;
+   }
+
    void HandleReferencedTObject(TBuffer &buf, void *addr, const TConfiguration *config) {
       TBitsConfiguration *conf = (TBitsConfiguration*)config;
       UShort_t pidf;
@@ -4349,6 +4394,11 @@ void TStreamerInfo::Compile()
       AddReadAction(fReadObjectWise, i, fCompOpt[i]);
       AddWriteAction(fWriteObjectWise, i, fCompOpt[i]);
    }
+   // The object wise read sequence is only ever applied as a whole (it is
+   // never sub-set per element like the member wise ones used by split
+   // branches), so runs of basic type reads can be collapsed into single
+   // actions.
+   fReadObjectWise->FuseBasicTypeReads();
    for (i = 0; i < fNfulldata; ++i) {
       if (!fCompFull[i]->fElem || fCompFull[i]->fElem->GetType()< 0) {
          continue;
@@ -5428,6 +5478,83 @@ void TStreamerInfoActions::TActionSequence::SetMissing()
    }
 }
 
+static TStreamerInfoActions::TStreamerInfoAction_t
+GetFusedBasicReadAction(TStreamerInfoActions::TStreamerInfoAction_t action, size_t &size)
+{
+   // Return the fused counterpart of the given single member basic type read
+   // action and the in-memory size of one member, or nullptr if the action
+   // does not read a plain basic type.
+
+   using namespace TStreamerInfoActions;
+   if (action == &ReadBasicType<Bool_t>)    { size = sizeof(Bool_t);    return &ReadFusedBasicType<Bool_t>; }
+   if (action == &ReadBasicType<Char_t>)    { size = sizeof(Char_t);    return &ReadFusedBasicType<Char_t>; }
+   if (action == &ReadBasicType<Short_t>)   { size = sizeof(Short_t);   return &ReadFusedBasicType<Short_t>; }
+   if (action == &ReadBasicType<Int_t>)     { size = sizeof(Int_t);     return &ReadFusedBasicType<Int_t>; }
+   if (action == &ReadBasicType<Long_t>)    { size = sizeof(Long_t);    return &ReadFusedBasicType<Long_t>; }
+   if (action == &ReadBasicType<Long64_t>)  { size = sizeof(Long64_t);  return &ReadFusedBasicType<Long64_t>; }
+   if (action == &ReadBasicType<Float_t>)   { size = sizeof(Float_t);   return &ReadFusedBasicType<Float_t>; }
+   if (action == &ReadBasicType<Double_t>)  { size = sizeof(Double_t);  return &ReadFusedBasicType<Double_t>; }
+   if (action == &ReadBasicType<UChar_t>)   { size = sizeof(UChar_t);   return &ReadFusedBasicType<UChar_t>; }
+   if (action == &ReadBasicType<UShort_t>)  { size = sizeof(UShort_t);  return &ReadFusedBasicType<UShort_t>; }
+   if (action == &ReadBasicType<UInt_t>)    { size = sizeof(UInt_t);    return &ReadFusedBasicType<UInt_t>; }
+   if (action == &ReadBasicType<ULong_t>)   { size = sizeof(ULong_t);   return &ReadFusedBasicType<ULong_t>; }
+   if (action == &ReadBasicType<ULong64_t>) { size = sizeof(ULong64_t); return &ReadFusedBasicType<ULong64_t>; }
+   return nullptr;
+}
+
+void TStreamerInfoActions::TActionSequence::FuseBasicTypeReads()
+{
+   // Collapse each run of consecutive reads of basic members of the same type
+   // into a single action, so that reading e.g. five adjacent doubles costs
+   // one dispatch instead of five.  The fused action only keeps the element
+   // id of the first member of the run, so this must only be applied to
+   // sequences that are never sub-set per element (i.e. the object wise read
+   // sequence); the member wise sequences used by split branches select
+   // actions by element id and must keep one action per member.
+
+   if (fActions.size() < 2)
+      return;
+
+   ActionContainer_t fused;
+   fused.reserve(fActions.size());
+
+   // Elements with the kCache bit participate in the onfile object caching
+   // machinery used by the schema evolution read rules and keep their own
+   // offset handling; leave them alone.
+   auto isFusable = [](const TConfiguredAction &act) {
+      const TConfiguration *conf = act.fConfiguration;
+      return conf->fLength == 1 && conf->fElemId != (UInt_t)-1 &&
+             !conf->fInfo->GetElements()->At(conf->fElemId)->TestBit(TStreamerElement::kCache);
+   };
+
+   for (size_t i = 0; i < fActions.size();) {
+      size_t size = 0;
+      TStreamerInfoAction_t action = GetFusedBasicReadAction(fActions[i].fAction, size);
+      size_t j = i + 1;
+      if (action && isFusable(fActions[i])) {
+         while (j < fActions.size() && fActions[j].fAction == fActions[i].fAction && isFusable(fActions[j]))
+            ++j;
+      }
+      if (action && (j - i) > 1) {
+         std::vector<Int_t> offsets;
+         offsets.reserve(j - i);
+         Bool_t contiguous = kTRUE;
+         for (size_t k = i; k < j; ++k) {
+            offsets.push_back(fActions[k].fConfiguration->fOffset);
+            if (k > i && offsets.back() != offsets.front() + (Int_t)((k - i) * size))
+               contiguous = kFALSE;
+         }
+         fused.emplace_back(action, new TConfigurationFused(*fActions[i].fConfiguration, std::move(offsets), contiguous));
+      } else {
+         for (size_t k = i; k < j; ++k)
+            fused.push_back(fActions[k]); // 'copy' constructor moves the configuration ownership.
+      }
+      i = j;
+   }
+
+   fActions.swap(fused);
+}
+
 TStreamerInfoActions::TActionSequence *TStreamerInfoActions::TActionSequence::CreateCopy()
 {
    // Create a copy of this sequence.
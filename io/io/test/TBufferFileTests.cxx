@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 
+#include "TAttLine.h"
+#include "TAttMarker.h"
 #include "TBufferFile.h"
 #include "TClass.h"
 #include <vector>
@@ -26,3 +28,64 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+// Runs of consecutive members of the same basic type are read by a single
+// fused action (TActionSequence::FuseBasicTypeReads); check that the values
+// survive a round trip unchanged.
+TEST(TBufferFile, FusedBasicTypeReads)
+{
+   TAttLine lineIn(600, 2, 3);      // three consecutive Short_t members
+   TAttMarker markerIn(432, 21, 1.5f); // two Short_t members followed by a Float_t
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObjectAny(&lineIn, TAttLine::Class());
+   buf.WriteObjectAny(&markerIn, TAttMarker::Class());
+
+   buf.SetReadMode();
+   buf.Reset();
+
+   auto lineOut = static_cast<TAttLine *>(buf.ReadObjectAny(TAttLine::Class()));
+   ASSERT_NE(lineOut, nullptr);
+   EXPECT_EQ(lineOut->GetLineColor(), 600);
+   EXPECT_EQ(lineOut->GetLineStyle(), 2);
+   EXPECT_EQ(lineOut->GetLineWidth(), 3);
+
+   auto markerOut = static_cast<TAttMarker *>(buf.ReadObjectAny(TAttMarker::Class()));
+   ASSERT_NE(markerOut, nullptr);
+   EXPECT_EQ(markerOut->GetMarkerColor(), 432);
+   EXPECT_EQ(markerOut->GetMarkerStyle(), 21);
+   EXPECT_FLOAT_EQ(markerOut->GetMarkerSize(), 1.5f);
+
+   delete lineOut;
+   delete markerOut;
+}
+
+// Pooled buffers grow through realloc and hand their storage back to a
+// per-thread pool; check the round trip across a forced expansion and that a
+// subsequent acquisition on the same thread reuses the grown allocation.
+TEST(TBufferFile, PooledBuffer)
+{
+   std::vector<int> v(100000);
+   for (size_t i = 0; i < v.size(); ++i)
+      v[i] = (int)i;
+   TClass *cl = TClass::GetClass("vector<int>");
+
+   auto buf = TBufferFile::AcquireFromPool(TBuffer::kWrite, 1024);
+   buf->WriteObjectAny(&v, cl); // much larger than the initial 1024 bytes
+   EXPECT_GT(buf->BufferSize(), 1024);
+
+   buf->SetReadMode();
+   buf->Reset();
+   auto readBack = static_cast<std::vector<int> *>(buf->ReadObjectAny(cl));
+   ASSERT_NE(readBack, nullptr);
+   ASSERT_EQ(readBack->size(), v.size());
+   EXPECT_EQ(*readBack, v);
+   delete readBack;
+
+   char *storage = buf->Buffer();
+   buf.reset(); // returns the allocation to the pool
+
+   auto buf2 = TBufferFile::AcquireFromPool(TBuffer::kWrite, 1024);
+   EXPECT_EQ(buf2->Buffer(), storage); // the grown allocation was recycled
+   EXPECT_GT(buf2->BufferSize(), 1024);
+}
@@ -94,3 +94,34 @@ TEST(TBufferJSON, TList_Add_Without_Option)
    EXPECT_EQ(link, nullptr);
 }
 
+
+// streamed conversion must produce byte-identical output to the TString variant
+TEST(TBufferJSON, OutputSink)
+{
+   TList lst;
+   lst.SetOwner(kTRUE);
+   for (int i = 0; i < 200; ++i)
+      lst.Add(new TNamed(TString::Format("name%d", i), TString::Format("title%d", i)));
+
+   auto json = TBufferJSON::ToJSON(&lst);
+
+   std::string collected;
+   int nchunks = 0;
+   TBufferJSON buf;
+   buf.SetOutputSink(
+      [&](const char *data, std::size_t len) {
+         collected.append(data, len);
+         nchunks++;
+      },
+      512); // small chunks to force several flushes
+   buf.StoreObject(&lst, TList::Class());
+
+   EXPECT_GT(nchunks, 1);
+   EXPECT_EQ(collected, json.Data());
+
+   // static helper with default chunk size delivers the same document
+   std::string collected2;
+   EXPECT_TRUE(TBufferJSON::ConvertToJSON(&lst, TList::Class(),
+                                          [&](const char *data, std::size_t len) { collected2.append(data, len); }));
+   EXPECT_EQ(collected2, json.Data());
+}
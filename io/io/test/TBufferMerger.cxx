@@ -118,6 +118,55 @@ TEST(TBufferMerger, ParallelTreeFill)
    EXPECT_TRUE(FileExists("tbuffermerger_parallel.root"));
 }
 
+TEST(TBufferMerger, ParallelTreeFillPendingList)
+{
+   int nthreads = 4;
+   int nevents = 256;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_pending.root");
+      merger.SetMaxPendingFiles(2);
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+
+            Fill(mytree, i * nevents, nevents);
+            myfile->Write();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+   }
+
+   ASSERT_TRUE(FileExists("tbuffermerger_pending.root"));
+
+   { // with the bounded pending list, data must be identical to a serial fill
+      TFile f("tbuffermerger_pending.root");
+      auto t = (TTree *)f.Get("mytree");
+      ASSERT_TRUE(t != nullptr);
+
+      int n, sum = 0;
+      int nentries = (int)t->GetEntries();
+
+      t->SetBranchAddress("n", &n);
+
+      for (int i = 0; i < nentries; ++i) {
+         t->GetEntry(i);
+         sum += n;
+      }
+
+      EXPECT_EQ(1024, nentries);
+      EXPECT_EQ(523776, sum);
+   }
+
+   RemoveFile("tbuffermerger_pending.root");
+}
+
 TEST(TBufferMerger, CheckTreeFillResults)
 {
    int sum_s, sum_p;
@@ -8,6 +8,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TH1.h"
+#include "TROOT.h"
 #include "TSystem.h"
 
 #include <memory>
@@ -279,3 +280,53 @@ TEST(TFileMerger, SelectiveMergeWithDirectories)
    for (auto name : {input1, input2, output})
       gSystem->Unlink(name);
 }
+
+#ifdef R__USE_IMT
+TEST(TFileMerger, ParallelDirectoryMerge)
+{
+   constexpr auto input1 = "parallelMerge_input_1.root";
+   constexpr auto input2 = "parallelMerge_input_2.root";
+   constexpr auto output = "parallelMerge_output.root";
+   const char *dirnames[] = {"dirA", "dirB", "dirC", "dirD"};
+
+   for (auto const &filename : {input1, input2}) {
+      TFile infile(filename, "recreate");
+      TH1F top("top", "Top-level histo", 2, 0, 1);
+      top.Fill(0.5);
+      infile.WriteObject(&top, "top");
+      for (auto dirname : dirnames) {
+         auto dir = infile.mkdir(dirname);
+         TH1F histo("histo", "Histo", 2, 0, 1);
+         histo.Fill(0.5);
+         dir->WriteObject(&histo, "histo");
+      }
+   }
+
+   ROOT::EnableImplicitMT();
+   {
+      TFileMerger fileMerger(false);
+      fileMerger.SetParallelMerge();
+      EXPECT_TRUE(fileMerger.GetParallelMerge());
+      fileMerger.AddFile(input1);
+      fileMerger.AddFile(input2);
+      fileMerger.OutputFile(output);
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+   ROOT::DisableImplicitMT();
+
+   TFile outfile(output);
+   auto top = outfile.Get<TH1F>("top");
+   ASSERT_NE(top, nullptr);
+   EXPECT_EQ(top->GetEntries(), 2);
+   for (auto dirname : dirnames) {
+      auto dir = outfile.Get<TDirectory>(dirname);
+      ASSERT_NE(dir, nullptr) << dirname;
+      auto histo = dir->Get<TH1F>("histo");
+      ASSERT_NE(histo, nullptr) << dirname;
+      EXPECT_EQ(histo->GetEntries(), 2) << dirname;
+   }
+
+   for (auto name : {input1, input2, output})
+      gSystem->Unlink(name);
+}
+#endif
@@ -5,9 +5,12 @@
 #include "gtest/gtest.h"
 
 #include "TFile.h"
+#include "TFileCacheWrite.h"
+#include "TFilePrefetch.h"
 #include "TMemFile.h"
 #include "TDirectory.h"
 #include "TKey.h"
+#include "TList.h"
 #include "TNamed.h"
 #include "TPluginManager.h"
 #include "TROOT.h" // gROOT
@@ -251,3 +254,109 @@ TEST(TFile, WalkTKeys)
    EXPECT_EQ(it->fKeyName, kLongerKey);
    EXPECT_EQ(it->fClassName, "string");
 }
+
+TEST(TFile, WriteCacheEagerWriteback)
+{
+   auto filename{"tfile_eager_writeback.root"};
+   auto vec_name{"payload"};
+
+   {
+      TFile f{filename, "recreate"};
+      auto cache = new TFileCacheWrite(&f, 64000);
+      cache->SetEagerWriteback();
+      EXPECT_TRUE(cache->IsEagerWriteback());
+      // Enough data for several cache flushes.
+      std::vector<double> payload(100000);
+      for (size_t i = 0; i < payload.size(); ++i)
+         payload[i] = 0.5 * i;
+      f.WriteObject(&payload, vec_name);
+      f.Close();
+   } // ~TFile deletes the cache
+
+   TFile input{filename};
+   auto payload = input.Get<std::vector<double>>(vec_name);
+   ASSERT_NE(payload, nullptr);
+   ASSERT_EQ(payload->size(), 100000u);
+   EXPECT_DOUBLE_EQ((*payload)[1], 0.5);
+   EXPECT_DOUBLE_EQ((*payload)[99999], 0.5 * 99999);
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+// The open sequence prefetches the top directory key list and the StreamerInfo
+// record through a temporary read cache; check that a reopened file comes back
+// with all its keys, its streamer info, and no cache left attached.
+TEST(TFile, OpenPrefetchesMetadata)
+{
+   auto filename{"tfile_open_prefetch.root"};
+   constexpr int nObjects = 20;
+
+   {
+      TFile f{filename, "recreate"};
+      for (int i = 0; i < nObjects; ++i) {
+         TNamed named{TString::Format("obj_%d", i).Data(), "prefetch test"};
+         f.WriteTObject(&named);
+      }
+      f.Close();
+   }
+
+   TFile input{filename};
+   ASSERT_FALSE(input.IsZombie());
+   EXPECT_EQ(input.GetCacheRead(), nullptr);
+   EXPECT_EQ(input.GetNkeys(), nObjects);
+   for (int i = 0; i < nObjects; ++i) {
+      auto named = input.Get<TNamed>(TString::Format("obj_%d", i).Data());
+      ASSERT_NE(named, nullptr);
+      EXPECT_STREQ(named->GetTitle(), "prefetch test");
+   }
+   auto infos = input.GetStreamerInfoList();
+   ASSERT_NE(infos, nullptr);
+   EXPECT_GT(infos->GetSize(), 0);
+   delete infos;
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+// Constant-stride accesses which miss the prefetched blocks should put the
+// adaptive readahead into a regime where upcoming reads are scheduled ahead.
+TEST(TFilePrefetch, AdaptiveReadahead)
+{
+   auto filename{"tfile_prefetch_readahead.root"};
+   constexpr Long64_t stride = 2048;
+   constexpr Int_t len = 1024;
+
+   {
+      TFile f{filename, "recreate", "", 0 /* no compression */};
+      std::vector<double> payload(20000);
+      for (size_t i = 0; i < payload.size(); ++i)
+         payload[i] = 0.25 * i;
+      f.WriteObject(&payload, "payload");
+      f.Close();
+   }
+
+   TFile f{filename};
+   TFilePrefetch prefetch(&f);
+   ASSERT_EQ(prefetch.ThreadStart(), 0);
+
+   char buffer[len];
+   for (int i = 0; i < 4; ++i) {
+      const Long64_t pos = 100 + i * stride;
+      EXPECT_FALSE(prefetch.ReadBufferNonBlocking(buffer, pos, len));
+      prefetch.ObserveAccess(pos, len);
+   }
+   EXPECT_EQ(prefetch.GetReadaheadMisses(), 4);
+   EXPECT_EQ(prefetch.GetReadaheadHits(), 0);
+
+   // The fourth observation detects the regime and schedules the grid ahead;
+   // the blocking read waits for the background thread to deliver the block.
+   const Long64_t pos = 100 + 4 * stride;
+   ASSERT_TRUE(prefetch.ReadBuffer(buffer, pos, len));
+
+   char expected[len];
+   ASSERT_FALSE(f.ReadBuffer(expected, pos, len));
+   EXPECT_EQ(memcmp(buffer, expected, len), 0);
+
+   gSystem->Unlink(filename);
+}
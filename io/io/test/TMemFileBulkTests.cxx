@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+
+#include "TList.h"
+#include "TMemFile.h"
+#include "TNamed.h"
+#include "TROOT.h"
+
+#include <memory>
+
+static void FillNames(TList &objects, int n)
+{
+   objects.SetOwner(kTRUE);
+   for (int i = 0; i < n; ++i)
+      objects.Add(new TNamed(TString::Format("obj_%d", i), TString::Format("title_%d", i)));
+}
+
+static void CheckRoundTrip(int nObjects)
+{
+   TList written;
+   FillNames(written, nObjects);
+
+   TMemFile f("membulk.root", "RECREATE");
+   EXPECT_GT(f.BulkWrite(written), 0);
+
+   TList restored;
+   restored.SetOwner(kTRUE);
+   EXPECT_EQ(f.BulkRead(restored), nObjects);
+   ASSERT_EQ(restored.GetSize(), nObjects);
+
+   for (int i = 0; i < nObjects; ++i) {
+      auto in = static_cast<TNamed *>(written.At(i));
+      auto out = static_cast<TNamed *>(restored.At(i));
+      EXPECT_STREQ(out->GetName(), in->GetName());
+      EXPECT_STREQ(out->GetTitle(), in->GetTitle());
+   }
+   f.Close();
+}
+
+TEST(TMemFileBulk, RoundTripSerial)
+{
+   ROOT::DisableImplicitMT();
+   CheckRoundTrip(100);
+}
+
+#ifdef R__USE_IMT
+TEST(TMemFileBulk, RoundTripParallel)
+{
+   ROOT::EnableImplicitMT();
+   CheckRoundTrip(100);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -37,6 +37,13 @@ def get_argparse():
         "using the compression level specified in the first input or the "
         "compression setting after fk (for example 206 when using -fk206)"), action = 'store_true')
     parser.add_argument("-ff", help="The compression level use is the one specified in the first input", action = 'store_true')
+    parser.add_argument("-incremental", help=textwrap.fill(
+        "Merge incrementally: remember which inputs went into the output in a state file "
+        "(TARGET.haddstate) and, when invoked again, only merge new inputs on top of the "
+        "existing output. If an input recorded in the state file changed or disappeared, "
+        "the whole output is merged from scratch. The target is replaced atomically and "
+        "the state file is updated only after a successful merge, so an interrupted run "
+        "can simply be re-executed. Cannot be combined with -a."), action = 'store_true')
     parser.add_argument("-k", help="Skip corrupt or non-existent files, do not exit", action = 'store_true')
     parser.add_argument("-L", help=textwrap.fill(
        "Read the list of objects from FILE and either only merge or skip those objects depending on "
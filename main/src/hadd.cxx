@@ -55,6 +55,13 @@
                        (unless -O is specified). Compresses the meta data using the compression level specified
                        in the first input or the compression setting after fk (for example 505 when using -fk505)
   \param -ff           The compression level used is the one specified in the first input
+  \param -incremental  Merge incrementally: remember which inputs went into the output in a
+                       state file (`<targetfile>.haddstate`) and, when invoked again, only merge
+                       new inputs on top of the existing output. If an input recorded in the
+                       state file changed or disappeared, the whole output is merged from
+                       scratch. The target is replaced atomically and the state file is updated
+                       only after a successful merge, so an interrupted run can simply be
+                       re-executed. Cannot be combined with -a.
   \param -j [N_JOBS]   Parallelise the execution in `N_JOBS` processes. If the number of processes is not specified,
                        or is 0, use the system maximum.
   \param -k            Skip corrupt or non-existent files, do not exit
@@ -152,6 +159,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -191,6 +199,7 @@ struct HAddArgs {
    bool fDebug;
    bool fKeepCompressionAsIs;
    bool fUseFirstInputCompression;
+   bool fIncremental;
 
    std::optional<std::string> fWorkingDir;
    std::optional<IntFlag_t> fNProcesses;
@@ -526,6 +535,7 @@ static std::optional<HAddArgs> ParseArgs(int argc, char **argv)
          PARSE_FLAG(FlagToggle, arg, "k", args.fSkipErrors);
          PARSE_FLAG(FlagToggle, arg, "O", args.fReoptimize);
          PARSE_FLAG(FlagToggle, arg, "dbg", args.fDebug);
+         PARSE_FLAG(FlagToggle, arg, "incremental", args.fIncremental);
          PARSE_FLAG(FlagArg, argc, argv, argIdx, "d", args.fWorkingDir);
          PARSE_FLAG(FlagArg, argc, argv, argIdx, "j", args.fNProcesses, {0});
          PARSE_FLAG(FlagArg, argc, argv, argIdx, "Ltype", args.fObjectFilterType, {}, ConvertFilterType);
@@ -612,6 +622,89 @@ static Int_t ParseFilterFile(const std::optional<std::string> &filterFileName,
    return 0;
 }
 
+// The merge manifest written next to the output in incremental mode (-incremental).
+// It records the identity of the output and of every input that went into it,
+// so that a subsequent run can tell apart inputs that are already merged from
+// new or changed ones.
+struct HAddManifestEntry {
+   std::string fUUID;
+   Long64_t fSize = -1;
+   Long_t fMTime = -1;
+   std::string fPath;
+};
+
+struct HAddManifest {
+   std::string fOutputUUID;
+   std::vector<HAddManifestEntry> fInputs;
+};
+
+static const char *const kManifestHeader = "hadd-state v1";
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the UUID of the ROOT file at `path` as a string, or an empty string
+/// if the file cannot be read.
+
+static std::string GetFileUUID(const char *path)
+{
+   std::unique_ptr<TFile> file{TFile::Open(path, "READ_WITHOUT_GLOBALREGISTRATION")};
+   if (!file || file->IsZombie())
+      return {};
+   return file->GetUUID().AsString();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the merge manifest from `name`. Returns nullopt if the file does not
+/// exist or cannot be parsed.
+
+static std::optional<HAddManifest> ReadMergeManifest(const std::string &name)
+{
+   std::ifstream in(name);
+   if (!in)
+      return {};
+   std::string line;
+   if (!std::getline(in, line) || line != kManifestHeader)
+      return {};
+   HAddManifest manifest;
+   while (std::getline(in, line)) {
+      std::istringstream ss(line);
+      std::string tag;
+      ss >> tag;
+      if (tag == "output") {
+         ss >> manifest.fOutputUUID;
+      } else if (tag == "input") {
+         HAddManifestEntry entry;
+         ss >> entry.fUUID >> entry.fSize >> entry.fMTime >> std::ws;
+         // the path is everything after the fixed fields; it may contain spaces
+         std::getline(ss, entry.fPath);
+         if (entry.fPath.empty())
+            return {};
+         manifest.fInputs.push_back(std::move(entry));
+      }
+   }
+   return manifest;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the merge manifest to `name`, going through a temporary file so that
+/// an interrupted write never leaves a truncated manifest behind.
+
+static bool WriteMergeManifest(const std::string &name, const HAddManifest &manifest)
+{
+   const std::string tmpName = name + ".tmp";
+   {
+      std::ofstream out(tmpName);
+      if (!out)
+         return false;
+      out << kManifestHeader << "\n";
+      out << "output " << manifest.fOutputUUID << "\n";
+      for (const auto &entry : manifest.fInputs)
+         out << "input " << entry.fUUID << " " << entry.fSize << " " << entry.fMTime << " " << entry.fPath << "\n";
+      if (!out)
+         return false;
+   }
+   return gSystem->Rename(tmpName.c_str(), name.c_str()) == 0;
+}
+
 int main(int argc, char **argv)
 {
    if (argc < 3 || "-h" == std::string(argv[1]) || "--help" == std::string(argv[1])) {
@@ -742,6 +835,105 @@ int main(int argc, char **argv)
       Err() << "could not find any valid input file " << std::endl;
       return 1;
    }
+
+   // In incremental mode, consult the merge manifest written by the previous
+   // run to find out which inputs are new. If the existing output is up to
+   // date, the unchanged inputs are not merged again: the previous output and
+   // the new inputs are merged into a temporary file which then replaces the
+   // target. The manifest is only updated after a successful merge, so an
+   // interrupted run leaves the previous output and state untouched and the
+   // next invocation simply redoes the missing work.
+   std::string mergeTarget = targetname;
+   std::string manifestName;
+   HAddManifest newManifest;
+   if (args.fIncremental) {
+      if (args.fAppend) {
+         Err() << "-incremental cannot be combined with -a.\n";
+         return 1;
+      }
+      manifestName = std::string(targetname) + ".haddstate";
+
+      std::optional<HAddManifest> oldManifest = ReadMergeManifest(manifestName);
+      bool haveValidState = false;
+      if (oldManifest) {
+         if (gSystem->AccessPathName(targetname, kReadPermission) == kFALSE)
+            haveValidState = !oldManifest->fOutputUUID.empty() && GetFileUUID(targetname) == oldManifest->fOutputUUID;
+         if (!haveValidState)
+            Warn() << "state file " << manifestName << " does not match the current output, merging from scratch.\n";
+      }
+
+      bool fullMerge = !haveValidState;
+      std::vector<std::string> newInputs;
+      std::size_t nMatched = 0;
+      for (const std::string &path : allSubfiles) {
+         HAddManifestEntry entry;
+         entry.fPath = path;
+         FileStat_t st;
+         if (gSystem->GetPathInfo(path.c_str(), st) == 0) {
+            entry.fSize = st.fSize;
+            entry.fMTime = st.fMtime;
+         }
+         const HAddManifestEntry *known = nullptr;
+         if (haveValidState) {
+            for (const auto &e : oldManifest->fInputs) {
+               if (e.fPath == path) {
+                  known = &e;
+                  break;
+               }
+            }
+         }
+         if (known && known->fSize == entry.fSize && known->fMTime == entry.fMTime) {
+            // untouched since the last run, no need to open it
+            newManifest.fInputs.push_back(*known);
+            ++nMatched;
+            continue;
+         }
+         entry.fUUID = GetFileUUID(path.c_str());
+         if (haveValidState && !entry.fUUID.empty()) {
+            // a touched, renamed or copied file with the same UUID has the same content
+            bool sameContent = false;
+            for (const auto &e : oldManifest->fInputs) {
+               if (e.fUUID == entry.fUUID) {
+                  sameContent = true;
+                  break;
+               }
+            }
+            if (sameContent) {
+               newManifest.fInputs.push_back(std::move(entry));
+               ++nMatched;
+               continue;
+            }
+         }
+         if (known) {
+            // the path now holds different content than what was merged; the
+            // stale content cannot be subtracted from the output again
+            Warn() << path << " changed since the last merge, merging from scratch.\n";
+            fullMerge = true;
+         }
+         newInputs.push_back(path);
+         newManifest.fInputs.push_back(std::move(entry));
+      }
+      if (!fullMerge && nMatched != oldManifest->fInputs.size()) {
+         Warn() << "some previously merged inputs are gone, merging from scratch.\n";
+         fullMerge = true;
+      }
+
+      if (!fullMerge) {
+         if (newInputs.empty()) {
+            if (verbosity > 0)
+               Info() << targetname << " is up to date, nothing to merge.\n";
+            return 0;
+         }
+         if (verbosity > 1)
+            Info() << "incremental merge of " << newInputs.size() << " new input(s) into " << targetname << ".\n";
+         // merge the previous output together with the new inputs
+         newInputs.insert(newInputs.begin(), targetname);
+         allSubfiles = std::move(newInputs);
+      }
+      // write into a temporary file and replace the target only on success
+      mergeTarget = std::string(targetname) + ".haddtmp";
+   }
+
    // The next snippet determines the output compression if unset
    if (newcomp == -1) {
       if (args.fUseFirstInputCompression || args.fKeepCompressionAsIs) {
@@ -769,8 +961,8 @@ int main(int argc, char **argv)
          Err() << "error opening target file for update :" << targetname << ".\n";
          return 2;
       }
-   } else if (!fileMerger.OutputFile(targetname, args.fForce, newcomp)) {
-      Err() << "error opening target file (does " << targetname << " exist?).\n";
+   } else if (!fileMerger.OutputFile(mergeTarget.c_str(), args.fForce || args.fIncremental, newcomp)) {
+      Err() << "error opening target file (does " << mergeTarget << " exist?).\n";
       if (!args.fForce)
          Info() << "pass \"-f\" argument to force re-creation of output file.\n";
       return 1;
@@ -892,6 +1084,20 @@ int main(int argc, char **argv)
    status = sequentialMerge(fileMerger, 0, allSubfiles.size());
 #endif
 
+   if (status && args.fIncremental) {
+      // atomically promote the temporary output and persist the new state
+      gSystem->Unlink(targetname);
+      if (gSystem->Rename(mergeTarget.c_str(), targetname) != 0) {
+         Err() << "could not move " << mergeTarget << " to " << targetname << ".\n";
+         return 1;
+      }
+      newManifest.fOutputUUID = GetFileUUID(targetname);
+      if (newManifest.fOutputUUID.empty() || !WriteMergeManifest(manifestName, newManifest)) {
+         Warn() << "could not write state file " << manifestName << "; the next merge will start from scratch.\n";
+         gSystem->Unlink(manifestName.c_str());
+      }
+   }
+
    if (status) {
       if (verbosity == 1) {
          Info() << "merged " << allSubfiles.size() << " (" << fileMerger.GetMergeList()->GetEntries()
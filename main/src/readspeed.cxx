@@ -20,7 +20,14 @@ int main(int argc, char **argv)
    if (!args.fShouldRun)
       return 1; // ParseArgs has printed the --help, has run the --test or has encountered an issue and logged about it
 
-   PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+   if (args.fCompareFiles.size() == 2)
+      return CompareRuns(args.fCompareFiles[0], args.fCompareFiles[1], args.fCompareThreshold);
+
+   const auto result = EvalThroughput(args.fData, args.fNThreads);
+   if (args.fJsonOutput)
+      PrintThroughputJson(result);
+   else
+      PrintThroughput(result);
 
    return 0;
 }
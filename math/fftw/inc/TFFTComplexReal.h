@@ -62,6 +62,7 @@ class TFFTComplexReal: public TVirtualFFT {
    void       SetPointComplex(Int_t ipoint, TComplex &c) override;
    void       SetPointsComplex(const Double_t *re, const Double_t *im) override;
    void       Transform() override;
+   virtual void TransformBatch(Int_t nbatch, Double_t *in, Double_t *out);
 
    ClassDefOverride(TFFTComplexReal,0);
 };
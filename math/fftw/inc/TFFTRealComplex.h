@@ -60,6 +60,7 @@ class TFFTRealComplex: public TVirtualFFT {
    void       SetPointComplex(Int_t ipoint, TComplex &c) override;
    void       SetPointsComplex(const Double_t *re, const Double_t *im) override;
    void       Transform() override;
+   virtual void TransformBatch(Int_t nbatch, Double_t *in, Double_t *out);
 
    ClassDefOverride(TFFTRealComplex,0);
 };
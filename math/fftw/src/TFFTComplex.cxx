@@ -40,6 +40,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTComplex.h"
+#include "TFFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -102,13 +103,12 @@ TFFTComplex::TFFTComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan is owned by the process-wide plan cache
+///and stays around until the root session is over, to be reused by other
+///transforms of the same size and type
 
 TFFTComplex::~TFFTComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = nullptr;
    fftw_free((fftw_complex*)fIn);
    if (fOut)
@@ -135,21 +135,22 @@ TFFTComplex::~TFFTComplex()
 /// - "EX" (from "exhaustive") - the most optimal way is found
 ///This option should be chosen depending on how many transforms of the same size and
 ///type are going to be done. Planning is only done once, for the first transform of this
-///size and type.
+///size and type: the plan is stored in a process-wide cache and reused by all
+///later transforms of the same geometry, sign and flags.
 
 void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
 {
    fSign = sign;
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = nullptr;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fOut, sign,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fIn, sign, MapFlag(flags));
+   UInt_t mapped = MapFlag(flags);
+   std::string key = TFFTWPlanCache::MakeKey(GetType(), fNdim, fN, fOut == nullptr, mapped, sign);
+   fPlan = TFFTWPlanCache::Instance().GetPlan(key, [&]() -> void* {
+      if (fOut)
+         return (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fOut, sign, mapped);
+      else
+         return (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fIn, sign, mapped);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -157,8 +158,14 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
 
 void TFFTComplex::Transform()
 {
-   if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+   if (fPlan){
+      //the plan may come from the cache and have been created on the arrays of
+      //another object, hence the new-array execute function
+      if (fOut)
+         fftw_execute_dft((fftw_plan)fPlan, (fftw_complex*)fIn, (fftw_complex*)fOut);
+      else
+         fftw_execute_dft((fftw_plan)fPlan, (fftw_complex*)fIn, (fftw_complex*)fIn);
+   }
    else {
       Error("Transform", "transform not initialised");
       return;
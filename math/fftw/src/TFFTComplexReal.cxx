@@ -42,6 +42,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTComplexReal.h"
+#include "TFFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -108,13 +109,12 @@ TFFTComplexReal::TFFTComplexReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan is owned by the process-wide plan cache
+///and stays around until the root session is over, to be reused by other
+///transforms of the same size and type
 
 TFFTComplexReal::~TFFTComplexReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = nullptr;
    fftw_free((fftw_complex*)fIn);
    if (fOut)
@@ -143,20 +143,21 @@ TFFTComplexReal::~TFFTComplexReal()
 ///
 ///This option should be chosen depending on how many transforms of the same size and
 ///type are going to be done. Planning is only done once, for the first transform of this
-///size and type.
+///size and type: the plan is stored in a process-wide cache and reused by all
+///later transforms of the same geometry and flags.
 
 void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*/)
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = nullptr;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN,(fftw_complex*)fIn,(Double_t*)fOut, MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fIn, MapFlag(flags));
+   UInt_t mapped = MapFlag(flags);
+   std::string key = TFFTWPlanCache::MakeKey(GetType(), fNdim, fN, fOut == nullptr, mapped);
+   fPlan = TFFTWPlanCache::Instance().GetPlan(key, [&]() -> void* {
+      if (fOut)
+         return (void*)fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fOut, mapped);
+      else
+         return (void*)fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fIn, mapped);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -164,14 +165,75 @@ void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*
 
 void TFFTComplexReal::Transform()
 {
-   if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+   if (fPlan){
+      //the plan may come from the cache and have been created on the arrays of
+      //another object, hence the new-array execute function
+      if (fOut)
+         fftw_execute_dft_c2r((fftw_plan)fPlan, (fftw_complex*)fIn, (Double_t*)fOut);
+      else
+         fftw_execute_dft_c2r((fftw_plan)fPlan, (fftw_complex*)fIn, (Double_t*)fIn);
+   }
    else {
       Error("Transform", "transform was not initialized");
       return;
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Computes the inverse transforms of nbatch equal-size signals in one call.
+///The input array contains nbatch blocks of fN[0]/2+1 complex numbers in
+///interleaved (re, im) format; the output array receives nbatch signals of
+///fN[0] real points each, stored contiguously. Unlike for Transform(), the
+///input array is preserved; as usual, the output is not normalized.
+///
+///The batched plans use the flags of the last Init() call (FFTW_ESTIMATE if
+///Init() was not run) and are cached process-wide, so transforming many
+///batches of the same size amortizes an expensive "M" planning.
+///Only 1-dimensional transforms are supported.
+
+void TFFTComplexReal::TransformBatch(Int_t nbatch, Double_t *in, Double_t *out)
+{
+   if (fNdim != 1){
+      Error("TransformBatch", "batched transforms are only supported for 1-dimensional transforms");
+      return;
+   }
+   if (nbatch <= 0 || !in || !out){
+      Error("TransformBatch", "invalid input");
+      return;
+   }
+
+   Int_t n = fN[0];
+   Int_t nin = n/2 + 1;
+   //FFTW_UNALIGNED makes the plan applicable to the caller's arrays, whatever
+   //their alignment; FFTW_PRESERVE_INPUT (supported for 1d c2r) keeps the
+   //caller's spectra intact
+   UInt_t mapped = MapFlag(fFlags) | FFTW_UNALIGNED | FFTW_PRESERVE_INPUT;
+
+   //transform in chunks of fixed size, so at most two plans (full chunk and
+   //remainder) are needed per transform size and flags
+   const Int_t kBatchChunk = 64;
+   Int_t done = 0;
+   while (done < nbatch){
+      Int_t m = (nbatch - done < kBatchChunk) ? nbatch - done : kBatchChunk;
+      std::string key = TFFTWPlanCache::MakeKey("C2R-batch", 1, fN, kFALSE, mapped, 0, nullptr, m);
+      void *plan = TFFTWPlanCache::Instance().GetPlan(key, [&]() -> void* {
+         fftw_complex *tmpin = (fftw_complex*)fftw_malloc(sizeof(fftw_complex)*m*nin);
+         Double_t *tmpout = (Double_t*)fftw_malloc(sizeof(Double_t)*m*n);
+         void *p = (void*)fftw_plan_many_dft_c2r(1, &n, m, tmpin, nullptr, 1, nin,
+                                                 tmpout, nullptr, 1, n, mapped);
+         fftw_free(tmpin);
+         fftw_free(tmpout);
+         return p;
+      });
+      if (!plan){
+         Error("TransformBatch", "planning failed");
+         return;
+      }
+      fftw_execute_dft_c2r((fftw_plan)plan, ((fftw_complex*)in) + done*nin, out + done*n);
+      done += m;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Fills the argument array with the computed transform
 /// Works only for output (input array is destroyed in a C2R transform)
@@ -59,8 +59,11 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTReal.h"
+#include "TFFTWPlanCache.h"
 #include "fftw3.h"
 
+#include <vector>
+
 ClassImp(TFFTReal);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -119,11 +122,11 @@ TFFTReal::TFFTReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///clean-up
+///clean-up. The plan is owned by the process-wide plan cache and is kept
+///around for reuse
 
 TFFTReal::~TFFTReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = nullptr;
    fftw_free(fIn);
    fIn = nullptr;
@@ -175,18 +178,24 @@ TFFTReal::~TFFTReal()
 
 void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 {
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = nullptr;
 
    if (!fKind)
       fKind = (fftw_r2r_kind*)fftw_malloc(sizeof(fftw_r2r_kind)*fNdim);
 
    if (MapOptions(kind)){
-      if (fOut)
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, MapFlag(flags));
-      else
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, MapFlag(flags));
+      UInt_t mapped = MapFlag(flags);
+      //the mapped kinds enter the key, the raw ones are ambiguous (see MapOptions)
+      std::vector<Int_t> mappedKind(fNdim);
+      for (Int_t i=0; i<fNdim; i++)
+         mappedKind[i] = Int_t(((fftw_r2r_kind*)fKind)[i]);
+      std::string key = TFFTWPlanCache::MakeKey("R2R", fNdim, fN, fOut == nullptr, mapped, 0, mappedKind.data());
+      fPlan = TFFTWPlanCache::Instance().GetPlan(key, [&]() -> void* {
+         if (fOut)
+            return (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, mapped);
+         else
+            return (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, mapped);
+      });
       fFlags = flags;
    }
 }
@@ -196,8 +205,14 @@ void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 
 void TFFTReal::Transform()
 {
-   if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+   if (fPlan){
+      //the plan may come from the cache and have been created on the arrays of
+      //another object, hence the new-array execute function
+      if (fOut)
+         fftw_execute_r2r((fftw_plan)fPlan, (Double_t*)fIn, (Double_t*)fOut);
+      else
+         fftw_execute_r2r((fftw_plan)fPlan, (Double_t*)fIn, (Double_t*)fIn);
+   }
    else {
       Error("Transform", "transform hasn't been initialised");
       return;
@@ -43,6 +43,7 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTRealComplex.h"
+#include "TFFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -112,13 +113,12 @@ TFFTRealComplex::TFFTRealComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan is owned by the process-wide plan cache
+///and stays around until the root session is over, to be reused by other
+///transforms of the same size and type
 
 TFFTRealComplex::~TFFTRealComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = nullptr;
    fftw_free(fIn);
    fIn = nullptr;
@@ -147,20 +147,21 @@ TFFTRealComplex::~TFFTRealComplex()
 ///
 ///This option should be chosen depending on how many transforms of the same size and
 ///type are going to be done. Planning is only done once, for the first transform of this
-///size and type.
+///size and type: the plan is stored in a process-wide cache and reused by all
+///later transforms of the same geometry and flags.
 
 void TFFTRealComplex::Init(Option_t *flags,Int_t /*sign*/, const Int_t* /*kind*/)
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = nullptr;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, MapFlag(flags));
+   UInt_t mapped = MapFlag(flags);
+   std::string key = TFFTWPlanCache::MakeKey(GetType(), fNdim, fN, fOut == nullptr, mapped);
+   fPlan = TFFTWPlanCache::Instance().GetPlan(key, [&]() -> void* {
+      if (fOut)
+         return (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut, mapped);
+      else
+         return (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, mapped);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -170,7 +171,12 @@ void TFFTRealComplex::Transform()
 {
 
    if (fPlan){
-      fftw_execute((fftw_plan)fPlan);
+      //the plan may come from the cache and have been created on the arrays of
+      //another object, hence the new-array execute function
+      if (fOut)
+         fftw_execute_dft_r2c((fftw_plan)fPlan, (Double_t*)fIn, (fftw_complex*)fOut);
+      else
+         fftw_execute_dft_r2c((fftw_plan)fPlan, (Double_t*)fIn, (fftw_complex*)fIn);
    }
    else {
       Error("Transform", "transform hasn't been initialised");
@@ -178,6 +184,61 @@ void TFFTRealComplex::Transform()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Computes the transforms of nbatch equal-size signals in one call.
+///The input array contains nbatch signals of fN[0] points each, stored
+///contiguously; the output array receives nbatch blocks of fN[0]/2+1 complex
+///numbers in interleaved (re, im) format, i.e. nbatch*2*(fN[0]/2+1) doubles.
+///The input array is preserved and, like for Transform(), the output is not
+///normalized.
+///
+///The batched plans use the flags of the last Init() call (FFTW_ESTIMATE if
+///Init() was not run) and are cached process-wide, so transforming many
+///batches of the same size amortizes an expensive "M" planning.
+///Only 1-dimensional transforms are supported.
+
+void TFFTRealComplex::TransformBatch(Int_t nbatch, Double_t *in, Double_t *out)
+{
+   if (fNdim != 1){
+      Error("TransformBatch", "batched transforms are only supported for 1-dimensional transforms");
+      return;
+   }
+   if (nbatch <= 0 || !in || !out){
+      Error("TransformBatch", "invalid input");
+      return;
+   }
+
+   Int_t n = fN[0];
+   Int_t nout = n/2 + 1;
+   //FFTW_UNALIGNED makes the plan applicable to the caller's arrays, whatever
+   //their alignment; the plan itself is created on scratch arrays
+   UInt_t mapped = MapFlag(fFlags) | FFTW_UNALIGNED;
+
+   //transform in chunks of fixed size, so at most two plans (full chunk and
+   //remainder) are needed per transform size and flags
+   const Int_t kBatchChunk = 64;
+   Int_t done = 0;
+   while (done < nbatch){
+      Int_t m = (nbatch - done < kBatchChunk) ? nbatch - done : kBatchChunk;
+      std::string key = TFFTWPlanCache::MakeKey("R2C-batch", 1, fN, kFALSE, mapped, 0, nullptr, m);
+      void *plan = TFFTWPlanCache::Instance().GetPlan(key, [&]() -> void* {
+         Double_t *tmpin = (Double_t*)fftw_malloc(sizeof(Double_t)*m*n);
+         fftw_complex *tmpout = (fftw_complex*)fftw_malloc(sizeof(fftw_complex)*m*nout);
+         void *p = (void*)fftw_plan_many_dft_r2c(1, &n, m, tmpin, nullptr, 1, n,
+                                                 tmpout, nullptr, 1, nout, mapped);
+         fftw_free(tmpin);
+         fftw_free(tmpout);
+         return p;
+      });
+      if (!plan){
+         Error("TransformBatch", "planning failed");
+         return;
+      }
+      fftw_execute_dft_r2c((fftw_plan)plan, in + done*n, ((fftw_complex*)out) + done*nout);
+      done += m;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Fills the array data with the computed transform.
 ///Only (roughly) a half of the transform is copied (exactly the output of FFTW),
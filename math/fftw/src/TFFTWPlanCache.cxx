@@ -0,0 +1,58 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TFFTWPlanCache.h"
+#include "TString.h"
+
+////////////////////////////////////////////////////////////////////////////////
+///Returns the process-wide cache instance
+
+TFFTWPlanCache &TFFTWPlanCache::Instance()
+{
+   static TFFTWPlanCache cache;
+   return cache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///Builds the cache key for a transform of the given type and geometry.
+///All the parameters that influence the generated plan have to enter the key:
+///the transform sizes, the in-place or out-of-place layout, the (already
+///mapped) FFTW flags, the sign for complex transforms, the r2r kinds and the
+///number of transforms for batched plans
+
+std::string TFFTWPlanCache::MakeKey(const char *type, Int_t ndim, const Int_t *n, Bool_t inPlace, UInt_t flags,
+                                    Int_t sign, const Int_t *kind, Int_t howmany)
+{
+   TString key = TString::Format("%s:%d:", type, ndim);
+   for (Int_t i = 0; i < ndim; i++)
+      key += TString::Format("%d,", n[i]);
+   key += TString::Format(":%d:%u:%d:%d", Int_t(inPlace), flags, sign, howmany);
+   if (kind) {
+      key += ":";
+      for (Int_t i = 0; i < ndim; i++)
+         key += TString::Format("%d,", kind[i]);
+   }
+   return std::string(key.Data());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///Returns the plan stored under the key, creating it with the provided planner
+///function on the first request. The planner runs while the cache mutex is
+///held, serializing the (not thread safe) FFTW planner. A failed planning
+///(planner returning null) is not cached and is retried on the next request
+
+void *TFFTWPlanCache::GetPlan(const std::string &key, const std::function<void *()> &planner)
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   void *&plan = fPlans[key];
+   if (!plan)
+      plan = planner();
+   return plan;
+}
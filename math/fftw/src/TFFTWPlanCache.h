@@ -0,0 +1,59 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TFFTWPlanCache
+#define ROOT_TFFTWPlanCache
+
+#include "RtypesCore.h"
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class TFFTWPlanCache
+///
+/// Internal process-wide cache for FFTW plans, shared by the TFFT* interface
+/// classes. Plans are keyed by the transform type, shape, flags and, where
+/// applicable, sign, r2r kinds and batch size, so a plan created once (e.g.
+/// with the expensive "M"easure flag) is reused by every later transform of
+/// the same geometry instead of being re-created per object.
+///
+/// The cache keeps ownership of the plans for the lifetime of the process.
+/// Since a cached plan records the arrays it was created with, it must be
+/// executed with the FFTW new-array execute functions (fftw_execute_dft_r2c
+/// and friends), never with plain fftw_execute.
+///
+/// All planner invocations go through the cache mutex: the FFTW planner is
+/// not thread safe, so this also serializes concurrent plan creation.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+class TFFTWPlanCache {
+ public:
+   static TFFTWPlanCache &Instance();
+
+   static std::string MakeKey(const char *type, Int_t ndim, const Int_t *n, Bool_t inPlace, UInt_t flags,
+                              Int_t sign = 0, const Int_t *kind = nullptr, Int_t howmany = 1);
+
+   void *GetPlan(const std::string &key, const std::function<void *()> &planner);
+
+ private:
+   TFFTWPlanCache() = default;
+   TFFTWPlanCache(const TFFTWPlanCache &) = delete;
+   TFFTWPlanCache &operator=(const TFFTWPlanCache &) = delete;
+
+   std::mutex fMutex;                   //protects fPlans and the FFTW planner
+   std::map<std::string, void *> fPlans; //cached plans, keyed by MakeKey()
+};
+
+#endif
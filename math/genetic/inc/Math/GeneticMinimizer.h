@@ -42,6 +42,8 @@ struct GeneticMinimizerParameters {
    Double_t fSC_factor;
    Double_t fConvCrit;
    Int_t fSeed;
+   Int_t fParallel;     // evaluate the population in parallel (requires implicit multi-threading)
+   Int_t fSteadyState;  // reuse the fitness of individuals whose genes did not change
 
 
    // constructor with default value
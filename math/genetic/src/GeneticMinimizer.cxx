@@ -8,7 +8,17 @@
 
 #include "TError.h"
 
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
+#include <cfloat>
+#include <map>
+#include <memory>
 
 namespace ROOT {
 namespace Math {
@@ -73,12 +83,134 @@ public:
       return fFunc(&x[0]);
    }
 
+   // thread-safe variant of Evaluate : the fixed parameters are merged with the
+   // free ones in the caller-provided buffer instead of the shared fValues, and
+   // the evaluation uses the given (possibly cloned) function object
+   Double_t Evaluate(const std::vector<double> & factors,
+                     const ROOT::Math::IMultiGenFunction & func,
+                     std::vector<double> & buffer) const {
+      unsigned int n = fValues.size();
+      if (n == 0 || fNFree == n)
+         return func(&factors[0]);
+
+      buffer = fValues;
+      for (unsigned int i = 0, j = 0; i < n ; ++i) {
+         if (!fFixedParFlag[i] ) {
+            assert (j < fNFree);
+            buffer[i] = factors[j];
+            j++;
+         }
+      }
+      return func(&buffer[0]);
+   }
+
+   const ROOT::Math::IMultiGenFunction & Function() const { return fFunc; }
+
+   void AddNCalls(unsigned int n) { fNCalls += n; }
+
    Double_t EstimatorFunction(std::vector<double> & factors ) override{
       fNCalls += 1;
       return Evaluate( factors);
    }
 };
 
+// specialization of the TMVA genetic algorithm which can evaluate the
+// population in parallel, cloning the objective function once per worker
+// thread, and which in steady-state mode reuses the estimator value of
+// individuals whose genes did not change since the previous generation
+class ParallelGeneticAlgorithm : public TMVA::GeneticAlgorithm {
+
+public:
+   ParallelGeneticAlgorithm(MultiGenFunctionFitness & target, Int_t populationSize,
+                            const std::vector<TMVA::Interval*> & ranges, UInt_t seed,
+                            Bool_t parallel, Bool_t steadyState) :
+      TMVA::GeneticAlgorithm(target, populationSize, ranges, seed),
+      fTarget(target),
+      fParallel(parallel),
+      fSteadyState(steadyState)
+   {}
+
+   Double_t CalculateFitness() override {
+
+      bool useParallel = false;
+#ifdef R__USE_IMT
+      useParallel = fParallel && ROOT::IsImplicitMTEnabled();
+#endif
+      if (!useParallel && !fSteadyState)
+         return TMVA::GeneticAlgorithm::CalculateFitness();
+
+      int popSize = fPopulation.GetPopulationSize();
+
+      // collect the individuals which really need an evaluation : in
+      // steady-state mode the survivors of the previous generation keep
+      // their cached estimator value
+      std::map<std::vector<Double_t>, Double_t> estimators;
+      std::vector<int> toEvaluate;
+      toEvaluate.reserve(popSize);
+      for (int index = 0; index < popSize; ++index) {
+         TMVA::GeneticGenes* genes = fPopulation.GetGenes(index);
+         if (fSteadyState) {
+            auto cached = fFitnessCache.find(genes->GetFactors());
+            if (cached != fFitnessCache.end()) {
+               genes->SetFitness( NewFitness(genes->GetFitness(), cached->second) );
+               estimators.insert(*cached);
+               continue;
+            }
+         }
+         toEvaluate.push_back(index);
+      }
+
+      std::vector<Double_t> results(toEvaluate.size());
+#ifdef R__USE_IMT
+      if (useParallel && toEvaluate.size() > 1) {
+         auto evalOne = [&](UInt_t i) {
+            // one cloned function context and one scratch buffer per worker thread
+            thread_local std::unique_ptr<ROOT::Math::IMultiGenFunction> funcClone;
+            thread_local const ROOT::Math::IMultiGenFunction *clonedFrom = nullptr;
+            thread_local std::vector<Double_t> buffer;
+            if (clonedFrom != &fTarget.Function()) {
+               funcClone.reset(fTarget.Function().Clone());
+               clonedFrom = &fTarget.Function();
+            }
+            results[i] = fTarget.Evaluate(fPopulation.GetGenes(toEvaluate[i])->GetFactors(), *funcClone, buffer);
+         };
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(evalOne, ROOT::TSeqU(toEvaluate.size()));
+      } else
+#endif
+      {
+         std::vector<Double_t> buffer;
+         for (unsigned int i = 0; i < toEvaluate.size(); ++i)
+            results[i] = fTarget.Evaluate(fPopulation.GetGenes(toEvaluate[i])->GetFactors(), fTarget.Function(), buffer);
+      }
+      fTarget.AddNCalls(toEvaluate.size());
+
+      for (unsigned int i = 0; i < toEvaluate.size(); ++i) {
+         TMVA::GeneticGenes* genes = fPopulation.GetGenes(toEvaluate[i]);
+         if (fSteadyState)
+            estimators[genes->GetFactors()] = results[i];
+         genes->SetFitness( NewFitness(genes->GetFitness(), results[i]) );
+      }
+
+      fBestFitness = DBL_MAX;
+      for (int index = 0; index < popSize; ++index)
+         fBestFitness = std::min(fBestFitness, fPopulation.GetGenes(index)->GetFitness());
+
+      if (fSteadyState)
+         fFitnessCache.swap(estimators);
+
+      fPopulation.Sort();
+
+      return fBestFitness;
+   }
+
+private:
+   MultiGenFunctionFitness & fTarget;
+   Bool_t fParallel;
+   Bool_t fSteadyState;
+   std::map<std::vector<Double_t>, Double_t> fFitnessCache;  // estimator value per gene vector of the previous generation
+};
+
 GeneticMinimizerParameters::GeneticMinimizerParameters()
 {
    // constructor of parameters with default values (use 100 is max iterations is not defined)
@@ -92,6 +224,8 @@ GeneticMinimizerParameters::GeneticMinimizerParameters()
    fConvCrit =10.0 * ROOT::Math::MinimizerOptions::DefaultTolerance(); // default is 0.001
    if (fConvCrit <=0 ) fConvCrit = 0.001;
    fSeed=0;  // random seed
+   fParallel=0;     // by default evaluate the population serially
+   fSteadyState=0;  // by default re-evaluate the full population at each generation
 }
 
 // genetic minimizer class
@@ -210,6 +344,8 @@ void  GeneticMinimizer::GetGeneticOptions(ROOT::Math::MinimizerOptions & opt) co
    geneticOpt.SetValue("SC_factor",fParameters.fSC_factor);
    geneticOpt.SetValue("ConvCrit",fParameters.fConvCrit);
    geneticOpt.SetValue("RandomSeed",fParameters.fSeed);
+   geneticOpt.SetValue("Parallel",fParameters.fParallel);
+   geneticOpt.SetValue("SteadyState",fParameters.fSteadyState);
 
    opt.SetExtraOptions(geneticOpt);
 }
@@ -239,6 +375,8 @@ void GeneticMinimizer::SetOptions(const ROOT::Math::MinimizerOptions & opt)
    geneticOpt->GetValue("SC_factor",fParameters.fSC_factor);
    geneticOpt->GetValue("ConvCrit",fParameters.fConvCrit);
    geneticOpt->GetValue("RandomSeed",fParameters.fSeed);
+   geneticOpt->GetValue("Parallel",fParameters.fParallel);
+   geneticOpt->GetValue("SteadyState",fParameters.fSteadyState);
 
    // use same of options in base class
    int maxiter = opt.MaxIterations();
@@ -261,7 +399,8 @@ bool GeneticMinimizer::Minimize()
    if (MaxIterations() > 0) fParameters.fNsteps = MaxIterations();
    if (Tolerance() > 0) fParameters.fConvCrit = 10* Tolerance();
 
-   TMVA::GeneticAlgorithm mg( *fFitness, fParameters.fPopSize, fRanges, fParameters.fSeed );
+   ParallelGeneticAlgorithm mg( *static_cast<MultiGenFunctionFitness*>(fFitness), fParameters.fPopSize, fRanges,
+                                fParameters.fSeed, fParameters.fParallel, fParameters.fSteadyState );
 
    if (PrintLevel() > 0) {
       std::cout << "GeneticMinimizer::Minimize  - Start iterating - max iterations = " <<  MaxIterations()
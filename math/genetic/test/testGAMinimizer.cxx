@@ -1,6 +1,7 @@
 #include <iostream>
 
 #include "Math/GeneticMinimizer.h"
+#include "Math/GenAlgoOptions.h"
 
 #include "TMath.h"
 
@@ -121,6 +122,30 @@ int testGAMinimizer(int verbose = 0) {
    if (!ok) Error("testGAMinimizer","Test failed for MultiMin");
    status |= !ok;
 
+   if (verbose) {
+      cout << "****************************************************\n";
+      cout << "Rosenbrock Function Minimization (steady-state mode) \n";
+   }
+   ROOT::Math::GeneticMinimizer gaSteadyState;
+   RosenBrockFunction rosenBrockSS;
+   gaSteadyState.SetFunction(rosenBrockSS);
+   gaSteadyState.SetLimitedVariable(0, "x", 0, 0, -5, +5);
+   gaSteadyState.SetLimitedVariable(1, "y", 0, 0, -5, +5);
+   gaSteadyState.SetPrintLevel(verbose);
+   gaSteadyState.SetMaxIterations(500);
+   gaSteadyState.SetRandomSeed(111);
+   ROOT::Math::MinimizerOptions ssOpt = gaSteadyState.Options();
+   ROOT::Math::GenAlgoOptions ssExtraOpt;
+   ssExtraOpt.SetValue("SteadyState", 1);
+   ssOpt.SetExtraOptions(ssExtraOpt);
+   gaSteadyState.SetOptions(ssOpt);
+   gaSteadyState.Minimize();
+   const double * xminSS = gaSteadyState.X();
+   cout << "RosenBrock (steady-state) min: " << gaSteadyState.MinValue() << " x = [" << xminSS[0] << "] [" << xminSS[1] << "]" << endl;
+   ok =  (std::abs(gaSteadyState.MinValue() ) < 5.E-2 );
+   if (!ok) Error("testGAMinimizer","Test failed for RosenBrock in steady-state mode");
+   status |= !ok;
+
    if (status) cout << "Test Failed !" << endl;
    else cout << "Done!" << endl;
 
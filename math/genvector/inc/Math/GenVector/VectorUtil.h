@@ -22,6 +22,8 @@
 
 #include "Math/GenVector/Boost.h"
 
+#include <cstddef>
+
 namespace ROOT {
 
    namespace Math {
@@ -541,6 +543,122 @@ namespace ROOT {
 
 
 
+         // BULK TRANSFORMATIONS
+         // apply a common transformation to a whole collection in one call;
+         // the transformation parameters are computed once and the loop body
+         // is free of function calls so the compiler can vectorize it
+
+         /**
+          Boost every Lorentz vector of a collection in place with a common boost vector.
+          Equivalent to calling boost() on each element, but the boost parameters are
+          computed only once; use this to transform a whole collection (e.g. a
+          ROOT::RVec of LorentzVector inside an RDataFrame expression) per call
+          instead of per element.
+          The requirements on the element type are that it implements the
+          X(), Y(), Z(), T() and SetXYZT methods, the collection only needs to
+          be iterable (ROOT::RVec, std::vector, std::span, ...).
+          The beta of the boost must be <= 1 or the collection is left untouched.
+          */
+         template <class LVectorColl, class BoostVector>
+         void ApplyBoost(LVectorColl & vs, const BoostVector & b) {
+            double bx = b.X();
+            double by = b.Y();
+            double bz = b.Z();
+            double b2 = bx*bx + by*by + bz*bz;
+            if (b2 >= 1) {
+               GenVector::Throw ( "Beta Vector supplied to set Boost represents speed >= c");
+               return;
+            }
+            using std::sqrt;
+            double gamma = 1.0 / sqrt(1.0 - b2);
+            double gamma2 = b2 > 0 ? (gamma - 1.0)/b2 : 0.0;
+            for (auto & v : vs) {
+               double x = v.X();
+               double y = v.Y();
+               double z = v.Z();
+               double t = v.T();
+               double bp = bx*x + by*y + bz*z;
+               v.SetXYZT( x + gamma2*bp*bx + gamma*bx*t,
+                          y + gamma2*bp*by + gamma*by*t,
+                          z + gamma2*bp*bz + gamma*bz*t,
+                          gamma*(t + bp) );
+            }
+         }
+
+         /**
+          Boost n Lorentz vectors stored as separate component arrays (structure of
+          arrays) in place with a common boost vector.  This is the layout produced
+          by columnar readers and is the most SIMD friendly form of ApplyBoost.
+          The beta of the boost must be <= 1 or the arrays are left untouched.
+          */
+         template <class Scalar, class BoostVector>
+         void ApplyBoost(std::size_t n, Scalar * x, Scalar * y, Scalar * z, Scalar * t, const BoostVector & b) {
+            double bx = b.X();
+            double by = b.Y();
+            double bz = b.Z();
+            double b2 = bx*bx + by*by + bz*bz;
+            if (b2 >= 1) {
+               GenVector::Throw ( "Beta Vector supplied to set Boost represents speed >= c");
+               return;
+            }
+            using std::sqrt;
+            double gamma = 1.0 / sqrt(1.0 - b2);
+            double gamma2 = b2 > 0 ? (gamma - 1.0)/b2 : 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+               double bp = bx*x[i] + by*y[i] + bz*z[i];
+               Scalar t2 = gamma*(t[i] + bp);
+               x[i] = x[i] + gamma2*bp*bx + gamma*bx*t[i];
+               y[i] = y[i] + gamma2*bp*by + gamma*by*t[i];
+               z[i] = z[i] + gamma2*bp*bz + gamma*bz*t[i];
+               t[i] = t2;
+            }
+         }
+
+         /**
+          Rotate every Lorentz vector of a collection in place with a common rotation,
+          leaving the time components unchanged.  Equivalent to calling Rotate() on
+          each element, but the matrix elements are read only once.
+          The requirement on the element type is that it implements the
+          X(), Y(), Z(), T() and SetXYZT methods; the rotation matrix needs to
+          implement the (i,j) operator, as for Rotate().
+          */
+         template <class LVectorColl, class RotationMatrix>
+         void ApplyRotation(LVectorColl & vs, const RotationMatrix & rot) {
+            const double r00 = rot(0,0), r01 = rot(0,1), r02 = rot(0,2);
+            const double r10 = rot(1,0), r11 = rot(1,1), r12 = rot(1,2);
+            const double r20 = rot(2,0), r21 = rot(2,1), r22 = rot(2,2);
+            for (auto & v : vs) {
+               double x = v.X();
+               double y = v.Y();
+               double z = v.Z();
+               v.SetXYZT( r00*x + r01*y + r02*z,
+                          r10*x + r11*y + r12*z,
+                          r20*x + r21*y + r22*z,
+                          v.T() );
+            }
+         }
+
+         /**
+          Rotate n vectors stored as separate component arrays (structure of arrays)
+          in place with a common rotation.  The rotation matrix needs to implement
+          the (i,j) operator, as for Rotate().
+          */
+         template <class Scalar, class RotationMatrix>
+         void ApplyRotation(std::size_t n, Scalar * x, Scalar * y, Scalar * z, const RotationMatrix & rot) {
+            const double r00 = rot(0,0), r01 = rot(0,1), r02 = rot(0,2);
+            const double r10 = rot(1,0), r11 = rot(1,1), r12 = rot(1,2);
+            const double r20 = rot(2,0), r21 = rot(2,1), r22 = rot(2,2);
+            for (std::size_t i = 0; i < n; ++i) {
+               Scalar x2 = r00*x[i] + r01*y[i] + r02*z[i];
+               Scalar y2 = r10*x[i] + r11*y[i] + r12*z[i];
+               Scalar z2 = r20*x[i] + r21*y[i] + r22*z[i];
+               x[i] = x2;
+               y[i] = y2;
+               z[i] = z2;
+            }
+         }
+
+
          // non-template utility functions for all objects
 
 
@@ -0,0 +1,101 @@
+#include "Math/Boost.h"
+#include "Math/Rotation3D.h"
+#include "Math/RotationZYX.h"
+#include "Math/VectorUtil.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector4D.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ROOT::Math;
+
+bool AlmostEq(const XYZTVector &v1, const XYZTVector &v2)
+{
+   const double eps = 0.00000001;
+   return std::abs(v2.X() - v1.X()) < eps && std::abs(v2.Y() - v1.Y()) < eps && std::abs(v2.Z() - v1.Z()) < eps &&
+          std::abs(v2.T() - v1.T()) < eps;
+}
+
+int main()
+{
+   int nFailedTests = 0;
+
+   const int n = 100;
+   std::vector<XYZTVector> ref;
+   for (int i = 0; i < n; ++i) {
+      double x = 0.1 * i - 3., y = 0.2 * i - 7., z = 0.05 * i + 1.;
+      ref.emplace_back(x, y, z, std::sqrt(x * x + y * y + z * z + 1.));
+   }
+
+   XYZVector beta(0.3, -0.1, 0.55);
+
+   // collection boost against the per-element boost
+   std::vector<XYZTVector> vs(ref);
+   VectorUtil::ApplyBoost(vs, beta);
+   for (int i = 0; i < n; ++i) {
+      if (!AlmostEq(vs[i], VectorUtil::boost(ref[i], beta))) {
+         std::cout << "ApplyBoost (collection) test failed for element " << i << std::endl;
+         nFailedTests++;
+         break;
+      }
+   }
+
+   // structure-of-arrays boost against the per-element boost
+   std::vector<double> px(n), py(n), pz(n), e(n);
+   for (int i = 0; i < n; ++i) {
+      px[i] = ref[i].X();
+      py[i] = ref[i].Y();
+      pz[i] = ref[i].Z();
+      e[i] = ref[i].T();
+   }
+   VectorUtil::ApplyBoost(px.size(), px.data(), py.data(), pz.data(), e.data(), beta);
+   for (int i = 0; i < n; ++i) {
+      if (!AlmostEq(XYZTVector(px[i], py[i], pz[i], e[i]), VectorUtil::boost(ref[i], beta))) {
+         std::cout << "ApplyBoost (SoA) test failed for element " << i << std::endl;
+         nFailedTests++;
+         break;
+      }
+   }
+
+   Rotation3D rot{RotationZYX(0.3, -1.2, 0.7)};
+
+   // the per-element reference, with the same matrix-element convention as
+   // VectorUtil::Rotate
+   auto rotate1 = [&](const XYZTVector &v) {
+      XYZVector r3 = VectorUtil::Rotate(XYZVector(v.X(), v.Y(), v.Z()), rot);
+      return XYZTVector(r3.X(), r3.Y(), r3.Z(), v.T());
+   };
+
+   // collection rotation against the per-element rotation
+   vs = ref;
+   VectorUtil::ApplyRotation(vs, rot);
+   for (int i = 0; i < n; ++i) {
+      if (!AlmostEq(vs[i], rotate1(ref[i]))) {
+         std::cout << "ApplyRotation (collection) test failed for element " << i << std::endl;
+         nFailedTests++;
+         break;
+      }
+   }
+
+   // structure-of-arrays rotation against the per-element rotation
+   for (int i = 0; i < n; ++i) {
+      px[i] = ref[i].X();
+      py[i] = ref[i].Y();
+      pz[i] = ref[i].Z();
+   }
+   VectorUtil::ApplyRotation(px.size(), px.data(), py.data(), pz.data(), rot);
+   for (int i = 0; i < n; ++i) {
+      XYZTVector r = rotate1(ref[i]);
+      if (!AlmostEq(XYZTVector(px[i], py[i], pz[i], ref[i].T()), r)) {
+         std::cout << "ApplyRotation (SoA) test failed for element " << i << std::endl;
+         nFailedTests++;
+         break;
+      }
+   }
+
+   if (nFailedTests == 0)
+      std::cout << "All bulk VectorUtil tests OK" << std::endl;
+   return nFailedTests;
+}
@@ -21,6 +21,7 @@
 #include "Math/IFunctionfwd.h"
 #include "Math/IParamFunction.h"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -99,6 +100,7 @@ public:
       SetModelFunction(rhs.ModelFunctionPtr() );
       fNEffPoints = rhs.fNEffPoints;
       fGrad = rhs.fGrad;
+      fGradPoint.clear();
    }
 
    /*
@@ -151,7 +153,13 @@ private:
 
    // for derivatives
    double DoDerivative(const double * x, unsigned int icoord) const override {
-      Gradient(x, fGrad.data());
+      // the minimizers request the derivatives one component at a time:
+      // recompute the gradient only when the parameter point has changed
+      unsigned int npar = fGrad.size();
+      if (fGradPoint.size() != npar || !std::equal(x, x + npar, fGradPoint.begin())) {
+         fGradPoint.assign(x, x + npar);
+         Gradient(x, fGrad.data());
+      }
       return fGrad[icoord];
    }
 
@@ -159,6 +167,7 @@ private:
    mutable unsigned int fNEffPoints;  ///< number of effective points used in the fit
 
    mutable std::vector<double> fGrad; ///< for derivatives
+   mutable std::vector<double> fGradPoint; ///< parameter values at which fGrad was computed (empty if invalid)
    ::ROOT::EExecutionPolicy fExecutionPolicy;
 
 };
@@ -19,6 +19,7 @@
 #include "Fit/FitUtil.h"
 #include "Math/IParamFunction.h"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -105,6 +106,7 @@ public:
       SetModelFunction(rhs.ModelFunctionPtr() );
       fNEffPoints = rhs.fNEffPoints;
       fGrad = rhs.fGrad;
+      fGradPoint.clear();
       fIsExtended = rhs.fIsExtended;
       fWeight = rhs.fWeight;
       fExecutionPolicy = rhs.fExecutionPolicy;
@@ -174,6 +176,7 @@ public:
       if (fWeight == 0) return; // do nothing if it was not weighted
       if (on) fWeight = 2;
       else fWeight = 1;
+      fGradPoint.clear(); // the weight enters the gradient, invalidate the cache
    }
 
 
@@ -193,7 +196,13 @@ private:
 
    // for derivatives
    double DoDerivative(const double * x, unsigned int icoord) const override {
-      Gradient(x, &fGrad[0]);
+      // the minimizers request the derivatives one component at a time:
+      // recompute the gradient only when the parameter point has changed
+      unsigned int npar = fGrad.size();
+      if (fGradPoint.size() != npar || !std::equal(x, x + npar, fGradPoint.begin())) {
+         fGradPoint.assign(x, x + npar);
+         Gradient(x, &fGrad[0]);
+      }
       return fGrad[icoord];
    }
 
@@ -206,6 +215,7 @@ private:
    mutable unsigned int fNEffPoints;  ///< number of effective points used in the fit
 
    mutable std::vector<double> fGrad; ///< for derivatives
+   mutable std::vector<double> fGradPoint; ///< parameter values at which fGrad was computed (empty if invalid)
 
    ::ROOT::EExecutionPolicy fExecutionPolicy; ///< Execution policy
 };
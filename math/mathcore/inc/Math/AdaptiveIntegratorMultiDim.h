@@ -166,6 +166,17 @@ public:
    ///set max points
    void SetMaxPts(unsigned int n) { fMaxPts = n; }
 
+   /// enable/disable the parallel region subdivision engine.
+   /// When enabled and ROOT::EnableImplicitMT() has been called, batches of
+   /// the worst regions are subdivided and evaluated concurrently, with a
+   /// deterministic reduction of the partial sums (the result does not
+   /// depend on the number of threads). The integrand must be thread safe.
+   /// It can also be enabled via the extra integration option "Parallel".
+   void SetParallel(bool on = true) { fParallel = on; }
+
+   /// return true if the parallel region subdivision engine is enabled
+   bool IsParallel() const { return fParallel; }
+
    /// set the options
    void SetOptions(const ROOT::Math::IntegratorMultiDimOptions & opt) override;
 
@@ -177,6 +188,9 @@ protected:
    // internal function to compute the integral (if absVal is true compute abs value of function integral
    double DoIntegral(const double* xmin, const double * xmax, bool absVal = false);
 
+   // parallel version of DoIntegral subdividing batches of regions concurrently
+   double DoIntegralParallel(const double* xmin, const double * xmax, bool absVal = false);
+
  private:
 
    unsigned int fDim;     ///< dimensionality of integrand
@@ -191,6 +205,7 @@ protected:
    double fRelError;      ///< Relative error
    int    fNEval;         ///< number of function evaluation
    int fStatus;           ///< status of algorithm (error if not zero)
+   bool fParallel;        ///< use the parallel region subdivision engine
 
    const IMultiGenFunction* fFun;   // pointer to integrand function
 
@@ -143,6 +143,21 @@ public:
    /// Find all triangles
    void      FindAllTriangles();
 
+   /// Write the found triangles and the spatial index to a binary cache file,
+   /// so a later session working on the same input points can restore the
+   /// triangulation with LoadTriangulation instead of recomputing it.
+   /// Triangulates first if FindAllTriangles() has not run yet.
+   /// Returns false if the file cannot be written (or when using the CGAL
+   /// backend, which keeps its triangulation in library internal structures).
+   bool      SaveTriangulation(const char *fileName);
+
+   /// Restore a triangulation written by SaveTriangulation. The input points
+   /// must be the same ones the file was produced from (the number of points
+   /// is checked). After a successful load Interpolate can be called directly
+   /// without triangulating again.
+   /// Returns false if the file cannot be read or does not match the points.
+   bool      LoadTriangulation(const char *fileName);
+
    /// return the number of triangles
    int    NumberOfTriangles() const {return fNdt;}
 
@@ -179,6 +194,11 @@ private:
    /// use Triangle or CGAL if flag is set
    void DoFindTriangles();
 
+#ifndef HAS_CGAL
+   /// internal function to fill the cell grid locating the triangles
+   void DoFillCells();
+#endif
+
    /// internal method to compute the interpolation
    double  DoInterpolateNormalized(double x, double y);
 
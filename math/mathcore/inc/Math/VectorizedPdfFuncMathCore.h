@@ -0,0 +1,68 @@
+// @(#)root/mathcore:$Id$
+// Authors: ROOT Math Team
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 , LCG ROOT MathLib Team                         *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+/**
+
+SIMD overloads of the most frequently used probability density functions
+of PdfFuncMathCore, evaluating one vector of points per call. They follow
+the conventions of the scalar functions; the distribution parameters stay
+scalar since a fit evaluates many points with the same parameters. With
+these overloads vectorized TFormula expressions (and therefore
+TF1/WrappedMultiTF1 based likelihood fits) can call the pdfs directly on
+ROOT::Double_v.
+
+The overloads are only available when ROOT is built with VecCore and Vc
+support; otherwise ROOT::Double_v aliases double and the scalar functions
+apply.
+
+*/
+
+#ifndef ROOT_Math_VectorizedPdfFuncMathCore
+#define ROOT_Math_VectorizedPdfFuncMathCore
+
+#include "Math/Types.h"
+#include "Math/PdfFuncMathCore.h"
+
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+
+namespace ROOT {
+namespace Math {
+
+/// SIMD overload of #breitwigner_pdf evaluating one vector of points
+::ROOT::Double_v breitwigner_pdf(::ROOT::Double_v x, double gamma, double x0 = 0);
+
+/// SIMD overload of #cauchy_pdf evaluating one vector of points
+::ROOT::Double_v cauchy_pdf(::ROOT::Double_v x, double b = 1, double x0 = 0);
+
+/// SIMD overload of #chisquared_pdf evaluating one vector of points
+::ROOT::Double_v chisquared_pdf(::ROOT::Double_v x, double r, double x0 = 0);
+
+/// SIMD overload of #crystalball_function evaluating one vector of points
+::ROOT::Double_v crystalball_function(::ROOT::Double_v x, double alpha, double n, double sigma, double mean = 0);
+
+/// SIMD overload of #crystalball_pdf evaluating one vector of points
+::ROOT::Double_v crystalball_pdf(::ROOT::Double_v x, double alpha, double n, double sigma, double mean = 0);
+
+/// SIMD overload of #gaussian_pdf evaluating one vector of points
+::ROOT::Double_v gaussian_pdf(::ROOT::Double_v x, double sigma = 1, double x0 = 0);
+
+/// SIMD overload of #normal_pdf evaluating one vector of points
+::ROOT::Double_v normal_pdf(::ROOT::Double_v x, double sigma = 1, double x0 = 0);
+
+/// SIMD overload of #poisson_pdf; the number of observations is passed as
+/// floating point vector, one value per lane
+::ROOT::Double_v poisson_pdf(::ROOT::Double_v n, double mu);
+
+} // namespace Math
+} // namespace ROOT
+
+#endif // VECCORE and VC exist check
+
+#endif /* ROOT_Math_VectorizedPdfFuncMathCore */
@@ -34,6 +34,7 @@
 //   * TRandomMixMax for the MixMaxEngine<240,0>  (MIXMAX with state N=240)
 //   * TRandomMixMax17 for the MixMaxEngine<17,0>  (MIXMAX with state N=17)
 //   * TRandomMixMax256 for the MixMaxEngine<256,2> (MIXMAX with state N=256 )
+//   * TRandomPhilox for the PhiloxEngine (counter-based Philox-4x64-10)
 //   * TRandomMT64 for the  StdEngine<std::mt19937_64> ( MersenneTwister 64 bits)
 //   * TRandomRanlux48 for the  StdEngine<std::ranlux48> (Ranlux 48 bits)
 //
@@ -76,6 +77,7 @@ public:
 // some useful typedef
 #include "Math/StdEngine.h"
 #include "Math/MixMaxEngine.h"
+#include "Math/PhiloxEngine.h"
 #include "Math/RanluxppEngine.h"
 
 // not working wight now for this classes
@@ -131,6 +133,15 @@ typedef TRandomGen<ROOT::Math::MixMaxEngine<256,2>> TRandomMixMax256;
 
 typedef TRandomGen<ROOT::Math::RanluxppEngine2048> TRandomRanluxpp;
 
+/**
+  @ingroup Random
+  Generator based on the Philox-4x64-10 counter-based engine,
+  ROOT::Math::PhiloxEngine. Jumping ahead is O(1) via the engine Skip
+  method, which makes reproducible parallel generation independent of the
+  number of workers.
+ */
+typedef TRandomGen<ROOT::Math::PhiloxEngine> TRandomPhilox;
+
 /**
   @ingroup Random
   Generator based on a the Mersenne-Twister generator with 64 bits,
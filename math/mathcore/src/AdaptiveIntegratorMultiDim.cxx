@@ -4,10 +4,170 @@
 #include "Math/IFunction.h"
 #include "Math/AdaptiveIntegratorMultiDim.h"
 #include "Math/IntegratorOptions.h"
+#include "Math/GenAlgoOptions.h"
+#include "Math/IOptions.h"
 #include "Math/Error.h"
 
 #include <cmath>
 #include <algorithm>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+namespace {
+
+// nodes and weights of the degree seven rule (weights divided by 2^n),
+// shared by the serial and the parallel subdivision engines
+const double gXl2 = 0.358568582800318073;//lambda_2
+const double gXl4 = 0.948683298050513796;//lambda_4
+const double gXl5 = 0.688247201611685289;//lambda_5
+const double gW2  = 980./6561; //weights/2^n
+const double gW4  = 200./19683;
+const double gWp2 = 245./486;//error weights/2^n
+const double gWp4 = 25./729;
+
+const double gWn1[14] = {     -0.193872885230909911, -0.555606360818980835,
+                              -0.876695625666819078, -1.15714067977442459,  -1.39694152314179743,
+                              -1.59609815576893754,  -1.75461057765584494,  -1.87247878880251983,
+                              -1.94970278920896201,  -1.98628257887517146,  -1.98221815780114818,
+                              -1.93750952598689219,  -1.85215668343240347,  -1.72615963013768225};
+
+const double gWn3[14] = {     0.0518213686937966768,  0.0314992633236803330,
+                              0.0111771579535639891,-0.00914494741655235473,-0.0294670527866686986,
+                              -0.0497891581567850424,-0.0701112635269013768, -0.0904333688970177241,
+                              -0.110755474267134071, -0.131077579637250419,  -0.151399685007366752,
+                              -0.171721790377483099, -0.192043895747599447,  -0.212366001117715794};
+
+const double gWn5[14] = {         0.871183254585174982e-01,  0.435591627292587508e-01,
+                                  0.217795813646293754e-01,  0.108897906823146873e-01,  0.544489534115734364e-02,
+                                  0.272244767057867193e-02,  0.136122383528933596e-02,  0.680611917644667955e-03,
+                                  0.340305958822333977e-03,  0.170152979411166995e-03,  0.850764897055834977e-04,
+                                  0.425382448527917472e-04,  0.212691224263958736e-04,  0.106345612131979372e-04};
+
+const double gWpn1[14] = {   -1.33196159122085045, -2.29218106995884763,
+                             -3.11522633744855959, -3.80109739368998611, -4.34979423868312742,
+                             -4.76131687242798352, -5.03566529492455417, -5.17283950617283939,
+                             -5.17283950617283939, -5.03566529492455417, -4.76131687242798352,
+                             -4.34979423868312742, -3.80109739368998611, -3.11522633744855959};
+
+const double gWpn3[14] = {     0.0445816186556927292, -0.0240054869684499309,
+                               -0.0925925925925925875, -0.161179698216735251,  -0.229766803840877915,
+                               -0.298353909465020564,  -0.366941015089163228,  -0.435528120713305891,
+                               -0.504115226337448555,  -0.572702331961591218,  -0.641289437585733882,
+                               -0.709876543209876532,  -0.778463648834019195,  -0.847050754458161859};
+
+// one subregion of the adaptive subdivision together with its rule results
+struct IntegrationRegion {
+   std::vector<double> fCtr;    // centre of the hyper-rectangle
+   std::vector<double> fWidth;  // half widths
+   double fVal = 0.;            // integral estimate on the region
+   double fErr = 0.;            // error estimate on the region
+   unsigned int fDivAxis = 1;   // coordinate with the biggest error (1-based)
+};
+
+// Evaluate the Genz-Malik degree seven rule on one region, filling its value,
+// error estimate and subdivision axis. This is the rule evaluation block of
+// the serial DoIntegral rewritten without the workspace bookkeeping; it only
+// reads the (thread safe) integrand, so independent regions can be evaluated
+// concurrently.
+void EvalGenzMalikRule(const ROOT::Math::IMultiGenFunction &f, bool absValue, IntegrationRegion &region)
+{
+   const unsigned int n = f.NDim();
+   const double *ctr = region.fCtr.data();
+   const double *width = region.fWidth.data();
+   double widthl[15], z[15];
+   unsigned int j, j1, k, l, m;
+
+   double twondm = std::pow(2.0, static_cast<int>(n));
+   double rgnvol = twondm;
+   for (j = 0; j < n; j++) {
+      rgnvol *= width[j];
+      z[j] = ctr[j];
+   }
+   double sum1 = f(z);
+
+   double difmax = 0, sum2 = 0, sum3 = 0, f2, f3, dif;
+   unsigned int idvaxn = 0;
+
+   //loop over coordinates
+   for (j = 0; j < n; j++) {
+      z[j] = ctr[j] - gXl2 * width[j];
+      if (absValue) f2 = std::abs(f(z));
+      else          f2 = f(z);
+      z[j] = ctr[j] + gXl2 * width[j];
+      if (absValue) f2 += std::abs(f(z));
+      else          f2 += f(z);
+      widthl[j] = gXl4 * width[j];
+      z[j] = ctr[j] - widthl[j];
+      if (absValue) f3 = std::abs(f(z));
+      else          f3 = f(z);
+      z[j] = ctr[j] + widthl[j];
+      if (absValue) f3 += std::abs(f(z));
+      else          f3 += f(z);
+      sum2 += f2;
+      sum3 += f3;
+      dif = std::abs(7 * f2 - f3 - 12 * sum1);
+      if (dif >= difmax) {
+         difmax = dif;
+         idvaxn = j + 1;
+      }
+      z[j] = ctr[j];
+   }
+
+   double sum4 = 0;
+   for (j = 1; j < n; j++) {
+      j1 = j - 1;
+      for (k = j; k < n; k++) {
+         for (l = 0; l < 2; l++) {
+            widthl[j1] = -widthl[j1];
+            z[j1] = ctr[j1] + widthl[j1];
+            for (m = 0; m < 2; m++) {
+               widthl[k] = -widthl[k];
+               z[k] = ctr[k] + widthl[k];
+               if (absValue) sum4 += std::abs(f(z));
+               else          sum4 += f(z);
+            }
+         }
+         z[k] = ctr[k];
+      }
+      z[j1] = ctr[j1];
+   }
+
+   double sum5 = 0;
+   for (j = 0; j < n; j++) {
+      widthl[j] = -gXl5 * width[j];
+      z[j] = ctr[j] + widthl[j];
+   }
+   // sum over end nodes ~gray codes
+   bool more = true;
+   while (more) {
+      if (absValue) sum5 += std::abs(f(z));
+      else          sum5 += f(z);
+      more = false;
+      for (j = 0; j < n; j++) {
+         widthl[j] = -widthl[j];
+         z[j] = ctr[j] + widthl[j];
+         if (widthl[j] > 0) {
+            more = true;
+            break;
+         }
+      }
+   }
+
+   double rgncmp = rgnvol * (gWpn1[n - 2] * sum1 + gWp2 * sum2 + gWpn3[n - 2] * sum3 + gWp4 * sum4);
+   double rgnval = gWn1[n - 2] * sum1 + gW2 * sum2 + gWn3[n - 2] * sum3 + gW4 * sum4 + gWn5[n - 2] * sum5;
+   rgnval *= rgnvol;
+   region.fVal = rgnval;
+   region.fErr = std::abs(rgnval - rgncmp);
+   region.fDivAxis = (idvaxn >= 1) ? idvaxn : 1;
+}
+
+} // anonymous namespace
 
 namespace ROOT {
 namespace Math {
@@ -25,6 +185,7 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double rel
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
+   fParallel(false),
    fFun(nullptr)
 {
    // constructor - without passing a function
@@ -45,6 +206,7 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim( const IMultiGenFunction
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
+   fParallel(false),
    fFun(&f)
 {
    // constructor passing a multi-dimensional function interface
@@ -83,6 +245,11 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
    //   2.A. van Doren and L. de Ridder, An adaptive algorithm for numerical
    //     integration over an n-dimensional cube, J.Comput. Appl. Math. 2 (1976) 207-217.
 
+#ifdef R__USE_IMT
+   if (fParallel && ROOT::IsImplicitMTEnabled())
+      return DoIntegralParallel(xmin, xmax, absValue);
+#endif
+
    //to be changed later
    unsigned int n=fDim;
    bool kFALSE = false;
@@ -98,43 +265,10 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
 
    double ctr[15], width[15], widthl[15], z[15];
 
-   static const double xl2 = 0.358568582800318073;//lambda_2
-   static const double xl4 = 0.948683298050513796;//lambda_4
-   static const double xl5 = 0.688247201611685289;//lambda_5
-   static const double w2  = 980./6561; //weights/2^n
-   static const double w4  = 200./19683;
-   static const double wp2 = 245./486;//error weights/2^n
-   static const double wp4 = 25./729;
-
-   static const double wn1[14] = {     -0.193872885230909911, -0.555606360818980835,
-                                       -0.876695625666819078, -1.15714067977442459,  -1.39694152314179743,
-                                       -1.59609815576893754,  -1.75461057765584494,  -1.87247878880251983,
-                                       -1.94970278920896201,  -1.98628257887517146,  -1.98221815780114818,
-                                       -1.93750952598689219,  -1.85215668343240347,  -1.72615963013768225};
-
-   static const double wn3[14] = {     0.0518213686937966768,  0.0314992633236803330,
-                                       0.0111771579535639891,-0.00914494741655235473,-0.0294670527866686986,
-                                       -0.0497891581567850424,-0.0701112635269013768, -0.0904333688970177241,
-                                       -0.110755474267134071, -0.131077579637250419,  -0.151399685007366752,
-                                       -0.171721790377483099, -0.192043895747599447,  -0.212366001117715794};
-
-   static const double wn5[14] = {         0.871183254585174982e-01,  0.435591627292587508e-01,
-                                           0.217795813646293754e-01,  0.108897906823146873e-01,  0.544489534115734364e-02,
-                                           0.272244767057867193e-02,  0.136122383528933596e-02,  0.680611917644667955e-03,
-                                           0.340305958822333977e-03,  0.170152979411166995e-03,  0.850764897055834977e-04,
-                                           0.425382448527917472e-04,  0.212691224263958736e-04,  0.106345612131979372e-04};
-
-   static const double wpn1[14] = {   -1.33196159122085045, -2.29218106995884763,
-                                      -3.11522633744855959, -3.80109739368998611, -4.34979423868312742,
-                                      -4.76131687242798352, -5.03566529492455417, -5.17283950617283939,
-                                      -5.17283950617283939, -5.03566529492455417, -4.76131687242798352,
-                                      -4.34979423868312742, -3.80109739368998611, -3.11522633744855959};
-
-   static const double wpn3[14] = {     0.0445816186556927292, -0.0240054869684499309,
-                                        -0.0925925925925925875, -0.161179698216735251,  -0.229766803840877915,
-                                        -0.298353909465020564,  -0.366941015089163228,  -0.435528120713305891,
-                                        -0.504115226337448555,  -0.572702331961591218,  -0.641289437585733882,
-                                        -0.709876543209876532,  -0.778463648834019195,  -0.847050754458161859};
+   // nodes and weights of the rule, shared with the parallel engine
+   const double xl2 = gXl2, xl4 = gXl4, xl5 = gXl5;
+   const double w2 = gW2, w4 = gW4, wp2 = gWp2, wp4 = gWp4;
+   const double *wn1 = gWn1, *wn3 = gWn3, *wn5 = gWn5, *wpn1 = gWpn1, *wpn3 = gWpn3;
 
    double result = 0;
    double abserr = 0;
@@ -379,6 +513,132 @@ L160: //to divide or not
 
 
 
+double AdaptiveIntegratorMultiDim::DoIntegralParallel(const double* xmin, const double * xmax, bool absValue)
+{
+#ifndef R__USE_IMT
+   // without implicit multi-threading support fall back to the serial engine
+   return DoIntegral(xmin, xmax, absValue);
+#else
+   unsigned int n = fDim;
+   double epsrel = fRelTol; //specified relative accuracy
+   double epsabs = fAbsTol; //specified absolute accuracy
+
+   fStatus = 3;
+   fResult = 0;
+   fError = 0;
+   fRelError = 0;
+   fNEval = 0;
+   // does not work for 1D functions
+   if (n < 2 || n > 15) {
+      MATH_WARN_MSGVAL("AdaptiveIntegratorMultiDim::Integral","Wrong function dimension",n);
+      return 0;
+   }
+
+   double twondm = std::pow(2.0,static_cast<int>(n));
+   unsigned int irgnst = 2*n+3;
+   unsigned int irlcls = (unsigned int)(twondm) +2*n*(n+1)+1;//minimal number of nodes in n dim
+
+   unsigned int minpts = fMinPts;
+   unsigned int maxpts = std::max(fMaxPts, irlcls);//specified maximal number of function evaluations
+   if (minpts < 1)      minpts = irlcls;
+   if (maxpts < minpts) maxpts = 10*minpts;
+
+   // same region capacity as the serial working array
+   unsigned int iwk = std::max( fSize, irgnst*(1 +maxpts/irlcls)/2 );
+   unsigned int maxRegions = iwk / irgnst;
+
+   // Number of regions subdivided per iteration. The batch size is a fixed
+   // constant so that the subdivision sequence - and therefore the result -
+   // does not depend on the number of threads.
+   const unsigned int kRegionsPerBatch = 16;
+
+   const IMultiGenFunction &f = *fFun;
+
+   IntegrationRegion first;
+   first.fCtr.resize(n);
+   first.fWidth.resize(n);
+   for (unsigned int j = 0; j < n; j++) {
+      first.fCtr[j] = (xmax[j] + xmin[j])*0.5;//center of the hypercube
+      first.fWidth[j] = (xmax[j] - xmin[j])*0.5;//its width
+   }
+   EvalGenzMalikRule(f, absValue, first);
+
+   // priority queue of the regions ordered by their error estimate
+   auto lessErr = [](const IntegrationRegion &a, const IntegrationRegion &b) { return a.fErr < b.fErr; };
+   std::priority_queue<IntegrationRegion, std::vector<IntegrationRegion>, decltype(lessErr)> regions(lessErr);
+
+   double result = first.fVal;
+   double abserr = first.fErr;
+   double relerr = 0;
+   unsigned int ifncls = irlcls;
+   regions.push(std::move(first));
+
+   ROOT::TThreadExecutor pool;
+   std::vector<IntegrationRegion> children;
+   std::vector<unsigned int> indices;
+
+   for (;;) {
+      double aresult = std::abs(result);
+      relerr = (aresult != 0) ? abserr/aresult : abserr;
+      if ( ( relerr < epsrel || abserr < epsabs ) && ifncls >= minpts) {
+         fStatus = 0;
+         break;
+      }
+      // regions which can still be subdivided within the call budget
+      unsigned int nsub = std::min<unsigned int>(kRegionsPerBatch, regions.size());
+      if (nsub > (maxpts - ifncls) / (2*irlcls)) nsub = (maxpts - ifncls) / (2*irlcls);
+      if (nsub == 0) {
+         fStatus = 1;  // maxpts is too small for the specified accuracy
+         break;
+      }
+      if (regions.size() + nsub > maxRegions) {
+         fStatus = 2;  // size is too small for the requested evaluations
+         break;
+      }
+
+      // split the worst regions along their worst coordinate
+      children.clear();
+      children.reserve(2*nsub);
+      for (unsigned int i = 0; i < nsub; i++) {
+         IntegrationRegion parent = regions.top();
+         regions.pop();
+         result -= parent.fVal;
+         abserr -= parent.fErr;
+         unsigned int iax = parent.fDivAxis - 1;
+         IntegrationRegion lower = parent;
+         lower.fWidth[iax] *= 0.5;
+         lower.fCtr[iax] -= lower.fWidth[iax];
+         IntegrationRegion upper = std::move(parent);
+         upper.fWidth[iax] *= 0.5;
+         upper.fCtr[iax] += upper.fWidth[iax];
+         children.push_back(std::move(lower));
+         children.push_back(std::move(upper));
+      }
+
+      // evaluate the new regions concurrently: every task writes only its own
+      // slot and the reduction below runs serially in slot order, so the sums
+      // are independent of the scheduling
+      indices.resize(children.size());
+      for (unsigned int i = 0; i < children.size(); i++)
+         indices[i] = i;
+      pool.Foreach([&](unsigned int i) { EvalGenzMalikRule(f, absValue, children[i]); }, indices);
+
+      for (auto &child : children) {
+         result += child.fVal;
+         abserr += child.fErr;
+         regions.push(std::move(child));
+      }
+      ifncls += 2*nsub*irlcls;
+   }
+
+   fResult = result;
+   fError = abserr;
+   fRelError = relerr;
+   fNEval = ifncls;
+   return result;
+#endif
+}
+
 double AdaptiveIntegratorMultiDim::Integral(const IMultiGenFunction &f, const double* xmin, const double * xmax)
 {
    // calculate integral passing a function object
@@ -395,6 +655,11 @@ ROOT::Math::IntegratorMultiDimOptions  AdaptiveIntegratorMultiDim::Options() con
    opt.SetNCalls(fMaxPts);
    opt.SetWKSize(fSize);
    opt.SetIntegrator("ADAPTIVE");
+   if (fParallel) {
+      ROOT::Math::GenAlgoOptions extraOpt;
+      extraOpt.SetIntValue("Parallel", 1);
+      opt.SetExtraOptions(extraOpt);
+   }
    return opt;
 }
 
@@ -409,6 +674,11 @@ void AdaptiveIntegratorMultiDim::SetOptions(const ROOT::Math::IntegratorMultiDim
    SetRelTolerance( opt.RelTolerance() );
    SetMaxPts( opt.NCalls() );
    SetSize( opt.WKSize() );
+   if (opt.ExtraOptions()) {
+      int parallel = fParallel;
+      if (opt.ExtraOptions()->GetValue("Parallel", parallel))
+         SetParallel(parallel != 0);
+   }
 }
 
 } // namespace Math
@@ -14,6 +14,7 @@
 #include "Math/Delaunay2D.h"
 #include "Rtypes.h"
 #include "TError.h"
+#include "TROOT.h"
 
 //#include <thread>
 
@@ -22,8 +23,15 @@
 #include "CDT/CDT.h"
 #endif
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <fstream>
 
 #include <iostream>
 #include <limits>
@@ -194,9 +202,9 @@ void Delaunay2D::DoFindTriangles() {
 
    fTriangles.resize(NumberOfTriangles);
 
-   for(i = 0; i < NumberOfTriangles; i++){
+   auto makeTriangle = [&](int it) {
       Triangle tri;
-      const auto& t = AllTriangles[i];
+      const auto& t = AllTriangles[it];
 
       const auto& v0  = AllVertices[t.vertices[0]];
       tri.x[0]   = v0.x;
@@ -216,7 +224,31 @@ void Delaunay2D::DoFindTriangles() {
       // see comment in header for CGAL fallback section
       tri.invDenom = 1 / ( (tri.y[1] - tri.y[2])*(tri.x[0] - tri.x[2]) + (tri.x[2] - tri.x[1])*(tri.y[0] - tri.y[2]) );
 
-      fTriangles[i] = tri;
+      fTriangles[it] = tri;
+   };
+
+   // each triangle is written to its own slot, so the loop can run in parallel
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(makeTriangle, ROOT::TSeqI(NumberOfTriangles));
+   } else
+#endif
+   for(i = 0; i < NumberOfTriangles; i++)
+      makeTriangle(i);
+
+   DoFillCells();
+}
+
+/// Triangle implementation for filling the cell grid used to locate the
+/// triangle containing an interpolation point
+void Delaunay2D::DoFillCells() {
+
+   for (int c = 0; c < (fNCells+1)*(fNCells+1); c++)
+      fCells[c].clear();
+
+   for (unsigned int i = 0; i < fTriangles.size(); i++) {
+      const Triangle &tri = fTriangles[i];
 
       auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
       auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
@@ -293,6 +325,101 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
    return fZout;
 }
 
+namespace {
+   // magic word and version of the triangulation cache file format
+   const uint32_t kTriangulationFileMagic   = 0x44543244; // "D2TD"
+   const uint32_t kTriangulationFileVersion = 1;
+}
+
+/// Triangle implementation for writing the triangulation to a binary file
+bool Delaunay2D::SaveTriangulation(const char *fileName) {
+
+   // make sure the triangulation exists before writing it
+   FindAllTriangles();
+
+   std::ofstream out(fileName, std::ios::binary);
+   if (!out) {
+      Error("SaveTriangulation", "Cannot open file %s for writing", fileName);
+      return false;
+   }
+
+   auto writeU32 = [&out](uint32_t v) { out.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
+   auto writeD   = [&out](double v)   { out.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
+
+   writeU32(kTriangulationFileMagic);
+   writeU32(kTriangulationFileVersion);
+   writeU32(fNpoints);
+   writeU32(fTriangles.size());
+   for (double v : {fOffsetX, fOffsetY, fScaleFactorX, fScaleFactorY, fXNmin, fXNmax, fYNmin, fYNmax})
+      writeD(v);
+
+   for (const Triangle &tri : fTriangles) {
+      for (int j = 0; j < 3; j++) writeD(tri.x[j]);
+      for (int j = 0; j < 3; j++) writeD(tri.y[j]);
+      for (int j = 0; j < 3; j++) writeU32(tri.idx[j]);
+      writeD(tri.invDenom);
+   }
+
+   return bool(out);
+}
+
+/// Triangle implementation for restoring the triangulation from a binary file
+bool Delaunay2D::LoadTriangulation(const char *fileName) {
+
+   std::ifstream in(fileName, std::ios::binary);
+   if (!in) {
+      Error("LoadTriangulation", "Cannot open file %s for reading", fileName);
+      return false;
+   }
+
+   auto readU32 = [&in]() { uint32_t v = 0; in.read(reinterpret_cast<char*>(&v), sizeof(v)); return v; };
+   auto readD   = [&in]() { double v = 0;   in.read(reinterpret_cast<char*>(&v), sizeof(v)); return v; };
+
+   if (readU32() != kTriangulationFileMagic || readU32() != kTriangulationFileVersion) {
+      Error("LoadTriangulation", "File %s is not a triangulation cache file", fileName);
+      return false;
+   }
+   uint32_t npoints = readU32();
+   if (npoints != static_cast<uint32_t>(fNpoints)) {
+      Error("LoadTriangulation", "File %s was produced from %u points, the current input has %d",
+            fileName, npoints, fNpoints);
+      return false;
+   }
+   uint32_t ntriangles = readU32();
+
+   fOffsetX      = readD();
+   fOffsetY      = readD();
+   fScaleFactorX = readD();
+   fScaleFactorY = readD();
+   fXNmin        = readD();
+   fXNmax        = readD();
+   fYNmin        = readD();
+   fYNmax        = readD();
+
+   fTriangles.resize(ntriangles);
+   for (Triangle &tri : fTriangles) {
+      for (int j = 0; j < 3; j++) tri.x[j]   = readD();
+      for (int j = 0; j < 3; j++) tri.y[j]   = readD();
+      for (int j = 0; j < 3; j++) tri.idx[j] = readU32();
+      tri.invDenom = readD();
+   }
+
+   if (!in) {
+      Error("LoadTriangulation", "File %s is truncated or corrupted", fileName);
+      fTriangles.clear();
+      return false;
+   }
+
+   // restore the quantities otherwise computed while triangulating
+   fXCellStep = fNCells / (fXNmax - fXNmin);
+   fYCellStep = fNCells / (fYNmax - fYNmin);
+   DoFillCells();
+   fNdt  = fTriangles.size();
+   fInit = kTRUE;
+
+   return true;
+}
+
 #else //HAS_CGAL: case of using GCAL
 
 /// CGAL implementation of normalize points
@@ -360,6 +487,19 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
 
    return res;
 }
+
+/// CGAL implementation: the triangulation lives in CGAL internal structures
+/// and cannot be written to a cache file
+bool Delaunay2D::SaveTriangulation(const char *) {
+   Warning("SaveTriangulation", "Saving the triangulation is not supported with the CGAL backend");
+   return false;
+}
+
+/// CGAL implementation: see SaveTriangulation
+bool Delaunay2D::LoadTriangulation(const char *) {
+   Warning("LoadTriangulation", "Loading a triangulation is not supported with the CGAL backend");
+   return false;
+}
 #endif // HAS_GCAL
 
 } // namespace Math
@@ -288,7 +288,9 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       //invError = (invError!= 0.0) ? 1.0/invError :1;
 
       const double * x = nullptr;
-      std::vector<double> xc;
+      // thread_local buffer: the lambda runs once per bin and per iteration,
+      // a plain local vector would mean a heap allocation per bin
+      thread_local std::vector<double> xc;
       double binVolume = 1.0;
       if (useBinVolume) {
          unsigned int ndim = data.NDim();
@@ -326,7 +328,8 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       else {
          // calculate integral normalized (divided) by bin volume
          // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
+         thread_local std::vector<double> x2;
+         x2.resize(data.NDim());
          data.GetBinUpEdgeCoordinates(i, x2.data());
          fval = igEval(x, x2.data());
       }
@@ -719,7 +722,8 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
 
    auto mapFunction = [&](const unsigned int i) {
       // set all vector values to zero
-      std::vector<double> gradFunc(npar);
+      thread_local std::vector<double> gradFunc;
+      gradFunc.resize(npar);
       std::vector<double> pointContribution(npar);
 
       const auto x1 = data.GetCoordComponent(i, 0);
@@ -731,7 +735,7 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       double fval = 0;
 
       const double *x = nullptr;
-      std::vector<double> xc;
+      thread_local std::vector<double> xc;
 
       unsigned int ndim = data.NDim();
       double binVolume = 1;
@@ -762,7 +766,8 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
          fval = func(x, p);
          func.ParameterGradient(x, p, &gradFunc[0]);
       } else {
-         std::vector<double> x2(data.NDim());
+         thread_local std::vector<double> x2;
+         x2.resize(data.NDim());
          data.GetBinUpEdgeCoordinates(i, x2.data());
          // calculate normalized integral and gradient (divided by bin volume)
          // need to set function and parameters here in case loop is parallelized
@@ -1182,12 +1187,13 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
    const double kdmax2 = std::numeric_limits<double>::max() / (4 * initialNPoints);
 
    auto mapFunction = [&](const unsigned int i) {
-      std::vector<double> gradFunc(npar);
+      thread_local std::vector<double> gradFunc;
+      gradFunc.resize(npar);
       std::vector<double> pointContribution(npar);
 
 
       const double * x = nullptr;
-      std::vector<double> xc;
+      thread_local std::vector<double> xc;
       if (data.NDim() > 1) {
          xc.resize(data.NDim() );
          for (unsigned int j = 0; j < data.NDim(); ++j)
@@ -1498,7 +1504,7 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
       auto y = *data.ValuePtr(i);
 
       const double *x = nullptr;
-      std::vector<double> xc;
+      thread_local std::vector<double> xc;
       double fval = 0;
       double binVolume = 1.0;
 
@@ -1534,7 +1540,8 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
       } else {
          // calculate integral (normalized by bin volume)
          // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
+         thread_local std::vector<double> x2;
+         x2.resize(data.NDim());
          data.GetBinUpEdgeCoordinates(i, x2.data());
          fval = igEval(x, x2.data());
       }
@@ -1681,7 +1688,8 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 
    auto mapFunction = [&](const unsigned int i) {
       // set all vector values to zero
-      std::vector<double> gradFunc(npar);
+      thread_local std::vector<double> gradFunc;
+      gradFunc.resize(npar);
       std::vector<double> pointContribution(npar);
 
       const auto x1 = data.GetCoordComponent(i, 0);
@@ -1693,7 +1701,7 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
       double fval = 0;
 
       const double *x = nullptr;
-      std::vector<double> xc;
+      thread_local std::vector<double> xc;
 
       unsigned ndim = data.NDim();
       double binVolume = 1.0;
@@ -1728,7 +1736,8 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
       } else {
          // calculate integral (normalized by bin volume)
          // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
+         thread_local std::vector<double> x2;
+         x2.resize(data.NDim());
          data.GetBinUpEdgeCoordinates(i, x2.data());
          fval = igEval(x, x2.data());
          CalculateGradientIntegral(func, x, x2.data(), p, &gradFunc[0]);
@@ -11,11 +11,17 @@
 
 #include "TKDTree.h"
 #include "TRandom.h"
+#include "TROOT.h"
 
 #include "TString.h"
 #include <cstring>
 #include <limits>
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 templateClassImp(TKDTree);
 
 
@@ -556,6 +562,50 @@ void TKDTree<Index, Value>::FindNearestNeighbors(const Value *point, const Int_t
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the kNN nearest neighbors of a batch of query points in one call
+///1st argument - the query points, row-major: point `#i` starts at points[i*ndim]
+///2nd argument - the number of query points
+///3rd argument - the number of neighbors to find for each query point
+///Arrays ind and dist are provided by the user and are assumed to be at least
+///npoints*kNN elements long; the neighbors of query point `#i` are returned in
+///the elements [i*kNN, (i+1)*kNN), sorted by increasing distance.
+///The node boundaries are computed once up front and the individual queries
+///only read the tree, so when ROOT::EnableImplicitMT() has been called the
+///query points are processed in parallel.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindNearestNeighbors(const Value *points, Index npoints, const Int_t kNN, Index *ind, Value *dist)
+{
+
+   if (!ind || !dist) {
+      Error("FindNearestNeighbors", "Working arrays must be allocated by the user!");
+      return;
+   }
+   // compute the boundaries before querying: afterwards the traversal is read-only
+   MakeBoundariesExact();
+
+   auto query = [&](Index ipoint) {
+      Index *pind = ind + ipoint*kNN;
+      Value *pdist = dist + ipoint*kNN;
+      for (Int_t i=0; i<kNN; i++){
+         pdist[i]=std::numeric_limits<Value>::max();
+         pind[i]=-1;
+      }
+      UpdateNearestNeighbors(0, points + ipoint*fNDim, kNN, pind, pdist);
+   };
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(query, ROOT::TSeq<Index>(0, npoints));
+      return;
+   }
+#endif
+   for (Index ipoint=0; ipoint<npoints; ipoint++)
+      query(ipoint);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Update the nearest neighbors values by examining the node inode
 
@@ -0,0 +1,110 @@
+#include "Math/VectorizedPdfFuncMathCore.h"
+
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+
+#include "Math/SpecFuncMathCore.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ROOT {
+namespace Math {
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v breitwigner_pdf(::ROOT::Double_v x, double gamma, double x0)
+{
+   double gammahalf = gamma / 2.0;
+   return gammahalf / (M_PI * ((x - x0) * (x - x0) + gammahalf * gammahalf));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v cauchy_pdf(::ROOT::Double_v x, double b, double x0)
+{
+   return b / (M_PI * ((x - x0) * (x - x0) + b * b));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v chisquared_pdf(::ROOT::Double_v x, double r, double x0)
+{
+   double a = r / 2 - 1.;
+   ::ROOT::Double_v z = x - x0;
+   ::ROOT::Double_v out = ::ROOT::Double_v(0.5) *
+      vecCore::math::Exp(a * vecCore::math::Log(::ROOT::Double_v(0.5) * z) - ::ROOT::Double_v(0.5) * z -
+                         ROOT::Math::lgamma(r / 2));
+   out = vecCore::Blend<::ROOT::Double_v>(z < ::ROOT::Double_v(0.0), ::ROOT::Double_v(0.0), out);
+   // as in the scalar version, return 0.5 for x = x0 and r = 2
+   if (a == 0)
+      vecCore::MaskedAssign(out, z == ::ROOT::Double_v(0.0), ::ROOT::Double_v(0.5));
+   return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v crystalball_function(::ROOT::Double_v x, double alpha, double n, double sigma, double mean)
+{
+   if (sigma < 0.)
+      return ::ROOT::Double_v(0.0);
+   ::ROOT::Double_v z = (x - mean) / sigma;
+   if (alpha < 0)
+      z = -z;
+   double abs_alpha = std::abs(alpha);
+   double nDivAlpha = n / abs_alpha;
+   double AA = std::exp(-0.5 * abs_alpha * abs_alpha);
+   double B = nDivAlpha - abs_alpha;
+   ::ROOT::Double_v arg = nDivAlpha / (B - z);
+   return vecCore::Blend<::ROOT::Double_v>(z > ::ROOT::Double_v(-abs_alpha),
+                                           vecCore::math::Exp(::ROOT::Double_v(-0.5) * z * z),
+                                           AA * vecCore::math::Pow(arg, ::ROOT::Double_v(n)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v crystalball_pdf(::ROOT::Double_v x, double alpha, double n, double sigma, double mean)
+{
+   // evaluation of the PDF ( is defined only for n >1)
+   if (sigma < 0.)
+      return ::ROOT::Double_v(0.0);
+   if (n <= 1)
+      return ::ROOT::Double_v(std::numeric_limits<double>::quiet_NaN());
+   double abs_alpha = std::abs(alpha);
+   double C = n / abs_alpha * 1. / (n - 1.) * std::exp(-alpha * alpha / 2.);
+   double D = std::sqrt(M_PI / 2.) * (1. + ROOT::Math::erf(abs_alpha / std::sqrt(2.)));
+   double N = 1. / (sigma * (C + D));
+   return N * crystalball_function(x, alpha, n, sigma, mean);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v gaussian_pdf(::ROOT::Double_v x, double sigma, double x0)
+{
+   ::ROOT::Double_v tmp = (x - x0) / sigma;
+   return (1.0 / (std::sqrt(2 * M_PI) * std::abs(sigma))) *
+          vecCore::math::Exp(::ROOT::Double_v(-0.5) * tmp * tmp);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v normal_pdf(::ROOT::Double_v x, double sigma, double x0)
+{
+   return gaussian_pdf(x, sigma, x0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+::ROOT::Double_v poisson_pdf(::ROOT::Double_v n, double mu)
+{
+   // return a nan for mu < 0 since it does not make sense
+   if (mu < 0)
+      return ::ROOT::Double_v(std::numeric_limits<double>::quiet_NaN());
+
+   // lgamma has no SIMD implementation, evaluate it per lane
+   ::ROOT::Double_v lg;
+   for (size_t i = 0; i < vecCore::VectorSize<::ROOT::Double_v>(); ++i)
+      vecCore::Set(lg, i, ROOT::Math::lgamma(vecCore::Get(n, i) + 1));
+
+   // for mu = 0 the log is -inf and the exp correctly gives 0 for n > 0;
+   // the n = 0 lanes are handled by the blend
+   return vecCore::Blend<::ROOT::Double_v>(n > ::ROOT::Double_v(0.0),
+                                           vecCore::math::Exp(n * vecCore::math::Log(::ROOT::Double_v(mu)) - lg - mu),
+                                           ::ROOT::Double_v(std::exp(-mu)));
+}
+
+} // namespace Math
+} // namespace ROOT
+
+#endif // VECCORE and VC exist check
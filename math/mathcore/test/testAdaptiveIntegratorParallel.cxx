@@ -0,0 +1,65 @@
+// Tests for the parallel region subdivision engine of
+// AdaptiveIntegratorMultiDim.
+
+#include "Math/AdaptiveIntegratorMultiDim.h"
+#include "Math/Functor.h"
+#include "Math/GenAlgoOptions.h"
+#include "Math/IntegratorOptions.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+// separable 4-dimensional gaussian with a known integral
+static double Gauss4D(const double *x)
+{
+   double s = 0;
+   for (unsigned int i = 0; i < 4; i++)
+      s += x[i] * x[i];
+   return std::exp(-s);
+}
+
+TEST(AdaptiveIntegratorMultiDim, ParallelEngine)
+{
+   ROOT::EnableImplicitMT(4);
+
+   ROOT::Math::Functor f(&Gauss4D, 4);
+   double xmin[4] = {-1., -1., -1., -1.};
+   double xmax[4] = {1., 1., 1., 1.};
+   const double truth = std::pow(std::sqrt(M_PI) * std::erf(1.), 4);
+
+   ROOT::Math::AdaptiveIntegratorMultiDim serial(f, 0., 1.E-6, 1000000);
+   const double resSerial = serial.Integral(xmin, xmax);
+   EXPECT_EQ(serial.Status(), 0);
+   EXPECT_NEAR(resSerial, truth, serial.Error());
+
+   ROOT::Math::AdaptiveIntegratorMultiDim parallel(f, 0., 1.E-6, 1000000);
+   parallel.SetParallel();
+   EXPECT_TRUE(parallel.IsParallel());
+   const double resParallel = parallel.Integral(xmin, xmax);
+   EXPECT_EQ(parallel.Status(), 0);
+   EXPECT_NEAR(resParallel, truth, parallel.Error());
+
+   // the reduction is deterministic: a second run gives the identical result
+   EXPECT_EQ(parallel.Integral(xmin, xmax), resParallel);
+}
+
+TEST(AdaptiveIntegratorMultiDim, ParallelOption)
+{
+   ROOT::Math::Functor f(&Gauss4D, 4);
+   ROOT::Math::AdaptiveIntegratorMultiDim ig(f, 0., 1.E-6, 1000000);
+
+   // the engine is selectable through the extra integration options
+   ROOT::Math::IntegratorMultiDimOptions opt = ig.Options();
+   ROOT::Math::GenAlgoOptions extraOpt;
+   extraOpt.SetIntValue("Parallel", 1);
+   opt.SetExtraOptions(extraOpt);
+   ig.SetOptions(opt);
+   EXPECT_TRUE(ig.IsParallel());
+
+   // and the choice round-trips through Options()
+   ROOT::Math::AdaptiveIntegratorMultiDim ig2(f, 0., 1.E-6, 1000000);
+   ig2.SetOptions(ig.Options());
+   EXPECT_TRUE(ig2.IsParallel());
+}
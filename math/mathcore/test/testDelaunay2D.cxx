@@ -7,6 +7,8 @@
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+
 // test Delauney interpolation on edges of a triangle
 // some of these tests failed when using the older version
 // see issue #
@@ -61,4 +63,38 @@ TEST(Delaunay2D,interpolation_at_edges)
 
 }
 
+// test saving the triangulation to a cache file and restoring it
+// in another instance working on the same points
+
+TEST(Delaunay2D, save_and_load_triangulation)
+{
+   const int n = 200;
+   double x[n], y[n], z[n];
+   for (int i = 0; i < n; i++) {
+      x[i] = std::cos(0.7 * i) * (1. + 0.01 * i);
+      y[i] = std::sin(0.7 * i) * (1. + 0.01 * i);
+      z[i] = x[i] * x[i] - y[i];
+   }
+
+   ROOT::Math::Delaunay2D d1(n, x, y, z);
+   d1.FindAllTriangles();
+   ASSERT_GT(d1.NumberOfTriangles(), 0);
+
+   const char *fileName = "delaunay2d_tri.cache";
+   ASSERT_TRUE(d1.SaveTriangulation(fileName));
+
+   ROOT::Math::Delaunay2D d2(n, x, y, z);
+   ASSERT_TRUE(d2.LoadTriangulation(fileName));
+   EXPECT_EQ(d2.NumberOfTriangles(), d1.NumberOfTriangles());
+
+   // the loaded triangulation interpolates identically to the computed one
+   for (double xx = -1.5; xx < 1.5; xx += 0.1)
+      for (double yy = -1.5; yy < 1.5; yy += 0.1)
+         EXPECT_DOUBLE_EQ(d2.Interpolate(xx, yy), d1.Interpolate(xx, yy));
+
+   // a file produced from a different number of points is rejected
+   ROOT::Math::Delaunay2D d3(n - 1, x, y, z);
+   EXPECT_FALSE(d3.LoadTriangulation(fileName));
+}
+
 
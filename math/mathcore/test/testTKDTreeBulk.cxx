@@ -0,0 +1,57 @@
+// Tests for the bulk nearest-neighbor query API of TKDTree.
+
+#include "TKDTree.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+// compare the batched query against per-point queries on random data
+static void CompareBulkToScalar(Int_t npoints, Int_t nqueries, Int_t ndim, Int_t kNN)
+{
+   TRandom3 rndm(4357);
+
+   std::vector<Double_t> data(ndim * npoints);
+   std::vector<Double_t *> columns(ndim);
+   for (Int_t idim = 0; idim < ndim; idim++) {
+      columns[idim] = &data[idim * npoints];
+      for (Int_t i = 0; i < npoints; i++)
+         columns[idim][i] = rndm.Uniform(-1., 1.);
+   }
+   TKDTreeID tree(npoints, ndim, 16, columns.data());
+   tree.Build();
+
+   std::vector<Double_t> queries(ndim * nqueries);
+   for (auto &q : queries)
+      q = rndm.Uniform(-1.2, 1.2);
+
+   std::vector<Int_t> bulkInd(nqueries * kNN);
+   std::vector<Double_t> bulkDist(nqueries * kNN);
+   tree.FindNearestNeighbors(queries.data(), nqueries, kNN, bulkInd.data(), bulkDist.data());
+
+   std::vector<Int_t> ind(kNN);
+   std::vector<Double_t> dist(kNN);
+   for (Int_t i = 0; i < nqueries; i++) {
+      tree.FindNearestNeighbors(&queries[i * ndim], kNN, ind.data(), dist.data());
+      for (Int_t j = 0; j < kNN; j++) {
+         EXPECT_EQ(bulkInd[i * kNN + j], ind[j]);
+         EXPECT_EQ(bulkDist[i * kNN + j], dist[j]);
+      }
+   }
+}
+
+TEST(TKDTreeBulk, NearestNeighbors)
+{
+   CompareBulkToScalar(2000, 500, 3, 5);
+   // fewer points than a bucket and k larger than the result set is sparse
+   CompareBulkToScalar(100, 50, 2, 10);
+}
+
+TEST(TKDTreeBulk, NearestNeighborsImplicitMT)
+{
+   ROOT::EnableImplicitMT(4);
+   CompareBulkToScalar(2000, 500, 3, 5);
+   ROOT::DisableImplicitMT();
+}
@@ -27,8 +27,38 @@
 #include "TDecompChol.h"
 #include "TMath.h"
 
+#include <utility>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 ClassImp(TDecompChol);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Invoke func(rowBegin,rowEnd) over the row interval [begin,end), split in
+/// chunks executed in parallel when implicit multi-threading is enabled.
+
+template <typename F>
+static void ApplyRowRanges(Int_t begin, Int_t end, F func)
+{
+#ifdef R__USE_IMT
+   constexpr Int_t kRowsPerTask = 32;
+   if (ROOT::IsImplicitMTEnabled() && end - begin > kRowsPerTask) {
+      std::vector<std::pair<Int_t, Int_t>> ranges;
+      ranges.reserve((end - begin + kRowsPerTask - 1) / kRowsPerTask);
+      for (Int_t r = begin; r < end; r += kRowsPerTask)
+         ranges.emplace_back(r, TMath::Min(end, r + kRowsPerTask));
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&func](const std::pair<Int_t, Int_t> &range) { func(range.first, range.second); }, ranges);
+      return;
+   }
+#endif
+   func(begin, end);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for (nrows x nrows) matrix
 
@@ -115,32 +145,96 @@ Bool_t TDecompChol::Decompose()
    Int_t i,j,icol,irow;
    const Int_t     n  = fU.GetNrows();
          Double_t *pU = fU.GetMatrixArray();
-   for (icol = 0; icol < n; icol++) {
-      const Int_t rowOff = icol*n;
-
-      //Compute fU(j,j) and test for non-positive-definiteness.
-      Double_t ujj = pU[rowOff+icol];
-      for (irow = 0; irow < icol; irow++) {
-         const Int_t pos_ij = irow*n+icol;
-         ujj -= pU[pos_ij]*pU[pos_ij];
-      }
-      if (ujj <= 0) {
-         Error("Decompose()","matrix not positive definite");
-         return kFALSE;
+
+   // Crossover between the plain column algorithm and the blocked
+   // right-looking factorization : small matrices stay on the serial path,
+   // large ones proceed tile by tile so the working set fits in cache and
+   // the trailing update can run in parallel.
+   const Int_t kBlockSize = 64;
+
+   if (n <= 2*kBlockSize) {
+      for (icol = 0; icol < n; icol++) {
+         const Int_t rowOff = icol*n;
+
+         //Compute fU(j,j) and test for non-positive-definiteness.
+         Double_t ujj = pU[rowOff+icol];
+         for (irow = 0; irow < icol; irow++) {
+            const Int_t pos_ij = irow*n+icol;
+            ujj -= pU[pos_ij]*pU[pos_ij];
+         }
+         if (ujj <= 0) {
+            Error("Decompose()","matrix not positive definite");
+            return kFALSE;
+         }
+         ujj = TMath::Sqrt(ujj);
+         pU[rowOff+icol] = ujj;
+         const Double_t inv_ujj = 1.0 / ujj;
+
+         if (icol < n-1) {
+            for (j = icol+1; j < n; j++) {
+               for (i = 0; i < icol; i++) {
+                  const Int_t rowOff2 = i*n;
+                  pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
+               }
+            }
+            for (j = icol+1; j < n; j++)
+               pU[rowOff + j] *= inv_ujj;
+         }
       }
-      ujj = TMath::Sqrt(ujj);
-      pU[rowOff+icol] = ujj;
-      const Double_t inv_ujj = 1.0 / ujj;
-
-      if (icol < n-1) {
-         for (j = icol+1; j < n; j++) {
-            for (i = 0; i < icol; i++) {
-               const Int_t rowOff2 = i*n;
-               pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
+   } else {
+      for (Int_t k = 0; k < n; k += kBlockSize) {
+         const Int_t kend = TMath::Min(n, k + kBlockSize);
+
+         // Factor the diagonal block and solve for the panel rows [k,kend) :
+         // the contributions of rows < k were already subtracted by the
+         // trailing updates of earlier blocks, so this is the unblocked
+         // algorithm with the inner sums restricted to the current block.
+         for (icol = k; icol < kend; icol++) {
+            const Int_t rowOff = icol*n;
+
+            Double_t ujj = pU[rowOff+icol];
+            for (irow = k; irow < icol; irow++) {
+               const Int_t pos_ij = irow*n+icol;
+               ujj -= pU[pos_ij]*pU[pos_ij];
+            }
+            if (ujj <= 0) {
+               Error("Decompose()","matrix not positive definite");
+               return kFALSE;
+            }
+            ujj = TMath::Sqrt(ujj);
+            pU[rowOff+icol] = ujj;
+            const Double_t inv_ujj = 1.0 / ujj;
+
+            if (icol < n-1) {
+               for (j = icol+1; j < n; j++) {
+                  for (i = k; i < icol; i++) {
+                     const Int_t rowOff2 = i*n;
+                     pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
+                  }
+               }
+               for (j = icol+1; j < n; j++)
+                  pU[rowOff + j] *= inv_ujj;
             }
          }
-         for (j = icol+1; j < n; j++)
-	    pU[rowOff + j] *= inv_ujj;
+
+         // Trailing update : subtract the rank-kBlockSize contribution of the
+         // panel from the not yet factored part of the upper triangle. Rows
+         // are independent, so the update runs in parallel chunks.
+         if (kend < n) {
+            ApplyRowRanges(kend, n, [pU, n, k, kend](Int_t rowBegin, Int_t rowEnd) {
+               for (Int_t ii = rowBegin; ii < rowEnd; ii++) {
+                  Double_t *rowi = pU + ii*n;
+                  for (Int_t r = k; r < kend; r++) {
+                     const Double_t *rowr = pU + r*n;
+                     const Double_t urI = rowr[ii];
+                     if (urI != 0.0) {
+                        for (Int_t jj = ii; jj < n; jj++)
+                           rowi[jj] -= urI*rowr[jj];
+                     }
+                  }
+               }
+            });
+         }
       }
    }
 
@@ -9,10 +9,17 @@
  *************************************************************************/
 
 #include <TDecompBase.h>
+#include <TDecompChol.h>
+#include <TMatrixD.h>
+#include <TMatrixDSym.h>
+#include <TVectorD.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <random>
 
 // This is just so the can use the protected DiagProd funciton in the test.
 class TDecompDummy : public TDecompBase {
@@ -37,3 +44,50 @@ TEST(testDecomp, DiagProd)
    // using this specific formula to validate the method.
    EXPECT_EQ(d1 * std::pow(2, d2), v[0]);
 }
+
+// Exercise the blocked Cholesky path (matrices above the serial crossover)
+// and verify the factorization and a solve against the input matrix.
+TEST(testDecomp, CholBlocked)
+{
+   constexpr Int_t n = 300;
+   std::mt19937 gen(7);
+   std::uniform_real_distribution<Double_t> dis(-1., 1.);
+
+   TMatrixD b(n, n);
+   for (Int_t i = 0; i < n; ++i)
+      for (Int_t j = 0; j < n; ++j)
+         b(i, j) = dis(gen);
+   TMatrixDSym a(TMatrixDSym::kAtA, b); // positive definite up to rounding
+   for (Int_t i = 0; i < n; ++i)
+      a(i, i) += 0.1 * n; // ensure it comfortably is
+
+   TDecompChol chol(a);
+   ASSERT_TRUE(chol.Decompose());
+
+   // U^T * U must reproduce the input
+   const TMatrixD &u = chol.GetU();
+   TMatrixDSym utu(TMatrixDSym::kAtA, u);
+   Double_t maxDiff = 0.;
+   for (Int_t i = 0; i < n; ++i)
+      for (Int_t j = 0; j < n; ++j)
+         maxDiff = std::max(maxDiff, std::abs(utu(i, j) - a(i, j)));
+   EXPECT_LT(maxDiff, 1e-9 * n);
+
+   // solving A x = b must give back a consistent x
+   TVectorD x(n);
+   for (Int_t i = 0; i < n; ++i)
+      x(i) = dis(gen);
+   TVectorD rhs = TMatrixD(a) * x;
+   ASSERT_TRUE(chol.Solve(rhs));
+   Double_t maxErr = 0.;
+   for (Int_t i = 0; i < n; ++i)
+      maxErr = std::max(maxErr, std::abs(rhs(i) - x(i)));
+   EXPECT_LT(maxErr, 1e-6);
+
+   // a non positive definite matrix must still be rejected
+   TMatrixDSym notPd(n);
+   notPd.UnitMatrix();
+   notPd(n / 2, n / 2) = -1.;
+   TDecompChol cholBad(notPd);
+   EXPECT_FALSE(cholBad.Decompose());
+}
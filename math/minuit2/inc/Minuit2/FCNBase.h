@@ -76,6 +76,37 @@ public:
 
    virtual double operator()(std::vector<double> const &v) const = 0;
 
+   /**
+
+      Evaluate the function at several parameter points in one call. The
+      default implementation simply loops over the points; override it
+      (and HasBatchEvaluate()) when the function can evaluate a batch of
+      points more efficiently than one by one, e.g. with a vectorized or
+      multi-threaded likelihood. The numerical gradient calculation then
+      funnels its probe points through this interface.
+
+      @param v the parameter points, each defined as in operator().
+
+      @return the function Value at each point, in the same order.
+
+   */
+
+   virtual std::vector<double> BatchEvaluate(std::vector<std::vector<double>> const &v) const
+   {
+      std::vector<double> result;
+      result.reserve(v.size());
+      for (auto const &point : v)
+         result.push_back(operator()(point));
+      return result;
+   }
+
+   /**
+      return true if BatchEvaluate is re-implemented with a dedicated batch
+      evaluation. Only then the gradient calculators submit their probe
+      points in batches instead of calling operator() point by point.
+   */
+   virtual bool HasBatchEvaluate() const { return false; }
+
    /**
 
       Error definition of the function. MINUIT defines Parameter errors as the
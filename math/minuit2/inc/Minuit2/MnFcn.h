@@ -60,6 +60,7 @@ public:
 
    double CallWithTransformedParams(std::vector<double> const &vpar) const;
    double CallWithoutDoingTrafo(const MnAlgebraicVector &) const;
+   std::vector<double> CallBatchWithTransformedParams(std::vector<std::vector<double>> const &vpars) const;
 
 private:
    const FCNBase &fFCN;
@@ -74,6 +75,9 @@ public:
 
    double operator()(const MnAlgebraicVector &v);
 
+   // evaluate several points in one batched FCN call (see FCNBase::BatchEvaluate)
+   std::vector<double> EvaluateBatch(const std::vector<MnAlgebraicVector> &points);
+
 private:
    MnFcn const &fMfcn;
    bool fDoInt2ext = false;
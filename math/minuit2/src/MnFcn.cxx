@@ -31,6 +31,15 @@ double MnFcn::CallWithTransformedParams(std::vector<double> const &vpar) const
    return Fcn()(vpar);
 }
 
+// Batched equivalent of CallWithTransformedParams: evaluate all points with a
+// single FCN call, counting one call per point.
+std::vector<double> MnFcn::CallBatchWithTransformedParams(std::vector<std::vector<double>> const &vpars) const
+{
+   fNumCall += vpars.size();
+
+   return Fcn().BatchEvaluate(vpars);
+}
+
 MnFcnCaller::MnFcnCaller(const MnFcn &mfcn) : fMfcn{mfcn}, fDoInt2ext{static_cast<bool>(mfcn.Trafo())}
 {
    if (!fDoInt2ext)
@@ -63,6 +72,30 @@ double MnFcnCaller::operator()(const MnAlgebraicVector &v)
    return fMfcn.CallWithTransformedParams(fVpar);
 }
 
+std::vector<double> MnFcnCaller::EvaluateBatch(const std::vector<MnAlgebraicVector> &points)
+{
+   std::vector<std::vector<double>> vpars;
+   vpars.reserve(points.size());
+
+   if (!fDoInt2ext) {
+      for (auto const &v : points)
+         vpars.emplace_back(v.Data(), v.Data() + v.size());
+   } else {
+      MnUserTransformation const &transform = *fMfcn.Trafo();
+
+      // transform every point completely: the component cache of operator()
+      // is of no use when the points of a batch differ from each other
+      for (auto const &v : points) {
+         std::vector<double> vpar = fVpar;
+         for (unsigned int i = 0; i < v.size(); i++)
+            vpar[transform.ExtOfInt(i)] = transform.Int2ext(i, v(i));
+         vpars.push_back(std::move(vpar));
+      }
+   }
+
+   return fMfcn.CallBatchWithTransformedParams(vpars);
+}
+
 } // namespace Minuit2
 
 } // namespace ROOT
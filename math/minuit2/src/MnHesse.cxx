@@ -26,6 +26,9 @@
 
 #include "Math/Util.h"
 
+#include <utility>
+#include <vector>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -332,6 +335,70 @@ MinimumState ComputeNumerical(const MnFcn &mfcn, const MinimumState &st, const M
          if ((in + offsetVect) % (n - 1) == 0)
             offsetVect += (in + offsetVect) / (n - 1);
 
+      if (mfcn.Fcn().HasBatchEvaluate()) {
+
+         // The probe points of the off-diagonal Elements are all independent
+         // of each other, so they are collected and submitted in batched FCN
+         // calls instead of being evaluated one by one. The points and the
+         // resulting matrix Elements are bit-identical to the ones of the
+         // point-by-point loop below.
+         constexpr unsigned int kBatch = 512;
+         std::vector<MnAlgebraicVector> points;
+         std::vector<std::pair<int, int>> elem;
+         auto flushBatch = [&]() {
+            std::vector<double> fval = mfcnCaller.EvaluateBatch(points);
+            for (unsigned int k = 0; k < elem.size(); k++) {
+               int i = elem[k].first;
+               int j = elem[k].second;
+               if (!doCentralFD)
+                  vhmat(i, j) = (fval[k] + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+               else
+                  vhmat(i, j) =
+                     (fval[4 * k] - fval[4 * k + 3] - fval[4 * k + 1] + fval[4 * k + 2]) / (4. * dirin(i) * dirin(j));
+            }
+            points.clear();
+            elem.clear();
+         };
+
+         for (unsigned int in = startParIndexOffDiagonal; in < endParIndexOffDiagonal; in++) {
+
+            int i = (in + offsetVect) / (n - 1);
+            if ((in + offsetVect) % (n - 1) == 0)
+               offsetVect += i;
+            int j = (in + offsetVect) % (n - 1) + 1;
+
+            if ((i + 1) == j || in == startParIndexOffDiagonal)
+               x(i) += dirin(i);
+
+            x(j) += dirin(j);
+
+            points.push_back(x); // fs1
+            if (!doCentralFD) {
+               x(j) -= dirin(j);
+            } else {
+               x(i) -= dirin(i);
+               x(i) -= dirin(i);
+               points.push_back(x); // fs3
+               x(j) -= dirin(j);
+               x(j) -= dirin(j);
+               points.push_back(x); // fs4
+               x(i) += dirin(i);
+               x(i) += dirin(i);
+               points.push_back(x); // fs2
+               x(j) += dirin(j);
+            }
+            elem.emplace_back(i, j);
+            if (elem.size() == kBatch)
+               flushBatch();
+
+            if (j % (n - 1) == 0 || in == endParIndexOffDiagonal - 1)
+               x(i) -= dirin(i);
+         }
+         if (!elem.empty())
+            flushBatch();
+
+      } else {
+
       for (unsigned int in = startParIndexOffDiagonal; in < endParIndexOffDiagonal; in++) {
 
          int i = (in + offsetVect) / (n - 1);
@@ -369,6 +436,8 @@ MinimumState ComputeNumerical(const MnFcn &mfcn, const MinimumState &st, const M
             x(i) -= dirin(i);
       }
 
+      }
+
       mpiprocOffDiagonal.SyncSymMatrixOffDiagonal(vhmat);
    }
 
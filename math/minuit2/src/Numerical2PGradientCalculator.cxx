@@ -26,6 +26,7 @@
 #include <cmath>
 #include <cassert>
 #include <iomanip>
+#include <vector>
 
 namespace ROOT {
 
@@ -90,6 +91,78 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
    unsigned int startElementIndex = mpiproc.StartElementIndex();
    unsigned int endElementIndex = mpiproc.EndElementIndex();
 
+   if (fFcn.Fcn().HasBatchEvaluate()) {
+
+      // The derivative cycles of different parameters are independent of each
+      // other, so the parameter and cycle loops can be interchanged and the
+      // two probe points of every still-active parameter submitted as one
+      // batched FCN call per cycle. The arithmetic per parameter is identical
+      // to the one of the point-by-point loop below.
+      std::vector<unsigned int> iactive;
+      iactive.reserve(endElementIndex - startElementIndex);
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++)
+         iactive.push_back(i);
+
+      std::vector<double> epspri(n, 0.);
+      std::vector<double> stepb4(n, 0.);
+      for (unsigned int i : iactive)
+         epspri[i] = eps2 + std::fabs(grd(i) * eps2);
+
+      std::vector<MnAlgebraicVector> points;
+      for (unsigned int j = 0; j < ncycle && !iactive.empty(); j++) {
+
+         // choose the step of every active parameter and collect the probe
+         // points; a parameter whose step settled is done and drops out
+         std::vector<unsigned int> ieval;
+         ieval.reserve(iactive.size());
+         points.clear();
+         for (unsigned int i : iactive) {
+            double optstp = std::sqrt(dfmin / (std::fabs(g2(i)) + epspri[i]));
+            double step = std::max(optstp, std::fabs(0.1 * gstep(i)));
+            if (trafo.Parameter(trafo.ExtOfInt(i)).HasLimits()) {
+               if (step > 0.5)
+                  step = 0.5;
+            }
+            double stpmax = 10. * std::fabs(gstep(i));
+            if (step > stpmax)
+               step = stpmax;
+            double stpmin = std::max(vrysml, 8. * std::fabs(eps2 * x(i)));
+            if (step < stpmin)
+               step = stpmin;
+            if (std::fabs((step - stepb4[i]) / step) < fStrategy.GradientStepTolerance())
+               continue;
+            gstep(i) = step;
+            stepb4[i] = step;
+
+            double xtf = x(i);
+            x(i) = xtf + step;
+            points.push_back(x);
+            x(i) = xtf - step;
+            points.push_back(x);
+            x(i) = xtf;
+            ieval.push_back(i);
+         }
+         if (ieval.empty())
+            break;
+
+         std::vector<double> fval = mfcnCaller.EvaluateBatch(points);
+
+         // update the derivatives; a parameter whose gradient settled is done
+         iactive.clear();
+         for (unsigned int k = 0; k < ieval.size(); k++) {
+            unsigned int i = ieval[k];
+            double fs1 = fval[2 * k];
+            double fs2 = fval[2 * k + 1];
+            double grdb4 = grd(i);
+            grd(i) = 0.5 * (fs1 - fs2) / gstep(i);
+            g2(i) = (fs1 + fs2 - 2. * fcnmin) / gstep(i) / gstep(i);
+            if (std::fabs(grdb4 - grd(i)) / (std::fabs(grd(i)) + dfmin / gstep(i)) >= fStrategy.GradientTolerance())
+               iactive.push_back(i);
+         }
+      }
+
+   } else {
+
    for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
 
 #else
@@ -195,6 +268,8 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
    }
 
 #ifndef _OPENMP
+   } // end of the point-by-point path
+
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
    mpiproc.SyncVector(gstep);
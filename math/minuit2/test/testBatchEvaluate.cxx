@@ -0,0 +1,123 @@
+// test of the batched FCN evaluation interface: a minimization and Hesse run
+// through FCNBase::BatchEvaluate must give results identical to the
+// point-by-point evaluation
+
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnPrint.h"
+#include "Minuit2/MnUserCovariance.h"
+#include "Minuit2/MnUserParameterState.h"
+#include "Minuit2/MnUserParameters.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+const unsigned int gNPar = 8;
+
+int gBatchCalls = 0;
+
+// mildly correlated, non-quadratic test function
+double TestFunction(std::vector<double> const &p)
+{
+   double s = 0.;
+   for (unsigned int i = 0; i < p.size(); i++) {
+      double d = p[i] - 0.3 * i;
+      s += (i + 1) * d * d + 0.1 * std::cos(p[i]);
+      if (i > 0)
+         s += 0.2 * p[i] * p[i - 1];
+   }
+   return s;
+}
+
+class PointwiseFcn : public FCNBase {
+public:
+   double operator()(std::vector<double> const &p) const override { return TestFunction(p); }
+   double Up() const override { return 1.; }
+};
+
+class BatchFcn : public FCNBase {
+public:
+   double operator()(std::vector<double> const &p) const override { return TestFunction(p); }
+   std::vector<double> BatchEvaluate(std::vector<std::vector<double>> const &v) const override
+   {
+      gBatchCalls++;
+      std::vector<double> result;
+      result.reserve(v.size());
+      for (auto const &p : v)
+         result.push_back(TestFunction(p));
+      return result;
+   }
+   bool HasBatchEvaluate() const override { return true; }
+   double Up() const override { return 1.; }
+};
+
+template <class FCN>
+FunctionMinimum Minimize(const FCN &fcn, bool limits)
+{
+   MnUserParameters upar;
+   for (unsigned int i = 0; i < gNPar; i++) {
+      upar.Add("p" + std::to_string(i), 0.5 + 0.1 * i, 0.1);
+      // put limits on some parameters to exercise the int2ext transformation
+      if (limits && i % 3 == 0)
+         upar.SetLimits(i, -10., 10.);
+   }
+   MnMigrad migrad(fcn, upar);
+   FunctionMinimum min = migrad();
+   MnHesse hesse;
+   hesse(fcn, min);
+   return min;
+}
+
+int testBatchEvaluate(bool limits)
+{
+   int iret = 0;
+
+   MnPrint print("testBatchEvaluate", MnPrint::GlobalLevel());
+
+   gBatchCalls = 0;
+   FunctionMinimum m1 = Minimize(PointwiseFcn{}, limits);
+   FunctionMinimum m2 = Minimize(BatchFcn{}, limits);
+
+   if (gBatchCalls == 0) {
+      print.Error("BatchEvaluate was never called");
+      iret |= 1;
+   }
+   if (m1.Fval() != m2.Fval()) {
+      print.Error("function values differ:", m1.Fval(), "vs", m2.Fval());
+      iret |= 2;
+   }
+   if (m1.NFcn() != m2.NFcn()) {
+      print.Error("numbers of function calls differ:", m1.NFcn(), "vs", m2.NFcn());
+      iret |= 4;
+   }
+   for (unsigned int i = 0; i < gNPar; i++) {
+      if (m1.UserState().Value(i) != m2.UserState().Value(i)) {
+         print.Error("values of parameter", i, "differ:", m1.UserState().Value(i), "vs", m2.UserState().Value(i));
+         iret |= 8;
+      }
+   }
+   const MnUserCovariance &c1 = m1.UserState().Covariance();
+   const MnUserCovariance &c2 = m2.UserState().Covariance();
+   for (unsigned int i = 0; i < gNPar; i++) {
+      for (unsigned int j = 0; j <= i; j++) {
+         if (c1(i, j) != c2(i, j)) {
+            print.Error("covariance elements", i, j, "differ:", c1(i, j), "vs", c2(i, j));
+            iret |= 16;
+         }
+      }
+   }
+   return iret;
+}
+
+int main()
+{
+   int iret = 0;
+   iret |= testBatchEvaluate(false);
+   iret |= testBatchEvaluate(true);
+   return iret;
+}
@@ -26,6 +26,7 @@ public:
 
    Bool_t          SetDecay(TLorentzVector &P, Int_t nt, const Double_t *mass, Option_t *opt="");
    Double_t        Generate();
+   void            GenerateBulk(Int_t nev, Double_t *wt, Double_t *px, Double_t *py, Double_t *pz, Double_t *e);
    TLorentzVector *GetDecay(Int_t n);
 
    Int_t    GetNt()      const { return fNt;}
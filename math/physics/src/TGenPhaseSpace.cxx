@@ -25,6 +25,8 @@ Note that Momentum, Energy units are Gev/C, GeV
 #include "TRandom.h"
 #include "TMath.h"
 
+#include <vector>
+
 const Int_t kMAXP = 18;
 
 ClassImp(TGenPhaseSpace);
@@ -168,6 +170,142 @@ Double_t TGenPhaseSpace::Generate()
    return wt;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///  Generate nev random final states in one call.
+///
+///  The output is written in structure-of-arrays form: each of px, py, pz, e
+///  must hold nev*GetNt() values and the component of decay product ip of
+///  event k is stored at index `ip*nev + k`, so the array of each component
+///  of each product is contiguous over the events.  wt must hold nev values
+///  and receives the un-normalized event weights.
+///
+///  The result is statistically equivalent to calling Generate() nev times,
+///  but the random numbers are drawn in bulk and the rotations and boosts
+///  are carried out on plain arrays instead of per-call TLorentzVector
+///  operations, which matters when generating very large toy samples.
+///  The decay products of the last generated event are also available
+///  through GetDecay(), as after Generate().
+///
+/// Note that Momentum, Energy units are Gev/C, GeV
+
+void TGenPhaseSpace::GenerateBulk(Int_t nev, Double_t *wt, Double_t *px, Double_t *py, Double_t *pz, Double_t *e)
+{
+   if (nev <= 0 || fNt < 2) return;
+
+   // precompute the final boost, it is the same for every event
+   Double_t b2 = fBeta[0]*fBeta[0] + fBeta[1]*fBeta[1] + fBeta[2]*fBeta[2];
+   Double_t gamma = 1.0 / TMath::Sqrt(1.0 - b2);
+   Double_t gamma2 = b2 > 0 ? (gamma - 1.0)/b2 : 0.0;
+
+   // random numbers per event: fNt-2 mass fractions plus two angles for
+   // each of the fNt-1 rotations, drawn in bulk one chunk at a time
+   const Int_t nrndpev = (fNt-2) + 2*(fNt-1);
+   const Int_t kChunk = 256;
+   std::vector<Double_t> rndbuf(nrndpev*kChunk);
+   Int_t nbuf = 0, ibuf = 0;
+
+   for (Int_t k = 0; k < nev; k++) {
+      if (ibuf == nbuf) {
+         nbuf = TMath::Min(nev-k, kChunk)*nrndpev;
+         gRandom->RndmArray(nbuf, rndbuf.data());
+         ibuf = 0;
+      }
+      const Double_t *rnd = &rndbuf[ibuf];
+      ibuf += nrndpev;
+
+      Double_t rno[kMAXP];
+      rno[0] = 0;
+      Int_t n;
+      if (fNt>2) {
+         for (n=1; n<fNt-1; n++) rno[n] = rnd[n-1];   // fNt-2 random numbers
+         for (n=2; n<fNt-1; n++) {                    // sort them
+            Double_t r = rno[n];
+            Int_t m = n-1;
+            while (m >= 1 && rno[m] > r) { rno[m+1] = rno[m]; m--; }
+            rno[m+1] = r;
+         }
+      }
+      rno[fNt-1] = 1;
+      rnd += fNt-2;
+
+      Double_t invMas[kMAXP], sum=0;
+      for (n=0; n<fNt; n++) {
+         sum      += fMass[n];
+         invMas[n] = rno[n]*fTeCmTm + sum;
+      }
+
+      Double_t evwt = fWtMax;
+      Double_t pd[kMAXP];
+      for (n=0; n<fNt-1; n++) {
+         pd[n] = PDK(invMas[n+1],invMas[n],fMass[n+1]);
+         evwt *= pd[n];
+      }
+      wt[k] = evwt;
+
+      //
+      //-----> complete specification of event (Raubold-Lynch method)
+      //
+      Double_t vx[kMAXP], vy[kMAXP], vz[kMAXP], ve[kMAXP];
+      vx[0] = 0;
+      vy[0] = pd[0];
+      vz[0] = 0;
+      ve[0] = TMath::Sqrt(pd[0]*pd[0]+fMass[0]*fMass[0]);
+
+      Int_t i=1;
+      Int_t j;
+      while (true) {
+         vx[i] = 0;
+         vy[i] = -pd[i-1];
+         vz[i] = 0;
+         ve[i] = TMath::Sqrt(pd[i-1]*pd[i-1]+fMass[i]*fMass[i]);
+
+         Double_t cZ   = 2*rnd[0] - 1;
+         Double_t sZ   = TMath::Sqrt(1-cZ*cZ);
+         Double_t angY = 2*TMath::Pi() * rnd[1];
+         Double_t cY   = TMath::Cos(angY);
+         Double_t sY   = TMath::Sin(angY);
+         rnd += 2;
+         for (j=0; j<=i; j++) {
+            Double_t x = vx[j];
+            Double_t y = vy[j];
+            vx[j] = cZ*x - sZ*y;
+            vy[j] = sZ*x + cZ*y;   // rotation around Z
+            x = vx[j];
+            Double_t z = vz[j];
+            vx[j] = cY*x - sY*z;
+            vz[j] = sY*x + cY*z;   // rotation around Y
+         }
+
+         if (i == (fNt-1)) break;
+
+         Double_t beta = pd[i] / sqrt(pd[i]*pd[i] + invMas[i]*invMas[i]);
+         Double_t g    = 1.0 / TMath::Sqrt(1.0 - beta*beta);
+         for (j=0; j<=i; j++) {
+            Double_t y  = vy[j];
+            vy[j] = g*(y + beta*ve[j]);      // boost along Y
+            ve[j] = g*(ve[j] + beta*y);
+         }
+         i++;
+      }
+
+      //
+      //---> final boost of all particles and write out
+      //
+      for (n=0; n<fNt; n++) {
+         Double_t bp = fBeta[0]*vx[n] + fBeta[1]*vy[n] + fBeta[2]*vz[n];
+         px[n*nev+k] = vx[n] + gamma2*bp*fBeta[0] + gamma*fBeta[0]*ve[n];
+         py[n*nev+k] = vy[n] + gamma2*bp*fBeta[1] + gamma*fBeta[1]*ve[n];
+         pz[n*nev+k] = vz[n] + gamma2*bp*fBeta[2] + gamma*fBeta[2]*ve[n];
+         e [n*nev+k] = gamma*(ve[n] + bp);
+      }
+   }
+
+   // leave the last event accessible through GetDecay()
+   Int_t last = nev-1;
+   for (Int_t n=0; n<fNt; n++)
+      fDecPro[n].SetPxPyPzE(px[n*nev+last], py[n*nev+last], pz[n*nev+last], e[n*nev+last]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return Lorentz vector corresponding to decay n
 
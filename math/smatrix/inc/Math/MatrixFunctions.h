@@ -736,10 +736,29 @@ inline T Similarity(const VecExpr<A,T,D>& lhs, const Expr<B,T,D,D,R>& rhs) {
 //==============================================================================
 template <class T, unsigned int D1, unsigned int D2, class R>
 inline SMatrix<T,D1,D1,MatRepSym<T,D1> > Similarity(const SMatrix<T,D1,D2,R>& lhs, const SMatrix<T,D2,D2,MatRepSym<T,D2> >& rhs) {
-  SMatrix<T,D1,D2, MatRepStd<T,D1,D2> > tmp = lhs * rhs;
-  typedef  SMatrix<T,D1,D1,MatRepSym<T,D1> > SMatrixSym;
-  SMatrixSym mret;
-  AssignSym::Evaluate(mret,  tmp * Transpose(lhs)  );
+  // Fused kernel: compute one row of tmp = lhs * rhs at a time and contract it
+  // immediately with the rows of lhs, writing only the lower half of the
+  // symmetric result. The dimensions are compile-time constants, so the loops
+  // fully unroll (and vectorize) for the small sizes used in track fitting,
+  // without materializing the full temporary of the expression-template path.
+  SMatrix<T,D1,D1,MatRepSym<T,D1> > mret;
+  T* ret = mret.Array();
+  for (unsigned int i = 0; i < D1; ++i) {
+    T tmp[D2];
+    for (unsigned int k = 0; k < D2; ++k) {
+      T sum = 0;
+      for (unsigned int l = 0; l < D2; ++l)
+        sum += lhs(i,l) * rhs(l,k);
+      tmp[k] = sum;
+    }
+    // symmetric storage is the packed lower block, filled row by row
+    for (unsigned int j = 0; j <= i; ++j) {
+      T sum = 0;
+      for (unsigned int k = 0; k < D2; ++k)
+        sum += tmp[k] * lhs(j,k);
+      *ret++ = sum;
+    }
+  }
   return mret;
 }
 
@@ -750,11 +769,8 @@ inline SMatrix<T,D1,D1,MatRepSym<T,D1> > Similarity(const SMatrix<T,D1,D2,R>& lh
 //==============================================================================
 template <class A, class T, unsigned int D1, unsigned int D2, class R>
 inline SMatrix<T,D1,D1,MatRepSym<T,D1> > Similarity(const Expr<A,T,D1,D2,R>& lhs, const SMatrix<T,D2,D2,MatRepSym<T,D2> >& rhs) {
-  SMatrix<T,D1,D2,MatRepStd<T,D1,D2> > tmp = lhs * rhs;
-  typedef  SMatrix<T,D1,D1,MatRepSym<T,D1> > SMatrixSym;
-  SMatrixSym mret;
-  AssignSym::Evaluate(mret,  tmp * Transpose(lhs)  );
-  return mret;
+  // evaluate the expression once and use the fused matrix kernel above
+  return Similarity(SMatrix<T,D1,D2,R>(lhs), rhs);
 }
 
 #ifdef XXX
@@ -786,10 +802,26 @@ inline SMatrix<T,D1,D1,MatRepSym<T,D1> > Similarity(const SMatrix<T,D1,D1,MatRep
 //==============================================================================
 template <class T, unsigned int D1, unsigned int D2, class R>
 inline SMatrix<T,D2,D2,MatRepSym<T,D2> > SimilarityT(const SMatrix<T,D1,D2,R>& lhs, const SMatrix<T,D1,D1,MatRepSym<T,D1> >& rhs) {
-  SMatrix<T,D1,D2,MatRepStd<T,D1,D2> > tmp = rhs * lhs;
-  typedef  SMatrix<T,D2,D2,MatRepSym<T,D2> > SMatrixSym;
-  SMatrixSym mret;
-  AssignSym::Evaluate(mret,  Transpose(lhs) * tmp );
+  // Fused kernel as in Similarity above: tmp = rhs * lhs is computed into a
+  // local compile-time-sized array and contracted with the columns of lhs,
+  // writing only the packed lower half of the symmetric result.
+  T tmp[D1][D2];
+  for (unsigned int k = 0; k < D1; ++k)
+    for (unsigned int j = 0; j < D2; ++j) {
+      T sum = 0;
+      for (unsigned int l = 0; l < D1; ++l)
+        sum += rhs(k,l) * lhs(l,j);
+      tmp[k][j] = sum;
+    }
+  SMatrix<T,D2,D2,MatRepSym<T,D2> > mret;
+  T* ret = mret.Array();
+  for (unsigned int i = 0; i < D2; ++i)
+    for (unsigned int j = 0; j <= i; ++j) {
+      T sum = 0;
+      for (unsigned int k = 0; k < D1; ++k)
+        sum += lhs(k,i) * tmp[k][j];
+      *ret++ = sum;
+    }
   return mret;
 }
 
@@ -800,11 +832,8 @@ inline SMatrix<T,D2,D2,MatRepSym<T,D2> > SimilarityT(const SMatrix<T,D1,D2,R>& l
 //==============================================================================
 template <class A, class T, unsigned int D1, unsigned int D2, class R>
 inline SMatrix<T,D2,D2,MatRepSym<T,D2> > SimilarityT(const Expr<A,T,D1,D2,R>& lhs, const SMatrix<T,D1,D1,MatRepSym<T,D1> >& rhs) {
-  SMatrix<T,D1,D2,MatRepStd<T,D1,D2> > tmp = rhs * lhs;
-  typedef  SMatrix<T,D2,D2,MatRepSym<T,D2> > SMatrixSym;
-  SMatrixSym mret;
-  AssignSym::Evaluate(mret,  Transpose(lhs) * tmp );
-  return mret;
+  // evaluate the expression once and use the fused matrix kernel above
+  return SimilarityT(SMatrix<T,D1,D2,R>(lhs), rhs);
 }
 
 
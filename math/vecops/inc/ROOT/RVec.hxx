@@ -1609,6 +1609,16 @@ inline size_t CapacityInBytes(const RVecN<T, N> &X)
 ///@name RVec Unary Arithmetic Operators
 ///@{
 
+/// \cond
+// Whether the result type U of an element-wise operation can be stored back
+// into the elements of an operand RVec<T>: only then can an operator recycle
+// the storage of an expiring temporary instead of allocating a new vector.
+// This is what fuses chained expressions such as `v0 * v1 + v2` into loops
+// over a single reused buffer (including its small-buffer storage).
+template <typename T, typename U>
+using CanReuseStorage = std::is_same<T, typename std::decay<U>::type>;
+/// \endcond
+
 #define RVEC_UNARY_OPERATOR(OP)                                                \
 template <typename T>                                                          \
 RVec<T> operator OP(const RVec<T> &v)                                          \
@@ -1617,6 +1627,14 @@ RVec<T> operator OP(const RVec<T> &v)                                          \
    for (auto &x : ret)                                                         \
       x = OP x;                                                                \
 return ret;                                                                    \
+}                                                                              \
+                                                                               \
+template <typename T>                                                          \
+RVec<T> operator OP(RVec<T> &&v)                                               \
+{                                                                              \
+   for (auto &x : v)                                                           \
+      x = OP x;                                                                \
+   return std::move(v);                                                        \
 }                                                                              \
 
 RVEC_UNARY_OPERATOR(+)
@@ -1665,6 +1683,74 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
+                                                                               \
+/* the overloads on expiring vectors recycle the operand's storage when the */ \
+/* result type allows it, so chained expressions reuse a single buffer */      \
+template <typename T0, typename T1,                                            \
+          typename std::enable_if<                                             \
+             CanReuseStorage<T0, decltype(std::declval<const T0 &>()           \
+                                             OP std::declval<const T1 &>())>::value, \
+             int>::type = 0>                                                   \
+RVec<T0> operator OP(RVec<T0> &&v, const T1 &y)                                \
+{                                                                              \
+   for (auto &x : v)                                                           \
+      x = x OP y;                                                              \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename std::enable_if<                                             \
+             CanReuseStorage<T1, decltype(std::declval<const T0 &>()           \
+                                             OP std::declval<const T1 &>())>::value, \
+             int>::type = 0>                                                   \
+RVec<T1> operator OP(const T0 &x, RVec<T1> &&v)                                \
+{                                                                              \
+   for (auto &y : v)                                                           \
+      y = x OP y;                                                              \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename std::enable_if<                                             \
+             CanReuseStorage<T0, decltype(std::declval<const T0 &>()           \
+                                             OP std::declval<const T1 &>())>::value, \
+             int>::type = 0>                                                   \
+RVec<T0> operator OP(RVec<T0> &&v0, const RVec<T1> &v1)                        \
+{                                                                              \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto itY = v1.begin();                                                      \
+   for (auto &x : v0)                                                          \
+      x = x OP *itY++;                                                         \
+   return std::move(v0);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename std::enable_if<                                             \
+             CanReuseStorage<T1, decltype(std::declval<const T0 &>()           \
+                                             OP std::declval<const T1 &>())>::value, \
+             int>::type = 0>                                                   \
+RVec<T1> operator OP(const RVec<T0> &v0, RVec<T1> &&v1)                        \
+{                                                                              \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto itX = v0.begin();                                                      \
+   for (auto &y : v1)                                                          \
+      y = *itX++ OP y;                                                         \
+   return std::move(v1);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename std::enable_if<                                             \
+             CanReuseStorage<T0, decltype(std::declval<const T0 &>()           \
+                                             OP std::declval<const T1 &>())>::value, \
+             int>::type = 0>                                                   \
+RVec<T0> operator OP(RVec<T0> &&v0, RVec<T1> &&v1)                             \
+{                                                                              \
+   return std::move(v0) OP v1;                                                 \
+}                                                                              \
 
 RVEC_BINARY_OPERATOR(+)
 RVEC_BINARY_OPERATOR(-)
@@ -1789,6 +1875,15 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T &x) { return FUNC(x); };                             \
       std::transform(v.begin(), v.end(), ret.begin(), f);                      \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   template <typename T,                                                       \
+             typename std::enable_if<CanReuseStorage<T, PromoteType<T>>::value, int>::type = 0> \
+   RVec<T> NAME(RVec<T> &&v)                                                   \
+   {                                                                           \
+      for (auto &x : v)                                                        \
+         x = FUNC(x);                                                          \
+      return std::move(v);                                                     \
    }
 
 #define RVEC_BINARY_FUNCTION(NAME, FUNC)                                       \
@@ -1820,6 +1915,57 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T0 &x, const T1 &y) { return FUNC(x, y); };            \
       std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), f);        \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1,                                         \
+             typename std::enable_if<CanReuseStorage<T0, PromoteTypes<T0, T1>>::value, int>::type = 0> \
+   RVec<T0> NAME(RVec<T0> &&v, const T1 &y)                                    \
+   {                                                                           \
+      for (auto &x : v)                                                        \
+         x = FUNC(x, y);                                                       \
+      return std::move(v);                                                     \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1,                                         \
+             typename std::enable_if<CanReuseStorage<T1, PromoteTypes<T0, T1>>::value, int>::type = 0> \
+   RVec<T1> NAME(const T0 &x, RVec<T1> &&v)                                    \
+   {                                                                           \
+      for (auto &y : v)                                                        \
+         y = FUNC(x, y);                                                       \
+      return std::move(v);                                                     \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1,                                         \
+             typename std::enable_if<CanReuseStorage<T0, PromoteTypes<T0, T1>>::value, int>::type = 0> \
+   RVec<T0> NAME(RVec<T0> &&v0, const RVec<T1> &v1)                            \
+   {                                                                           \
+      if (v0.size() != v1.size())                                              \
+         throw std::runtime_error(ERROR_MESSAGE(NAME));                        \
+                                                                               \
+      auto itY = v1.begin();                                                   \
+      for (auto &x : v0)                                                       \
+         x = FUNC(x, *itY++);                                                  \
+      return std::move(v0);                                                    \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1,                                         \
+             typename std::enable_if<CanReuseStorage<T1, PromoteTypes<T0, T1>>::value, int>::type = 0> \
+   RVec<T1> NAME(const RVec<T0> &v0, RVec<T1> &&v1)                            \
+   {                                                                           \
+      if (v0.size() != v1.size())                                              \
+         throw std::runtime_error(ERROR_MESSAGE(NAME));                        \
+                                                                               \
+      auto itX = v0.begin();                                                   \
+      for (auto &y : v1)                                                       \
+         y = FUNC(*itX++, y);                                                  \
+      return std::move(v1);                                                    \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1,                                         \
+             typename std::enable_if<CanReuseStorage<T0, PromoteTypes<T0, T1>>::value, int>::type = 0> \
+   RVec<T0> NAME(RVec<T0> &&v0, RVec<T1> &&v1)                                 \
+   {                                                                           \
+      return NAME(std::move(v0), static_cast<const RVec<T1> &>(v1));           \
    }                                                                           \
 
 #define RVEC_STD_UNARY_FUNCTION(F) RVEC_UNARY_FUNCTION(F, std::F)
@@ -1878,6 +2024,7 @@ RVEC_STD_UNARY_FUNCTION(tgamma)
 
 #ifdef R__HAS_VDT
 #define RVEC_VDT_UNARY_FUNCTION(F) RVEC_UNARY_FUNCTION(F, vdt::F)
+#define RVEC_VDT_BINARY_FUNCTION(F) RVEC_BINARY_FUNCTION(F, vdt::F)
 
 RVEC_VDT_UNARY_FUNCTION(fast_expf)
 RVEC_VDT_UNARY_FUNCTION(fast_logf)
@@ -1887,6 +2034,8 @@ RVEC_VDT_UNARY_FUNCTION(fast_tanf)
 RVEC_VDT_UNARY_FUNCTION(fast_asinf)
 RVEC_VDT_UNARY_FUNCTION(fast_acosf)
 RVEC_VDT_UNARY_FUNCTION(fast_atanf)
+RVEC_VDT_UNARY_FUNCTION(fast_isqrtf)
+RVEC_VDT_BINARY_FUNCTION(fast_atan2f)
 
 RVEC_VDT_UNARY_FUNCTION(fast_exp)
 RVEC_VDT_UNARY_FUNCTION(fast_log)
@@ -1896,7 +2045,10 @@ RVEC_VDT_UNARY_FUNCTION(fast_tan)
 RVEC_VDT_UNARY_FUNCTION(fast_asin)
 RVEC_VDT_UNARY_FUNCTION(fast_acos)
 RVEC_VDT_UNARY_FUNCTION(fast_atan)
+RVEC_VDT_UNARY_FUNCTION(fast_isqrt)
+RVEC_VDT_BINARY_FUNCTION(fast_atan2)
 #undef RVEC_VDT_UNARY_FUNCTION
+#undef RVEC_VDT_BINARY_FUNCTION
 
 #endif // R__HAS_VDT
 
@@ -2984,8 +3136,17 @@ RVec<Common_t> DeltaPhi(T0 v1, const RVec<T1>& v2, const Common_t c = M_PI)
 template <typename T0, typename T1 = T0, typename T2 = T0, typename T3 = T0, typename Common_t = std::common_type_t<T0, T1, T2, T3>>
 RVec<Common_t> DeltaR2(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2>& phi1, const RVec<T3>& phi2, const Common_t c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   // a single fused loop instead of chained RVec arithmetic: no temporary
+   // vectors and a body simple enough for the compiler to auto-vectorize
+   using size_type = typename RVec<T0>::size_type;
+   const size_type size = eta1.size();
+   auto r = RVec<Common_t>(size);
+   for (size_type i = 0; i < size; i++) {
+      const auto deta = eta1[i] - eta2[i];
+      const auto dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = deta * deta + dphi * dphi;
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2998,7 +3159,15 @@ RVec<Common_t> DeltaR2(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2
 template <typename T0, typename T1 = T0, typename T2 = T0, typename T3 = T0, typename Common_t = std::common_type_t<T0, T1, T2, T3>>
 RVec<Common_t> DeltaR(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2>& phi1, const RVec<T3>& phi2, const Common_t c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   using size_type = typename RVec<T0>::size_type;
+   const size_type size = eta1.size();
+   auto r = RVec<Common_t>(size);
+   for (size_type i = 0; i < size; i++) {
+      const auto deta = eta1[i] - eta2[i];
+      const auto dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = std::sqrt(deta * deta + dphi * dphi);
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -3485,6 +3654,7 @@ RVEC_EXTERN_STD_FUNCTIONS(double)
 #ifdef R__HAS_VDT
 
 #define RVEC_EXTERN_VDT_UNARY_FUNCTION(T, F) RVEC_EXTERN_UNARY_FUNCTION(T, F, vdt::F)
+#define RVEC_EXTERN_VDT_BINARY_FUNCTION(T, F) RVEC_EXTERN_BINARY_FUNCTION(T, T, F, vdt::F)
 
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_expf)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_logf)
@@ -3494,6 +3664,8 @@ RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_tanf)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_asinf)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_acosf)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_atanf)
+RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_isqrtf)
+RVEC_EXTERN_VDT_BINARY_FUNCTION(float, fast_atan2f)
 
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_exp)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_log)
@@ -3503,6 +3675,8 @@ RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_tan)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_asin)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_acos)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_atan)
+RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_isqrt)
+RVEC_EXTERN_VDT_BINARY_FUNCTION(double, fast_atan2)
 
 #endif // R__HAS_VDT
 
@@ -238,6 +238,8 @@ RVEC_DECLARE_STD_FUNCTIONS(double)
 
 #define RVEC_DECLARE_VDT_UNARY_FUNCTION(T, F)    \
    RVEC_DECLARE_UNARY_FUNCTION(T, F, vdt::F)
+#define RVEC_DECLARE_VDT_BINARY_FUNCTION(T, F)   \
+   RVEC_DECLARE_BINARY_FUNCTION(T, T, F, vdt::F)
 
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_expf)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_logf)
@@ -247,6 +249,8 @@ RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_tanf)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_asinf)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_acosf)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_atanf)
+RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_isqrtf)
+RVEC_DECLARE_VDT_BINARY_FUNCTION(float, fast_atan2f)
 
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_exp)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_log)
@@ -256,6 +260,8 @@ RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_tan)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_asin)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_acos)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_atan)
+RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_isqrt)
+RVEC_DECLARE_VDT_BINARY_FUNCTION(double, fast_atan2)
 
 #endif // R__HAS_VDT
 
@@ -299,6 +299,53 @@ TEST(VecOps, MathVectorInPlace)
    CheckEqual(div, ref / vec);
 }
 
+TEST(VecOps, MathRValueReuse)
+{
+   // operators on expiring vectors must recycle the operand's buffer
+   // (when the element type is preserved) and still give the same results
+   RVec<double> ref{1, 2, 3};
+   RVec<double> vec{3, 4, 5};
+
+   RVec<double> v(ref);
+   const auto *addr = v.data();
+   auto chained = (std::move(v) * 2. + vec) / 3.;
+   CheckEqual(chained, (ref * 2. + vec) / 3.);
+   EXPECT_EQ(chained.data(), addr);
+
+   // also through the sqrt/pow math functions
+   RVec<double> v2(ref);
+   addr = v2.data();
+   auto mathchain = sqrt(pow(std::move(v2), 2.) + vec * vec);
+   CheckEqual(mathchain, sqrt(ref * ref + vec * vec));
+   EXPECT_EQ(mathchain.data(), addr);
+
+   // scalar on the left, reusing the right operand
+   RVec<double> v3(ref);
+   addr = v3.data();
+   auto fromscalar = 10. - std::move(v3);
+   CheckEqual(fromscalar, 10. - ref);
+   EXPECT_EQ(fromscalar.data(), addr);
+
+   // unary minus on a temporary
+   RVec<double> v4(ref);
+   addr = v4.data();
+   auto neg = -std::move(v4);
+   CheckEqual(neg, RVec<double>{-1, -2, -3});
+   EXPECT_EQ(neg.data(), addr);
+
+   // a promoting operation cannot reuse the storage and must still work
+   RVec<float> vf{1.f, 2.f, 3.f};
+   auto promoted = std::move(vf) * 2.;
+   static_assert(std::is_same<decltype(promoted), RVec<double>>::value,
+                 "mixed-type operation must still promote");
+   CheckEqual(promoted, ref * 2.);
+
+   // size checks are preserved on the reusing paths
+   RVec<double> v5(ref);
+   RVec<double> shorter{1, 2};
+   EXPECT_THROW(std::move(v5) + shorter, std::runtime_error);
+}
+
 TEST(VecOps, Filter)
 {
    RVec<int> v{0, 1, 2, 3, 4, 5};
@@ -490,6 +537,10 @@ TEST(VecOps, MathFuncs)
    CHECK_VDT_FUNC(atan)
    CHECK_VDT_FUNC(acos)
    CHECK_VDT_FUNC(atan)
+   CHECK_VDT_FUNC(isqrt)
+
+   CheckEqual(fast_atan2(v, u), Map(v, u, [](double y, double x) { return vdt::fast_atan2(y, x); }),
+              "error checking vdt function atan2");
 #endif
 }
 
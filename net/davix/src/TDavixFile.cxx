@@ -340,12 +340,34 @@ TDavixFileInternal::~TDavixFileInternal()
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Session caching is only exposed by newer versions of davix, so use the same
+// SFINAE trick as for the S3 region below: the first overload wins when
+// setSessionCaching is available, otherwise the variadic one is picked.
+template<typename TContext = Davix::Context>
+static auto contextSessionCaching(TContext *context, bool option)
+  -> decltype(context->setSessionCaching(option), void())
+{
+   if (gDebug > 1) Info("contextSessionCaching", "Setting davix session caching to %s",
+                        option ? "true" : "false");
+   context->setSessionCaching(option);
+}
+
+template<typename TContext = Davix::Context>
+static void contextSessionCaching(...) {
+   Warning("contextSessionCaching", "Unable to set session caching, not supported by this version of davix");
+}
+
 Context *TDavixFileInternal::getDavixInstance()
 {
    if (davix_context_s == NULL) {
       TLockGuard guard(&createLock);
       if (davix_context_s == NULL) {
          davix_context_s = new Context();
+         // Cache authenticated sessions in the process-wide context, so that
+         // further opens against the same endpoint reuse the TLS session
+         // instead of paying a full handshake per file
+         if (!isno(gEnv->GetValue("Davix.SessionCaching", (const char *)"y")))
+            contextSessionCaching(davix_context_s, true);
       }
    }
    return davix_context_s;
@@ -470,6 +492,35 @@ static void awsAlternate(...) {
    Warning("awsAlternate", "Unable to set AWS path-based bucket option (s3alternate), not supported by this version of davix");
 }
 
+// Identical SFINAE trick as above for setKeepAlive
+template<typename TRequestParams = Davix::RequestParams>
+static auto paramKeepAlive(TRequestParams *parameters, bool option)
+  -> decltype(parameters->setKeepAlive(option), void())
+{
+   if (gDebug > 1) Info("paramKeepAlive", "Setting keep-alive to %s", option ? "true" : "false");
+   parameters->setKeepAlive(option);
+}
+
+template<typename TRequestParams = Davix::RequestParams>
+static void paramKeepAlive(...) {
+   Warning("paramKeepAlive", "Unable to set keep-alive, not supported by this version of davix");
+}
+
+// Identical SFINAE trick as above for setHttp2: multiplex requests over one
+// connection where the server supports it
+template<typename TRequestParams = Davix::RequestParams>
+static auto paramHttp2(TRequestParams *parameters, bool option)
+  -> decltype(parameters->setHttp2(option), void())
+{
+   if (gDebug > 1) Info("paramHttp2", "Setting HTTP/2 to %s", option ? "true" : "false");
+   parameters->setHttp2(option);
+}
+
+template<typename TRequestParams = Davix::RequestParams>
+static void paramHttp2(...) {
+   Warning("paramHttp2", "Unable to enable HTTP/2, not supported by this version of davix");
+}
+
 void TDavixFileInternal::setAwsRegion(const std::string & region) {
    if(!region.empty()) {
       awsRegion(davixParam, region.c_str());
@@ -509,6 +560,12 @@ void TDavixFileInternal::parseConfig()
    davixParam->setTransparentRedirectionSupport(true);
    davixParam->setClientCertCallbackX509(&TDavixFile_http_authn_cert_X509, NULL);
 
+   // connection reuse
+   if (!isno(gEnv->GetValue("Davix.KeepAlive", (const char *)"y")))
+      paramKeepAlive(davixParam, true);
+   if (!isno(gEnv->GetValue("Davix.UseHTTP2", (const char *)"n")))
+      paramHttp2(davixParam, true);
+
    // setup CADIR
    env_var = gEnv->GetValue("Davix.GSI.CAdir", (const char *) NULL);
    if (env_var) {
@@ -4,6 +4,8 @@
 #pragma link off all classes;
 #pragma link off all functions;
 
+#pragma link C++ class THistPyramid;
+#pragma link C++ class THistStreamHandler;
 #pragma link C++ class TRootSnifferFull;
 
 #endif
@@ -0,0 +1,50 @@
+// $Id$
+// Author: ROOT team   29/08/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THistPyramid
+#define ROOT_THistPyramid
+
+#include "TNamed.h"
+
+#include <memory>
+#include <vector>
+
+class TH2;
+class TH2D;
+
+class THistPyramid : public TNamed {
+protected:
+   TH2 *fHist{nullptr};                         ///<! source histogram, not owned
+   std::vector<std::unique_ptr<TH2D>> fLevels;  ///<! aggregated copies, halved per axis at each level
+   Int_t fMinBins{64};                          ///<! stop aggregating below this bin count per axis
+   Double_t fEntries{-1.};                      ///<! entries of the source when the levels were built
+
+   void BuildLevels();
+
+public:
+   THistPyramid() = default;
+   THistPyramid(TH2 *hist, const char *name = nullptr);
+   virtual ~THistPyramid() = default;
+
+   /// Coarsest per-axis bin count; levels stop once an axis would go below it
+   void SetMinBins(Int_t nbins) { fMinBins = nbins > 2 ? nbins : 2; fEntries = -1.; }
+
+   /// Rebuild the aggregated levels when the source histogram changed
+   void Update();
+
+   Int_t GetNlevels();
+   TH2 *GetLevel(Int_t level);
+   TH2 *GetView(Int_t maxnx, Int_t maxny);
+
+   ClassDefOverride(THistPyramid, 0) // multi-resolution aggregated copies of a TH2
+};
+
+#endif
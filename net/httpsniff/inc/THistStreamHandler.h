@@ -0,0 +1,55 @@
+// $Id$
+// Author: ROOT team   28/08/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THistStreamHandler
+#define ROOT_THistStreamHandler
+
+#include "THttpWSHandler.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class TH1;
+
+class THistStreamHandler : public THttpWSHandler {
+protected:
+   struct Client_t {
+      UInt_t fWSId{0};                                      ///<! websocket id of the client
+      std::map<std::string, std::vector<Double_t>> fShadow; ///<! bin contents last sent to this client
+   };
+
+   std::vector<TH1 *> fHists;     ///<! streamed histograms, not owned
+   std::vector<Client_t> fClients; ///<! per-client shadow state
+   Int_t fCompress{5};            ///<! zstd compression level for the binary frames, 0 disables
+
+   std::string BuildFrame(TH1 *hist, std::vector<Double_t> &shadow);
+
+public:
+   THistStreamHandler(const char *name, const char *title);
+   virtual ~THistStreamHandler() = default;
+
+   void AddHist(TH1 *hist);
+   void RemoveHist(TH1 *hist);
+
+   /// Compression level of the frame payload: 0 switches compression off
+   void SetCompression(Int_t lvl) { fCompress = lvl; }
+
+   /// Compare all histograms against each client's shadow copy and send the
+   /// changed bin ranges; call periodically, e.g. from a TTimer
+   void StreamUpdates();
+
+   Bool_t ProcessWS(THttpCallArg *arg) override;
+
+   ClassDefOverride(THistStreamHandler, 0) // websocket streaming of changed histogram bins
+};
+
+#endif
@@ -0,0 +1,165 @@
+// $Id$
+// Author: ROOT team   29/08/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THistPyramid.h"
+
+#include "TH2.h"
+#include "TMath.h"
+
+/** \class THistPyramid
+\ingroup http
+
+Multi-resolution pyramid over a TH2 for web display of large maps.
+
+Displaying a 4096x4096 occupancy map through THttpServer ships every bin to
+the browser although the viewport can only resolve a few hundred bins per
+axis. THistPyramid keeps mipmap-style aggregated copies of the source
+histogram: each level halves the number of bins per axis, summing the 2x2
+fine bins (and their Sumw2 when present) into one coarse bin, until an axis
+would drop below the configured minimum or its bin count becomes odd. The
+levels are rebuilt lazily whenever the entry count of the source changed, so
+the incremental cost of serving a coarse view of a live histogram is one
+aggregation pass, geometric in the level sizes (~1/3 of the source on top).
+
+Register the pyramid next to the histogram and let clients pick the
+resolution matching their viewport through the binary method-execution
+request of THttpServer:
+~~~ {.cpp}
+auto pyramid = new THistPyramid(hmap);
+serv->Register("/maps", pyramid);
+// client side, e.g. from JSROOT:
+//   maps/hmap_pyramid/exe.bin?method=GetView&maxnx=512&maxny=512
+~~~
+The reply is a regular streamed TH2D which JSROOT draws like any histogram;
+a zoom-in simply requests a larger maxnx/maxny (level 0 returns the source
+itself). exe.json can be used instead of exe.bin for textual transfer.
+*/
+
+ClassImp(THistPyramid);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Normal constructor. The source histogram is not owned and must outlive the
+/// pyramid. The default name appends "_pyramid" to the histogram name.
+
+THistPyramid::THistPyramid(TH2 *hist, const char *name)
+   : TNamed(name ? name : TString::Format("%s_pyramid", hist ? hist->GetName() : "none").Data(),
+            "multi-resolution histogram pyramid"),
+     fHist(hist)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rebuild the aggregated levels when the entry count of the source changed
+/// since the last build
+
+void THistPyramid::Update()
+{
+   if (!fHist)
+      return;
+   if (!fLevels.empty() || fEntries >= 0.) {
+      if (fHist->GetEntries() == fEntries)
+         return;
+   }
+   BuildLevels();
+   fEntries = fHist->GetEntries();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Aggregate the source into the pyramid levels. Level i+1 is produced from
+/// level i by summing 2x2 bins, so the total work is geometric in the sizes.
+
+void THistPyramid::BuildLevels()
+{
+   fLevels.clear();
+   const TH2 *src = fHist;
+   int level = 1;
+   while (src) {
+      const int nx = src->GetNbinsX();
+      const int ny = src->GetNbinsY();
+      // halving requires even bin counts and must not undershoot the minimum
+      if ((nx % 2) || (ny % 2) || (nx / 2 < fMinBins) || (ny / 2 < fMinBins))
+         break;
+      const int cnx = nx / 2, cny = ny / 2;
+      auto coarse = std::make_unique<TH2D>(TString::Format("%s_l%d", GetName(), level).Data(), fHist->GetTitle(), cnx,
+                                           src->GetXaxis()->GetXmin(), src->GetXaxis()->GetXmax(), cny,
+                                           src->GetYaxis()->GetXmin(), src->GetYaxis()->GetXmax());
+      coarse->SetDirectory(nullptr);
+      const bool sumw2 = src->GetSumw2N() > 0;
+      if (sumw2)
+         coarse->Sumw2();
+      // interior bins: sum the 2x2 block; under/overflows map one to one
+      for (int iy = 0; iy <= cny + 1; ++iy) {
+         const int fy0 = (iy == 0) ? 0 : (iy == cny + 1) ? ny + 1 : 2 * iy - 1;
+         const int fy1 = (iy >= 1 && iy <= cny) ? fy0 + 1 : fy0;
+         for (int ix = 0; ix <= cnx + 1; ++ix) {
+            const int fx0 = (ix == 0) ? 0 : (ix == cnx + 1) ? nx + 1 : 2 * ix - 1;
+            const int fx1 = (ix >= 1 && ix <= cnx) ? fx0 + 1 : fx0;
+            double sum = 0., err2 = 0.;
+            for (int fy = fy0; fy <= fy1; ++fy) {
+               for (int fx = fx0; fx <= fx1; ++fx) {
+                  sum += src->GetBinContent(fx, fy);
+                  if (sumw2) {
+                     const double err = src->GetBinError(fx, fy);
+                     err2 += err * err;
+                  }
+               }
+            }
+            coarse->SetBinContent(ix, iy, sum);
+            if (sumw2)
+               coarse->SetBinError(ix, iy, TMath::Sqrt(err2));
+         }
+      }
+      coarse->SetEntries(fHist->GetEntries());
+      src = coarse.get();
+      fLevels.emplace_back(std::move(coarse));
+      level++;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of available levels, the full-resolution source included
+
+Int_t THistPyramid::GetNlevels()
+{
+   Update();
+   return fLevels.size() + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Access one level: 0 is the source histogram, each following level halves
+/// the number of bins per axis. Out-of-range levels clamp to the coarsest.
+
+TH2 *THistPyramid::GetLevel(Int_t level)
+{
+   Update();
+   if (level <= 0 || fLevels.empty())
+      return fHist;
+   if (level > (Int_t)fLevels.size())
+      level = fLevels.size();
+   return fLevels[level - 1].get();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the finest level whose bin counts fit into the given viewport
+/// budget, falling back to the coarsest level when none does
+
+TH2 *THistPyramid::GetView(Int_t maxnx, Int_t maxny)
+{
+   Update();
+   if (!fHist)
+      return nullptr;
+   if (fHist->GetNbinsX() <= maxnx && fHist->GetNbinsY() <= maxny)
+      return fHist;
+   for (auto &level : fLevels)
+      if (level->GetNbinsX() <= maxnx && level->GetNbinsY() <= maxny)
+         return level.get();
+   return fLevels.empty() ? fHist : fLevels.back().get();
+}
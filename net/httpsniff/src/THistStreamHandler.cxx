@@ -0,0 +1,190 @@
+// $Id$
+// Author: ROOT team   28/08/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THistStreamHandler.h"
+
+#include "TH1.h"
+#include "RZip.h"
+#include "Compression.h"
+
+#include <algorithm>
+#include <cstring>
+
+/** \class THistStreamHandler
+\ingroup http
+
+Websocket handler which streams histogram updates as binary deltas.
+
+For every connected client the handler keeps a shadow copy of the bin
+contents last sent to it. StreamUpdates() compares the histograms against
+each client's shadow and sends only the changed contiguous bin ranges as a
+packed binary frame, zstd-compressed when that pays off, so a monitoring
+client polling hundreds of mostly-static histograms receives a few bytes
+instead of a full JSON conversion per histogram.
+
+Each frame carries the textual header `HSTR:<histname>:<rawlen>` followed by
+the payload: repeated records of `Int_t start, Int_t count, Double_t
+values[count]` over the flat cell index (underflow and overflow included).
+A payload shorter than `<rawlen>` is a ROOT compression frame and has to be
+inflated first. A newly connected client, or one that sends the text command
+`reset`, receives the full contents in the next frame.
+
+Typical use in a DQM application:
+~~~ {.cpp}
+auto handler = std::make_shared<THistStreamHandler>("histstream", "live histograms");
+handler->AddHist(hpx);
+serv->RegisterWS(handler);
+// from the event loop or a 1 Hz TTimer:
+handler->StreamUpdates();
+~~~
+*/
+
+ClassImp(THistStreamHandler);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Normal constructor
+
+THistStreamHandler::THistStreamHandler(const char *name, const char *title) : THttpWSHandler(name, title)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register a histogram for streaming; the histogram is not owned and must
+/// outlive the handler or be removed with RemoveHist()
+
+void THistStreamHandler::AddHist(TH1 *hist)
+{
+   if (hist && (std::find(fHists.begin(), fHists.end(), hist) == fHists.end()))
+      fHists.emplace_back(hist);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove a histogram from streaming
+
+void THistStreamHandler::RemoveHist(TH1 *hist)
+{
+   fHists.erase(std::remove(fHists.begin(), fHists.end(), hist), fHists.end());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pack the cells of hist which differ from the shadow copy into contiguous
+/// ranges and bring the shadow up to date. Returns an empty string when
+/// nothing changed. A shadow of the wrong size (first contact or rebinned
+/// histogram) produces a single range with the full contents.
+
+std::string THistStreamHandler::BuildFrame(TH1 *hist, std::vector<Double_t> &shadow)
+{
+   Int_t ncells = hist->GetNcells();
+   Bool_t full = (Int_t) shadow.size() != ncells;
+   if (full)
+      shadow.assign(ncells, 0.);
+
+   std::string raw;
+   Int_t start = -1;
+
+   auto flush = [&](Int_t endExcl) {
+      if (start < 0)
+         return;
+      Int_t count = endExcl - start;
+      raw.append(reinterpret_cast<const char *>(&start), sizeof(Int_t));
+      raw.append(reinterpret_cast<const char *>(&count), sizeof(Int_t));
+      raw.append(reinterpret_cast<const char *>(shadow.data() + start), count * sizeof(Double_t));
+      start = -1;
+   };
+
+   for (Int_t i = 0; i < ncells; ++i) {
+      Double_t v = hist->GetBinContent(i);
+      if (full || (v != shadow[i])) {
+         shadow[i] = v;
+         if (start < 0)
+            start = i;
+      } else {
+         flush(i);
+      }
+   }
+   flush(ncells);
+
+   return raw;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Send the changed bin ranges of all registered histograms to all connected
+/// clients; a histogram without changes produces no frame for that client
+
+void THistStreamHandler::StreamUpdates()
+{
+   for (auto &client : fClients) {
+      for (auto hist : fHists) {
+         auto &shadow = client.fShadow[hist->GetName()];
+         std::string raw = BuildFrame(hist, shadow);
+         if (raw.empty())
+            continue;
+
+         std::string hdr = std::string("HSTR:") + hist->GetName() + ":" + std::to_string(raw.length());
+
+         if ((fCompress > 0) && (raw.length() > 64) && (raw.length() < (size_t) kMAXZIPBUF)) {
+            int srcsize = raw.length();
+            int tgtsize = srcsize + 9; // leave room for the ROOT compression frame header
+            std::vector<char> zbuf(tgtsize);
+            int zipsize = 0;
+            R__zipMultipleAlgorithm(fCompress, &srcsize, const_cast<char *>(raw.data()), &tgtsize, zbuf.data(),
+                                    &zipsize, ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+            if ((zipsize > 0) && (zipsize < (int) raw.length())) {
+               SendHeaderWS(client.fWSId, hdr.c_str(), zbuf.data(), zipsize);
+               continue;
+            }
+         }
+
+         SendHeaderWS(client.fWSId, hdr.c_str(), raw.data(), raw.length());
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Handle websocket lifecycle; the only recognized client command is the
+/// text message `reset`, which drops the client's shadow state so the next
+/// StreamUpdates() resends the full contents
+
+Bool_t THistStreamHandler::ProcessWS(THttpCallArg *arg)
+{
+   if (!arg || (arg->GetWSId() == 0))
+      return kTRUE;
+
+   if (arg->IsMethod("WS_CONNECT"))
+      return kTRUE; // accept all clients
+
+   if (arg->IsMethod("WS_READY")) {
+      Client_t client;
+      client.fWSId = arg->GetWSId();
+      fClients.emplace_back(std::move(client));
+      return kTRUE;
+   }
+
+   if (arg->IsMethod("WS_CLOSE")) {
+      UInt_t wsid = arg->GetWSId();
+      fClients.erase(std::remove_if(fClients.begin(), fClients.end(),
+                                    [wsid](const Client_t &client) { return client.fWSId == wsid; }),
+                     fClients.end());
+      return kTRUE;
+   }
+
+   if (arg->IsMethod("WS_DATA")) {
+      std::string cmd(static_cast<const char *>(arg->GetPostData()), arg->GetPostDataLength());
+      if (cmd == "reset") {
+         for (auto &client : fClients)
+            if (client.fWSId == arg->GetWSId())
+               client.fShadow.clear();
+      }
+      return kTRUE;
+   }
+
+   return kFALSE;
+}
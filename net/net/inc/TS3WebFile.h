@@ -86,6 +86,8 @@ protected:
    // Data members
    TS3HTTPRequest fS3Request;      // S3 HTTP request
    Bool_t         fUseMultiRange;  // Is the S3 server capable of serving multirange requests?
+   Long64_t       fCoalesceGap;    // Maximum gap (in bytes) between byte ranges coalesced into a single ranged GET
+   Long64_t       fCoalesceSize;   // Maximum size (in bytes) of a coalesced ranged GET
 
 public:
    // Constructors & Destructor
@@ -67,9 +67,29 @@ http://docs.amazonwebservices.com/AmazonS3/latest/dev/Welcome.html
 #include "TPRegexp.h"
 #include "TEnv.h"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
 
 ClassImp(TS3WebFile);
 
+namespace {
+   // Credentials already used for a given host, so that subsequent files
+   // opened from the same server can be accessed without repeating the
+   // AUTH option and without the environmental variables being set.
+   struct S3Credentials {
+      TString fAccessKey;
+      TString fSecretKey;
+      TString fToken;
+   };
+   std::mutex gS3CredentialCacheMutex;
+   std::map<TString, S3Credentials> gS3CredentialCache;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Construct a TS3WebFile object. The path argument is a URL of one of the
 /// following forms:
@@ -201,6 +221,23 @@ TS3WebFile::TS3WebFile(const char* path, Option_t* options)
       GetCredentialsFromEnv(kAccessKeyEnv, kSecretKeyEnv, kSessionToken,
          accessKey, secretKey, token);
 
+   // If we still have no credentials, reuse the ones already used for this
+   // host, if any. Conversely, if we do have credentials, remember them for
+   // the next file opened from this host.
+   {
+      std::lock_guard<std::mutex> lock(gS3CredentialCacheMutex);
+      if (accessKey.IsNull() || secretKey.IsNull()) {
+         auto cached = gS3CredentialCache.find(fUrl.GetHost());
+         if (cached != gS3CredentialCache.end()) {
+            accessKey = cached->second.fAccessKey;
+            secretKey = cached->second.fSecretKey;
+            token = cached->second.fToken;
+         }
+      } else {
+         gS3CredentialCache[fUrl.GetHost()] = S3Credentials{accessKey, secretKey, token};
+      }
+   }
+
    // Initialize the S3 HTTP request
    fS3Request.SetHost(fUrl.GetHost());
    if (accessKey.IsNull() || secretKey.IsNull()) {
@@ -226,6 +263,12 @@ TS3WebFile::TS3WebFile(const char* path, Option_t* options)
    // later in the initialization process
    fUseMultiRange = kFALSE;
 
+   // Coalesce nearby byte ranges into a single ranged GET: object stores
+   // typically pay a large first-byte latency per request, so fetching a
+   // small gap of unused bytes is cheaper than issuing a second request.
+   fCoalesceGap = gEnv->GetValue("TS3WebFile.CoalesceGap", 65536);
+   fCoalesceSize = gEnv->GetValue("TS3WebFile.CoalesceSize", 8388608);
+
    // Call super-class initializer
    TWebFile::Init(kFALSE);
 
@@ -307,27 +350,74 @@ void TS3WebFile::SetMsgReadBuffer10(const char* redirectLocation, Bool_t tempRed
 
 
 ////////////////////////////////////////////////////////////////////////////////
+/// Overwrites TWebFile::ReadBuffers() for reading specified byte ranges.
+/// According to the kind of server this file is hosted by, we use a single
+/// HTTP request with a multi-range header or we generate a minimal number of
+/// single-range requests by coalescing nearby ranges: the few unused bytes
+/// between two close ranges are cheaper to fetch than the first-byte latency
+/// of a second request. The maximum tolerated gap and the maximum size of a
+/// coalesced request can be tuned (in bytes) with the TS3WebFile.CoalesceGap
+/// and TS3WebFile.CoalesceSize configuration values.
 
 Bool_t TS3WebFile::ReadBuffers(char* buf, Long64_t* pos, Int_t* len, Int_t nbuf)
 {
-   // Overwrites TWebFile::ReadBuffers() for reading specified byte ranges.
-   // According to the kind of server this file is hosted by, we use a
-   // single HTTP request with a muti-range header or we generate multiple
-   // requests with a single range each.
-
    // Does this server support multi-range GET requests?
    if (fUseMultiRange)
       return TWebFile::ReadBuffers(buf, pos, len, nbuf);
 
-   // Send multiple GET requests with a single range of bytes
-   // Adapted from original version by Wang Lu
-   for (Int_t i=0, offset=0; i < nbuf; i++) {
-      TString rangeHeader = TString::Format("Range: bytes=%lld-%lld\r\n\r\n",
-         pos[i], pos[i] + len[i] - 1);
-      TString s3Request = fS3Request.GetRequest(TS3HTTPRequest::kGET, kFALSE) + rangeHeader;
-      if (GetFromWeb10(&buf[offset], len[i], s3Request) == -1)
-         return kTRUE;
-      offset += len[i];
+   if (nbuf <= 0)
+      return kFALSE;
+
+   // Compute the offset of each requested range in the output buffer
+   std::vector<Long64_t> outOffset(nbuf + 1);
+   outOffset[0] = 0;
+   for (Int_t i = 0; i < nbuf; i++)
+      outOffset[i + 1] = outOffset[i] + len[i];
+
+   // Sort the requested ranges by file position
+   std::vector<Int_t> index(nbuf);
+   std::iota(index.begin(), index.end(), 0);
+   std::sort(index.begin(), index.end(), [&pos](Int_t a, Int_t b) { return pos[a] < pos[b]; });
+
+   // Group ranges separated by at most fCoalesceGap bytes and issue one
+   // single-range GET request per group
+   std::vector<char> block;
+   for (Int_t first = 0; first < nbuf;) {
+      Int_t last = first;
+      Long64_t blockStart = pos[index[first]];
+      Long64_t blockEnd = blockStart + len[index[first]];
+      while (last + 1 < nbuf) {
+         Int_t next = index[last + 1];
+         Long64_t nextEnd = pos[next] + len[next];
+         if (pos[next] - blockEnd > fCoalesceGap || std::max(blockEnd, nextEnd) - blockStart > fCoalesceSize)
+            break;
+         blockEnd = std::max(blockEnd, nextEnd);
+         last++;
+      }
+
+      if (first == last) {
+         // A single range: read it directly into the output buffer.
+         // Adapted from original version by Wang Lu
+         Int_t i = index[first];
+         TString rangeHeader = TString::Format("Range: bytes=%lld-%lld\r\n\r\n",
+            pos[i], pos[i] + len[i] - 1);
+         TString s3Request = fS3Request.GetRequest(TS3HTTPRequest::kGET, kFALSE) + rangeHeader;
+         if (GetFromWeb10(&buf[outOffset[i]], len[i], s3Request) == -1)
+            return kTRUE;
+      } else {
+         // Several nearby ranges: fetch the enclosing span with one request
+         // and scatter the pieces into the output buffer
+         block.resize(blockEnd - blockStart);
+         TString rangeHeader = TString::Format("Range: bytes=%lld-%lld\r\n\r\n", blockStart, blockEnd - 1);
+         TString s3Request = fS3Request.GetRequest(TS3HTTPRequest::kGET, kFALSE) + rangeHeader;
+         if (GetFromWeb10(block.data(), (Int_t)(blockEnd - blockStart), s3Request) == -1)
+            return kTRUE;
+         for (Int_t j = first; j <= last; j++) {
+            Int_t i = index[j];
+            memcpy(&buf[outOffset[i]], &block[pos[i] - blockStart], len[i]);
+         }
+      }
+      first = last + 1;
    }
    return kFALSE;
 }
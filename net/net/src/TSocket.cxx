@@ -633,6 +633,38 @@ Int_t TSocket::SendRaw(const void *buffer, Int_t length, ESendRecvOptions opt)
    return nsent;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Send several raw buffers in order with a single scatter-gather write
+/// where the platform supports it, avoiding the user-space concatenation of
+/// multi-segment payloads. Returns the total number of bytes sent or -1 in
+/// case of error. Returns -4 in case of kNoBlock and errno == EWOULDBLOCK.
+/// Returns -5 if pipe broken or reset by peer (EPIPE || ECONNRESET).
+
+Int_t TSocket::SendRawV(const void *const *buffers, const Int_t *lengths, Int_t nbufs,
+                        ESendRecvOptions opt)
+{
+   TSystem::ResetErrno();
+
+   if (!IsValid()) return -1;
+
+   ResetBit(TSocket::kBrokenConn);
+   Int_t nsent;
+   if ((nsent = gSystem->SendRawV(fSocket, buffers, lengths, nbufs, (int) opt)) <= 0) {
+      if (nsent == -5) {
+         // Connection reset or broken: close
+         MarkBrokenConnection();
+      }
+      return nsent;
+   }
+
+   fBytesSent  += nsent;
+   fgBytesSent += nsent;
+
+   Touch();  // update usage timestamp
+
+   return nsent;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Check if TStreamerInfo must be sent. The list of TStreamerInfo of classes
 /// in the object in the message is in the fInfos list of the message.
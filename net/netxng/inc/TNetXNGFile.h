@@ -22,11 +22,14 @@
 #include "TFile.h"
 #include "TSemaphore.h"
 
+#include <vector>
+
 namespace XrdCl {
    class File;
    class URL;
 }
 class XrdSysCondVar;
+class TNetXNGReadvRequest;
 
 
 /// Enables access to XRootD files using the new client.
@@ -41,6 +44,9 @@ private:
    Int_t                   fReadvIovMax; // Max number of readv chunks
    Int_t                   fQueryReadVParams;
    TString                 fNewUrl;
+   std::vector<TNetXNGReadvRequest *> fPendingReadvs; // In-flight pipelined vector reads
+   std::vector<Double_t>   fReadvLatencies; // Submit-to-completion wall time of recent requests
+   Int_t                   fNextReadvId;    // Id handed to the next submitted vector read
 
 public:
    TNetXNGFile();
@@ -64,6 +70,10 @@ public:
    Bool_t   ReadBuffer(char *buffer, Long64_t position, Int_t length) override;
    Bool_t   ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
                         Int_t nbuffs) override;
+   Int_t    SubmitReadBuffers(char *buffer, Long64_t *position, Int_t *length,
+                              Int_t nbuffs);
+   Bool_t   WaitReadBuffers(Int_t requestId);
+   const std::vector<Double_t> &GetReadvLatencies() const { return fReadvLatencies; }
    TString  GetNewUrl() override { return fNewUrl; }
 
 private:
@@ -117,6 +117,26 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
       TSemaphore                        *fSemaphore;   // Synchronize the responses
 };
 
+//------------------------------------------------------------------------------
+// State of one pipelined vector read, from submission to completion
+////////////////////////////////////////////////////////////////////////////////
+
+class TNetXNGReadvRequest
+{
+   public:
+      TNetXNGReadvRequest(Int_t id, size_t nChunkLists):
+         fId(id), fSemaphore(0), fStatuses(nChunkLists), fNIssued(0),
+         fTotalBytes(0), fFirstPosition(0), fStart(0) {}
+
+      Int_t                             fId;            // Id returned by SubmitReadBuffers
+      TSemaphore                        fSemaphore;     // Posted once per completed chunk list
+      std::vector<XrdCl::XRootDStatus*> fStatuses;      // One status per chunk list
+      Int_t                             fNIssued;       // Chunk lists actually sent to the server
+      Int_t                             fTotalBytes;    // Requested bytes, for the byte counters
+      Long64_t                          fFirstPosition; // Offset of the first chunk, for perf stats
+      Double_t                          fStart;         // Submission time
+};
+
 
 ClassImp(TNetXNGFile);
 
@@ -127,7 +147,8 @@ TNetXNGFile::TNetXNGFile()
      fMode(XrdCl::OpenFlags::None),
      fInitCondVar(nullptr),
      fReadvIorMax(0),
-     fReadvIovMax(0)
+     fReadvIovMax(0),
+     fNextReadvId(0)
 {
 }
 
@@ -177,6 +198,7 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
    fQueryReadVParams = 1;
    fReadvIorMax = 2097136;
    fReadvIovMax = 1024;
+   fNextReadvId = 0;
 
    if (ParseOpenMode(mode, fOption, fMode, kTRUE)<0) {
       Error("Open", "could not parse open mode %s", mode);
@@ -342,6 +364,10 @@ void TNetXNGFile::Close(const Option_t */*option*/)
 
    if (!fFile) return;
 
+   // Drain reads still in flight before tearing down the client object
+   while (!fPendingReadvs.empty())
+      WaitReadBuffers(fPendingReadvs.front()->fId);
+
    XrdCl::XRootDStatus status = fFile->Close();
    if (!status.IsOK()) {
       Error("Close", "%s", status.ToStr().c_str());
@@ -486,23 +512,50 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
 
 Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       Int_t nbuffs)
+{
+   Int_t requestId = SubmitReadBuffers(buffer, position, length, nbuffs);
+   if (requestId < 0)
+      return kTRUE;
+   return WaitReadBuffers(requestId);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Submit a scattered read without waiting for its completion
+///
+/// The request is sent to the server immediately and the response is consumed
+/// by the client's polling threads, so several requests can be in flight at
+/// once and the data of one request can be unpacked while the next ones are
+/// on the wire. Each submission must be paired with a WaitReadBuffers() call
+/// before the target buffer is read; ReadBuffers() is the degenerate
+/// submit-then-wait case. TTreeCache style prefetchers can submit the next
+/// cache fill ahead of the current one to keep the link busy.
+///
+/// param buffer:   a pointer to a buffer big enough to hold all of the
+///                 requested data; must stay valid until WaitReadBuffers()
+/// param position: position[i] is the seek position of chunk i of len
+///                 length[i]
+/// param length:   length[i] is the length of the chunk at offset
+///                 position[i]
+/// param nbuffs:   number of chunks
+/// returns:        the request id to pass to WaitReadBuffers(), or -1 in
+///                 case of failure
+
+Int_t TNetXNGFile::SubmitReadBuffers(char *buffer, Long64_t *position,
+      Int_t *length, Int_t nbuffs)
 {
    using namespace XrdCl;
 
    // Check the file isn't a zombie or closed
    if (!IsUseable())
-      return kTRUE;
+      return -1;
 
    std::vector<ChunkList>      chunkLists;
    ChunkList                   chunks;
-   std::vector<XRootDStatus*> *statuses;
-   TSemaphore                 *semaphore;
    Int_t                       totalBytes = 0;
    Long64_t                    offset     = 0;
    char                       *cursor     = buffer;
 
-   Double_t start = 0;
-   if (gPerfStats) start = TTimeStamp();
+   Double_t start = TTimeStamp();
 
    if (fArchiveOffset)
       for (Int_t i = 0; i < nbuffs; i++)
@@ -549,65 +602,106 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if( !chunks.empty() )
       chunkLists.push_back(chunks);
 
-   TAsyncReadvHandler *handler;
-   XRootDStatus        status;
-   semaphore = new TSemaphore(0);
-   statuses  = new std::vector<XRootDStatus*>(chunkLists.size());
+   TNetXNGReadvRequest *request = new TNetXNGReadvRequest(fNextReadvId++,
+                                                          chunkLists.size());
+   request->fTotalBytes    = totalBytes;
+   request->fFirstPosition = position[0];
+   request->fStart         = start;
 
-   // Read asynchronously but wait for all responses
+   // Send all chunk lists without waiting for the responses
+   XRootDStatus status;
    std::vector<ChunkList>::iterator it;
    for (it = chunkLists.begin(); it != chunkLists.end(); ++it)
    {
-      handler = new TAsyncReadvHandler(statuses, it - chunkLists.begin(),
-                                       semaphore);
+      TAsyncReadvHandler *handler =
+         new TAsyncReadvHandler(&request->fStatuses, it - chunkLists.begin(),
+                                &request->fSemaphore);
       status = fFile->VectorRead(*it, 0, handler);
 
       if (!status.IsOK()) {
-         Error("ReadBuffers", "%s", status.ToStr().c_str());
-         return kTRUE;
+         Error("SubmitReadBuffers", "%s", status.ToStr().c_str());
+         delete handler;
+         break;
       }
+      request->fNIssued++;
    }
 
-   // Wait for all responses
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      semaphore->Wait();
+   fPendingReadvs.push_back(request);
+   if (request->fNIssued != (Int_t) chunkLists.size()) {
+      // Keep the partially submitted request so WaitReadBuffers() can drain
+      // the responses already on the wire and report the failure
+      WaitReadBuffers(request->fId);
+      return -1;
    }
+   return request->fId;
+}
 
-   // Check for errors
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      XRootDStatus *st = statuses->at(it - chunkLists.begin());
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the completion of a read submitted with SubmitReadBuffers()
+///
+/// The wall-clock time between submission and completion is appended to the
+/// latency record available through GetReadvLatencies().
+///
+/// param requestId: the id returned by SubmitReadBuffers()
+/// returns:         kTRUE in case of failure
 
-      if (!st->IsOK()) {
-         Error("ReadBuffers", "%s", st->ToStr().c_str());
-         for( ; it != chunkLists.end(); ++it )
-         {
-            st = statuses->at( it - chunkLists.begin() );
-            delete st;
-         }
-         delete statuses;
-         delete semaphore;
+Bool_t TNetXNGFile::WaitReadBuffers(Int_t requestId)
+{
+   using namespace XrdCl;
 
-         return kTRUE;
+   TNetXNGReadvRequest *request = nullptr;
+   for (auto it = fPendingReadvs.begin(); it != fPendingReadvs.end(); ++it) {
+      if ((*it)->fId == requestId) {
+         request = *it;
+         fPendingReadvs.erase(it);
+         break;
+      }
+   }
+   if (!request) {
+      Error("WaitReadBuffers", "unknown request id %d", requestId);
+      return kTRUE;
+   }
+
+   // Wait for the responses of all chunk lists that made it to the server
+   for (Int_t i = 0; i < request->fNIssued; ++i)
+      request->fSemaphore.Wait();
+
+   // Check for errors; statuses of never-issued chunk lists stay null
+   Bool_t failed = request->fNIssued != (Int_t) request->fStatuses.size();
+   for (Int_t i = 0; i < request->fNIssued; ++i) {
+      XRootDStatus *st = request->fStatuses[i];
+      if (!st->IsOK()) {
+         Error("WaitReadBuffers", "%s", st->ToStr().c_str());
+         failed = kTRUE;
       }
       delete st;
    }
 
+   Double_t latency = TTimeStamp() - request->fStart;
+   fReadvLatencies.push_back(latency);
+   if (fReadvLatencies.size() > 64)
+      fReadvLatencies.erase(fReadvLatencies.begin());
+
+   if (failed) {
+      delete request;
+      return kTRUE;
+   }
+
    // Bump the globals
-   fBytesRead  += totalBytes;
-   fgBytesRead += totalBytes;
+   fBytesRead  += request->fTotalBytes;
+   fgBytesRead += request->fTotalBytes;
    fReadCalls  ++;
    fgReadCalls ++;
 
    if (gPerfStats) {
-      fOffset = position[0];
-      gPerfStats->FileReadEvent(this, totalBytes, start);
+      fOffset = request->fFirstPosition;
+      gPerfStats->FileReadEvent(this, request->fTotalBytes, request->fStart);
    }
 
    if (gMonitoringWriter)
       gMonitoringWriter->SendFileReadProgress(this);
 
-   delete statuses;
-   delete semaphore;
+   delete request;
    return kFALSE;
 }
 
@@ -98,6 +98,23 @@ void cudaEventRecord(CudaEvent &event, CudaStream &stream)
    ERRCHECK(::cudaEventRecord(event, stream));
 }
 
+/**
+ * Checks whether the work captured by a recorded CUDA event has completed.
+ *
+ * @param[in] event           CudaEvent object representing the recorded event.
+ * @return                    True if all captured work has completed, false otherwise.
+ */
+bool cudaEventCompleted(CudaEvent &event)
+{
+   cudaError_t err = cudaEventQuery(event);
+   if (err == cudaErrorNotReady)
+      return false;
+   else if (err == cudaSuccess)
+      return true;
+   ERRCHECK(err);
+   return true;
+}
+
 /**
  * Creates a new CUDA stream.
  *
@@ -72,6 +72,7 @@ private:
 };
 
 void cudaEventRecord(CudaEvent &, CudaStream &);
+bool cudaEventCompleted(CudaEvent &);
 float cudaEventElapsedTime(CudaEvent &, CudaEvent &);
 
 /// \cond ROOFIT_INTERNAL
@@ -26,6 +26,8 @@ This file contains the code for cuda computations using the RooBatchCompute libr
 #include <cassert>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <vector>
 
@@ -81,6 +83,75 @@ int getGridSize(std::size_t n)
    return std::min(int(std::ceil(double(n) / blockSize)), maxGridSize);
 }
 
+/// A pinned-host/device staging pair for the packed kernel arguments (the
+/// Batches struct, the Batch array, the scalar values and the extra args),
+/// together with the CUDA event that tells when the upload and the kernel that
+/// used it have completed.
+class ArgPackBuffer {
+public:
+   ArgPackBuffer(std::size_t capacity) : _host{capacity}, _device{capacity}, _event{/*forTiming=*/false} {}
+
+   std::size_t capacity() const { return _host.size(); }
+   char *host() { return _host.data(); }
+   char *device() { return _device.data(); }
+
+   void recordUse(CudaInterface::CudaStream &stream)
+   {
+      CudaInterface::cudaEventRecord(_event, stream);
+      _pendingUse = true;
+   }
+   bool isInUse()
+   {
+      if (_pendingUse && CudaInterface::cudaEventCompleted(_event))
+         _pendingUse = false;
+      return _pendingUse;
+   }
+
+private:
+   CudaInterface::PinnedHostArray<char> _host;
+   CudaInterface::DeviceArray<char> _device;
+   CudaInterface::CudaEvent _event;
+   bool _pendingUse = false;
+};
+
+/// Pool of ArgPackBuffer objects. Allocating pinned host and device memory is
+/// expensive and the argument pack is re-staged on every kernel launch, so
+/// instead of allocating per compute() call the staging pairs are reused
+/// across calls and minimizer iterations. A pooled pair is only handed out
+/// again once the asynchronous upload that last used it has completed, which
+/// keeps the host-side filling of the pinned buffer race-free.
+class ArgPackBufferPool {
+public:
+   std::unique_ptr<ArgPackBuffer> acquire(std::size_t memSize)
+   {
+      // Round up to the next power of two so that evaluations with slightly
+      // different numbers of variables or extra arguments share pool entries.
+      std::size_t capacity = 64;
+      while (capacity < memSize)
+         capacity *= 2;
+      std::lock_guard<std::mutex> guard{_mutex};
+      auto &queue = _pools[capacity];
+      if (!queue.empty() && !queue.front()->isInUse()) {
+         auto out = std::move(queue.front());
+         queue.pop();
+         return out;
+      }
+      // All pooled pairs of this capacity are still used by in-flight
+      // kernels: allocate a fresh one instead of stalling the host.
+      return std::make_unique<ArgPackBuffer>(capacity);
+   }
+
+   void release(std::unique_ptr<ArgPackBuffer> buffer)
+   {
+      std::lock_guard<std::mutex> guard{_mutex};
+      _pools[buffer->capacity()].push(std::move(buffer));
+   }
+
+private:
+   std::mutex _mutex;
+   std::map<std::size_t, std::queue<std::unique_ptr<ArgPackBuffer>>> _pools;
+};
+
 } // namespace
 
 std::vector<void (*)(Batches &)> getFunctions();
@@ -115,14 +186,13 @@ public:
       const std::size_t memSize = sizeof(Batches) + vars.size() * sizeof(Batch) + vars.size() * sizeof(double) +
                                   extraArgs.size() * sizeof(double);
 
-      std::vector<char> hostMem(memSize);
-      auto batches = reinterpret_cast<Batches *>(hostMem.data());
+      auto staging = _argPackBufferPool.acquire(memSize);
+      auto batches = reinterpret_cast<Batches *>(staging->host());
       auto arrays = reinterpret_cast<Batch *>(batches + 1);
       auto scalarBuffer = reinterpret_cast<double *>(arrays + vars.size());
       auto extraArgsHost = reinterpret_cast<double *>(scalarBuffer + vars.size());
 
-      DeviceArray<char> deviceMem(memSize);
-      auto batchesDevice = reinterpret_cast<Batches *>(deviceMem.data());
+      auto batchesDevice = reinterpret_cast<Batches *>(staging->device());
       auto arraysDevice = reinterpret_cast<Batch *>(batchesDevice + 1);
       auto scalarBufferDevice = reinterpret_cast<double *>(arraysDevice + vars.size());
       auto extraArgsDevice = reinterpret_cast<double *>(scalarBufferDevice + vars.size());
@@ -136,7 +206,7 @@ public:
          batches->extra = extraArgsDevice;
       }
 
-      copyHostToDevice(hostMem.data(), deviceMem.data(), hostMem.size(), cfg.cudaStream());
+      copyHostToDevice(staging->host(), staging->device(), memSize, cfg.cudaStream());
 
       const int gridSize = getGridSize(nEvents);
       _computeFunctions[computer]<<<gridSize, blockSize, 0, *cfg.cudaStream()>>>(*batchesDevice);
@@ -147,6 +217,11 @@ public:
       if (!extraArgs.empty()) {
          copyDeviceToHost(extraArgsDevice, extraArgs.data(), extraArgs.size(), cfg.cudaStream());
       }
+
+      // The upload and the kernel are asynchronous on the stream, so the
+      // staging pair can only be reused once they have completed.
+      staging->recordUse(*cfg.cudaStream());
+      _argPackBufferPool.release(std::move(staging));
    }
    /// Return the sum of an input array
    double reduceSum(RooBatchCompute::Config const &cfg, InputArr input, size_t n) override;
@@ -175,6 +250,7 @@ public:
 
 private:
    const std::vector<void (*)(Batches &)> _computeFunctions;
+   ArgPackBufferPool _argPackBufferPool;
 
 }; // End class RooBatchComputeClass
 
@@ -200,6 +200,140 @@ inline double broadcast(std::span<const double> const &s, std::size_t i)
    return s.size() > 1 ? s[i] : s[0];
 }
 
+/// Apply the contribution of one nuisance parameter with a scalar value to
+/// the full bin array. This is the hot loop of a HistFactory fit: instead of
+/// re-dispatching on the interpolation code and the sign of the parameter for
+/// every bin (like flexibleInterpSingle() does), the dispatch happens once per
+/// parameter and the bin loops are branch-free, so the compiler can vectorize
+/// them. The arithmetic per bin is identical to flexibleInterpSingle() with a
+/// boundary of 1.0.
+void interpolateScalarParam(int code, double x, std::span<const double> low, std::span<const double> high,
+                            std::span<const double> nominal, std::span<double> sum)
+{
+   const std::size_t n = sum.size();
+   const double boundary = 1.0;
+
+   switch (code) {
+   case 0: {
+      // piece-wise linear
+      if (x > 0) {
+         for (std::size_t j = 0; j < n; ++j) {
+            sum[j] += x * (broadcast(high, j) - broadcast(nominal, j));
+         }
+      } else {
+         for (std::size_t j = 0; j < n; ++j) {
+            sum[j] += x * (broadcast(nominal, j) - broadcast(low, j));
+         }
+      }
+      break;
+   }
+   case 1: {
+      // piece-wise log
+      if (x >= 0) {
+         for (std::size_t j = 0; j < n; ++j) {
+            sum[j] += sum[j] * (std::pow(broadcast(high, j) / broadcast(nominal, j), +x) - 1);
+         }
+      } else {
+         for (std::size_t j = 0; j < n; ++j) {
+            sum[j] += sum[j] * (std::pow(broadcast(low, j) / broadcast(nominal, j), -x) - 1);
+         }
+      }
+      break;
+   }
+   case 2: {
+      // parabolic with linear
+      if (x > 1) {
+         for (std::size_t j = 0; j < n; ++j) {
+            double hi = broadcast(high, j);
+            double lo = broadcast(low, j);
+            double nom = broadcast(nominal, j);
+            double a = 0.5 * (hi + lo) - nom;
+            double b = 0.5 * (hi - lo);
+            sum[j] += (2 * a + b) * (x - 1) + hi - nom;
+         }
+      } else if (x < -1) {
+         for (std::size_t j = 0; j < n; ++j) {
+            double hi = broadcast(high, j);
+            double lo = broadcast(low, j);
+            double nom = broadcast(nominal, j);
+            double a = 0.5 * (hi + lo) - nom;
+            double b = 0.5 * (hi - lo);
+            sum[j] += -1 * (2 * a - b) * (x + 1) + lo - nom;
+         }
+      } else {
+         for (std::size_t j = 0; j < n; ++j) {
+            double hi = broadcast(high, j);
+            double lo = broadcast(low, j);
+            double nom = broadcast(nominal, j);
+            double a = 0.5 * (hi + lo) - nom;
+            double b = 0.5 * (hi - lo);
+            sum[j] += a * x * x + b * x;
+         }
+      }
+      break;
+   }
+   case 4: {
+      if (x >= boundary) {
+         for (std::size_t j = 0; j < n; ++j) {
+            sum[j] += x * (broadcast(high, j) - broadcast(nominal, j));
+         }
+      } else if (x <= -boundary) {
+         for (std::size_t j = 0; j < n; ++j) {
+            sum[j] += x * (broadcast(nominal, j) - broadcast(low, j));
+         }
+      } else {
+         // interpolate 6th degree
+         double t = x / boundary;
+         double polyFac = t * (15 + t * t * (-10 + t * t * 3));
+         for (std::size_t j = 0; j < n; ++j) {
+            double nom = broadcast(nominal, j);
+            double epsPlus = broadcast(high, j) - nom;
+            double epsMinus = nom - broadcast(low, j);
+            double S = 0.5 * (epsPlus + epsMinus);
+            double A = 0.0625 * (epsPlus - epsMinus);
+            sum[j] += x * (S + polyFac * A);
+         }
+      }
+      break;
+   }
+   case 6: {
+      // multiplicative version of code 4
+      if (x >= boundary) {
+         for (std::size_t j = 0; j < n; ++j) {
+            double nom = broadcast(nominal, j);
+            sum[j] += x * (broadcast(high, j) / nom - 1.0) * sum[j];
+         }
+      } else if (x <= -boundary) {
+         for (std::size_t j = 0; j < n; ++j) {
+            double nom = broadcast(nominal, j);
+            sum[j] += x * (1.0 - broadcast(low, j) / nom) * sum[j];
+         }
+      } else {
+         double t = x / boundary;
+         double polyFac = t * (15 + t * t * (-10 + t * t * 3));
+         for (std::size_t j = 0; j < n; ++j) {
+            double nom = broadcast(nominal, j);
+            double epsPlus = broadcast(high, j) / nom - 1.0;
+            double epsMinus = 1.0 - broadcast(low, j) / nom;
+            double S = 0.5 * (epsPlus + epsMinus);
+            double A = 0.0625 * (epsPlus - epsMinus);
+            sum[j] += x * (S + polyFac * A) * sum[j];
+         }
+      }
+      break;
+   }
+   default: {
+      // code 5 (and unknown codes) branch on per-bin quantities, so there is
+      // nothing to hoist out of the loop
+      for (std::size_t j = 0; j < n; ++j) {
+         using RooFit::Detail::MathFuncs::flexibleInterpSingle;
+         sum[j] += flexibleInterpSingle(code, broadcast(low, j), broadcast(high, j), boundary, broadcast(nominal, j),
+                                        x, sum[j]);
+      }
+   }
+   }
+}
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +354,14 @@ void PiecewiseInterpolation::doEval(RooFit::EvalContext &ctx) const
       auto low = ctx.at(_lowSet.at(i));
       auto high = ctx.at(_highSet.at(i));
 
+      if (param.size() == 1) {
+         // the usual HistFactory case: the parameter is a scalar nuisance
+         // parameter, so the interpolation-code dispatch can be hoisted out of
+         // the bin loop
+         interpolateScalarParam(_interpCode[i], param[0], low, high, nominal, sum);
+         continue;
+      }
+
       for (std::size_t j = 0; j < sum.size(); ++j) {
          using RooFit::Detail::MathFuncs::flexibleInterpSingle;
          sum[j] += flexibleInterpSingle(_interpCode[i], broadcast(low, j), broadcast(high, j), 1.0, broadcast(nominal, j),
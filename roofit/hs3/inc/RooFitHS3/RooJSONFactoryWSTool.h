@@ -130,6 +130,9 @@ public:
    static std::unique_ptr<RooDataHist>
    readBinnedData(const RooFit::Detail::JSONNode &n, const std::string &namecomp, RooArgSet const &vars);
 
+   void setImportFilter(std::set<std::string> distributionNames);
+   std::set<std::string> const &importFilter() const { return _importFilter; }
+
    bool importJSON(std::string const &filename);
    bool importYML(std::string const &filename);
    bool importJSON(std::istream &os);
@@ -247,5 +250,6 @@ private:
    std::unique_ptr<RooFit::JSONIO::Detail::Domains> _domains;
    std::vector<RooAbsArg const *> _serversToExport;
    std::vector<RooAbsArg const *> _serversToDelete;
+   std::set<std::string> _importFilter;
 };
 #endif
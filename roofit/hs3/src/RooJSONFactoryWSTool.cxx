@@ -604,10 +604,6 @@ void importAnalysis(const JSONNode &rootnode, const JSONNode &analysisNode, cons
    if (workspace.obj(mcname))
       return;
 
-   workspace.import(RooStats::ModelConfig{mcname.c_str(), mcname.c_str()});
-   auto *mc = static_cast<RooStats::ModelConfig *>(workspace.obj(mcname));
-   mc->SetWS(workspace);
-
    std::vector<std::string> nllDataNames;
 
    auto *nllNode = RooJSONFactoryWSTool::findNamedChild(likelihoodsNode, analysisNode["likelihood"].val());
@@ -654,15 +650,30 @@ void importAnalysis(const JSONNode &rootnode, const JSONNode &analysisNode, cons
          RooCategory indexCat{indexCatName.c_str(), indexCatName.c_str()};
          std::map<std::string, RooAbsPdf *> pdfMap;
          for (std::size_t i = 0; i < nllDistNames.size(); ++i) {
-            indexCat.defineType(nllDistNames[i], i);
-            pdfMap[nllDistNames[i]] = workspace.pdf(nllDistNames[i]);
+            // Skip channels that are absent because of an import filter
+            if (RooAbsPdf *channelPdf = workspace.pdf(nllDistNames[i])) {
+               indexCat.defineType(nllDistNames[i], i);
+               pdfMap[nllDistNames[i]] = channelPdf;
+            }
+         }
+         if (!pdfMap.empty()) {
+            RooSimultaneous simPdf{simPdfName.c_str(), simPdfName.c_str(), pdfMap, indexCat};
+            workspace.import(simPdf, RooFit::RecycleConflictNodes(true), RooFit::Silence(true));
+            pdf = static_cast<RooSimultaneous *>(workspace.pdf(simPdfName));
          }
-         RooSimultaneous simPdf{simPdfName.c_str(), simPdfName.c_str(), pdfMap, indexCat};
-         workspace.import(simPdf, RooFit::RecycleConflictNodes(true), RooFit::Silence(true));
-         pdf = static_cast<RooSimultaneous *>(workspace.pdf(simPdfName));
       }
    }
 
+   if (!pdf) {
+      RooJSONFactoryWSTool::warning("pdf of analysis '" + analysisName +
+                                    "' is not available (it might have been excluded by an import filter), skipping");
+      return;
+   }
+
+   workspace.import(RooStats::ModelConfig{mcname.c_str(), mcname.c_str()});
+   auto *mc = static_cast<RooStats::ModelConfig *>(workspace.obj(mcname));
+   mc->SetWS(workspace);
+
    mc->SetPdf(*pdf);
 
    if (!extConstraints.empty())
@@ -745,8 +756,17 @@ void combinePdfs(const JSONNode &rootnode, RooWorkspace &ws)
       std::map<std::string, RooAbsPdf *> pdfMap;
 
       for (std::size_t iChannel = 0; iChannel < labels.size(); ++iChannel) {
-         indexCat.defineType(labels[iChannel], indices[iChannel]);
-         pdfMap[labels[iChannel]] = ws.pdf(pdfNames[iChannel]);
+         // Channels can be absent from the workspace if the import was
+         // restricted with RooJSONFactoryWSTool::setImportFilter(). The
+         // combined pdf is then built from the channels that are present.
+         if (RooAbsPdf *pdf = ws.pdf(pdfNames[iChannel])) {
+            indexCat.defineType(labels[iChannel], indices[iChannel]);
+            pdfMap[labels[iChannel]] = pdf;
+         }
+      }
+
+      if (pdfMap.empty()) {
+         continue;
       }
 
       RooSimultaneous simPdf{combinedName.c_str(), combinedName.c_str(), pdfMap, indexCat};
@@ -1724,16 +1744,42 @@ void RooJSONFactoryWSTool::importDependants(const JSONNode &n)
    }
    if (auto seq = n.find("functions")) {
       for (const auto &p : seq->children()) {
+         if (!_importFilter.empty() && _importFilter.find(RooJSONFactoryWSTool::name(p)) == _importFilter.end()) {
+            continue;
+         }
          this->importFunction(p, true);
       }
    }
    if (auto seq = n.find("distributions")) {
       for (const auto &p : seq->children()) {
+         if (!_importFilter.empty() && _importFilter.find(RooJSONFactoryWSTool::name(p)) == _importFilter.end()) {
+            continue;
+         }
          this->importFunction(p, true);
       }
    }
 }
 
+/**
+ * @brief Restrict the next import to a subset of the top-level distributions.
+ *
+ * By default, an import materializes the RooAbsArg graphs of all functions and
+ * distributions in the JSON data. For large combined workspaces this is
+ * expensive even if only a few channels are of interest. When a non-empty
+ * filter is set, only the named distributions (and, via the on-demand request
+ * mechanism, their dependants) are constructed. Combined distributions are
+ * built from the subset of their channels that got imported, and analyses
+ * whose pdf is not available are skipped. Pass an empty set to restore the
+ * default behavior of importing everything.
+ *
+ * @param distributionNames The names of the top-level distributions to import.
+ * @return void
+ */
+void RooJSONFactoryWSTool::setImportFilter(std::set<std::string> distributionNames)
+{
+   _importFilter = std::move(distributionNames);
+}
+
 void RooJSONFactoryWSTool::exportModelConfig(JSONNode &rootnode, RooStats::ModelConfig const &mc,
                                              const std::vector<CombinedData> &combDataSets)
 {
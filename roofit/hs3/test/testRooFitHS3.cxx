@@ -437,3 +437,43 @@ TEST(RooFitHS3, ScientificNotation)
    RooJSONFactoryWSTool t2(newws);
    ASSERT_TRUE(t2.importJSONfromString(jsonStr));
 }
+
+TEST(RooFitHS3, ImportFilter)
+{
+   // Create a two-channel RooSimultaneous and export it to JSON.
+   RooRealVar x("x", "x", -8, 8);
+   RooRealVar mean("mean", "mean", 0, -8, 8);
+   RooRealVar sigma("sigma", "sigma", 0.3, 0.1, 10);
+   RooGaussian model("model", "model", x, mean, sigma);
+   RooGaussian model_ctl("model_ctl", "model_ctl", x, mean, 0.3);
+   RooCategory sample("sample", "sample", {{"physics", 0}, {"control", 1}});
+   RooSimultaneous simPdf("simPdf", "simultaneous pdf", sample);
+   simPdf.addPdf(model, "physics");
+   simPdf.addPdf(model_ctl, "control");
+
+   RooWorkspace ws1;
+   ws1.import(simPdf);
+   const std::string json = RooJSONFactoryWSTool{ws1}.exportJSONtoString();
+
+   // Importing with a filter should only materialize the selected channel and
+   // its dependants, and build the combined pdf from that channel alone.
+   RooWorkspace ws2;
+   RooJSONFactoryWSTool tool{ws2};
+   tool.setImportFilter({"model"});
+   ASSERT_TRUE(tool.importJSONfromString(json));
+
+   EXPECT_NE(ws2.pdf("model"), nullptr);
+   EXPECT_EQ(ws2.pdf("model_ctl"), nullptr);
+
+   auto *simPdf2 = dynamic_cast<RooSimultaneous *>(ws2.pdf("simPdf"));
+   ASSERT_NE(simPdf2, nullptr);
+   EXPECT_NE(simPdf2->getPdf("physics"), nullptr);
+   EXPECT_EQ(simPdf2->getPdf("control"), nullptr);
+
+   // An empty filter restores the default behavior of importing everything.
+   RooWorkspace ws3;
+   RooJSONFactoryWSTool tool3{ws3};
+   tool3.setImportFilter({});
+   ASSERT_TRUE(tool3.importJSONfromString(json));
+   EXPECT_NE(ws3.pdf("model_ctl"), nullptr);
+}
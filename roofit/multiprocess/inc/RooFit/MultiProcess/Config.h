@@ -15,6 +15,7 @@
 
 #include "RooFit/MultiProcess/types.h"
 
+#include <string>
 #include <vector>
 #include <cstddef>  // std::size_t
 
@@ -47,6 +48,20 @@ public:
    private:
       static QueueType queueType_;
    };
+
+   struct Network {
+      enum class Transport {IPC, TCP};
+      static bool setTransport(Transport transport);
+      static Transport getTransport();
+      static bool setTcpHost(const std::string& host);
+      static std::string getTcpHost();
+      static bool setTcpBasePort(int port);
+      static int getTcpBasePort();
+   private:
+      static Transport transport_;
+      static std::string tcpHost_;
+      static int tcpBasePort_;
+   };
 private:
    static unsigned int defaultNWorkers_;
    static bool timingAnalysis_;
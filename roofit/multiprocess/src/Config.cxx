@@ -142,12 +142,75 @@ void Config::Queue::suggestTaskOrder(std::size_t job_id, const std::vector<Task>
    }
 }
 
+/// Set the transport used for the messenger connections between master,
+/// queue and workers.
+///
+/// By default, the processes communicate over ipc:// socket files in the
+/// temporary directory, which restricts all processes to a single host. With
+/// the TCP transport, the messenger endpoints become tcp:// sockets on a
+/// consecutive port range starting at the configured base port, so that
+/// workers on other hosts can reach them; this is the transport to use when
+/// scaling a fit beyond one machine. Like the number of workers, the
+/// transport cannot be changed after the JobManager has been instantiated.
+bool Config::Network::setTransport(Transport transport)
+{
+   if (JobManager::is_instantiated()) {
+      printf("Warning: cannot set RooFit::MultiProcess transport after JobManager has been instantiated!\n");
+      return false;
+   }
+   transport_ = transport;
+   return true;
+}
+
+Config::Network::Transport Config::Network::getTransport()
+{
+   return transport_;
+}
+
+/// Set the host name or address where the master process' TCP endpoints can
+/// be reached. Only used with the TCP transport.
+bool Config::Network::setTcpHost(const std::string& host)
+{
+   if (JobManager::is_instantiated()) {
+      printf("Warning: cannot set RooFit::MultiProcess TCP host after JobManager has been instantiated!\n");
+      return false;
+   }
+   tcpHost_ = host;
+   return true;
+}
+
+std::string Config::Network::getTcpHost()
+{
+   return tcpHost_;
+}
+
+/// Set the first port of the consecutive range used for the TCP messenger
+/// endpoints. Concurrent fits on the same host must use disjoint ranges.
+/// Only used with the TCP transport.
+bool Config::Network::setTcpBasePort(int port)
+{
+   if (JobManager::is_instantiated()) {
+      printf("Warning: cannot set RooFit::MultiProcess TCP base port after JobManager has been instantiated!\n");
+      return false;
+   }
+   tcpBasePort_ = port;
+   return true;
+}
+
+int Config::Network::getTcpBasePort()
+{
+   return tcpBasePort_;
+}
+
 // initialize static members
 unsigned int Config::defaultNWorkers_ = std::thread::hardware_concurrency();
 std::size_t Config::LikelihoodJob::defaultNEventTasks = Config::LikelihoodJob::automaticNEventTasks;
 std::size_t Config::LikelihoodJob::defaultNComponentTasks = Config::LikelihoodJob::automaticNComponentTasks;
 Config::Queue::QueueType Config::Queue::queueType_ = Config::Queue::QueueType::FIFO;
 bool Config::timingAnalysis_ = false;
+Config::Network::Transport Config::Network::transport_ = Config::Network::Transport::IPC;
+std::string Config::Network::tcpHost_ = "127.0.0.1";
+int Config::Network::tcpBasePort_ = 7777;
 
 } // namespace MultiProcess
 } // namespace RooFit
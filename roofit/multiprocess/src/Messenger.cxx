@@ -11,6 +11,7 @@
  * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
  */
 
+#include "RooFit/MultiProcess/Config.h"
 #include "RooFit/MultiProcess/Messenger.h"
 #include "RooFit/MultiProcess/util.h"
 
@@ -32,8 +33,11 @@ void set_socket_immediate(ZmqLingeringSocketPtr<> &socket)
  * \brief Manages ZeroMQ sockets and wraps send and receive calls
  *
  * This class is used for all interprocess communication between the master,
- * queue and worker processes. It sets up ZeroMQ sockets between all processes
- * over IPC socket files stored in /tmp on the filesystem.
+ * queue and worker processes. It sets up ZeroMQ sockets between all processes,
+ * by default over IPC socket files stored in /tmp on the filesystem. With
+ * 'Config::Network::setTransport' the sockets can instead be set up over TCP
+ * on a consecutive port range, making the endpoints reachable from other
+ * hosts.
  *
  * Several sockets are used for communication between different places for
  * different purposes:
@@ -69,6 +73,34 @@ Messenger::Messenger(const ProcessManager &process_manager)
       return "ipc://" + tmpPath + "/roofit_" + std::to_string(pid) + "_roofitMP";
    };
 
+   // Fixed channel numbering used for TCP port assignment; the per-worker
+   // channels are interleaved in pairs after the five singleton channels.
+   enum Channel : int {
+      kMasterToQueue = 0,
+      kQueueToMaster,
+      kMasterToWorkers,
+      kWorkersToMaster,
+      kSubscriberPing,
+      kFirstWorkerChannel
+   };
+
+   const bool useTcp = Config::Network::getTransport() == Config::Network::Transport::TCP;
+   const std::string tcpHost = Config::Network::getTcpHost();
+   const int tcpBasePort = Config::Network::getTcpBasePort();
+
+   auto bindAddress = [&](int channel, std::string const &ipcSuffix, pid_t pid) -> std::string {
+      if (useTcp) {
+         return "tcp://*:" + std::to_string(tcpBasePort + channel);
+      }
+      return makeAddrPrefix(pid) + ipcSuffix;
+   };
+   auto connectAddress = [&](int channel, std::string const &ipcSuffix, pid_t pid) -> std::string {
+      if (useTcp) {
+         return "tcp://" + tcpHost + ":" + std::to_string(tcpBasePort + channel);
+      }
+      return makeAddrPrefix(pid) + ipcSuffix;
+   };
+
    // high water mark for master-queue sending, which can be quite a busy channel, especially at the start of a run
    int hwm = 0;
    // create zmq connections and pollers where necessary
@@ -77,34 +109,34 @@ Messenger::Messenger(const ProcessManager &process_manager)
    // constructor.
    try {
       if (process_manager.is_master()) {
-         auto addrBase = makeAddrPrefix(getpid());
+         auto pid = getpid();
 
          mq_push_.reset(zmqSvc().socket_ptr(zmq::socket_type::push));
          mq_push_->set(zmq::sockopt::sndhwm, hwm);
-         bindAddr(mq_push_, addrBase + "_from_master_to_queue");
+         bindAddr(mq_push_, bindAddress(kMasterToQueue, "_from_master_to_queue", pid));
 
          mq_push_poller_.register_socket(*mq_push_, zmq::event_flags::pollout);
 
          mq_pull_.reset(zmqSvc().socket_ptr(zmq::socket_type::pull));
          mq_pull_->set(zmq::sockopt::rcvhwm, hwm);
-         bindAddr(mq_pull_, addrBase + "_from_queue_to_master");
+         bindAddr(mq_pull_, bindAddress(kQueueToMaster, "_from_queue_to_master", pid));
 
          mq_pull_poller_.register_socket(*mq_pull_, zmq::event_flags::pollin);
 
          mw_pub_.reset(zmqSvc().socket_ptr(zmq::socket_type::pub));
          mw_pub_->set(zmq::sockopt::sndhwm, hwm);
-         bindAddr(mw_pub_, addrBase + "_from_master_to_workers");
+         bindAddr(mw_pub_, bindAddress(kMasterToWorkers, "_from_master_to_workers", pid));
 
          wm_pull_.reset(zmqSvc().socket_ptr(zmq::socket_type::pull));
          wm_pull_->set(zmq::sockopt::rcvhwm, hwm);
-         bindAddr(wm_pull_, addrBase + "_from_workers_to_master");
+         bindAddr(wm_pull_, bindAddress(kWorkersToMaster, "_from_workers_to_master", pid));
          wm_pull_poller_.register_socket(*wm_pull_, zmq::event_flags::pollin);
 
          close_MQ_on_destruct_ = true;
 
          // make sure all subscribers are connected
          ZmqLingeringSocketPtr<> subscriber_ping_socket{zmqSvc().socket_ptr(zmq::socket_type::pull)};
-         bindAddr(subscriber_ping_socket, addrBase + "_subscriber_ping_socket");
+         bindAddr(subscriber_ping_socket, bindAddress(kSubscriberPing, "_subscriber_ping_socket", pid));
          ZeroMQPoller subscriber_ping_poller;
          subscriber_ping_poller.register_socket(*subscriber_ping_socket, zmq::event_flags::pollin);
          std::size_t N_subscribers_confirmed = 0;
@@ -120,7 +152,7 @@ Messenger::Messenger(const ProcessManager &process_manager)
          zmqSvc().send(*mw_pub_, true);
 
       } else if (process_manager.is_queue()) {
-         auto addrBase = makeAddrPrefix(getppid());
+         auto pid = getppid();
 
          // first the queue-worker sockets
          // do resize instead of reserve so that the unique_ptrs are initialized
@@ -133,13 +165,15 @@ Messenger::Messenger(const ProcessManager &process_manager)
          for (std::size_t ix = 0; ix < process_manager.N_workers(); ++ix) {
             // push
             qw_push_[ix].reset(zmqSvc().socket_ptr(zmq::socket_type::push));
-            bindAddr(qw_push_[ix], addrBase + "_from_queue_to_worker_" + std::to_string(ix));
+            bindAddr(qw_push_[ix],
+                     bindAddress(kFirstWorkerChannel + 2 * ix, "_from_queue_to_worker_" + std::to_string(ix), pid));
 
             qw_push_poller_[ix].register_socket(*qw_push_[ix], zmq::event_flags::pollout);
 
             // pull
             qw_pull_[ix].reset(zmqSvc().socket_ptr(zmq::socket_type::pull));
-            bindAddr(qw_pull_[ix], addrBase + "_from_worker_" + std::to_string(ix) + "_to_queue");
+            bindAddr(qw_pull_[ix],
+                     bindAddress(kFirstWorkerChannel + 2 * ix + 1, "_from_worker_" + std::to_string(ix) + "_to_queue", pid));
 
             qw_pull_poller_[ix].register_socket(*qw_pull_[ix], zmq::event_flags::pollin);
          }
@@ -147,20 +181,21 @@ Messenger::Messenger(const ProcessManager &process_manager)
          // then the master-queue sockets
          mq_push_.reset(zmqSvc().socket_ptr(zmq::socket_type::push));
          mq_push_->set(zmq::sockopt::sndhwm, hwm);
-         mq_push_->connect(addrBase + "_from_queue_to_master");
+         mq_push_->connect(connectAddress(kQueueToMaster, "_from_queue_to_master", pid));
 
          mq_push_poller_.register_socket(*mq_push_, zmq::event_flags::pollout);
 
          mq_pull_.reset(zmqSvc().socket_ptr(zmq::socket_type::pull));
          mq_pull_->set(zmq::sockopt::rcvhwm, hwm);
-         mq_pull_->connect(addrBase + "_from_master_to_queue");
+         mq_pull_->connect(connectAddress(kMasterToQueue, "_from_master_to_queue", pid));
 
          mq_pull_poller_.register_socket(*mq_pull_, zmq::event_flags::pollin);
 
          close_MQ_on_destruct_ = true;
          close_QW_container_on_destruct_ = true;
       } else if (process_manager.is_worker()) {
-         auto addrBase = makeAddrPrefix(getppid());
+         auto pid = getppid();
+         const std::size_t worker_id = process_manager.worker_id();
 
          // we only need one queue-worker pipe on the worker
          qw_push_poller_.resize(1);
@@ -168,31 +203,31 @@ Messenger::Messenger(const ProcessManager &process_manager)
 
          // push
          this_worker_qw_push_.reset(zmqSvc().socket_ptr(zmq::socket_type::push));
-         auto addr = addrBase + "_from_worker_" + std::to_string(process_manager.worker_id()) + "_to_queue";
-         this_worker_qw_push_->connect(addr);
+         this_worker_qw_push_->connect(connectAddress(kFirstWorkerChannel + 2 * worker_id + 1,
+                                                      "_from_worker_" + std::to_string(worker_id) + "_to_queue", pid));
 
          qw_push_poller_[0].register_socket(*this_worker_qw_push_, zmq::event_flags::pollout);
 
          // pull
          this_worker_qw_pull_.reset(zmqSvc().socket_ptr(zmq::socket_type::pull));
-         addr = addrBase + "_from_queue_to_worker_" + std::to_string(process_manager.worker_id());
-         this_worker_qw_pull_->connect(addr);
+         this_worker_qw_pull_->connect(connectAddress(kFirstWorkerChannel + 2 * worker_id,
+                                                      "_from_queue_to_worker_" + std::to_string(worker_id), pid));
 
          qw_pull_poller_[0].register_socket(*this_worker_qw_pull_, zmq::event_flags::pollin);
 
          mw_sub_.reset(zmqSvc().socket_ptr(zmq::socket_type::sub));
          mw_sub_->set(zmq::sockopt::rcvhwm, hwm);
          mw_sub_->set(zmq::sockopt::subscribe, "");
-         mw_sub_->connect(addrBase + "_from_master_to_workers");
+         mw_sub_->connect(connectAddress(kMasterToWorkers, "_from_master_to_workers", pid));
          mw_sub_poller_.register_socket(*mw_sub_, zmq::event_flags::pollin);
 
          wm_push_.reset(zmqSvc().socket_ptr(zmq::socket_type::push));
          wm_push_->set(zmq::sockopt::sndhwm, hwm);
-         wm_push_->connect(addrBase + "_from_workers_to_master");
+         wm_push_->connect(connectAddress(kWorkersToMaster, "_from_workers_to_master", pid));
 
          // check publisher connection and then wait until all subscribers are connected
          ZmqLingeringSocketPtr<> subscriber_ping_socket{zmqSvc().socket_ptr(zmq::socket_type::push)};
-         subscriber_ping_socket->connect(addrBase + "_subscriber_ping_socket");
+         subscriber_ping_socket->connect(connectAddress(kSubscriberPing, "_subscriber_ping_socket", pid));
          auto all_connected = zmqSvc().receive<bool>(*mw_sub_);
          zmqSvc().send(*subscriber_ping_socket, "present");
 
@@ -219,8 +254,11 @@ Messenger::~Messenger()
          mq_pull_.reset();
          mw_pub_.reset();
          wm_pull_.reset();
-         // remove bound files
+         // remove bound files (for the TCP transport there is nothing to clean up)
          for (const auto &address : bound_ipc_addresses_) {
+            if (address.compare(0, 6, "ipc://") != 0) {
+               continue;
+            }
             // no need to check return value, they are only zero byte /tmp files, the OS should eventually clean them up
             remove(address.substr(6).c_str());
          }
@@ -10,6 +10,7 @@
  * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
  */
 
+#include "RooFit/MultiProcess/Config.h"
 #include "RooFit/MultiProcess/Messenger.h"
 #include "RooFit/MultiProcess/ProcessManager.h" // ... JobManager::process_manager()
 
@@ -56,6 +57,49 @@ TEST(TestMPMessenger, Connections)
    }
 }
 
+TEST(TestMPMessenger, ConnectionsOverTcp)
+{
+   // same as Connections, but with the sockets set up over TCP instead of
+   // over ipc:// files, as used when workers run on other hosts
+   RooFit::MultiProcess::Config::Network::setTransport(RooFit::MultiProcess::Config::Network::Transport::TCP);
+   RooFit::MultiProcess::Config::Network::setTcpBasePort(38573);
+
+   struct sigaction sa;
+   RooFit::MultiProcess::ProcessManager pm(4);
+   if (pm.is_master()) {
+      // on master, we have to handle SIGCHLD
+      memset(&sa, '\0', sizeof(sa));
+      sa.sa_handler = handle_sigchld;
+      if (sigaction(SIGCHLD, &sa, nullptr) < 0) {
+         std::perror("sigaction failed");
+         std::exit(1);
+      }
+   }
+   RooFit::MultiProcess::Messenger messenger(pm);
+   if (pm.is_master()) {
+      // more SIGCHLD handling
+      sigset_t sigmask;
+      sigemptyset(&sigmask);
+      sigaddset(&sigmask, SIGCHLD);
+      int rc = sigprocmask(SIG_BLOCK, &sigmask, &messenger.ppoll_sigmask);
+      if (rc < 0) {
+         throw std::runtime_error("sigprocmask failed in TestMPMessenger.ConnectionsOverTcp");
+      }
+   }
+   messenger.test_connections(pm);
+   if (pm.is_master()) {
+      // clean up signal management modifications
+      sigprocmask(SIG_SETMASK, &messenger.ppoll_sigmask, nullptr);
+      sa.sa_handler = SIG_DFL;
+      if (sigaction(SIGCHLD, &sa, nullptr) < 0) {
+         std::perror("sigaction failed");
+         std::exit(1);
+      }
+   }
+
+   RooFit::MultiProcess::Config::Network::setTransport(RooFit::MultiProcess::Config::Network::Transport::IPC);
+}
+
 TEST(TestMPMessenger, ConnectionsManualExit)
 {
    // the point of this test is to see whether clean-up of ZeroMQ resources is done properly without calling any
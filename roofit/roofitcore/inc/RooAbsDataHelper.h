@@ -19,9 +19,12 @@
 #include <RooRealVar.h>
 
 #include <vector>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <cstddef>
 #include <string>
+#include <utility>
 
 class TTreeReader;
 
@@ -158,4 +161,46 @@ using RooDataSetHelper = RooAbsDataHelper<RooDataSet>;
 /// Helper for creating a RooDataHist inside RDataFrame. \see RooAbsDataHelper
 using RooDataHistHelper = RooAbsDataHelper<RooDataHist>;
 
+namespace RooFit {
+
+/// Create a RooDataSet from an RDataFrame without filling it event by event.
+///
+/// One Take action is booked per variable, so a single event loop materializes
+/// all columns, and the resulting buffers are handed to the dataset by move
+/// via RooDataSet::fromColumns(). For large inputs this is much faster than
+/// filling via RooDataSetHelper, at the cost of only supporting real-valued
+/// columns that are **matched by name** to the variables in `vars`. The
+/// column values are adopted as-is: unlike with RooDataSetHelper, events
+/// outside the ranges of the variables are not skipped. Use an RDataFrame
+/// Filter node to cut on the variable ranges if this matters.
+///
+/// \param dataFrame RDataFrame (or RDataFrame node) to read the columns from.
+/// \param name Name of the dataset.
+/// \param title Title for e.g. plotting.
+/// \param vars Variables to create in the dataset. For each variable, the
+/// RDataFrame column with the same name is read.
+/// \param wgtVarName Optional name of the variable in `vars` that holds the
+/// event weights.
+template <typename DataFrame_t>
+std::unique_ptr<RooDataSet> makeDataSetFromRDataFrame(DataFrame_t &dataFrame, RooStringView name, RooStringView title,
+                                                      const RooArgSet &vars, const char *wgtVarName = nullptr)
+{
+   // Book all Take actions before dereferencing any result, such that one
+   // event loop fills all columns.
+   std::vector<std::pair<std::string, decltype(dataFrame.template Take<double>(""))>> results;
+   results.reserve(vars.size());
+   for (RooAbsArg *var : vars) {
+      results.emplace_back(var->GetName(), dataFrame.template Take<double>(var->GetName()));
+   }
+
+   std::map<std::string, std::vector<double>> columns;
+   for (auto &result : results) {
+      columns.emplace(result.first, std::move(*result.second));
+   }
+
+   return RooDataSet::fromColumns(name, title, vars, std::move(columns), wgtVarName);
+}
+
+} // namespace RooFit
+
 #endif
@@ -27,7 +27,9 @@ class TDirectory;
 #include "RooDirItem.h"
 
 #include <list>
+#include <map>
 #include <string_view>
+#include <vector>
 
 class RooDataSet : public RooAbsData, public RooDirItem {
 public:
@@ -60,6 +62,10 @@ public:
              const RooCmdArg& arg7={}, const RooCmdArg& arg8={}) const ;
 
 
+  static std::unique_ptr<RooDataSet> fromColumns(RooStringView name, RooStringView title, const RooArgSet& vars,
+                                                 std::map<std::string,std::vector<double>>&& columns,
+                                                 const char* wgtVarName=nullptr) ;
+
   /// Read data from a text file and create a dataset from it.
   /// The possible options are: (D)ebug, (Q)uiet.
   static RooDataSet *read(const char *filename, const RooArgList &variables,
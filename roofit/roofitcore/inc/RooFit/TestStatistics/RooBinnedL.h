@@ -40,6 +40,8 @@ public:
 private:
    mutable bool _first = true;        ///<!
    mutable std::vector<double> _binw; ///<!
+   std::vector<double> _weights;      ///<! cached observed bin counts
+   std::vector<double> _lnGammaN;     ///<! cached log(N!) per bin (the counts never change during a fit)
    std::unique_ptr<RooChangeTracker> paramTracker_;
    Section lastSection_ = {0, 0}; // used for cache together with the parameter tracker
    mutable ROOT::Math::KahanSum<double> cachedResult_{0.};
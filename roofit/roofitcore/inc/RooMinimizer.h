@@ -33,6 +33,7 @@
 #include <vector>
 
 class RooAbsMinimizerFcn;
+class RooAbsData;
 class RooAbsReal;
 class RooFitResult;
 class RooArgList;
@@ -110,6 +111,11 @@ public:
       std::string minimizerType;   // local config
 
       bool setInitialCovariance = false; // Use covariance matrix provided by user
+
+      // Seed each minimization with the solution and covariance matrix of the
+      // previous fit, falling back to a cold start when the previous state is
+      // stale. Can also be toggled later with setWarmStart().
+      bool warmStart = false;
    };
 
    // For backwards compatibility with when the RooMinimizer used the ROOT::Math::Fitter.
@@ -164,12 +170,21 @@ public:
 
    int minimize(const char *type, const char *alg = nullptr);
 
+   std::vector<std::unique_ptr<RooFitResult>> fitDatasets(std::vector<RooAbsData *> const &datasets);
+
    RooFit::OwningPtr<RooFitResult> save(const char *name = nullptr, const char *title = nullptr);
    RooPlot *contour(RooRealVar &var1, RooRealVar &var2, double n1 = 1.0, double n2 = 2.0, double n3 = 0.0,
                     double n4 = 0.0, double n5 = 0.0, double n6 = 0.0, unsigned int npoints = 50);
 
    void setProfile(bool flag = true) { _cfg.profile = flag; }
 
+   /// If flag is true, seed the next minimization with the solution and
+   /// covariance matrix of the previous fit instead of starting cold. The
+   /// previous state is only used when it passes a staleness check (valid fit,
+   /// accurate covariance matrix and a starting point close to the previous
+   /// solution), otherwise the minimization silently falls back to a cold start.
+   void setWarmStart(bool flag = true) { _cfg.warmStart = flag; }
+
    int getPrintLevel();
 
    void setMinimizerType(std::string const &type);
@@ -224,6 +239,7 @@ private:
    bool calculateMinosErrors();
 
    void initMinimizer();
+   bool warmStartValid() const;
    void updateFitConfig();
    bool updateMinimizerOptions(bool canDifferentMinim = true);
 
@@ -242,6 +258,7 @@ private:
    TStopwatch _cumulTimer;
    std::unique_ptr<TMatrixDSym> _extV;
    std::unique_ptr<RooAbsMinimizerFcn> _fcn;
+   RooAbsReal *_func = nullptr; ///< the function passed in the constructor, needed to re-attach data in fitDatasets()
    std::vector<std::pair<std::string, int>> _statusHistory;
    RooMinimizer::Config _cfg; // local config object
 
@@ -66,6 +66,10 @@ public:
 
   static Int_t getCacheAllNumeric() ;
 
+  static void setNumIntValueCacheSize(std::size_t size) ;
+
+  static std::size_t getNumIntValueCacheSize() ;
+
   std::list<double>* plotSamplingHint(RooAbsRealLValue& obs, double xlo, double xhi) const override {
     // Forward plot sampling hint of integrand
     return _function->plotSamplingHint(obs,xlo,xhi) ;
@@ -147,6 +151,8 @@ protected:
 private:
   void addNumIntDep(RooAbsArg const &arg);
 
+  std::string numIntValueCacheKey() const;
+
   ClassDefOverride(RooRealIntegral,5) // Real-valued function representing an integral over a RooAbsReal object
 };
 
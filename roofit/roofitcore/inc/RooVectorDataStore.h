@@ -89,6 +89,7 @@ public:
   /// @{
   ArraysStruct getArrays() const;
   void recomputeSumWeight();
+  void adoptColumn(RooAbsArg const& var, std::vector<double>&& data);
   /// @}
 
 private:
@@ -19,6 +19,7 @@
 #include <RooAbsReal.h>
 #include <RooAddition.h>
 #include <RooBatchCompute.h>
+#include <RooBatchedFuncWrapper.h>
 #include <RooBinSamplingPdf.h>
 #include <RooCategory.h>
 #include <RooCmdConfig.h>
@@ -40,6 +41,8 @@
 #include <Math/CholeskyDecomp.h>
 #include <Math/Util.h>
 
+#include <TEnv.h>
+
 #include "ConstraintHelpers.h"
 #include "RooEvaluatorWrapper.h"
 #include "RooFitImplHelpers.h"
@@ -805,6 +808,15 @@ std::unique_ptr<RooAbsReal> createNLL(RooAbsPdf &pdf, RooAbsData &data, const Ro
          if (createGradient)
             static_cast<Experimental::RooFuncWrapper &>(*nllWrapper).createGradient();
       } else {
+         // Optionally fuse chains of element-wise nodes into single
+         // JIT-compiled kernels before handing the graph to the evaluator.
+         if (gEnv->GetValue("RooFit.EvaluatorFusion", 0)) {
+            int nFused = RooFit::Experimental::fuseElementwiseChains(*nll, normSet);
+            if (nFused > 0) {
+               oocxcoutI(&pdf, Fitting) << "RooAbsPdf::fitTo(" << pdf.GetName() << ") fused " << nFused
+                                        << " element-wise node chains into single kernels\n";
+            }
+         }
          nllWrapper = std::make_unique<RooEvaluatorWrapper>(
             *nll, &data, evalBackend == RooFit::EvalBackend::Value::Cuda, rangeName ? rangeName : "", pdfClone.get(),
             takeGlobalObservablesFromData);
@@ -0,0 +1,232 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooBatchedFuncWrapper.h>
+
+#include <RooConstVar.h>
+#include <RooFit/CodegenContext.h>
+#include <RooFit/EvalContext.h>
+#include <RooMsgService.h>
+
+#include <TInterpreter.h>
+#include <TROOT.h>
+
+#include <Math/Util.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace {
+
+// Node types that are element-wise (each output entry depends only on the
+// same entry of each input) and supported by code generation.
+bool isElementwise(RooAbsArg const *arg)
+{
+   static const std::unordered_set<std::string> elementwiseClasses{"RooProduct",    "RooAddition",  "RooRatio",
+                                                                   "RooPolyVar",    "RooPolynomial", "RooFormulaVar",
+                                                                   "RooGenericPdf", "RooExponential", "RooGaussian"};
+   return elementwiseClasses.find(arg->ClassName()) != elementwiseClasses.end();
+}
+
+// Inputs the fused kernel can read directly: variables and constants.
+bool isLeafInput(RooAbsArg const *arg)
+{
+   return arg->isFundamental() || dynamic_cast<RooConstVar const *>(arg);
+}
+
+} // namespace
+
+namespace RooFit {
+
+namespace Experimental {
+
+RooBatchedFuncWrapper::RooBatchedFuncWrapper(const char *name, const char *title, RooAbsReal &obj,
+                                             RooArgSet const &observables)
+   : RooAbsReal{name, title},
+     _params{"!params", "List of parameters", this},
+     _obs{"!obs", "List of observables", this}
+{
+   // Get the parameters: everything the wrapped object depends on, except the observables.
+   RooArgSet paramSet;
+   obj.getParameters(&observables, paramSet);
+
+   for (RooAbsArg *param : paramSet) {
+      if (!dynamic_cast<RooAbsReal *>(param)) {
+         if (param->isConstant()) {
+            continue;
+         }
+         std::stringstream errorMsg;
+         errorMsg << "In creation of function " << GetName()
+                  << " wrapper: input param expected to be of type RooAbsReal.";
+         coutE(InputArguments) << errorMsg.str() << std::endl;
+         throw std::runtime_error(errorMsg.str().c_str());
+      }
+      _params.add(*param);
+   }
+   _obs.add(observables);
+
+   // Set up the code generation context: parameters and observables are
+   // addressed as flat array slots in the generated function body.
+   RooFit::Experimental::CodegenContext ctx;
+
+   int idx = 0;
+   for (RooAbsArg *param : _params) {
+      ctx.addResult(param, "params[" + std::to_string(idx) + "]");
+      idx++;
+   }
+   idx = 0;
+   for (RooAbsArg *obs : _obs) {
+      ctx.addResult(obs->GetName(), "obs[" + std::to_string(idx) + "]");
+      idx++;
+   }
+
+   gInterpreter->Declare("#pragma cling optimize(2)");
+
+   // Declare and compile the flat per-entry function.
+   auto print = [](std::string const &msg) { oocoutI(nullptr, Fitting) << msg << std::endl; };
+   ROOT::Math::Util::TimingScope timingScope(print, "Batched kernel JIT time:");
+   _funcName = ctx.buildFunction(obj);
+   _func = reinterpret_cast<Func>(gInterpreter->ProcessLine((_funcName + ";").c_str()));
+
+   _xlArr = ctx.xlArr();
+   _collectedFunctions = ctx.collectedFunctions();
+
+   _paramBuffer.resize(_params.size());
+   _obsBuffer.resize(_obs.size());
+}
+
+RooBatchedFuncWrapper::RooBatchedFuncWrapper(const RooBatchedFuncWrapper &other, const char *name)
+   : RooAbsReal(other, name),
+     _params("!params", this, other._params),
+     _obs("!obs", this, other._obs),
+     _funcName(other._funcName),
+     _func(other._func),
+     _xlArr(other._xlArr),
+     _collectedFunctions(other._collectedFunctions),
+     _paramBuffer(other._paramBuffer),
+     _obsBuffer(other._obsBuffer)
+{
+}
+
+double RooBatchedFuncWrapper::evaluate() const
+{
+   for (std::size_t k = 0; k < _params.size(); ++k) {
+      _paramBuffer[k] = static_cast<RooAbsReal const &>(_params[k]).getVal();
+   }
+   for (std::size_t j = 0; j < _obs.size(); ++j) {
+      _obsBuffer[j] = static_cast<RooAbsReal const &>(_obs[j]).getVal();
+   }
+   return _func(_paramBuffer.data(), _obsBuffer.data(), _xlArr.data());
+}
+
+void RooBatchedFuncWrapper::doEval(RooFit::EvalContext &ctx) const
+{
+   std::span<double> output = ctx.output();
+
+   for (std::size_t k = 0; k < _params.size(); ++k) {
+      _paramBuffer[k] = ctx.at(&_params[k])[0];
+   }
+
+   std::vector<std::span<const double>> obsSpans(_obs.size());
+   for (std::size_t j = 0; j < _obs.size(); ++j) {
+      obsSpans[j] = ctx.at(&_obs[j]);
+   }
+
+   for (std::size_t i = 0; i < output.size(); ++i) {
+      for (std::size_t j = 0; j < obsSpans.size(); ++j) {
+         _obsBuffer[j] = obsSpans[j].size() > 1 ? obsSpans[j][i] : obsSpans[j][0];
+      }
+      output[i] = _func(_paramBuffer.data(), _obsBuffer.data(), _xlArr.data());
+   }
+}
+
+int fuseElementwiseChains(RooAbsReal &head, RooArgSet const &observables)
+{
+   RooArgSet nodes;
+   head.treeNodeServerList(&nodes);
+
+   std::unordered_set<RooAbsArg *> used;
+   int nFused = 0;
+
+   for (RooAbsArg *root : nodes) {
+      if (root == &head || !isElementwise(root) || used.count(root) || !dynamic_cast<RooAbsReal *>(root)) {
+         continue;
+      }
+
+      // Grow the fused region top-down from the root. A server joins the
+      // region if it is element-wise and all of its value clients are already
+      // inside (so its intermediate array is not needed elsewhere); anything
+      // else must be a real-valued leaf, otherwise code generation would
+      // descend into a node the evaluator still computes itself.
+      std::unordered_set<RooAbsArg *> region{root};
+      std::vector<RooAbsArg *> worklist{root};
+      bool valid = true;
+      while (valid && !worklist.empty()) {
+         RooAbsArg *node = worklist.back();
+         worklist.pop_back();
+         for (RooAbsArg *server : node->servers()) {
+            if (region.count(server)) {
+               continue;
+            }
+            if (isLeafInput(server)) {
+               if (!dynamic_cast<RooAbsReal *>(server)) {
+                  valid = false; // e.g. a category index
+                  break;
+               }
+               continue;
+            }
+            if (!isElementwise(server) || used.count(server)) {
+               valid = false;
+               break;
+            }
+            bool clientsInside = true;
+            for (RooAbsArg *client : server->valueClients()) {
+               if (!region.count(client)) {
+                  clientsInside = false;
+               }
+            }
+            if (!clientsInside) {
+               valid = false;
+               break;
+            }
+            region.insert(server);
+            worklist.push_back(server);
+         }
+      }
+      if (!valid || region.size() < 2) {
+         continue;
+      }
+
+      auto &rootReal = static_cast<RooAbsReal &>(*root);
+
+      RooArgSet regionObs;
+      rootReal.getObservables(&observables, regionObs);
+
+      auto wrapper = std::make_unique<RooBatchedFuncWrapper>((std::string(root->GetName()) + "_fused").c_str(),
+                                                             root->GetTitle(), rootReal, regionObs);
+      wrapper->setAttribute((std::string("ORIGNAME:") + root->GetName()).c_str());
+
+      std::vector<RooAbsArg *> clients{root->valueClients().begin(), root->valueClients().end()};
+      for (RooAbsArg *client : clients) {
+         client->redirectServers(RooArgList(*wrapper), false, true);
+      }
+
+      used.insert(region.begin(), region.end());
+      head.addOwnedComponents(std::move(wrapper));
+      ++nFused;
+   }
+
+   return nFused;
+}
+
+} // namespace Experimental
+
+} // namespace RooFit
@@ -113,6 +113,7 @@ the new `RooAbsData::uniqueId()`.
 #include <iostream>
 #include <memory>
 #include <fstream>
+#include <stdexcept>
 
 
 using std::endl, std::string, std::map, std::list, std::ifstream, std::ofstream, std::ostream;
@@ -1223,6 +1224,63 @@ RooPlot* RooDataSet::plotOnXY(RooPlot* frame, const RooCmdArg& arg1, const RooCm
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Construct a dataset by adopting already-filled columns without copying the
+/// event values. Each variable in `vars` must have a matching entry in
+/// `columns`, and all columns must have the same length. The column buffers
+/// are moved into the vector data store, so for large inputs this is much
+/// faster than filling the dataset event by event.
+/// \param name Name of the dataset.
+/// \param title Title for e.g. plotting.
+/// \param vars Variables that correspond to the columns. Only real-valued
+/// variables are supported.
+/// \param columns Map from variable name to column values. The vectors are
+/// consumed: after the call, the map only contains moved-from vectors.
+/// \param wgtVarName Optional name of the variable in `vars` that holds the
+/// event weights.
+
+std::unique_ptr<RooDataSet> RooDataSet::fromColumns(RooStringView name, RooStringView title, const RooArgSet &vars,
+                                                    std::map<std::string, std::vector<double>> &&columns,
+                                                    const char *wgtVarName)
+{
+   auto data = std::make_unique<RooDataSet>(name, title, vars,
+                                            wgtVarName ? RooFit::WeightVar(wgtVarName) : RooCmdArg::none());
+
+   auto *store = dynamic_cast<RooVectorDataStore *>(data->store());
+   if (store == nullptr) {
+      throw std::runtime_error("RooDataSet::fromColumns() requires the vector data store. Don't change the default "
+                               "storage type with RooAbsData::setDefaultStorageType() when using it.");
+   }
+
+   std::size_t nEntries = 0;
+   bool isFirstColumn = true;
+
+   for (RooAbsArg *var : vars) {
+      if (dynamic_cast<RooAbsReal *>(var) == nullptr) {
+         throw std::invalid_argument(std::string("RooDataSet::fromColumns(): variable \"") + var->GetName() +
+                                     "\" is not real-valued. Only real-valued variables are supported.");
+      }
+      auto found = columns.find(var->GetName());
+      if (found == columns.end()) {
+         throw std::invalid_argument(std::string("RooDataSet::fromColumns(): no column provided for variable \"") +
+                                     var->GetName() + "\".");
+      }
+      if (isFirstColumn) {
+         nEntries = found->second.size();
+         isFirstColumn = false;
+      } else if (found->second.size() != nEntries) {
+         throw std::invalid_argument(std::string("RooDataSet::fromColumns(): column \"") + var->GetName() +
+                                     "\" doesn't have the same length as the other columns.");
+      }
+      store->adoptColumn(*var, std::move(found->second));
+   }
+
+   store->recomputeSumWeight();
+
+   return data;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read given list of ascii files, and construct a data set, using the given
 /// ArgList as structure definition.
@@ -109,6 +109,7 @@ struct NodeInfo {
    bool fromArrayInput = false;
    bool isVariable = false;
    bool isDirty = true;
+   bool needsCompute = true;
    bool isCategory = false;
    bool hasLogged = false;
    bool computeInGPU = false;
@@ -451,9 +452,66 @@ std::span<const double> Evaluator::getValHeterogeneous()
    for (auto &info : _nodes) {
       info.remClients = info.clientInfos.size();
       info.remServers = info.serverInfos.size();
-      if (info.buffer && !info.fromArrayInput) {
+   }
+
+   // Figure out which nodes changed since the last evaluation. The nodes list
+   // is topologically sorted, so propagating the variable dirty flags to the
+   // clients is a single forward pass.
+   for (auto &info : _nodes) {
+      if (info.fromArrayInput) {
+         info.isDirty = false;
+         continue;
+      }
+      if (info.isVariable) {
+         auto *var = static_cast<RooRealVar const *>(info.absArg);
+         if (info.lastSetValCount != var->valueResetCounter()) {
+            info.lastSetValCount = var->valueResetCounter();
+            info.isDirty = true;
+         }
+      } else {
+         for (NodeInfo const *serverInfo : info.serverInfos) {
+            if (serverInfo->isDirty) {
+               info.isDirty = true;
+               break;
+            }
+         }
+      }
+   }
+
+   // A clean node still needs to be recomputed when a client is recomputed
+   // and the node's output did not survive the previous evaluation: only
+   // scalar outputs and data inputs are persistent, the array buffers get
+   // recycled. Propagate this requirement backwards through the graph.
+   for (auto it = _nodes.rbegin(); it != _nodes.rend(); ++it) {
+      NodeInfo &info = *it;
+      info.needsCompute = info.isDirty;
+      if (!info.needsCompute && !info.isScalar() && !info.fromArrayInput) {
+         for (NodeInfo const *clientInfo : info.clientInfos) {
+            if (clientInfo->needsCompute) {
+               info.needsCompute = true;
+               break;
+            }
+         }
+      }
+   }
+
+   // Nodes that don't need to be computed are marked as finished right away,
+   // updating the bookkeeping of their clients and servers accordingly. Their
+   // results from the last evaluation are still registered in the evaluation
+   // contexts.
+   for (auto &info : _nodes) {
+      if (info.buffer && !info.fromArrayInput && info.needsCompute) {
          info.buffer.reset();
       }
+      if (!info.fromArrayInput && !info.needsCompute) {
+         info.remServers = -2;
+         for (auto *clientInfo : info.clientInfos) {
+            --clientInfo->remServers;
+         }
+         for (auto *serverInfo : info.serverInfos) {
+            serverInfo->decrementRemainingClients();
+         }
+      }
    }
 
    // find initial GPU nodes and assign them to GPU
@@ -515,6 +573,10 @@ std::span<const double> Evaluator::getValHeterogeneous()
       }
    }
 
+   for (auto &info : _nodes) {
+      info.isDirty = false;
+   }
+
    // return the final value
    return _evalContextCUDA.at(&_topNode);
 }
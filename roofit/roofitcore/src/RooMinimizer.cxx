@@ -64,6 +64,7 @@ automatic PDF optimization.
 #include <TGraph.h>
 #include <TMarker.h>
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <stdexcept> // logic_error
@@ -82,7 +83,7 @@ automatic PDF optimization.
 /// value of the input function.
 
 /// Constructor that accepts all configuration in struct with RooAbsReal likelihood
-RooMinimizer::RooMinimizer(RooAbsReal &function, Config const &cfg) : _cfg(cfg)
+RooMinimizer::RooMinimizer(RooAbsReal &function, Config const &cfg) : _func(&function), _cfg(cfg)
 {
    initMinimizerFirstPart();
    auto nll_real = dynamic_cast<RooFit::TestStatistics::RooRealL *>(&function);
@@ -308,6 +309,38 @@ int RooMinimizer::minimize(const char *type, const char *alg)
    return _status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fit the same model to a sequence of datasets, reusing the computation graph
+/// of the minimized function for all of them. Each dataset is attached to the
+/// function with RooAbsReal::setData() (without cloning it) and minimized with
+/// the configured minimizer, so the model is never rebuilt between fits. When
+/// warm starting is enabled (see setWarmStart()), every fit after the first
+/// one is seeded with the solution and covariance matrix of the previous one,
+/// which makes long calibration sequences over slightly shifted datasets
+/// converge in a few iterations each.
+/// \param[in] datasets Datasets to fit one after the other.
+/// \return One fit result per dataset, in the order given. A null entry is
+///         stored for null input datasets.
+
+std::vector<std::unique_ptr<RooFitResult>> RooMinimizer::fitDatasets(std::vector<RooAbsData *> const &datasets)
+{
+   std::vector<std::unique_ptr<RooFitResult>> results;
+   results.reserve(datasets.size());
+
+   for (RooAbsData *data : datasets) {
+      if (data == nullptr) {
+         coutE(Minimization) << "RooMinimizer::fitDatasets: skipping null dataset" << std::endl;
+         results.emplace_back(nullptr);
+         continue;
+      }
+      _func->setData(*data, false);
+      minimize(_cfg.minimizerType.c_str());
+      results.emplace_back(save());
+   }
+
+   return results;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute MIGRAD. Changes in parameter values
 /// and calculated errors are automatically
@@ -968,7 +1001,13 @@ void RooMinimizer::initMinimizer()
    _minimizer->SetFunction(*getMultiGenFcn());
    _minimizer->SetVariables(_config.ParamsSettings().begin(), _config.ParamsSettings().end());
 
-   if (_cfg.setInitialCovariance) {
+   if (_cfg.warmStart && warmStartValid()) {
+      // Seed the minimizer with the full covariance matrix of the previous
+      // fit. The packed storage of FitResult::fCovMatrix matches the input
+      // format expected by the minimizer. The previous solution itself was
+      // already propagated to the parameter settings by updateFitConfig().
+      _minimizer->SetCovariance(_result->fCovMatrix, _fcn->getNDim());
+   } else if (_cfg.setInitialCovariance) {
       std::vector<double> v;
       for (std::size_t i = 0; i < _fcn->getNDim(); ++i) {
          RooRealVar &param = _fcn->floatableParam(i);
@@ -978,6 +1017,33 @@ void RooMinimizer::initMinimizer()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Check whether the state of the previous fit can be used to warm-start the
+/// next minimization. The previous fit must be valid with a full and accurate
+/// covariance matrix for an unchanged number of parameters, and the current
+/// starting point must be close to the previous solution: if any parameter
+/// moved by more than ten previous standard deviations the state is considered
+/// stale and the minimization falls back to a cold start.
+
+bool RooMinimizer::warmStartValid() const
+{
+   if (!_result || !_result->fValid)
+      return false;
+
+   const std::size_t npar = _fcn->getNDim();
+   if (_result->fParams.size() != npar || _result->fCovStatus != 3)
+      return false;
+   if (_result->fCovMatrix.size() != npar * (npar + 1) / 2)
+      return false;
+
+   for (std::size_t i = 0; i < npar; ++i) {
+      const double err = _result->error(i);
+      if (err > 0 && std::abs(_config.ParSettings(i).Value() - _result->fParams[i]) > 10 * err)
+         return false;
+   }
+   return true;
+}
+
 bool RooMinimizer::updateMinimizerOptions(bool canDifferentMinim)
 {
    // update minimizer options when re-doing a Fit or computing Hesse or Minos errors
@@ -44,12 +44,86 @@ integration is performed in the various implementations of the RooAbsIntegrator
 #include <RooSuperCategory.h>
 #include <RooTrace.h>
 
+#include <TEnv.h>
+
 #include <iostream>
+#include <list>
 #include <memory>
+#include <unordered_map>
 
 
 namespace {
 
+/// Process-wide LRU cache for values of numeric integrals, keyed by the
+/// integral configuration and the current parameter values. Unlike the
+/// RooExpensiveObjectCache, which keeps a single parameter point per integral,
+/// this cache holds many parameter points, so repeated evaluations of the
+/// same configuration -- across toy fits of cloned models or minimizer
+/// retries -- hit the cache. Disabled by default; see
+/// RooRealIntegral::setNumIntValueCacheSize().
+class NumIntValueCache {
+public:
+   static NumIntValueCache &instance()
+   {
+      static NumIntValueCache cache;
+      return cache;
+   }
+
+   std::size_t maxSize() const { return _maxSize; }
+
+   void setMaxSize(std::size_t size)
+   {
+      _maxSize = size;
+      trim();
+   }
+
+   bool find(std::string const &key, double &value)
+   {
+      auto iter = _index.find(key);
+      if (iter == _index.end()) {
+         return false;
+      }
+      // move hit to the front of the LRU list
+      _lru.splice(_lru.begin(), _lru, iter->second);
+      value = iter->second->second;
+      return true;
+   }
+
+   void insert(std::string const &key, double value)
+   {
+      auto iter = _index.find(key);
+      if (iter != _index.end()) {
+         iter->second->second = value;
+         _lru.splice(_lru.begin(), _lru, iter->second);
+         return;
+      }
+      _lru.emplace_front(key, value);
+      _index[key] = _lru.begin();
+      trim();
+   }
+
+private:
+   NumIntValueCache()
+   {
+      if (gEnv) {
+         int size = gEnv->GetValue("RooFit.NumIntValueCacheSize", 0);
+         _maxSize = size > 0 ? size : 0;
+      }
+   }
+
+   void trim()
+   {
+      while (_index.size() > _maxSize) {
+         _index.erase(_lru.back().first);
+         _lru.pop_back();
+      }
+   }
+
+   std::size_t _maxSize = 0;
+   std::list<std::pair<std::string, double>> _lru;
+   std::unordered_map<std::string, std::list<std::pair<std::string, double>>::iterator> _index;
+};
+
 /// Utility function that returns true if 'object server' is a server
 /// to exactly one of the RooAbsArgs in 'exclLVBranches'
 bool servesExclusively(const RooAbsArg *server, const RooArgSet &exclLVBranches, const RooArgSet &allBranches)
@@ -815,9 +889,19 @@ double RooRealIntegral::evaluate() const
         cacheVal = static_cast<RooDouble const*>(expensiveObjectCache().retrieveObject(GetName(),RooDouble::Class(),parameters()))  ;
       }
 
+      // The opt-in LRU value cache keeps many parameter points per integral,
+      // unlike the expensive object cache which holds only the latest one
+      const bool useValueCache = !_intList.empty() && getNumIntValueCacheSize() > 0 ;
+      std::string valueCacheKey ;
+      if (useValueCache) {
+        valueCacheKey = numIntValueCacheKey() ;
+      }
+
       if (cacheVal) {
         retVal = *cacheVal ;
    // std::cout << "using cached value of integral" << GetName() << std::endl ;
+      } else if (useValueCache && NumIntValueCache::instance().find(valueCacheKey,retVal)) {
+   // Value found in the LRU cache, nothing further to do
       } else {
 
 
@@ -848,6 +932,10 @@ double RooRealIntegral::evaluate() const
         _intList.assign(_saveInt) ;
         _sumList.assign(_saveSum) ;
 
+        if (useValueCache) {
+          NumIntValueCache::instance().insert(valueCacheKey,retVal) ;
+        }
+
         // Cache numeric integrals in >1d expensive object cache
         if ((_cacheNum && !_intList.empty()) || int(_intList.size())>=_cacheAllNDim) {
           RooDouble* val = new RooDouble(retVal) ;
@@ -1106,6 +1194,55 @@ Int_t RooRealIntegral::getCacheAllNumeric()
    return _cacheAllNDim;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the capacity of the process-wide LRU cache for numeric integral values.
+/// When non-zero, every (partially) numeric integral value is memoized keyed by
+/// the integral name, the integration range, and the current parameter values,
+/// so repeated evaluations at previously visited parameter points -- e.g.
+/// across toy fits of identically structured models or across minimizer
+/// retries -- skip the numeric integration entirely. A size of zero (the
+/// default) disables the cache. The initial size can also be set with the
+/// `RooFit.NumIntValueCacheSize` configuration entry in rootrc. Note that the
+/// key is based on the integral name, so unrelated integrals that share both
+/// name and parameter names should not be evaluated with the cache enabled.
+
+void RooRealIntegral::setNumIntValueCacheSize(std::size_t size)
+{
+   NumIntValueCache::instance().setMaxSize(size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the capacity of the process-wide LRU cache for numeric integral values.
+
+std::size_t RooRealIntegral::getNumIntValueCacheSize()
+{
+   return NumIntValueCache::instance().maxSize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the key for the numeric integral value cache from the integral name,
+/// the integration range, and the current parameter values.
+
+std::string RooRealIntegral::numIntValueCacheKey() const
+{
+   std::string key = GetName();
+   if (const char *rangeName = RooNameReg::str(_rangeName)) {
+      key += '/';
+      key += rangeName;
+   }
+   key += '\0';
+   for (RooAbsArg const *param : parameters()) {
+      if (auto real = dynamic_cast<RooAbsReal const *>(param)) {
+         const double val = real->getVal();
+         key.append(reinterpret_cast<const char *>(&val), sizeof(val));
+      } else if (auto cat = dynamic_cast<RooAbsCategory const *>(param)) {
+         const int idx = cat->getCurrentIndex();
+         key.append(reinterpret_cast<const char *>(&idx), sizeof(idx));
+      }
+   }
+   return key;
+}
+
 std::unique_ptr<RooAbsArg>
 RooRealIntegral::compileForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext &ctx) const
 {
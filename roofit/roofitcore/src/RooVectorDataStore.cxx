@@ -47,6 +47,7 @@ which returns spans pointing directly to the data.
 #include "TBuffer.h"
 
 #include <iomanip>
+#include <stdexcept>
 using std::string, std::vector, std::list;
 
 
@@ -1358,6 +1359,30 @@ void RooVectorDataStore::recomputeSumWeight() {
 }
 
 
+/// Adopt an externally filled column without copying the event values. The
+/// moved-in vector replaces the storage of the column for \p var. Meant for
+/// use by RooFit bulk import functions such as RooDataSet::fromColumns();
+/// it is the caller's responsibility to adopt columns of equal length for
+/// all variables in the store and to call recomputeSumWeight() afterwards.
+void RooVectorDataStore::adoptColumn(RooAbsArg const& var, std::vector<double>&& data) {
+  const std::string name = var.GetName();
+  for(auto* real : _realStoreList) {
+    if(name == real->_nativeReal->GetName()) {
+      real->_vec = std::move(data);
+      return;
+    }
+  }
+  for(auto* realf : _realfStoreList) {
+    if(name == realf->_nativeReal->GetName()) {
+      realf->_vec = std::move(data);
+      return;
+    }
+  }
+  throw std::invalid_argument("RooVectorDataStore::adoptColumn(): no real-valued column named \"" + name +
+                              "\" in this store");
+}
+
+
 /// Exports all arrays in this RooVectorDataStore into a simple datastructure
 /// to be used by RooFit internal export functions.
 RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
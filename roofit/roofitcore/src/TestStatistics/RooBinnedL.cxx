@@ -74,6 +74,18 @@ RooBinnedL::RooBinnedL(RooAbsPdf *pdf, RooAbsData *data)
          ++biter;
       }
    }
+
+   // Cache the observed bin counts and their log-factorials. The counts are
+   // fixed for the lifetime of the likelihood, so the expensive LnGamma terms
+   // only need to be computed once instead of on every evaluation.
+   _weights.reserve(data_->numEntries());
+   _lnGammaN.reserve(data_->numEntries());
+   for (int i = 0; i < data_->numEntries(); ++i) {
+      data_->get(i);
+      double eventWeight = data_->weight();
+      _weights.push_back(eventWeight);
+      _lnGammaN.push_back(TMath::LnGamma(eventWeight + 1));
+   }
 }
 
 RooBinnedL::~RooBinnedL() = default;
@@ -107,12 +119,12 @@ RooBinnedL::evaluatePartition(Section bins, std::size_t /*components_begin*/, st
 
    for (std::size_t i = bins.begin(N_events_); i < bins.end(N_events_); ++i) {
 
+      // load the bin observable for the pdf evaluation below
       data_->get(i);
 
-      double eventWeight = data_->weight();
-
-      // Calculate log(Poisson(N|mu) for this bin
-      double N = eventWeight;
+      // Calculate log(Poisson(N|mu) for this bin, with the observed count and
+      // its log-factorial taken from the caches filled in the constructor
+      double N = _weights[i];
       double mu = pdf_->getVal() * _binw[i];
 
       if (mu <= 0 && N > 0) {
@@ -128,9 +140,9 @@ RooBinnedL::evaluatePartition(Section bins, std::size_t /*components_begin*/, st
 
       } else {
 
-         double term = -1 * (-mu + N * log(mu) - TMath::LnGamma(N + 1));
+         double term = -1 * (-mu + N * log(mu) - _lnGammaN[i]);
 
-         sumWeight += eventWeight;
+         sumWeight += N;
          result += term;
       }
    }
@@ -101,6 +101,36 @@ TEST(RooAbsDataHelper, RooDataSetWeighted)
    EXPECT_NEAR(rooDataSet->moment(y, 2.), targetYVar, targetYVar * 1.E-4);
 }
 
+TEST(RooAbsDataHelper, MakeDataSetFromRDataFrame)
+{
+   auto dd = makeDataFrame();
+   RooArgSet vars = makeVariablesSet();
+   vars.addOwned(std::make_unique<RooRealVar>("w", "w", 1.));
+   RooRealVar &x = static_cast<RooRealVar &>(vars["x"]);
+   RooRealVar &y = static_cast<RooRealVar &>(vars["y"]);
+
+   auto rooDataSet = RooFit::makeDataSetFromRDataFrame(dd, "dataset", "Title of dataset", vars, "w");
+
+   auto sumEntriesResult = dd.Sum("w");
+
+   double sumEntries = sumEntriesResult.GetValue();
+
+   ASSERT_EQ(rooDataSet->numEntries(), nEvent);
+   EXPECT_TRUE(rooDataSet->isWeighted());
+   EXPECT_NEAR(rooDataSet->sumEntries(), sumEntries, sumEntries * 1.E-9);
+   EXPECT_NEAR(rooDataSet->mean(x), targetXMean, 1.E-4);
+   EXPECT_NEAR(rooDataSet->moment(x, 2.), targetXVar, targetXVar * 1.E-4);
+   EXPECT_NEAR(rooDataSet->mean(y), targetYMean, 1.E-4);
+   EXPECT_NEAR(rooDataSet->moment(y, 2.), targetYVar, targetYVar * 1.E-4);
+
+   // The adopted weight column must also be visible through the batch interface.
+   auto weights = rooDataSet->getWeightBatch(0, 10, false);
+   ASSERT_EQ(weights.size(), 10u);
+   for (double w : weights) {
+      EXPECT_DOUBLE_EQ(w, 0.5);
+   }
+}
+
 TEST(RooAbsDataHelper, RooDataHist)
 {
    auto dd = makeDataFrame();
@@ -0,0 +1,86 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooAddition.h>
+#include <RooFit/Evaluator.h>
+#include <RooFormulaVar.h>
+#include <RooHelpers.h>
+#include <RooRealVar.h>
+
+#include "gtest_wrapper.h"
+
+#include <vector>
+
+namespace {
+
+// A RooAddition that counts how often the evaluator asks it to recompute.
+class CountingAddition : public RooAddition {
+public:
+   CountingAddition(const char *name, const RooArgList &sumSet) : RooAddition{name, name, sumSet} {}
+
+   void doEval(RooFit::EvalContext &ctx) const override
+   {
+      ++evalCount;
+      RooAddition::doEval(ctx);
+   }
+
+   mutable int evalCount = 0;
+};
+
+} // namespace
+
+// The evaluator must only recompute the subgraphs that depend on parameters
+// that actually changed, and leave the cached results of clean subgraphs
+// untouched.
+TEST(RooFitEvaluator, SkipsCleanSubgraphs)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0.0, -5.0, 5.0);
+   RooRealVar p1("p1", "p1", 1.0, 0.1, 10.0);
+   RooRealVar p2("p2", "p2", 0.5, -5.0, 5.0);
+
+   RooFormulaVar f1("f1", "p1 * x", {p1, x});
+   RooFormulaVar f2("f2", "p2 + x", {p2, x});
+   CountingAddition chanA("chanA", {f1});
+   CountingAddition chanB("chanB", {f2});
+   RooAddition sum("sum", "sum", {chanA, chanB});
+
+   const std::size_t nEntries = 20;
+   std::vector<double> xVals(nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      xVals[i] = -4.0 + 8.0 * i / (nEntries - 1);
+   }
+
+   RooFit::Evaluator evaluator(sum);
+   evaluator.setInput("x", xVals, false);
+
+   evaluator.run();
+   EXPECT_EQ(chanA.evalCount, 1);
+   EXPECT_EQ(chanB.evalCount, 1);
+
+   // Changing one parameter must only recompute the channel depending on it.
+   p1.setVal(2.0);
+   evaluator.run();
+   EXPECT_EQ(chanA.evalCount, 2);
+   EXPECT_EQ(chanB.evalCount, 1);
+
+   // With no changes at all, nothing recomputes.
+   std::span<const double> output = evaluator.run();
+   EXPECT_EQ(chanA.evalCount, 2);
+   EXPECT_EQ(chanB.evalCount, 1);
+
+   // The output after partial recomputation is still correct.
+   ASSERT_EQ(output.size(), nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      const double expected = p1.getVal() * xVals[i] + p2.getVal() + xVals[i];
+      EXPECT_NEAR(output[i], expected, 1e-12) << "entry " << i;
+   }
+}
@@ -0,0 +1,111 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooAddition.h>
+#include <RooBatchedFuncWrapper.h>
+#include <RooFit/Evaluator.h>
+#include <RooFormulaVar.h>
+#include <RooGaussian.h>
+#include <RooHelpers.h>
+#include <RooProduct.h>
+#include <RooRealVar.h>
+
+#include "gtest_wrapper.h"
+
+#include <vector>
+
+// The wrapper must reproduce the wrapped expression value by value in scalar
+// mode.
+TEST(RooBatchedFuncWrapper, ScalarMatchesWrapped)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0.0, -5.0, 5.0);
+   RooRealVar mu("mu", "mu", 0.5, -5.0, 5.0);
+   RooRealVar sigma("sigma", "sigma", 1.5, 0.1, 10.0);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+
+   RooFit::Experimental::RooBatchedFuncWrapper wrapper("wrapper", "wrapper", gauss, {x});
+
+   for (double xVal = -4.5; xVal < 4.5; xVal += 0.25) {
+      x.setVal(xVal);
+      EXPECT_NEAR(wrapper.getVal(), gauss.getVal(), 1e-12);
+   }
+}
+
+// The batched evaluation through the RooFit::Evaluator must match the scalar
+// evaluation of the wrapped object entry by entry.
+TEST(RooBatchedFuncWrapper, BatchMatchesScalar)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0.0, -5.0, 5.0);
+   RooRealVar mu("mu", "mu", -0.3, -5.0, 5.0);
+   RooRealVar sigma("sigma", "sigma", 2.0, 0.1, 10.0);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+
+   RooFit::Experimental::RooBatchedFuncWrapper wrapper("wrapper", "wrapper", gauss, {x});
+
+   const std::size_t nEntries = 100;
+   std::vector<double> xVals(nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      xVals[i] = -4.5 + 9.0 * i / (nEntries - 1);
+   }
+
+   RooFit::Evaluator evaluator(wrapper);
+   evaluator.setInput("x", xVals, false);
+   std::span<const double> output = evaluator.run();
+
+   ASSERT_EQ(output.size(), nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      x.setVal(xVals[i]);
+      EXPECT_NEAR(output[i], gauss.getVal(), 1e-12) << "entry " << i;
+   }
+}
+
+// Fusing a chain of element-wise nodes must rewrite the graph below the head
+// and leave the evaluated values unchanged.
+TEST(RooBatchedFuncWrapper, FuseElementwiseChains)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0.0, -5.0, 5.0);
+   RooRealVar a("a", "a", 1.5, 0.1, 10.0);
+   RooRealVar b("b", "b", 0.5, -5.0, 5.0);
+   RooRealVar c("c", "c", 2.0, -10.0, 10.0);
+
+   RooFormulaVar f1("f1", "a * x * x", {a, x});
+   RooFormulaVar f2("f2", "x + b", {x, b});
+   RooProduct prod("prod", "prod", {f1, f2});
+   RooAddition head("head", "head", {prod, c});
+
+   // The {prod, f1, f2} chain is fused into one kernel; the head itself is
+   // never replaced.
+   EXPECT_EQ(RooFit::Experimental::fuseElementwiseChains(head, {x}), 1);
+   EXPECT_NE(head.findServer("prod_fused"), nullptr);
+   EXPECT_EQ(head.findServer("prod"), nullptr);
+
+   const std::size_t nEntries = 50;
+   std::vector<double> xVals(nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      xVals[i] = -4.5 + 9.0 * i / (nEntries - 1);
+   }
+
+   RooFit::Evaluator evaluator(head);
+   evaluator.setInput("x", xVals, false);
+   std::span<const double> output = evaluator.run();
+
+   ASSERT_EQ(output.size(), nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      const double xVal = xVals[i];
+      const double expected = a.getVal() * xVal * xVal * (xVal + b.getVal()) + c.getVal();
+      EXPECT_NEAR(output[i], expected, 1e-12) << "entry " << i;
+   }
+}
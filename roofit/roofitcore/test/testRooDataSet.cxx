@@ -23,6 +23,7 @@
 
 #include <fstream>
 #include <memory>
+#include <stdexcept>
 
 #include "gtest/gtest.h"
 
@@ -537,3 +538,59 @@ TEST(RooDataSet, ReduceCompositeDataStoreByIndexCat)
    EXPECT_EQ(dsCat->getCurrentIndex(), initialIndexInDataStore);
    EXPECT_EQ(cat->getCurrentIndex(), initialIndexInWorkspace);
 }
+
+/// Check that a dataset built from moved-in columns is identical to one that
+/// was filled event by event.
+TEST(RooDataSet, FromColumns)
+{
+   RooRealVar x("x", "x", 0., -10., 10.);
+   RooRealVar w("w", "w", 1., 0., 10.);
+
+   const std::size_t nEntries = 100;
+
+   std::map<std::string, std::vector<double>> columns;
+   auto &xVals = columns["x"];
+   auto &wVals = columns["w"];
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      xVals.push_back(-5. + 10. * i / nEntries);
+      wVals.push_back(0.5 + 0.01 * i);
+   }
+
+   // Reference dataset, filled event by event.
+   RooDataSet ref("ref", "ref", {x, w}, RooFit::WeightVar("w"));
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      x.setVal(-5. + 10. * i / nEntries);
+      ref.add(RooArgSet{x}, 0.5 + 0.01 * i);
+   }
+
+   auto data = RooDataSet::fromColumns("data", "data", {x, w}, std::move(columns), "w");
+
+   ASSERT_EQ(data->numEntries(), ref.numEntries());
+   EXPECT_TRUE(data->isWeighted());
+   EXPECT_DOUBLE_EQ(data->sumEntries(), ref.sumEntries());
+
+   for (int i = 0; i < ref.numEntries(); ++i) {
+      data->get(i);
+      ref.get(i);
+      EXPECT_DOUBLE_EQ(data->weight(), ref.weight());
+   }
+
+   // The adopted columns must be visible through the batch interfaces,
+   // including the lazily-computed squared weights.
+   auto xBatch = data->getBatches(0, nEntries).at(&(*data->get())["x"]);
+   auto wBatch = data->getWeightBatch(0, nEntries, false);
+   auto w2Batch = data->getWeightBatch(0, nEntries, true);
+   ASSERT_EQ(xBatch.size(), nEntries);
+   ASSERT_EQ(wBatch.size(), nEntries);
+   ASSERT_EQ(w2Batch.size(), nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      EXPECT_DOUBLE_EQ(xBatch[i], -5. + 10. * i / nEntries);
+      EXPECT_DOUBLE_EQ(wBatch[i], 0.5 + 0.01 * i);
+      EXPECT_DOUBLE_EQ(w2Batch[i], wBatch[i] * wBatch[i]);
+   }
+
+   // Columns missing or with inconsistent lengths are rejected.
+   std::map<std::string, std::vector<double>> badColumns;
+   badColumns["x"] = {1., 2., 3.};
+   EXPECT_THROW(RooDataSet::fromColumns("bad", "bad", {x, w}, std::move(badColumns), "w"), std::invalid_argument);
+}
@@ -22,6 +22,7 @@
 #include "gtest_wrapper.h"
 
 #include <memory>
+#include <vector>
 
 namespace {
 RooArgList getSortedServers(RooAbsArg const &arg)
@@ -410,3 +411,43 @@ TEST(RooRealIntegral, GaussianWithSigmaDependingOnX)
 
    EXPECT_EQ(val1, val2);
 }
+
+// Check that the opt-in LRU value cache returns the same values as direct
+// numeric integration when revisiting previously evaluated parameter points.
+TEST(RooRealIntegral, NumIntValueCache)
+{
+   RooWorkspace ws;
+   ws.factory("Gaussian::gauss(x[-10, 10], mu[0, -3, 3], sigma[2, 0.1, 10])");
+
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &mu = *ws.var("mu");
+   RooAbsPdf &gauss = *ws.pdf("gauss");
+   gauss.forceNumInt(true);
+
+   std::unique_ptr<RooAbsReal> integral{gauss.createIntegral(x)};
+
+   const std::vector<double> muVals{-1.5, 0.0, 0.7, 2.3};
+
+   // Reference values without the cache
+   ASSERT_EQ(RooRealIntegral::getNumIntValueCacheSize(), 0u);
+   std::vector<double> refVals;
+   for (double muVal : muVals) {
+      mu.setVal(muVal);
+      refVals.push_back(integral->getVal());
+   }
+
+   RooRealIntegral::setNumIntValueCacheSize(100);
+
+   // First pass fills the cache, second pass must hit it and reproduce the
+   // exact same values
+   for (int pass = 0; pass < 2; ++pass) {
+      for (std::size_t i = 0; i < muVals.size(); ++i) {
+         mu.setVal(muVals[i]);
+         EXPECT_EQ(integral->getVal(), refVals[i]) << "pass " << pass << ", mu = " << muVals[i];
+      }
+   }
+
+   // Restore the default configuration
+   RooRealIntegral::setNumIntValueCacheSize(0);
+   EXPECT_EQ(RooRealIntegral::getNumIntValueCacheSize(), 0u);
+}
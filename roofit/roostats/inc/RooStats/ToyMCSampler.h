@@ -78,6 +78,7 @@ class ToyMCSampler: public TestStatSampler {
       SamplingDistribution* GetSamplingDistribution(RooArgSet& paramPoint) override;
       virtual RooDataSet* GetSamplingDistributions(RooArgSet& paramPoint);
       virtual RooDataSet* GetSamplingDistributionsSingleWorker(RooArgSet& paramPoint);
+      virtual RooDataSet* GetSamplingDistributionsParallelWorkers(RooArgSet& paramPoint);
 
       virtual SamplingDistribution* AppendSamplingDistribution(
          RooArgSet& allParameters,
@@ -226,6 +227,22 @@ class ToyMCSampler: public TestStatSampler {
 
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
+      /// Distribute the toys over `n` worker processes (1 means serial
+      /// running). \see GetSamplingDistributionsParallelWorkers()
+      void SetNumWorkers(unsigned int n) {
+         if (n == 0) {
+            oocoutE(nullptr,InputArguments) << "Number of workers must be at least 1. Doing nothing." << std::endl;
+            return;
+         }
+         fNumWorkers = n;
+      }
+      unsigned int GetNumWorkers() const { return fNumWorkers; }
+
+      /// Base seed for the deterministic per-worker seeding in parallel runs:
+      /// worker `i` seeds its generator with `seed + i`. With the default of
+      /// zero, a base seed is drawn from the current RooRandom generator.
+      void SetParallelSeed(unsigned int seed) { fParallelSeed = seed; }
+
    protected:
 
       const RooArgList* EvaluateAllTestStatistics(RooAbsData& data, const RooArgSet& poi, DetailedOutputAggregator& detOutAgg);
@@ -284,6 +301,9 @@ class ToyMCSampler: public TestStatSampler {
       static bool fgAlwaysUseMultiGen ;  ///< Use PrepareMultiGen always
       bool fUseMultiGen = false;         ///< Use PrepareMultiGen?
 
+      unsigned int fNumWorkers = 1;   ///< number of worker processes for parallel runs
+      unsigned int fParallelSeed = 0; ///< base seed for per-worker seeding (0: draw from RooRandom)
+
    ClassDefOverride(ToyMCSampler, 0) // A simple implementation of the TestStatSampler interface
 };
 }
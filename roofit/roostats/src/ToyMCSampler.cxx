@@ -45,6 +45,13 @@ TestStatistic.
 
 #include "TMath.h"
 
+#ifndef _WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <limits>
+#include <utility>
+
 
 using namespace RooFit;
 using std::endl;
@@ -245,8 +252,83 @@ SamplingDistribution* ToyMCSampler::GetSamplingDistribution(RooArgSet& paramPoin
 
 RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
-   // ======= S I N G L E   R U N ? =======
+   if(fNumWorkers > 1) {
+      return GetSamplingDistributionsParallelWorkers(paramPointIn);
+   }
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distribute the toys over the worker processes configured with
+/// SetNumWorkers() and merge their sampling distributions.
+///
+/// Each worker is a forked process (RooFit is not thread safe, so the toys
+/// cannot run on threads) that seeds its random generator deterministically
+/// with `baseSeed + workerIndex` and then runs its share of the toys through
+/// GetSamplingDistributionsSingleWorker(). The base seed can be fixed with
+/// SetParallelSeed() to make the merged distribution reproducible.
+///
+/// Adaptive sampling (SetToysLeftTail() etc.) requires a running count of the
+/// toys in the tails and is therefore not supported in parallel runs; it
+/// falls back to serial running with a warning.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsParallelWorkers(RooArgSet& paramPointIn)
+{
+#ifdef _WIN32
+   oocoutW(nullptr, InputArguments) << "Parallel toy generation is not supported on Windows. "
+      "Running all toys serially." << std::endl;
    return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if(fToysInTails != 0.0) {
+      oocoutW(nullptr, InputArguments) << "Adaptive sampling is not supported in parallel runs. "
+         "Running all toys serially." << std::endl;
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
+
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << std::endl;
+      return nullptr;
+   }
+
+   const unsigned int baseSeed =
+      fParallelSeed != 0 ? fParallelSeed : RooRandom::randomGenerator()->Integer(std::numeric_limits<int>::max()) + 1;
+
+   // one {seed, ntoys} task per worker, distributing the remainder toys
+   std::vector<std::pair<unsigned int, Int_t>> tasks;
+   for (unsigned int i = 0; i < fNumWorkers; ++i) {
+      Int_t share = fNToys / fNumWorkers + (static_cast<Int_t>(i) < fNToys % fNumWorkers ? 1 : 0);
+      if (share > 0) tasks.emplace_back(baseSeed + i, share);
+   }
+   if (tasks.empty()) {
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
+
+   oocoutP(nullptr, Generation) << "Running " << fNToys << " toys on " << tasks.size()
+      << " worker processes" << std::endl;
+
+   ROOT::TProcessExecutor executor(tasks.size());
+   auto results = executor.Map(
+      [&](std::pair<unsigned int, Int_t> const &task) -> RooDataSet * {
+         RooRandom::randomGenerator()->SetSeed(task.first);
+         fNToys = task.second;
+         return GetSamplingDistributionsSingleWorker(paramPointIn);
+      },
+      tasks);
+
+   RooDataSet* merged = nullptr;
+   for (RooDataSet* r : results) {
+      if (r == nullptr) continue;
+      if (merged == nullptr) {
+         merged = r;
+      } else {
+         merged->append(*r);
+         delete r;
+      }
+   }
+   return merged;
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
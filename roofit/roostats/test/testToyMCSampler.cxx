@@ -0,0 +1,60 @@
+// Tests for the ToyMCSampler
+
+#include <RooStats/NumEventsTestStat.h>
+#include <RooStats/SamplingDistribution.h>
+#include <RooStats/ToyMCSampler.h>
+
+#include <RooExtendPdf.h>
+#include <RooGaussian.h>
+#include <RooRealVar.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#ifndef _WIN32
+
+/// Check that the parallel toy engine produces the requested number of toys
+/// and is reproducible when the base seed is fixed.
+TEST(ToyMCSampler, ParallelWorkers)
+{
+   using namespace RooStats;
+
+   RooRealVar x("x", "x", -5., 5.);
+   RooRealVar mu("mu", "mu", 0., -1., 1.);
+   RooRealVar sigma("sigma", "sigma", 1.);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+   RooRealVar n("n", "n", 50.);
+   RooExtendPdf model("model", "model", gauss, n);
+
+   const int nToys = 20;
+
+   NumEventsTestStat ts(model);
+   ToyMCSampler sampler(ts, nToys);
+   sampler.SetPdf(model);
+   RooArgSet observables{x};
+   sampler.SetObservables(observables);
+   RooArgSet poi{mu};
+   sampler.SetParametersForTestStat(poi);
+
+   sampler.SetNumWorkers(2);
+   sampler.SetParallelSeed(4357);
+
+   RooArgSet paramPoint{mu};
+   std::unique_ptr<SamplingDistribution> dist{sampler.GetSamplingDistribution(paramPoint)};
+   ASSERT_NE(dist, nullptr);
+   EXPECT_EQ(dist->GetSize(), nToys);
+
+   // The event counts follow a Poisson distribution with mean 50, so the toys
+   // of the two workers cannot all have produced the same test statistic.
+   const std::vector<double> &values = dist->GetSamplingDistribution();
+   EXPECT_GT(*std::max_element(values.begin(), values.end()), *std::min_element(values.begin(), values.end()));
+
+   // A second run with the same base seed must reproduce the distribution.
+   std::unique_ptr<SamplingDistribution> dist2{sampler.GetSamplingDistribution(paramPoint)};
+   ASSERT_NE(dist2, nullptr);
+   EXPECT_EQ(values, dist2->GetSamplingDistribution());
+}
+
+#endif // _WIN32
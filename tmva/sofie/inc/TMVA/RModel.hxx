@@ -147,6 +147,8 @@ public:
 
 protected:
    // internal functions
+   // fuse eligible operator pairs (e.g. Gemm followed by Relu) before initialization
+   void FuseOperators();
    // generate code for the initialized tensors
    void GenerateInitializedTensorInfo();
    // generate code for the intermediate tensors
@@ -68,6 +68,15 @@ namespace SOFIE{
          fOutputTensorNames = { fNY };
       }
 
+      // Fuse an activation into this Gemm, writing the result directly to the
+      // tensor named outputName. Used by RModel::FuseOperators() when the Gemm
+      // output is only consumed by an activation operator.
+      void FuseActivation(EActivationType activation, const std::string &outputName) {
+         fActivation = activation;
+         fNY = UTILITY::Clean_name(outputName);
+         fOutputTensorNames = { fNY };
+      }
+
       std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) override {
          ETensorType out = input[0];
          return {out};
@@ -2,6 +2,10 @@
 #define TMVA_SOFIE_SOFIE_HELPERS
 
 
+#include <ROOT/RVec.hxx>
+
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -50,6 +54,56 @@ public:
    }
 };
 
+///Helper class used by SofieBatchFunctor to evaluate a model generated
+///with a batch size larger than one on whole collections of events.
+template <typename Session_t, typename T>
+class SofieBatchFunctorHelper {
+   std::size_t fBatchSize; // batch size the model was generated with
+   std::size_t fNInputs;   // number of input variables per event
+   std::vector<std::vector<T>> fInput;
+   std::vector<Session_t> fSessions;
+
+public:
+   SofieBatchFunctorHelper(std::size_t batchSize, std::size_t nInputs, unsigned int nslots = 0,
+                           const std::string &filename = "")
+      : fBatchSize(batchSize), fNInputs(nInputs)
+   {
+      // create Sessions according to given number of slots.
+      // if number of slots is zero create a single session
+      if (nslots < 1) nslots = 1;
+      fInput.resize(nslots, std::vector<T>(fBatchSize * fNInputs));
+      fSessions.reserve(nslots);
+      for (unsigned int i = 0; i < nslots; i++) {
+         if (filename.empty())
+            fSessions.emplace_back();
+         else
+            fSessions.emplace_back(filename);
+      }
+   }
+
+   /// Evaluate the model on a flattened collection of events (its size must
+   /// be a multiple of the number of input variables). The session is invoked
+   /// once per batch of events instead of once per event; the last incomplete
+   /// batch is zero-padded and the outputs of the padding are discarded.
+   /// Returns the flattened model outputs of all events.
+   ROOT::RVec<T> operator()(unsigned slot, const ROOT::RVec<T> &events)
+   {
+      auto &input = fInput[slot];
+      auto &session = fSessions[slot];
+      const std::size_t nEvents = events.size() / fNInputs;
+      ROOT::RVec<T> out;
+      for (std::size_t first = 0; first < nEvents; first += fBatchSize) {
+         const std::size_t n = std::min(fBatchSize, nEvents - first);
+         std::copy(events.begin() + first * fNInputs, events.begin() + (first + n) * fNInputs, input.begin());
+         std::fill(input.begin() + n * fNInputs, input.end(), T{});
+         auto y = session.infer(input.data());
+         const std::size_t nOutPerEvent = y.size() / fBatchSize;
+         out.insert(out.end(), y.begin(), y.begin() + n * nOutPerEvent);
+      }
+      return out;
+   }
+};
+
 /// SofieFunctor : used to wrap the infer function of the
 /// generated model by SOFIE in a RDF compatible signature.
 /// The number of slots is an optional parameter used to
@@ -66,6 +120,22 @@ auto SofieFunctor(unsigned int nslots = 0, const std::string & weightsFile = "")
    return SofieFunctorHelper<std::make_index_sequence<N>, Session_t, float>(nslots, weightsFile);
 }
 
+/// SofieBatchFunctor : used to wrap the infer function of a SOFIE model
+/// generated with a batch size larger than one in a RDF compatible signature
+/// operating on collection columns. One call evaluates the model on all
+/// events (e.g. candidates) contained in the collection, amortizing the
+/// per-invocation overhead and letting the generated kernels work on the
+/// whole batch dimension at once. The model must be generated with the batch
+/// size passed as first argument, and nInputs is the number of input
+/// variables per event. As for SofieFunctor, pass the number of RDataFrame
+/// slots to allow for parallel evaluation.
+template <typename Session_t>
+auto SofieBatchFunctor(std::size_t batchSize, std::size_t nInputs, unsigned int nslots = 0,
+                       const std::string &weightsFile = "") -> SofieBatchFunctorHelper<Session_t, float>
+{
+   return SofieBatchFunctorHelper<Session_t, float>(batchSize, nInputs, nslots, weightsFile);
+}
+
 }//Experimental
 }//TMVA
 
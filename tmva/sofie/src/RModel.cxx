@@ -9,6 +9,8 @@
 #endif
 
 #include "TMVA/RModel.hxx"
+#include "TMVA/ROperator_Gemm.hxx"
+#include "TMVA/ROperator_Relu.hxx"
 #include "TMVA/SOFIE_common.hxx"
 
 namespace TMVA {
@@ -380,6 +382,51 @@ void RModel::Initialize(int batchSize, bool verbose) {
    Initialize(inputParams, verbose);
    fIntermediateMemoryInfo = MemoryPoolInfo();
 }
+// Fuse eligible pairs of operators into a single one. For the time being this
+// covers Gemm followed by Relu: the activation is folded into the epilogue of
+// the Gemm kernel, so the intermediate pre-activation tensor is never
+// allocated and the output array is traversed only once. This is done before
+// the operators are initialized, so the fused-away operators never register
+// their tensors.
+void RModel::FuseOperators()
+{
+   for (size_t i = 0; i < fOperators.size(); ++i) {
+      auto *gemm = dynamic_cast<ROperator_Gemm<float> *>(fOperators[i].get());
+      if (!gemm)
+         continue;
+      std::string_view gemmOut = gemm->GetOpOutputTensors()[0];
+      // the Gemm output must not be a model output and must be consumed by
+      // exactly one operator, otherwise it needs to stay materialized
+      if (std::find(fOutputTensorNames.begin(), fOutputTensorNames.end(), std::string(gemmOut)) !=
+          fOutputTensorNames.end())
+         continue;
+      size_t nConsumers = 0;
+      size_t consumerIdx = 0;
+      for (size_t j = 0; j < fOperators.size(); ++j) {
+         if (j == i)
+            continue;
+         for (auto &inputName : fOperators[j]->GetOpInputTensors()) {
+            if (inputName == gemmOut) {
+               ++nConsumers;
+               consumerIdx = j;
+            }
+         }
+      }
+      if (nConsumers != 1)
+         continue;
+      auto *relu = dynamic_cast<ROperator_Relu<float> *>(fOperators[consumerIdx].get());
+      if (!relu)
+         continue;
+      std::string reluOut{relu->GetOpOutputTensors()[0]};
+      if (fVerbose)
+         std::cout << "fusing Relu for tensor " << reluOut << " into preceding Gemm" << std::endl;
+      gemm->FuseActivation(EActivationType::RELU, reluOut);
+      fOperators.erase(fOperators.begin() + consumerIdx);
+      if (consumerIdx < i)
+         --i;
+   }
+}
+
 void RModel::Initialize(const std::map<std::string, size_t> & inputParams, bool verbose) {
 
    fVerbose = int(verbose);
@@ -392,6 +439,10 @@ void RModel::Initialize(const std::map<std::string, size_t> & inputParams, bool
    fIntermediateTensorInfos.clear();
    fDynamicTensorInfos.clear();
 
+   // fuse eligible operator pairs before the operators register their tensors
+   if (fOptimizationLevel == OptimizationLevel::kExtended)
+      FuseOperators();
+
    // loop on inputs and see if shape can be  full specified
    // if the batch size is provided it can be used to specify the full shape
    // Add the full specified tensors in fReadyInputTensors collection
@@ -0,0 +1,55 @@
+// Tests for the batched SOFIE RDataFrame functor
+
+#include "TMVA/SOFIEHelpers.hxx"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+// Mock session standing in for a SOFIE-generated one: batch size 4, two input
+// variables per event, one output per event (the sum of the two inputs)
+struct MockSession {
+   static constexpr std::size_t batchSize = 4;
+   static constexpr std::size_t nInputs = 2;
+
+   MockSession() = default;
+   MockSession(const std::string &) {}
+
+   std::vector<float> infer(const float *input)
+   {
+      nCalls++;
+      std::vector<float> out(batchSize);
+      for (std::size_t i = 0; i < batchSize; ++i) {
+         out[i] = input[i * nInputs] + input[i * nInputs + 1];
+      }
+      return out;
+   }
+
+   int nCalls = 0;
+};
+
+} // namespace
+
+TEST(SofieBatchFunctor, ChunkedEvaluation)
+{
+   auto functor = TMVA::Experimental::SofieBatchFunctor<MockSession>(MockSession::batchSize, MockSession::nInputs, 2);
+
+   // 6 events of 2 variables each: one full batch plus a padded one
+   ROOT::RVec<float> events;
+   for (int i = 0; i < 6; ++i) {
+      events.push_back(i);
+      events.push_back(0.5f * i);
+   }
+
+   auto out = functor(1u, events);
+   ASSERT_EQ(out.size(), 6u);
+   for (int i = 0; i < 6; ++i) {
+      EXPECT_FLOAT_EQ(out[i], 1.5f * i);
+   }
+
+   // an empty collection yields no outputs and no model invocation
+   EXPECT_TRUE(functor(0u, {}).empty());
+}
@@ -0,0 +1,59 @@
+// Tests for the operator fusion pass in RModel
+
+#include "TMVA/RModel.hxx"
+#include "TMVA/ROperator_Gemm.hxx"
+#include "TMVA/ROperator_Relu.hxx"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace TMVA::Experimental::SOFIE;
+
+namespace {
+
+// A minimal MLP layer: Gemm with bias followed by a Relu
+RModel makeGemmReluModel(std::vector<std::string> const &outputNames)
+{
+   RModel model("FusionTest", "");
+   model.AddInputTensorInfo("A", ETensorType::FLOAT, std::vector<size_t>{1, 4});
+   model.AddInputTensorName("A");
+   std::vector<float> weights(16, 0.5f);
+   model.AddInitializedTensor<float>("B", {4, 4}, weights.data());
+   std::vector<float> bias(4, 0.25f);
+   model.AddInitializedTensor<float>("C", {1, 4}, bias.data());
+   model.AddOperator(std::make_unique<ROperator_Gemm<float>>(1.0, 1.0, 0, 0, "A", "B", "C", "G"));
+   model.AddOperator(std::make_unique<ROperator_Relu<float>>("G", "Y"));
+   model.AddOutputTensorNameList(outputNames);
+   return model;
+}
+
+} // namespace
+
+TEST(SOFIE, GemmReluFusion)
+{
+   RModel model = makeGemmReluModel({"Y"});
+   model.Generate(Options::kNoWeightFile);
+   const std::string code = model.ReturnGenerated();
+
+   // The standalone Relu loop must be gone: the activation is applied in the
+   // epilogue of the Gemm kernel, which writes directly to the output tensor.
+   EXPECT_EQ(code.find("//------ RELU"), std::string::npos);
+   // The pre-activation tensor is no longer materialized
+   EXPECT_EQ(code.find("tensor_G"), std::string::npos);
+   EXPECT_NE(code.find("tensor_Y"), std::string::npos);
+}
+
+TEST(SOFIE, GemmReluFusionSkippedForModelOutput)
+{
+   // If the Gemm output is also a model output it must stay materialized, so
+   // the pair cannot be fused
+   RModel model = makeGemmReluModel({"G", "Y"});
+   model.Generate(Options::kNoWeightFile);
+   const std::string code = model.ReturnGenerated();
+
+   EXPECT_NE(code.find("//------ RELU"), std::string::npos);
+   EXPECT_NE(code.find("tensor_G"), std::string::npos);
+}
@@ -51,6 +51,10 @@ private:
    std::unique_ptr<TMVA::Experimental::RTensor<float>> fTrainingRemainder;
    std::unique_ptr<TMVA::Experimental::RTensor<float>> fValidationRemainder;
 
+   // Pool of returned full-size batch tensors, reused for the next batches so
+   // that steady-state batch creation does not allocate
+   std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fBatchPool;
+
 public:
    RBatchLoader(const TMVA::Experimental::RTensor<float> &chunkTensor, const std::size_t batchSize,
                 const std::size_t numColumns, const std::size_t maxBatches)
@@ -79,6 +83,11 @@ public:
          return *fCurrentBatch;
       }
 
+      // The consumer is done with the previous batch, recycle its tensor
+      if (fCurrentBatch && fCurrentBatch->GetShape()[0] == fBatchSize && fBatchPool.size() < fMaxBatches) {
+         fBatchPool.emplace_back(std::move(fCurrentBatch));
+      }
+
       fCurrentBatch = std::move(fTrainingBatchQueue.front());
       fTrainingBatchQueue.pop();
 
@@ -98,6 +107,13 @@ public:
          return *fCurrentBatch;
       }
 
+      if (fCurrentBatch && fCurrentBatch->GetShape()[0] == fBatchSize) {
+         std::lock_guard<std::mutex> lock(fBatchLock);
+         if (fBatchPool.size() < fMaxBatches) {
+            fBatchPool.emplace_back(std::move(fCurrentBatch));
+         }
+      }
+
       fCurrentBatch = std::move(fValidationBatchQueue.front());
       fValidationBatchQueue.pop();
 
@@ -128,12 +144,28 @@ public:
       fBatchCondition.notify_all();
    }
 
+   /// \brief Get a tensor for a full-size batch, reusing a recycled one when available
+   std::unique_ptr<TMVA::Experimental::RTensor<float>> AcquireBatch()
+   {
+      {
+         std::lock_guard<std::mutex> lock(fBatchLock);
+         if (!fBatchPool.empty()) {
+            auto batch = std::move(fBatchPool.back());
+            fBatchPool.pop_back();
+            return batch;
+         }
+      }
+      return std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>{fBatchSize, fNumColumns});
+   }
+
    std::unique_ptr<TMVA::Experimental::RTensor<float>>
    CreateBatch(const TMVA::Experimental::RTensor<float> &chunkTensor, std::span<const std::size_t> idxs,
                std::size_t batchSize)
    {
-      auto batch =
-         std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({batchSize, fNumColumns}));
+      auto batch = batchSize == fBatchSize
+                      ? AcquireBatch()
+                      : std::make_unique<TMVA::Experimental::RTensor<float>>(
+                           std::vector<std::size_t>({batchSize, fNumColumns}));
 
       for (std::size_t i = 0; i < batchSize; i++) {
          std::copy(chunkTensor.GetData() + (idxs[i] * fNumColumns),
@@ -147,8 +179,7 @@ public:
    CreateFirstBatch(const TMVA::Experimental::RTensor<float> &remainderTensor, std::size_t remainderTensorRow,
                     std::span<const std::size_t> eventIndices)
    {
-      auto batch =
-         std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({fBatchSize, fNumColumns}));
+      auto batch = AcquireBatch();
 
       for (size_t i = 0; i < remainderTensorRow; i++) {
          std::copy(remainderTensor.GetData() + i * fNumColumns, remainderTensor.GetData() + (i + 1) * fNumColumns,
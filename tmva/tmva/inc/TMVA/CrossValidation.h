@@ -133,9 +133,11 @@ public:
 
    void SetNumFolds(UInt_t i);
    void SetSplitExpr(TString splitExpr);
+   void SetNumWorkerProcs(UInt_t i) { fNumWorkerProcs = i; }
 
    UInt_t GetNumFolds() { return fNumFolds; }
    TString GetSplitExpr() { return fSplitExprString; }
+   UInt_t GetNumWorkerProcs() const { return fNumWorkerProcs; }
 
    Factory &GetFactory() { return *fFactory; }
 
@@ -146,6 +146,10 @@ namespace TMVA {
       // get the forest
       inline const std::vector<TMVA::DecisionTree*> & GetForest() const;
 
+      // access to settings needed to evaluate the trained forest outside of this class
+      const TString& GetBoostType() const { return fBoostType; }
+      Bool_t GetUseYesNoLeaf() const { return fUseYesNoLeaf; }
+
       // get the forest
       inline const std::vector<const TMVA::Event*> & GetTrainingEvents() const;
 
@@ -32,6 +32,9 @@
 
 namespace TMVA {
 
+class DecisionTree;
+class MethodBDT;
+
 namespace Experimental {
 
 class RBDT final {
@@ -65,6 +68,10 @@ public:
    static RBDT LoadText(std::string const &txtpath, std::vector<std::string> &features, int nClasses, bool logistic,
                         Value_t baseScore);
 
+   static RBDT FromTMVA(TMVA::MethodBDT const &method);
+   static RBDT FromTMVA(std::vector<TMVA::DecisionTree *> const &forest, std::vector<double> const &boostWeights,
+                        std::string const &boostType, int nClasses, bool useYesNoLeaf);
+
 private:
    /// Map from XGBoost to RBDT indices.
    using IndexMap = std::unordered_map<int, int>;
@@ -88,8 +95,13 @@ private:
    std::vector<Value_t> fBaseResponses;
    Value_t fBaseScore = 0.0;
    bool fLogistic = false;
+   /// Linear transformation applied to the binary response after the optional
+   /// logistic function, needed to reproduce the [-1,1] output of TMVA
+   /// gradient-boosted classification.
+   Value_t fOutputScale = 1.0;
+   Value_t fOutputOffset = 0.0;
 
-   ClassDefNV(RBDT, 1);
+   ClassDefNV(RBDT, 2);
 };
 
 } // namespace Experimental
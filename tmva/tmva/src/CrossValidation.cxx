@@ -32,6 +32,7 @@
 #include "TLegend.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -266,6 +267,14 @@ dataloader->AddTree( background, "cls2" );
 dataloader->PrepareTrainingAndTestTree( "", "", "nTest_cls1=1:nTest_cls2=1" );
 ~~~
 
+## Parallel fold evaluation
+With the `NumWorkerProcs` option (or `SetNumWorkerProcs`) the folds are
+trained and evaluated in parallel worker processes. The workers are forked
+after the dataset has been read and transformed, so they share a single
+immutable copy of the event data through copy-on-write memory; only the
+per-fold event lists are built in each worker. `NumWorkerProcs=0` uses one
+worker per available cpu.
+
 ## Split Expression
 See CVSplit documentation?
 
@@ -617,6 +626,13 @@ void TMVA::CrossValidation::Evaluate()
          // Fall back to global config
          nWorkers = TMVA::gConfig().GetNumWorkers();
       }
+#ifdef _MSC_VER
+      if (nWorkers > 1) {
+         Log() << kWARNING << "Parallel fold evaluation is not supported on Windows, processing the folds serially."
+               << Endl;
+         nWorkers = 1;
+      }
+#endif
       if (nWorkers == 1) {
          for (UInt_t iFold = 0; iFold < fNumFolds; ++iFold) {
             auto fold_result = ProcessFold(iFold, methodInfo);
@@ -624,6 +640,11 @@ void TMVA::CrossValidation::Evaluate()
          }
       } else {
 #ifndef _MSC_VER
+         // The fold workers are forked processes. They inherit the already
+         // transformed dataset of the parent read-only through copy-on-write
+         // memory, so the folds train on nWorkers cores while sharing a single
+         // copy of the event data; each worker only materialises the per-fold
+         // event pointer lists in PrepareFoldDataSet().
          ROOT::TProcessExecutor workers(nWorkers);
          std::vector<CrossValidationFoldResult> result_vector;
 
@@ -633,6 +654,12 @@ void TMVA::CrossValidation::Evaluate()
 
          result_vector = workers.Map(workItem, ROOT::TSeqI(fNumFolds));
 
+         // Fold results can come back in any order
+         std::sort(result_vector.begin(), result_vector.end(),
+                   [](CrossValidationFoldResult const &a, CrossValidationFoldResult const &b) {
+                      return a.fFold < b.fFold;
+                   });
+
          for (auto && fold_result : result_vector) {
             result.Fill(fold_result);
          }
@@ -18,6 +18,10 @@
 
 #include <TMVA/RBDT.hxx>
 
+#include <TMVA/DecisionTree.h>
+#include <TMVA/DecisionTreeNode.h>
+#include <TMVA/MethodBDT.h>
+
 #include <ROOT/StringUtils.hxx>
 
 #include <TFile.h>
@@ -25,7 +29,9 @@
 
 #include <cmath>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <stdlib.h>
@@ -163,6 +169,7 @@ void TMVA::Experimental::RBDT::ComputeImpl(const Value_t *array, Value_t *out) c
       if (fLogistic) {
          out[0] = 1.0 / (1.0 + std::exp(-out[0]));
       }
+      out[0] = fOutputScale * out[0] + fOutputOffset;
    }
 }
 
@@ -354,6 +361,129 @@ TMVA::Experimental::RBDT TMVA::Experimental::RBDT::LoadText(std::istream &file,
    return ff;
 }
 
+/// Compact a trained forest of TMVA decision trees into the flat node arrays
+/// of an RBDT, reproducing the classification output of MethodBDT.
+///
+/// The pointer-linked DecisionTreeNode objects are flattened into contiguous
+/// arrays with index-based children, so the evaluation is the same fast
+/// traversal that is used for models imported from XGBoost. Supported are
+/// binary classification with gradient boosting (the \f$2/(1+e^{-2s})-1\f$
+/// output transformation is reproduced exactly), binary classification with
+/// weighted-average boosting like AdaBoost or Bagging (the boost weights are
+/// folded into the leaf responses), and multiclass gradient boosting (one
+/// tree per class per boosting round, followed by a softmax). Regression
+/// forests and trees with Fisher-discriminant cuts are not supported.
+///
+/// \param forest the trained decision trees, e.g. from MethodBDT::GetForest()
+/// \param boostWeights the per-tree boost weights, used for non-gradient boosting
+/// \param boostType the BoostType option the forest was trained with
+/// \param nClasses number of classes (2 for binary classification)
+/// \param useYesNoLeaf the UseYesNoLeaf option the forest was trained with
+TMVA::Experimental::RBDT TMVA::Experimental::RBDT::FromTMVA(std::vector<TMVA::DecisionTree *> const &forest,
+                                                            std::vector<double> const &boostWeights,
+                                                            std::string const &boostType, int nClasses,
+                                                            bool useYesNoLeaf)
+{
+   const std::string info = "constructing RBDT from TMVA forest: ";
+
+   RBDT ff;
+   const bool isGrad = boostType == "Grad";
+   const bool multiclass = nClasses > 2;
+   ff.fBaseResponses.resize(multiclass ? nClasses : 1);
+
+   double norm = 1.0;
+   if (!isGrad && !multiclass) {
+      norm = 0.0;
+      for (double w : boostWeights) {
+         norm += w;
+      }
+      if (norm <= std::numeric_limits<double>::epsilon()) {
+         throw std::runtime_error(info + "sum of boost weights is zero");
+      }
+   }
+   if (isGrad && !multiclass) {
+      // MethodBDT::GetGradBoostMVA() returns 2/(1+exp(-2*sum))-1, which is
+      // expressed here as the logistic function of the doubled leaf responses
+      // followed by a linear transformation
+      ff.fLogistic = true;
+      ff.fOutputScale = 2.0;
+      ff.fOutputOffset = -1.0;
+   }
+
+   IndexMap nodeIndices;
+   IndexMap leafIndices;
+   int nPreviousNodes = 0;
+   int nPreviousLeaves = 0;
+   int treesSkipped = 0;
+
+   for (std::size_t itree = 0; itree < forest.size(); ++itree) {
+      TMVA::DecisionTree const &tree = *forest[itree];
+      // Gradient-boosted trees store their response in the leaves; for the
+      // other boost types the leaf value is the node type (+-1) or the purity,
+      // as in DecisionTree::CheckEvent(). The multiclass response ignores the
+      // boost weights, see MethodBDT::GetMulticlassValues().
+      double scale = 1.0;
+      if (!multiclass) {
+         scale = isGrad ? 2.0 : boostWeights[itree] / norm;
+      }
+
+      int nextId = 0;
+      std::function<int(TMVA::DecisionTreeNode const *)> visit = [&](TMVA::DecisionTreeNode const *node) -> int {
+         const int id = nextId++;
+         if (node->GetNodeType() == 0) { // intermediate node
+            if (node->GetNFisherCoeff() > 0) {
+               throw std::runtime_error(info + "trees with Fisher-discriminant cuts are not supported");
+            }
+            const std::size_t pos = ff.fCutValues.size();
+            nodeIndices[id] = pos;
+            ff.fCutIndices.push_back(node->GetSelector());
+            ff.fCutValues.push_back(node->GetCutValue());
+            ff.fLeftIndices.push_back(0);
+            ff.fRightIndices.push_back(0);
+            // the cut type flips which child is taken for values above the cut
+            TMVA::DecisionTreeNode const *left = node->GetCutType() ? node->GetLeft() : node->GetRight();
+            TMVA::DecisionTreeNode const *right = node->GetCutType() ? node->GetRight() : node->GetLeft();
+            const int leftId = visit(left);
+            const int rightId = visit(right);
+            ff.fLeftIndices[pos] = leftId;
+            ff.fRightIndices[pos] = rightId;
+         } else { // leaf node
+            leafIndices[id] = ff.fResponses.size();
+            const double value =
+               tree.DoRegression() ? node->GetResponse() : (useYesNoLeaf ? node->GetNodeType() : node->GetPurity());
+            ff.fResponses.push_back(scale * value);
+         }
+         return id;
+      };
+      visit(tree.GetRoot());
+
+      terminateTree(ff, nPreviousNodes, nPreviousLeaves, nodeIndices, leafIndices, treesSkipped);
+   }
+
+   if (multiclass && (ff.fRootIndices.size() + treesSkipped) % nClasses != 0) {
+      std::stringstream ss;
+      ss << info << "forest has " << ff.fRootIndices.size() + treesSkipped
+         << " trees, which is not compatible with " << nClasses << " classes!";
+      throw std::runtime_error(ss.str());
+   }
+
+   return ff;
+}
+
+/// Compact the trained forest of a MethodBDT into an RBDT, see the
+/// documentation of the overload taking the forest directly for the
+/// supported configurations.
+TMVA::Experimental::RBDT TMVA::Experimental::RBDT::FromTMVA(TMVA::MethodBDT const &method)
+{
+   if (method.GetAnalysisType() == TMVA::Types::kRegression) {
+      throw std::runtime_error("constructing RBDT from TMVA forest: regression is not supported");
+   }
+   const bool multiclass = method.GetAnalysisType() == TMVA::Types::kMulticlass;
+   const int nClasses = multiclass ? method.DataInfo().GetNClasses() : 2;
+   return FromTMVA(method.GetForest(), method.GetBoostWeights(), method.GetBoostType().Data(), nClasses,
+                   method.GetUseYesNoLeaf());
+}
+
 TMVA::Experimental::RBDT::RBDT(const std::string &key, const std::string &filename)
 {
    std::unique_ptr<TFile> file{TFile::Open(filename.c_str(), "READ")};
@@ -0,0 +1,116 @@
+// Tests for the conversion of trained TMVA BDT forests to RBDT
+
+#include <TMVA/RBDT.hxx>
+
+#include <TMVA/DecisionTree.h>
+#include <TMVA/DecisionTreeNode.h>
+#include <TMVA/Types.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using TMVA::Experimental::RBDT;
+
+namespace {
+
+// Build a depth-one decision tree with a single cut on the given variable.
+// The leaf values are stored both as response (used by gradient-boosted
+// trees) and as node type (used with the UseYesNoLeaf option).
+std::unique_ptr<TMVA::DecisionTree> makeStumpTree(Short_t selector, Float_t cutValue, Bool_t cutType,
+                                                  Float_t leftValue, Float_t rightValue, bool regression)
+{
+   auto *root = new TMVA::DecisionTreeNode{};
+   root->SetSelector(selector);
+   root->SetCutValue(cutValue);
+   root->SetCutType(cutType);
+   root->SetNodeType(0);
+
+   auto *left = new TMVA::DecisionTreeNode{};
+   left->SetNodeType(leftValue < 0 ? -1 : 1);
+   left->SetResponse(leftValue);
+   root->SetLeft(left);
+
+   auto *right = new TMVA::DecisionTreeNode{};
+   right->SetNodeType(rightValue < 0 ? -1 : 1);
+   right->SetResponse(rightValue);
+   root->SetRight(right);
+
+   auto tree = std::make_unique<TMVA::DecisionTree>();
+   tree->SetRoot(root);
+   // gradient-boosted trees are flagged as regression trees in MethodBDT
+   tree->SetAnalysisType(regression ? TMVA::Types::kRegression : TMVA::Types::kClassification);
+   return tree;
+}
+
+std::vector<TMVA::DecisionTree *> rawPointers(std::vector<std::unique_ptr<TMVA::DecisionTree>> const &forest)
+{
+   std::vector<TMVA::DecisionTree *> out;
+   for (auto const &tree : forest) {
+      out.push_back(tree.get());
+   }
+   return out;
+}
+
+} // namespace
+
+// Binary classification with gradient boosting: the responses are summed up
+// and transformed with 2/(1+exp(-2*sum))-1, i.e. tanh(sum).
+TEST(RBDTFromTMVA, GradBinary)
+{
+   std::vector<std::unique_ptr<TMVA::DecisionTree>> forest;
+   forest.emplace_back(makeStumpTree(0, 0.5, true, 0.2, -0.3, true));
+   // a false cut type swaps the meaning of the two children
+   forest.emplace_back(makeStumpTree(1, 1.0, false, 0.4, -0.1, true));
+
+   RBDT bdt = RBDT::FromTMVA(rawPointers(forest), {1.0, 1.0}, "Grad", 2, false);
+
+   // x0 < 0.5 takes the left leaf of the first tree; x1 >= 1.0 with inverted
+   // cut type takes the left leaf of the second tree
+   auto out = bdt.Compute(std::vector<float>{0.0, 2.0});
+   ASSERT_EQ(out.size(), 1u);
+   EXPECT_FLOAT_EQ(out[0], std::tanh(0.2f + 0.4f));
+
+   // x0 >= 0.5 and x1 < 1.0 take the two right leaves
+   out = bdt.Compute(std::vector<float>{1.0, 0.5});
+   EXPECT_FLOAT_EQ(out[0], std::tanh(-0.3f - 0.1f));
+}
+
+// Binary classification with AdaBoost and UseYesNoLeaf: the +-1 leaf values
+// are averaged with the boost weights.
+TEST(RBDTFromTMVA, AdaBoostBinary)
+{
+   std::vector<std::unique_ptr<TMVA::DecisionTree>> forest;
+   forest.emplace_back(makeStumpTree(0, 0.5, true, 1.0, -1.0, false));
+   forest.emplace_back(makeStumpTree(0, 1.5, true, 1.0, -1.0, false));
+
+   RBDT bdt = RBDT::FromTMVA(rawPointers(forest), {3.0, 1.0}, "AdaBoost", 2, true);
+
+   // x0 = 1.0 is above the first cut and below the second one
+   auto out = bdt.Compute(std::vector<float>{1.0});
+   ASSERT_EQ(out.size(), 1u);
+   EXPECT_FLOAT_EQ(out[0], (3.0f * -1.0f + 1.0f * 1.0f) / 4.0f);
+}
+
+// Multiclass gradient boosting: one tree per class, the boost weights are
+// ignored and the per-class sums are passed through a softmax.
+TEST(RBDTFromTMVA, GradMulticlass)
+{
+   std::vector<std::unique_ptr<TMVA::DecisionTree>> forest;
+   forest.emplace_back(makeStumpTree(0, 0.0, true, -0.5, 0.3, true));
+   forest.emplace_back(makeStumpTree(0, 0.0, true, -0.5, 0.1, true));
+   forest.emplace_back(makeStumpTree(0, 0.0, true, -0.5, -0.2, true));
+
+   RBDT bdt = RBDT::FromTMVA(rawPointers(forest), {1.0, 1.0, 1.0}, "Grad", 3, false);
+
+   // x0 >= 0 takes the right leaf of each tree
+   auto out = bdt.Compute(std::vector<float>{1.0});
+   ASSERT_EQ(out.size(), 3u);
+   const float norm = std::exp(0.3f) + std::exp(0.1f) + std::exp(-0.2f);
+   EXPECT_FLOAT_EQ(out[0], std::exp(0.3f) / norm);
+   EXPECT_FLOAT_EQ(out[1], std::exp(0.1f) / norm);
+   EXPECT_FLOAT_EQ(out[2], std::exp(-0.2f) / norm);
+   EXPECT_FLOAT_EQ(out[0] + out[1] + out[2], 1.0f);
+}
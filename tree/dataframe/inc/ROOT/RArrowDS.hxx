@@ -59,6 +59,10 @@ public:
 
 RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columnNames);
 
+RDataFrame FromArrowIPC(std::string_view fileName, std::vector<std::string> const &columnNames = {});
+
+void ToArrowIPC(ROOT::RDF::RNode df, std::string_view fileName, std::vector<std::string> columnNames = {});
+
 } // namespace RDF
 
 } // namespace ROOT
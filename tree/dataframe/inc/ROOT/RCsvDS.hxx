@@ -16,7 +16,9 @@
 
 #include <cstdint>
 #include <deque>
+#include <future>
 #include <list>
+#include <mutex>
 #include <unordered_map>
 #include <set>
 #include <memory>
@@ -89,9 +91,11 @@ private:
    std::vector<std::string> fHeaders; // the column names
    std::unordered_map<std::string, ColType_t> fColTypes;
    std::set<std::string> fColContainingEmpty; // store columns which had empty entry
+   std::mutex fColEmptyMutex; // protects fColContainingEmpty when records are filled in parallel
    std::list<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
    std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot] (same ordering as fHeaders)
    std::vector<Record_t> fRecords;                         // fRecords[entry][column] (same ordering as fHeaders)
+   std::future<std::vector<Record_t>> fPrefetchedRecords;  // next chunk of records, read in the background
    std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
    std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
    std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
@@ -110,10 +114,13 @@ private:
    void ValidateColTypes(std::vector<std::string> &) const;
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
-   std::vector<std::string> ParseColumns(const std::string &);
-   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   std::vector<std::string> ParseColumns(const std::string &) const;
+   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t) const;
    ColType_t GetType(std::string_view colName) const;
+   std::vector<Record_t> ReadRecordChunk();
+   void FreeRecords(std::vector<Record_t> &records);
    void FreeRecords();
+   void DiscardPrefetchedRecords();
 
 protected:
    std::string AsString() final;
@@ -133,6 +140,7 @@ public:
    std::size_t GetNFiles() const final { return 1; }
    const std::vector<std::string> &GetColumnNames() const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
+   void PrefetchEntryRanges() final;
    std::string GetTypeName(std::string_view colName) const final;
    bool HasColumn(std::string_view colName) const final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
@@ -31,9 +31,12 @@
 #include "TObject.h"
 #include "ROOT/RDF/RActionImpl.hxx"
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "ROOT/RDF/RQuantileSketch.hxx"
+#include "ROOT/RDF/RReservoirSample.hxx"
 
 #include <algorithm>
 #include <array>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -324,6 +327,44 @@ void ResetIfPossible(...);
 void UnsetDirectoryIfPossible(TH1 *h);
 void UnsetDirectoryIfPossible(...);
 
+/// Run independent result-merging tasks, in parallel if implicit multi-threading is enabled.
+void RunMergeTasks(std::vector<std::function<void()>> &tasks);
+
+/// Merge all objects into the first one via pairwise tree reduction.
+/// Every round merges pairs of partial results, in parallel if implicit multi-threading is enabled, until only the
+/// first object is left. For heavyweight results (e.g. large TH3Ds) a sequential merge of all slots into the first
+/// object would dominate the finalization time.
+template <typename H>
+auto MergePairwise(std::vector<H *> &objs) -> decltype(objs[0]->Merge((TCollection *)nullptr), void())
+{
+   std::vector<H *> level(objs.begin(), objs.end());
+   std::vector<std::function<void()>> tasks;
+   while (level.size() > 1) {
+      tasks.clear();
+      std::vector<H *> survivors;
+      for (std::size_t i = 0; i + 1 < level.size(); i += 2) {
+         H *dst = level[i];
+         H *src = level[i + 1];
+         survivors.push_back(dst);
+         tasks.emplace_back([dst, src] {
+            TList l;
+            l.Add(src);
+            dst->Merge(&l);
+         });
+      }
+      if (level.size() % 2 == 1)
+         survivors.push_back(level.back());
+      RunMergeTasks(tasks);
+      level = std::move(survivors);
+   }
+}
+
+/// Whether T is one of the concrete one-dimensional histogram types, which can be filled in bulk via TH1::FillN.
+/// Derived types such as TProfile or TH2 are excluded: they override Fill and FillN with different semantics.
+template <typename T>
+struct IsPlainTH1 : Disjunction<std::is_same<T, TH1C>, std::is_same<T, TH1S>, std::is_same<T, TH1I>,
+                                std::is_same<T, TH1L>, std::is_same<T, TH1F>, std::is_same<T, TH1D>> {};
+
 /// The generic Fill helper: it calls Fill on per-thread objects and then Merge to produce a final result.
 /// For one-dimensional histograms, if no axes are specified, RDataFrame uses BufferedFillHelper instead.
 template <typename HIST = Hist_t>
@@ -335,10 +376,7 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    auto Merge(std::vector<H *> &objs, int /*toincreaseoverloadpriority*/)
       -> decltype(objs[0]->Merge((TCollection *)nullptr), void())
    {
-      TList l;
-      for (auto it = ++objs.begin(); it != objs.end(); ++it)
-         l.Add(*it);
-      objs[0]->Merge(&l);
+      MergePairwise(objs);
    }
 
    // Merge overload for types with Merge(const std::vector&)
@@ -365,6 +403,27 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
       }
    }
 
+   /// One scratch buffer per thread and per argument position, for on-the-fly conversions to double in bulk fills.
+   template <std::size_t ArgIdx>
+   static std::vector<double> &GetConversionBuffer()
+   {
+      thread_local std::vector<double> buffer;
+      return buffer;
+   }
+
+   /// Return the values of v as a contiguous array of doubles, converting them into buf if they are of another type.
+   template <typename T>
+   static const double *GetDoubleData(const RVec<T> &v, std::vector<double> &buf)
+   {
+      if constexpr (std::is_same<T, double>::value) {
+         (void)buf;
+         return v.data();
+      } else {
+         buf.assign(v.begin(), v.end());
+         return buf.data();
+      }
+   }
+
 public:
    FillHelper(FillHelper &&) = default;
    FillHelper(const FillHelper &) = delete;
@@ -415,6 +474,28 @@ public:
       ExecLoop<colidx>(slot, xrefend, MakeBegin(xs)...);
    }
 
+   // Bulk fill of a one-dimensional histogram from a collection column, avoiding one virtual Fill call per element.
+   // The values are streamed directly from the RVec's buffer (which for TTree inputs is typically the
+   // TTreeReaderArray's buffer) into TH1::FillN, converting to double on the fly if needed.
+   template <typename T, typename H = HIST,
+             std::enable_if_t<std::is_arithmetic<T>::value && IsPlainTH1<H>::value, int> = 0>
+   void Exec(unsigned int slot, const RVec<T> &xs)
+   {
+      fObjects[slot]->FillN(static_cast<Int_t>(xs.size()), GetDoubleData(xs, GetConversionBuffer<0>()), /*w=*/nullptr);
+   }
+
+   // Bulk fill of a one-dimensional histogram from a collection column and a collection of weights.
+   template <typename T, typename W, typename H = HIST,
+             std::enable_if_t<std::is_arithmetic<T>::value && std::is_arithmetic<W>::value && IsPlainTH1<H>::value,
+                              int> = 0>
+   void Exec(unsigned int slot, const RVec<T> &xs, const RVec<W> &ws)
+   {
+      if (xs.size() != ws.size())
+         throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
+      fObjects[slot]->FillN(static_cast<Int_t>(xs.size()), GetDoubleData(xs, GetConversionBuffer<0>()),
+                            GetDoubleData(ws, GetConversionBuffer<1>()));
+   }
+
    template <typename T = HIST>
    void Exec(...)
    {
@@ -760,11 +841,11 @@ public:
    void Finalize()
    {
       if (fObjects.size() > 1) {
-         TList list;
-         for (auto it = fObjects.cbegin() + 1; it != fObjects.end(); ++it) {
-            list.Add(it->get());
-         }
-         fObjects[0]->Merge(&list);
+         std::vector<HIST *> objs;
+         objs.reserve(fObjects.size());
+         for (auto &obj : fObjects)
+            objs.push_back(obj.get());
+         MergePairwise(objs);
       }
 
       fObjects.resize(1);
@@ -1316,6 +1397,95 @@ public:
    }
 };
 
+class R__CLING_PTRCHECK(off) QuantileHelper : public RActionImpl<QuantileHelper> {
+   std::shared_ptr<std::vector<double>> fResultQuantiles;
+   /// The requested quantile levels, in [0, 1].
+   std::vector<double> fLevels;
+   /// One sketch per slot; Finalize merges them all into the first one.
+   std::vector<RQuantileSketch> fSketches;
+
+public:
+   QuantileHelper(const std::shared_ptr<std::vector<double>> &quantilesVPtr, const std::vector<double> &levels,
+                  std::size_t compression, const unsigned int nSlots);
+   QuantileHelper(QuantileHelper &&) = default;
+   QuantileHelper(const QuantileHelper &) = delete;
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Exec(unsigned int slot, double v) { fSketches[slot].Add(v); }
+
+   template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
+   void Exec(unsigned int slot, const T &vs)
+   {
+      for (auto &&v : vs)
+         fSketches[slot].Add(v);
+   }
+
+   void Initialize() { /* noop */}
+
+   void Finalize();
+
+   // Helper functions for RMergeableValue
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      // After Finalize the first sketch holds the full summary.
+      return std::make_unique<RMergeableQuantile>(*fResultQuantiles, fLevels, fSketches[0]);
+   }
+
+   std::string GetActionName() { return "Quantile"; }
+
+   QuantileHelper MakeNew(void *newResult, std::string_view /*variation*/ = "nominal")
+   {
+      auto &result = *static_cast<std::shared_ptr<std::vector<double>> *>(newResult);
+      return QuantileHelper(result, fLevels, fSketches[0].GetCompression(), fSketches.size());
+   }
+};
+
+template <typename T>
+class R__CLING_PTRCHECK(off) ReservoirSampleHelper : public RActionImpl<ReservoirSampleHelper<T>> {
+   std::shared_ptr<std::vector<T>> fResultSample;
+   std::size_t fSampleSize;
+   /// One reservoir per slot; Finalize merges them all into the first one.
+   std::vector<RReservoirSample<T>> fReservoirs;
+
+public:
+   ReservoirSampleHelper(const std::shared_ptr<std::vector<T>> &samplePtr, std::size_t sampleSize,
+                         const unsigned int nSlots)
+      : fResultSample(samplePtr), fSampleSize(sampleSize)
+   {
+      fReservoirs.reserve(nSlots);
+      for (unsigned int slot = 0; slot < nSlots; ++slot)
+         fReservoirs.emplace_back(sampleSize, /*seed=*/slot);
+   }
+   ReservoirSampleHelper(ReservoirSampleHelper &&) = default;
+   ReservoirSampleHelper(const ReservoirSampleHelper &) = delete;
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Exec(unsigned int slot, const T &value) { fReservoirs[slot].Add(value); }
+
+   void Initialize() { /* noop */}
+
+   void Finalize()
+   {
+      auto &merged = fReservoirs[0];
+      for (std::size_t slot = 1; slot < fReservoirs.size(); ++slot)
+         merged.Merge(fReservoirs[slot]);
+      *fResultSample = merged.GetSample();
+   }
+
+   // Helper functions for RMergeableValue
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      // After Finalize the first reservoir has seen the values of all slots.
+      return std::make_unique<RMergeableReservoirSample<T>>(*fResultSample, fReservoirs[0].GetSeen(), fSampleSize);
+   }
+
+   std::string GetActionName() { return "ReservoirSample"; }
+
+   ReservoirSampleHelper MakeNew(void *newResult, std::string_view /*variation*/ = "nominal")
+   {
+      auto &result = *static_cast<std::shared_ptr<std::vector<T>> *>(newResult);
+      return ReservoirSampleHelper(result, fSampleSize, fReservoirs.size());
+   }
+};
+
 template <typename PrevNodeType>
 class R__CLING_PTRCHECK(off) DisplayHelper : public RActionImpl<DisplayHelper<PrevNodeType>> {
 private:
@@ -99,6 +99,8 @@ struct Sum{};
 struct Mean{};
 struct Fill{};
 struct StdDev{};
+struct Quantile{};
+struct ReservoirSample{};
 struct Display{};
 struct Snapshot{};
 struct Book{};
@@ -247,6 +249,39 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<double> &stdDeviation
    return std::make_unique<Action_t>(Helper_t(stdDeviationV, nSlots), bl, prevNode, colRegister);
 }
 
+struct QuantileHelperArgs {
+   std::shared_ptr<std::vector<double>> fResultQuantiles;
+   std::vector<double> fLevels;
+   std::size_t fCompression;
+};
+
+// Quantile action
+template <typename ColType, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<QuantileHelperArgs> &helperArgs, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Quantile, const RColumnRegister &colRegister)
+{
+   using Helper_t = QuantileHelper;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColType>>;
+   return std::make_unique<Action_t>(Helper_t(helperArgs->fResultQuantiles, helperArgs->fLevels,
+                                              helperArgs->fCompression, nSlots),
+                                     bl, std::move(prevNode), colRegister);
+}
+
+// ReservoirSample action
+template <typename ColType, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl,
+            const std::shared_ptr<std::pair<std::shared_ptr<std::vector<ColType>>, std::size_t>> &helperArgs,
+            const unsigned int nSlots, std::shared_ptr<PrevNodeType> prevNode, ActionTags::ReservoirSample,
+            const RColumnRegister &colRegister)
+{
+   using Helper_t = ReservoirSampleHelper<ColType>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColType>>;
+   return std::make_unique<Action_t>(Helper_t(helperArgs->first, helperArgs->second, nSlots), bl, std::move(prevNode),
+                                     colRegister);
+}
+
 using displayHelperArgs_t = std::pair<size_t, std::shared_ptr<ROOT::RDF::RDisplay>>;
 
 // Display action
@@ -302,9 +337,13 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
                                                outputLM, std::move(isDefine), colTypeIDs),
                                       colNames, colTypeIDs, prevNode, colRegister));
       } else {
-         // multi-thread snapshot to RNTuple is not yet supported
-         // TODO(fdegeus) Add MT snapshotting
-         throw std::runtime_error("Snapshot: Snapshotting to RNTuple with IMT enabled is not supported yet.");
+         // multi-thread snapshot: one RNTupleFillContext per slot, clusters are committed independently
+         using Helper_t = UntypedSnapshotRNTupleHelperMT;
+         using Action_t = RActionSnapshot<Helper_t, PrevNodeType>;
+
+         actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, colNames, outputColNames, options,
+                                               inputLM, outputLM, std::move(isDefine), colTypeIDs),
+                                      colNames, colTypeIDs, prevNode, colRegister));
       }
    } else {
       if (!ROOT::IsImplicitMTEnabled()) {
@@ -27,6 +27,15 @@ ULong64_t GetVectorAddress(std::vector<dtype> &p)
    return reinterpret_cast<ULong64_t>(&p);
 }
 
+// Address of the first element of the vector's buffer, to create a zero-copy
+// view (e.g. a NumPy array) on the data owned by the vector. The owner of the
+// vector must be kept alive as long as the view is in use.
+template <typename dtype>
+ULong64_t GetVectorDataAddress(std::vector<dtype> &p)
+{
+   return reinterpret_cast<ULong64_t>(p.data());
+}
+
 inline ULong64_t GetAddress(std::vector<std::string> &p)
 {
    return reinterpret_cast<ULong64_t>(&p);
@@ -69,6 +78,21 @@ ROOT::RDF::RResultPtr<std::vector<T>> RDataFrameTake(ROOT::RDF::RNode df, std::s
    return df.Take<T>(column);
 }
 
+// Materialize a column directly into a caller-owned buffer (typically the
+// memory of a freshly allocated NumPy array) during the event loop, avoiding
+// the intermediate std::vector of the Take action and the copy into the
+// array afterwards. The buffer is indexed with rdfentry_, so it must hold as
+// many elements as the dataset has entries and the dataframe must not carry
+// filters or ranges; entry-indexed writes are race-free also with implicit
+// multi-threading enabled.
+template <typename T>
+void RDataFrameFillBuffer(ROOT::RDF::RNode df, std::string_view column, ULong64_t bufferAddress)
+{
+   auto buffer = reinterpret_cast<T *>(bufferAddress);
+   df.Foreach([buffer](const T &value, ULong64_t entry) { buffer[entry] = value; },
+              {std::string(column), "rdfentry_"});
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -18,7 +18,6 @@
 
 #include <vector>
 #include <string>
-#include <sstream>
 #include <type_traits>
 
 namespace ROOT {
@@ -37,6 +36,7 @@ private:
 
 public:
    RDisplayElement(const std::string &representation);
+   RDisplayElement(std::string &&representation);
    RDisplayElement();
    void SetPrint();
    void SetIgnore();
@@ -87,6 +87,7 @@ private:
    std::vector<unsigned short> fWidths; ///< Tracks the maximum width of each column, based on the largest element.
 
    VecStr_t fRepresentations; ///< Used by the JITted code to store the string representation of the data.
+   std::string fJitCode; ///< Reused across AddRow calls to accumulate the JITted code without reallocating.
    std::vector<VecStr_t> fCollectionsRepresentations; ///< Used by the JITted code to store the string representation of
                                                       ///< the data in case of collection. Each row corresponds to a
                                                       ///< column, each column to a value of the collection.
@@ -100,21 +101,21 @@ private:
    size_t fNMaxCollectionElements = 10; // threshold on number of elements in collections to be Print()
 
    ////////////////////////////////////////////////////////////////////////////
-   /// Appends a cling::printValue call to the stringstream
+   /// Appends a cling::printValue call to the JITted code
    /// This overload works for non-collection data types which are also not
    /// trivially representable as strings.
    /// \tparam T the type of the event to convert
-   /// \param[in] stream Where the conversion function call will be chained.
+   /// \param[in] jitCode Where the conversion function call will be chained.
    /// \param[in] element The event to convert to its string representation
    /// \param[in] index To which column the event belongs to
    /// \return false, the event is not a collection
    template <typename T,
              std::enable_if_t<!std::is_arithmetic_v<T> && !ROOT::Internal::RDF::IsDataContainer<T>::value, int> = 0>
-   bool AddInterpreterString(std::stringstream &stream, T &element, const int &index)
+   bool AddInterpreterString(std::string &jitCode, T &element, const int &index)
    {
-      stream << "*((std::string*)" << ROOT::Internal::RDF::PrettyPrintAddr(&(fRepresentations[index]))
-             << ") = cling::printValue((" << fTypes[index] << "*)" << ROOT::Internal::RDF::PrettyPrintAddr(&element)
-             << ");";
+      jitCode += "*((std::string*)" + ROOT::Internal::RDF::PrettyPrintAddr(&(fRepresentations[index])) +
+                 ") = cling::printValue((" + fTypes[index] + "*)" + ROOT::Internal::RDF::PrettyPrintAddr(&element) +
+                 ");";
       return false;
    }
 
@@ -127,7 +128,7 @@ private:
    /// \param[in] index To which column the event belongs to
    /// \return false, the event is not a collection
    template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
-   bool AddInterpreterString(std::stringstream &, T &element, const int &index)
+   bool AddInterpreterString(std::string &, T &element, const int &index)
    {
       // Short-circuit the logic and just insert the string representation of
       // the symple type at the right index.
@@ -140,7 +141,7 @@ private:
    /// \param[in] element The event to convert to its string representation
    /// \param[in] index To which column the event belongs to
    /// \return false, the event is not a collection
-   bool AddInterpreterString(std::stringstream &, bool &element, const int &index)
+   bool AddInterpreterString(std::string &, bool &element, const int &index)
    {
       // Short-circuit the logic and just insert the string representation of
       // the boolean value at the right index.
@@ -149,9 +150,9 @@ private:
    }
 
    ////////////////////////////////////////////////////////////////////////////
-   /// Appends collection.size() cling::printValue calls to the stringstream.
+   /// Appends collection.size() cling::printValue calls to the JITted code.
    /// \tparam T the type of the event to convert
-   /// \param[in] stream Where the conversion function call will be chained.
+   /// \param[in] jitCode Where the conversion function call will be chained.
    /// \param[in] collection The event to convert to its string representation
    /// \param[in] index To which column the event belongs to
    /// \return true, the event is a collection
@@ -159,7 +160,7 @@ private:
    template <typename T, std::enable_if_t<ROOT::Internal::RDF::IsDataContainer<T>::value &&
                                              !std::is_arithmetic_v<typename T::value_type>,
                                           int> = 0>
-   bool AddInterpreterString(std::stringstream &stream, T &collection, const int &index)
+   bool AddInterpreterString(std::string &jitCode, T &collection, const int &index)
    {
       size_t collectionSize = std::distance(std::begin(collection), std::end(collection));
       // Prepare the row to contain as many elements as the number of elements in the collection
@@ -173,9 +174,10 @@ private:
 
       // For each element, append a call and feed the proper type returned by GetSplit
       for (size_t i = 0; i < collectionSize; ++i) {
-         stream << "*((std::string*)" << ROOT::Internal::RDF::PrettyPrintAddr(&(fCollectionsRepresentations[index][i]))
-                << ") = cling::printValue((" << output[1] << "*)"
-                << ROOT::Internal::RDF::PrettyPrintAddr(&(collection[i])) << ");";
+         jitCode += "*((std::string*)" +
+                    ROOT::Internal::RDF::PrettyPrintAddr(&(fCollectionsRepresentations[index][i])) +
+                    ") = cling::printValue((" + output[1] + "*)" +
+                    ROOT::Internal::RDF::PrettyPrintAddr(&(collection[i])) + ");";
       }
       return true;
    }
@@ -191,7 +193,7 @@ private:
                                              std::is_arithmetic_v<typename T::value_type> &&
                                              !std::is_same_v<typename T::value_type, bool>,
                                           int> = 0>
-   bool AddInterpreterString(std::stringstream &, T &collection, const int &index)
+   bool AddInterpreterString(std::string &, T &collection, const int &index)
    {
       auto collectionSize = std::distance(std::begin(collection), std::end(collection));
       VecStr_t collectionRepr(collectionSize);
@@ -214,7 +216,7 @@ private:
    template <typename T, std::enable_if_t<ROOT::Internal::RDF::IsDataContainer<T>::value &&
                                              std::is_same_v<typename T::value_type, bool>,
                                           int> = 0>
-   bool AddInterpreterString(std::stringstream &, T &collection, const int &index)
+   bool AddInterpreterString(std::string &, T &collection, const int &index)
    {
       auto collectionSize = std::distance(std::begin(collection), std::end(collection));
       VecStr_t collectionRepr(collectionSize);
@@ -235,9 +237,9 @@ private:
    /// \return false, the event is not a collection
    ///
    /// This specialization for arrays of characters skips the cling::printValue
-   /// (i.e. appends nothing to the stream) and directly writes to fRepresentations the
+   /// (i.e. appends nothing to the JITted code) and directly writes to fRepresentations the
    /// string representation of the array of chars.
-   bool AddInterpreterString(std::stringstream &, ROOT::RVec<char> &charArr, const int &index)
+   bool AddInterpreterString(std::string &, ROOT::RVec<char> &charArr, const int &index)
    {
       // if null-terminated char array, do not copy the null terminator into std::string, it makes columns misaligned.
       const auto length = charArr[charArr.size()-1] == '\0' ? charArr.size() - 1 : charArr.size();
@@ -251,11 +253,15 @@ private:
    void AddToRow(const std::string &stringEle);
 
    ////////////////////////////////////////////////////////////////////////////
-   /// Adds a collection to the table
+   /// Adds a single element to the next slot in the table, stealing the string
+   void AddToRow(std::string &&stringEle);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// Adds a collection to the table, stealing its strings
    ///
    /// Starting from the slot, the elements are added one under the other, each
    /// one using a single cell of an entire row
-   void AddCollectionToRow(const VecStr_t &collection);
+   void AddCollectionToRow(VecStr_t &collection);
 
    ////////////////////////////////////////////////////////////////////////////
    /// Moves to the next cell
@@ -276,22 +282,22 @@ private:
    template <typename... Columns>
    void AddRow(Columns &... columns)
    {
-      std::stringstream calc; // JITted code
+      fJitCode.clear(); // keeps the allocation across rows
       int columnIndex = 0;
       // Unwrapping the parameters to create the JITted code.
-      bool isCollection [] {AddInterpreterString(calc, columns, columnIndex++)...};
+      bool isCollection [] {AddInterpreterString(fJitCode, columns, columnIndex++)...};
 
       // Let cling::printValue handle the conversion. This can be done only through cling-compiled code.
-      const std::string toJit = calc.str();
-      if (!toJit.empty())
-         ROOT::Internal::RDF::InterpreterCalc(calc.str(), "Display");
+      if (!fJitCode.empty())
+         ROOT::Internal::RDF::InterpreterCalc(fJitCode, "Display");
 
-      // Populate the fTable using the results of the JITted code.
+      // Populate the fTable using the results of the JITted code. The representations are moved into the
+      // table cells: they are rebuilt at the next row anyway and this saves one string copy per cell.
       for (size_t i = 0; i < fNColumns; ++i) {
          if (isCollection[i]) {
             AddCollectionToRow(fCollectionsRepresentations[i]);
          } else {
-            AddToRow(fRepresentations[i]);
+            AddToRow(std::move(fRepresentations[i]));
          }
       }
    }
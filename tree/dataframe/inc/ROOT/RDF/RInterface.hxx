@@ -1647,6 +1647,67 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns to a temporary file on disk and read them back lazily.
+   /// \param[in] columnList columns to be cached on disk.
+   /// \param[in] options RSnapshotOptions struct controlling output format and compression of the cache file.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// Disk-backed alternative to Cache(): instead of materializing the selected columns in memory, they are
+   /// written to a unique file in the system temporary directory and the returned `RDataFrame` reads them back
+   /// from there. Data is reloaded chunk-wise through the normal TTree basket (or RNTuple page) machinery, so
+   /// memory usage stays bounded regardless of the dataset size, at the cost of (compressed) disk I/O on each
+   /// pass. Use it for iterative multi-pass analyses of intermediates that are too large for Cache().
+   ///
+   /// The output format and compression settings can be tuned through \p options, e.g. setting
+   /// `options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple` spills to an RNTuple instead of a
+   /// TTree. The cache file is removed at the end of the process; to keep a persistent copy use Snapshot()
+   /// directly.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto cached_df = df.CacheToDisk({"col0", "col1"});
+   /// ~~~
+   RInterface<RLoopManager> CacheToDisk(const ColumnNames_t &columnList,
+                                        const RSnapshotOptions &options = RSnapshotOptions())
+   {
+      auto opts = options;
+      opts.fLazy = false; // the cache file must be complete before the returned dataframe can read it
+      auto snapshot = Snapshot("RDFCacheData", RDFInternal::MakeTemporaryCacheFileName(), columnList, opts);
+      return *snapshot;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns to a temporary file on disk and read them back lazily.
+   /// \param[in] columnNameRegexp The regular expression to match the column names to be selected. The presence of a '^' and a '$' at the end of the string is implicitly assumed if they are not specified. The dialect supported is PCRE via the TPRegexp class. An empty string signals the selection of all columns.
+   /// \param[in] options RSnapshotOptions struct controlling output format and compression of the cache file.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// The existing columns are matched against the regular expression. If the string provided
+   /// is empty, all columns are selected. See the previous overload for more information.
+   RInterface<RLoopManager> CacheToDisk(std::string_view columnNameRegexp = "",
+                                        const RSnapshotOptions &options = RSnapshotOptions())
+   {
+      auto opts = options;
+      opts.fLazy = false;
+      auto snapshot = Snapshot("RDFCacheData", RDFInternal::MakeTemporaryCacheFileName(), columnNameRegexp, opts);
+      return *snapshot;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns to a temporary file on disk and read them back lazily.
+   /// \param[in] columnList columns to be cached on disk.
+   /// \param[in] options RSnapshotOptions struct controlling output format and compression of the cache file.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// See the previous overloads for more information.
+   RInterface<RLoopManager> CacheToDisk(std::initializer_list<std::string> columnList,
+                                        const RSnapshotOptions &options = RSnapshotOptions())
+   {
+      ColumnNames_t selectedColumns(columnList);
+      return CacheToDisk(selectedColumns, options);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -2843,6 +2904,85 @@ public:
       return CreateAction<RDFInternal::ActionTags::StdDev, T>(userColumns, stdDeviationV, stdDeviationV, fProxiedPtr);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return approximate quantiles of processed column values (*lazy action*).
+   /// \tparam T The type of the branch/column.
+   /// \param[in] columnName The name of the branch/column to be treated.
+   /// \param[in] quantiles The quantile levels to estimate, each in [0, 1].
+   /// \param[in] compression Accuracy/memory trade-off of the underlying sketch, see
+   ///            ROOT::Internal::RDF::RQuantileSketch. Larger values give more accurate
+   ///            estimates at the cost of a larger (but still bounded) memory footprint.
+   /// \return the estimated quantile values, one per level, wrapped in a RResultPtr.
+   ///
+   /// The estimates are produced in a single pass over the data with a mergeable
+   /// sketch that uses O(compression) memory per processing slot, independently of
+   /// the number of processed entries, making the action suitable for arbitrarily
+   /// large datasets. Levels 0 and 1 return the exact minimum and maximum; the
+   /// accuracy of the other levels improves towards the tails, so extreme
+   /// quantiles such as 0.99 are estimated more precisely than the median.
+   ///
+   /// If T is not specified, RDataFrame will infer it from the data and just-in-time compile the correct
+   /// template specialization of this method.
+   ///
+   /// This action is *lazy*: upon invocation of this method the calculation is
+   /// booked but not executed. Also see RResultPtr.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// // Deduce column type (this invocation needs jitting internally)
+   /// auto medianAndP99 = myDf.Quantile("values", {0.5, 0.99});
+   /// // Explicit column type
+   /// auto medianAndP99_1 = myDf.Quantile<double>("values", {0.5, 0.99});
+   /// ~~~
+   ///
+   template <typename T = RDFDetail::RInferredType>
+   RResultPtr<std::vector<double>> Quantile(std::string_view columnName, const std::vector<double> &quantiles,
+                                            std::size_t compression = RDFInternal::RQuantileSketch::kDefaultCompression)
+   {
+      if (quantiles.empty())
+         throw std::runtime_error("Quantile: at least one quantile level must be requested.");
+      if (std::any_of(quantiles.begin(), quantiles.end(), [](double q) { return q < 0. || q > 1.; }))
+         throw std::runtime_error("Quantile: quantile levels must be in [0, 1].");
+      const auto userColumns = columnName.empty() ? ColumnNames_t() : ColumnNames_t({std::string(columnName)});
+      auto quantilesV = std::make_shared<std::vector<double>>(quantiles.size(), 0.);
+      auto helperArgs = std::make_shared<RDFInternal::QuantileHelperArgs>(
+         RDFInternal::QuantileHelperArgs{quantilesV, quantiles, compression});
+      return CreateAction<RDFInternal::ActionTags::Quantile, T>(userColumns, quantilesV, helperArgs, fProxiedPtr);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return a uniform random sample of processed column values (*lazy action*).
+   /// \tparam T The type of the branch/column.
+   /// \param[in] columnName The name of the branch/column to be treated.
+   /// \param[in] sampleSize The maximum number of values to sample.
+   /// \return the sampled values wrapped in a RResultPtr.
+   ///
+   /// The sample is drawn in a single pass over the data with reservoir sampling,
+   /// using O(sampleSize) memory per processing slot independently of the number
+   /// of processed entries: after the event loop the result holds a uniform
+   /// random sample without replacement of the column values, or all of them if
+   /// fewer than sampleSize entries were processed.
+   ///
+   /// This action is *lazy*: upon invocation of this method the calculation is
+   /// booked but not executed. Also see RResultPtr.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto sample = myDf.ReservoirSample<double>("values", 1000);
+   /// ~~~
+   ///
+   template <typename T>
+   RResultPtr<std::vector<T>> ReservoirSample(std::string_view columnName, std::size_t sampleSize)
+   {
+      if (sampleSize == 0)
+         throw std::runtime_error("ReservoirSample: the sample size must be positive.");
+      const auto userColumns = columnName.empty() ? ColumnNames_t() : ColumnNames_t({std::string(columnName)});
+      auto sampleV = std::make_shared<std::vector<T>>();
+      auto helperArgs =
+         std::make_shared<std::pair<std::shared_ptr<std::vector<T>>, std::size_t>>(sampleV, sampleSize);
+      return CreateAction<RDFInternal::ActionTags::ReservoirSample, T>(userColumns, sampleV, helperArgs, fProxiedPtr);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Return the sum of processed column values (*lazy action*).
@@ -186,6 +186,7 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   bool OnlyRunsActions() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
@@ -224,6 +225,7 @@ public:
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run(bool jit = true);
+   static void RunSharedScan(const std::vector<RLoopManager *> &lms);
    const ColumnNames_t &GetDefaultColumnNames() const;
    TTree *GetTree() const;
    ULong64_t GetNEmptyEntries() const { return fEmptyEntryRange.second - fEmptyEntryRange.first; }
@@ -18,20 +18,84 @@
 #define ROOT_RDF_RMERGEABLEVALUE
 
 #include <algorithm> // std::find, std::min, std::max
+#include <cstddef>   // std::size_t
+#include <cstring>   // std::memcpy
 #include <iterator>  // std::distance
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "ROOT/RDF/RQuantileSketch.hxx"   // RMergeableQuantile
+#include "ROOT/RDF/RReservoirSample.hxx"  // RMergeableReservoirSample::Merge
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
+#include "TH1.h"    // RMergeableFill::Serialize
 #include "TList.h"  // RMergeableFill::Merge
 
 namespace ROOT {
 namespace Detail {
 namespace RDF {
 
+/// \cond HIDDEN_SYMBOLS
+// Helpers for the compact binary wire format of the mergeables, see e.g. RMergeableCount::Serialize.
+namespace MergeableWire {
+
+/// Version of the compact binary wire format produced by the Serialize methods of the mergeables.
+/// Incremented whenever the layout of any payload changes.
+constexpr unsigned char kWireFormatVersion = 1;
+
+/// Tag identifying the concrete mergeable class in the wire format header.
+enum class EKind : unsigned char {
+   kCount = 0,
+   kSum = 1,
+   kMin = 2,
+   kMax = 3,
+   kMean = 4,
+   kStdDev = 5,
+   kFill = 6,
+   kQuantile = 7,
+   kReservoirSample = 8
+};
+
+template <typename T>
+void Append(std::vector<char> &buf, const T &value)
+{
+   static_assert(std::is_trivially_copyable<T>::value, "Wire format values must be trivially copyable.");
+   const auto *bytes = reinterpret_cast<const char *>(&value);
+   buf.insert(buf.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T Extract(const std::vector<char> &buf, std::size_t &pos)
+{
+   static_assert(std::is_trivially_copyable<T>::value, "Wire format values must be trivially copyable.");
+   if (pos + sizeof(T) > buf.size())
+      throw std::runtime_error("RMergeableValue: corrupt or truncated serialized buffer.");
+   T value;
+   std::memcpy(&value, buf.data() + pos, sizeof(T));
+   pos += sizeof(T);
+   return value;
+}
+
+inline void AppendHeader(std::vector<char> &buf, EKind kind)
+{
+   Append(buf, kWireFormatVersion);
+   Append(buf, static_cast<unsigned char>(kind));
+}
+
+inline void CheckHeader(const std::vector<char> &buf, std::size_t &pos, EKind kind)
+{
+   const auto version = Extract<unsigned char>(buf, pos);
+   if (version != kWireFormatVersion)
+      throw std::runtime_error("RMergeableValue: unsupported wire format version " + std::to_string(version) + ".");
+   if (Extract<unsigned char>(buf, pos) != static_cast<unsigned char>(kind))
+      throw std::runtime_error("RMergeableValue: the serialized buffer holds a different mergeable type.");
+}
+} // namespace MergeableWire
+/// \endcond
+
 // Fwd declarations for RMergeableValue
 template <typename T>
 class RMergeableValue;
@@ -71,6 +135,21 @@ public:
    RMergeableValueBase &operator=(const RMergeableValueBase &) = delete;
    RMergeableValueBase(RMergeableValueBase &&) = delete;
    RMergeableValueBase &operator=(RMergeableValueBase &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   /// \throws std::logic_error If the concrete mergeable type does not support
+   ///         the wire format.
+   ///
+   /// The counterpart is the static Deserialize method of the concrete
+   /// mergeable class, which the receiving end of the transfer must know, as it
+   /// usually does in a distributed reduction. Compared to streaming the full
+   /// mergeable with TBufferFile, the wire format only contains the raw data
+   /// needed to reconstruct the result plus minimal metadata.
+   virtual std::vector<char> Serialize() const
+   {
+      throw std::logic_error("This mergeable type does not support the compact binary wire format.");
+   }
 };
 
 /**
@@ -136,6 +215,8 @@ currently available:
 - RMergeableMax
 - RMergeableMean
 - RMergeableMin
+- RMergeableQuantile
+- RMergeableReservoirSample
 - RMergeableStdDev
 - RMergeableSum
 */
@@ -232,6 +313,27 @@ public:
    RMergeableCount &operator=(const RMergeableCount &) = delete;
    RMergeableCount(RMergeableCount &&) = delete;
    RMergeableCount &operator=(RMergeableCount &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   std::vector<char> Serialize() const final
+   {
+      std::vector<char> buf;
+      MergeableWire::AppendHeader(buf, MergeableWire::EKind::kCount);
+      MergeableWire::Append(buf, fValue);
+      return buf;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   /// \throws std::runtime_error If the buffer is truncated or was produced by
+   ///         another mergeable type or wire format version.
+   static std::unique_ptr<RMergeableCount> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kCount);
+      return std::make_unique<RMergeableCount>(MergeableWire::Extract<ULong64_t>(buf, pos));
+   }
 };
 
 /**
@@ -313,6 +415,88 @@ public:
    RMergeableFill &operator=(const RMergeableFill &) = delete;
    RMergeableFill(RMergeableFill &&) = delete;
    RMergeableFill &operator=(RMergeableFill &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   /// \throws std::logic_error For profile histograms, whose per-bin entry
+   ///         counts are not part of the payload.
+   ///
+   /// Only the cell contents, the Sumw2 array, the statistics and the number of
+   /// entries are written: the binning is not part of the payload, so the
+   /// buffer is a fraction of the size of a fully streamed histogram.
+   /// Deserialize reconstructs the result from the buffer plus a histogram with
+   /// the same binning, which a distributed reduction has available in the
+   /// shape of the (empty) result model. Only available for TH1-derived result
+   /// types.
+   std::vector<char> Serialize() const final
+   {
+      if constexpr (!std::is_base_of<TH1, T>::value) {
+         return RMergeableValueBase::Serialize(); // throws
+      } else {
+         const TH1 &h = this->fValue;
+         if (h.InheritsFrom("TProfile") || h.InheritsFrom("TProfile2D") || h.InheritsFrom("TProfile3D"))
+            throw std::logic_error("RMergeableFill: the compact wire format does not support profile histograms.");
+
+         std::vector<char> buf;
+         MergeableWire::AppendHeader(buf, MergeableWire::EKind::kFill);
+         const Int_t ncells = h.GetNcells();
+         MergeableWire::Append(buf, ncells);
+         for (Int_t i = 0; i < ncells; ++i)
+            MergeableWire::Append(buf, h.GetBinContent(i));
+         const Int_t sumw2N = h.GetSumw2N();
+         MergeableWire::Append(buf, sumw2N);
+         const TArrayD &sumw2 = *h.GetSumw2();
+         for (Int_t i = 0; i < sumw2N; ++i)
+            MergeableWire::Append(buf, sumw2[i]);
+         Double_t stats[TH1::kNstat];
+         h.GetStats(stats);
+         for (auto stat : stats)
+            MergeableWire::Append(buf, stat);
+         MergeableWire::Append(buf, h.GetEntries());
+         return buf;
+      }
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   /// \param[in] buf The serialized buffer.
+   /// \param[in] model A histogram with the same binning as the serialized one,
+   ///            e.g. the empty result model. Its contents are overwritten.
+   /// \throws std::runtime_error If the buffer is truncated, was produced by
+   ///         another mergeable type or wire format version, or the binning of
+   ///         the model does not match the serialized contents.
+   template <typename U = T, std::enable_if_t<std::is_base_of<TH1, U>::value, int> = 0>
+   static std::unique_ptr<RMergeableFill<T>> Deserialize(const std::vector<char> &buf, const T &model)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kFill);
+
+      auto result = std::make_unique<RMergeableFill<T>>(model);
+      TH1 &h = result->fValue;
+      const auto ncells = MergeableWire::Extract<Int_t>(buf, pos);
+      if (ncells != h.GetNcells())
+         throw std::runtime_error("RMergeableFill: the binning of the model histogram does not match the "
+                                  "serialized contents.");
+      for (Int_t i = 0; i < ncells; ++i)
+         h.SetBinContent(i, MergeableWire::Extract<Double_t>(buf, pos));
+      const auto sumw2N = MergeableWire::Extract<Int_t>(buf, pos);
+      if (sumw2N > 0) {
+         if (sumw2N != ncells)
+            throw std::runtime_error("RMergeableValue: corrupt or truncated serialized buffer.");
+         h.Sumw2();
+         TArrayD &sumw2 = *h.GetSumw2();
+         for (Int_t i = 0; i < sumw2N; ++i)
+            sumw2[i] = MergeableWire::Extract<Double_t>(buf, pos);
+      } else {
+         h.GetSumw2()->Set(0); // the serialized histogram did not track Sumw2, the model might
+      }
+      Double_t stats[TH1::kNstat];
+      for (auto &stat : stats)
+         stat = MergeableWire::Extract<Double_t>(buf, pos);
+      h.PutStats(stats);
+      h.SetEntries(MergeableWire::Extract<Double_t>(buf, pos));
+      return result;
+   }
 };
 
 template <typename T>
@@ -343,6 +527,25 @@ public:
    RMergeableMax &operator=(const RMergeableMax &) = delete;
    RMergeableMax(RMergeableMax &&) = delete;
    RMergeableMax &operator=(RMergeableMax &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   std::vector<char> Serialize() const final
+   {
+      std::vector<char> buf;
+      MergeableWire::AppendHeader(buf, MergeableWire::EKind::kMax);
+      MergeableWire::Append(buf, this->fValue);
+      return buf;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   static std::unique_ptr<RMergeableMax> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kMax);
+      return std::make_unique<RMergeableMax>(MergeableWire::Extract<T>(buf, pos));
+   }
 };
 
 /**
@@ -409,6 +612,28 @@ public:
    RMergeableMean &operator=(const RMergeableMean &) = delete;
    RMergeableMean(RMergeableMean &&) = delete;
    RMergeableMean &operator=(RMergeableMean &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   std::vector<char> Serialize() const final
+   {
+      std::vector<char> buf;
+      MergeableWire::AppendHeader(buf, MergeableWire::EKind::kMean);
+      MergeableWire::Append(buf, fValue);
+      MergeableWire::Append(buf, fCounts);
+      return buf;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   static std::unique_ptr<RMergeableMean> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kMean);
+      const auto value = MergeableWire::Extract<Double_t>(buf, pos);
+      const auto counts = MergeableWire::Extract<ULong64_t>(buf, pos);
+      return std::make_unique<RMergeableMean>(value, counts);
+   }
 };
 
 template <typename T>
@@ -439,6 +664,243 @@ public:
    RMergeableMin &operator=(const RMergeableMin &) = delete;
    RMergeableMin(RMergeableMin &&) = delete;
    RMergeableMin &operator=(RMergeableMin &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   std::vector<char> Serialize() const final
+   {
+      std::vector<char> buf;
+      MergeableWire::AppendHeader(buf, MergeableWire::EKind::kMin);
+      MergeableWire::Append(buf, this->fValue);
+      return buf;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   static std::unique_ptr<RMergeableMin> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kMin);
+      return std::make_unique<RMergeableMin>(MergeableWire::Extract<T>(buf, pos));
+   }
+};
+
+/**
+\class ROOT::Detail::RDF::RMergeableQuantile
+\ingroup dataframe
+\brief Specialization of RMergeableValue for the Quantile action.
+
+Other than the estimated quantile values, the mergeable stores the requested
+quantile levels and the full RQuantileSketch, so that merging can aggregate the
+sketches and re-derive the estimates from the combined summary.
+*/
+class RMergeableQuantile final : public RMergeableValue<std::vector<Double_t>> {
+   std::vector<Double_t> fLevels;              ///< The requested quantile levels, in [0, 1].
+   ROOT::Internal::RDF::RQuantileSketch fSketch; ///< The sketch the estimates were derived from.
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Aggregate the information contained in another RMergeableValue
+   ///        into this.
+   /// \param[in] other Another RMergeableValue object.
+   /// \throws std::invalid_argument If the cast of the other object to the same
+   ///         type as this one fails, or if the quantile levels differ.
+   ///
+   /// The two sketches are merged and the quantile estimates are recomputed
+   /// from the combined summary.
+   ///
+   /// \note All the `Merge` methods in the RMergeableValue family are private.
+   /// To merge multiple RMergeableValue objects please use [MergeValues]
+   /// (namespaceROOT_1_1Detail_1_1RDF.html#af16fefbe2d120983123ddf8a1e137277).
+   void Merge(const RMergeableValue<std::vector<Double_t>> &other) final
+   {
+      try {
+         const auto &othercast = dynamic_cast<const RMergeableQuantile &>(other);
+         if (fLevels != othercast.fLevels)
+            throw std::invalid_argument("Quantile results with different levels cannot be merged together.");
+
+         fSketch.Merge(othercast.fSketch);
+         for (std::size_t i = 0; i < fLevels.size(); ++i)
+            this->fValue[i] = fSketch.GetQuantile(fLevels[i]);
+      } catch (const std::bad_cast &) {
+         throw std::invalid_argument("Results from different actions cannot be merged together.");
+      }
+   }
+
+public:
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Constructor that initializes data members.
+   /// \param[in] value The estimated quantile values, one per level.
+   /// \param[in] levels The requested quantile levels, in [0, 1].
+   /// \param[in] sketch The sketch the estimates were derived from.
+   RMergeableQuantile(const std::vector<Double_t> &value, const std::vector<Double_t> &levels,
+                      ROOT::Internal::RDF::RQuantileSketch sketch)
+      : RMergeableValue<std::vector<Double_t>>(value), fLevels(levels), fSketch(std::move(sketch))
+   {
+      fSketch.Flush();
+   }
+   /**
+      Default constructor. Needed to allow serialization of ROOT objects. See
+      [TBufferFile::WriteObjectClass]
+      (classTBufferFile.html#a209078a4cb58373b627390790bf0c9c1)
+   */
+   RMergeableQuantile() = default;
+   RMergeableQuantile(const RMergeableQuantile &) = delete;
+   RMergeableQuantile &operator=(const RMergeableQuantile &) = delete;
+   RMergeableQuantile(RMergeableQuantile &&) = delete;
+   RMergeableQuantile &operator=(RMergeableQuantile &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   ///
+   /// The payload holds the quantile levels and the full sketch, so the size is
+   /// O(compression) regardless of the number of values the sketch has seen.
+   std::vector<char> Serialize() const final
+   {
+      std::vector<char> buf;
+      MergeableWire::AppendHeader(buf, MergeableWire::EKind::kQuantile);
+      MergeableWire::Append(buf, static_cast<ULong64_t>(fLevels.size()));
+      for (auto level : fLevels)
+         MergeableWire::Append(buf, level);
+      MergeableWire::Append(buf, static_cast<ULong64_t>(fSketch.GetCompression()));
+      MergeableWire::Append(buf, fSketch.GetCount());
+      MergeableWire::Append(buf, fSketch.GetMin());
+      MergeableWire::Append(buf, fSketch.GetMax());
+      const auto &centroids = fSketch.GetCentroids();
+      MergeableWire::Append(buf, static_cast<ULong64_t>(centroids.size()));
+      for (const auto &centroid : centroids) {
+         MergeableWire::Append(buf, centroid.fMean);
+         MergeableWire::Append(buf, centroid.fWeight);
+      }
+      return buf;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   static std::unique_ptr<RMergeableQuantile> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kQuantile);
+      const auto nLevels = MergeableWire::Extract<ULong64_t>(buf, pos);
+      std::vector<Double_t> levels(nLevels);
+      for (auto &level : levels)
+         level = MergeableWire::Extract<Double_t>(buf, pos);
+      const auto compression = static_cast<std::size_t>(MergeableWire::Extract<ULong64_t>(buf, pos));
+      const auto count = MergeableWire::Extract<ULong64_t>(buf, pos);
+      const auto min = MergeableWire::Extract<Double_t>(buf, pos);
+      const auto max = MergeableWire::Extract<Double_t>(buf, pos);
+      const auto nCentroids = MergeableWire::Extract<ULong64_t>(buf, pos);
+      std::vector<ROOT::Internal::RDF::RQuantileSketch::RCentroid> centroids(nCentroids);
+      for (auto &centroid : centroids) {
+         centroid.fMean = MergeableWire::Extract<Double_t>(buf, pos);
+         centroid.fWeight = MergeableWire::Extract<Double_t>(buf, pos);
+      }
+      ROOT::Internal::RDF::RQuantileSketch sketch{compression, min, max, count, std::move(centroids)};
+      std::vector<Double_t> values(nLevels);
+      for (ULong64_t i = 0; i < nLevels; ++i)
+         values[i] = sketch.GetQuantile(levels[i]);
+      return std::make_unique<RMergeableQuantile>(values, levels, std::move(sketch));
+   }
+};
+
+/**
+\class ROOT::Detail::RDF::RMergeableReservoirSample
+\ingroup dataframe
+\brief Specialization of RMergeableValue for the ReservoirSample action.
+
+Other than the sample itself, the mergeable stores the number of values the
+sample was drawn from, so that merging can draw from the two samples with the
+correct proportions.
+*/
+template <typename T>
+class RMergeableReservoirSample final : public RMergeableValue<std::vector<T>> {
+   ULong64_t fSeen;         ///< The number of values the sample was drawn from.
+   std::size_t fSampleSize; ///< The maximum size of the sample.
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Aggregate the information contained in another RMergeableValue
+   ///        into this.
+   /// \param[in] other Another RMergeableValue object.
+   /// \throws std::invalid_argument If the cast of the other object to the same
+   ///         type as this one fails, or if the sample sizes differ.
+   ///
+   /// The merged sample draws from the two samples proportionally to the
+   /// number of values each one has seen, see RReservoirSample::Merge.
+   ///
+   /// \note All the `Merge` methods in the RMergeableValue family are private.
+   /// To merge multiple RMergeableValue objects please use [MergeValues]
+   /// (namespaceROOT_1_1Detail_1_1RDF.html#af16fefbe2d120983123ddf8a1e137277).
+   void Merge(const RMergeableValue<std::vector<T>> &other) final
+   {
+      try {
+         const auto &othercast = dynamic_cast<const RMergeableReservoirSample<T> &>(other);
+         if (fSampleSize != othercast.fSampleSize)
+            throw std::invalid_argument("Sample results with different sample sizes cannot be merged together.");
+
+         ROOT::Internal::RDF::RReservoirSample<T> merged{fSampleSize, std::move(this->fValue), fSeen,
+                                                         /*seed=*/fSeen + othercast.fSeen};
+         merged.Merge({fSampleSize, othercast.fValue, othercast.fSeen});
+         this->fValue = merged.GetSample();
+         fSeen = merged.GetSeen();
+      } catch (const std::bad_cast &) {
+         throw std::invalid_argument("Results from different actions cannot be merged together.");
+      }
+   }
+
+public:
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Constructor that initializes data members.
+   /// \param[in] value The sample.
+   /// \param[in] seen The number of values the sample was drawn from.
+   /// \param[in] sampleSize The maximum size of the sample.
+   RMergeableReservoirSample(const std::vector<T> &value, ULong64_t seen, std::size_t sampleSize)
+      : RMergeableValue<std::vector<T>>(value), fSeen{seen}, fSampleSize{sampleSize}
+   {
+   }
+   /**
+      Default constructor. Needed to allow serialization of ROOT objects. See
+      [TBufferFile::WriteObjectClass]
+      (classTBufferFile.html#a209078a4cb58373b627390790bf0c9c1)
+   */
+   RMergeableReservoirSample() = default;
+   RMergeableReservoirSample(const RMergeableReservoirSample &) = delete;
+   RMergeableReservoirSample &operator=(const RMergeableReservoirSample &) = delete;
+   RMergeableReservoirSample(RMergeableReservoirSample &&) = delete;
+   RMergeableReservoirSample &operator=(RMergeableReservoirSample &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   /// \throws std::logic_error If the sampled type is not trivially copyable.
+   std::vector<char> Serialize() const final
+   {
+      if constexpr (!std::is_trivially_copyable<T>::value) {
+         return RMergeableValueBase::Serialize(); // throws
+      } else {
+         std::vector<char> buf;
+         MergeableWire::AppendHeader(buf, MergeableWire::EKind::kReservoirSample);
+         MergeableWire::Append(buf, fSeen);
+         MergeableWire::Append(buf, static_cast<ULong64_t>(fSampleSize));
+         MergeableWire::Append(buf, static_cast<ULong64_t>(this->fValue.size()));
+         for (const auto &value : this->fValue)
+            MergeableWire::Append(buf, value);
+         return buf;
+      }
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   template <typename U = T, std::enable_if_t<std::is_trivially_copyable<U>::value, int> = 0>
+   static std::unique_ptr<RMergeableReservoirSample<T>> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kReservoirSample);
+      const auto seen = MergeableWire::Extract<ULong64_t>(buf, pos);
+      const auto sampleSize = static_cast<std::size_t>(MergeableWire::Extract<ULong64_t>(buf, pos));
+      const auto nValues = MergeableWire::Extract<ULong64_t>(buf, pos);
+      std::vector<T> values(nValues);
+      for (auto &value : values)
+         value = MergeableWire::Extract<T>(buf, pos);
+      return std::make_unique<RMergeableReservoirSample<T>>(values, seen, sampleSize);
+   }
 };
 
 /**
@@ -524,6 +986,30 @@ public:
    RMergeableStdDev &operator=(const RMergeableStdDev &) = delete;
    RMergeableStdDev(RMergeableStdDev &&) = delete;
    RMergeableStdDev &operator=(RMergeableStdDev &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   std::vector<char> Serialize() const final
+   {
+      std::vector<char> buf;
+      MergeableWire::AppendHeader(buf, MergeableWire::EKind::kStdDev);
+      MergeableWire::Append(buf, fValue);
+      MergeableWire::Append(buf, fCounts);
+      MergeableWire::Append(buf, fMean);
+      return buf;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   static std::unique_ptr<RMergeableStdDev> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kStdDev);
+      const auto value = MergeableWire::Extract<Double_t>(buf, pos);
+      const auto counts = MergeableWire::Extract<ULong64_t>(buf, pos);
+      const auto mean = MergeableWire::Extract<Double_t>(buf, pos);
+      return std::make_unique<RMergeableStdDev>(value, counts, mean);
+   }
 };
 
 template <typename T>
@@ -554,6 +1040,25 @@ public:
    RMergeableSum &operator=(const RMergeableSum &) = delete;
    RMergeableSum(RMergeableSum &&) = delete;
    RMergeableSum &operator=(RMergeableSum &&) = delete;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Serialize into the compact, versioned binary wire format.
+   std::vector<char> Serialize() const final
+   {
+      std::vector<char> buf;
+      MergeableWire::AppendHeader(buf, MergeableWire::EKind::kSum);
+      MergeableWire::Append(buf, this->fValue);
+      return buf;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Reconstruct a mergeable from a buffer produced by Serialize.
+   static std::unique_ptr<RMergeableSum> Deserialize(const std::vector<char> &buf)
+   {
+      std::size_t pos = 0;
+      MergeableWire::CheckHeader(buf, pos, MergeableWire::EKind::kSum);
+      return std::make_unique<RMergeableSum>(MergeableWire::Extract<T>(buf, pos));
+   }
 };
 
 /**
@@ -0,0 +1,92 @@
+/**
+ \file ROOT/RDF/RQuantileSketch.hxx
+ \ingroup dataframe
+ \date 2026-08
+*/
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RQUANTILESKETCH
+#define ROOT_RDF_RQUANTILESKETCH
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "RtypesCore.h"
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RQuantileSketch
+\ingroup dataframe
+\brief A mergeable, single-pass sketch for approximate quantiles.
+
+The sketch summarizes an arbitrarily long stream of values with a bounded
+number of weighted centroids, in the spirit of Dunning's t-digest. Incoming
+values are buffered and periodically compressed into the centroid list; the
+compression step bounds the weight of each centroid with the scale function
+`4 * N * q * (1 - q) / compression`, which keeps centroids small near the
+tails and therefore makes extreme quantiles more accurate than central ones.
+
+Two sketches built over disjoint parts of a dataset can be combined with
+Merge, which makes the class suitable both for multi-thread event loops (one
+sketch per processing slot) and for distributed reductions. The memory
+footprint is O(compression) regardless of the number of values added.
+*/
+class RQuantileSketch {
+public:
+   /// A group of neighboring values summarized by their weighted mean.
+   struct RCentroid {
+      double fMean = 0.;
+      double fWeight = 0.;
+   };
+
+   /// Default value for the compression parameter, a good trade-off between
+   /// memory footprint (a few kilobytes) and accuracy (per mille on central
+   /// quantiles, better on the tails).
+   static constexpr std::size_t kDefaultCompression = 256u;
+
+private:
+   std::vector<RCentroid> fCentroids; ///< Compressed summary, sorted by mean.
+   std::vector<double> fBuffer;       ///< Values not yet compressed into the centroids.
+   double fMin = std::numeric_limits<double>::max();    ///< Smallest value added so far.
+   double fMax = std::numeric_limits<double>::lowest(); ///< Largest value added so far.
+   ULong64_t fCount = 0;                                ///< Number of values added so far.
+   std::size_t fCompression = kDefaultCompression;      ///< Bound on the number of centroids.
+
+   void Compress();
+
+public:
+   explicit RQuantileSketch(std::size_t compression = kDefaultCompression);
+   /// Reconstruct a sketch from its serialized parts, see e.g. RMergeableQuantile::Deserialize.
+   RQuantileSketch(std::size_t compression, double min, double max, ULong64_t count,
+                   std::vector<RCentroid> centroids);
+
+   void Add(double value);
+   void Merge(const RQuantileSketch &other);
+   double GetQuantile(double quantile);
+   /// Compress any buffered values into the centroid list, e.g. before calling GetCentroids.
+   void Flush() { Compress(); }
+
+   ULong64_t GetCount() const { return fCount; }
+   std::size_t GetCompression() const { return fCompression; }
+   double GetMin() const { return fMin; }
+   double GetMax() const { return fMax; }
+   /// The compressed summary. Only complete after a call to Flush.
+   const std::vector<RCentroid> &GetCentroids() const { return fCentroids; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RQUANTILESKETCH
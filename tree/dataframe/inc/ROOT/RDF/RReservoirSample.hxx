@@ -0,0 +1,125 @@
+/**
+ \file ROOT/RDF/RReservoirSample.hxx
+ \ingroup dataframe
+ \date 2026-08
+*/
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESERVOIRSAMPLE
+#define ROOT_RDF_RRESERVOIRSAMPLE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "RtypesCore.h"
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RReservoirSample
+\ingroup dataframe
+\brief A mergeable, single-pass uniform random sample of bounded size.
+
+Implements reservoir sampling ("algorithm R"): after any number of calls to
+Add, the reservoir holds a uniform random sample without replacement of the
+values seen so far, using O(sampleSize) memory. Two reservoirs built over
+disjoint parts of a dataset can be combined with Merge, which draws from the
+two reservoirs proportionally to the number of values each one has seen.
+
+The random generator is seeded deterministically from the constructor
+argument, so single-thread results are reproducible; in multi-thread event
+loops the partitioning of entries over slots is itself not deterministic.
+*/
+template <typename T>
+class RReservoirSample {
+   std::vector<T> fSample;     ///< The current sample, at most fSampleSize values.
+   ULong64_t fSeen = 0;        ///< Number of values the sample was drawn from.
+   std::size_t fSampleSize;    ///< Maximum size of the sample.
+   std::mt19937_64 fRng;       ///< Generator for the sampling decisions.
+
+public:
+   explicit RReservoirSample(std::size_t sampleSize, std::uint64_t seed = 0u)
+      : fSampleSize(sampleSize), fRng(seed + 1u)
+   {
+      if (sampleSize == 0)
+         throw std::invalid_argument("RReservoirSample: the sample size must be positive.");
+      fSample.reserve(sampleSize);
+   }
+
+   /// Reconstruct a reservoir from its serialized parts, see e.g. RMergeableReservoirSample::Deserialize.
+   RReservoirSample(std::size_t sampleSize, std::vector<T> sample, ULong64_t seen, std::uint64_t seed = 0u)
+      : fSample(std::move(sample)), fSeen(seen), fSampleSize(sampleSize), fRng(seed + 1u)
+   {
+      if (sampleSize == 0)
+         throw std::invalid_argument("RReservoirSample: the sample size must be positive.");
+   }
+
+   void Add(const T &value)
+   {
+      ++fSeen;
+      if (fSample.size() < fSampleSize) {
+         fSample.push_back(value);
+         return;
+      }
+      const auto j = std::uniform_int_distribution<ULong64_t>{0, fSeen - 1}(fRng);
+      if (j < fSampleSize)
+         fSample[j] = value;
+   }
+
+   /// Combine with a reservoir built over a disjoint part of the dataset: each
+   /// value of the merged sample is drawn from one of the two reservoirs with
+   /// probability proportional to the number of values that reservoir has seen.
+   void Merge(const RReservoirSample &other)
+   {
+      if (other.fSeen == 0)
+         return;
+      if (fSeen == 0) {
+         fSample = other.fSample;
+         fSeen = other.fSeen;
+         return;
+      }
+
+      auto mine = std::move(fSample);
+      auto theirs = other.fSample;
+      std::shuffle(mine.begin(), mine.end(), fRng);
+      std::shuffle(theirs.begin(), theirs.end(), fRng);
+
+      const double myWeight = static_cast<double>(fSeen) / static_cast<double>(fSeen + other.fSeen);
+      std::uniform_real_distribution<double> uniform{0., 1.};
+      std::vector<T> merged;
+      merged.reserve(fSampleSize);
+      std::size_t myNext = 0, theirNext = 0;
+      while (merged.size() < fSampleSize && (myNext < mine.size() || theirNext < theirs.size())) {
+         const bool takeMine =
+            theirNext == theirs.size() || (myNext < mine.size() && uniform(fRng) < myWeight);
+         merged.push_back(takeMine ? mine[myNext++] : theirs[theirNext++]);
+      }
+
+      fSample = std::move(merged);
+      fSeen += other.fSeen;
+   }
+
+   const std::vector<T> &GetSample() const { return fSample; }
+   ULong64_t GetSeen() const { return fSeen; }
+   std::size_t GetSampleSize() const { return fSampleSize; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESERVOIRSAMPLE
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <tuple>
 #include <utility> // make_index_sequence
 #include <vector>
 
@@ -53,6 +54,19 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// For each variation, the index of the first variation that shares the same previous node. Variations whose
+   /// filter chain does not depend on the varied columns all point to the nominal node, so with weight-only
+   /// variations the filters are only checked once per entry instead of once per variation.
+   std::vector<unsigned int> fFirstSharingPrevNode;
+
+   /// Per-slot cache of filter decisions, indexed by the first variation sharing the previous node (-1: not checked
+   /// yet for the current entry).
+   std::vector<std::vector<int>> fFilterPass;
+
+   /// Per-slot flags signalling, for each input column, whether all variations read it through the same reader, in
+   /// which case its value is fetched only once per entry and shared between the helper invocations.
+   std::vector<std::array<bool, ColumnTypes_t::list_size>> fColumnShared;
+
    /// \brief Creates new filter nodes, one per variation, from the upstream nominal one.
    /// \param nominal The nominal filter
    /// \return The varied filters
@@ -95,6 +109,20 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
          if (fIsDefine[i])
             define->MakeVariations(GetVariations());
       }
+
+      fFirstSharingPrevNode.reserve(fPrevNodes.size());
+      for (auto i = 0u; i < fPrevNodes.size(); ++i) {
+         auto firstIdx = i;
+         for (auto j = 0u; j < i; ++j) {
+            if (fPrevNodes[j] == fPrevNodes[i]) {
+               firstIdx = j;
+               break;
+            }
+         }
+         fFirstSharingPrevNode.push_back(firstIdx);
+      }
+      fFilterPass.resize(GetNSlots(), std::vector<int>(fPrevNodes.size()));
+      fColumnShared.resize(GetNSlots());
    }
 
    /// This constructor takes in input a vector of previous nodes, motivated by the CloneAction logic.
@@ -137,6 +165,14 @@ public:
       for (const auto &variation : GetVariations())
          fInputValues[slot].emplace_back(GetColumnReaders(slot, r, ColumnTypes_t{}, info, variation));
 
+      // columns for which every variation ends up with the same reader only need to be read once per entry
+      const auto &readers = fInputValues[slot];
+      for (std::size_t colIdx = 0; colIdx < ColumnTypes_t::list_size; ++colIdx) {
+         fColumnShared[slot][colIdx] =
+            std::all_of(readers.begin(), readers.end(),
+                        [&](const auto &varReaders) { return varReaders[colIdx] == readers[0][colIdx]; });
+      }
+
       std::for_each(fHelpers.begin(), fHelpers.end(), [=](Helper &h) { h.InitTask(r, slot); });
    }
 
@@ -153,22 +189,43 @@ public:
                               "FilterAvailable/FilterMissing to discard/keep entries with missing values instead."};
    }
 
+   /// Run all variations for this entry in a single pass.
+   /// Filter decisions are only computed once per distinct upstream node and values of columns that are not affected
+   /// by any variation are only fetched once and shared between the helper invocations, so that e.g. weight-only
+   /// variations do not re-read the unvaried columns and do not re-check the nominal filters per variation.
    template <typename... ColTypes, std::size_t... ReaderIdxs>
-   void CallExec(unsigned int slot, unsigned int varIdx, Long64_t entry, TypeList<ColTypes...>,
-                 std::index_sequence<ReaderIdxs...>)
+   void RunAllVariations(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<ReaderIdxs...>)
    {
-      fHelpers[varIdx].Exec(slot, GetValueChecked<ColTypes>(slot, varIdx, ReaderIdxs, entry)...);
-      (void)entry;
-   }
+      auto &filterPass = fFilterPass[slot];
+      std::fill(filterPass.begin(), filterPass.end(), -1);
+
+      const auto &colShared = fColumnShared[slot];
+      std::tuple<ColTypes *...> sharedValues{static_cast<ColTypes *>(nullptr)...};
+      bool sharedFetched = false;
 
-   void Run(unsigned int slot, Long64_t entry) final
-   {
       for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
-            CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+         auto &pass = filterPass[fFirstSharingPrevNode[varIdx]];
+         if (pass < 0)
+            pass = fPrevNodes[varIdx]->CheckFilters(slot, entry);
+         if (!pass)
+            continue;
+         if (!sharedFetched) {
+            // values are fetched lazily so that entries for which no variation passes its filters never read them
+            ((colShared[ReaderIdxs]
+                 ? (void)(std::get<ReaderIdxs>(sharedValues) = &GetValueChecked<ColTypes>(slot, 0u, ReaderIdxs, entry))
+                 : (void)0),
+             ...);
+            sharedFetched = true;
+         }
+         fHelpers[varIdx].Exec(slot, (colShared[ReaderIdxs]
+                                         ? *std::get<ReaderIdxs>(sharedValues)
+                                         : GetValueChecked<ColTypes>(slot, varIdx, ReaderIdxs, entry))...);
       }
+      (void)entry;
    }
 
+   void Run(unsigned int slot, Long64_t entry) final { RunAllVariations(slot, entry, ColumnTypes_t{}, TypeInd_t{}); }
+
    void TriggerChildrenCount() final
    {
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
@@ -34,6 +34,13 @@ class RNTupleWriter;
 class REntry;
 class TBufferMerger;
 class TBufferMergerFile;
+namespace Experimental {
+class RNTupleParallelWriter;
+class RNTupleFillContext;
+namespace Detail {
+class RRawPtrWriteEntry;
+} // namespace Detail
+} // namespace Experimental
 } // namespace ROOT
 
 namespace ROOT::Internal::RDF {
@@ -102,6 +109,60 @@ public:
    UntypedSnapshotRNTupleHelper MakeNew(void *newName);
 };
 
+class R__CLING_PTRCHECK(off) UntypedSnapshotRNTupleHelperMT final : public RActionImpl<UntypedSnapshotRNTupleHelperMT> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fDirName;
+   std::string fNTupleName;
+
+   std::unique_ptr<TFile> fOutputFile;
+
+   RSnapshotOptions fOptions;
+   ROOT::Detail::RDF::RLoopManager *fInputLoopManager;
+   ROOT::Detail::RDF::RLoopManager *fOutputLoopManager;
+   ColumnNames_t fInputFieldNames; // This contains the resolved aliases
+   ColumnNames_t fOutputFieldNames;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   /// One fill context per slot, so that clusters are prepared and committed independently.
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   /// One entry per slot, connected to the model clone of the corresponding fill context.
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RRawPtrWriteEntry>> fOutputEntries;
+
+   std::vector<bool> fIsDefine;
+
+   std::vector<const std::type_info *> fInputColumnTypeIDs; // Types for the input columns
+
+public:
+   UntypedSnapshotRNTupleHelperMT(unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                                  std::string_view ntuplename, const ColumnNames_t &vfnames,
+                                  const ColumnNames_t &fnames, const RSnapshotOptions &options,
+                                  ROOT::Detail::RDF::RLoopManager *inputLM, ROOT::Detail::RDF::RLoopManager *outputLM,
+                                  std::vector<bool> &&isDefine, const std::vector<const std::type_info *> &colTypeIDs);
+
+   UntypedSnapshotRNTupleHelperMT(const UntypedSnapshotRNTupleHelperMT &) = delete;
+   UntypedSnapshotRNTupleHelperMT &operator=(const UntypedSnapshotRNTupleHelperMT &) = delete;
+   UntypedSnapshotRNTupleHelperMT(UntypedSnapshotRNTupleHelperMT &&) noexcept;
+   UntypedSnapshotRNTupleHelperMT &operator=(UntypedSnapshotRNTupleHelperMT &&) noexcept;
+   ~UntypedSnapshotRNTupleHelperMT() final;
+
+   void InitTask(TTreeReader *, unsigned int slot);
+
+   void Exec(unsigned int slot, const std::vector<void *> &values);
+
+   void Initialize();
+
+   void Finalize();
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   ROOT::RDF::SampleCallback_t GetSampleCallback() final
+   {
+      return [](unsigned int, const RSampleInfo &) mutable {};
+   }
+
+   UntypedSnapshotRNTupleHelperMT MakeNew(void *newName);
+};
+
 class R__CLING_PTRCHECK(off) UntypedSnapshotTTreeHelper final : public RActionImpl<UntypedSnapshotTTreeHelper> {
    std::string fFileName;
    std::string fDirName;
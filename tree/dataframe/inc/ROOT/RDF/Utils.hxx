@@ -148,6 +148,8 @@ char TypeID2ROOTTypeName(const std::type_info &tid);
 
 unsigned int GetNSlots();
 
+std::string MakeTemporaryCacheFileName();
+
 /// `type` is TypeList if MustRemove is false, otherwise it is a TypeList with the first type removed
 template <bool MustRemove, typename TypeList>
 struct RemoveFirstParameterIf {
@@ -190,6 +190,35 @@ unsigned int RunGraphs(std::vector<RResultHandle> handles);
 
 namespace Experimental {
 
+// clang-format off
+/// Run the event loops of multiple RDataFrames over a single shared scan of their common dataset.
+/// \param[in] handles A vector of RResultHandles whose event loops should be run.
+/// \return The number of distinct computation graphs that have been processed.
+///
+/// Unlike \ref ROOT::RDF::RunGraphs "RunGraphs", which runs the event loops concurrently but still reads the
+/// dataset once per computation graph, this function interleaves the per-entry processing of all graphs so that
+/// the dataset is scanned once: each entry is handed to every graph in turn before moving on to the next entry,
+/// so the baskets decompressed for the first graph are reused by the others instead of being read and
+/// decompressed again. This is beneficial when several independent analyses (e.g. built via separate RDataFrame
+/// constructions) iterate over the same input files and I/O or decompression dominates the runtime.
+///
+/// All computation graphs must iterate over the same entries; a `std::runtime_error` is thrown otherwise.
+/// The shared scan is single-threaded and requires dataset-backed event loops; if these conditions are not met
+/// (e.g. EnableImplicitMT is active) the event loops are run sequentially instead, with a warning.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df1("tree", "file.root");
+/// auto r1 = df1.Histo1D("var1");
+///
+/// ROOT::RDataFrame df2("tree", "file.root");
+/// auto r2 = df2.Sum("var2");
+///
+/// // RResultPtr -> RResultHandle conversion is automatic
+/// ROOT::RDF::Experimental::RunGraphsShared({r1, r2});
+/// ~~~
+// clang-format on
+unsigned int RunGraphsShared(std::vector<RResultHandle> handles);
+
 /// \brief Produce all required systematic variations for the given result.
 /// \param[in] resPtr The result for which variations should be produced.
 /// \return A \ref ROOT::RDF::Experimental::RResultMap "RResultMap" object with full variation names as strings
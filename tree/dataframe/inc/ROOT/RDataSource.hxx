@@ -133,6 +133,7 @@ RDataSource implementations must support running multiple event-loops consecutiv
  - \b SetNSlots() is called once per RDataSource object, typically when it is associated to a RDataFrame.
  - \b GetColumnReaders() can be called several times, potentially with the same arguments, also in-between event-loops, but not during an event-loop.
  - \b GetEntryRanges() will be called several times, including during an event loop, as additional ranges are needed.  It will not be called concurrently.
+ - \b PrefetchEntryRanges() is called right after \b GetEntryRanges(): sources can optionally start loading the data for the next batch of ranges in the background while the current one is processed.
  - \b Initialize() and \b Finalize() are called once per event-loop,  right before starting and right after finishing.
  - \b InitSlot(), \b SetEntry(), and \b FinalizeSlot() can be called concurrently from multiple threads, multiple times per event-loop.
 
@@ -278,6 +279,16 @@ public:
    // clang-format on
    virtual std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() = 0;
 
+   // clang-format off
+   /// \brief Start preparing the next batch of entry ranges while the current one is processed.
+   /// Sources that can overlap I/O with computation can override this method to asynchronously load the data
+   /// backing the next batch of entry ranges, e.g. on a background thread. It is called by RDataFrame right after
+   /// GetEntryRanges, before the returned ranges are processed; the next call to GetEntryRanges must wait for the
+   /// asynchronous work to finish. The default implementation does nothing, i.e. all reading happens in
+   /// GetEntryRanges.
+   // clang-format on
+   virtual void PrefetchEntryRanges() {}
+
    // clang-format off
    /// \brief Advance the "cursors" returned by GetColumnReaders to the selected entry for a particular slot.
    /// \param[in] slot The data processing slot that needs to be considered
@@ -24,6 +24,12 @@
 namespace ROOT {
 namespace RDF {
 
+class RResultHandle;
+
+namespace Experimental {
+unsigned int RunGraphsShared(std::vector<RResultHandle> handles);
+}
+
 /// \brief A type-erased version of RResultPtr and RResultMap.
 /// RResultHandles are used to invoke ROOT::RDF::RunGraphs() and can also be useful
 /// to store result pointers of different types in the same collection. Knowledge
@@ -43,6 +49,8 @@ class RResultHandle {
 
    // The ROOT::RDF::RunGraphs helper has to access the loop manager to check whether two RResultHandles belong to the same computation graph
    friend unsigned int RunGraphs(std::vector<RResultHandle>);
+   // Same for the shared-scan variant, which additionally hands the loop managers over to a single lockstep event loop
+   friend unsigned int Experimental::RunGraphsShared(std::vector<RResultHandle>);
 
    /// Get the pointer to the encapsulated result.
    /// Ownership is not transferred to the caller.
@@ -16,6 +16,7 @@
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "TError.h" // Warning
+#include "TList.h" // for merging partial results in OnPartialResultMerged
 
 #include <memory>
 #include <functional>
@@ -189,6 +190,33 @@ class RResultPtr {
    /// Triggers the event loop in the RLoopManager
    void TriggerRun();
 
+   // Merge overload for types with Merge(TCollection*), like TH1s, used by OnPartialResultMerged
+   template <typename V, typename = std::enable_if_t<std::is_base_of<TObject, V>::value, int>>
+   static auto MergePartials(V &snapshot, std::vector<V *> &partials, int /*toincreaseoverloadpriority*/)
+      -> decltype(snapshot.Merge((TCollection *)nullptr), void())
+   {
+      TList l;
+      for (auto *p : partials)
+         l.Add(p);
+      snapshot.Merge(&l);
+   }
+
+   // Merge overload for types with Merge(const std::vector&)
+   template <typename V>
+   static auto MergePartials(V &snapshot, std::vector<V *> &partials, double /*toloweroverloadpriority*/)
+      -> decltype(snapshot.Merge(std::vector<V *>{}), void())
+   {
+      snapshot.Merge(partials);
+   }
+
+   // Merge overload to error out in case no valid merge method was detected
+   template <typename V>
+   static void MergePartials(V &, ...)
+   {
+      static_assert(sizeof(V) < 0, "OnPartialResultMerged requires a result type that provides a Merge(TCollection*) "
+                                   "or Merge(const std::vector&) method.");
+   }
+
    void ThrowIfNull()
    {
       if (fObjPtr == nullptr)
@@ -351,6 +379,69 @@ public:
       return *this;
    }
 
+   // clang-format off
+   /// Register a callback that RDataFrame will execute "everyNEvents" on a merged snapshot of all partial results.
+   ///
+   /// \param[in] everyNEvents Frequency at which the callback will be called, as a number of events processed
+   /// \param[in] callback a callable with signature `void(Value_t&)` where Value_t is the type of the value contained in this RResultPtr
+   /// \return this RResultPtr, to allow chaining with other calls
+   ///
+   /// See `OnPartialResult` for a generic explanation of the callback mechanism. Compared to `OnPartialResult`,
+   /// which passes the partial result accumulated by a single worker thread, this method builds a snapshot that
+   /// merges the partial results of _all_ worker threads before invoking the callback, so in multi-thread event
+   /// loops the callback sees a value that converges towards the final result as the loop progresses. This is the
+   /// method of choice to monitor e.g. a converging histogram during a long scan:
+   /// \code{.cpp}
+   /// auto h = df.Histo1D("x");
+   /// TCanvas c("c","x hist");
+   /// h.OnPartialResultMerged(100000, [&c](TH1D &h_) { c.cd(); h_.Draw(); c.Update(); });
+   /// \endcode
+   ///
+   /// The snapshot is a temporary copy: modifying it does not affect the result, and it is only valid for the
+   /// duration of the callback. Building it costs one copy plus one merge of the per-thread partial results, so the
+   /// callback frequency should be chosen accordingly (every few seconds' worth of events, not every few events).
+   /// As for `OnPartialResult`, the callback is never executed by multiple threads concurrently. Note that worker
+   /// threads other than the one running the callback keep processing entries while their partial results are
+   /// merged, so the snapshot is a close approximation of the state of the computation rather than an exact
+   /// entry-count cut: this is harmless for monitoring purposes.
+   ///
+   /// This method requires the result type to expose a `Merge(TCollection*)` (like all TH1-derived classes) or a
+   /// `Merge(const std::vector&)` method, and produces a compile-time error otherwise.
+   // clang-format on
+   RResultPtr<T> &OnPartialResultMerged(ULong64_t everyNEvents, std::function<void(T &)> callback)
+   {
+      ThrowIfNull();
+      auto actionPtr = fActionPtr;
+      const auto nSlots = fLoopManager->GetNSlots();
+      constexpr auto kUninit = std::numeric_limits<unsigned int>::max();
+      auto activeSlot = std::make_shared<std::atomic_uint>(kUninit);
+      auto c = [=](unsigned int slot) {
+         if (activeSlot->load() == kUninit) {
+            // Try to grab the right to run the callback for our slot:
+            unsigned int expected = kUninit;
+            activeSlot->compare_exchange_strong(expected, slot);
+         }
+         if (activeSlot->load() != slot)
+            return;
+
+         auto &first = *static_cast<Value_t *>(actionPtr->PartialUpdate(0u));
+         if (nSlots == 1) {
+            callback(first);
+            return;
+         }
+         // merge a copy of the first slot's partial result with the live partial results of the other slots
+         Value_t snapshot{first};
+         std::vector<Value_t *> partials;
+         partials.reserve(nSlots - 1);
+         for (auto s = 1u; s < nSlots; ++s)
+            partials.emplace_back(static_cast<Value_t *>(actionPtr->PartialUpdate(s)));
+         MergePartials(snapshot, partials, /*toselectoverload*/ 0);
+         callback(snapshot);
+      };
+      fLoopManager->RegisterCallback(everyNEvents, std::move(c));
+      return *this;
+   }
+
    // clang-format off
    /// Register a callback that RDataFrame will execute in each worker thread concurrently on that thread's partial result.
    ///
@@ -32,6 +32,7 @@ arrow::Schema.
 #include <snprintf.h>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -41,6 +42,11 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -609,6 +615,180 @@ RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::strin
    return tdf;
 }
 
+/// \brief Factory method to create an Apache Arrow RDataFrame from an IPC (Feather V2) file.
+///
+/// The file is memory-mapped and the record batches adopt the mapped buffers directly,
+/// so column data is not copied: values are served to RDataFrame straight from the
+/// page cache. Only the metadata footer is parsed eagerly.
+/// \param[in] fileName path of the Arrow IPC file.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the file
+RDataFrame FromArrowIPC(std::string_view fileName, std::vector<std::string> const &columnNames)
+{
+   const std::string fname(fileName);
+
+   auto maybeFile = arrow::io::MemoryMappedFile::Open(fname, arrow::io::FileMode::READ);
+   if (!maybeFile.ok()) {
+      throw std::runtime_error("Could not memory-map Arrow IPC file " + fname + ": " + maybeFile.status().ToString());
+   }
+
+   auto maybeReader = arrow::ipc::RecordBatchFileReader::Open(*maybeFile);
+   if (!maybeReader.ok()) {
+      throw std::runtime_error("Could not open Arrow IPC file " + fname + ": " + maybeReader.status().ToString());
+   }
+   auto reader = *maybeReader;
+
+   std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+   batches.reserve(reader->num_record_batches());
+   for (int i = 0; i < reader->num_record_batches(); ++i) {
+      auto maybeBatch = reader->ReadRecordBatch(i);
+      if (!maybeBatch.ok()) {
+         throw std::runtime_error("Could not read record batch " + std::to_string(i) + " of Arrow IPC file " + fname +
+                                  ": " + maybeBatch.status().ToString());
+      }
+      batches.emplace_back(*maybeBatch);
+   }
+
+   auto maybeTable = arrow::Table::FromRecordBatches(reader->schema(), batches);
+   if (!maybeTable.ok()) {
+      throw std::runtime_error("Could not create table from Arrow IPC file " + fname + ": " +
+                               maybeTable.status().ToString());
+   }
+
+   return FromArrow(*maybeTable, columnNames);
+}
+
+namespace {
+
+template <typename BuilderType, typename T>
+std::shared_ptr<arrow::Array> MakeArrowArray(const std::vector<T> &values)
+{
+   BuilderType builder;
+   auto status = builder.AppendValues(reinterpret_cast<const typename BuilderType::value_type *>(values.data()),
+                                      values.size());
+   std::shared_ptr<arrow::Array> array;
+   if (status.ok())
+      status = builder.Finish(&array);
+   if (!status.ok())
+      throw std::runtime_error("Could not create Arrow array: " + status.ToString());
+   return array;
+}
+
+std::shared_ptr<arrow::Array> MakeArrowArray(const std::vector<bool> &values)
+{
+   arrow::BooleanBuilder builder;
+   auto status = builder.AppendValues(values);
+   std::shared_ptr<arrow::Array> array;
+   if (status.ok())
+      status = builder.Finish(&array);
+   if (!status.ok())
+      throw std::runtime_error("Could not create Arrow array: " + status.ToString());
+   return array;
+}
+
+std::shared_ptr<arrow::Array> MakeArrowArray(const std::vector<std::string> &values)
+{
+   arrow::StringBuilder builder;
+   auto status = builder.AppendValues(values);
+   std::shared_ptr<arrow::Array> array;
+   if (status.ok())
+      status = builder.Finish(&array);
+   if (!status.ok())
+      throw std::runtime_error("Could not create Arrow array: " + status.ToString());
+   return array;
+}
+
+} // anonymous namespace
+
+/// \brief Save the content of an RDataFrame node into an Apache Arrow IPC (Feather V2) file.
+///
+/// One Take action is booked per column, so a single event loop produces all values,
+/// which are then appended to Arrow builders in bulk and written out as one table.
+/// Supported column types are the fundamental ones understood by Arrow:
+/// Long64_t, ULong64_t, Int_t, UInt_t, float, double, bool and std::string.
+/// \param[in] df the RDataFrame node to save.
+/// \param[in] fileName path of the output Arrow IPC file.
+/// \param[in] columnNames the name of the columns to save
+/// In case columnNames is empty, we save all the columns of the node
+void ToArrowIPC(ROOT::RDF::RNode df, std::string_view fileName, std::vector<std::string> columnNames)
+{
+   if (columnNames.empty())
+      columnNames = df.GetColumnNames();
+
+   arrow::FieldVector fields;
+   // deferred so that all Take results are booked upfront and run in the same event loop
+   std::vector<std::function<std::shared_ptr<arrow::Array>()>> makeArrays;
+
+   for (const auto &name : columnNames) {
+      const auto type = df.GetColumnType(name);
+      if (type == "Long64_t" || type == "long long") {
+         auto res = df.Take<Long64_t>(name);
+         fields.push_back(arrow::field(name, arrow::int64()));
+         makeArrays.emplace_back([res] { return MakeArrowArray<arrow::Int64Builder>(*res); });
+      } else if (type == "ULong64_t" || type == "unsigned long long") {
+         auto res = df.Take<ULong64_t>(name);
+         fields.push_back(arrow::field(name, arrow::uint64()));
+         makeArrays.emplace_back([res] { return MakeArrowArray<arrow::UInt64Builder>(*res); });
+      } else if (type == "Int_t" || type == "int") {
+         auto res = df.Take<Int_t>(name);
+         fields.push_back(arrow::field(name, arrow::int32()));
+         makeArrays.emplace_back([res] { return MakeArrowArray<arrow::Int32Builder>(*res); });
+      } else if (type == "UInt_t" || type == "unsigned int") {
+         auto res = df.Take<UInt_t>(name);
+         fields.push_back(arrow::field(name, arrow::uint32()));
+         makeArrays.emplace_back([res] { return MakeArrowArray<arrow::UInt32Builder>(*res); });
+      } else if (type == "float") {
+         auto res = df.Take<float>(name);
+         fields.push_back(arrow::field(name, arrow::float32()));
+         makeArrays.emplace_back([res] { return MakeArrowArray<arrow::FloatBuilder>(*res); });
+      } else if (type == "double") {
+         auto res = df.Take<double>(name);
+         fields.push_back(arrow::field(name, arrow::float64()));
+         makeArrays.emplace_back([res] { return MakeArrowArray<arrow::DoubleBuilder>(*res); });
+      } else if (type == "bool" || type == "Bool_t") {
+         auto res = df.Take<bool>(name);
+         fields.push_back(arrow::field(name, arrow::boolean()));
+         makeArrays.emplace_back([res] { return MakeArrowArray(*res); });
+      } else if (type == "std::string" || type == "string") {
+         auto res = df.Take<std::string>(name);
+         fields.push_back(arrow::field(name, arrow::utf8()));
+         makeArrays.emplace_back([res] { return MakeArrowArray(*res); });
+      } else {
+         throw std::runtime_error("ToArrowIPC: column \"" + name + "\" has unsupported type " + type);
+      }
+   }
+
+   // triggers the single event loop on first dereference of a Take result
+   arrow::ArrayVector arrays;
+   arrays.reserve(makeArrays.size());
+   for (auto &makeArray : makeArrays)
+      arrays.emplace_back(makeArray());
+
+   auto schema = arrow::schema(fields);
+   auto table = arrow::Table::Make(schema, arrays);
+
+   const std::string fname(fileName);
+
+   auto maybeOut = arrow::io::FileOutputStream::Open(fname);
+   if (!maybeOut.ok()) {
+      throw std::runtime_error("Could not open output file " + fname + ": " + maybeOut.status().ToString());
+   }
+
+   auto maybeWriter = arrow::ipc::MakeFileWriter(*maybeOut, schema);
+   if (!maybeWriter.ok()) {
+      throw std::runtime_error("Could not create Arrow IPC writer for " + fname + ": " +
+                               maybeWriter.status().ToString());
+   }
+   auto writer = *maybeWriter;
+
+   auto status = writer->WriteTable(*table);
+   if (status.ok())
+      status = writer->Close();
+   if (!status.ok()) {
+      throw std::runtime_error("Could not write Arrow IPC file " + fname + ": " + status.ToString());
+   }
+}
+
 } // namespace RDF
 
 } // namespace ROOT
@@ -82,13 +82,20 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <TError.h>
+#include <TROOT.h> // IsImplicitMTEnabled
+
+#include "RConfigure.h" // R__USE_IMT
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <cinttypes>
+#include <cstring>
 #include <iterator>
 #include <memory>
-#include <sstream>
 #include <string>
 
 namespace ROOT {
@@ -184,36 +191,61 @@ void RCsvDS::FillHeaders(const std::string &line)
 
 void RCsvDS::FillRecord(const std::string &line, Record_t &record)
 {
+   // std::from_chars does not accept a leading '+' and has no floating-point support on all platforms,
+   // fall back to the std::sto* conversions (and their error reporting) for whatever it does not parse
+   auto fnToDouble = [](const std::string &col) {
+      double d;
+#ifdef __cpp_lib_to_chars
+      if (std::from_chars(col.data(), col.data() + col.size(), d).ec == std::errc{})
+         return d;
+#endif
+      d = std::stod(col);
+      return d;
+   };
+
+   auto fnToLong64 = [](const std::string &col) {
+      Long64_t l;
+      if (std::from_chars(col.data(), col.data() + col.size(), l).ec == std::errc{})
+         return l;
+      l = std::stoll(col);
+      return l;
+   };
+
+   auto fnMarkEmpty = [this](const std::string &header) {
+      std::lock_guard<std::mutex> lock(fColEmptyMutex);
+      fColContainingEmpty.insert(header);
+   };
+
    auto i = 0U;
 
    auto columns = ParseColumns(line);
+   record.reserve(columns.size());
+
+   auto colTypeIter = fColTypesList.begin();
 
    for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+      if (colTypeIter == fColTypesList.end())
+         break;
+      const auto colType = *colTypeIter++;
 
       switch (colType) {
       case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
+         record.emplace_back(new double((col != "nan") ? fnToDouble(col) : std::numeric_limits<double>::quiet_NaN()));
          break;
       }
       case 'L': {
          if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
+            record.emplace_back(new Long64_t(fnToLong64(col)));
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
+            fnMarkEmpty(fHeaders[i]);
             record.emplace_back(new Long64_t(0));
          }
          break;
       }
       case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
-         }
+         if (col == "nan")
+            fnMarkEmpty(fHeaders[i]);
+         record.emplace_back(new bool(col == "true"));
          break;
       }
       case 'T': {
@@ -321,9 +353,10 @@ void RCsvDS::InferType(const std::string &col, unsigned int idxCol)
    fColTypesList.push_back(type);
 }
 
-std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
+std::vector<std::string> RCsvDS::ParseColumns(const std::string &line) const
 {
    std::vector<std::string> columns;
+   columns.reserve(fHeaders.size());
 
    for (size_t i = 0; i < line.size(); ++i) {
       i = ParseValue(line, columns, i);
@@ -332,24 +365,33 @@ std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
    return columns;
 }
 
-size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
+size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i) const
 {
    std::string val;
-   bool quoted = false;
    const size_t prevPos = i; // used to check if cell is empty
 
-   for (; i < line.size(); ++i) {
-      if (line[i] == fOptions.fDelimiter && !quoted) {
-         break;
-      } else if (line[i] == '"') {
-         // Keep just one quote for escaped quotes, none for the normal quotes
-         if (line[i + 1] != '"') {
-            quoted = !quoted;
+   // fast path for cells without quotes: delimiter and quote lookup through memchr, cell copied in one go
+   const auto posDelim = line.find(fOptions.fDelimiter, i);
+   const size_t cellEnd = posDelim == std::string::npos ? line.size() : posDelim;
+   if (!std::memchr(line.data() + i, '"', cellEnd - i)) {
+      val.assign(line, i, cellEnd - i);
+      i = cellEnd;
+   } else {
+      bool quoted = false;
+
+      for (; i < line.size(); ++i) {
+         if (line[i] == fOptions.fDelimiter && !quoted) {
+            break;
+         } else if (line[i] == '"') {
+            // Keep just one quote for escaped quotes, none for the normal quotes
+            if (line[i + 1] != '"') {
+               quoted = !quoted;
+            } else {
+               val += line[++i];
+            }
          } else {
-            val += line[++i];
+            val += line[i];
          }
-      } else {
-         val += line[i];
       }
    }
 
@@ -460,9 +502,9 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    Construct();
 }
 
-void RCsvDS::FreeRecords()
+void RCsvDS::FreeRecords(std::vector<Record_t> &records)
 {
-   for (auto &record : fRecords) {
+   for (auto &record : records) {
       for (size_t i = 0; i < record.size(); ++i) {
          void *p = record[i];
          const auto colType = fColTypes[fHeaders[i]];
@@ -486,18 +528,68 @@ void RCsvDS::FreeRecords()
          }
       }
    }
-   fRecords.clear();
+   records.clear();
+}
+
+void RCsvDS::FreeRecords()
+{
+   FreeRecords(fRecords);
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Wait for a pending background read, if any, and free the records it produced.
+void RCsvDS::DiscardPrefetchedRecords()
+{
+   if (!fPrefetchedRecords.valid())
+      return;
+   auto records = fPrefetchedRecords.get();
+   FreeRecords(records);
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Read the next chunk of lines (all of them if no chunk size is set) into typed records.
+/// Lines are read sequentially, but their conversion into records is independent per line:
+/// with implicit multi-threading enabled, large chunks are parsed in parallel.
+std::vector<RCsvDS::Record_t> RCsvDS::ReadRecordChunk()
+{
+   auto linesToRead = fOptions.fLinesChunkSize;
+   std::vector<std::string> lines;
+   if (fOptions.fLinesChunkSize > 0)
+      lines.reserve(fOptions.fLinesChunkSize);
+   std::string line;
+   while ((-1LL == fOptions.fLinesChunkSize || 0 != linesToRead) && Readln(line)) {
+      lines.emplace_back(std::move(line));
+      --linesToRead;
+   }
+
+   std::vector<Record_t> records(lines.size());
+
+#ifdef R__USE_IMT
+   // only worth spawning tasks when enough lines per task are available
+   if (ROOT::IsImplicitMTEnabled() && lines.size() >= 4096u) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&lines, &records, this](ULong64_t i) { FillRecord(lines[i], records[i]); },
+                   ROOT::TSeqUL(lines.size()), pool.GetPoolSize() * 4);
+      return records;
+   }
+#endif
+
+   for (std::size_t i = 0u; i < lines.size(); ++i)
+      FillRecord(lines[i], records[i]);
+   return records;
 }
 
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RCsvDS::~RCsvDS()
 {
+   DiscardPrefetchedRecords();
    FreeRecords();
 }
 
 void RCsvDS::Finalize()
 {
+   DiscardPrefetchedRecords();
    RewindToData();
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
@@ -511,16 +603,13 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
-   // Read records and store them in memory
-   auto linesToRead = fOptions.fLinesChunkSize;
+   // Read records and store them in memory, unless a background read started by PrefetchEntryRanges
+   // already did so
    FreeRecords();
-
-   std::string line;
-   while ((-1LL == fOptions.fLinesChunkSize || 0 != linesToRead) && Readln(line)) {
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
-   }
+   if (fPrefetchedRecords.valid())
+      fRecords = fPrefetchedRecords.get();
+   else
+      fRecords = ReadRecordChunk();
 
    if (!fColContainingEmpty.empty()) {
       std::string msg = "";
@@ -567,6 +656,15 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    return entryRanges;
 }
 
+void RCsvDS::PrefetchEntryRanges()
+{
+   // Read the next chunk of lines on a background thread, overlapping the parsing I/O with the
+   // processing of the current chunk. The records are picked up by the next call to GetEntryRanges.
+   if (fPrefetchedRecords.valid())
+      return;
+   fPrefetchedRecords = std::async(std::launch::async, [this] { return ReadRecordChunk(); });
+}
+
 RCsvDS::ColType_t RCsvDS::GetType(std::string_view colName) const
 {
    if (!HasColumn(colName)) {
@@ -11,8 +11,12 @@
 #include "ROOT/RDF/ActionHelpers.hxx"
 
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 #include <RtypesCore.h>
+#include <TROOT.h> // IsImplicitMTEnabled
 #include <TStatistic.h>
 
 namespace ROOT {
@@ -37,6 +41,18 @@ void UnsetDirectoryIfPossible(TH1 *h)
 }
 void UnsetDirectoryIfPossible(...) {}
 
+void RunMergeTasks(std::vector<std::function<void()>> &tasks)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && tasks.size() > 1) {
+      ROOT::TThreadExecutor{}.Foreach([](const std::function<void()> &task) { task(); }, tasks);
+      return;
+   }
+#endif
+   for (auto &task : tasks)
+      task();
+}
+
 CountHelper::CountHelper(const std::shared_ptr<ULong64_t> &resultCount, const unsigned int nSlots)
    : fResultCount(resultCount), fCounts(nSlots, 0)
 {
@@ -220,6 +236,27 @@ void StdDevHelper::Finalize()
    *fResultStdDev = std::sqrt(variance);
 }
 
+QuantileHelper::QuantileHelper(const std::shared_ptr<std::vector<double>> &quantilesVPtr,
+                               const std::vector<double> &levels, std::size_t compression, const unsigned int nSlots)
+   : fResultQuantiles(quantilesVPtr), fLevels(levels)
+{
+   fSketches.reserve(nSlots);
+   for (unsigned int slot = 0; slot < nSlots; ++slot)
+      fSketches.emplace_back(compression);
+}
+
+void QuantileHelper::Finalize()
+{
+   // Merges the per-slot sketches and derives the quantile estimates from the combined summary.
+   auto &merged = fSketches[0];
+   for (std::size_t slot = 1; slot < fSketches.size(); ++slot)
+      merged.Merge(fSketches[slot]);
+
+   fResultQuantiles->resize(fLevels.size());
+   for (std::size_t i = 0; i < fLevels.size(); ++i)
+      (*fResultQuantiles)[i] = merged.GetQuantile(fLevels[i]);
+}
+
 // External templates are disabled for gcc5 since this version wrongly omits the C++11 ABI attribute
 #if __GNUC__ > 5
 template class TakeHelper<bool, bool, std::vector<bool>>;
@@ -38,6 +38,14 @@ RDisplayElement::RDisplayElement(const std::string &representation) : fRepresent
    SetPrint();
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// Constructor stealing the representation string
+/// \param[in] representation The representation string
+RDisplayElement::RDisplayElement(std::string &&representation) : fRepresentation(std::move(representation))
+{
+   SetPrint();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// Constructor assuming an empty representation to be printed
 RDisplayElement::RDisplayElement()
@@ -125,18 +133,30 @@ void RDisplay::AddToRow(const std::string &stringEle)
    MovePosition();
 }
 
-void RDisplay::AddCollectionToRow(const std::vector<std::string> &collection)
+void RDisplay::AddToRow(std::string &&stringEle)
+{
+   // If the current element is wider than the widest element found, update the width
+   EnsureCurrentColumnWidth(stringEle.length());
+
+   // Save the element without copying the string...
+   fTable[fCurrentRow][fCurrentColumn] = DElement_t(std::move(stringEle));
+
+   // ...and move to the next
+   MovePosition();
+}
+
+void RDisplay::AddCollectionToRow(std::vector<std::string> &collection)
 {
    auto row = fCurrentRow;
    // For each element of the collection, save it. The first element will be in the current row, next ones will have
    // their own row.
    size_t collectionSize = collection.size();
    for (size_t index = 0; index < collectionSize; ++index) {
-      auto stringEle = collection[index];
-      auto element = DElement_t(stringEle);
-
       // Update the width if this element is the biggest found
-      EnsureCurrentColumnWidth(stringEle.length());
+      EnsureCurrentColumnWidth(collection[index].length());
+
+      // The collection is rebuilt for the next row, so its strings can be stolen rather than copied
+      auto element = DElement_t(std::move(collection[index]));
 
       if (index < fNMaxCollectionElements) {
          // Do nothing, by default DisplayElement is printed
@@ -150,7 +170,7 @@ void RDisplay::AddCollectionToRow(const std::vector<std::string> &collection)
       }
 
       // Save the element
-      fTable[row][fCurrentColumn] = element;
+      fTable[row][fCurrentColumn] = std::move(element);
       ++row;
 
       if (index != collectionSize - 1 && fTable.size() <= row) {
@@ -317,22 +337,25 @@ std::string RDisplay::AsStringMarkdown(bool considerDots) const
       stringRow << "| ";
       for (size_t columnIndex = 0; columnIndex < columnsToPrint; ++columnIndex) {
          const auto &element = row[columnIndex];
-         std::string printedElement = "";
+         static const std::string dots = "...";
+         static const std::string empty;
+         // Reference the representation instead of copying it, cells can be large collection elements
+         const std::string *printedElement = &empty;
 
          // TODO: add a function option to avoid this behavior
          if (considerDots && element.IsDot()) {
-            printedElement = "...";
+            printedElement = &dots;
          } else if (!considerDots || element.IsPrint()) {
-            printedElement = element.GetRepresentation();
+            printedElement = &element.GetRepresentation();
          } else { // IsIgnore
-            // Do nothing, printedElement remains ""
+            // Do nothing, printedElement remains empty
          }
-         if (!printedElement.empty()) {
+         if (!printedElement->empty()) {
             // Found at least one element, so the row is not empty.
             isRowEmpty = false;
          }
 
-         stringRow << std::left << std::setw(fWidths[columnIndex]) << std::setfill(fgSeparator) << printedElement
+         stringRow << std::left << std::setw(fWidths[columnIndex]) << std::setfill(fgSeparator) << *printedElement
                    << " | ";
       }
       if (!isRowEmpty) {
@@ -141,6 +141,67 @@ unsigned int ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    return uniqueLoops.size();
 }
 
+unsigned int ROOT::RDF::Experimental::RunGraphsShared(std::vector<RResultHandle> handles)
+{
+   if (handles.empty()) {
+      Warning("RunGraphsShared", "Got an empty list of handles, now quitting.");
+      return 0u;
+   }
+
+   // Check that there are results which have not yet been run
+   const unsigned int nToRun =
+      std::count_if(handles.begin(), handles.end(), [](const auto &h) { return !h.IsReady(); });
+   if (nToRun < handles.size()) {
+      Warning("RunGraphsShared", "Got %zu handles from which %zu link to results which are already ready.",
+              handles.size(), handles.size() - nToRun);
+   }
+   if (nToRun == 0u)
+      return 0u;
+
+   // Find the unique event loops
+   auto sameGraph = [](const RResultHandle &a, const RResultHandle &b) { return a.fLoopManager < b.fLoopManager; };
+   std::set<RResultHandle, decltype(sameGraph)> s(handles.begin(), handles.end(), sameGraph);
+   std::vector<RResultHandle> uniqueLoops(s.begin(), s.end());
+
+   // Trigger jitting. One call is enough to jit the code required by all computation graphs.
+   TStopwatch sw;
+   sw.Start();
+   {
+      const auto effectiveVerbosity = ROOT::Internal::GetChannelOrManager(ROOT::Detail::RDF::RDFLogChannel())
+                                         .GetEffectiveVerbosity(ROOT::RLogManager::Get());
+      if (effectiveVerbosity >= ROOT::ELogLevel::kDebug + 10) {
+         // a very high verbosity was requested, let's not silence anything
+         uniqueLoops[0].fLoopManager->Jit();
+      } else {
+         // silence logs from RLoopManager::Jit: RunGraphsShared does its own logging
+         auto silenceRDFLogs = ROOT::RLogScopedVerbosity(ROOT::Detail::RDF::RDFLogChannel(), ROOT::ELogLevel::kError);
+         uniqueLoops[0].fLoopManager->Jit();
+      }
+   }
+   sw.Stop();
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+      << "Just-in-time compilation phase for RunGraphsShared (" << uniqueLoops.size()
+      << " unique computation graphs) completed"
+      << (sw.RealTime() > 1e-3 ? " in " + std::to_string(sw.RealTime()) + " seconds." : " in less than 1ms.");
+
+   // Hand all event loops over to a single lockstep scan of the dataset (or to sequential event loops if the
+   // graphs are not suitable for sharing, see RLoopManager::RunSharedScan).
+   std::vector<ROOT::Detail::RDF::RLoopManager *> lms;
+   lms.reserve(uniqueLoops.size());
+   for (auto &h : uniqueLoops)
+      if (h.fLoopManager)
+         lms.push_back(h.fLoopManager);
+
+   sw.Start();
+   ROOT::Detail::RDF::RLoopManager::RunSharedScan(lms);
+   sw.Stop();
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+      << "Finished RunGraphsShared run (" << uniqueLoops.size() << " unique computation graphs, " << sw.CpuTime()
+      << "s CPU, " << sw.RealTime() << "s elapsed).";
+
+   return uniqueLoops.size();
+}
+
 ROOT::RDF::Experimental::SnapshotPtr_t ROOT::RDF::Experimental::VariationsFor(ROOT::RDF::Experimental::SnapshotPtr_t)
 {
    throw std::logic_error("Varying a Snapshot result is not implemented yet.");
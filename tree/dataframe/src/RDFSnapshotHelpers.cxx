@@ -22,7 +22,10 @@
 #include <ROOT/REntry.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleFillContext.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
 #include <ROOT/RNTupleWriter.hxx>
+#include <ROOT/RRawPtrWriteEntry.hxx>
 #include <ROOT/RTTreeDS.hxx>
 #include <ROOT/TBufferMerger.hxx>
 
@@ -837,38 +840,60 @@ void ROOT::Internal::RDF::UntypedSnapshotRNTupleHelper::Exec(unsigned int /* slo
    fWriter->Fill();
 }
 
-void ROOT::Internal::RDF::UntypedSnapshotRNTupleHelper::Initialize()
+namespace {
+
+/// Populates the (bare or default) model with one field per output column, using the input column types.
+void AddSnapshotRNTupleFields(ROOT::RNTupleModel &model, const ROOT::Internal::RDF::ColumnNames_t &inputFieldNames,
+                              const ROOT::Internal::RDF::ColumnNames_t &outputFieldNames,
+                              const std::vector<const std::type_info *> &inputColumnTypeIDs,
+                              ROOT::Detail::RDF::RLoopManager &inputLM, const ROOT::RDF::RSnapshotOptions &options)
 {
-   auto model = ROOT::RNTupleModel::Create();
-   auto nFields = fOutputFieldNames.size();
+   auto nFields = outputFieldNames.size();
    for (decltype(nFields) i = 0; i < nFields; i++) {
       // Need to retrieve the type of every field to create as a string
       // If the input type for a field does not have RTTI, internally we store it as the tag UseNativeDataType. When
       // that is detected, we need to ask the data source which is the type name based on the on-disk information.
-      const auto typeName = *fInputColumnTypeIDs[i] == typeid(ROOT::Internal::RDF::UseNativeDataType)
-                               ? ROOT::Internal::RDF::GetTypeNameWithOpts(*fInputLoopManager->GetDataSource(),
-                                                                          fInputFieldNames[i], fOptions.fVector2RVec)
-                               : ROOT::Internal::RDF::TypeID2TypeName(*fInputColumnTypeIDs[i]);
-      model->AddField(ROOT::RFieldBase::Create(fOutputFieldNames[i], typeName).Unwrap());
+      const auto typeName = *inputColumnTypeIDs[i] == typeid(ROOT::Internal::RDF::UseNativeDataType)
+                               ? ROOT::Internal::RDF::GetTypeNameWithOpts(*inputLM.GetDataSource(),
+                                                                          inputFieldNames[i], options.fVector2RVec)
+                               : ROOT::Internal::RDF::TypeID2TypeName(*inputColumnTypeIDs[i]);
+      model.AddField(ROOT::RFieldBase::Create(outputFieldNames[i], typeName).Unwrap());
    }
-   fOutputEntry = &model->GetDefaultEntry();
-
-   ROOT::RNTupleWriteOptions writeOptions;
-   writeOptions.SetCompression(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
+}
 
-   fOutputFile.reset(TFile::Open(fFileName.c_str(), fOptions.fMode.c_str()));
-   if (!fOutputFile)
-      throw std::runtime_error("Snapshot: could not create output file " + fFileName);
+/// Opens the snapshot output file and returns the directory the ntuple should be written to.
+TDirectory *OpenSnapshotRNTupleOutput(std::unique_ptr<TFile> &outputFile, const std::string &fileName,
+                                      const std::string &dirName, const ROOT::RDF::RSnapshotOptions &options)
+{
+   outputFile.reset(TFile::Open(fileName.c_str(), options.fMode.c_str()));
+   if (!outputFile)
+      throw std::runtime_error("Snapshot: could not create output file " + fileName);
 
-   TDirectory *outputDir = fOutputFile.get();
-   if (!fDirName.empty()) {
-      TString checkupdate = fOptions.fMode;
+   TDirectory *outputDir = outputFile.get();
+   if (!dirName.empty()) {
+      TString checkupdate = options.fMode;
       checkupdate.ToLower();
       if (checkupdate == "update")
-         outputDir = fOutputFile->mkdir(fDirName.c_str(), "", true); // do not overwrite existing directory
+         outputDir = outputFile->mkdir(dirName.c_str(), "", true); // do not overwrite existing directory
       else
-         outputDir = fOutputFile->mkdir(fDirName.c_str());
+         outputDir = outputFile->mkdir(dirName.c_str());
    }
+   return outputDir;
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::RDF::UntypedSnapshotRNTupleHelper::Initialize()
+{
+   auto model = ROOT::RNTupleModel::Create();
+   AddSnapshotRNTupleFields(*model, fInputFieldNames, fOutputFieldNames, fInputColumnTypeIDs, *fInputLoopManager,
+                            fOptions);
+   fOutputEntry = &model->GetDefaultEntry();
+
+   ROOT::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
+
+   TDirectory *outputDir = OpenSnapshotRNTupleOutput(fOutputFile, fFileName, fDirName, fOptions);
 
    fWriter = ROOT::RNTupleWriter::Append(std::move(model), fNTupleName, *outputDir, writeOptions);
 }
@@ -900,3 +925,116 @@ ROOT::Internal::RDF::UntypedSnapshotRNTupleHelper::MakeNew(void *newName)
                                        fInputLoopManager,  fOutputLoopManager, std::vector<bool>(fIsDefine),
                                        fInputColumnTypeIDs};
 }
+
+ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::UntypedSnapshotRNTupleHelperMT(
+   unsigned int nSlots, std::string_view filename, std::string_view dirname, std::string_view ntuplename,
+   const ColumnNames_t &vfnames, const ColumnNames_t &fnames, const RSnapshotOptions &options,
+   ROOT::Detail::RDF::RLoopManager *inputLM, ROOT::Detail::RDF::RLoopManager *outputLM, std::vector<bool> &&isDefine,
+   const std::vector<const std::type_info *> &colTypeIDs)
+   : fNSlots(nSlots),
+     fFileName(filename),
+     fDirName(dirname),
+     fNTupleName(ntuplename),
+     fOutputFile(nullptr),
+     fOptions(options),
+     fInputLoopManager(inputLM),
+     fOutputLoopManager(outputLM),
+     fInputFieldNames(vfnames),
+     fOutputFieldNames(ReplaceDotWithUnderscore(fnames)),
+     fWriter(nullptr),
+     fIsDefine(std::move(isDefine)),
+     fInputColumnTypeIDs(colTypeIDs)
+{
+   EnsureValidSnapshotRNTupleOutput(fOptions, fNTupleName, fFileName);
+}
+
+// Define special member methods here where the definition of all the data member types is available
+ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::UntypedSnapshotRNTupleHelperMT(
+   ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT &&) noexcept = default;
+ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT &ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::operator=(
+   ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT &&) noexcept = default;
+
+ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::~UntypedSnapshotRNTupleHelperMT()
+{
+   if (!fNTupleName.empty() && !fOutputLoopManager->GetDataSource() && fOptions.fLazy)
+      Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+}
+
+void ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::Initialize()
+{
+   // A bare model avoids the allocation of a useless default entry: each fill context creates its own entry from
+   // its clone of the model.
+   auto model = ROOT::RNTupleModel::CreateBare();
+   AddSnapshotRNTupleFields(*model, fInputFieldNames, fOutputFieldNames, fInputColumnTypeIDs, *fInputLoopManager,
+                            fOptions);
+
+   ROOT::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
+
+   TDirectory *outputDir = OpenSnapshotRNTupleOutput(fOutputFile, fFileName, fDirName, fOptions);
+
+   fWriter = ROOT::Experimental::RNTupleParallelWriter::Append(std::move(model), fNTupleName, *outputDir, writeOptions);
+
+   fFillContexts.clear();
+   fFillContexts.resize(fNSlots);
+   fOutputEntries.clear();
+   fOutputEntries.resize(fNSlots);
+}
+
+void ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::InitTask(TTreeReader *, unsigned int slot)
+{
+   // The fill context of a slot is kept for the duration of the event loop, so that partially filled clusters
+   // survive task boundaries.
+   if (!fFillContexts[slot]) {
+      fFillContexts[slot] = fWriter->CreateFillContext();
+      fOutputEntries[slot] = fFillContexts[slot]->CreateRawPtrWriteEntry();
+   }
+}
+
+void ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::Exec(unsigned int slot, const std::vector<void *> &values)
+{
+   assert(values.size() == fOutputFieldNames.size());
+   auto &entry = *fOutputEntries[slot];
+   for (decltype(values.size()) i = 0; i < values.size(); i++) {
+      entry.BindRawPtr(fOutputFieldNames[i], values[i]);
+   }
+   fFillContexts[slot]->Fill(entry);
+}
+
+void ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::Finalize()
+{
+   // All fill contexts must flush their data and be destroyed before the parallel writer commits the dataset.
+   fOutputEntries.clear();
+   fFillContexts.clear();
+   fWriter.reset();
+   // We can now set the data source of the loop manager for the RDataFrame that is returned by the Snapshot call.
+   fOutputLoopManager->SetDataSource(std::make_unique<ROOT::RDF::RNTupleDS>(fDirName + "/" + fNTupleName, fFileName));
+}
+
+/**
+ * Create a new UntypedSnapshotRNTupleHelperMT with a different output file name.
+ *
+ * \param[in] newName A type-erased string with the output file name
+ * \return UntypedSnapshotRNTupleHelperMT
+ *
+ * This MakeNew implementation is tied to the cloning feature of actions
+ * of the computation graph. In particular, cloning a Snapshot node usually
+ * also involves changing the name of the output file, otherwise the cloned
+ * Snapshot would overwrite the same file.
+ */
+ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT
+ROOT::Internal::RDF::UntypedSnapshotRNTupleHelperMT::MakeNew(void *newName)
+{
+   const std::string finalName = *reinterpret_cast<const std::string *>(newName);
+   return UntypedSnapshotRNTupleHelperMT{fNSlots,
+                                         finalName,
+                                         fDirName,
+                                         fNTupleName,
+                                         fInputFieldNames,
+                                         fOutputFieldNames,
+                                         fOptions,
+                                         fInputLoopManager,
+                                         fOutputLoopManager,
+                                         std::vector<bool>(fIsDefine),
+                                         fInputColumnTypeIDs};
+}
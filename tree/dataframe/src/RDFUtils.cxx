@@ -26,9 +26,12 @@
 #include "TInterpreter.h"
 #include "TLeaf.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
+#include "TSystem.h" // TempDirectory, GetPid
 #include "TTree.h"
 
+#include <cstdio> // std::remove
 #include <fstream>
+#include <mutex>
 #include <nlohmann/json.hpp> // nlohmann::json::parse
 #include <stdexcept>
 #include <string>
@@ -384,6 +387,30 @@ unsigned int GetNSlots()
    return nSlots;
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// Create a unique file name for an on-disk column cache in the system
+/// temporary directory. The file is removed at the end of the process.
+std::string MakeTemporaryCacheFileName()
+{
+   struct RTemporaryFiles {
+      std::mutex fMutex;
+      std::vector<std::string> fNames;
+      ~RTemporaryFiles()
+      {
+         for (const auto &n : fNames)
+            std::remove(n.c_str());
+      }
+   };
+   static RTemporaryFiles cacheFiles;
+   static unsigned int counter = 0;
+
+   std::lock_guard<std::mutex> _(cacheFiles.fMutex);
+   std::string name = std::string(gSystem->TempDirectory()) + "/rdf_cache_" + std::to_string(gSystem->GetPid()) +
+                      "_" + std::to_string(counter++) + ".root";
+   cacheFiles.fNames.push_back(name);
+   return name;
+}
+
 /// Replace occurrences of '.' with '_' in each string passed as argument.
 /// An Info message is printed when this happens. Dots at the end of the string are not replaced.
 /// An exception is thrown in case the resulting set of strings would contain duplicates.
@@ -519,8 +519,15 @@ void RLoopManager::RunEmptySourceMT()
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (OnlyRunsActions()) {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               for (auto *actionPtr : fBookedActions)
+                  actionPtr->Run(slot, currEntry);
+            }
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -544,9 +551,17 @@ void RLoopManager::RunEmptySource()
    RCallCleanUpTask cleanup(*this);
    try {
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
-      for (ULong64_t currEntry = fEmptyEntryRange.first;
-           currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (OnlyRunsActions()) {
+         for (ULong64_t currEntry = fEmptyEntryRange.first;
+              currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
+            for (auto *actionPtr : fBookedActions)
+               actionPtr->Run(0, currEntry);
+         }
+      } else {
+         for (ULong64_t currEntry = fEmptyEntryRange.first;
+              currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -632,6 +647,9 @@ void RLoopManager::RunDataSource()
       ROOT::Internal::RDF::RDSRangeRAII __{*this, 0u, 0ull};
 
       ranges = fDataSource->GetEntryRanges();
+      // give the source a chance to load the data for the next batch of ranges while we process this one
+      if (!ranges.empty())
+         fDataSource->PrefetchEntryRanges();
 
       fSampleInfos[0] = ROOT::Internal::RDF::CreateSampleInfo(*fDataSource, /*slot*/ 0, fSampleMap);
 
@@ -640,11 +658,21 @@ void RLoopManager::RunDataSource()
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
-            for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
-               if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+            if (OnlyRunsActions()) {
+               for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
+                  if (fDataSource->SetEntry(0u, entry)) {
+                     for (auto *actionPtr : fBookedActions)
+                        actionPtr->Run(0u, entry);
+                  }
+                  processedEntries++;
+               }
+            } else {
+               for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
+                  if (fDataSource->SetEntry(0u, entry)) {
+                     RunAndCheckFilters(0u, entry);
+                  }
+                  processedEntries++;
                }
-               processedEntries++;
             }
          }
       } catch (...) {
@@ -672,6 +700,148 @@ void RLoopManager::RunDataSource()
    }
 }
 
+/// Run the event loops of several RLoopManagers over the same dataset in lockstep.
+/// Each entry is processed by every computation graph in turn before moving on to the next entry, so when the inputs
+/// are backed by the same TTree (or the OS file cache) the baskets decompressed for the first graph are still loaded
+/// when the other graphs process the same entries, and the dataset is effectively read and decompressed only once
+/// instead of once per graph. See ROOT::RDF::Experimental::RunGraphsShared for the user-facing entry point.
+/// Falls back to running the event loops one after the other if any of the managers is not driven by a
+/// single-threaded data-source loop.
+void RLoopManager::RunSharedScan(const std::vector<RLoopManager *> &lms)
+{
+   assert(!lms.empty());
+   // An empty per-graph entry range would make the lockstep iteration trivially diverge, so treat it as unsuitable
+   // for sharing as well.
+   const bool allDataSource = std::all_of(lms.begin(), lms.end(), [](RLoopManager *lm) {
+      return lm->fLoopType == ELoopType::kDataSource && lm->fDataSource != nullptr &&
+             lm->fBeginEntry != lm->fEndEntry;
+   });
+   if (!allDataSource) {
+      Warning("RunGraphsShared",
+              "A shared dataset scan requires all computation graphs to use single-threaded, dataset-backed event "
+              "loops. Running the event loops one after the other instead.");
+      for (auto *lm : lms)
+         lm->Run(/*jit=*/false);
+      return;
+   }
+
+   // Change value of TTree::GetMaxTreeSize only for this scope. Revert when #6640 will be solved.
+   MaxTreeSizeRAII ctxtmts;
+
+   for (auto *lm : lms) {
+      R__LOG_INFO(RDFLogChannel()) << "Starting event loop number " << lm->fNRuns << " (shared scan).";
+      ThrowIfNSlotsChanged(lm->GetNSlots());
+      lm->InitNodes();
+   }
+
+   struct NodesCleanerRAII {
+      const std::vector<RLoopManager *> &fLMs;
+      ~NodesCleanerRAII()
+      {
+         for (auto *lm : fLMs)
+            lm->CleanUpNodes();
+      }
+   };
+   NodesCleanerRAII runKeeper{lms};
+
+   TStopwatch s;
+   s.Start();
+
+   // The rest mirrors RunDataSource, with the per-entry processing of all graphs interleaved.
+   for (auto *lm : lms) {
+      if (lm->fBeginEntry != 0 || lm->fEndEntry != std::numeric_limits<Long64_t>::max())
+         lm->fDataSource->SetGlobalEntryRange(
+            std::make_pair<std::uint64_t, std::uint64_t>(lm->fBeginEntry, lm->fEndEntry));
+   }
+
+   std::vector<std::unique_ptr<DSRunRAII>> sourceGuards;
+   std::vector<std::unique_ptr<RCallCleanUpTask>> cleanups;
+   for (auto *lm : lms) {
+      sourceGuards.emplace_back(std::make_unique<DSRunRAII>(*lm->fDataSource, lm->fSuppressErrorsForMissingBranches));
+      cleanups.emplace_back(std::make_unique<RCallCleanUpTask>(*lm));
+   }
+
+   auto stillRunning = [](const RLoopManager *lm) { return lm->fNStopsReceived < lm->fNChildren; };
+   std::vector<std::uint64_t> processedEntries(lms.size(), 0u);
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges{};
+   do {
+
+      std::vector<std::unique_ptr<ROOT::Internal::RDF::RDSRangeRAII>> rangeGuards;
+      for (auto *lm : lms)
+         rangeGuards.emplace_back(std::make_unique<ROOT::Internal::RDF::RDSRangeRAII>(*lm, 0u, 0ull));
+
+      ranges = lms[0]->fDataSource->GetEntryRanges();
+      for (std::size_t i = 1; i < lms.size(); ++i) {
+         if (lms[i]->fDataSource->GetEntryRanges() != ranges)
+            throw std::runtime_error("RunGraphsShared: the computation graphs do not iterate over the same dataset "
+                                     "(their entry ranges differ), cannot share the dataset scan.");
+      }
+      // give the sources a chance to load the data for the next batch of ranges while we process this one
+      if (!ranges.empty())
+         for (auto *lm : lms)
+            lm->fDataSource->PrefetchEntryRanges();
+
+      for (std::size_t i = 0; i < lms.size(); ++i)
+         lms[i]->fSampleInfos[0] = ROOT::Internal::RDF::CreateSampleInfo(*lms[i]->fDataSource, /*slot*/ 0, lms[i]->fSampleMap);
+
+      try {
+         for (const auto &range : ranges) {
+            const auto start = range.first;
+            const auto end = range.second;
+            R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({lms[0]->fDataSource->GetLabel(), start, end, 0u});
+            for (auto entry = start; entry < end; ++entry) {
+               for (std::size_t i = 0; i < lms.size(); ++i) {
+                  auto *lm = lms[i];
+                  if (!stillRunning(lm))
+                     continue;
+                  if (lm->fDataSource->SetEntry(0u, entry)) {
+                     if (lm->OnlyRunsActions()) {
+                        for (auto *actionPtr : lm->fBookedActions)
+                           actionPtr->Run(0u, entry);
+                     } else {
+                        lm->RunAndCheckFilters(0u, entry);
+                     }
+                  }
+                  processedEntries[i]++;
+               }
+               if (std::none_of(lms.begin(), lms.end(), stillRunning))
+                  break;
+            }
+         }
+      } catch (...) {
+         std::cerr << "RDataFrame::Run: event loop was interrupted\n";
+         throw;
+      }
+
+   } while (!ranges.empty() && std::any_of(lms.begin(), lms.end(), stillRunning));
+
+   for (std::size_t i = 0; i < lms.size(); ++i) {
+      auto *lm = lms[i];
+      ROOT::Internal::RDF::RunFinalChecks(*lm->fDataSource, stillRunning(lm));
+
+      if (lm->fEndEntry != std::numeric_limits<Long64_t>::max() &&
+          static_cast<std::uint64_t>(lm->fEndEntry - lm->fBeginEntry) > processedEntries[i]) {
+         std::ostringstream buf{};
+         buf << "RDataFrame stopped processing after ";
+         buf << processedEntries[i];
+         buf << " entries, whereas an entry range (begin=";
+         buf << lm->fBeginEntry;
+         buf << ",end=";
+         buf << lm->fEndEntry;
+         buf << ") was requested. Consider adjusting the end value of the entry range to a maximum of ";
+         buf << (lm->fBeginEntry + processedEntries[i]);
+         buf << ".";
+         Warning("RDataFrame::Run", "%s", buf.str().c_str());
+      }
+   }
+
+   s.Stop();
+   for (auto *lm : lms)
+      lm->fNRuns++;
+   R__LOG_INFO(RDFLogChannel()) << "Finished shared scan over " << lms.size() << " computation graphs (" << s.CpuTime()
+                                << "s CPU, " << s.RealTime() << "s elapsed).";
+}
+
 /// Run event loop over data accessed through a DataSource, in parallel.
 void RLoopManager::RunDataSourceMT()
 {
@@ -710,6 +880,14 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Return true if the only per-entry work is running the booked actions, i.e. there are no named filters, sample
+/// callbacks or every-N-events callbacks that RunAndCheckFilters would have to service. In that case the event loops
+/// can take a tight fast path that skips the per-entry bookkeeping.
+bool RLoopManager::OnlyRunsActions() const
+{
+   return fBookedNamedFilters.empty() && fSampleCallbacks.empty() && fCallbacksEveryNEvents.empty();
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
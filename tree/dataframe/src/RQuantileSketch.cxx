@@ -0,0 +1,150 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RQuantileSketch.hxx"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RQuantileSketch::RQuantileSketch(std::size_t compression) : fCompression(compression)
+{
+   if (compression == 0)
+      throw std::invalid_argument("RQuantileSketch: the compression parameter must be positive.");
+   fBuffer.reserve(8 * fCompression);
+}
+
+RQuantileSketch::RQuantileSketch(std::size_t compression, double min, double max, ULong64_t count,
+                                 std::vector<RCentroid> centroids)
+   : fCentroids(std::move(centroids)), fMin(min), fMax(max), fCount(count), fCompression(compression)
+{
+   if (compression == 0)
+      throw std::invalid_argument("RQuantileSketch: the compression parameter must be positive.");
+}
+
+void RQuantileSketch::Add(double value)
+{
+   fBuffer.push_back(value);
+   fMin = std::min(fMin, value);
+   fMax = std::max(fMax, value);
+   ++fCount;
+   if (fBuffer.size() >= 8 * fCompression)
+      Compress();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Aggregate the summary of another sketch into this one.
+/// \param[in] other A sketch built over a disjoint part of the dataset.
+///
+/// The other sketch's centroids and buffered values are appended to this
+/// sketch's and the result is compressed again, so repeated merges do not grow
+/// the memory footprint.
+void RQuantileSketch::Merge(const RQuantileSketch &other)
+{
+   fCentroids.insert(fCentroids.end(), other.fCentroids.begin(), other.fCentroids.end());
+   fBuffer.insert(fBuffer.end(), other.fBuffer.begin(), other.fBuffer.end());
+   fMin = std::min(fMin, other.fMin);
+   fMax = std::max(fMax, other.fMax);
+   fCount += other.fCount;
+   Compress();
+}
+
+void RQuantileSketch::Compress()
+{
+   for (auto value : fBuffer)
+      fCentroids.push_back({value, 1.});
+   fBuffer.clear();
+
+   if (fCentroids.size() <= 1)
+      return;
+
+   std::sort(fCentroids.begin(), fCentroids.end(),
+             [](const RCentroid &a, const RCentroid &b) { return a.fMean < b.fMean; });
+
+   const double total = static_cast<double>(fCount);
+   std::vector<RCentroid> merged;
+   merged.reserve(fCompression + 1);
+   merged.push_back(fCentroids.front());
+   double weightSoFar = 0.;
+   for (std::size_t i = 1; i < fCentroids.size(); ++i) {
+      auto &current = merged.back();
+      const auto &next = fCentroids[i];
+      const double proposed = current.fWeight + next.fWeight;
+      // Bound the weight of a centroid at quantile q by 4*N*q*(1-q)/compression,
+      // so that centroids stay small near the tails and extreme quantiles are
+      // resolved more accurately than central ones.
+      const double q = (weightSoFar + 0.5 * proposed) / total;
+      const double limit = 4. * total * q * (1. - q) / static_cast<double>(fCompression);
+      if (proposed <= limit) {
+         current.fMean += (next.fMean - current.fMean) * next.fWeight / proposed;
+         current.fWeight = proposed;
+      } else {
+         weightSoFar += current.fWeight;
+         merged.push_back(next);
+      }
+   }
+   fCentroids = std::move(merged);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Estimate the value at the requested quantile.
+/// \param[in] quantile The quantile level, in [0, 1].
+/// \return The estimated value, NaN if the sketch is empty.
+///
+/// The estimate interpolates linearly between the means of neighboring
+/// centroids, treating each centroid's mean as the value at the midpoint of
+/// the ranks it covers. Levels 0 and 1 return the exact minimum and maximum.
+double RQuantileSketch::GetQuantile(double quantile)
+{
+   if (quantile < 0. || quantile > 1.)
+      throw std::invalid_argument("RQuantileSketch: quantile levels must be in [0, 1].");
+   if (fCount == 0)
+      return std::numeric_limits<double>::quiet_NaN();
+
+   Compress();
+
+   if (quantile == 0.)
+      return fMin;
+   if (quantile == 1.)
+      return fMax;
+   if (fCentroids.size() == 1)
+      return fCentroids.front().fMean;
+
+   const double rank = quantile * static_cast<double>(fCount);
+   double cumulativeWeight = 0.;
+   double previousCenter = 0.;
+   double previousMean = fMin;
+   for (const auto &centroid : fCentroids) {
+      const double center = cumulativeWeight + 0.5 * centroid.fWeight;
+      if (rank < center) {
+         if (center == previousCenter)
+            return centroid.fMean;
+         const double t = (rank - previousCenter) / (center - previousCenter);
+         return previousMean + t * (centroid.fMean - previousMean);
+      }
+      previousCenter = center;
+      previousMean = centroid.fMean;
+      cumulativeWeight += centroid.fWeight;
+   }
+
+   // The requested rank falls beyond the center of the last centroid.
+   const double end = static_cast<double>(fCount);
+   if (end == previousCenter)
+      return fMax;
+   const double t = (rank - previousCenter) / (end - previousCenter);
+   return previousMean + t * (fMax - previousMean);
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -9,6 +9,8 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <filesystem>
+#include <string>
 
 #include <TFile.h>
 
@@ -340,3 +342,68 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+static int CountDiskCacheFiles()
+{
+   const std::string prefix = "rdf_cache_" + std::to_string(gSystem->GetPid());
+   int n = 0;
+   for (const auto &entry : std::filesystem::directory_iterator(gSystem->TempDirectory()))
+      if (entry.path().filename().string().rfind(prefix, 0) == 0)
+         ++n;
+   return n;
+}
+
+TEST(CacheToDisk, RoundTripTTree)
+{
+   ROOT::RDataFrame tdf(5);
+   int i = 1;
+   auto d = tdf.Define("c0", [&i]() { return i++; }).Define("c1", []() { return 1.; });
+
+   const auto nFilesBefore = CountDiskCacheFiles();
+   auto cached = d.CacheToDisk({"c0", "c1"});
+   // the spill lives in the system temporary directory, registered for removal
+   // at the end of the process
+   EXPECT_EQ(nFilesBefore + 1, CountDiskCacheFiles());
+
+   auto c = cached.Count();
+   auto m = cached.Min<int>("c0");
+   auto v = *cached.Take<int>("c0");
+   auto w = *cached.Take<double>("c1");
+   EXPECT_EQ(5UL, *c);
+   EXPECT_EQ(1, *m);
+   for (auto j : ROOT::TSeqI(5)) {
+      EXPECT_EQ(j + 1, v[j]);
+      EXPECT_DOUBLE_EQ(1., w[j]);
+   }
+}
+
+TEST(CacheToDisk, RoundTripRNTuple)
+{
+   ROOT::RDataFrame tdf(5);
+   int i = 1;
+   auto d = tdf.Define("c0", [&i]() { return i++; }).Define("c1", []() { return 1.; });
+
+   RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   const auto nFilesBefore = CountDiskCacheFiles();
+   auto cached = d.CacheToDisk({"c0", "c1"}, opts);
+   EXPECT_EQ(nFilesBefore + 1, CountDiskCacheFiles());
+
+   auto c = cached.Count();
+   auto v = *cached.Take<int>("c0");
+   auto w = *cached.Take<double>("c1");
+   EXPECT_EQ(5UL, *c);
+   for (auto j : ROOT::TSeqI(5)) {
+      EXPECT_EQ(j + 1, v[j]);
+      EXPECT_DOUBLE_EQ(1., w[j]);
+   }
+}
+
+TEST(CacheToDisk, Regexp)
+{
+   ROOT::RDataFrame tdf(3);
+   auto d = tdf.Define("x", "rdfentry_").Define("y", "2 * rdfentry_");
+   auto cached = d.CacheToDisk("x|y");
+   EXPECT_EQ(3u, cached.Sum("x").GetValue());
+   EXPECT_EQ(6u, cached.Sum("y").GetValue());
+}
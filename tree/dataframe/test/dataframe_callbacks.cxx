@@ -299,6 +299,21 @@ TEST_F(RDFCallbacks, MultipleEventLoops)
    EXPECT_EQ(i, gNEvents);
 }
 
+TEST_F(RDFCallbacks, Histo1DMerged)
+{
+   // Histo1D<double> + OnPartialResultMerged: with one slot it behaves like OnPartialResult
+   auto h = tdf.Histo1D<double>({"", "", 128, -2., 2.}, "x");
+   using value_t = typename decltype(h)::Value_t;
+   ULong64_t i = 0ull;
+   ULong64_t everyN = 1ull;
+   h.OnPartialResultMerged(everyN, [&i, &everyN](value_t &h_) {
+      i += everyN;
+      EXPECT_EQ(h_.GetEntries(), i);
+   });
+   *h;
+   EXPECT_EQ(gNEvents, i);
+}
+
 class FunctorClass {
    unsigned int &i_;
 
@@ -384,6 +399,24 @@ TEST_F(RDFCallbacksMT, Histo1DWithFillHelper)
    EXPECT_EQ(gNEvents, std::accumulate(is.begin(), is.end(), 0ull));
 }
 
+TEST_F(RDFCallbacksMT, Histo1DMerged)
+{
+   // Histo1D<double> + OnPartialResultMerged: the snapshot merges the partial results of all slots
+   auto h = tdf.Histo1D<double>({"", "", 128, -2., 2.}, "x");
+   using value_t = typename decltype(h)::Value_t;
+   ULong64_t lastEntries = 0ull;
+   h.OnPartialResultMerged(1ull, [&lastEntries](value_t &h_) {
+      // other slots keep filling while we merge, so we can only check that the merged entry count never decreases
+      // and never exceeds the dataset size
+      const auto entries = static_cast<ULong64_t>(h_.GetEntries());
+      EXPECT_GE(entries, lastEntries);
+      EXPECT_LE(entries, gNEvents);
+      lastEntries = entries;
+   });
+   *h;
+   EXPECT_GT(lastEntries, 0ull);
+}
+
 TEST(RDFCallbacksMTMore, LessTasksThanWorkers)
 {
    ROOT::EnableImplicitMT(4);
@@ -113,6 +113,68 @@ TEST(RDataFrameMergeResults, MergeHisto1DModel)
    EXPECT_DOUBLE_EQ(mh.GetMean(), 49.5);
 }
 
+TEST(RDataFrameMergeResults, SerializeScalarMergeables)
+{
+   ROOT::RDataFrame df{10};
+   auto col = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   auto count = GetMergeableValue(col.Count());
+   auto mean = GetMergeableValue(col.Mean<double>("x"));
+   auto stddev = GetMergeableValue(col.StdDev<double>("x"));
+   auto sum = GetMergeableValue(col.Sum<double>("x"));
+   auto min = GetMergeableValue(col.Min<double>("x"));
+   auto max = GetMergeableValue(col.Max<double>("x"));
+
+   // round-trip through the compact wire format and check the merged results are unaffected
+   std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<ULong64_t>> count2 =
+      ROOT::Detail::RDF::RMergeableCount::Deserialize(count->Serialize());
+   auto mergedCount = MergeValues(std::move(count), std::move(count2));
+   EXPECT_EQ(mergedCount->GetValue(), 20ull);
+
+   std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<Double_t>> mean2 =
+      ROOT::Detail::RDF::RMergeableMean::Deserialize(mean->Serialize());
+   auto mergedMean = MergeValues(std::move(mean), std::move(mean2));
+   EXPECT_DOUBLE_EQ(mergedMean->GetValue(), 4.5);
+
+   auto stddev2 = ROOT::Detail::RDF::RMergeableStdDev::Deserialize(stddev->Serialize());
+   auto sum2 = ROOT::Detail::RDF::RMergeableSum<double>::Deserialize(sum->Serialize());
+   auto min2 = ROOT::Detail::RDF::RMergeableMin<double>::Deserialize(min->Serialize());
+   auto max2 = ROOT::Detail::RDF::RMergeableMax<double>::Deserialize(max->Serialize());
+   EXPECT_DOUBLE_EQ(sum2->GetValue(), 45.);
+   EXPECT_DOUBLE_EQ(min2->GetValue(), 0.);
+   EXPECT_DOUBLE_EQ(max2->GetValue(), 9.);
+   EXPECT_DOUBLE_EQ(stddev2->GetValue(),
+                    GetMergeableValue(col.StdDev<double>("x"))->GetValue());
+
+   // deserializing as the wrong mergeable type must be detected
+   EXPECT_THROW(ROOT::Detail::RDF::RMergeableCount::Deserialize(sum2->Serialize()), std::runtime_error);
+}
+
+TEST(RDataFrameMergeResults, SerializeMergeableFill)
+{
+   ROOT::RDataFrame df{100};
+   auto col = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto hist = col.Histo1D<double>({"name", "title", 100, 0, 100}, "x");
+
+   auto mh1 = GetMergeableValue(hist);
+   auto mh2 = GetMergeableValue(hist);
+
+   const auto buf = mh2->Serialize();
+   // the payload is bin contents, sumw2, stats and entry count: much smaller than a streamed TH1D
+   const TH1D model("name", "title", 100, 0, 100);
+   std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<TH1D>> mh3 =
+      ROOT::Detail::RDF::RMergeableFill<TH1D>::Deserialize(buf, model);
+
+   auto mergedptr = MergeValues(std::move(mh1), std::move(mh3));
+   const auto &mh = mergedptr->GetValue();
+   EXPECT_EQ(mh.GetEntries(), 200);
+   EXPECT_DOUBLE_EQ(mh.GetMean(), 49.5);
+
+   // a model with different binning must be rejected
+   const TH1D wrongModel("name", "title", 10, 0, 100);
+   EXPECT_THROW(ROOT::Detail::RDF::RMergeableFill<TH1D>::Deserialize(buf, wrongModel), std::runtime_error);
+}
+
 TEST(RDataFrameMergeResults, MergeHisto2D)
 {
    ROOT::RDataFrame df{100};
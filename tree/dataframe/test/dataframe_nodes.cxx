@@ -45,6 +45,20 @@ TEST(RDataFrameNodes, RSlotStackPutBackTooMany)
    EXPECT_THROW(theTest(), std::logic_error);
 }
 
+// A thread that returns a slot and asks for a new one should get the same slot back
+// (while uncontended), so per-slot state stays warm in its caches.
+TEST(RDataFrameNodes, RSlotStackSticky)
+{
+   ROOT::Internal::RSlotStack s(4);
+   const auto slot = s.GetSlot();
+   s.ReturnSlot(slot);
+   for (int i = 0; i < 3; ++i) {
+      const auto again = s.GetSlot();
+      EXPECT_EQ(slot, again);
+      s.ReturnSlot(again);
+   }
+}
+
 // Run with 16 threads with 8 slots, and ensure that slot numbers
 // are always unique.
 TEST(RDataFrameNodes, RSlotStackUnique)
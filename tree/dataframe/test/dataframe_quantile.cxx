@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RResultPtr.hxx>          // GetMergeableValue
+#include <ROOT/RDF/RMergeableValue.hxx> // MergeValues
+
+#include <gtest/gtest.h>
+
+using ROOT::Detail::RDF::GetMergeableValue;
+using ROOT::Detail::RDF::MergeValues;
+
+TEST(RDataFrameQuantile, ApproximateQuantiles)
+{
+   ROOT::RDataFrame df{10000};
+   auto col = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   auto quantiles = col.Quantile<double>("x", {0., 0.5, 0.99, 1.});
+   ASSERT_EQ(4u, quantiles->size());
+
+   // Levels 0 and 1 are the exact extrema
+   EXPECT_DOUBLE_EQ(0., quantiles->at(0));
+   EXPECT_DOUBLE_EQ(9999., quantiles->at(3));
+   // The other levels are approximate, with per-cent accuracy at the default compression
+   EXPECT_NEAR(4999.5, quantiles->at(1), 50.);
+   EXPECT_NEAR(9900., quantiles->at(2), 50.);
+}
+
+TEST(RDataFrameQuantile, JittedColumnType)
+{
+   ROOT::RDataFrame df{1000};
+   auto col = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   auto quantiles = col.Quantile("x", {0.5});
+   EXPECT_NEAR(499.5, quantiles->at(0), 10.);
+}
+
+TEST(RDataFrameQuantile, InvalidLevels)
+{
+   ROOT::RDataFrame df{10};
+   EXPECT_THROW(df.Quantile<ULong64_t>("rdfentry_", {}), std::runtime_error);
+   EXPECT_THROW(df.Quantile<ULong64_t>("rdfentry_", {1.5}), std::runtime_error);
+}
+
+TEST(RDataFrameQuantile, MergeQuantiles)
+{
+   ROOT::RDataFrame df{10000};
+   auto col = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   auto quantiles = col.Quantile<double>("x", {0.5});
+
+   auto mq1 = GetMergeableValue(quantiles);
+   auto mq2 = GetMergeableValue(quantiles);
+
+   // Merging a result with itself doubles the weights but must not move the quantiles
+   auto mergedptr = MergeValues(std::move(mq1), std::move(mq2));
+   const auto &mq = mergedptr->GetValue();
+   ASSERT_EQ(1u, mq.size());
+   EXPECT_NEAR(quantiles->at(0), mq[0], 50.);
+
+   // The compact wire format round-trips the full sketch
+   const auto buf = mergedptr->Serialize();
+   auto deserialized = ROOT::Detail::RDF::RMergeableQuantile::Deserialize(buf);
+   ASSERT_EQ(1u, deserialized->GetValue().size());
+   EXPECT_DOUBLE_EQ(mq[0], deserialized->GetValue()[0]);
+}
+
+TEST(RDataFrameSample, ReservoirSample)
+{
+   ROOT::RDataFrame df{10000};
+   auto col = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   auto sample = col.ReservoirSample<double>("x", 100);
+   ASSERT_EQ(100u, sample->size());
+   for (auto value : *sample) {
+      EXPECT_GE(value, 0.);
+      EXPECT_LT(value, 10000.);
+   }
+
+   // No duplicates: reservoir sampling draws without replacement
+   auto sorted = *sample;
+   std::sort(sorted.begin(), sorted.end());
+   EXPECT_EQ(sorted.end(), std::adjacent_find(sorted.begin(), sorted.end()));
+}
+
+TEST(RDataFrameSample, SmallDataset)
+{
+   ROOT::RDataFrame df{10};
+
+   // With fewer entries than the sample size, all values are kept
+   auto sample = df.ReservoirSample<ULong64_t>("rdfentry_", 100);
+   auto sorted = *sample;
+   std::sort(sorted.begin(), sorted.end());
+   ASSERT_EQ(10u, sorted.size());
+   for (ULong64_t i = 0; i < 10; ++i)
+      EXPECT_EQ(i, sorted[i]);
+
+   EXPECT_THROW(df.ReservoirSample<ULong64_t>("rdfentry_", 0), std::runtime_error);
+}
+
+TEST(RDataFrameSample, MergeSamples)
+{
+   ROOT::RDataFrame df{1000};
+
+   auto sample = df.ReservoirSample<ULong64_t>("rdfentry_", 50);
+
+   auto ms1 = GetMergeableValue(sample);
+   auto ms2 = GetMergeableValue(sample);
+
+   auto mergedptr = MergeValues(std::move(ms1), std::move(ms2));
+   const auto &ms = mergedptr->GetValue();
+   ASSERT_EQ(50u, ms.size());
+   for (auto value : ms)
+      EXPECT_LT(value, 1000u);
+
+   // The compact wire format round-trips the sample and its metadata
+   const auto buf = mergedptr->Serialize();
+   auto deserialized = ROOT::Detail::RDF::RMergeableReservoirSample<ULong64_t>::Deserialize(buf);
+   EXPECT_EQ(ms, deserialized->GetValue());
+}
@@ -469,6 +469,24 @@ TEST_P(RDFSimpleTests, CArraysFromTree)
    EXPECT_EQ(20, h_jit->GetEntries());
 }
 
+TEST_P(RDFSimpleTests, Histo1DBulkFillFromRVec)
+{
+   // one-dimensional histograms are filled in bulk via TH1::FillN when the column is an RVec
+   auto df = RDataFrame(10)
+                .Define("xs", [] { return ROOT::RVecF{1.f, 2.f, 3.f}; })
+                .Define("ws", [] { return ROOT::RVecD{1., 2., 3.}; });
+   auto h = df.Histo1D<ROOT::RVecF>({"h", "h", 4, 0., 4.}, "xs");
+   auto hw = df.Histo1D<ROOT::RVecF, ROOT::RVecD>({"hw", "hw", 4, 0., 4.}, "xs", "ws");
+   EXPECT_EQ(30, h->GetEntries());
+   EXPECT_DOUBLE_EQ(10., h->GetBinContent(2));
+   EXPECT_DOUBLE_EQ(10., h->GetBinContent(3));
+   EXPECT_DOUBLE_EQ(10., h->GetBinContent(4));
+   EXPECT_EQ(30, hw->GetEntries());
+   EXPECT_DOUBLE_EQ(10., hw->GetBinContent(2));
+   EXPECT_DOUBLE_EQ(20., hw->GetBinContent(3));
+   EXPECT_DOUBLE_EQ(30., hw->GetBinContent(4));
+}
+
 TEST_P(RDFSimpleTests, TakeCarrays)
 {
    auto treeName = "t";
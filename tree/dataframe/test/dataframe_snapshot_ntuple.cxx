@@ -15,6 +15,8 @@
 
 #include <TFile.h>
 
+#include <algorithm>
+
 using ROOT::RNTupleModel;
 using ROOT::RNTupleReader;
 using ROOT::RNTupleWriter;
@@ -572,23 +574,35 @@ struct TIMTEnabler {
    ~TIMTEnabler() { ROOT::DisableImplicitMT(); }
 };
 
-TEST(RDFSnapshotRNTuple, ThrowIfMT)
+TEST(RDFSnapshotRNTuple, FromScratchMT)
 {
    TIMTEnabler _(4);
 
-   FileRAII fileGuard{"RDFSnapshotRNTuple_throw_if_mt.root"};
+   FileRAII fileGuard{"RDFSnapshotRNTuple_from_scratch_mt.root"};
 
-   auto df = ROOT::RDataFrame(25ull).Define("x", [] { return 10; });
+   auto df = ROOT::RDataFrame(25ull).DefineSlotEntry("entry", [](unsigned int, ULong64_t entry) { return entry; });
 
    RSnapshotOptions opts;
    opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
 
-   try {
-      auto sdf = df.Snapshot("ntuple", fileGuard.GetPath(), {"x"}, opts);
-      *sdf;
-      FAIL() << "MT snapshotting to RNTuple is not supported yet";
-   } catch (const std::runtime_error &err) {
-      EXPECT_STREQ(err.what(), "Snapshot: Snapshotting to RNTuple with IMT enabled is not supported yet.");
+   auto sdf = df.Snapshot("ntuple", fileGuard.GetPath(), {"entry"}, opts);
+
+   // Verify we actually snapshotted to an RNTuple. Entries are written in parallel, so their order is not
+   // guaranteed; check that every input entry arrived exactly once.
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(25ull, ntuple->GetNEntries());
+
+   std::vector<ULong64_t> entries;
+   auto entryView = ntuple->GetView<ULong64_t>("entry");
+   for (const auto i : ntuple->GetEntryRange()) {
+      entries.push_back(entryView(i));
    }
+   std::sort(entries.begin(), entries.end());
+   for (ULong64_t i = 0; i < 25; i++) {
+      EXPECT_EQ(i, entries[i]);
+   }
+
+   // The snapshotted dataset must be usable for further processing
+   EXPECT_EQ(25, *sdf->Count());
 }
 #endif // R__USE_IMT
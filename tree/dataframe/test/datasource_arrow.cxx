@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <iostream>
 using namespace arrow;
 
@@ -263,6 +264,29 @@ TEST(RArrowDS, FromARDFWithJitting)
    EXPECT_EQ(40, *min);
 }
 
+TEST(RArrowDS, ArrowIPCRoundTrip)
+{
+   const auto fname = "datasource_arrow_ipc_roundtrip.arrow";
+
+   auto df = ROOT::RDF::FromArrow(createTestTable(), {});
+   ROOT::RDF::ToArrowIPC(df, fname);
+
+   auto df2 = ROOT::RDF::FromArrowIPC(fname);
+   auto c = df2.Count();
+   auto maxHeight = df2.Max<double>("Height");
+   auto names = df2.Take<std::string>("Name");
+   auto married = df2.Take<bool>("Married");
+
+   EXPECT_EQ(6U, *c);
+   EXPECT_DOUBLE_EQ(200.5, *maxHeight);
+   EXPECT_STREQ("Harry", names->at(0).c_str());
+   EXPECT_STREQ("\"Joe\"", names->at(2).c_str());
+   EXPECT_TRUE(married->at(0));
+   EXPECT_FALSE(married->at(2));
+
+   std::remove(fname);
+}
+
 // NOW MT!-------------
 #ifdef R__USE_IMT
 
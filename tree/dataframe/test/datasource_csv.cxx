@@ -201,6 +201,34 @@ TEST(RCsvDS, ProgressiveReadingEntryRanges)
    EXPECT_EQ(2U, numIterations); // we should have processed 2 chunks
 }
 
+TEST(RCsvDS, PrefetchEntryRanges)
+{
+   // Same as ProgressiveReadingEntryRanges, but with the next chunk read in the background
+   auto chunkSize = 3LL;
+   RCsvDS tds(fileNameHeaders, true, ',', chunkSize);
+   tds.SetNSlots(1U);
+   auto val = tds.GetColumnReaders(0U, "Name", typeid(std::string));
+   tds.Initialize();
+
+   std::vector<std::string> names = {"Harry", "Bob,Bob", "\"Joe\"", "Tom", " John  ", " Mary Ann "};
+   auto ranges = tds.GetEntryRanges();
+   auto numIterations = 0U;
+   while (!ranges.empty()) {
+      tds.PrefetchEntryRanges();
+      for (auto &&range : ranges) {
+         tds.InitSlot(0U, range.first);
+         for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
+            tds.SetEntry(0U, i);
+            EXPECT_EQ(names[i], *val->TryGet<std::string>(i));
+         }
+      }
+      ranges = tds.GetEntryRanges();
+      numIterations++;
+   }
+
+   EXPECT_EQ(2U, numIterations); // we should have processed 2 chunks
+}
+
 TEST(RCsvDS, ProgressiveReadingRDF)
 {
    // Even chunks
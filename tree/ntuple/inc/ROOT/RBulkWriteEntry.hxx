@@ -0,0 +1,224 @@
+/// \file ROOT/RBulkWriteEntry.hxx
+/// \ingroup NTuple
+/// \date 2026-08-28
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBulkWriteEntry
+#define ROOT_RBulkWriteEntry
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RFieldToken.hxx>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+
+class RNTupleModel;
+
+namespace Experimental {
+
+class RNTupleFillContext;
+
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RBulkWriteEntry
+\ingroup NTuple
+\brief Serializes batches of events laid out as consecutive user structs, avoiding per-entry indirection
+
+The struct layout is bound once: SetStride() fixes the distance between two consecutive events and
+BindFieldOffset() records, per field, the byte offset of the corresponding struct member (validated against the
+field type).  RNTupleFillContext::FillBulk() then ingests N events in one call.  Members of fields that map
+as-is to a single column are gathered into a contiguous scratch buffer and appended column-wise; all other
+members are serialized in place, without copying them into entry-managed values first.
+
+~~~ {.cpp}
+struct Event {
+   float pt;
+   std::vector<float> hits;
+};
+auto entry = writer->CreateBulkWriteEntry();
+entry->SetStride(sizeof(Event));
+entry->BindFieldOffset<float>("pt", offsetof(Event, pt));
+entry->BindFieldOffset<std::vector<float>>("hits", offsetof(Event, hits));
+
+std::vector<Event> events = NextBatch();
+writer->FillBulk(*entry, events.data(), events.size());
+~~~
+
+This class is meant for compiled converters and frameworks with a stable event struct.  All other users are
+encouraged to use the API provided by REntry, with safe interfaces, type checks, and shared object ownership.
+*/
+// clang-format on
+class RBulkWriteEntry {
+   friend class ROOT::RNTupleModel;
+   friend class ROOT::Experimental::RNTupleFillContext;
+
+private:
+   static constexpr std::size_t kUnsetOffset = std::size_t(-1);
+
+   /// The entry must be linked to a specific model, identified by a model ID
+   std::uint64_t fModelId = 0;
+   /// The entry and its tokens are also linked to a specific schema, identified by a schema ID
+   std::uint64_t fSchemaId = 0;
+   /// Corresponds to the fields of the linked model
+   std::vector<ROOT::RFieldBase *> fFields;
+   /// The byte offsets of the struct members corresponding to the fields
+   std::vector<std::size_t> fOffsets;
+   /// To validate BindFieldOffset(), a copy of all field types
+   std::vector<std::string> fFieldTypes;
+   /// For fast lookup of token IDs given a (sub)field name present in the entry
+   std::unordered_map<std::string, std::size_t> fFieldName2Token;
+   /// The distance in bytes between two consecutive events, i.e. the size of the user struct
+   std::size_t fStride = 0;
+   /// Number of fields with a valid offset; AppendBulk() requires all fields to be bound
+   std::size_t fNBoundFields = 0;
+   /// Gathers strided struct members of mappable fields into a contiguous block for column-wise appends
+   std::vector<unsigned char> fScratch;
+
+   explicit RBulkWriteEntry(std::uint64_t modelId, std::uint64_t schemaId) : fModelId(modelId), fSchemaId(schemaId) {}
+
+   void AddField(ROOT::RFieldBase &field)
+   {
+      fFieldName2Token[field.GetQualifiedFieldName()] = fFields.size();
+      fFields.emplace_back(&field);
+      fOffsets.emplace_back(kUnsetOffset);
+      fFieldTypes.push_back(field.GetTypeName());
+   }
+
+   std::size_t AppendBulk(const void *from, std::size_t count)
+   {
+      if (R__unlikely(fNBoundFields != fFields.size()))
+         throw RException(R__FAIL("invalid attempt to bulk fill with unbound fields, "
+                                  "make sure to call BindFieldOffset() for every field of the model."));
+      if (R__unlikely(fStride == 0))
+         throw RException(R__FAIL("invalid attempt to bulk fill without a struct layout, call SetStride() first."));
+
+      std::size_t bytesWritten = 0;
+      const auto *base = static_cast<const unsigned char *>(from);
+      for (std::size_t f = 0; f < fFields.size(); f++) {
+         auto &field = *fFields[f];
+         const auto *src = base + fOffsets[f];
+         auto *principalColumn = field.fPrincipalColumn;
+         if ((field.GetTraits() & ROOT::RFieldBase::kTraitMappable) && principalColumn) {
+            const std::size_t elemSize = principalColumn->GetElement()->GetSize();
+            fScratch.resize(count * elemSize);
+            for (std::size_t i = 0; i < count; i++)
+               std::memcpy(fScratch.data() + i * elemSize, src + i * fStride, elemSize);
+            principalColumn->AppendV(fScratch.data(), count);
+            bytesWritten += count * principalColumn->GetElement()->GetPackedSize();
+         } else {
+            for (std::size_t i = 0; i < count; i++)
+               bytesWritten += field.Append(src + i * fStride);
+         }
+      }
+      return bytesWritten;
+   }
+
+   void EnsureMatchingModel(RFieldToken token) const
+   {
+      if (fSchemaId != token.fSchemaId) {
+         throw RException(R__FAIL("invalid token for this entry, "
+                                  "make sure to use a token from a model with the same schema as this entry."));
+      }
+   }
+
+   /// This function has linear complexity, only use it for more helpful error messages!
+   const std::string &FindFieldName(RFieldToken token) const
+   {
+      for (const auto &[fieldName, index] : fFieldName2Token) {
+         if (index == token.fIndex) {
+            return fieldName;
+         }
+      }
+      // Should never happen, but avoid compiler warning about "returning reference to local temporary object".
+      static const std::string empty = "";
+      return empty;
+   }
+
+   template <typename T>
+   void EnsureMatchingType(RFieldToken token [[maybe_unused]]) const
+   {
+      if constexpr (!std::is_void_v<T>) {
+         if (fFieldTypes[token.fIndex] != ROOT::RField<T>::TypeName()) {
+            throw RException(R__FAIL("type mismatch for field " + FindFieldName(token) + ": " +
+                                     fFieldTypes[token.fIndex] + " vs. " + ROOT::RField<T>::TypeName()));
+         }
+      }
+   }
+
+public:
+   RBulkWriteEntry(const RBulkWriteEntry &other) = delete;
+   RBulkWriteEntry &operator=(const RBulkWriteEntry &other) = delete;
+   RBulkWriteEntry(RBulkWriteEntry &&other) = default;
+   RBulkWriteEntry &operator=(RBulkWriteEntry &&other) = default;
+   ~RBulkWriteEntry() = default;
+
+   /// The ordinal of the (sub)field fieldName; can be used in other methods to address the corresponding value
+   RFieldToken GetToken(std::string_view fieldName) const
+   {
+      auto it = fFieldName2Token.find(std::string(fieldName));
+      if (it == fFieldName2Token.end()) {
+         throw RException(R__FAIL("invalid field name: " + std::string(fieldName)));
+      }
+      return RFieldToken(it->second, fSchemaId);
+   }
+
+   /// Set the distance in bytes between two consecutive events, i.e. `sizeof` of the user struct
+   void SetStride(std::size_t stride)
+   {
+      if (stride == 0) {
+         throw RException(R__FAIL("invalid stride of zero bytes"));
+      }
+      fStride = stride;
+   }
+
+   /// Record the byte offset of the struct member backing the field referenced by `token`.
+   ///
+   /// **Note**: if `T = void`, type checks are disabled.  It is the caller's responsibility to match the field and
+   /// member types.
+   template <typename T>
+   void BindFieldOffset(RFieldToken token, std::size_t offset)
+   {
+      EnsureMatchingModel(token);
+      EnsureMatchingType<T>(token);
+      if (fOffsets[token.fIndex] == kUnsetOffset)
+         fNBoundFields++;
+      fOffsets[token.fIndex] = offset;
+   }
+
+   /// Record the byte offset of the struct member backing the field referenced by its name.
+   ///
+   /// \sa BindFieldOffset(RFieldToken, std::size_t)
+   template <typename T>
+   void BindFieldOffset(std::string_view fieldName, std::size_t offset)
+   {
+      BindFieldOffset<T>(GetToken(fieldName), offset);
+   }
+
+   std::uint64_t GetModelId() const { return fModelId; }
+   std::uint64_t GetSchemaId() const { return fSchemaId; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
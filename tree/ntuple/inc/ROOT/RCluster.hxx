@@ -192,6 +192,9 @@ public:
    const ColumnSet_t &GetAvailPhysicalColumns() const { return fAvailPhysicalColumns; }
    bool ContainsColumn(ROOT::DescriptorId_t colId) const { return fAvailPhysicalColumns.count(colId) > 0; }
    size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   /// Returns the sum of the sizes of the registered on-disk pages; used for the memory accounting of cached
+   /// clusters. Note that pages of the shared zero-page buffer are counted like regular pages.
+   size_t GetSizeOfOnDiskPages() const;
 }; // class RCluster
 
 } // namespace Internal
@@ -19,6 +19,7 @@
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -91,6 +92,17 @@ private:
    /// The cache of clusters around the currently active cluster
    std::vector<std::unique_ptr<RCluster>> fPool;
 
+   /// Process-wide sum of the compressed page bytes currently cached by all cluster pools
+   static std::atomic<std::size_t> fgGlobalNBytes;
+   /// Process-wide budget for the bytes cached by all cluster pools; zero means unlimited
+   static std::atomic<std::size_t> fgGlobalMemoryBudget;
+   /// The number of bytes of this pool currently accounted for in fgGlobalNBytes; only accessed by the
+   /// thread calling GetCluster()
+   std::size_t fNBytesAccounted = 0;
+
+   /// Recomputes the size of the cached clusters of this pool and adjusts the process-wide accounting
+   void UpdateMemoryAccounting();
+
    /// Protects the shared state between the main thread and the I/O thread, namely the work queue and the in-flight
    /// clusters vector
    std::mutex fLockWorkQueue;
@@ -138,6 +150,15 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   /// Sets a process-wide budget (in bytes) shared by all cluster pools, e.g. of the page sources opened by
+   /// chain and friend processing.  While the aggregated size of the cached clusters exceeds the budget,
+   /// pools suspend speculative read-ahead and only load clusters that are immediately required.
+   /// Zero (the default) means unlimited.
+   static void SetGlobalMemoryBudget(std::size_t nBytes) { fgGlobalMemoryBudget = nBytes; }
+   static std::size_t GetGlobalMemoryBudget() { return fgGlobalMemoryBudget; }
+   /// Returns the sum of the compressed page bytes currently cached by all cluster pools of the process
+   static std::size_t GetGlobalNBytesCached() { return fgGlobalNBytes; }
 }; // class RClusterPool
 
 } // namespace Internal
@@ -22,6 +22,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <memory>
 #include <utility>
@@ -54,6 +55,13 @@ private:
    ROOT::Internal::RPage fWritePage;
    /// The initial number of elements in a page
    ROOT::NTupleSize_t fInitialNElements = 1;
+   /// Per-column limit for the write page size, initialized from RNTupleWriteOptions::fMaxUnzippedPageSize and
+   /// retuned by UpdateCompressionStats() if adaptive page sizes are enabled
+   std::size_t fMaxUnzippedPageSize = 0;
+   /// Sum of the unzipped sizes of the pages committed so far, for adaptive page sizing
+   std::size_t fNBytesCommittedUnzipped = 0;
+   /// Sum of the on-storage sizes of the pages committed so far, for adaptive page sizing
+   std::size_t fNBytesCommittedZipped = 0;
    /// The number of elements written resp. available in the column
    ROOT::NTupleSize_t fNElements = 0;
    /// The currently mapped page for reading
@@ -79,12 +87,12 @@ private:
    void HandleWritePageIfFull()
    {
       auto newMaxElements = fWritePage.GetMaxElements() * 2;
-      if (newMaxElements * fElement->GetSize() > fPageSink->GetWriteOptions().GetMaxUnzippedPageSize()) {
-         newMaxElements = fPageSink->GetWriteOptions().GetMaxUnzippedPageSize() / fElement->GetSize();
+      if (newMaxElements * fElement->GetSize() > fMaxUnzippedPageSize) {
+         newMaxElements = std::max<ROOT::NTupleSize_t>(fMaxUnzippedPageSize / fElement->GetSize(), fInitialNElements);
       }
 
-      if (newMaxElements == fWritePage.GetMaxElements()) {
-         // Maximum page size reached, flush and reset
+      if (newMaxElements <= fWritePage.GetMaxElements()) {
+         // Maximum page size reached (or lowered by adaptive page sizing), flush and reset
          Flush();
       } else {
          auto expandedPage = fPageSink->ReservePage(fHandleSink, newMaxElements);
@@ -157,6 +165,34 @@ public:
       }
    }
 
+   /// Records the unzipped and on-storage size of a committed page and, once a meaningful amount of data has been
+   /// seen, retunes the column's maximum write page size: the new limit is the unzipped size whose pages are
+   /// expected to compress to RNTupleWriteOptions::fApproxZippedPageSize, clamped between the initial and the
+   /// maximum page size of the write options.  Called by page sinks if adaptive page sizes are enabled.
+   /// Returns true if the limit changed.
+   bool UpdateCompressionStats(std::size_t nBytesUnzipped, std::size_t nBytesZipped)
+   {
+      static constexpr std::size_t kMinCommittedForRetuning = 1024 * 1024;
+
+      fNBytesCommittedUnzipped += nBytesUnzipped;
+      fNBytesCommittedZipped += nBytesZipped;
+      if (fNBytesCommittedZipped == 0 || fNBytesCommittedUnzipped < kMinCommittedForRetuning)
+         return false;
+
+      const auto &options = fPageSink->GetWriteOptions();
+      const auto compressionFactor =
+         static_cast<double>(fNBytesCommittedUnzipped) / static_cast<double>(fNBytesCommittedZipped);
+      auto target = static_cast<std::size_t>(compressionFactor * options.GetApproxZippedPageSize());
+      target = std::clamp(target, options.GetInitialUnzippedPageSize(), options.GetMaxUnzippedPageSize());
+      if (target == fMaxUnzippedPageSize)
+         return false;
+      fMaxUnzippedPageSize = target;
+      return true;
+   }
+
+   /// The current limit for the unzipped size of the write page (see UpdateCompressionStats())
+   std::size_t GetMaxUnzippedPageSize() const { return fMaxUnzippedPageSize; }
+
    void Read(const ROOT::NTupleSize_t globalIndex, void *to)
    {
       if (!fReadPageRef.Get().Contains(globalIndex)) {
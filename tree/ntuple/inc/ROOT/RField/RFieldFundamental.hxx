@@ -434,6 +434,13 @@ public:
    /// This is mutually exclusive with SetTruncated() and SetQuantized() and supersedes them if called after them.
    void SetHalfPrecision() { SetColumnRepresentatives({{ROOT::ENTupleColumnType::kReal16}}); }
 
+   /// Sets this field to use a brain-float (bfloat16) representation, occupying 16 bits on disk
+   /// (1 sign bit, 8 exponent bits, 7 mantissa bits). Compared to SetHalfPrecision(), this keeps the
+   /// full exponent range of a single-precision float at the cost of mantissa precision, so it suits
+   /// quantities spanning many orders of magnitude.
+   /// This is mutually exclusive with SetTruncated() and SetQuantized() and supersedes them if called after them.
+   void SetBFloat16() { SetColumnRepresentatives({{ROOT::ENTupleColumnType::kBFloat16}}); }
+
    /// Set the on-disk representation of this field to a single-precision float truncated to `nBits`.
    /// The remaining (32 - `nBits`) bits will be truncated from the number's mantissa.
    /// `nBits` must be $10 <= nBits <= 31$ (this means that at least 1 bit
@@ -40,6 +40,7 @@ class RFieldVisitor;
 namespace Experimental {
 
 namespace Detail {
+class RBulkWriteEntry;
 class RRawPtrWriteEntry;
 } // namespace Detail
 
@@ -80,6 +81,7 @@ This is and can only be partially enforced through C++.
 // clang-format on
 class RFieldBase {
    friend class ROOT::RClassField;                             // to mark members as artificial
+   friend class ROOT::Experimental::Detail::RBulkWriteEntry;   // to call Append() and to access the principal column
    friend class ROOT::Experimental::Detail::RRawPtrWriteEntry; // to call Append()
    friend struct ROOT::Internal::RFieldCallbackInjector;       // used for unit tests
    friend struct ROOT::Internal::RFieldRepresentationModifier; // used for unit tests
@@ -857,6 +859,11 @@ public:
 
    /// Overload to read all elements in the given cluster range.
    void *ReadBulk(ROOT::RNTupleLocalRange range) { return ReadBulk(*range.begin(), nullptr, range.size()); }
+
+   /// Overload that takes the global index of the first value to read. Since bulks have to come from the same
+   /// cluster, the requested range is clamped to the cluster that contains `firstIndex`: on return, `size` is set
+   /// to the number of values in the returned array, which may be smaller than the requested number.
+   void *ReadBulk(ROOT::NTupleSize_t firstIndex, const bool *maskReq, std::size_t &size);
 };
 
 namespace Internal {
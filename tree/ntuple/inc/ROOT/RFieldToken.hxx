@@ -24,6 +24,7 @@ class RNTupleModel;
 
 namespace Experimental {
 namespace Detail {
+class RBulkWriteEntry;
 class RRawPtrWriteEntry;
 } // namespace Detail
 } // namespace Experimental
@@ -40,6 +41,7 @@ It can be used for fast indexing in REntry's methods, e.g. REntry::BindValue().
 class RFieldToken {
    friend class REntry;
    friend class RNTupleModel;
+   friend class Experimental::Detail::RBulkWriteEntry;
    friend class Experimental::Detail::RRawPtrWriteEntry;
 
    std::size_t fIndex = 0;                      ///< The index of the field (top-level or registered subfield)
@@ -59,6 +59,10 @@ class RFieldDescriptorBuilder;
 class RNTupleDescriptorBuilder;
 
 RNTupleDescriptor CloneDescriptorSchema(const RNTupleDescriptor &desc);
+
+/// Returns a shared, immutable copy of the given string. Repeated calls with equal strings return the same copy,
+/// so that, e.g., the many identical type names in large schemas are stored only once per process.
+std::shared_ptr<const std::string> InternString(const std::string &s);
 } // namespace Internal
 
 // clang-format off
@@ -82,10 +86,10 @@ private:
    std::string fFieldName;
    /// Free text set by the user
    std::string fFieldDescription;
-   /// The C++ type that was used when writing the field
-   std::string fTypeName;
-   /// A typedef or using directive that resolved to the type name during field creation
-   std::string fTypeAlias;
+   /// The C++ type that was used when writing the field; interned because many fields usually share the same type name
+   std::shared_ptr<const std::string> fTypeName = Internal::InternString("");
+   /// A typedef or using directive that resolved to the type name during field creation; interned like the type name
+   std::shared_ptr<const std::string> fTypeAlias = Internal::InternString("");
    /// The number of elements per entry for fixed-size arrays
    std::uint64_t fNRepetitions = 0;
    /// The structural information carried by this field in the data model tree
@@ -128,8 +132,8 @@ public:
    std::uint32_t GetTypeVersion() const { return fTypeVersion; }
    const std::string &GetFieldName() const { return fFieldName; }
    const std::string &GetFieldDescription() const { return fFieldDescription; }
-   const std::string &GetTypeName() const { return fTypeName; }
-   const std::string &GetTypeAlias() const { return fTypeAlias; }
+   const std::string &GetTypeName() const { return *fTypeName; }
+   const std::string &GetTypeAlias() const { return *fTypeAlias; }
    std::uint64_t GetNRepetitions() const { return fNRepetitions; }
    ROOT::ENTupleStructure GetStructure() const { return fStructure; }
    ROOT::DescriptorId_t GetParentId() const { return fParentId; }
@@ -1328,12 +1332,12 @@ public:
    }
    RFieldDescriptorBuilder &TypeName(const std::string &typeName)
    {
-      fField.fTypeName = typeName;
+      fField.fTypeName = InternString(typeName);
       return *this;
    }
    RFieldDescriptorBuilder &TypeAlias(const std::string &typeAlias)
    {
-      fField.fTypeAlias = typeAlias;
+      fField.fTypeAlias = InternString(typeAlias);
       return *this;
    }
    RFieldDescriptorBuilder &NRepetitions(std::uint64_t nRepetitions)
@@ -20,6 +20,7 @@
 #include <ROOT/REntry.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RBulkWriteEntry.hxx>
 #include <ROOT/RRawPtrWriteEntry.hxx>
 #include <ROOT/RNTupleFillStatus.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
@@ -138,6 +139,41 @@ public:
    /// \return The number of uncompressed bytes written.
    std::size_t Fill(Detail::RRawPtrWriteEntry &entry) { return FillImpl(entry); }
 
+   /// Fill `count` events laid out as consecutive structs starting at `from` through an RBulkWriteEntry, but don't
+   /// commit the cluster. The calling code must pass an RNTupleFillStatus and check
+   /// RNTupleFillStatus::ShouldFlushCluster; note that the cluster size is only checked once per batch.
+   ///
+   /// This method will check the entry's model ID to ensure it comes from the context's own model or throw an
+   /// exception otherwise.
+   void FillBulkNoFlush(Detail::RBulkWriteEntry &entry, const void *from, std::size_t count,
+                        ROOT::RNTupleFillStatus &status)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      const std::size_t bytesWritten = entry.AppendBulk(from, count);
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries += count;
+
+      status.fNEntriesSinceLastFlush = fNEntries - fLastFlushed;
+      status.fUnzippedClusterSize = fUnzippedClusterSize;
+      status.fLastEntrySize = count ? (bytesWritten / count) : 0;
+      status.fShouldFlushCluster =
+         (fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst);
+   }
+   /// Fill `count` events laid out as consecutive structs starting at `from` through an RBulkWriteEntry.
+   /// \return The number of uncompressed bytes written.
+   std::size_t FillBulk(Detail::RBulkWriteEntry &entry, const void *from, std::size_t count)
+   {
+      const std::size_t sizeBefore = fUnzippedClusterSize;
+      ROOT::RNTupleFillStatus status;
+      FillBulkNoFlush(entry, from, count, status);
+      const std::size_t bytesWritten = status.GetUnzippedClusterSize() - sizeBefore;
+      if (status.ShouldFlushCluster())
+         FlushCluster();
+      return bytesWritten;
+   }
+
    /// Flush column data, preparing for CommitCluster or to reduce memory usage. This will trigger compression of pages,
    /// but not actually write to storage.
    void FlushColumns();
@@ -152,6 +188,7 @@ public:
    {
       return fModel->CreateRawPtrWriteEntry();
    }
+   std::unique_ptr<Detail::RBulkWriteEntry> CreateBulkWriteEntry() const { return fModel->CreateBulkWriteEntry(); }
 
    /// Return the entry number that was last flushed in a cluster.
    ROOT::NTupleSize_t GetLastFlushed() const { return fLastFlushed; }
@@ -18,6 +18,7 @@
 
 #include <ROOT/RField.hxx>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -140,6 +141,37 @@ private:
       std::unordered_map<RCombinedJoinFieldValue, std::vector<ROOT::NTupleSize_t>, RCombinedJoinFieldValueHash>
          fMapping;
 
+      /// Bloom filter over the join field value hashes in fMapping, probed in GetEntryIndexes before the map lookup.
+      /// For sparse joins, where most probes miss, this avoids the cache-miss-bound hash map lookup in the vast
+      /// majority of cases. Sized to kBloomBitsPerKey bits per distinct key, rounded up to a power of two words.
+      std::vector<std::uint64_t> fBloomFilter;
+      /// Bit mask to map a Bloom filter probe to a bit position; the filter size in bits is fBloomBitMask + 1
+      std::uint64_t fBloomBitMask = 0;
+
+      static constexpr std::size_t kBloomBitsPerKey = 10;
+      static constexpr std::size_t kBloomNProbes = 3;
+
+      /// Returns the bit positions probed for a given key hash, following the double-hashing scheme.
+      void BloomInsert(std::size_t hash)
+      {
+         const std::uint64_t h2 = (hash >> 33) | 1;
+         for (std::size_t i = 0; i < kBloomNProbes; ++i) {
+            const std::uint64_t bit = (hash + i * h2) & fBloomBitMask;
+            fBloomFilter[bit >> 6] |= std::uint64_t(1) << (bit & 63);
+         }
+      }
+
+      bool BloomMayContain(std::size_t hash) const
+      {
+         const std::uint64_t h2 = (hash >> 33) | 1;
+         for (std::size_t i = 0; i < kBloomNProbes; ++i) {
+            const std::uint64_t bit = (hash + i * h2) & fBloomBitMask;
+            if ((fBloomFilter[bit >> 6] & (std::uint64_t(1) << (bit & 63))) == 0)
+               return false;
+         }
+         return true;
+      }
+
       /// Names of the join fields used for the mapping to their respective entry indexes.
       std::vector<std::string> fJoinFieldNames;
 
@@ -37,6 +37,7 @@ class RNTupleWriter;
 
 namespace Experimental {
 namespace Detail {
+class RBulkWriteEntry;
 class RRawPtrWriteEntry;
 } // namespace Detail
 } // namespace Experimental
@@ -344,6 +345,7 @@ public:
    /// BindRawPtr() to set memory addresses before serializing / deserializing the entry.
    std::unique_ptr<REntry> CreateBareEntry() const;
    std::unique_ptr<Experimental::Detail::RRawPtrWriteEntry> CreateRawPtrWriteEntry() const;
+   std::unique_ptr<Experimental::Detail::RBulkWriteEntry> CreateBulkWriteEntry() const;
    /// Creates a token to be used in REntry methods to address a field present in the entry
    ROOT::RFieldToken GetToken(std::string_view fieldName) const;
    /// Calls the given field's CreateBulk() method. Throws an RException if no field with the given name exists.
@@ -63,6 +63,18 @@ This is useful, e.g., in the context of RDataFrame where the threads are fully m
 </td>
 </tr>
 
+<tr>
+<td>`ClusterPipelineDepth`</td>
+<td>`unsigned int`</td>
+<td>1</td>
+<td>
+The number of clusters requested in a single prefetch batch. Clusters arriving ahead of need are
+decompressed in the background (if a task scheduler is available, see `UseImplicitMT`), so a depth
+larger than one overlaps read and decompression of upcoming clusters with the processing of the
+current one, at the cost of a larger prefetcher memory footprint.
+</td>
+</tr>
+
 <tr>
 <td>`EnableMetrics`</td>
 <td>`bool`</td>
@@ -72,6 +84,19 @@ If `true`, the RNTupleReader will track metrics straight from its construction,
 if calling RNTupleReader::EnableMetrics() before having created the object.
 </td>
 </tr>
+
+<tr>
+<td>`EnableLazyClusterMetadata`</td>
+<td>`bool`</td>
+<td>`false`</td>
+<td>
+If `true`, attaching to an RNTuple deserializes only the header and footer; the page list envelopes of the
+cluster groups are read and deserialized on demand when reading first touches the corresponding entries.
+This reduces the time and memory needed to open RNTuples with many clusters and columns. Note that as long as
+not all cluster groups are materialized, the attached descriptor reports fewer clusters than are on storage and
+cluster prefetching does not look ahead across the boundary of the last materialized cluster group.
+</td>
+</tr>
 </table>
 */
 // clang-format on
@@ -92,21 +117,29 @@ public:
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
-   /// The number of cluster to be prefetched in a single batch; this option is transitional and will be replaced
-   /// by an option that allows to control the amount of memory that the prefetcher uses.
+   /// The number of clusters to be prefetched (and, if possible, decompressed in the background) in a single batch;
+   /// eventually this option may be replaced by one that controls the amount of memory that the prefetcher uses.
    unsigned int fClusterBunchSize = 1;
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
    bool fEnableMetrics = false;
+   bool fEnableLazyClusterMetadata = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
 
+   unsigned int GetClusterPipelineDepth() const { return fClusterBunchSize; }
+   /// Values smaller than one are clamped to one, which corresponds to plain prefetching without pipelining.
+   void SetClusterPipelineDepth(unsigned int val) { fClusterBunchSize = (val > 0) ? val : 1; }
+
    EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
    void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
 
    bool GetEnableMetrics() const { return fEnableMetrics; }
    void SetEnableMetrics(bool val) { fEnableMetrics = val; }
+
+   bool GetEnableLazyClusterMetadata() const { return fEnableLazyClusterMetadata; }
+   void SetEnableLazyClusterMetadata(bool val) { fEnableLazyClusterMetadata = val; }
 }; // class RNTupleReadOptions
 
 namespace Internal {
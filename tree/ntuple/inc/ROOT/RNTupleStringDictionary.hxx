@@ -0,0 +1,126 @@
+/// \file ROOT/RNTupleStringDictionary.hxx
+/// \ingroup NTuple
+/// \date 2026-08-29
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RNTupleStringDictionary
+#define ROOT_RNTupleStringDictionary
+
+#include <ROOT/RField.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RNTupleStringDictionary
+\ingroup NTuple
+\brief Dictionary-encodes a string field of an RNTuple so analyses can work on integer codes.
+
+Categorical string fields (sample and category labels, trigger line names, ...) typically take few
+distinct values that repeat millions of times. The dictionary maps each distinct value to a dense
+integer code in first-appearance order and stores one code per entry. Group-by style analyses can
+then compare and hash the codes instead of the strings, and a cut on a label becomes an integer
+comparison against LookupCode().
+*/
+// clang-format on
+class RNTupleStringDictionary {
+public:
+   using Code_t = std::uint32_t;
+   static constexpr Code_t kInvalidCode = Code_t(-1);
+
+private:
+   /// Name of the string field that is dictionary-encoded.
+   std::string fFieldName;
+
+   /// The distinct field values, indexed by their code.
+   std::vector<std::string> fValues;
+
+   /// Maps a field value to its code; the inverse of fValues.
+   std::unordered_map<std::string, Code_t> fCodes;
+
+   /// One code per entry, in entry order across all added page sources.
+   std::vector<Code_t> fEntryCodes;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Create a new RNTupleStringDictionary for the given field.
+   ///
+   /// \param[in] fieldName The name of the string field to dictionary-encode.
+   RNTupleStringDictionary(std::string_view fieldName) : fFieldName(fieldName) {}
+
+public:
+   RNTupleStringDictionary(const RNTupleStringDictionary &other) = delete;
+   RNTupleStringDictionary &operator=(const RNTupleStringDictionary &other) = delete;
+   RNTupleStringDictionary(RNTupleStringDictionary &&other) = delete;
+   RNTupleStringDictionary &operator=(RNTupleStringDictionary &&other) = delete;
+   ~RNTupleStringDictionary() = default;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Create an RNTupleStringDictionary for the given field.
+   ///
+   /// \param[in] fieldName The name of the string field to dictionary-encode.
+   ///
+   /// \return A pointer to the newly-created dictionary.
+   static std::unique_ptr<RNTupleStringDictionary> Create(std::string_view fieldName);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Dictionary-encode the field values of the RNTuple represented by the provided page source.
+   ///
+   /// Codes are assigned in first-appearance order and are shared across all added page sources, so the
+   /// same value maps to the same code in a chain of RNTuples.
+   ///
+   /// \param[in] pageSource The page source of the RNTuple whose entries to encode.
+   ///
+   /// \return A reference to the updated dictionary.
+   RNTupleStringDictionary &Add(ROOT::Internal::RPageSource &pageSource);
+
+   /// Returns the number of distinct field values seen so far.
+   std::size_t GetNValues() const { return fValues.size(); }
+
+   /// Returns the codes of all encoded entries, in entry order.
+   const std::vector<Code_t> &GetEntryCodes() const { return fEntryCodes; }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Get the code of the given entry.
+   ///
+   /// \param[in] entryIdx The index of the entry, relative to the first added page source.
+   ///
+   /// \return The code of the entry's field value.
+   Code_t GetCode(ROOT::NTupleSize_t entryIdx) const { return fEntryCodes.at(entryIdx); }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Get the field value corresponding to the given code.
+   ///
+   /// \param[in] code A code previously returned by GetCode() or LookupCode().
+   ///
+   /// \return The decoded field value.
+   const std::string &GetValue(Code_t code) const { return fValues.at(code); }
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Get the code of the given field value, if it occurs in the encoded entries.
+   ///
+   /// \param[in] value The field value to look up.
+   ///
+   /// \return The code of the value, or kInvalidCode if the value does not occur.
+   Code_t LookupCode(const std::string &value) const;
+};
+} // namespace Internal
+} // namespace Experimental
+} // namespace ROOT
+
+#endif // ROOT_RNTupleStringDictionary
@@ -102,6 +102,7 @@ enum class ENTupleColumnType {
    kSplitUInt16,
    kReal32Trunc,
    kReal32Quant,
+   kBFloat16,
    kMax,
 };
 
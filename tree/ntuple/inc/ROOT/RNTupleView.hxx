@@ -20,8 +20,11 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <string_view>
 
+#include <cstddef>
 #include <iterator>
 #include <memory>
+#include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
 #include <unordered_map>
@@ -164,6 +167,10 @@ class RNTupleView : public RNTupleViewBase<T> {
    friend class ROOT::RNTupleReader;
    friend class RNTupleCollectionView;
 
+private:
+   /// Lazily created by GetBulk(); owns the array of values that the returned spans point to.
+   std::optional<ROOT::RFieldBase::RBulkValues> fBulk;
+
 protected:
    RNTupleView(std::unique_ptr<ROOT::RFieldBase> field, ROOT::RNTupleGlobalRange range)
       : RNTupleViewBase<T>(std::move(field), range)
@@ -201,6 +208,41 @@ public:
       RNTupleViewBase<T>::fValue.Read(localIndex);
       return RNTupleViewBase<T>::fValue.template GetRef<T>();
    }
+
+   /// Reads up to `count` consecutive values starting at `globalIndex` and returns them as a contiguous span,
+   /// avoiding the per-entry call overhead of operator(). Bulks cannot cross cluster boundaries, so the returned
+   /// span may hold fewer than `count` values; callers should advance by the size of the returned span.
+   /// The span remains valid until the next GetBulk() call or until the view is destroyed.
+   ///
+   /// **Example: sum a float field in bulks**
+   /// ~~~ {.cpp}
+   /// auto view = reader->GetView<float>("pt");
+   /// const auto nEntries = view.GetFieldRange().size();
+   /// double sum = 0;
+   /// for (ROOT::NTupleSize_t i = 0; i < nEntries;) {
+   ///    auto bulk = view.GetBulk(i, nEntries - i);
+   ///    for (float x : bulk)
+   ///       sum += x;
+   ///    i += bulk.size();
+   /// }
+   /// ~~~
+   std::span<const T> GetBulk(ROOT::NTupleSize_t globalIndex, std::size_t count)
+   {
+      if (!fBulk)
+         fBulk = RNTupleViewBase<T>::fField->CreateBulk();
+      auto *values = fBulk->ReadBulk(globalIndex, nullptr, count);
+      return std::span<const T>(static_cast<const T *>(values), count);
+   }
+
+   /// Reads all values in the given cluster range and returns them as a contiguous span.
+   /// \see GetBulk(ROOT::NTupleSize_t, std::size_t)
+   std::span<const T> GetBulk(ROOT::RNTupleLocalRange range)
+   {
+      if (!fBulk)
+         fBulk = RNTupleViewBase<T>::fField->CreateBulk();
+      auto *values = fBulk->ReadBulk(range);
+      return std::span<const T>(static_cast<const T *>(values), range.size());
+   }
 };
 
 // clang-format off
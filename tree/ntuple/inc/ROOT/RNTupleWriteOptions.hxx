@@ -98,6 +98,29 @@ Pages can grow only to the given limit in bytes.
 </td>
 </tr>
 
+<tr>
+<td>`ApproxZippedPageSize`</td>
+<td>`std::size_t`</td>
+<td>64 KiB</td>
+<td>
+Target size of a page after compression; only used if `EnableAdaptivePageSizes` is set.
+</td>
+</tr>
+
+<tr>
+<td>`EnableAdaptivePageSizes`</td>
+<td>`bool`</td>
+<td>`false`</td>
+<td>
+If enabled, every column tracks the compression ratio of its committed pages and retunes its maximum unzipped
+page size to the value whose pages are expected to compress to `ApproxZippedPageSize`, clamped between
+`InitialUnzippedPageSize` and `MaxUnzippedPageSize`. Well-compressing columns thus get larger in-memory pages
+while incompressible columns stop growing early, which concentrates the page buffer budget where compression
+benefits from it. The number of retuning decisions is reported through the sink's RNTupleMetrics
+(`nAdaptivePageSizeUpdates`).
+</td>
+</tr>
+
 <tr>
 <td>`PageBufferBudget`</td>
 <td>`std::size_t`</td>
@@ -142,6 +165,18 @@ performance (with Direct I/O) at a reasonable memory consumption.
 </td>
 </tr>
 
+<tr>
+<td>`UseBackgroundClusterFlush`</td>
+<td>`bool`</td>
+<td>`false`</td>
+<td>
+If set, committing a cluster hands the compressed pages to a background thread that performs the actual
+write, so that the next cluster can be filled (and compressed) while the previous one is in flight.
+Useful for streaming use cases where the storage endpoint is slow or remote. Only has an effect if
+buffered writing is turned on. Note that write errors of a cluster surface only at the next flush point.
+</td>
+</tr>
+
 <tr>
 <td>`UseImplicitMT`</td>
 <td>EImplicitMT</td>
@@ -193,9 +228,12 @@ protected:
    std::size_t fMaxUnzippedClusterSize = 10 * fApproxZippedClusterSize;
    std::size_t fInitialUnzippedPageSize = 256;
    std::size_t fMaxUnzippedPageSize = 1024 * 1024;
+   std::size_t fApproxZippedPageSize = 64 * 1024;
+   bool fEnableAdaptivePageSizes = false;
    std::size_t fPageBufferBudget = 0;
    bool fUseBufferedWrite = true;
    bool fUseDirectIO = false;
+   bool fUseBackgroundClusterFlush = false;
    std::size_t fWriteBufferSize = 4 * 1024 * 1024;
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
    bool fEnablePageChecksums = true;
@@ -228,6 +266,12 @@ public:
    std::size_t GetMaxUnzippedPageSize() const { return fMaxUnzippedPageSize; }
    void SetMaxUnzippedPageSize(std::size_t val);
 
+   std::size_t GetApproxZippedPageSize() const { return fApproxZippedPageSize; }
+   void SetApproxZippedPageSize(std::size_t val);
+
+   bool GetEnableAdaptivePageSizes() const { return fEnableAdaptivePageSizes; }
+   void SetEnableAdaptivePageSizes(bool val) { fEnableAdaptivePageSizes = val; }
+
    std::size_t GetPageBufferBudget() const;
    void SetPageBufferBudget(std::size_t val) { fPageBufferBudget = val; }
 
@@ -237,6 +281,9 @@ public:
    bool GetUseDirectIO() const { return fUseDirectIO; }
    void SetUseDirectIO(bool val) { fUseDirectIO = val; }
 
+   bool GetUseBackgroundClusterFlush() const { return fUseBackgroundClusterFlush; }
+   void SetUseBackgroundClusterFlush(bool val) { fUseBackgroundClusterFlush = val; }
+
    std::size_t GetWriteBufferSize() const { return fWriteBufferSize; }
    void SetWriteBufferSize(std::size_t val) { fWriteBufferSize = val; }
 
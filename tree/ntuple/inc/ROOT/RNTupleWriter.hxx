@@ -23,6 +23,7 @@
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RBulkWriteEntry.hxx>
 #include <ROOT/RRawPtrWriteEntry.hxx>
 
 #include <cstddef>
@@ -180,6 +181,21 @@ public:
       fFillContext.FillNoFlush(entry, status);
    }
 
+   /// Fill `count` events laid out as consecutive structs starting at `from` through an RBulkWriteEntry.  This method
+   /// will check the entry's model ID to ensure it comes from the writer's own model or throw an exception otherwise.
+   /// \return The number of uncompressed bytes written.
+   std::size_t FillBulk(Experimental::Detail::RBulkWriteEntry &entry, const void *from, std::size_t count)
+   {
+      return fFillContext.FillBulk(entry, from, count);
+   }
+   /// Fill `count` events through an RBulkWriteEntry, but don't commit the cluster. The calling code must pass an
+   /// RNTupleFillStatus and check RNTupleFillStatus::ShouldFlushCluster.
+   void FillBulkNoFlush(Experimental::Detail::RBulkWriteEntry &entry, const void *from, std::size_t count,
+                        RNTupleFillStatus &status)
+   {
+      fFillContext.FillBulkNoFlush(entry, from, count, status);
+   }
+
    /// Flush column data, preparing for CommitCluster or to reduce memory usage. This will trigger compression of pages,
    /// but not actually write to storage (unless buffered writing is turned off).
    void FlushColumns() { fFillContext.FlushColumns(); }
@@ -202,6 +218,10 @@ public:
    {
       return fFillContext.CreateRawPtrWriteEntry();
    }
+   std::unique_ptr<Experimental::Detail::RBulkWriteEntry> CreateBulkWriteEntry() const
+   {
+      return fFillContext.CreateBulkWriteEntry();
+   }
 
    /// Return the entry number that was last flushed in a cluster.
    ROOT::NTupleSize_t GetLastFlushed() const { return fFillContext.GetLastFlushed(); }
@@ -0,0 +1,118 @@
+/// \file ROOT/RNTupleZoneMap.hxx
+/// \ingroup NTuple
+/// \date 2026-08-29
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RNTupleZoneMap
+#define ROOT_RNTupleZoneMap
+
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTupleRange.hxx>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RNTupleZoneMap
+\ingroup NTuple
+\brief Builds per-cluster min/max statistics (zone maps) on numeric fields of an RNTuple for data skipping.
+
+Selective analyses often read clusters only to reject all their entries. A zone map records, for each
+cluster, the minimum and maximum value of the selected fields. A simple range cut can then be evaluated
+against the zone boundaries first, and clusters whose value range cannot satisfy the cut are skipped
+without loading their pages, e.g. by iterating only the entry ranges returned by GetCandidateRanges().
+*/
+// clang-format on
+class RNTupleZoneMap {
+public:
+   //////////////////////////////////////////////////////////////////////////
+   /// Value statistics of one field in one cluster.
+   struct RZoneStats {
+      ROOT::NTupleSize_t fFirstEntry = 0;
+      ROOT::NTupleSize_t fNEntries = 0;
+      double fMin = std::numeric_limits<double>::max();
+      double fMax = std::numeric_limits<double>::lowest();
+   };
+
+private:
+   /// Names of the numeric fields for which zone statistics are collected.
+   std::vector<std::string> fFieldNames;
+
+   /// Per-field zone statistics, one entry per cluster in entry order across all added page sources.
+   std::unordered_map<std::string, std::vector<RZoneStats>> fZones;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Create a new RNTupleZoneMap for the given fields.
+   ///
+   /// \param[in] fieldNames The names of the fields to collect zone statistics for. Only fields of integral or
+   /// floating-point type are allowed.
+   RNTupleZoneMap(const std::vector<std::string> &fieldNames) : fFieldNames(fieldNames) {}
+
+public:
+   RNTupleZoneMap(const RNTupleZoneMap &other) = delete;
+   RNTupleZoneMap &operator=(const RNTupleZoneMap &other) = delete;
+   RNTupleZoneMap(RNTupleZoneMap &&other) = delete;
+   RNTupleZoneMap &operator=(RNTupleZoneMap &&other) = delete;
+   ~RNTupleZoneMap() = default;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Create an RNTupleZoneMap for the given fields.
+   ///
+   /// \param[in] fieldNames The names of the fields to collect zone statistics for. Only fields of integral or
+   /// floating-point type are allowed.
+   ///
+   /// \return A pointer to the newly-created zone map.
+   static std::unique_ptr<RNTupleZoneMap> Create(const std::vector<std::string> &fieldNames);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Collect the zone statistics of the RNTuple represented by the provided page source.
+   ///
+   /// \param[in] pageSource The page source of the RNTuple to collect zone statistics for.
+   /// \param[in] entryOffset Offset to add to the entry ranges of the collected zones. This can be used when the
+   /// RNTuple represented by the provided page source is part of a chain of RNTuples.
+   ///
+   /// \return A reference to the updated zone map.
+   RNTupleZoneMap &Add(ROOT::Internal::RPageSource &pageSource, ROOT::NTupleSize_t entryOffset = 0);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Get the zone statistics collected for the given field.
+   ///
+   /// \param[in] fieldName The name of the field.
+   ///
+   /// \return The zone statistics of the field, one entry per cluster in entry order.
+   const std::vector<RZoneStats> &GetZones(const std::string &fieldName) const;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Get the entry ranges whose zones may contain values in `[min, max]`.
+   ///
+   /// \param[in] fieldName The name of the field the cut is applied to.
+   /// \param[in] min The lower bound of the cut (inclusive).
+   /// \param[in] max The upper bound of the cut (inclusive).
+   ///
+   /// \return The entry ranges of the clusters whose value range overlaps `[min, max]`, with adjacent ranges
+   /// merged. Entries outside the returned ranges cannot satisfy the cut and their pages need not be loaded;
+   /// entries inside the ranges still need to be checked against the cut.
+   std::vector<ROOT::RNTupleGlobalRange>
+   GetCandidateRanges(const std::string &fieldName, double min, double max) const;
+};
+} // namespace Internal
+} // namespace Experimental
+} // namespace ROOT
+
+#endif // ROOT_RNTupleZoneMap
@@ -21,9 +21,11 @@
 
 #include <deque>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -81,6 +83,17 @@ private:
          return fSealedPages.emplace_back();
       }
 
+      /// Hands over the buffered pages and their sealed counterparts, e.g. to a background flush task.
+      /// The column handle is kept so that the column buffer can be reused for the next cluster.
+      std::pair<std::deque<RPageZipItem>, RPageStorage::SealedPageSequence_t> MoveOutBufferedPages()
+      {
+         // Moving a deque preserves iterators, so the RSealedPage elements keep referring to valid buffers.
+         auto result = std::make_pair(std::move(fBufferedPages), std::move(fSealedPages));
+         fBufferedPages.clear();
+         fSealedPages.clear();
+         return result;
+      }
+
    private:
       RPageStorage::ColumnHandle_t fCol;
       /// Using a deque guarantees that element iterators are never invalidated
@@ -97,6 +110,7 @@ private:
    /// I/O performance counters that get registered in fMetrics
    struct RCounters {
       ROOT::Experimental::Detail::RNTuplePlainCounter &fParallelZip;
+      ROOT::Experimental::Detail::RNTuplePlainCounter &fNAdaptivePageSizeUpdates;
       ROOT::Experimental::Detail::RNTupleAtomicCounter &fTimeWallZip;
       ROOT::Experimental::Detail::RNTuplePlainCounter &fTimeWallCriticalSection;
       ROOT::Experimental::Detail::RNTupleTickCounter<ROOT::Experimental::Detail::RNTupleAtomicCounter> &fTimeCpuZip;
@@ -115,9 +129,17 @@ private:
    std::vector<ColumnHandle_t> fSuppressedColumns;
    ROOT::DescriptorId_t fNFields = 0;
    ROOT::DescriptorId_t fNColumns = 0;
+   /// Set if `UseBackgroundClusterFlush` is enabled: the cluster that is currently being written to the inner sink
+   /// by a background thread. All other interactions with the inner sink first wait for the flush to finish.
+   std::future<void> fPendingFlush;
 
    void ConnectFields(const std::vector<ROOT::RFieldBase *> &fields, ROOT::NTupleSize_t firstEntry);
    void FlushClusterImpl(std::function<void(void)> FlushClusterFn);
+   /// If adaptive page sizes are enabled, feed the sealed sizes of the buffered pages back to their columns;
+   /// called on the main thread after all sealing tasks have finished.
+   void UpdateAdaptivePageSizes();
+   /// Blocks until a possibly in-flight background cluster flush has finished; rethrows its errors, if any.
+   void WaitForPendingFlush();
 
 public:
    explicit RPageSinkBuf(std::unique_ptr<RPageSink> inner);
@@ -461,6 +461,7 @@ protected:
    /// Default I/O performance counters that get registered in fMetrics
    struct RCounters {
       ROOT::Experimental::Detail::RNTupleAtomicCounter &fNPageCommitted;
+      ROOT::Experimental::Detail::RNTupleAtomicCounter &fNAdaptivePageSizeUpdates;
       ROOT::Experimental::Detail::RNTupleAtomicCounter &fSzWritePayload;
       ROOT::Experimental::Detail::RNTupleAtomicCounter &fSzZip;
       ROOT::Experimental::Detail::RNTupleAtomicCounter &fTimeWallWrite;
@@ -616,6 +617,14 @@ private:
 
    /// Remembers the last cluster id from which a page was requested
    ROOT::DescriptorId_t fLastUsedCluster = ROOT::kInvalidDescriptorId;
+   /// The deserialize mode passed to `Attach()`; reused when page lists are deserialized on demand
+   ROOT::Internal::RNTupleSerializer::EDescriptorDeserializeMode fDeserializeMode =
+      ROOT::Internal::RNTupleSerializer::EDescriptorDeserializeMode::kForReading;
+
+   /// If cluster metadata is loaded lazily (see RNTupleReadOptions::SetEnableLazyClusterMetadata()), deserializes the
+   /// page list of the first cluster group, in entry order, whose cluster details are not yet materialized.
+   /// Returns false if all cluster groups are materialized (or if lazy cluster metadata is disabled).
+   bool TryMaterializeNextClusterGroup();
    /// Clusters from where pages got preloaded in UnzipClusterImpl(), ordered by first entry number
    /// of the clusters. If the last used cluster changes in LoadPage(), all unused pages from
    /// previous clusters are evicted from the page pool.
@@ -701,6 +710,11 @@ protected:
    virtual void LoadStructureImpl() = 0;
    /// `LoadStructureImpl()` has been called before `AttachImpl()` is called
    virtual ROOT::RNTupleDescriptor AttachImpl(ROOT::Internal::RNTupleSerializer::EDescriptorDeserializeMode mode) = 0;
+   /// Reads and deserializes the page list of the given cluster group into `desc`. Only called for cluster groups
+   /// without materialized cluster details, i.e. when cluster metadata is loaded lazily
+   /// (see RNTupleReadOptions::SetEnableLazyClusterMetadata()). Called with the exclusive descriptor lock held.
+   virtual void LoadPageListImpl(ROOT::RNTupleDescriptor &desc, const ROOT::RClusterGroupDescriptor &cgDesc,
+                                 ROOT::Internal::RNTupleSerializer::EDescriptorDeserializeMode mode);
    /// Returns a new, unattached page source for the same data set
    virtual std::unique_ptr<RPageSource> CloneImpl() const = 0;
    // Only called if a task scheduler is set. No-op be default.
@@ -152,6 +152,8 @@ private:
 protected:
    void LoadStructureImpl() final;
    ROOT::RNTupleDescriptor AttachImpl(RNTupleSerializer::EDescriptorDeserializeMode mode) final;
+   void LoadPageListImpl(ROOT::RNTupleDescriptor &desc, const ROOT::RClusterGroupDescriptor &cgDesc,
+                         RNTupleSerializer::EDescriptorDeserializeMode mode) final;
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
    std::unique_ptr<RPageSource> CloneImpl() const final;
 
@@ -63,3 +63,11 @@ void ROOT::Internal::RCluster::SetColumnAvailable(ROOT::DescriptorId_t physicalC
 {
    fAvailPhysicalColumns.insert(physicalColumnId);
 }
+
+size_t ROOT::Internal::RCluster::GetSizeOfOnDiskPages() const
+{
+   size_t nbytes = 0;
+   for (const auto &[_, page] : fOnDiskPages)
+      nbytes += page.GetSize();
+   return nbytes;
+}
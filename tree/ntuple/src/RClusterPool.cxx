@@ -30,6 +30,9 @@
 #include <set>
 #include <utility>
 
+std::atomic<std::size_t> ROOT::Internal::RClusterPool::fgGlobalNBytes = 0;
+std::atomic<std::size_t> ROOT::Internal::RClusterPool::fgGlobalMemoryBudget = 0;
+
 bool ROOT::Internal::RClusterPool::RInFlightCluster::operator<(const RInFlightCluster &other) const
 {
    if (fClusterKey.fClusterId == other.fClusterKey.fClusterId) {
@@ -66,6 +69,18 @@ ROOT::Internal::RClusterPool::~RClusterPool()
       fCvHasReadWork.notify_one();
    }
    fThreadIo.join();
+   fgGlobalNBytes -= fNBytesAccounted;
+}
+
+void ROOT::Internal::RClusterPool::UpdateMemoryAccounting()
+{
+   std::size_t nbytes = 0;
+   for (const auto &cptr : fPool) {
+      if (cptr)
+         nbytes += cptr->GetSizeOfOnDiskPages();
+   }
+   fgGlobalNBytes += nbytes - fNBytesAccounted;
+   fNBytesAccounted = nbytes;
 }
 
 void ROOT::Internal::RClusterPool::ExecReadClusters()
@@ -174,6 +189,18 @@ public:
       }
    }
 
+   /// Drops all clusters that are not immediately required; used when the process-wide memory budget
+   /// of the cluster pools is exhausted and speculative read-ahead has to be suspended.
+   void DropNonRequired()
+   {
+      for (auto itr = fMap.begin(); itr != fMap.end();) {
+         if ((itr->second.fFlags & kFlagRequired) == 0)
+            itr = fMap.erase(itr);
+         else
+            ++itr;
+      }
+   }
+
    decltype(fMap)::iterator begin() { return fMap.begin(); }
    decltype(fMap)::iterator end() { return fMap.end(); }
 };
@@ -233,6 +260,12 @@ ROOT::Internal::RClusterPool::GetCluster(ROOT::DescriptorId_t clusterId, const R
          continue;
       cptr.reset();
    }
+   UpdateMemoryAccounting();
+
+   // If the cluster pools of the process collectively exceed their memory budget, do not read ahead but load
+   // only what is needed right now.
+   if (const auto budget = fgGlobalMemoryBudget.load(); (budget > 0) && (fgGlobalNBytes.load() >= budget))
+      provide.DropNonRequired();
 
    // Move clusters that meanwhile arrived into cache pool
    {
@@ -322,6 +355,7 @@ ROOT::Internal::RClusterPool::GetCluster(ROOT::DescriptorId_t clusterId, const R
       }
    } // work queue lock guard
 
+   UpdateMemoryAccounting();
    return WaitFor(clusterId, physicalColumns);
 }
 
@@ -373,6 +407,7 @@ ROOT::Internal::RClusterPool::WaitFor(ROOT::DescriptorId_t clusterId, const RClu
          auto idxFreeSlot = FindFreeSlot();
          fPool[idxFreeSlot] = std::move(cptr);
       }
+      UpdateMemoryAccounting();
 
       std::lock_guard<std::mutex> lockGuardInFlightClusters(fLockWorkQueue);
       fInFlightClusters.erase(itr);
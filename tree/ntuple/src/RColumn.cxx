@@ -46,6 +46,7 @@ void ROOT::Internal::RColumn::ConnectPageSink(ROOT::DescriptorId_t fieldId, RPag
    }
 
    fPageSink = &pageSink;
+   fMaxUnzippedPageSize = pageSink.GetWriteOptions().GetMaxUnzippedPageSize();
    fFirstElementIndex = firstElementIndex;
    fHandleSink = fPageSink->AddColumn(fieldId, *this);
    fOnDiskId = fPageSink->GetColumnId(fHandleSink);
@@ -58,6 +58,7 @@ std::pair<std::uint16_t, std::uint16_t> ROOT::Internal::RColumnElementBase::GetV
    case ENTupleColumnType::kSplitUInt16: return std::make_pair(16, 16);
    case ENTupleColumnType::kReal32Trunc: return std::make_pair(10, 31);
    case ENTupleColumnType::kReal32Quant: return std::make_pair(1, 32);
+   case ENTupleColumnType::kBFloat16: return std::make_pair(16, 16);
    default:
       if (type == kTestFutureColumnType)
          return std::make_pair(32, 32);
@@ -99,6 +100,7 @@ const char *ROOT::Internal::RColumnElementBase::GetColumnTypeName(ENTupleColumnT
    case ENTupleColumnType::kSplitUInt16: return "SplitUInt16";
    case ENTupleColumnType::kReal32Trunc: return "Real32Trunc";
    case ENTupleColumnType::kReal32Quant: return "Real32Quant";
+   case ENTupleColumnType::kBFloat16: return "BFloat16";
    default:
       if (type == kTestFutureColumnType)
          return "TestFutureType";
@@ -142,6 +144,7 @@ ROOT::Internal::RColumnElementBase::Generate<void>(ENTupleColumnType onDiskType)
    case ENTupleColumnType::kSplitUInt16: return std::make_unique<RColumnElement<std::uint16_t, ENTupleColumnType::kSplitUInt16>>();
    case ENTupleColumnType::kReal32Trunc: return std::make_unique<RColumnElement<float, ENTupleColumnType::kReal32Trunc>>();
    case ENTupleColumnType::kReal32Quant: return std::make_unique<RColumnElement<float, ENTupleColumnType::kReal32Quant>>();
+   case ENTupleColumnType::kBFloat16: return std::make_unique<RColumnElement<float, ENTupleColumnType::kBFloat16>>();
    default:
       if (onDiskType == kTestFutureColumnType)
          return std::make_unique<RColumnElement<Internal::RTestFutureColumn, kTestFutureColumnType>>();
@@ -12,6 +12,7 @@
 #include <ROOT/RError.hxx>
 #include <Byteswap.h>
 
+#include <algorithm>
 #include <bitset>
 #include <cassert>
 #include <limits>
@@ -194,6 +195,42 @@ inline void CastUnpack(void *destination, const void *source, std::size_t count)
    }
 }
 
+/// \brief Byte-plane transpose used by the split encodings
+///
+/// Writes all the first bytes of the `count` `N`-byte elements in `source`, followed by all the second bytes, etc.
+/// Iterating over the byte planes in the outer loop keeps the stores sequential, which compilers can
+/// auto-vectorize (strided load, contiguous store), unlike the element-wise loop with its byte-sized inner loop.
+/// `planeStride` is the distance between consecutive byte planes in the split array; it equals the total
+/// number of elements of the column chunk, which may be larger than `count` when transposing tile by tile.
+template <std::size_t N>
+inline void SplitBytePlanes(char *splitArray, const char *srcBytes, std::size_t count, std::size_t planeStride)
+{
+   for (std::size_t b = 0; b < N; ++b) {
+      char *dst = splitArray + b * planeStride;
+      const char *src = srcBytes + b;
+      for (std::size_t i = 0; i < count; ++i) {
+         dst[i] = src[i * N];
+      }
+   }
+}
+
+/// \brief Reverses the effect of SplitBytePlanes (contiguous load, strided store)
+template <std::size_t N>
+inline void UnsplitBytePlanes(char *dstBytes, const char *splitArray, std::size_t count, std::size_t planeStride)
+{
+   for (std::size_t b = 0; b < N; ++b) {
+      const char *src = splitArray + b * planeStride;
+      char *dst = dstBytes + b;
+      for (std::size_t i = 0; i < count; ++i) {
+         dst[i * N] = src[i];
+      }
+   }
+}
+
+/// Number of elements encoded on the stack before transposing them into the split array; the tile keeps the
+/// working set of the fused delta/zigzag + split kernels inside the L1 cache.
+inline constexpr std::size_t kSplitTileSize = 1024;
+
 /// \brief Split encoding of elements, possibly into narrower column
 ///
 /// Used to first cast and then split-encode in-memory values to the on-disk column. Swap bytes if necessary.
@@ -201,6 +238,13 @@ template <typename DestT, typename SourceT>
 inline void CastSplitPack(void *destination, const void *source, std::size_t count)
 {
    constexpr std::size_t N = sizeof(DestT);
+#if R__LITTLE_ENDIAN == 1
+   if constexpr (std::is_same_v<DestT, SourceT>) {
+      // Neither cast nor byte swap required: the split is a plain byte-plane transpose.
+      SplitBytePlanes<N>(reinterpret_cast<char *>(destination), reinterpret_cast<const char *>(source), count, count);
+      return;
+   }
+#endif
    auto splitArray = reinterpret_cast<char *>(destination);
    auto src = reinterpret_cast<const SourceT *>(source);
    for (std::size_t i = 0; i < count; ++i) {
@@ -219,6 +263,13 @@ template <typename DestT, typename SourceT>
 inline void CastSplitUnpack(void *destination, const void *source, std::size_t count)
 {
    constexpr std::size_t N = sizeof(SourceT);
+#if R__LITTLE_ENDIAN == 1
+   if constexpr (std::is_same_v<DestT, SourceT>) {
+      // Neither cast, range check, nor byte swap required: reverse the byte-plane transpose directly.
+      UnsplitBytePlanes<N>(reinterpret_cast<char *>(destination), reinterpret_cast<const char *>(source), count, count);
+      return;
+   }
+#endif
    auto dst = reinterpret_cast<DestT *>(destination);
    auto splitArray = reinterpret_cast<const char *>(source);
    for (std::size_t i = 0; i < count; ++i) {
@@ -241,6 +292,22 @@ inline void CastDeltaSplitPack(void *destination, const void *source, std::size_
    constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
    auto splitArray = reinterpret_cast<char *>(destination);
+#if R__LITTLE_ENDIAN == 1
+   if constexpr (std::is_same_v<DestT, SourceT>) {
+      // Compute the deltas tile by tile into a stack buffer and transpose the byte planes from there;
+      // both loops are free of byte-sized inner loops and auto-vectorize.
+      DestT tile[kSplitTileSize];
+      for (std::size_t tileOff = 0; tileOff < count; tileOff += kSplitTileSize) {
+         const std::size_t n = std::min(kSplitTileSize, count - tileOff);
+         tile[0] = (tileOff == 0) ? src[0] : DestT(src[tileOff] - src[tileOff - 1]);
+         for (std::size_t i = 1; i < n; ++i) {
+            tile[i] = src[tileOff + i] - src[tileOff + i - 1];
+         }
+         SplitBytePlanes<N>(splitArray + tileOff, reinterpret_cast<const char *>(tile), n, count);
+      }
+      return;
+   }
+#endif
    for (std::size_t i = 0; i < count; ++i) {
       DestT val = (i == 0) ? src[0] : src[i] - src[i - 1];
       ByteSwapIfNecessary(val);
@@ -259,6 +326,22 @@ inline void CastDeltaSplitUnpack(void *destination, const void *source, std::siz
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
+#if R__LITTLE_ENDIAN == 1
+   if constexpr (std::is_same_v<DestT, SourceT>) {
+      // The vectorizable byte-plane gather dominates; the remaining prefix sum is a cheap scalar loop.
+      SourceT tile[kSplitTileSize];
+      SourceT previous = 0;
+      for (std::size_t tileOff = 0; tileOff < count; tileOff += kSplitTileSize) {
+         const std::size_t n = std::min(kSplitTileSize, count - tileOff);
+         UnsplitBytePlanes<N>(reinterpret_cast<char *>(tile), splitArray + tileOff, n, count);
+         for (std::size_t i = 0; i < n; ++i) {
+            previous += tile[i];
+            dst[tileOff + i] = previous;
+         }
+      }
+      return;
+   }
+#endif
    for (std::size_t i = 0; i < count; ++i) {
       SourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
@@ -282,6 +365,20 @@ inline void CastZigzagSplitPack(void *destination, const void *source, std::size
    constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
    auto splitArray = reinterpret_cast<char *>(destination);
+#if R__LITTLE_ENDIAN == 1
+   if constexpr (std::is_same_v<DestT, SourceT>) {
+      UDestT tile[kSplitTileSize];
+      for (std::size_t tileOff = 0; tileOff < count; tileOff += kSplitTileSize) {
+         const std::size_t n = std::min(kSplitTileSize, count - tileOff);
+         for (std::size_t i = 0; i < n; ++i) {
+            const DestT val = src[tileOff + i];
+            tile[i] = (static_cast<UDestT>(val) << 1) ^ static_cast<UDestT>(val >> (kNBitsDestT - 1));
+         }
+         SplitBytePlanes<N>(splitArray + tileOff, reinterpret_cast<const char *>(tile), n, count);
+      }
+      return;
+   }
+#endif
    for (std::size_t i = 0; i < count; ++i) {
       UDestT val = (static_cast<DestT>(src[i]) << 1) ^ (static_cast<DestT>(src[i]) >> (kNBitsDestT - 1));
       ByteSwapIfNecessary(val);
@@ -301,6 +398,20 @@ inline void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
+#if R__LITTLE_ENDIAN == 1
+   if constexpr (std::is_same_v<DestT, SourceT>) {
+      USourceT tile[kSplitTileSize];
+      for (std::size_t tileOff = 0; tileOff < count; tileOff += kSplitTileSize) {
+         const std::size_t n = std::min(kSplitTileSize, count - tileOff);
+         UnsplitBytePlanes<N>(reinterpret_cast<char *>(tile), splitArray + tileOff, n, count);
+         for (std::size_t i = 0; i < n; ++i) {
+            const USourceT val = tile[i];
+            dst[tileOff + i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
+         }
+      }
+      return;
+   }
+#endif
    for (std::size_t i = 0; i < count; ++i) {
       USourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
@@ -367,6 +478,7 @@ std::unique_ptr<RColumnElementBase> GenerateColumnElementInternal(ENTupleColumnT
       return std::make_unique<RColumnElement<CppT, ENTupleColumnType::kReal32Trunc>>();
    case ENTupleColumnType::kReal32Quant:
       return std::make_unique<RColumnElement<CppT, ENTupleColumnType::kReal32Quant>>();
+   case ENTupleColumnType::kBFloat16: return std::make_unique<RColumnElement<CppT, ENTupleColumnType::kBFloat16>>();
    default:
       if (onDiskType == kTestFutureColumnType)
          return std::make_unique<RColumnElement<CppT, kTestFutureColumnType>>();
@@ -876,6 +988,77 @@ public:
    RIdentifier GetIdentifier() const final { return RIdentifier{typeid(double), ENTupleColumnType::kReal16}; }
 };
 
+template <>
+class RColumnElement<float, ENTupleColumnType::kBFloat16> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = 16;
+   RColumnElement() : RColumnElementBase(kSize, kBitsOnStorage) {}
+   bool IsMappable() const final { return kIsMappable; }
+
+   void Pack(void *dst, const void *src, std::size_t count) const final
+   {
+      const float *floatArray = reinterpret_cast<const float *>(src);
+      std::uint16_t *uint16Array = reinterpret_cast<std::uint16_t *>(dst);
+
+      // The bit manipulations in the conversion auto-vectorize, unlike the table-driven fp16 one
+      for (std::size_t i = 0; i < count; ++i) {
+         uint16Array[i] = ROOT::Internal::FloatToBFloat16(floatArray[i]);
+         ByteSwapIfNecessary(uint16Array[i]);
+      }
+   }
+
+   void Unpack(void *dst, const void *src, std::size_t count) const final
+   {
+      float *floatArray = reinterpret_cast<float *>(dst);
+      const std::uint16_t *uint16Array = reinterpret_cast<const std::uint16_t *>(src);
+
+      for (std::size_t i = 0; i < count; ++i) {
+         std::uint16_t val = uint16Array[i];
+         ByteSwapIfNecessary(val);
+         floatArray[i] = ROOT::Internal::BFloat16ToFloat(val);
+      }
+   }
+
+   RIdentifier GetIdentifier() const final { return RIdentifier{typeid(float), ENTupleColumnType::kBFloat16}; }
+};
+
+template <>
+class RColumnElement<double, ENTupleColumnType::kBFloat16> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = 16;
+   RColumnElement() : RColumnElementBase(kSize, kBitsOnStorage) {}
+   bool IsMappable() const final { return kIsMappable; }
+
+   void Pack(void *dst, const void *src, std::size_t count) const final
+   {
+      const double *doubleArray = reinterpret_cast<const double *>(src);
+      std::uint16_t *uint16Array = reinterpret_cast<std::uint16_t *>(dst);
+
+      for (std::size_t i = 0; i < count; ++i) {
+         uint16Array[i] = ROOT::Internal::FloatToBFloat16(static_cast<float>(doubleArray[i]));
+         ByteSwapIfNecessary(uint16Array[i]);
+      }
+   }
+
+   void Unpack(void *dst, const void *src, std::size_t count) const final
+   {
+      double *doubleArray = reinterpret_cast<double *>(dst);
+      const std::uint16_t *uint16Array = reinterpret_cast<const std::uint16_t *>(src);
+
+      for (std::size_t i = 0; i < count; ++i) {
+         std::uint16_t val = uint16Array[i];
+         ByteSwapIfNecessary(val);
+         doubleArray[i] = static_cast<double>(ROOT::Internal::BFloat16ToFloat(val));
+      }
+   }
+
+   RIdentifier GetIdentifier() const final { return RIdentifier{typeid(double), ENTupleColumnType::kBFloat16}; }
+};
+
 template <typename T>
 class RColumnElementTrunc : public RColumnElementBase {
 public:
@@ -214,6 +214,7 @@ const ROOT::RFieldBase::RColumnRepresentations &ROOT::RField<float>::GetColumnRe
    static RColumnRepresentations representations({{ENTupleColumnType::kSplitReal32},
                                                   {ENTupleColumnType::kReal32},
                                                   {ENTupleColumnType::kReal16},
+                                                  {ENTupleColumnType::kBFloat16},
                                                   {ENTupleColumnType::kReal32Trunc},
                                                   {ENTupleColumnType::kReal32Quant}},
                                                  {{ENTupleColumnType::kSplitReal64}, {ENTupleColumnType::kReal64}});
@@ -236,6 +237,7 @@ const ROOT::RFieldBase::RColumnRepresentations &ROOT::RField<double>::GetColumnR
                                                   {ENTupleColumnType::kSplitReal32},
                                                   {ENTupleColumnType::kReal32},
                                                   {ENTupleColumnType::kReal16},
+                                                  {ENTupleColumnType::kBFloat16},
                                                   {ENTupleColumnType::kReal32Trunc},
                                                   {ENTupleColumnType::kReal32Quant}},
                                                  {});
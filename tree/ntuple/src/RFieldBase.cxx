@@ -13,6 +13,7 @@
 #include <TClassEdit.h>
 #include <TEnum.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -216,6 +217,24 @@ void ROOT::RFieldBase::RBulkValues::AdoptBuffer(void *buf, std::size_t capacity)
    fIsAdopted = true;
 }
 
+void *ROOT::RFieldBase::RBulkValues::ReadBulk(ROOT::NTupleSize_t firstIndex, const bool *maskReq, std::size_t &size)
+{
+   auto *principalColumn = fField->fPrincipalColumn;
+   R__ASSERT(principalColumn);
+   const auto localIndex = principalColumn->GetClusterIndex(firstIndex);
+
+   ROOT::NTupleSize_t nElementsInCluster;
+   {
+      const auto descGuard = principalColumn->GetPageSource()->GetSharedDescriptorGuard();
+      nElementsInCluster = descGuard->GetClusterDescriptor(localIndex.GetClusterId())
+                              .GetColumnRange(principalColumn->GetHandleSource().fPhysicalId)
+                              .GetNElements();
+   }
+   size = std::min<std::size_t>(size, nElementsInCluster - localIndex.GetIndexInCluster());
+
+   return ReadBulk(localIndex, maskReq, size);
+}
+
 //------------------------------------------------------------------------------
 
 void ROOT::RFieldBase::RCreateObjectDeleter<void>::operator()(void *)
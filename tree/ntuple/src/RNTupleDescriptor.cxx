@@ -29,16 +29,32 @@
 #include <deque>
 #include <functional>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <set>
 #include <utility>
 
 using ROOT::Internal::RNTupleSerializer;
 
+std::shared_ptr<const std::string> ROOT::Internal::InternString(const std::string &s)
+{
+   static std::mutex gLock;
+   // The pool is never pruned: it is bounded by the set of distinct strings interned, i.e. in practice by the
+   // type name diversity of the schemas seen by the process.
+   static std::map<std::string, std::shared_ptr<const std::string>, std::less<>> gPool;
+
+   std::lock_guard<std::mutex> lockGuard(gLock);
+   auto itr = gPool.find(s);
+   if (itr == gPool.end())
+      itr = gPool.emplace(s, std::make_shared<const std::string>(s)).first;
+   return itr->second;
+}
+
 bool ROOT::RFieldDescriptor::operator==(const RFieldDescriptor &other) const
 {
    return fFieldId == other.fFieldId && fFieldVersion == other.fFieldVersion && fTypeVersion == other.fTypeVersion &&
           fFieldName == other.fFieldName && fFieldDescription == other.fFieldDescription &&
-          fTypeName == other.fTypeName && fTypeAlias == other.fTypeAlias && fNRepetitions == other.fNRepetitions &&
+          *fTypeName == *other.fTypeName && *fTypeAlias == *other.fTypeAlias && fNRepetitions == other.fNRepetitions &&
           fStructure == other.fStructure && fParentId == other.fParentId &&
           fProjectionSourceId == other.fProjectionSourceId && fLinkIds == other.fLinkIds &&
           fLogicalColumnIds == other.fLogicalColumnIds && other.fTypeChecksum == other.fTypeChecksum;
@@ -153,13 +169,13 @@ bool ROOT::RFieldDescriptor::IsCustomClass() const
       return false;
 
    // Skip untyped structs
-   if (fTypeName.empty())
+   if (fTypeName->empty())
       return false;
 
    if (fStructure == ROOT::ENTupleStructure::kRecord) {
-      if (fTypeName.compare(0, 10, "std::pair<") == 0)
+      if (fTypeName->compare(0, 10, "std::pair<") == 0)
          return false;
-      if (fTypeName.compare(0, 11, "std::tuple<") == 0)
+      if (fTypeName->compare(0, 11, "std::tuple<") == 0)
          return false;
    }
 
@@ -411,7 +427,16 @@ ROOT::RNTupleDescriptor::FindClusterId(ROOT::DescriptorId_t physicalColumnId, RO
    std::size_t cgRight = GetNClusterGroups() - 1;
    while (cgLeft <= cgRight) {
       const std::size_t cgMidpoint = (cgLeft + cgRight) / 2;
-      const auto &clusterIds = GetClusterGroupDescriptor(fSortedClusterGroupIds[cgMidpoint]).GetClusterIds();
+      const auto &cgDesc = GetClusterGroupDescriptor(fSortedClusterGroupIds[cgMidpoint]);
+      if (!cgDesc.HasClusterDetails()) {
+         // Cluster group whose page list has not (yet) been materialized. Materialized cluster groups form a prefix
+         // in entry order (see RPageSource), so the searched-for element, if present at all, is in the lower half.
+         if (cgMidpoint == 0)
+            return ROOT::kInvalidDescriptorId;
+         cgRight = cgMidpoint - 1;
+         continue;
+      }
+      const auto &clusterIds = cgDesc.GetClusterIds();
       R__ASSERT(!clusterIds.empty());
 
       const auto &clusterDesc = GetClusterDescriptor(clusterIds.front());
@@ -486,6 +511,10 @@ ROOT::DescriptorId_t ROOT::RNTupleDescriptor::FindClusterId(ROOT::NTupleSize_t e
          continue;
       }
 
+      // The entry is in this cluster group, but the corresponding page list may not (yet) be materialized
+      if (!cgDesc.HasClusterDetails())
+         return ROOT::kInvalidDescriptorId;
+
       // Binary search in the current cluster group; since we already checked the element range boundaries,
       // the element must be in that cluster group.
       const auto &clusterIds = cgDesc.GetClusterIds();
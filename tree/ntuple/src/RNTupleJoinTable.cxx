@@ -85,6 +85,17 @@ ROOT::Experimental::Internal::RNTupleJoinTable::REntryMapping::REntryMapping(
 
       fMapping[RCombinedJoinFieldValue(castJoinValues)].push_back(i + entryOffset);
    }
+
+   // Size the Bloom filter to the number of distinct keys; rounding the bit count up to a power of two
+   // lets us use a mask instead of a modulo in the probes.
+   std::uint64_t nBits = 64;
+   while (nBits < fMapping.size() * kBloomBitsPerKey)
+      nBits <<= 1;
+   fBloomBitMask = nBits - 1;
+   fBloomFilter.assign(nBits >> 6, 0);
+   const RCombinedJoinFieldValueHash hasher;
+   for (const auto &[key, _] : fMapping)
+      BloomInsert(hasher(key));
 }
 
 const std::vector<ROOT::NTupleSize_t> *
@@ -100,7 +111,11 @@ ROOT ::Experimental::Internal::RNTupleJoinTable::REntryMapping::GetEntryIndexes(
       castJoinValues.push_back(CastValuePtr(valuePtrs[i], fJoinFieldValueSizes[i]));
    }
 
-   if (const auto &entries = fMapping.find(RCombinedJoinFieldValue(castJoinValues)); entries != fMapping.end()) {
+   const RCombinedJoinFieldValue joinValue(castJoinValues);
+   if (!BloomMayContain(RCombinedJoinFieldValueHash{}(joinValue)))
+      return nullptr;
+
+   if (const auto &entries = fMapping.find(joinValue); entries != fMapping.end()) {
       return &entries->second;
    }
 
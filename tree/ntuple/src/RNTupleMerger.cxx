@@ -853,7 +853,11 @@ void RNTupleMerger::MergeCommonColumns(ROOT::Internal::RClusterPool &clusterPool
 void RNTupleMerger::MergeSourceClusters(RPageSource &source, std::span<const RColumnMergeInfo> commonColumns,
                                         std::span<const RColumnMergeInfo> extraDstColumns, RNTupleMergeData &mergeData)
 {
-   ROOT::Internal::RClusterPool clusterPool{source};
+   // Let the pool's I/O thread read ahead, so the next clusters are fetched while the pages of the current
+   // one are resealed and committed to the destination. The memory held at any point in time stays bounded
+   // by the pool size (twice the pipeline depth in clusters) instead of growing with the source.
+   const auto pipelineDepth = std::max(2u, source.GetReadOptions().GetClusterPipelineDepth());
+   ROOT::Internal::RClusterPool clusterPool{source, pipelineDepth};
 
    std::vector<RColumnMergeInfo> missingColumns{extraDstColumns.begin(), extraDstColumns.end()};
 
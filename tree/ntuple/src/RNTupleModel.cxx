@@ -11,6 +11,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RBulkWriteEntry.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RFieldToken.hxx>
@@ -521,6 +522,23 @@ std::unique_ptr<ROOT::Experimental::Detail::RRawPtrWriteEntry> ROOT::RNTupleMode
    return entry;
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RBulkWriteEntry> ROOT::RNTupleModel::CreateBulkWriteEntry() const
+{
+   switch (fModelState) {
+   case EState::kBuilding: throw RException(R__FAIL("invalid attempt to create entry of unfrozen model"));
+   case EState::kExpired: throw RException(R__FAIL("invalid attempt to create entry of expired model"));
+   case EState::kFrozen: break;
+   }
+
+   auto entry = std::unique_ptr<Experimental::Detail::RBulkWriteEntry>(
+      new Experimental::Detail::RBulkWriteEntry(fModelId, fSchemaId));
+   for (const auto &f : fFieldZero->GetMutableSubfields()) {
+      entry->AddField(*f);
+   }
+   // fRegisteredSubfields are not relevant for writing
+   return entry;
+}
+
 ROOT::RFieldToken ROOT::RNTupleModel::GetToken(std::string_view fieldName) const
 {
    const auto &topLevelFields = fFieldZero->GetConstSubfields();
@@ -753,6 +753,7 @@ ROOT::Internal::RNTupleSerializer::SerializeColumnType(ENTupleColumnType type, v
    case ENTupleColumnType::kSplitIndex64: return SerializeUInt16(0x1B, buffer);
    case ENTupleColumnType::kReal32Trunc: return SerializeUInt16(0x1C, buffer);
    case ENTupleColumnType::kReal32Quant: return SerializeUInt16(0x1D, buffer);
+   case ENTupleColumnType::kBFloat16: return SerializeUInt16(0x1E, buffer);
    default:
       if (type == ROOT::Internal::kTestFutureColumnType)
          return SerializeUInt16(0x99, buffer);
@@ -796,6 +797,7 @@ ROOT::Internal::RNTupleSerializer::DeserializeColumnType(const void *buffer, ENT
    case 0x1B: type = ENTupleColumnType::kSplitIndex64; break;
    case 0x1C: type = ENTupleColumnType::kReal32Trunc; break;
    case 0x1D: type = ENTupleColumnType::kReal32Quant; break;
+   case 0x1E: type = ENTupleColumnType::kBFloat16; break;
    // case 0x99 => kTestFutureColumnType missing on purpose
    default:
       // may be a column type introduced by a future version
@@ -0,0 +1,68 @@
+/// \file RNTupleStringDictionary.cxx
+/// \ingroup NTuple
+/// \date 2026-08-29
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleStringDictionary.hxx>
+
+std::unique_ptr<ROOT::Experimental::Internal::RNTupleStringDictionary>
+ROOT::Experimental::Internal::RNTupleStringDictionary::Create(std::string_view fieldName)
+{
+   return std::unique_ptr<RNTupleStringDictionary>(new RNTupleStringDictionary(fieldName));
+}
+
+ROOT::Experimental::Internal::RNTupleStringDictionary &
+ROOT::Experimental::Internal::RNTupleStringDictionary::Add(ROOT::Internal::RPageSource &pageSource)
+{
+   pageSource.Attach();
+   auto desc = pageSource.GetSharedDescriptorGuard();
+
+   auto fieldId = desc->FindFieldId(fFieldName);
+   if (fieldId == ROOT::kInvalidDescriptorId)
+      throw RException(
+         R__FAIL("could not find field \"" + fFieldName + "\" in RNTuple \"" + pageSource.GetNTupleName() + "\""));
+
+   const auto &fieldDesc = desc->GetFieldDescriptor(fieldId);
+   if (fieldDesc.GetTypeName() != "std::string") {
+      throw RException(R__FAIL("cannot dictionary-encode field \"" + fFieldName + "\" with type \"" +
+                               fieldDesc.GetTypeName() + "\": only std::string fields are supported"));
+   }
+
+   auto field = fieldDesc.CreateField(desc.GetRef());
+   ROOT::Internal::CallConnectPageSourceOnField(*field, pageSource);
+   auto fieldValue = field->CreateValue();
+
+   const auto nEntries = pageSource.GetNEntries();
+   fEntryCodes.reserve(fEntryCodes.size() + nEntries);
+
+   for (ROOT::NTupleSize_t i = 0; i < nEntries; ++i) {
+      // TODO: use bulk reading
+      fieldValue.Read(i);
+
+      const auto &value = *fieldValue.GetPtr<std::string>();
+      auto [itr, inserted] = fCodes.try_emplace(value, static_cast<Code_t>(fValues.size()));
+      if (inserted)
+         fValues.emplace_back(value);
+      fEntryCodes.emplace_back(itr->second);
+   }
+
+   return *this;
+}
+
+ROOT::Experimental::Internal::RNTupleStringDictionary::Code_t
+ROOT::Experimental::Internal::RNTupleStringDictionary::LookupCode(const std::string &value) const
+{
+   auto code = fCodes.find(value);
+   if (code == fCodes.end())
+      return kInvalidCode;
+   return code->second;
+}
@@ -74,6 +74,14 @@ void ROOT::RNTupleWriteOptions::SetMaxUnzippedPageSize(std::size_t val)
    fMaxUnzippedPageSize = val;
 }
 
+void ROOT::RNTupleWriteOptions::SetApproxZippedPageSize(std::size_t val)
+{
+   if (val == 0) {
+      throw RException(R__FAIL("invalid target page size: 0"));
+   }
+   fApproxZippedPageSize = val;
+}
+
 void ROOT::RNTupleWriteOptions::SetEnableSamePageMerging(bool val)
 {
    if (val && !fEnablePageChecksums) {
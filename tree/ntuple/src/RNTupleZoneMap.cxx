@@ -0,0 +1,174 @@
+/// \file RNTupleZoneMap.cxx
+/// \ingroup NTuple
+/// \date 2026-08-29
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleZoneMap.hxx>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+enum class ENumericType {
+   kInt8,
+   kUInt8,
+   kInt16,
+   kUInt16,
+   kInt32,
+   kUInt32,
+   kInt64,
+   kUInt64,
+   kFloat,
+   kDouble
+};
+
+const std::unordered_map<std::string, ENumericType> &GetNumericTypes()
+{
+   static const std::unordered_map<std::string, ENumericType> numericTypes = {
+      {"std::int8_t", ENumericType::kInt8},     {"std::uint8_t", ENumericType::kUInt8},
+      {"std::int16_t", ENumericType::kInt16},   {"std::uint16_t", ENumericType::kUInt16},
+      {"std::int32_t", ENumericType::kInt32},   {"std::uint32_t", ENumericType::kUInt32},
+      {"std::int64_t", ENumericType::kInt64},   {"std::uint64_t", ENumericType::kUInt64},
+      {"float", ENumericType::kFloat},          {"double", ENumericType::kDouble}};
+   return numericTypes;
+}
+
+double CastValuePtr(void *valuePtr, ENumericType type)
+{
+   switch (type) {
+   case ENumericType::kInt8: return *reinterpret_cast<std::int8_t *>(valuePtr);
+   case ENumericType::kUInt8: return *reinterpret_cast<std::uint8_t *>(valuePtr);
+   case ENumericType::kInt16: return *reinterpret_cast<std::int16_t *>(valuePtr);
+   case ENumericType::kUInt16: return *reinterpret_cast<std::uint16_t *>(valuePtr);
+   case ENumericType::kInt32: return *reinterpret_cast<std::int32_t *>(valuePtr);
+   case ENumericType::kUInt32: return *reinterpret_cast<std::uint32_t *>(valuePtr);
+   case ENumericType::kInt64: return *reinterpret_cast<std::int64_t *>(valuePtr);
+   case ENumericType::kUInt64: return *reinterpret_cast<std::uint64_t *>(valuePtr);
+   case ENumericType::kFloat: return *reinterpret_cast<float *>(valuePtr);
+   case ENumericType::kDouble: return *reinterpret_cast<double *>(valuePtr);
+   }
+   throw ROOT::RException(R__FAIL("unsupported numeric type"));
+}
+} // anonymous namespace
+
+std::unique_ptr<ROOT::Experimental::Internal::RNTupleZoneMap>
+ROOT::Experimental::Internal::RNTupleZoneMap::Create(const std::vector<std::string> &fieldNames)
+{
+   return std::unique_ptr<RNTupleZoneMap>(new RNTupleZoneMap(fieldNames));
+}
+
+ROOT::Experimental::Internal::RNTupleZoneMap &
+ROOT::Experimental::Internal::RNTupleZoneMap::Add(ROOT::Internal::RPageSource &pageSource,
+                                                  ROOT::NTupleSize_t entryOffset)
+{
+   pageSource.Attach();
+   auto desc = pageSource.GetSharedDescriptorGuard();
+
+   std::vector<std::unique_ptr<ROOT::RFieldBase>> fields;
+   std::vector<ROOT::RFieldBase::RValue> fieldValues;
+   std::vector<ENumericType> fieldTypes;
+   fieldValues.reserve(fFieldNames.size());
+   fieldTypes.reserve(fFieldNames.size());
+
+   for (const auto &fieldName : fFieldNames) {
+      auto fieldId = desc->FindFieldId(fieldName);
+      if (fieldId == ROOT::kInvalidDescriptorId)
+         throw RException(R__FAIL("could not find field \"" + fieldName + "\" in RNTuple \"" +
+                                  pageSource.GetNTupleName() + "\""));
+
+      const auto &fieldDesc = desc->GetFieldDescriptor(fieldId);
+
+      const auto numericType = GetNumericTypes().find(fieldDesc.GetTypeName());
+      if (numericType == GetNumericTypes().end()) {
+         throw RException(R__FAIL("cannot use field \"" + fieldName + "\" with type \"" + fieldDesc.GetTypeName() +
+                                  "\" in zone map: only integral and floating-point types are allowed"));
+      }
+
+      auto field = fieldDesc.CreateField(desc.GetRef());
+      ROOT::Internal::CallConnectPageSourceOnField(*field, pageSource);
+
+      fieldValues.emplace_back(field->CreateValue());
+      fieldTypes.emplace_back(numericType->second);
+      fields.emplace_back(std::move(field));
+   }
+
+   for (const auto &clusterDesc : desc->GetClusterIterable()) {
+      const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+      const auto nEntries = clusterDesc.GetNEntries();
+
+      std::vector<RZoneStats> clusterZones(fFieldNames.size());
+      for (auto &zone : clusterZones) {
+         zone.fFirstEntry = firstEntry + entryOffset;
+         zone.fNEntries = nEntries;
+      }
+
+      for (ROOT::NTupleSize_t i = firstEntry; i < firstEntry + nEntries; ++i) {
+         for (unsigned j = 0; j < fieldValues.size(); ++j) {
+            // TODO: use bulk reading
+            fieldValues[j].Read(i);
+
+            const auto value = CastValuePtr(fieldValues[j].GetPtr<void>().get(), fieldTypes[j]);
+            clusterZones[j].fMin = std::min(clusterZones[j].fMin, value);
+            clusterZones[j].fMax = std::max(clusterZones[j].fMax, value);
+         }
+      }
+
+      for (unsigned j = 0; j < fFieldNames.size(); ++j)
+         fZones[fFieldNames[j]].emplace_back(clusterZones[j]);
+   }
+
+   // The cluster iterable is not guaranteed to be in entry order
+   for (const auto &fieldName : fFieldNames) {
+      auto &zones = fZones[fieldName];
+      std::sort(zones.begin(), zones.end(),
+                [](const RZoneStats &a, const RZoneStats &b) { return a.fFirstEntry < b.fFirstEntry; });
+   }
+
+   return *this;
+}
+
+const std::vector<ROOT::Experimental::Internal::RNTupleZoneMap::RZoneStats> &
+ROOT::Experimental::Internal::RNTupleZoneMap::GetZones(const std::string &fieldName) const
+{
+   auto zones = fZones.find(fieldName);
+   if (zones == fZones.end())
+      throw RException(R__FAIL("no zone statistics collected for field \"" + fieldName + "\""));
+   return zones->second;
+}
+
+std::vector<ROOT::RNTupleGlobalRange>
+ROOT::Experimental::Internal::RNTupleZoneMap::GetCandidateRanges(const std::string &fieldName, double min,
+                                                                 double max) const
+{
+   std::vector<ROOT::RNTupleGlobalRange> ranges;
+
+   ROOT::NTupleSize_t pendingStart = ROOT::kInvalidNTupleIndex;
+   ROOT::NTupleSize_t pendingEnd = ROOT::kInvalidNTupleIndex;
+
+   for (const auto &zone : GetZones(fieldName)) {
+      if (zone.fMax < min || zone.fMin > max)
+         continue;
+
+      if (pendingStart != ROOT::kInvalidNTupleIndex && zone.fFirstEntry == pendingEnd) {
+         pendingEnd = zone.fFirstEntry + zone.fNEntries;
+         continue;
+      }
+      if (pendingStart != ROOT::kInvalidNTupleIndex)
+         ranges.emplace_back(pendingStart, pendingEnd);
+      pendingStart = zone.fFirstEntry;
+      pendingEnd = zone.fFirstEntry + zone.fNEntries;
+   }
+   if (pendingStart != ROOT::kInvalidNTupleIndex)
+      ranges.emplace_back(pendingStart, pendingEnd);
+
+   return ranges;
+}
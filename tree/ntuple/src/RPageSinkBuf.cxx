@@ -13,13 +13,17 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RNTupleWriteOptions.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 
 #include <algorithm>
+#include <future>
 #include <memory>
+#include <utility>
 
 using ROOT::Experimental::Detail::RNTupleAtomicCounter;
 using ROOT::Experimental::Detail::RNTupleAtomicTimer;
@@ -43,6 +47,8 @@ ROOT::Internal::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink> inner)
    fMetrics = RNTupleMetrics("RPageSinkBuf");
    fCounters = std::make_unique<RCounters>(
       RCounters{*fMetrics.MakeCounter<RNTuplePlainCounter *>("ParallelZip", "", "compressing pages in parallel"),
+                *fMetrics.MakeCounter<RNTuplePlainCounter *>("nAdaptivePageSizeUpdates", "",
+                                                             "number of retuned per-column page size limits"),
                 *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallZip", "ns", "wall clock time spent compressing"),
                 *fMetrics.MakeCounter<RNTuplePlainCounter *>("timeWallCriticalSection", "ns",
                                                              "wall clock time spent in critical sections"),
@@ -59,6 +65,19 @@ ROOT::Internal::RPageSinkBuf::~RPageSinkBuf()
    // This cannot be moved to the base class destructor, given non-static members have been destroyed by the time the
    // base class destructor is invoked.
    WaitForAllTasks();
+   if (fPendingFlush.valid()) {
+      try {
+         fPendingFlush.get();
+      } catch (const RException &err) {
+         R__LOG_ERROR(ROOT::Internal::NTupleLog()) << "failure flushing cluster: " << err.GetError().GetReport();
+      }
+   }
+}
+
+void ROOT::Internal::RPageSinkBuf::WaitForPendingFlush()
+{
+   if (fPendingFlush.valid())
+      fPendingFlush.get();
 }
 
 ROOT::Internal::RPageStorage::ColumnHandle_t
@@ -103,6 +122,8 @@ void ROOT::Internal::RPageSinkBuf::UpdateSchema(const ROOT::Internal::RNTupleMod
 {
    ConnectFields(changeset.fAddedFields, firstEntry);
 
+   WaitForPendingFlush();
+
    // The buffered page sink maintains a copy of the RNTupleModel for the inner sink; replicate the changes there
    // TODO(jalopezg): we should be able, in general, to simplify the buffered sink.
    auto cloneAddField = [&](const ROOT::RFieldBase *field) {
@@ -136,6 +157,7 @@ void ROOT::Internal::RPageSinkBuf::UpdateSchema(const ROOT::Internal::RNTupleMod
 
 void ROOT::Internal::RPageSinkBuf::UpdateExtraTypeInfo(const ROOT::RExtraTypeInfoDescriptor &extraTypeInfo)
 {
+   WaitForPendingFlush();
    RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
    RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
    fInnerSink->UpdateExtraTypeInfo(extraTypeInfo);
@@ -212,9 +234,13 @@ void ROOT::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t columnHandle, const
       // Make sure the page buffer is not aliased so that we can free the uncompressed page.
       config.fAllowAlias = false;
       config.fBuffer = zipItem.fBuf.get();
-      // TODO: Somehow expose the time spent in zipping via the metrics. Wall time is tricky because the tasks run
-      // in parallel...
-      sealedPage = SealPage(config);
+      {
+         // The counters are atomic, so tasks can update them concurrently. Note that timeWallZip aggregates
+         // the time spent in all sealing tasks; with parallel compression it can exceed the elapsed wall
+         // clock time of the cluster flush.
+         RNTupleAtomicTimer timer(fCounters->fTimeWallZip, fCounters->fTimeCpuZip);
+         sealedPage = SealPage(config);
+      }
       shrinkSealedPage();
       zipItem.fSealedPage = &sealedPage;
       // Release the uncompressed page. This works because the "page allocator must be thread-safe."
@@ -237,9 +263,29 @@ void ROOT::Internal::RPageSinkBuf::CommitSealedPageV(
 // We implement both StageCluster() and CommitCluster() because we can call CommitCluster() on the inner sink more
 // efficiently in a single critical section. For parallel writing, it also guarantees that we produce a fully sequential
 // file.
+void ROOT::Internal::RPageSinkBuf::UpdateAdaptivePageSizes()
+{
+   if (!GetWriteOptions().GetEnableAdaptivePageSizes())
+      return;
+
+   for (auto &bufColumn : fBufferedColumns) {
+      auto *column = bufColumn.GetHandle().fColumn;
+      if (!column)
+         continue;
+      const auto elementSize = column->GetElement()->GetSize();
+      for (const auto &sealedPage : bufColumn.GetSealedPages()) {
+         if (column->UpdateCompressionStats(sealedPage.GetNElements() * elementSize, sealedPage.GetDataSize()))
+            fCounters->fNAdaptivePageSizeUpdates.Inc();
+      }
+   }
+}
+
 void ROOT::Internal::RPageSinkBuf::FlushClusterImpl(std::function<void(void)> FlushClusterFn)
 {
    WaitForAllTasks();
+   WaitForPendingFlush();
+
+   UpdateAdaptivePageSizes();
 
    std::vector<RSealedPageGroup> toCommit;
    toCommit.reserve(fBufferedColumns.size());
@@ -267,8 +313,61 @@ void ROOT::Internal::RPageSinkBuf::FlushClusterImpl(std::function<void(void)> Fl
 
 std::uint64_t ROOT::Internal::RPageSinkBuf::CommitCluster(ROOT::NTupleSize_t nNewEntries)
 {
-   std::uint64_t nbytes;
-   FlushClusterImpl([&] { nbytes = fInnerSink->CommitCluster(nNewEntries); });
+   if (!GetWriteOptions().GetUseBackgroundClusterFlush()) {
+      std::uint64_t nbytes;
+      FlushClusterImpl([&] { nbytes = fInnerSink->CommitCluster(nNewEntries); });
+      return nbytes;
+   }
+
+   WaitForAllTasks();
+   WaitForPendingFlush();
+
+   UpdateAdaptivePageSizes();
+
+   // Hand the sealed pages of this cluster over to a background thread, so that the caller can start filling
+   // the next cluster while the previous one is in flight, e.g. to a slow or remote storage endpoint.
+   struct RFlushPayload {
+      std::vector<ROOT::DescriptorId_t> fPhysicalIds;
+      std::vector<std::deque<RColumnBuf::RPageZipItem>> fZipItems;
+      std::vector<RPageStorage::SealedPageSequence_t> fSealedPages;
+      std::vector<ColumnHandle_t> fSuppressedColumns;
+   };
+   auto payload = std::make_shared<RFlushPayload>();
+   payload->fPhysicalIds.reserve(fBufferedColumns.size());
+   payload->fZipItems.reserve(fBufferedColumns.size());
+   payload->fSealedPages.reserve(fBufferedColumns.size());
+   std::uint64_t nbytes = 0;
+   for (auto &bufColumn : fBufferedColumns) {
+      R__ASSERT(bufColumn.HasSealedPagesOnly());
+      payload->fPhysicalIds.emplace_back(bufColumn.GetHandle().fPhysicalId);
+      auto [zipItems, sealedPages] = bufColumn.MoveOutBufferedPages();
+      for (const auto &sealedPage : sealedPages)
+         nbytes += sealedPage.GetBufferSize();
+      payload->fZipItems.emplace_back(std::move(zipItems));
+      payload->fSealedPages.emplace_back(std::move(sealedPages));
+   }
+   payload->fSuppressedColumns = std::move(fSuppressedColumns);
+   fSuppressedColumns.clear();
+
+   fPendingFlush = std::async(std::launch::async, [this, payload, nNewEntries] {
+      std::vector<RSealedPageGroup> toCommit;
+      toCommit.reserve(payload->fSealedPages.size());
+      for (std::size_t i = 0; i < payload->fSealedPages.size(); ++i) {
+         toCommit.emplace_back(payload->fPhysicalIds[i], payload->fSealedPages[i].cbegin(),
+                               payload->fSealedPages[i].cend());
+      }
+
+      RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
+      RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
+      fInnerSink->CommitSealedPageV(toCommit);
+
+      for (auto handle : payload->fSuppressedColumns)
+         fInnerSink->CommitSuppressedColumn(handle);
+
+      fInnerSink->CommitCluster(nNewEntries);
+   });
+
+   // The bytes written by the inner sink, which we cannot wait for, equal the sum of the sealed page buffers.
    return nbytes;
 }
 
@@ -281,6 +380,7 @@ ROOT::Internal::RPageSink::RStagedCluster ROOT::Internal::RPageSinkBuf::StageClu
 
 void ROOT::Internal::RPageSinkBuf::CommitStagedClusters(std::span<RStagedCluster> clusters)
 {
+   WaitForPendingFlush();
    RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
    RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
    fInnerSink->CommitStagedClusters(clusters);
@@ -288,6 +388,7 @@ void ROOT::Internal::RPageSinkBuf::CommitStagedClusters(std::span<RStagedCluster
 
 void ROOT::Internal::RPageSinkBuf::CommitClusterGroup()
 {
+   WaitForPendingFlush();
    RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
    RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
    fInnerSink->CommitClusterGroup();
@@ -295,6 +396,7 @@ void ROOT::Internal::RPageSinkBuf::CommitClusterGroup()
 
 void ROOT::Internal::RPageSinkBuf::CommitDatasetImpl()
 {
+   WaitForPendingFlush();
    RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
    RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
    fInnerSink->CommitDataset();
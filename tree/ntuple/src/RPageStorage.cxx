@@ -221,11 +221,41 @@ void ROOT::Internal::RPageSource::LoadStructure()
 void ROOT::Internal::RPageSource::Attach(RNTupleSerializer::EDescriptorDeserializeMode mode)
 {
    LoadStructure();
-   if (!fIsAttached)
+   if (!fIsAttached) {
+      fDeserializeMode = mode;
       GetExclDescriptorGuard().MoveIn(AttachImpl(mode));
+   }
    fIsAttached = true;
 }
 
+void ROOT::Internal::RPageSource::LoadPageListImpl(ROOT::RNTupleDescriptor &, const ROOT::RClusterGroupDescriptor &,
+                                                   RNTupleSerializer::EDescriptorDeserializeMode)
+{
+   throw RException(R__FAIL("this page source does not support lazy loading of cluster metadata"));
+}
+
+bool ROOT::Internal::RPageSource::TryMaterializeNextClusterGroup()
+{
+   if (!fOptions.GetEnableLazyClusterMetadata())
+      return false;
+
+   auto descriptorGuard = GetExclDescriptorGuard();
+   // Materialize cluster groups in entry order, so that the materialized cluster details always form a prefix
+   // of the data set; RNTupleDescriptor::FindClusterId() relies on this property.
+   const ROOT::RClusterGroupDescriptor *next = nullptr;
+   for (const auto &cgDesc : descriptorGuard->GetClusterGroupIterable()) {
+      if (cgDesc.HasClusterDetails())
+         continue;
+      if (!next || (cgDesc.GetMinEntry() < next->GetMinEntry()))
+         next = &cgDesc;
+   }
+   if (!next)
+      return false;
+
+   LoadPageListImpl(*descriptorGuard.operator->(), *next, fDeserializeMode);
+   return true;
+}
+
 std::unique_ptr<ROOT::Internal::RPageSource> ROOT::Internal::RPageSource::Clone() const
 {
    auto clone = CloneImpl();
@@ -392,22 +422,28 @@ ROOT::Internal::RPageSource::LoadPage(ColumnHandle_t columnHandle, ROOT::NTupleS
 
    std::uint64_t idxInCluster;
    RClusterInfo clusterInfo;
-   {
-      auto descriptorGuard = GetSharedDescriptorGuard();
-      clusterInfo.fClusterId = descriptorGuard->FindClusterId(columnId, globalIndex);
+   for (;;) {
+      {
+         auto descriptorGuard = GetSharedDescriptorGuard();
+         clusterInfo.fClusterId = descriptorGuard->FindClusterId(columnId, globalIndex);
+
+         if (clusterInfo.fClusterId != ROOT::kInvalidDescriptorId) {
+            const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterInfo.fClusterId);
+            const auto &columnRange = clusterDescriptor.GetColumnRange(columnId);
+            if (columnRange.IsSuppressed())
+               return ROOT::Internal::RPageRef();
+
+            clusterInfo.fColumnOffset = columnRange.GetFirstElementIndex();
+            R__ASSERT(clusterInfo.fColumnOffset <= globalIndex);
+            idxInCluster = globalIndex - clusterInfo.fColumnOffset;
+            clusterInfo.fPageInfo = clusterDescriptor.GetPageRange(columnId).Find(idxInCluster);
+            break;
+         }
+      }
 
-      if (clusterInfo.fClusterId == ROOT::kInvalidDescriptorId)
+      // The element may be in a cluster group whose page list has not yet been materialized
+      if (!TryMaterializeNextClusterGroup())
          throw RException(R__FAIL("entry with index " + std::to_string(globalIndex) + " out of bounds"));
-
-      const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterInfo.fClusterId);
-      const auto &columnRange = clusterDescriptor.GetColumnRange(columnId);
-      if (columnRange.IsSuppressed())
-         return ROOT::Internal::RPageRef();
-
-      clusterInfo.fColumnOffset = columnRange.GetFirstElementIndex();
-      R__ASSERT(clusterInfo.fColumnOffset <= globalIndex);
-      idxInCluster = globalIndex - clusterInfo.fColumnOffset;
-      clusterInfo.fPageInfo = clusterDescriptor.GetPageRange(columnId).Find(idxInCluster);
    }
 
    if (clusterInfo.fPageInfo.GetLocator().GetType() == RNTupleLocator::kTypeUnknown)
@@ -568,6 +604,16 @@ ROOT::RResult<ROOT::Internal::RPage> ROOT::Internal::RPageSource::UnsealPage(con
       return R__FORWARD_ERROR(rv);
 
    const auto bytesPacked = element.GetPackedSize(sealedPage.GetNElements());
+
+   if ((sealedPage.GetDataSize() == bytesPacked) && !element.IsMappable()) {
+      // The page is stored uncompressed and needs unpacking anyway, so we can unpack directly from the
+      // sealed buffer and avoid the intermediate copy of the packed representation.
+      auto page = pageAlloc.NewPage(element.GetSize(), sealedPage.GetNElements());
+      element.Unpack(page.GetBuffer(), sealedPage.GetBuffer(), sealedPage.GetNElements());
+      page.GrowUnchecked(sealedPage.GetNElements());
+      return page;
+   }
+
    auto page = pageAlloc.NewPage(element.GetPackedSize(), sealedPage.GetNElements());
    if (sealedPage.GetDataSize() != bytesPacked) {
       ROOT::Internal::RNTupleDecompressor::Unzip(sealedPage.GetBuffer(), sealedPage.GetDataSize(), bytesPacked,
@@ -1036,6 +1082,11 @@ void ROOT::Internal::RPagePersistentSink::CommitPage(ColumnHandle_t columnHandle
    pageInfo.SetLocator(CommitPageImpl(columnHandle, page));
    pageInfo.SetHasChecksum(GetWriteOptions().GetEnablePageChecksums());
    fOpenPageRanges.at(columnHandle.fPhysicalId).GetPageInfos().emplace_back(pageInfo);
+
+   if (GetWriteOptions().GetEnableAdaptivePageSizes() && columnHandle.fColumn) {
+      if (columnHandle.fColumn->UpdateCompressionStats(page.GetNBytes(), pageInfo.GetLocator().GetNBytesOnStorage()))
+         fCounters->fNAdaptivePageSizeUpdates.Inc();
+   }
 }
 
 void ROOT::Internal::RPagePersistentSink::CommitSealedPage(ROOT::DescriptorId_t physicalColumnId,
@@ -1281,6 +1332,8 @@ void ROOT::Internal::RPagePersistentSink::EnableDefaultMetrics(const std::string
    fMetrics = RNTupleMetrics(prefix);
    fCounters = std::make_unique<RCounters>(RCounters{
       *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nPageCommitted", "", "number of pages committed to storage"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nAdaptivePageSizeUpdates", "",
+                                                    "number of retuned per-column page size limits"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter *>("szWritePayload", "B", "volume written for committed pages"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter *>("szZip", "B", "volume before zipping"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallWrite", "ns", "wall clock time spent writing"),
@@ -368,17 +368,10 @@ ROOT::RNTupleDescriptor ROOT::Internal::RPageSourceFile::AttachImpl(RNTupleSeria
 
    auto desc = fDescriptorBuilder.MoveDescriptor();
 
-   std::vector<unsigned char> buffer;
-   for (const auto &cgDesc : desc.GetClusterGroupIterable()) {
-      buffer.resize(std::max<size_t>(buffer.size(),
-                                     cgDesc.GetPageListLength() + cgDesc.GetPageListLocator().GetNBytesOnStorage()));
-      auto *zipBuffer = buffer.data() + cgDesc.GetPageListLength();
-      fReader.ReadBuffer(zipBuffer, cgDesc.GetPageListLocator().GetNBytesOnStorage(),
-                         cgDesc.GetPageListLocator().GetPosition<std::uint64_t>());
-      RNTupleDecompressor::Unzip(zipBuffer, cgDesc.GetPageListLocator().GetNBytesOnStorage(),
-                                 cgDesc.GetPageListLength(), buffer.data());
-
-      RNTupleSerializer::DeserializePageList(buffer.data(), cgDesc.GetPageListLength(), cgDesc.GetId(), desc, mode);
+   // With lazy cluster metadata, the page lists are deserialized on demand in LoadPageListImpl()
+   if (!GetReadOptions().GetEnableLazyClusterMetadata()) {
+      for (const auto &cgDesc : desc.GetClusterGroupIterable())
+         LoadPageListImpl(desc, cgDesc, mode);
    }
 
    // For the page reads, we rely on the I/O scheduler to define the read requests
@@ -387,6 +380,21 @@ ROOT::RNTupleDescriptor ROOT::Internal::RPageSourceFile::AttachImpl(RNTupleSeria
    return desc;
 }
 
+void ROOT::Internal::RPageSourceFile::LoadPageListImpl(ROOT::RNTupleDescriptor &desc,
+                                                       const ROOT::RClusterGroupDescriptor &cgDesc,
+                                                       RNTupleSerializer::EDescriptorDeserializeMode mode)
+{
+   const auto bufSize = cgDesc.GetPageListLength() + cgDesc.GetPageListLocator().GetNBytesOnStorage();
+   const auto buffer = MakeUninitArray<unsigned char>(bufSize);
+   auto *zipBuffer = buffer.get() + cgDesc.GetPageListLength();
+   fReader.ReadBuffer(zipBuffer, cgDesc.GetPageListLocator().GetNBytesOnStorage(),
+                      cgDesc.GetPageListLocator().GetPosition<std::uint64_t>());
+   RNTupleDecompressor::Unzip(zipBuffer, cgDesc.GetPageListLocator().GetNBytesOnStorage(), cgDesc.GetPageListLength(),
+                              buffer.get());
+
+   RNTupleSerializer::DeserializePageList(buffer.get(), cgDesc.GetPageListLength(), cgDesc.GetId(), desc, mode);
+}
+
 void ROOT::Internal::RPageSourceFile::LoadSealedPage(ROOT::DescriptorId_t physicalColumnId,
                                                      RNTupleLocalIndex localIndex, RSealedPage &sealedPage)
 {
@@ -854,6 +854,78 @@ TEST(RRawPtrWriteEntry, Basics)
    EXPECT_THROW(e->BindRawPtr(token, &pt), ROOT::RException);
 }
 
+TEST(RBulkWriteEntry, Basics)
+{
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<float>>("hits");
+   model->Freeze();
+
+   auto e = model->CreateBulkWriteEntry();
+   EXPECT_EQ(e->GetModelId(), model->GetModelId());
+   EXPECT_EQ(e->GetSchemaId(), model->GetSchemaId());
+
+   EXPECT_THROW(e->GetToken("eta"), ROOT::RException);
+   EXPECT_THROW(e->SetStride(0), ROOT::RException);
+
+   struct Event {
+      float pt;
+      std::vector<float> hits;
+   };
+   e->SetStride(sizeof(Event));
+   e->BindFieldOffset<float>("pt", offsetof(Event, pt));
+   // Type checks apply as for REntry
+   EXPECT_THROW(e->BindFieldOffset<double>("pt", offsetof(Event, pt)), ROOT::RException);
+   // Tokens from a new model are incompatible
+   auto model2 = RNTupleModel::Create();
+   model2->MakeField<float>("pt");
+   model2->Freeze();
+   EXPECT_THROW(e->BindFieldOffset<float>(model2->GetToken("pt"), 0), ROOT::RException);
+   e->BindFieldOffset<std::vector<float>>("hits", offsetof(Event, hits));
+}
+
+TEST(RBulkWriteEntry, WriteRead)
+{
+   FileRaii fileGuard("test_ntuple_bulk_write_entry.root");
+
+   struct Event {
+      float pt;
+      std::vector<float> hits;
+   };
+   std::vector<Event> events;
+   for (int i = 0; i < 100; i++) {
+      events.emplace_back(Event{static_cast<float>(i), {static_cast<float>(i), static_cast<float>(2 * i)}});
+   }
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::vector<float>>("hits");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+
+      auto entry = writer->CreateBulkWriteEntry();
+      // Bulk filling with unbound fields or without a stride should throw
+      EXPECT_THROW(writer->FillBulk(*entry, events.data(), events.size()), ROOT::RException);
+      entry->BindFieldOffset<float>("pt", offsetof(Event, pt));
+      entry->BindFieldOffset<std::vector<float>>("hits", offsetof(Event, hits));
+      EXPECT_THROW(writer->FillBulk(*entry, events.data(), events.size()), ROOT::RException);
+      entry->SetStride(sizeof(Event));
+
+      writer->FillBulk(*entry, events.data(), 60);
+      writer->FillBulk(*entry, events.data() + 60, events.size() - 60);
+   }
+
+   auto reader = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   ASSERT_EQ(events.size(), reader->GetNEntries());
+   auto pt = reader->GetModel().GetDefaultEntry().GetPtr<float>("pt");
+   auto hits = reader->GetModel().GetDefaultEntry().GetPtr<std::vector<float>>("hits");
+   for (std::size_t i = 0; i < events.size(); i++) {
+      reader->LoadEntry(i);
+      EXPECT_FLOAT_EQ(events[i].pt, *pt);
+      EXPECT_EQ(events[i].hits, *hits);
+   }
+}
+
 TEST(RFieldBase, CreateObject)
 {
    auto ptrInt = RField<int>("name").CreateObject<int>();
@@ -686,3 +686,68 @@ TEST(RNTupleDescriptor, CloneSchema)
    EXPECT_EQ(descOnlySchema.GetOnDiskHeaderSize(), 0);
    EXPECT_EQ(descOnlySchema.GetOnDiskFooterSize(), 0);
 }
+
+TEST(RNTupleDescriptor, TypeNameInterning)
+{
+   // Equal strings are interned into the same shared copy
+   EXPECT_EQ(ROOT::Internal::InternString("std::vector<float>").get(),
+             ROOT::Internal::InternString("std::vector<float>").get());
+   EXPECT_NE(ROOT::Internal::InternString("float").get(), ROOT::Internal::InternString("double").get());
+
+   auto fieldDesc = RFieldDescriptorBuilder()
+                       .FieldId(1)
+                       .FieldName("pt")
+                       .TypeName("float")
+                       .Structure(ROOT::ENTupleStructure::kLeaf)
+                       .MakeDescriptor()
+                       .Unwrap();
+   EXPECT_EQ("float", fieldDesc.GetTypeName());
+   EXPECT_EQ(ROOT::Internal::InternString("float").get(), &fieldDesc.GetTypeName());
+   // Clones share the interned type name
+   const auto clone = fieldDesc.Clone();
+   EXPECT_EQ(&fieldDesc.GetTypeName(), &clone.GetTypeName());
+}
+
+TEST(RNTupleDescriptor, LazyClusterMetadata)
+{
+   FileRaii fileGuard("test_ntuple_lazy_cluster_metadata.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *fldPt = i;
+         writer->Fill();
+         if ((i % 25) == 24)
+            writer->CommitCluster(true /* commitClusterGroup */);
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetEnableLazyClusterMetadata(true);
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   {
+      const auto &desc = reader->GetDescriptor();
+      EXPECT_EQ(4u, desc.GetNClusterGroups());
+      EXPECT_EQ(100u, desc.GetNEntries());
+      EXPECT_EQ(4u, desc.GetNClusters());
+      // Opening deserialized only header and footer; no page list has been read yet
+      EXPECT_EQ(0u, desc.GetNActiveClusters());
+      for (const auto &cgDesc : desc.GetClusterGroupIterable())
+         EXPECT_FALSE(cgDesc.HasClusterDetails());
+   }
+
+   auto viewPt = reader->GetView<float>("pt");
+   EXPECT_FLOAT_EQ(0.0, viewPt(0));
+   // Reading the first entry materialized the cluster details of the first cluster group only
+   EXPECT_EQ(1u, reader->GetDescriptor().GetNActiveClusters());
+
+   EXPECT_FLOAT_EQ(99.0, viewPt(99));
+   EXPECT_EQ(4u, reader->GetDescriptor().GetNActiveClusters());
+
+   // Ensure all entries are readable after on-demand materialization
+   for (int i = 0; i < 100; ++i)
+      EXPECT_FLOAT_EQ(float(i), viewPt(i));
+
+   EXPECT_THROW(viewPt(100), ROOT::RException);
+}
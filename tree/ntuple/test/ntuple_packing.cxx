@@ -152,6 +152,55 @@ TEST(Packing, HalfPrecisionFloat)
    EXPECT_FLOAT_EQ(0.399902343, dout4[3]);
 }
 
+TEST(Packing, BrainFloat)
+{
+   auto element32_16 = RColumnElementBase::Generate<float>(ENTupleColumnType::kBFloat16);
+   auto element64_16 = RColumnElementBase::Generate<double>(ENTupleColumnType::kBFloat16);
+   element32_16->Pack(nullptr, nullptr, 0);
+   element32_16->Unpack(nullptr, nullptr, 0);
+   element64_16->Pack(nullptr, nullptr, 0);
+   element64_16->Unpack(nullptr, nullptr, 0);
+
+   float fin = 3.14;
+   unsigned char buf[2] = {0, 0};
+   element32_16->Pack(buf, &fin, 1);
+   // Expected bit representation: 0b01000000 01001001 (top halfword of the float, rounded to nearest even)
+   EXPECT_EQ(0x49, buf[0]);
+   EXPECT_EQ(0x40, buf[1]);
+   float fout = 0.;
+   element32_16->Unpack(&fout, buf, 1);
+   EXPECT_FLOAT_EQ(3.140625, fout);
+
+   buf[0] = buf[1] = 0;
+   double din = 3.14;
+   element64_16->Pack(buf, &din, 1);
+   EXPECT_EQ(0x49, buf[0]);
+   EXPECT_EQ(0x40, buf[1]);
+   double dout = 0.;
+   element64_16->Unpack(&dout, buf, 1);
+   EXPECT_FLOAT_EQ(3.140625, dout);
+
+   float fin4[] = {0.1, 0.2, 0.3, 0.4};
+   std::uint64_t b4 = 0;
+   element32_16->Pack(&b4, &fin4, 4);
+   float fout4[] = {0., 0., 0., 0.};
+   element32_16->Unpack(&fout4, &b4, 4);
+   EXPECT_FLOAT_EQ(0.10009765625, fout4[0]);
+   EXPECT_FLOAT_EQ(0.2001953125, fout4[1]);
+   EXPECT_FLOAT_EQ(0.30078125, fout4[2]);
+   EXPECT_FLOAT_EQ(0.400390625, fout4[3]);
+
+   double din4[] = {0.1, 0.2, 0.3, 0.4};
+   b4 = 0;
+   element64_16->Pack(&b4, &din4, 4);
+   double dout4[] = {0., 0., 0., 0.};
+   element64_16->Unpack(&dout4, &b4, 4);
+   EXPECT_FLOAT_EQ(0.10009765625, dout4[0]);
+   EXPECT_FLOAT_EQ(0.2001953125, dout4[1]);
+   EXPECT_FLOAT_EQ(0.30078125, dout4[2]);
+   EXPECT_FLOAT_EQ(0.400390625, dout4[3]);
+}
+
 TEST(Packing, RColumnSwitch)
 {
    auto element = RColumnElementBase::Generate<RColumnSwitch>(ENTupleColumnType::kSwitch);
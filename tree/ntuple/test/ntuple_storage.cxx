@@ -223,6 +223,43 @@ TEST(RNTuple, PageFilling)
    EXPECT_EQ(3u, prY.GetPageInfos()[1].GetNElements());
 }
 
+TEST(RNTuple, AdaptivePageSizes)
+{
+   FileRaii fileGuard("test_ntuple_adaptive_page_sizes.root");
+
+   RNTupleWriteOptions options;
+   EXPECT_THROW(options.SetApproxZippedPageSize(0), ROOT::RException);
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fldX = model->MakeField<std::uint64_t>("x");
+
+      options.SetEnableAdaptivePageSizes(true);
+      options.SetApproxZippedPageSize(4 * 1024);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      writer->EnableMetrics();
+      // Three clusters of incompressible data; after the first cluster, the column has seen enough data to
+      // retune its page size limit down towards the target zipped page size
+      std::uint64_t entry = 0;
+      for (int cluster = 0; cluster < 3; ++cluster) {
+         for (std::uint64_t i = 0; i < 200000; ++i, ++entry) {
+            *fldX = entry * 0x9e3779b97f4a7c15u;
+            writer->Fill();
+         }
+         writer->CommitCluster();
+      }
+      auto *counter = writer->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.nAdaptivePageSizeUpdates");
+      ASSERT_FALSE(counter == nullptr);
+      EXPECT_GT(counter->GetValueAsInt(), 0);
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(600000u, reader->GetNEntries());
+   auto x = reader->GetModel().GetDefaultEntry().GetPtr<std::uint64_t>("x");
+   reader->LoadEntry(599999);
+   EXPECT_EQ(599999u * 0x9e3779b97f4a7c15u, *x);
+}
+
 TEST(RNTuple, PageFillingString)
 {
    FileRaii fileGuard("test_ntuple_page_filling_string.root");
@@ -0,0 +1,91 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleStringDictionary, Basic)
+{
+   FileRaii fileGuard("test_ntuple_string_dictionary_basic.root");
+
+   const std::vector<std::string> labels = {"electron", "muon", "electron", "tau", "muon", "electron"};
+   {
+      auto model = RNTupleModel::Create();
+      auto fld = model->MakeField<std::string>("label");
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (const auto &label : labels) {
+         *fld = label;
+         ntuple->Fill();
+      }
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+   auto dict = RNTupleStringDictionary::Create("label");
+   dict->Add(*pageSource);
+
+   // Codes are assigned in first-appearance order
+   EXPECT_EQ(3u, dict->GetNValues());
+   EXPECT_EQ(0u, dict->LookupCode("electron"));
+   EXPECT_EQ(1u, dict->LookupCode("muon"));
+   EXPECT_EQ(2u, dict->LookupCode("tau"));
+   EXPECT_EQ(RNTupleStringDictionary::kInvalidCode, dict->LookupCode("jet"));
+
+   ASSERT_EQ(labels.size(), dict->GetEntryCodes().size());
+   for (unsigned i = 0; i < labels.size(); ++i) {
+      EXPECT_EQ(dict->LookupCode(labels[i]), dict->GetCode(i));
+      EXPECT_EQ(labels[i], dict->GetValue(dict->GetCode(i)));
+   }
+}
+
+TEST(RNTupleStringDictionary, MultipleSources)
+{
+   FileRaii fileGuard1("test_ntuple_string_dictionary_sources1.root");
+   FileRaii fileGuard2("test_ntuple_string_dictionary_sources2.root");
+
+   for (const auto *path : {fileGuard1.GetPath().c_str(), fileGuard2.GetPath().c_str()}) {
+      auto model = RNTupleModel::Create();
+      auto fld = model->MakeField<std::string>("label");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path);
+      // The second file introduces "down" but shares "up" with the first one
+      *fld = (path == fileGuard1.GetPath()) ? "up" : "down";
+      ntuple->Fill();
+      *fld = "up";
+      ntuple->Fill();
+   }
+
+   auto dict = RNTupleStringDictionary::Create("label");
+   auto pageSource1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+   auto pageSource2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+   dict->Add(*pageSource1).Add(*pageSource2);
+
+   // Codes must be stable across the chain of sources
+   EXPECT_EQ(2u, dict->GetNValues());
+   const auto upCode = dict->LookupCode("up");
+   const auto downCode = dict->LookupCode("down");
+   EXPECT_EQ((std::vector<RNTupleStringDictionary::Code_t>{upCode, upCode, downCode, upCode}),
+             dict->GetEntryCodes());
+}
+
+TEST(RNTupleStringDictionary, InvalidField)
+{
+   FileRaii fileGuard("test_ntuple_string_dictionary_invalid.root");
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<float>("fldFloat") = 1.f;
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      ntuple->Fill();
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+
+   try {
+      RNTupleStringDictionary::Create("fldFloat")->Add(*pageSource);
+      FAIL() << "non-string fields should not be allowed in string dictionaries";
+   } catch (const ROOT::RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("only std::string fields are supported"));
+   }
+
+   try {
+      RNTupleStringDictionary::Create("fldMissing")->Add(*pageSource);
+      FAIL() << "fields not present in the RNTuple should cause an error";
+   } catch (const ROOT::RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("could not find field \"fldMissing\""));
+   }
+}
@@ -10,6 +10,8 @@
 #include <ROOT/RNTupleFillStatus.hxx>
 #include <ROOT/RNTupleJoinTable.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleStringDictionary.hxx>
+#include <ROOT/RNTupleZoneMap.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleReadOptions.hxx>
@@ -85,6 +87,8 @@ using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
 using RNTupleReader = ROOT::RNTupleReader;
 using RNTupleReadOptions = ROOT::RNTupleReadOptions;
 using RNTupleWriter = ROOT::RNTupleWriter;
+using RNTupleStringDictionary = ROOT::Experimental::Internal::RNTupleStringDictionary;
+using RNTupleZoneMap = ROOT::Experimental::Internal::RNTupleZoneMap;
 using RNTupleWriteOptions = ROOT::RNTupleWriteOptions;
 using RNTupleWriteOptionsDaos = ROOT::Experimental::RNTupleWriteOptionsDaos;
 using RNTupleMetrics = ROOT::Experimental::Detail::RNTupleMetrics;
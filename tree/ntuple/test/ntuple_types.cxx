@@ -1732,6 +1732,59 @@ TEST(RNTuple, HalfPrecisionFloat)
    EXPECT_FLOAT_EQ(0.0f, (*fVec)[3]);
 }
 
+TEST(RNTuple, BrainFloat)
+{
+   FileRaii fileGuard("test_ntuple_brain_float.root");
+
+   auto f1Fld = RFieldBase::Create("f1", "float").Unwrap();
+   dynamic_cast<RField<float> *>(f1Fld.get())->SetBFloat16();
+   EXPECT_EQ(ROOT::ENTupleColumnType::kBFloat16, f1Fld->GetColumnRepresentatives()[0][0]);
+   EXPECT_EQ("float", f1Fld->GetTypeName());
+
+   auto fVecFld = RFieldBase::Create("fVec", "std::vector<float>").Unwrap();
+   dynamic_cast<RField<float> *>(fVecFld->GetMutableSubfields()[0])->SetBFloat16();
+   EXPECT_EQ(ROOT::ENTupleColumnType::kBFloat16, fVecFld->GetConstSubfields()[0]->GetColumnRepresentatives()[0][0]);
+
+   auto model = RNTupleModel::Create();
+   model->AddField(std::move(f1Fld));
+   model->AddField(std::move(fVecFld));
+
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto f1 = writer->GetModel().GetDefaultEntry().GetPtr<float>("f1");
+      auto fVec = writer->GetModel().GetDefaultEntry().GetPtr<std::vector<float>>("fVec");
+      *f1 = 0.1f;
+      *fVec = {0.1f, 0.2f};
+      writer->Fill();
+      *f1 = 4245.5f;
+      *fVec = {std::numeric_limits<float>::max(), std::numeric_limits<float>::min(),
+               std::numeric_limits<float>::lowest(), std::numeric_limits<float>::denorm_min()};
+      writer->Fill();
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+
+   EXPECT_EQ(4, ROOT::Internal::RColumnElementBase::Generate(ROOT::ENTupleColumnType::kBFloat16)->GetSize());
+
+   const auto &desc = reader->GetDescriptor();
+   EXPECT_EQ(ROOT::ENTupleColumnType::kBFloat16, (*desc.GetColumnIterable(desc.FindFieldId("f1")).begin()).GetType());
+
+   auto f1 = reader->GetModel().GetDefaultEntry().GetPtr<float>("f1");
+   auto fVec = reader->GetModel().GetDefaultEntry().GetPtr<std::vector<float>>("fVec");
+   reader->LoadEntry(0);
+   EXPECT_FLOAT_EQ(0.10009765625f, *f1);
+   EXPECT_FLOAT_EQ(0.10009765625f, (*fVec)[0]);
+   EXPECT_FLOAT_EQ(0.2001953125f, (*fVec)[1]);
+   reader->LoadEntry(1);
+   EXPECT_FLOAT_EQ(4256.f, *f1);
+   // unlike fp16, bfloat16 keeps the full float exponent range: the normal
+   // limits survive the round trip and only the denormal flushes to zero
+   EXPECT_FLOAT_EQ(INFINITY, (*fVec)[0]);
+   EXPECT_FLOAT_EQ(std::numeric_limits<float>::min(), (*fVec)[1]);
+   EXPECT_FLOAT_EQ(-INFINITY, (*fVec)[2]);
+   EXPECT_FLOAT_EQ(0.0f, (*fVec)[3]);
+}
+
 TEST(RNTuple, Double32)
 {
    FileRaii fileGuard("test_ntuple_double32.root");
@@ -57,6 +57,48 @@ TEST(RNTuple, View)
    EXPECT_EQ(3, n);
 }
 
+TEST(RNTuple, ViewBulk)
+{
+   FileRaii fileGuard("test_ntuple_view_bulk.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; i++) {
+         *fieldPt = static_cast<float>(i);
+         writer->Fill();
+         if (i == 59)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = reader->GetView<float>("pt");
+   const auto nEntries = viewPt.GetFieldRange().size();
+   EXPECT_EQ(100U, nEntries);
+
+   ROOT::NTupleSize_t i = 0;
+   int nBulks = 0;
+   while (i < nEntries) {
+      auto bulk = viewPt.GetBulk(i, nEntries - i);
+      // Bulks must not cross the cluster boundary after entry 59
+      EXPECT_EQ((nBulks == 0) ? 60U : 40U, bulk.size());
+      for (float x : bulk) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i), x);
+         i++;
+      }
+      nBulks++;
+   }
+   EXPECT_EQ(2, nBulks);
+
+   // Read a subrange in the middle of the first cluster
+   auto bulk = viewPt.GetBulk(10, 20);
+   ASSERT_EQ(20U, bulk.size());
+   EXPECT_FLOAT_EQ(10.f, bulk[0]);
+   EXPECT_FLOAT_EQ(29.f, bulk[19]);
+}
+
 TEST(RNTuple, CollectionView)
 {
    FileRaii fileGuard("test_ntuple_collection_view.root");
@@ -0,0 +1,116 @@
+#include "ntuple_test.hxx"
+#include "CustomStruct.hxx"
+
+TEST(RNTupleZoneMap, Basic)
+{
+   FileRaii fileGuard("test_ntuple_zone_map_basic.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fld = model->MakeField<float>("fld");
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+
+      // Three clusters of 10 entries with disjoint value ranges: [0, 9], [100, 109], [200, 209]
+      for (int cluster = 0; cluster < 3; ++cluster) {
+         for (int i = 0; i < 10; ++i) {
+            *fld = cluster * 100.f + i;
+            ntuple->Fill();
+         }
+         ntuple->CommitCluster();
+      }
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+   auto zoneMap = RNTupleZoneMap::Create({"fld"});
+   zoneMap->Add(*pageSource);
+
+   const auto &zones = zoneMap->GetZones("fld");
+   ASSERT_EQ(3u, zones.size());
+   for (unsigned i = 0; i < zones.size(); ++i) {
+      EXPECT_EQ(i * 10, zones[i].fFirstEntry);
+      EXPECT_EQ(10u, zones[i].fNEntries);
+      EXPECT_FLOAT_EQ(i * 100.f, zones[i].fMin);
+      EXPECT_FLOAT_EQ(i * 100.f + 9.f, zones[i].fMax);
+   }
+
+   // A cut fully inside the second cluster's value range selects only that cluster
+   auto ranges = zoneMap->GetCandidateRanges("fld", 105., 107.);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(10u, *ranges[0].begin());
+   EXPECT_EQ(10u, ranges[0].size());
+
+   // A cut spanning the first two clusters merges their adjacent entry ranges
+   ranges = zoneMap->GetCandidateRanges("fld", 5., 105.);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(0u, *ranges[0].begin());
+   EXPECT_EQ(20u, ranges[0].size());
+
+   // A cut that only the last cluster's value range can satisfy skips the first two clusters
+   ranges = zoneMap->GetCandidateRanges("fld", 200., 300.);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(20u, *ranges[0].begin());
+   EXPECT_EQ(10u, ranges[0].size());
+
+   // A cut outside all value ranges selects nothing
+   ranges = zoneMap->GetCandidateRanges("fld", 500., 600.);
+   EXPECT_TRUE(ranges.empty());
+}
+
+TEST(RNTupleZoneMap, InvalidTypes)
+{
+   FileRaii fileGuard("test_ntuple_zone_map_invalid_types.root");
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<float>("fldFloat") = 2.5;
+      *model->MakeField<std::string>("fldString") = "foo";
+      *model->MakeField<CustomStruct>("fldStruct") =
+         CustomStruct{0.1, {2.f, 4.f}, {{1.f}, {3.f, 5.f}}, "bar", std::byte(8)};
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      ntuple->Fill();
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+
+   try {
+      RNTupleZoneMap::Create({"fldString"})->Add(*pageSource);
+      FAIL() << "non-numeric fields should not be allowed in zone maps";
+   } catch (const ROOT::RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("only integral and floating-point types are allowed"));
+   }
+
+   try {
+      RNTupleZoneMap::Create({"fldStruct"})->Add(*pageSource);
+      FAIL() << "non-numeric fields should not be allowed in zone maps";
+   } catch (const ROOT::RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("only integral and floating-point types are allowed"));
+   }
+}
+
+TEST(RNTupleZoneMap, MissingField)
+{
+   FileRaii fileGuard("test_ntuple_zone_map_missing_field.root");
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<float>("fld") = 1.f;
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      ntuple->Fill();
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+   auto zoneMap = RNTupleZoneMap::Create({"fldMissing"});
+
+   try {
+      zoneMap->Add(*pageSource);
+      FAIL() << "fields not present in the RNTuple should cause an error";
+   } catch (const ROOT::RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("could not find field \"fldMissing\""));
+   }
+
+   try {
+      zoneMap->GetZones("fldMissing");
+      FAIL() << "querying a field without collected statistics should cause an error";
+   } catch (const ROOT::RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("no zone statistics collected"));
+   }
+}
@@ -16,17 +16,28 @@
 
 #include "ReadSpeed.hxx"
 
+#include <string>
 #include <vector>
 
 namespace ReadSpeed {
 
 void PrintThroughput(const Result &r);
+/// Print the result as a flat JSON object, suitable for archival and for --compare.
+void PrintThroughputJson(const Result &r);
+/// Compare two runs saved with --json; return a non-zero exit code if the new run
+/// is slower than the reference by more than thresholdPct percent.
+int CompareRuns(const std::string &refFileName, const std::string &newFileName, double thresholdPct);
 
 struct Args {
    Data fData;
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   bool fJsonOutput = false;
+   /// When two file names are given with --compare, diff the two saved runs instead of measuring.
+   std::vector<std::string> fCompareFiles;
+   /// Maximum tolerated throughput regression for --compare, in percent.
+   double fCompareThreshold = 10.;
 };
 
 Args ParseArgs(const std::vector<std::string> &args);
@@ -14,8 +14,12 @@
 #include <ROOT/TTreeProcessorMT.hxx> // for TTreeProcessorMT::SetTasksPerWorkerHint
 #endif
 
-#include <iostream>
 #include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
 
 using namespace ReadSpeed;
 
@@ -26,6 +30,8 @@ const auto usageText = "Usage:\n"
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
                        "               [--tasks-per-worker ntasks]\n"
+                       "               [--json]\n"
+                       " rootreadspeed --compare reference.json new.json [--threshold percent]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
                        " Use -h for usage help, --help for detailed information.\n";
@@ -57,7 +63,17 @@ const auto argUsageText =
    "      The number of threads to use for file reading. Will automatically cap to the number of available threads on "
    "the machine.\n"
    "    --tasks-per-worker ntasks\n"
-   "      The number of tasks to generate for each worker thread when using multithreading.";
+   "      The number of tasks to generate for each worker thread when using multithreading.\n"
+   "    --json\n"
+   "      Print the results as a flat JSON object instead of the human-readable report, e.g. for archival\n"
+   "      in release validation. The JSON object is the last block printed on stdout.\n"
+   "\n"
+   "  Comparing runs:\n"
+   "    --compare reference.json new.json\n"
+   "      Instead of measuring, compare two runs saved with --json and report the throughput change.\n"
+   "      Exits with a non-zero status if the new run is slower than the reference by more than the threshold.\n"
+   "    --threshold percent\n"
+   "      The maximum tolerated throughput regression for --compare, in percent (default 10).";
 
 const auto fullUsageText =
    "Description:\n"
@@ -164,6 +180,79 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "For details run with the --help command.\n";
 }
 
+void ReadSpeed::PrintThroughputJson(const Result &r)
+{
+   const unsigned int effectiveThreads = std::max(r.fThreadPoolSize, 1u);
+   const double cpuEfficiency = (r.fCpuTime / effectiveThreads) / r.fRealTime;
+
+   std::cout << "{\n";
+   std::cout << "  \"thread_pool_size\": " << r.fThreadPoolSize << ",\n";
+   std::cout << "  \"mt_setup_real_time_s\": " << r.fMTSetupRealTime << ",\n";
+   std::cout << "  \"mt_setup_cpu_time_s\": " << r.fMTSetupCpuTime << ",\n";
+   std::cout << "  \"real_time_s\": " << r.fRealTime << ",\n";
+   std::cout << "  \"cpu_time_s\": " << r.fCpuTime << ",\n";
+   std::cout << "  \"uncompressed_bytes_read\": " << r.fUncompressedBytesRead << ",\n";
+   std::cout << "  \"compressed_bytes_read\": " << r.fCompressedBytesRead << ",\n";
+   std::cout << "  \"uncompressed_throughput_mbs\": " << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 << ",\n";
+   std::cout << "  \"compressed_throughput_mbs\": " << r.fCompressedBytesRead / r.fRealTime / 1024 / 1024 << ",\n";
+   std::cout << "  \"cpu_efficiency\": " << cpuEfficiency << "\n";
+   std::cout << "}\n";
+}
+
+// Extract the numeric values of a flat JSON object saved with --json. This is
+// not a general JSON parser, it only needs to read back what
+// PrintThroughputJson writes.
+static std::map<std::string, double> ReadJsonMetrics(const std::string &fileName)
+{
+   std::ifstream in(fileName);
+   if (!in)
+      throw std::runtime_error("Could not open file '" + fileName + '\'');
+   std::stringstream buffer;
+   buffer << in.rdbuf();
+   const std::string content = buffer.str();
+
+   std::map<std::string, double> metrics;
+   const std::regex metricRegex("\"([a-z_]+)\"\\s*:\\s*(-?[0-9.eE+-]+)");
+   for (auto it = std::sregex_iterator(content.begin(), content.end(), metricRegex); it != std::sregex_iterator();
+        ++it) {
+      metrics[(*it)[1]] = std::stod((*it)[2]);
+   }
+   return metrics;
+}
+
+int ReadSpeed::CompareRuns(const std::string &refFileName, const std::string &newFileName, double thresholdPct)
+{
+   std::map<std::string, double> ref, run;
+   try {
+      ref = ReadJsonMetrics(refFileName);
+      run = ReadJsonMetrics(newFileName);
+   } catch (const std::exception &e) {
+      std::cerr << e.what() << '\n';
+      return 2;
+   }
+
+   int exitCode = 0;
+   for (const auto *metric : {"uncompressed_throughput_mbs", "compressed_throughput_mbs"}) {
+      const auto refIt = ref.find(metric);
+      const auto runIt = run.find(metric);
+      if (refIt == ref.end() || runIt == run.end() || refIt->second <= 0.) {
+         std::cerr << "Metric '" << metric << "' missing or invalid in one of the runs.\n";
+         exitCode = 2;
+         continue;
+      }
+      const double changePct = (runIt->second - refIt->second) / refIt->second * 100.;
+      std::cout << metric << ":\t" << refIt->second << " -> " << runIt->second << " MB/s (" << (changePct >= 0 ? "+" : "")
+                << changePct << "%)\n";
+      if (-changePct > thresholdPct) {
+         std::cout << "FAIL: '" << metric << "' regressed by more than " << thresholdPct << "%.\n";
+         exitCode = 1;
+      }
+   }
+   if (exitCode == 0)
+      std::cout << "OK: no throughput regression above " << thresholdPct << "%.\n";
+   return exitCode;
+}
+
 Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 {
    // Print help message and exit if "--help"
@@ -184,8 +273,20 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 
    Data d;
    unsigned int nThreads = 0;
+   bool jsonOutput = false;
+   std::vector<std::string> compareFiles;
+   double compareThreshold = 10.;
 
-   enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
+   enum class EArgState {
+      kNone,
+      kTrees,
+      kFiles,
+      kBranches,
+      kThreads,
+      kTasksPerWorkerHint,
+      kCompare,
+      kThreshold
+   } argState = EArgState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
    const auto branchOptionsErrMsg =
       "Options --all-branches, --branches, and --branches-regex are mutually exclusive. You can use only one.\n";
@@ -225,6 +326,13 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
          argState = EArgState::kThreads;
       } else if (arg == "--tasks-per-worker") {
          argState = EArgState::kTasksPerWorkerHint;
+      } else if (arg == "--json") {
+         argState = EArgState::kNone;
+         jsonOutput = true;
+      } else if (arg == "--compare") {
+         argState = EArgState::kCompare;
+      } else if (arg == "--threshold") {
+         argState = EArgState::kThreshold;
       } else if (arg[0] == '-') {
          std::cerr << "Unrecognized option '" << arg << "'\n";
          return {};
@@ -237,6 +345,11 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
             nThreads = std::stoi(arg);
             argState = EArgState::kNone;
             break;
+         case EArgState::kCompare: compareFiles.emplace_back(arg); break;
+         case EArgState::kThreshold:
+            compareThreshold = std::stod(arg);
+            argState = EArgState::kNone;
+            break;
          case EArgState::kTasksPerWorkerHint:
 #ifdef R__USE_IMT
             ROOT::TTreeProcessorMT::SetTasksPerWorkerHint(std::stoi(arg));
@@ -251,7 +364,14 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   if (!compareFiles.empty() && compareFiles.size() != 2) {
+      std::cerr << "Option --compare expects exactly two file names.\n";
+      return {};
+   }
+
+   return Args{std::move(d),        nThreads,         branchState == EBranchState::kAll,
+               /*fShouldRun=*/true, jsonOutput,       std::move(compareFiles),
+               compareThreshold};
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
@@ -12,6 +12,8 @@
 #include "TSystem.h"
 #include "TTree.h"
 
+#include <fstream>
+
 using namespace ReadSpeed;
 
 // Helper function to generate a .root file with some dummy data in it.
@@ -202,6 +204,68 @@ TEST(ReadSpeedCLI, NoArgs)
    EXPECT_TRUE(!parsedArgs.fShouldRun) << "Program running when not using any arguments";
 }
 
+TEST(ReadSpeedCLI, JsonArg)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--branches", "x", "--json",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_TRUE(parsedArgs.fJsonOutput) << "JSON output not enabled by --json";
+}
+
+TEST(ReadSpeedCLI, CompareArgs)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--compare", "reference.json", "new.json", "--threshold", "5",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   ASSERT_EQ(parsedArgs.fCompareFiles.size(), 2u) << "Wrong number of files parsed for --compare";
+   EXPECT_EQ(parsedArgs.fCompareFiles[0], "reference.json");
+   EXPECT_EQ(parsedArgs.fCompareFiles[1], "new.json");
+   EXPECT_DOUBLE_EQ(parsedArgs.fCompareThreshold, 5.);
+}
+
+TEST(ReadSpeedCLI, CompareWrongNumberOfFiles)
+{
+   const std::vector<std::string> allArgs{"root-readspeed", "--compare", "reference.json"};
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(!parsedArgs.fShouldRun) << "Program running with an incomplete --compare option";
+}
+
+TEST(ReadSpeedCLI, CompareRuns)
+{
+   auto writeRun = [](const std::string &fname, double uncompressedMbs, double compressedMbs) {
+      std::ofstream out(fname);
+      out << "{\n";
+      out << "  \"uncompressed_throughput_mbs\": " << uncompressedMbs << ",\n";
+      out << "  \"compressed_throughput_mbs\": " << compressedMbs << "\n";
+      out << "}\n";
+   };
+
+   writeRun("readspeed_ref.json", 1000., 100.);
+   writeRun("readspeed_same.json", 980., 99.);
+   writeRun("readspeed_slow.json", 500., 50.);
+
+   EXPECT_EQ(CompareRuns("readspeed_ref.json", "readspeed_same.json", 10.), 0)
+      << "Comparison failing for a run within the threshold";
+   EXPECT_EQ(CompareRuns("readspeed_ref.json", "readspeed_slow.json", 10.), 1)
+      << "Comparison passing for a run well below the threshold";
+   EXPECT_EQ(CompareRuns("readspeed_ref.json", "readspeed_missing.json", 10.), 2)
+      << "Comparison not reporting a missing input file";
+
+   gSystem->Unlink("readspeed_ref.json");
+   gSystem->Unlink("readspeed_same.json");
+   gSystem->Unlink("readspeed_slow.json");
+}
+
 TEST(ReadSpeedCLI, InvalidArgs)
 {
    const std::vector<std::string> allArgs{
@@ -31,6 +31,9 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <atomic>
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -72,10 +75,14 @@ class TBulkBranchRead {
 public:
    /// See TBranch::GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
+   /// See TBranch::GetBulkEntriesAndOffsets(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
+   Int_t GetBulkEntriesAndOffsets(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   /// See TBranch::GetEntriesSerializedAndOffsets(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
+   Int_t GetEntriesSerializedAndOffsets(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    /// Return true if the branch can be read through the bulk interfaces.
    bool SupportsBulkRead() const;
 
@@ -131,6 +138,7 @@ protected:
    Long64_t    fFirstBasketEntry; ///<! First entry in the current basket.
    Long64_t    fNextBasketEntry;  ///<! Next entry that will requires us to go to the next basket
    TBasket    *fCurrentBasket;    ///<! Pointer to the current basket.
+   std::atomic<Int_t> fPendingBasketWrites{0}; ///<! Number of in-flight asynchronous basket writes (see TTree::SetAsyncBasketFlush)
    Long64_t    fEntries;          ///<  Number of entries
    Long64_t    fFirstEntry;       ///<  Number of the first entry in this branch
    Long64_t    fTotBytes;         ///<  Total number of bytes in all leaves before compression
@@ -153,6 +161,7 @@ protected:
    BulkObj     fBulk;             ///<! Helper for performing bulk IO
 
    bool        fSkipZip;          ///<! After being read, the buffer will not be unzipped.
+   bool        fAdaptiveCompression; ///<! If true, compression settings are chosen from trials on the first flushed basket
 
    using CacheInfo_t = ROOT::Internal::TBranchCacheInfo;
    CacheInfo_t fCacheInfo;        ///<! Hold info about which basket are in the cache and if they have been retrieved from the cache.
@@ -182,9 +191,13 @@ private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntriesAndOffsets(Long64_t, TBuffer&, std::vector<Int_t>&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   Int_t    GetEntriesSerializedAndOffsets(Long64_t, TBuffer&, std::vector<Int_t>&);
+   Int_t    GetEntriesAndOffsetsImpl(Long64_t, TBuffer&, std::vector<Int_t>&, TLeaf *swapLeaf);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
+   void     ChooseCompressionSettings(TBasket &basket);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
@@ -269,6 +282,8 @@ public:
    virtual void      ResetReadEntry() {fReadEntry = -1;}
    virtual void      SetAddress(void *add);
    virtual void      SetObject(void *objadd);
+           void      SetAdaptiveCompression(bool adaptive = true) { fAdaptiveCompression = adaptive; }
+           bool      GetAdaptiveCompression() const { return fAdaptiveCompression; }
    virtual void      SetAutoDelete(bool autodel=true);
    virtual void      SetBasketSize(Int_t buffsize);
    virtual void      SetBufferAddress(TBuffer *entryBuffer);
@@ -318,8 +333,10 @@ namespace Experimental {
 namespace Internal {
 
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntriesAndOffsets(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetBulkEntriesAndOffsets(evt, user_buf, offsets); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetEntriesSerializedAndOffsets(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetEntriesSerializedAndOffsets(evt, user_buf, offsets); }
 inline bool   TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
 
 }  // Internal
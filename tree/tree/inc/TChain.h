@@ -23,7 +23,11 @@
 
 #include "TTree.h"
 
+#include <utility>
+#include <vector>
+
 class TFile;
+class TFileOpenHandle;
 class TBrowser;
 class TCut;
 class TEntryList;
@@ -43,6 +47,8 @@ protected:
    TObjArray   *fFiles;            ///< -> List of file names containing the trees (TChainElement, owned)
    TList       *fStatus;           ///< -> List of active/inactive branches (TChainElement, owned)
    bool         fGlobalRegistration;  ///<! if true, bypass use of global lists
+   Int_t        fAsyncOpenAhead;      ///<! Number of upcoming chain elements to open asynchronously ahead of the event loop
+   std::vector<std::pair<Int_t, TFileOpenHandle *>> fAsyncOpenHandles; ///<! Pending asynchronous open requests, as (tree number, handle) pairs
 
 private:
    TChain(const TChain&);            // not implemented
@@ -52,6 +58,9 @@ private:
 
 protected:
    void InvalidateCurrentTree();
+   TFileOpenHandle *ClaimAsyncOpenHandle(Int_t treenum);
+   void AsyncOpenUpcomingFiles(Int_t treenum);
+   void ClearAsyncOpenRequests();
 
    // Called when setting the branch address of friends. In the case of TChain, the TChainElement for branch
    // 'bname' is created calling IsDelayed, to avoid missing branch errors when connecting it to the trees
@@ -97,6 +106,7 @@ public:
    bool      GetBranchStatus(const char* branchname) const override;
    Long64_t  GetCacheSize() const override { return fTree ? fTree->GetCacheSize() : fCacheSize; }
    Long64_t  GetChainEntryNumber(Long64_t entry) const override;
+           Int_t     GetAsyncOpenAhead() const { return fAsyncOpenAhead; }
    TClusterIterator GetClusterIterator(Long64_t firstentry) override;
            Int_t     GetNtrees() const { return fNtrees; }
    Long64_t  GetEntries() const override;
@@ -144,6 +154,7 @@ public:
    void      ResetBranchAddresses() override;
    void      SavePrimitive (std::ostream &out, Option_t *option="") override;
    Long64_t  Scan(const char *varexp="", const char *selection="", Option_t *option="", Long64_t nentries=kMaxEntries, Long64_t firstentry=0) override; // *MENU*
+   virtual void      SetAsyncOpenAhead(Int_t nfiles = 2);
    virtual void      SetAutoDelete(bool autodel=true);
    Int_t     SetBranchAddress(const char *bname,void *add, TBranch **ptr = nullptr) override;
    Int_t     SetBranchAddress(const char *bname,void *add, TBranch **ptr, TClass *realClass, EDataType datatype, bool isptr) override;
@@ -67,8 +67,10 @@ class TEntryListBlock:public TObject
    bool    Enter(Int_t entry);
    bool    Remove(Int_t entry);
    Int_t   Contains(Int_t entry);
+   Int_t   ContainsRange(Int_t entrymin, Int_t entrymax);
    void    OptimizeStorage();
    Int_t   Merge(TEntryListBlock *block);
+   Int_t   Subtract(TEntryListBlock *block);
    Int_t   Next();
    Int_t   GetEntry(Int_t entry);
    void    ResetIndices() {fLastIndexQueried = -1, fLastIndexReturned = -1;}
@@ -50,6 +50,7 @@ class TList;
 
 #include <array>
 #include <atomic>
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -169,6 +170,8 @@ private:
    mutable bool fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   bool fAsyncBasketFlush{false};               ///<! True if full baskets are compressed and written by tasks outliving Fill.
+   std::unique_ptr<ROOT::Internal::TBranchIMTHelper> fAsyncFlushHelper; ///<! Task group shared by the asynchronous basket writes.
 
    std::unordered_map<std::string, TBranch *>
       fNamesToBranches; ///<! maps names to their branches, useful when retrieving branches by name
@@ -552,6 +555,7 @@ public:
    virtual const char     *GetFriendAlias(TTree*) const;
            TH1            *GetHistogram() { return GetPlayer()->GetHistogram(); }
    virtual bool            GetImplicitMT() { return fIMTEnabled; }
+           bool            GetAsyncBasketFlush() const { return fAsyncBasketFlush; }
    virtual Int_t          *GetIndex() { return &fIndex.fArray[0]; }
    virtual Double_t       *GetIndexValues() { return &fIndexValues.fArray[0]; }
            ROOT::TIOFeatures GetIOFeatures() const;
@@ -652,6 +656,7 @@ public:
    virtual void            ResetBranchAddress(TBranch *);
    virtual void            ResetBranchAddresses();
    virtual Long64_t        Scan(const char* varexp = "", const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
+   virtual void            SetAdaptiveCompression(const char *bname = "*", bool adaptive = true);
    virtual bool            SetAlias(const char* aliasName, const char* aliasFormula);
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
@@ -693,6 +698,7 @@ public:
    virtual void            SetEventList(TEventList* list);
    virtual void            SetEntryList(TEntryList* list, Option_t *opt="");
    virtual void            SetImplicitMT(bool enabled) { fIMTEnabled = enabled; }
+   virtual void            SetAsyncBasketFlush(bool enabled = true);
    virtual void            SetMakeClass(Int_t make);
    virtual void            SetMaxEntryLoop(Long64_t maxev = kMaxEntries) { fMaxEntryLoop = maxev; } // *MENU*
    static  void            SetMaxTreeSize(Long64_t maxsize = 100000000000LL);
@@ -733,6 +739,7 @@ public:
    virtual Int_t           StopCacheLearningPhase();
    virtual Int_t           UnbinnedFit(const char* funcname, const char* varexp, const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0);
            void            UseCurrentStyle() override;
+           void            WaitAsyncBaskets();
            Int_t           Write(const char *name=nullptr, Int_t option=0, Int_t bufsize=0) override;
            Int_t           Write(const char *name=nullptr, Int_t option=0, Int_t bufsize=0) const override;
 
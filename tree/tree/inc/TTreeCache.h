@@ -27,6 +27,7 @@
 
 class TTree;
 class TBranch;
+class TEntryList;
 class TObjArray;
 
 class TTreeCache : public TFileCacheRead {
@@ -51,6 +52,7 @@ protected:
    TObjArray   *fBranches{nullptr};   ///<! List of branches to be stored in the cache
    TList       *fBrNames{nullptr};    ///<! list of branch names in the cache
    TTree       *fTree{nullptr};       ///<! pointer to the current Tree
+   TEntryList  *fEntryList{nullptr};  ///<! entry list used to skip baskets without any selected entry (not owned)
    bool         fIsLearning{true};   ///<! true if cache is in learning mode
    bool         fIsManual{false};    ///<! true if cache is StopLearningPhase was used
    bool         fFirstBuffer{true};  ///<! true if first buffer is used for prefetching
@@ -142,6 +144,7 @@ public:
    Double_t             GetEfficiencyRel() const;
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
    virtual Int_t        GetEntryMax() const {return fEntryMax;}
+   TEntryList          *GetEntryList() const {return fEntryList;}
    static Int_t         GetLearnEntries();
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
@@ -163,6 +166,7 @@ public:
    void                 ResetMissCache(); // Reset the miss cache.
    void                 SetAutoCreated(bool val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Long64_t buffersize) override;
+   virtual void         SetEntryList(TEntryList *enlist) {fEntryList = enlist;}
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
    void                 SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect) override;
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
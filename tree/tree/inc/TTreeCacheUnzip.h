@@ -51,6 +51,7 @@ protected:
       std::unique_ptr<char[]> *fUnzipChunks;     ///<! [fNseek] Individual unzipped chunks. Their summed size is kept under control.
       std::vector<Int_t>       fUnzipLen;        ///<! [fNseek] Length of the unzipped buffers
       std::atomic<Byte_t>     *fUnzipStatus;     ///<! [fNSeek]
+      std::atomic<Long64_t>    fTotalSize{0};    ///<! Summed size of the unzipped chunks currently held
 
       UnzipState() {
          fUnzipChunks = nullptr;
@@ -61,6 +62,7 @@ protected:
          if (fUnzipStatus) delete [] fUnzipStatus;
       }
       void   Clear(Int_t size);
+      Long64_t GetTotalSize() const { return fTotalSize.load(); }
       bool   IsUntouched(Int_t index) const;
       bool   IsProgress(Int_t index) const;
       bool   IsFinished(Int_t index) const;
@@ -52,6 +52,7 @@ protected:
    TSQLServer            *fServer;
    bool                   fBranchChecked;
    TSQLTableInfo         *fTableInfo;
+   Int_t                  fFetchBatchSize;  ///<! Rows per window query when seeking, 0 = scan the full result set
 
    void                   CheckBasket(TBranch *tb);
    bool                   CheckBranch(TBranch *tb);
@@ -86,6 +87,8 @@ public:
    Long64_t       GetEntries() const override;
    Long64_t               GetEntries(const char *sel) override { return TTree::GetEntries(sel); }
    Long64_t               GetEntriesFast()const override;
+   Int_t                  GetFetchBatchSize() const { return fFetchBatchSize; }
+   void                   SetFetchBatchSize(Int_t size) { fFetchBatchSize = size; }
    TString                GetTableName(){ return fTable; }
    Long64_t       LoadTree(Long64_t entry) override;
    virtual Long64_t       PrepEntry(Long64_t entry);
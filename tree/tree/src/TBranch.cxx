@@ -38,6 +38,7 @@
 #include "TLeafS.h"
 #include "TMessage.h"
 #include "TROOT.h"
+#include "TStopwatch.h"
 #include "TSystem.h"
 #include "TMath.h"
 #include "TTree.h"
@@ -52,6 +53,8 @@
 #include "TBranchIMTHelper.h"
 
 #include "ROOT/TIOFeatures.hxx"
+#include "RZip.h"
+#include "Compression.h"
 
 #include <atomic>
 #include <cstddef>
@@ -124,6 +127,7 @@ TBranch::TBranch()
 , fBrowsables(nullptr)
 , fBulk(*this)
 , fSkipZip(false)
+, fAdaptiveCompression(false)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -237,6 +241,7 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fBrowsables(nullptr)
 , fBulk(*this)
 , fSkipZip(false)
+, fAdaptiveCompression(false)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -291,6 +296,7 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fBrowsables(nullptr)
 , fBulk(*this)
 , fSkipZip(false)
+, fAdaptiveCompression(false)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -1684,6 +1690,184 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Read a basket of variable-sized events into the given buffer with
+///        byte swapping, together with the entry boundaries.
+///
+/// \return On success, the number of events held by this branch that have been
+///         read into the buffer. -1 on failure.
+///
+/// On success, `offsets` holds `N + 1` values (with `N` the return value): the
+/// byte offset of each entry's payload relative to `user_buf.GetCurrent()`,
+/// plus the end of the last entry. The values of entry `i` thus span the bytes
+/// `[offsets[i], offsets[i+1])` and contain
+/// `(offsets[i+1] - offsets[i]) / leaf->GetLenType()` elements of the type held
+/// by this branch. This supports the variable-sized branches that
+/// GetBulkEntries() cannot handle: leaf-list branches with a count leaf and the
+/// member branches of split collections (e.g. the values branch of a split
+/// `std::vector<float>`), whose baskets store an entry-offset table next to a
+/// payload of raw values.
+///
+/// Branches whose payload interleaves per-entry metadata with the values (e.g.
+/// unsplit collection branches, whose deserialization is external) are not
+/// supported; see TBranch::GetEntriesSerializedAndOffsets() for those.
+///
+/// \note This interface is not meant to be exposed to end users, but rather it should
+///       be wrapped by higher-level interfaces.
+///
+Int_t TBranch::GetBulkEntriesAndOffsets(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   // TODO: eventually support multiple leaves.
+   if (R__unlikely(fNleaves != 1)) return -1;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   const auto dtype = leaf->GetDeserializeType();
+   if (R__unlikely(dtype != TLeaf::DeserializeType::kInPlace && dtype != TLeaf::DeserializeType::kZeroCopy)) {
+      // The payload is not a plain sequence of values that can be byteswapped wholesale.
+      return -1;
+   }
+
+   // Single-byte payloads need no swapping at all.
+   TLeaf *swapLeaf = (dtype == TLeaf::DeserializeType::kInPlace) ? leaf : nullptr;
+   return GetEntriesAndOffsetsImpl(entry, user_buf, offsets, swapLeaf);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Read a basket of variable-sized events into the given buffer without
+///        byte swapping, together with the entry boundaries.
+///
+/// \return On success, the number of events held by this branch that have been
+///         read into the buffer. -1 on failure.
+///
+/// Same contract as TBranch::GetBulkEntriesAndOffsets(), except that the
+/// payload is left serialized and the caller must deserialize each entry's
+/// byte range `[offsets[i], offsets[i+1])` itself. Because no in-place
+/// deserialization is attempted, this also works for branches with external
+/// deserialization, e.g. unsplit collection branches whose per-entry payload
+/// interleaves headers with the values.
+///
+/// \note This interface is not meant to be exposed to end users, but rather it should
+///       be wrapped by higher-level interfaces.
+///
+Int_t TBranch::GetEntriesSerializedAndOffsets(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   // TODO: eventually support multiple leaves.
+   if (R__unlikely(fNleaves != 1)) return -1;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   if (R__unlikely(leaf->GetDeserializeType() == TLeaf::DeserializeType::kDestructive)) {
+      Error("GetEntriesSerializedAndOffsets", "Encountered a branch with destructive deserialization; failing.");
+      return -1;
+   }
+
+   return GetEntriesAndOffsetsImpl(entry, user_buf, offsets, nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Common implementation of GetBulkEntriesAndOffsets and
+/// GetEntriesSerializedAndOffsets; it should not be called directly.
+///
+/// Reads the basket starting at `entry` into `user_buf`, fills `offsets` with
+/// the entry boundaries from the basket's entry-offset table and, if
+/// `swapLeaf` is non-null, byteswaps the whole payload in place as a sequence
+/// of `swapLeaf->GetLenType()`-sized elements.
+Int_t TBranch::GetEntriesAndOffsetsImpl(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets,
+                                        TLeaf *swapLeaf)
+{
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   bool enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) { return -1; }
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) { return -1; }
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) {
+       Error("GetEntriesAndOffsetsImpl", "Failed to read from full cluster; first entry is %lld; requested entry is %lld.\n", first, entry);
+       return -1;
+   }
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetEntriesAndOffsetsImpl", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetEntriesAndOffsetsImpl", "Basket has displacement.\n");
+      return -1;
+   }
+
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket]) {
+         // It is backed, so we can be destructive
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy, we can't return it as is to the user, just make a copy.
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   Int_t bufbegin = basket->GetKeylen();
+   user_buf.SetBufferOffset(bufbegin);
+
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+
+   // The entry-offset table maps each entry to its payload's byte offset within the
+   // basket buffer (the first entry starts right after the key). For fixed-size
+   // entries TBasket computes the table on the fly.
+   const Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffset)) {
+      Error("GetEntriesAndOffsetsImpl", "Basket has no entry-offset table.\n");
+      return -1;
+   }
+   offsets.resize(N + 1);
+   for (Int_t i = 0; i < N; ++i) {
+      offsets[i] = entryOffset[i] - bufbegin;
+   }
+   offsets[N] = basket->GetLast() - bufbegin;
+
+   if (swapLeaf) {
+      // Unlike ReadBasketFast, which multiplies the entry count by the leaf's static
+      // length, here the total number of elements follows from the payload size.
+      const Int_t lenType = swapLeaf->GetLenType();
+      const Long64_t payloadBytes = offsets[N] - offsets[0];
+      bool swapOk = true;
+      switch (lenType) {
+      case 1: break; // single bytes need no swapping
+      case 2: swapOk = user_buf.ByteSwapBuffer(payloadBytes / 2, kShort_t); break;
+      case 4: swapOk = user_buf.ByteSwapBuffer(payloadBytes / 4, kInt_t); break;
+      case 8: swapOk = user_buf.ByteSwapBuffer(payloadBytes / 8, kDouble_t); break;
+      default: swapOk = false; break;
+      }
+      if (R__unlikely(!swapOk)) {
+         Error("GetEntriesAndOffsetsImpl", "Leaf failed to read.\n");
+         return -1;
+      }
+      user_buf.SetBufferOffset(bufbegin);
+   }
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -3208,12 +3392,87 @@ void TBranch::Streamer(TBuffer& b)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Choose the compression settings of this branch from trial compressions of the
+/// given (full, not yet written) basket, see TBranch::SetAdaptiveCompression.
+///
+/// The serialized payload of the basket is compressed with a small candidate set
+/// of algorithm/level pairs and the candidate with the smallest output is locked
+/// in; among candidates within 5% of the smallest output the fastest one wins.
+/// The decision is recorded in the branch's persistent compression settings (so
+/// it is reproducible from the output file) and logged with Info.
+
+void TBranch::ChooseCompressionSettings(TBasket &basket)
+{
+   char *payload = basket.GetBufferRef()->Buffer() + basket.GetKeylen();
+   Int_t payloadLen = basket.GetBufferRef()->Length() - basket.GetKeylen();
+   if (payloadLen > kMAXZIPBUF)
+      payloadLen = kMAXZIPBUF;
+   if (payloadLen < 512) {
+      // Too small to be representative (and to gain anything): keep the current settings.
+      fAdaptiveCompression = false;
+      return;
+   }
+
+   struct Candidate {
+      ROOT::RCompressionSetting::EAlgorithm::EValues fAlgorithm;
+      Int_t fLevel;
+   };
+   const Candidate candidates[] = {
+      {ROOT::RCompressionSetting::EAlgorithm::kZLIB, ROOT::RCompressionSetting::ELevel::kDefaultOld},
+      {ROOT::RCompressionSetting::EAlgorithm::kLZ4, ROOT::RCompressionSetting::ELevel::kDefaultLZ4},
+      {ROOT::RCompressionSetting::EAlgorithm::kZSTD, ROOT::RCompressionSetting::ELevel::kDefaultZSTD},
+      {ROOT::RCompressionSetting::EAlgorithm::kZSTD, 9}};
+   constexpr auto kNCandidates = sizeof(candidates) / sizeof(candidates[0]);
+
+   std::vector<char> target(payloadLen + 64);
+   Int_t sizes[kNCandidates];
+   Double_t times[kNCandidates];
+   for (std::size_t i = 0; i < kNCandidates; ++i) {
+      Int_t srcsize = payloadLen;
+      Int_t tgtsize = payloadLen;
+      Int_t nout = 0;
+      TStopwatch sw;
+      sw.Start();
+      R__zipMultipleAlgorithm(candidates[i].fLevel, &srcsize, payload, &tgtsize, target.data(), &nout,
+                              candidates[i].fAlgorithm);
+      sw.Stop();
+      // nout == 0 means the payload did not compress with this candidate
+      sizes[i] = (nout > 0 && nout < payloadLen) ? nout : payloadLen;
+      times[i] = sw.RealTime();
+   }
+
+   // Smallest output wins; among candidates within 5% of the smallest, the fastest wins.
+   std::size_t best = 0;
+   for (std::size_t i = 1; i < kNCandidates; ++i)
+      if (sizes[i] < sizes[best])
+         best = i;
+   const Int_t tolerated = sizes[best] + sizes[best] / 20;
+   for (std::size_t i = 0; i < kNCandidates; ++i)
+      if (sizes[i] <= tolerated && times[i] < times[best])
+         best = i;
+
+   SetCompressionSettings(
+      ROOT::CompressionSettings(candidates[best].fAlgorithm, candidates[best].fLevel));
+   fAdaptiveCompression = false;
+
+   if (gDebug > 0 || (fTree && fTree->Debug())) {
+      const Double_t mbps = times[best] > 0 ? payloadLen / times[best] * 1e-6 : 0.;
+      Info("ChooseCompressionSettings", "branch %s: selected %s level %d (ratio %.2f, %.0f MB/s) from a %d byte sample",
+           GetName(), ROOT::RCompressionSetting::AlgorithmToString(candidates[best].fAlgorithm).c_str(),
+           candidates[best].fLevel, (Double_t)payloadLen / sizes[best], mbps, payloadLen);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write the current basket to disk and return the number of bytes
 /// written to the file.
 
 Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *imtHelper)
 {
+   if (R__unlikely(fAdaptiveCompression))
+      ChooseCompressionSettings(*basket);
+
    Int_t nevbuf = basket->GetNevBuf();
    if (fEntryOffsetLen > 10 &&  (4*nevbuf) < fEntryOffsetLen ) {
       // Make sure that the fEntryOffset array does not stay large unnecessarily.
@@ -3223,6 +3482,55 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
 
+   if (imtHelper && fTree->GetAsyncBasketFlush()) {
+      // Asynchronous flush mode: detach the full basket from the branch and
+      // update the branch bookkeeping right away, so that the next Fill call
+      // can start a fresh basket while this one is compressed and written to
+      // the file by a background task (TBasket::WriteBuffer serializes the
+      // actual file access).
+      if (fPendingBasketWrites > 0) {
+         // Rare: the previous basket of this branch is still in flight. Drain
+         // so that the per-basket arrays stay single-writer.
+         imtHelper->Wait();
+      }
+      --fNBaskets;
+      fBaskets[where] = nullptr;
+      if (basket == fCurrentBasket) {
+         fCurrentBasket    = nullptr;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      if (where == fWriteBasket) {
+         ++fWriteBasket;
+         if (fWriteBasket >= fMaxBaskets) {
+            ExpandBasketArrays();
+         }
+         // Make sure the container covers the new slot; the next FillImpl
+         // call will create a fresh basket there.
+         fBaskets.AddAtAndExpand(nullptr, fWriteBasket);
+         fBasketEntry[fWriteBasket] = fEntryNumber;
+      }
+      ++fPendingBasketWrites;
+      imtHelper->Run([this, basket, where]() {
+         Int_t nout = basket->WriteBuffer(); //  Write buffer
+         if (nout < 0)
+            Error("WriteBasketImpl", "basket's WriteBuffer failed.");
+         fBasketBytes[where] = basket->GetNbytes();
+         fBasketSeek[where]  = basket->GetSeekKey();
+         if (nout > 0) {
+            Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+            fZipBytes += nout;
+            fTotBytes += addbytes;
+            fTree->AddTotBytes(addbytes);
+            fTree->AddZipBytes(nout);
+         }
+         delete basket;
+         --fPendingBasketWrites;
+         return nout;
+      });
+      return 0;
+   }
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -14,6 +14,8 @@
 
 #include "RtypesCore.h"
 
+#include <atomic>
+
 #ifdef R__USE_IMT
 #include "ROOT/TTaskGroup.hxx"
 #endif
@@ -35,6 +37,7 @@ public:
    template<typename FN> void Run(const FN &lambda) {
 #ifdef R__USE_IMT
       if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
+      ++fNpending;
       fGroup->Run( [this, lambda]() {
          auto nbytes = lambda();
          if (nbytes >= 0) {
@@ -42,6 +45,7 @@ public:
          } else {
             ++fNerrors;
          }
+         --fNpending;
       });
 #else
       (void)lambda;
@@ -56,10 +60,12 @@ public:
 
    Long64_t GetNbytes() { return fBytes; }
    Long64_t GetNerrors() {  return fNerrors; }
+   Int_t    GetNpending() { return fNpending; }
 
 private:
    std::atomic<Long64_t> fBytes{0};   ///< Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; ///< Total error count of all tasks done by this helper.
+   std::atomic<Int_t>    fNpending{0}; ///< Number of tasks submitted and not yet finished.
 #ifdef R__USE_IMT
    std::unique_ptr<TaskGroup_t> fGroup;
 #endif
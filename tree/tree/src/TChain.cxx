@@ -27,6 +27,7 @@ the trees in the chain.
 #include "TChain.h"
 #include "ROOT/InternalTreeUtils.hxx"
 
+#include <algorithm>
 #include <iostream>
 #include <cfloat>
 #include <string>
@@ -38,6 +39,7 @@ the trees in the chain.
 #include "TClass.h"
 #include "TColor.h"
 #include "TCut.h"
+#include "TEnv.h"
 #include "TError.h"
 #include "TFile.h"
 #include "TFileInfo.h"
@@ -71,7 +73,8 @@ ClassImp(TChain);
 
 TChain::TChain(Mode mode)
    : TTree(), fTreeOffsetLen(100), fNtrees(0), fTreeNumber(-1), fTreeOffset(nullptr), fCanDeleteRefs(false), fTree(nullptr),
-     fFile(nullptr), fFiles(nullptr), fStatus(nullptr), fGlobalRegistration(mode == kWithGlobalRegistration)
+     fFile(nullptr), fFiles(nullptr), fStatus(nullptr), fGlobalRegistration(mode == kWithGlobalRegistration),
+     fAsyncOpenAhead(gEnv->GetValue("TChain.AsyncOpenAhead", 0))
 {
    fTreeOffset = new Long64_t[fTreeOffsetLen];
    fFiles = new TObjArray(fTreeOffsetLen);
@@ -136,7 +139,8 @@ TChain::TChain(Mode mode)
 TChain::TChain(const char *name, const char *title, Mode mode)
    : TTree(name, title, /*splitlevel*/ 99, nullptr), fTreeOffsetLen(100), fNtrees(0), fTreeNumber(-1), fTreeOffset(nullptr),
      fCanDeleteRefs(false), fTree(nullptr), fFile(nullptr), fFiles(nullptr), fStatus(nullptr),
-     fGlobalRegistration(mode == kWithGlobalRegistration)
+     fGlobalRegistration(mode == kWithGlobalRegistration),
+     fAsyncOpenAhead(gEnv->GetValue("TChain.AsyncOpenAhead", 0))
 {
    //
    //*-*
@@ -166,6 +170,8 @@ TChain::~TChain()
 {
    bool rootAlive = gROOT && !gROOT->TestBit(TObject::kInvalidObject);
 
+   ClearAsyncOpenRequests();
+
    if (rootAlive && fGlobalRegistration) {
       R__LOCKGUARD(gROOTMutex);
       gROOT->GetListOfCleanups()->Remove(this);
@@ -1454,11 +1460,22 @@ Long64_t TChain::LoadTree(Long64_t entry)
    {
       TDirectory::TContext ctxt;
       const char *option = fGlobalRegistration ? "READ" : "READ_WITHOUT_GLOBALREGISTRATION";
-      fFile = TFile::Open(element->GetTitle(), option);
+      // If an asynchronous open was issued for this element by a previous file transition
+      // (see SetAsyncOpenAhead), attach to it instead of opening from scratch.
+      if (TFileOpenHandle *fh = ClaimAsyncOpenHandle(treenum))
+         fFile = TFile::Open(fh);
+      else
+         fFile = TFile::Open(element->GetTitle(), option);
       if (fFile && fGlobalRegistration)
          fFile->SetBit(kMustCleanup);
    }
 
+   // Issue asynchronous open requests for the upcoming elements of the chain, so that for
+   // protocols with asynchronous open support (e.g. xrootd) the open latency of the next
+   // files overlaps with the processing of this one.
+   if (fAsyncOpenAhead > 0)
+      AsyncOpenUpcomingFiles(treenum);
+
    // ----- Begin of modifications by MvL
    Int_t returnCode = 0;
    if (!fFile || fFile->IsZombie()) {
@@ -1699,6 +1716,61 @@ Long64_t TChain::LoadTree(Long64_t entry)
    return treeReadEntry;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// If an asynchronous open request is pending for chain element `treenum`, remove it
+/// from the list of pending requests and return its handle, otherwise return nullptr.
+/// The caller takes ownership of the handle and is expected to pass it to TFile::Open.
+
+TFileOpenHandle *TChain::ClaimAsyncOpenHandle(Int_t treenum)
+{
+   for (auto it = fAsyncOpenHandles.begin(); it != fAsyncOpenHandles.end(); ++it) {
+      if (it->first == treenum) {
+         TFileOpenHandle *fh = it->second;
+         fAsyncOpenHandles.erase(it);
+         return fh;
+      }
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Issue asynchronous open requests (see TFile::AsyncOpen) for the elements following
+/// `treenum`, up to the lookahead depth configured with SetAsyncOpenAhead. Elements
+/// with a request already pending are skipped. For protocols without asynchronous open
+/// support the request only records the open arguments and the actual open still
+/// happens synchronously in LoadTree.
+
+void TChain::AsyncOpenUpcomingFiles(Int_t treenum)
+{
+   const char *option = fGlobalRegistration ? "READ" : "READ_WITHOUT_GLOBALREGISTRATION";
+   const Int_t last = std::min(treenum + fAsyncOpenAhead, fNtrees - 1);
+   for (Int_t i = treenum + 1; i <= last; ++i) {
+      const bool pending = std::any_of(fAsyncOpenHandles.begin(), fAsyncOpenHandles.end(),
+                                       [i](const std::pair<Int_t, TFileOpenHandle *> &p) { return p.first == i; });
+      if (pending)
+         continue;
+      TChainElement *element = (TChainElement *)fFiles->At(i);
+      if (!element)
+         continue;
+      if (TFileOpenHandle *fh = TFile::AsyncOpen(element->GetTitle(), option))
+         fAsyncOpenHandles.emplace_back(i, fh);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Finalize and discard all pending asynchronous open requests.
+/// A request in flight cannot simply be dropped: the open is completed (waiting if
+/// necessary) and the resulting file is closed.
+
+void TChain::ClearAsyncOpenRequests()
+{
+   for (auto &entry : fAsyncOpenHandles) {
+      if (TFile *f = TFile::Open(entry.second))
+         delete f;
+   }
+   fAsyncOpenHandles.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Check / locate the files in the chain.
 /// By default only the files not yet looked up are checked.
@@ -2271,6 +2343,7 @@ void TChain::RemoveFriend(TTree* oldFriend)
 
 void TChain::Reset(Option_t*)
 {
+   ClearAsyncOpenRequests();
    delete fFile;
    fFile = nullptr;
    fNtrees         = 0;
@@ -2373,6 +2446,29 @@ Long64_t TChain::Scan(const char* varexp, const char* selection, Option_t* optio
    return TTree::Scan(varexp, selection, option, nentries, firstentry);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the number of upcoming chain elements that LoadTree opens asynchronously
+/// ahead of the event loop (0 disables the lookahead, which is the default).
+///
+/// With a non-zero lookahead, every file transition issues asynchronous open
+/// requests (TFile::AsyncOpen) for the next `nfiles` elements of the chain, so
+/// that for protocols with asynchronous open support (currently xrootd via
+/// TNetXNGFile) the connection and open latency of upcoming files overlaps with
+/// the processing of the current one instead of stalling each transition. This
+/// also speeds up operations that visit every file back-to-back, such as
+/// GetEntries on a chain whose entry counts are not yet known.
+///
+/// The default can also be set via the `TChain.AsyncOpenAhead` configuration
+/// value in rootrc. For local files the requests degrade to standard synchronous
+/// opens and the lookahead has no effect.
+
+void TChain::SetAsyncOpenAhead(Int_t nfiles)
+{
+   fAsyncOpenAhead = nfiles;
+   if (fAsyncOpenAhead <= 0)
+      ClearAsyncOpenRequests();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the global branch kAutoDelete bit.
 ///
@@ -615,6 +615,38 @@ Int_t TEntryList::Contains(Long64_t entry, TTree *tree)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// True if any of the entries from entrymin to entrymax (included) is in the
+/// list. The entry numbers are interpreted as in Contains() when no tree is
+/// given: with respect to this list (or, when the list has sub-lists, with
+/// respect to the current sub-list).
+
+Int_t TEntryList::ContainsRange(Long64_t entrymin, Long64_t entrymax)
+{
+   if (entrymin > entrymax)
+      return 0;
+   if (fBlocks) {
+      //this entry list doesn't contain any sub-lists
+      Long64_t blockmin = entrymin/kBlockSize;
+      Long64_t blockmax = entrymax/kBlockSize;
+      if (blockmin >= fNBlocks) return 0;
+      if (blockmax >= fNBlocks) blockmax = fNBlocks-1;
+      for (Long64_t nblock = blockmin; nblock <= blockmax; nblock++) {
+         TEntryListBlock *block = (TEntryListBlock*)fBlocks->UncheckedAt(nblock);
+         if (!block) continue;
+         Int_t locmin = (nblock==blockmin) ? entrymin - nblock*kBlockSize : 0;
+         Int_t locmax = (nblock==blockmax) ? entrymax - nblock*kBlockSize : kBlockSize-1;
+         if (block->ContainsRange(locmin, locmax)) return 1;
+      }
+      return 0;
+   }
+   if (fLists) {
+      if (!fCurrent) fCurrent = (TEntryList*)fLists->First();
+      if (fCurrent) return fCurrent->ContainsRange(entrymin, entrymax);
+   }
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by TKey and others to automatically add us to a directory when we are read from a file.
 
@@ -1341,13 +1373,21 @@ void TEntryList::Subtract(const TEntryList *elist)
          //second list is also only for 1 tree
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
-            //same tree
-            Long64_t n2 = elist->GetN();
-            Long64_t entry;
-            for (Int_t i=0; i<n2; i++){
-               entry = (const_cast<TEntryList*>(elist))->GetEntry(i);
-               Remove(entry);
+            //same tree - subtract block by block
+            if (!elist->fBlocks) return;
+            TEntryListBlock *block1 = nullptr;
+            TEntryListBlock *block2 = nullptr;
+            Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+            Long64_t nnew, nold;
+            for (Int_t i=0; i<nmin; i++){
+               block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+               block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
+               nold = block1->GetNPassed();
+               nnew = block1->Subtract(block2);
+               fN = fN - nold + nnew;
             }
+            fLastIndexQueried = -1;
+            fLastIndexReturned = 0;
          } else {
             //different trees
             return;
@@ -38,16 +38,30 @@ End_Macro
  - __Merge__() - adds all entries from one block to the other. If the first block
              uses array representation, it's changed to bits representation only
              if the total number of passing entries is still less than kBlockSize
+ - __Subtract__() - removes all entries of the other block from this block.
  - __GetEntry(n)__ - returns n-th non-zero entry.
  - __Next__()      - return next non-zero entry. In case of representation 1), Next()
                  is faster than GetEntry()
 */
 
 #include "TEntryListBlock.h"
+#include "TMath.h"
 #include "TString.h"
 
 ClassImp(TEntryListBlock);
 
+namespace {
+   // Number of set bits in a 16-bit word
+   inline Int_t BitCount(UShort_t word)
+   {
+      UInt_t bits = word;
+      bits = bits - ((bits >> 1) & 0x5555U);
+      bits = (bits & 0x3333U) + ((bits >> 2) & 0x3333U);
+      bits = (bits + (bits >> 4)) & 0x0F0FU;
+      return (bits + (bits >> 8)) & 0xFFU;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default c-tor
 
@@ -236,6 +250,51 @@ Int_t TEntryListBlock::Contains(Int_t entry)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// True if any of the entries from entrymin to entrymax (included) is in the list
+
+Int_t TEntryListBlock::ContainsRange(Int_t entrymin, Int_t entrymax)
+{
+   if (entrymin > entrymax || entrymin < 0 || entrymax > kBlockSize*16) {
+      Error("ContainsRange", "Illegal entry range!\n");
+      return 0;
+   }
+   if (!fIndices && fPassing)
+      return 0;
+   if (fType==0 && fIndices){
+      //bits
+      Int_t ifirst = entrymin>>4;
+      Int_t ilast = entrymax>>4;
+      for (Int_t i = ifirst; i <= ilast; i++){
+         UShort_t bits = fIndices[i];
+         if (!bits) continue;
+         if (i == ifirst)
+            bits &= (UShort_t)(0xFFFF << (entrymin & 15));
+         if (i == ilast)
+            bits &= (UShort_t)(0xFFFF >> (15 - (entrymax & 15)));
+         if (bits) return 1;
+      }
+      return 0;
+   }
+   //list
+   if (fPassing && fIndices){
+      //the indices are sorted in increasing order
+      Long64_t imax = TMath::BinarySearch((Long64_t)fNPassed, fIndices, (UShort_t)entrymax);
+      return (imax >= 0 && fIndices[imax] >= entrymin);
+   } else {
+      if (!fIndices || fNPassed==0){
+         //all entries pass
+         return 1;
+      }
+      //fIndices stores the entries that don't pass: the range contains a
+      //passing entry unless all its entries are in fIndices
+      Long64_t nlisted = TMath::BinarySearch((Long64_t)fNPassed, fIndices, (UShort_t)entrymax) + 1;
+      if (entrymin > 0)
+         nlisted -= TMath::BinarySearch((Long64_t)fNPassed, fIndices, (UShort_t)(entrymin-1)) + 1;
+      return (Long64_t(entrymax) - entrymin + 1) > nlisted;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge with the other block
 /// Returns the resulting number of entries in the block
@@ -261,9 +320,11 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    if (fType==0){
       //stored as bits
       if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
+         //both stored as bits - merge word by word
+         fNPassed = 0;
+         for (i=0; i<kBlockSize; i++){
+            fIndices[i] |= block->fIndices[i];
+            fNPassed += BitCount(fIndices[i]);
          }
       } else {
          if (block->fPassing){
@@ -272,21 +333,19 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
                Enter(block->fIndices[i]);
             }
          } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
+            //the other block stores entries that don't pass - build the
+            //complement of its (sorted) list word by word and OR it in
+            Int_t ilist = 0;
+            fNPassed = 0;
+            for (i=0; i<kBlockSize; i++){
+               UShort_t miss = 0;
+               while (block->fIndices && ilist < block->fNPassed && (block->fIndices[ilist]>>4) == i){
+                  miss |= 1<<(block->fIndices[ilist] & 15);
+                  ilist++;
                }
+               fIndices[i] |= (UShort_t)(~miss);
+               fNPassed += BitCount(fIndices[i]);
             }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
          }
       }
    } else {
@@ -313,7 +372,7 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
                   newpos++;
                   elpos++;
                }
-               if (fIndices[i] == elst[elpos]) elpos++;
+               if (elpos < en && fIndices[i] == elst[elpos]) elpos++;
                newlist[newpos] = fIndices[i];
                newpos++;
             }
@@ -334,16 +393,21 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
             UShort_t *newlist = new UShort_t[newsize];
             Int_t newpos, current;
             newpos = current = 0;
-            for (i=0; i<kBlockSize*16; i++){
-               if (!block->Contains(i)) continue;
-               while(current < fNPassed && fIndices[current]<i){
-                  newlist[newpos] = fIndices[current];
-                  current++;
+            for (Int_t iword=0; iword<kBlockSize; iword++){
+               UShort_t bits = block->fIndices[iword];
+               if (!bits) continue;
+               for (j=0; j<16; j++){
+                  if (!(bits & (1<<j))) continue;
+                  i = (iword<<4) + j;
+                  while(current < fNPassed && fIndices[current]<i){
+                     newlist[newpos] = fIndices[current];
+                     current++;
+                     newpos++;
+                  }
+                  if (current < fNPassed && fIndices[current]==i) current++;
+                  newlist[newpos] = i;
                   newpos++;
                }
-               if (fIndices[current]==i) current++;
-               newlist[newpos] = i;
-               newpos++;
             }
             while(current<fNPassed){
                newlist[newpos] = fIndices[current];
@@ -363,6 +427,57 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    return GetNPassed();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all entries of this block that are contained in the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   Int_t i;
+   if (GetNPassed() == 0 || block->GetNPassed() == 0) return GetNPassed();
+   if (fType != 0){
+      //change to bits
+      UShort_t *bits = new UShort_t[kBlockSize];
+      Transform(true, bits);
+   }
+   if (block->fType == 0){
+      //the other block is stored as bits - clear word by word
+      fNPassed = 0;
+      for (i=0; i<kBlockSize; i++){
+         fIndices[i] &= (UShort_t)(~block->fIndices[i]);
+         fNPassed += BitCount(fIndices[i]);
+      }
+   } else if (block->fPassing){
+      //the other block stores a list of passing entries - clear their bits
+      for (i=0; i<block->fNPassed; i++){
+         Int_t ibite = block->fIndices[i]>>4;
+         Int_t ibit = block->fIndices[i] & 15;
+         if (fIndices[ibite] & (1<<ibit)){
+            fIndices[ibite] &= (1<<ibit) ^ 0xFFFF;
+            fNPassed--;
+         }
+      }
+   } else {
+      //the other block stores the entries that don't pass - only those
+      //may survive in this block
+      Int_t ilist = 0;
+      fNPassed = 0;
+      for (i=0; i<kBlockSize; i++){
+         UShort_t miss = 0;
+         while (block->fIndices && ilist < block->fNPassed && (block->fIndices[ilist]>>4) == i){
+            miss |= 1<<(block->fIndices[ilist] & 15);
+            ilist++;
+         }
+         fIndices[i] &= miss;
+         fNPassed += BitCount(fIndices[i]);
+      }
+   }
+   fLastIndexQueried = -1;
+   fLastIndexReturned = -1;
+   OptimizeStorage();
+   return GetNPassed();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of entries, passing the selection.
 /// In case, when the block stores entries that pass (fPassing=1) returns fNPassed
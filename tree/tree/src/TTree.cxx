@@ -948,6 +948,9 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   // No basket compression/write task may outlive the tree.
+   WaitAsyncBaskets();
+
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -1529,6 +1532,9 @@ TFriendElement *TTree::AddFriend(TTree *tree, const char *alias, bool warn)
 Long64_t TTree::AutoSave(Option_t* option)
 {
    if (!fDirectory || fDirectory == gROOT || !fDirectory->IsWritable()) return 0;
+   // The saved header snapshots the basket seek addresses: no asynchronous
+   // basket write may still be in flight.
+   WaitAsyncBaskets();
    if (gDebug > 0) {
       Info("AutoSave", "Tree:%s after %lld bytes written\n",GetName(),GetTotBytes());
    }
@@ -2784,6 +2790,8 @@ TFile* TTree::ChangeFile(TFile* file)
    // as well as with TFileMerger operations, see #6640.
    if ((dynamic_cast<TMemFile *>(file)) || file->TestBit(TFile::kCancelTTreeChangeRequest))
       return file;
+   // No in-flight basket write may target the file we are about to leave.
+   WaitAsyncBaskets();
    file->cd();
    Write();
    Reset();
@@ -4669,11 +4677,22 @@ Int_t TTree::Fill()
 
 #ifdef R__USE_IMT
    const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
-   ROOT::Internal::TBranchIMTHelper imtHelper;
+   const auto asyncFlush = useIMT && fAsyncBasketFlush;
+   ROOT::Internal::TBranchIMTHelper localHelper;
+   ROOT::Internal::TBranchIMTHelper *imtHelperPtr = nullptr;
    if (useIMT) {
+      if (asyncFlush) {
+         // The tasks are handed to a helper owned by the tree, so that they
+         // can keep compressing and writing after this Fill call returns.
+         if (!fAsyncFlushHelper)
+            fAsyncFlushHelper.reset(new ROOT::Internal::TBranchIMTHelper());
+         imtHelperPtr = fAsyncFlushHelper.get();
+      } else {
+         imtHelperPtr = &localHelper;
+         fIMTZipBytes.store(0);
+         fIMTTotBytes.store(0);
+      }
       fIMTFlush = true;
-      fIMTZipBytes.store(0);
-      fIMTTotBytes.store(0);
    }
 #endif
 
@@ -4687,7 +4706,7 @@ Int_t TTree::Fill()
 #ifndef R__USE_IMT
       nwrite = branch->FillImpl(nullptr);
 #else
-      nwrite = branch->FillImpl(useIMT ? &imtHelper : nullptr);
+      nwrite = branch->FillImpl(imtHelperPtr);
 #endif
       if (nwrite < 0) {
          if (nerror < 2) {
@@ -4712,12 +4731,28 @@ Int_t TTree::Fill()
 
 #ifdef R__USE_IMT
    if (fIMTFlush) {
-      imtHelper.Wait();
-      fIMTFlush = false;
-      const_cast<TTree *>(this)->AddTotBytes(fIMTTotBytes);
-      const_cast<TTree *>(this)->AddZipBytes(fIMTZipBytes);
-      nbytes += imtHelper.GetNbytes();
-      nerror += imtHelper.GetNerrors();
+      if (asyncFlush) {
+         // Fold the bytes recorded by the basket tasks so far into the plain
+         // counters: the autoflush/autosave decisions below read GetZipBytes()
+         // and must see these bytes even when no drain ever happens because
+         // compression keeps up with Fill. Tasks still in flight continue to
+         // accumulate into the atomics (fIMTFlush stays true), so nothing is
+         // lost or counted twice.
+         fTotBytes += fIMTTotBytes.exchange(0);
+         fZipBytes += fIMTZipBytes.exchange(0);
+         // The basket tasks are left in flight; only apply backpressure when
+         // compression cannot keep up with Fill, to bound the queue of
+         // baskets (and hence the memory) the pipeline may accumulate.
+         if (fAsyncFlushHelper->GetNpending() > 4 * nbranches)
+            WaitAsyncBaskets();
+      } else {
+         imtHelperPtr->Wait();
+         fIMTFlush = false;
+         const_cast<TTree *>(this)->AddTotBytes(fIMTTotBytes);
+         const_cast<TTree *>(this)->AddZipBytes(fIMTZipBytes);
+         nbytes += imtHelperPtr->GetNbytes();
+         nerror += imtHelperPtr->GetNerrors();
+      }
    }
 #endif
 
@@ -5185,6 +5220,57 @@ Int_t TTree::FlushBaskets(bool create_cluster) const
     return retval;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the asynchronous basket flush mode.
+///
+/// When enabled (and implicit multi-threading is active, see
+/// ROOT::EnableImplicitMT and TTree::SetImplicitMT), a basket that fills up
+/// during TTree::Fill is detached from its branch immediately and handed to a
+/// task that compresses it and writes it to the file, while Fill returns and
+/// keeps accepting entries. The basket bookkeeping (entry numbers, basket
+/// seek addresses) is identical to the synchronous mode, so readers see the
+/// same entry ordering; only the physical order of the baskets in the file
+/// may differ, as it already can with a multithreaded FlushBaskets. The
+/// number of in-flight tasks is bounded: Fill blocks once more than four
+/// tasks per branch are pending.
+///
+/// The pipeline is drained automatically by FlushBaskets, AutoSave,
+/// ChangeFile and the destructor; call WaitAsyncBaskets explicitly before
+/// reading back entries of a tree being filled or modifying its branch
+/// structure.
+
+void TTree::SetAsyncBasketFlush(bool enabled)
+{
+   if (!enabled && fAsyncBasketFlush)
+      WaitAsyncBaskets();
+   if (enabled && !ROOT::IsImplicitMTEnabled())
+      Warning("SetAsyncBasketFlush",
+              "asynchronous basket flushing has no effect unless implicit multi-threading is enabled");
+   fAsyncBasketFlush = enabled;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until all basket compression/write tasks dispatched by Fill in the
+/// asynchronous basket flush mode (see SetAsyncBasketFlush) have completed
+/// and fold their byte counts into the tree statistics.
+
+void TTree::WaitAsyncBaskets()
+{
+#ifdef R__USE_IMT
+   if (!fAsyncFlushHelper)
+      return;
+   fAsyncFlushHelper->Wait();
+   fTotBytes += fIMTTotBytes;
+   fIMTTotBytes.store(0);
+   fZipBytes += fIMTZipBytes;
+   fIMTZipBytes.store(0);
+   fIMTFlush = false;
+   if (fAsyncFlushHelper->GetNerrors() > 0)
+      Error("WaitAsyncBaskets", "%lld basket write task(s) failed.", fAsyncFlushHelper->GetNerrors());
+   fAsyncFlushHelper.reset();
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal implementation of the FlushBaskets algorithm.
 /// Unlike the public interface, this does NOT create an explicit event cluster
@@ -5196,6 +5282,9 @@ Int_t TTree::FlushBaskets(bool create_cluster) const
 Int_t TTree::FlushBasketsImpl() const
 {
    if (!fDirectory) return 0;
+
+   // Drain any basket write still in flight from the asynchronous flush mode.
+   const_cast<TTree*>(this)->WaitAsyncBaskets();
    Int_t nbytes = 0;
    Int_t nerror = 0;
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
@@ -8512,6 +8601,49 @@ void TTree::SetAutoSave(Long64_t autos)
    fAutoSave = autos;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable (or disable) adaptive compression for the branches matching bname.
+///
+/// bname is the name of a branch.
+///
+/// - if bname="*", apply to all branches.
+/// - if bname="xxx*", apply to all branches with name starting with xxx
+///
+/// see TRegexp for wildcarding options
+///
+/// With adaptive compression enabled, each matching branch compresses the
+/// payload of its first flushed basket with a small candidate set of
+/// algorithm/level pairs (zlib, lz4 and zstd at their recommended levels plus a
+/// ratio-oriented zstd level) and locks in the candidate producing the smallest
+/// output; among candidates within 5% of the smallest output the fastest one is
+/// chosen. The per-branch decision is stored in the branch's regular
+/// compression settings, so it is persisted with the tree and later writes and
+/// reads are reproducible without re-running the trials. This recovers most of
+/// the gains of hand-tuning per-branch compression on mixed-content data, at
+/// the one-time cost of a few extra compressions of one basket per branch.
+///
+/// Must be called before the matching branches flush their first basket.
+
+void TTree::SetAdaptiveCompression(const char *bname, bool adaptive)
+{
+   Int_t nleaves = fLeaves.GetEntriesFast();
+   TRegexp re(bname, true);
+   Int_t nb = 0;
+   for (Int_t i = 0; i < nleaves; i++) {
+      TLeaf *leaf = (TLeaf *)fLeaves.UncheckedAt(i);
+      TBranch *branch = (TBranch *)leaf->GetBranch();
+      TString s = branch->GetName();
+      if (strcmp(bname, branch->GetName()) && (s.Index(re) == kNPOS)) {
+         continue;
+      }
+      nb++;
+      branch->SetAdaptiveCompression(adaptive);
+   }
+   if (!nb) {
+      Error("SetAdaptiveCompression", "unknown branch -> '%s'", bname);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a branch's basket size.
 ///
@@ -289,6 +289,7 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TList.h"
 #include "TBranch.h"
 #include "TBranchElement.h"
+#include "TEntryList.h"
 #include "TEventList.h"
 #include "TObjArray.h"
 #include "TObjString.h"
@@ -1307,6 +1308,22 @@ bool TTreeCache::FillBuffer()
       }
    }
 
+   // Similarly, a TEntryList (set explicitly via SetEntryList, e.g. by a
+   // TTreeReader, or attached to the owner) lets us skip the baskets that
+   // contain no selected entries.
+   TEntryList *enlist = elist ? nullptr : (fEntryList ? fEntryList : fTree->GetEntryList());
+   if (enlist) {
+      if (enlist->GetLists()) {
+         // The sub-lists hold entry numbers local to each tree of the chain;
+         // use the one kept in sync with the currently loaded tree.
+         enlist = enlist->GetCurrentList();
+      } else if (fTree->IsA() == TChain::Class()) {
+         TChain *chain = (TChain*)fTree;
+         Int_t t = chain->GetTreeNumber();
+         chainOffset = chain->GetTreeOffset()[t];
+      }
+   }
+
    //clear cache buffer
    Int_t ntotCurrentBuf = 0;
    if (fEnablePrefetching){ //prefetching mode
@@ -1368,7 +1385,7 @@ bool TTreeCache::FillBuffer()
          kRewind = 3
       };
 
-      auto CollectBaskets = [this, elist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
+      auto CollectBaskets = [this, elist, enlist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
        &cursor, &lowestMaxEntry, &maxReadEntry, &minEntry,
        &reachedEnd, &skippedFirst, &oncePerBranch, &nDistinctLoad, &progress,
        &ranges, &memRanges, &reqRanges,
@@ -1501,6 +1518,14 @@ bool TTreeCache::FillBuffer()
                      continue;
                }
 
+               if (enlist) {
+                  Long64_t emax = fEntryMax;
+                  if (j<nb-1)
+                     emax = entries[j + 1] - 1;
+                  if (!enlist->ContainsRange(entries[j]+chainOffset,emax+chainOffset))
+                     continue;
+               }
+
                if (b->fCacheInfo.HasBeenUsed(j) || b->fCacheInfo.IsInCache(j) || b->fCacheInfo.IsVetoed(j)) {
                   // We already cached and used this basket during this cluster range,
                   // let's not redo it
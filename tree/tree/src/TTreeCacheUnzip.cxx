@@ -27,6 +27,8 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMath.h"
 #include "TROOT.h"
 #include "TMutex.h"
+#include "TTimeStamp.h"
+#include "TVirtualPerfStats.h"
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
@@ -58,6 +60,7 @@ void TTreeCacheUnzip::UnzipState::Clear(Int_t size) {
       }
       if (fUnzipStatus) fUnzipStatus[i].store(0);
    }
+   fTotalSize.store(0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -124,6 +127,8 @@ void TTreeCacheUnzip::UnzipState::Reset(Int_t oldSize, Int_t newSize) {
 ///       to unzip this basket.
 
 void TTreeCacheUnzip::UnzipState::SetFinished(Int_t index) {
+   if (fUnzipChunks[index])
+      fTotalSize -= fUnzipLen[index];
    fUnzipLen[index] = 0;
    fUnzipChunks[index].reset();
    fUnzipStatus[index].store((Byte_t)kFinished);
@@ -132,6 +137,8 @@ void TTreeCacheUnzip::UnzipState::SetFinished(Int_t index) {
 ////////////////////////////////////////////////////////////////////////////////
 
 void TTreeCacheUnzip::UnzipState::SetMissed(Int_t index) {
+   if (fUnzipChunks[index])
+      fTotalSize -= fUnzipLen[index];
    fUnzipChunks[index].reset();
    fUnzipStatus[index].store((Byte_t)kFinished);
 }
@@ -140,6 +147,7 @@ void TTreeCacheUnzip::UnzipState::SetMissed(Int_t index) {
 
 void TTreeCacheUnzip::UnzipState::SetUnzipped(Int_t index, char* buf, Int_t len) {
    // Update status array at the very end because we need to be synchronous with the main thread.
+   fTotalSize += len;
    fUnzipLen[index] = len;
    fUnzipChunks[index].reset(buf);
    fUnzipStatus[index].store((Byte_t)kFinished);
@@ -346,6 +354,18 @@ bool TTreeCacheUnzip::FillBuffer()
    ResetCache();
    fIsLearning = false;
 
+#ifdef R__USE_IMT
+   // Kick off the decompression of the newly registered baskets on the task arena
+   // right away, instead of waiting for the first cache miss in GetUnzipBuffer.
+   if (fParallel && ROOT::IsImplicitMTEnabled()) {
+      if (fUnzipTaskGroup) {
+         fUnzipTaskGroup->Cancel();
+         fUnzipTaskGroup.reset();
+      }
+      CreateTasks();
+   }
+#endif
+
    return true;
 }
 
@@ -584,6 +604,25 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
            return 0;
    }
 
+   // Bound the memory held by the pool of ready unzipped blocks: when the budget
+   // is spent, leave this block to be inflated inline by the reading thread. The
+   // budget frees up as the main thread consumes the ready blocks.
+   if (fUnzipState.GetTotalSize() + len > fUnzipBufferSize) {
+      if (gDebug > 0)
+         Info("UnzipCache", "Unzipped-block budget exhausted, leaving block %d to the reading thread.", index);
+
+      fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+      if (locbuff) delete [] locbuff;
+      return 0;
+   }
+
+   // Record the unzipping in the performance statistics, as TBasket does for the
+   // inline case: without this the time spent inflating in the tasks is invisible.
+   Double_t start = 0;
+   TVirtualPerfStats *perfStats = fTree->GetPerfStats() ? fTree->GetPerfStats() : gPerfStats;
+   if (R__unlikely(perfStats))
+      start = TTimeStamp();
+
    // Unzip it into a new blk
    char *ptr = nullptr;
    Int_t loclen = UnzipBuffer(&ptr, locbuff);
@@ -596,6 +635,8 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       }
       fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
       fNUnzip++;
+      if (R__unlikely(perfStats))
+         perfStats->UnzipEvent(fTree, rdoffs, start, nbytes - keylen, objlen);
    } else {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
       delete [] ptr;
@@ -614,6 +655,17 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 Int_t TTreeCacheUnzip::CreateTasks()
 {
    auto mapFunction = [&]() {
+      // The content of the cache is transferred from the file lazily, at the first
+      // read. When the tasks are created right after FillBuffer the transfer has
+      // not happened yet: trigger it from here, off the main thread, so that the
+      // unzip tasks below find the data in place.
+      if (!fIsTransferred && fNseek > 0) {
+         std::vector<char> scratch(fSeekLen[0]);
+         Int_t loc = -1;
+         if (ReadBufferExt(scratch.data(), fSeek[0], fSeekLen[0], loc) <= 0)
+            return;
+      }
+
       auto unzipFunction = [&](const std::vector<Int_t> &indices) {
          // If cache is invalidated and we should return immediately.
          if (!fIsTransferred) return nullptr;
@@ -646,6 +698,9 @@ Int_t TTreeCacheUnzip::CreateTasks()
          accusz = 0;
       }
       ROOT::TThreadExecutor pool;
+      // Basket groups take uneven time to inflate: let the executor size the
+      // chunks from the measured duration of the first ones.
+      pool.SetAutoChunking(true);
       pool.Foreach(unzipFunction, basketIndices);
    };
 
@@ -714,6 +769,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, bool
                   fUnzipState.fUnzipChunks[seekidx].reset();
                   *free = false;
                }
+               // The chunk left the pool of ready blocks, in either case.
+               fUnzipState.fTotalSize -= fUnzipState.fUnzipLen[seekidx];
 
                fNFound++;
                return fUnzipState.fUnzipLen[seekidx];
@@ -763,6 +820,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, bool
                fUnzipState.fUnzipChunks[seekidx].reset();
                *free = false;
             }
+            // The chunk left the pool of ready blocks, in either case.
+            fUnzipState.fTotalSize -= fUnzipState.fUnzipLen[seekidx];
 
             fNStalls++;
             return fUnzipState.fUnzipLen[seekidx];
@@ -949,6 +1008,7 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
 
    printf("******TreeCacheUnzip statistics for file: %s ******\n",fFile->GetName());
    printf("Max allowed mem for pending buffers: %lld\n", fUnzipBufferSize);
+   printf("Current mem used by pending buffers: %lld\n", fUnzipState.GetTotalSize());
    printf("Number of blocks unzipped by threads: %d\n", fNUnzip);
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
@@ -36,7 +36,14 @@ Class implementing or helping  the various TTree cloning method
 #include "TTreeCache.h"
 #include "snprintf.h"
 
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
 #include <algorithm>
+#include <memory>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -729,61 +736,83 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 void TTreeCloner::WriteBaskets()
 {
    TBasket *basket = new TBasket();
+
+   // Read the j-th basket of the sorted list into 'bk', keeping its payload
+   // compressed.
+   auto loadBasket = [this](TBasket &bk, UInt_t j) -> bool {
+      TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+      TFile *fromfile = from->GetFile(0);
+      Int_t index = fBasketNum[ fBasketIndex[j] ];
+      Long64_t pos = from->GetBasketSeek(index);
+      if (from->GetBasketBytes()[index] == 0) {
+         from->GetBasketBytes()[index] = bk.ReadBasketBytes(pos, fromfile);
+      }
+      Int_t len = from->GetBasketBytes()[index];
+      if (bk.LoadBasketBuffers(pos, len, fromfile, fFromTree) != 0) {
+         return false;
+      }
+      bk.IncrementPidOffset(fPidOffset);
+      return true;
+   };
+
+#ifdef R__USE_IMT
+   // When implicit multi-threading is enabled, read the next basket while the
+   // current one is written out.  The input and the output file are still
+   // each accessed by one thread at a time and the write order is preserved.
+   const bool readAhead = ROOT::IsImplicitMTEnabled();
+   std::unique_ptr<TBasket> nextBasket(readAhead ? new TBasket() : nullptr);
+   std::unique_ptr<ROOT::Experimental::TTaskGroup> readGroup(readAhead ? new ROOT::Experimental::TTaskGroup() : nullptr);
+   bool nextInFlight = false;
+   bool next_ok = false;
+#endif
+
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
       TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
 
       TFile *tofile = fToFile;
-      TFile *fromfile = from->GetFile(0);
 
       Int_t index = fBasketNum[ fBasketIndex[j] ];
 
       Long64_t pos = from->GetBasketSeek(index);
-      if (IsInPlace()) {
-         if (pos != 0) {
-            if (fFileCache && j >= notCached) {
-               notCached = FillCache(notCached);
-            }
-            Int_t len = from->GetBasketBytes()[index];
-            if (len == 0) {
-               len = basket->ReadBasketBytes(pos, fromfile);
-               from->GetBasketBytes()[index] = len;
-            }
-
-            const bool load_ok = (basket->LoadBasketBuffers(pos, len, fromfile, fFromTree) == 0);
-            if (!load_ok) {
-               fWarningMsg.Form("Error in LoadBasketBuffers at index %u.", j);
-               if (!(fOptions & kNoWarnings)) {
-                  Warning("TTreeCloner::WriteBaskets", "%s", fWarningMsg.Data());
-               }
-            }
-            basket->IncrementPidOffset(fPidOffset);
-            const bool copy_ok = (basket->CopyTo(tofile) != -1);
-            if (!copy_ok) {
-               fWarningMsg.Form("Error in CopyTo at index %u.", j);
-               if (!(fOptions & kNoWarnings)) {
-                  Warning("TTreeCloner::WriteBaskets", "%s", fWarningMsg.Data());
-               }
-            }
-            to->fBasketSeek[index] = basket->GetSeekKey();
-         }
-      } else if (pos!=0) {
+      if (pos != 0) {
          if (fFileCache && j >= notCached) {
             notCached = FillCache(notCached);
          }
-         if (from->GetBasketBytes()[index] == 0) {
-            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
-         }
-         Int_t len = from->GetBasketBytes()[index];
 
-         const bool load_ok = (basket->LoadBasketBuffers(pos, len, fromfile, fFromTree) == 0);
+         bool load_ok;
+#ifdef R__USE_IMT
+         if (nextInFlight) {
+            readGroup->Wait();
+            nextInFlight = false;
+            TBasket *loaded = nextBasket.release();
+            nextBasket.reset(basket);
+            basket = loaded;
+            load_ok = next_ok;
+         } else
+#endif
+         load_ok = loadBasket(*basket, j);
          if (!load_ok) {
             fWarningMsg.Form("Error in LoadBasketBuffers at index %u.", j);
             if (!(fOptions & kNoWarnings)) {
                Warning("TTreeCloner::WriteBaskets", "%s", fWarningMsg.Data());
             }
          }
-         basket->IncrementPidOffset(fPidOffset);
+
+#ifdef R__USE_IMT
+         if (readAhead && j + 1 < fMaxBaskets) {
+            TBranch *nextFrom = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j+1] ] );
+            Long64_t nextPos = nextFrom->GetBasketSeek( fBasketNum[ fBasketIndex[j+1] ] );
+            // Only read ahead within the current cache window: FillCache
+            // resets the cache and must not run concurrently with a read.
+            if (nextPos != 0 && (!fFileCache || (j + 1) < notCached)) {
+               TBasket *nb = nextBasket.get();
+               readGroup->Run([nb, j, &next_ok, &loadBasket]() { next_ok = loadBasket(*nb, j + 1); });
+               nextInFlight = true;
+            }
+         }
+#endif
+
          const bool copy_ok = (basket->CopyTo(tofile) != -1);
          if (!copy_ok) {
             fWarningMsg.Form("Error in CopyTo at index %u.", j);
@@ -791,8 +820,12 @@ void TTreeCloner::WriteBaskets()
                Warning("TTreeCloner::WriteBaskets", "%s", fWarningMsg.Data());
             }
          }
-         to->AddBasket(*basket,true,fToStartEntries + from->GetBasketEntry()[index]);
-      } else {
+         if (IsInPlace()) {
+            to->fBasketSeek[index] = basket->GetSeekKey();
+         } else {
+            to->AddBasket(*basket,true,fToStartEntries + from->GetBasketEntry()[index]);
+         }
+      } else if (!IsInPlace()) {
          TBasket *frombasket = from->GetBasket( index );
          if (frombasket && frombasket->GetNevBuf()>0) {
             TBasket *tobasket = (TBasket*)frombasket->Clone();
@@ -802,5 +835,10 @@ void TTreeCloner::WriteBaskets()
          }
       }
    }
+#ifdef R__USE_IMT
+   if (nextInFlight) {
+      readGroup->Wait();
+   }
+#endif
    delete basket;
 }
@@ -55,7 +55,8 @@ TTreeSQL::TTreeSQL(TSQLServer *server, TString DB, const TString& table) :
    fResult(nullptr), fRow(nullptr),
    fServer(server),
    fBranchChecked(false),
-   fTableInfo(nullptr)
+   fTableInfo(nullptr),
+   fFetchBatchSize(0)
 {
    fCurrentEntry = -1;
    fQuery = TString("Select * from " + fTable);
@@ -743,6 +744,13 @@ Long64_t TTreeSQL::LoadTree(Long64_t entry)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Make sure the server and result set are setup for the requested entry
+///
+/// When a fetch batch size has been set (see SetFetchBatchSize), the rows are
+/// retrieved in windows of that size via `LIMIT ... OFFSET ...` queries and a
+/// seek jumps directly to the window containing the requested entry, instead
+/// of re-running the full query and stepping row by row from the beginning.
+/// Like the full-result scan, this relies on the server returning the rows of
+/// repeated identical queries in a stable order.
 
 Long64_t TTreeSQL::PrepEntry(Long64_t entry)
 {
@@ -751,10 +759,20 @@ Long64_t TTreeSQL::PrepEntry(Long64_t entry)
 
    if(entry == fCurrentEntry) return entry;
 
-   if(entry < fCurrentEntry || fResult==nullptr){
+   if(entry < fCurrentEntry || fResult==nullptr ||
+      (fFetchBatchSize > 0 && entry > fCurrentEntry + fFetchBatchSize)){
       delete fResult;
-      fResult = fServer->Query(fQuery.Data());
-      fCurrentEntry = -1;
+      fResult = nullptr;
+      if (fFetchBatchSize > 0) {
+         TString query = fQuery;
+         query += TString::Format(" LIMIT %d OFFSET %lld", fFetchBatchSize, entry);
+         fResult = fServer->Query(query.Data());
+         if (fResult) fCurrentEntry = entry - 1;
+      }
+      if (fResult==nullptr) {
+         fResult = fServer->Query(fQuery.Data());
+         fCurrentEntry = -1;
+      }
    }
 
    bool reset = false;
@@ -762,6 +780,15 @@ Long64_t TTreeSQL::PrepEntry(Long64_t entry)
       ++fCurrentEntry;
       delete fRow;
       fRow = fResult->Next();
+      if (fRow==nullptr && fFetchBatchSize > 0 && !reset) {
+         // the current window is exhausted, fetch the next batch starting
+         // at the row we are about to read
+         delete fResult;
+         TString query = fQuery;
+         query += TString::Format(" LIMIT %d OFFSET %d", fFetchBatchSize, fCurrentEntry);
+         fResult = fServer->Query(query.Data());
+         fRow = fResult ? fResult->Next() : nullptr;
+      }
       if (fRow==nullptr && !reset) {
          delete fResult;
          fResult = fServer->Query(fQuery.Data());
@@ -233,3 +233,81 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, bulkReadWithOffsets)
+{
+   std::unique_ptr<TFile> hfile{TFile::Open(fFileName.c_str())};
+   printf("Starting read of file %s.\n", fFileName.c_str());
+   TStopwatch sw;
+
+   printf("Using bulk-with-offsets APIs.\n");
+
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchInt = tree->GetBranch("i");
+   ASSERT_TRUE(branchInt);
+
+   float idx_f = 0;
+   int idx_i = 0;
+   Long64_t evt_idx = 0;
+   Long64_t events = fEventCount;
+   Int_t cluster_size = std::min(fClusterSize, fEventCount);
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile intBuf(TBuffer::kWrite, 32*1024);
+   std::vector<Int_t> floatOffsets;
+   std::vector<Int_t> intOffsets;
+
+   sw.Start();
+   while (events) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntriesAndOffsets(evt_idx, floatBuf, floatOffsets);
+      ASSERT_EQ(count, cluster_size);
+      ASSERT_EQ(floatOffsets.size(), static_cast<size_t>(count) + 1);
+      count = branchInt->GetBulkRead().GetBulkEntriesAndOffsets(evt_idx, intBuf, intOffsets);
+      ASSERT_EQ(count, cluster_size);
+
+      if (events > count) {
+         events -= count;
+      } else {
+         events = 0;
+      }
+      // The payload is byteswapped in place, so each entry's values can be used
+      // directly as a span delimited by consecutive offsets.
+      char *float_buf = floatBuf.GetCurrent();
+      char *int_buf = intBuf.GetCurrent();
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Int_t entry_count = (floatOffsets[idx + 1] - floatOffsets[idx]) / static_cast<Int_t>(sizeof(float));
+         if (R__unlikely(entry_count != ((evt_idx + idx + 1) % 10))) {
+            printf("Incorrect number of elements on float branch: %d, expected %lld (event %lld)\n",
+                   entry_count, (evt_idx + idx + 1) % 10, evt_idx + idx);
+            ASSERT_TRUE(false);
+         }
+         ASSERT_EQ(intOffsets[idx + 1] - intOffsets[idx], entry_count * static_cast<Int_t>(sizeof(int)));
+
+         float *entry_floats = reinterpret_cast<float*>(float_buf + floatOffsets[idx]);
+         int *entry_ints = reinterpret_cast<int*>(int_buf + intOffsets[idx]);
+         for (int entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+            if (R__unlikely((evt_idx < 1600000) && (entry_floats[entry_idx] != idx_f))) {
+               printf("Incorrect value on float branch: %f, expected %f (event %lld, entry %d)\n",
+                      entry_floats[entry_idx], idx_f, evt_idx + idx, entry_idx);
+               ASSERT_TRUE(false);
+            }
+            idx_f++;
+            if (R__unlikely((evt_idx < 1600000) && (entry_ints[entry_idx] != idx_i))) {
+               printf("Incorrect value on int branch: %d, expected %d (event %lld, entry %d)\n",
+                      entry_ints[entry_idx], idx_i, evt_idx + idx, entry_idx);
+               ASSERT_TRUE(false);
+            }
+            idx_i++;
+         }
+      }
+      evt_idx += count;
+   }
+   events = fEventCount;
+   ASSERT_EQ(evt_idx, events);
+
+   sw.Stop();
+   printf("Bulk-with-offsets API: Successful read of all events.\n");
+   printf("Bulk-with-offsets API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
+}
@@ -29,6 +29,106 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, asyncBasketFlush)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "asyncBasketFlush.root";
+   const int nEntries = 20000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAsyncBasketFlush();
+      double x = 0.;
+      int i = 0;
+      auto bx = t.Branch("x", &x);
+      auto bi = t.Branch("i", &i);
+      // Small baskets so that many of them go through the write pipeline.
+      bx->SetBasketSize(512);
+      bi->SetBasketSize(512);
+      for (int e = 0; e < nEntries; ++e) {
+         x = 0.5 * e;
+         i = e;
+         t.Fill();
+      }
+      // Bytes compressed by the basket tasks must show up in the bookkeeping
+      // even without a drain: the byte-based autoflush/autosave decisions
+      // read GetZipBytes() during the fill.
+      EXPECT_GT(t.GetZipBytes(), 0);
+      t.Write();
+      f.Close();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   EXPECT_EQ(t->GetEntries(), nEntries);
+   double x = 0.;
+   int i = 0;
+   t->SetBranchAddress("x", &x);
+   t->SetBranchAddress("i", &i);
+   for (int e = 0; e < nEntries; ++e) {
+      t->GetEntry(e);
+      EXPECT_DOUBLE_EQ(x, 0.5 * e);
+      EXPECT_EQ(i, e);
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, fastCloneReadAhead)
+{
+   ROOT::EnableImplicitMT();
+   const auto inName = "fastCloneReadAheadIn.root";
+   const auto outName = "fastCloneReadAheadOut.root";
+   const int nEntries = 5000;
+   {
+      TFile f(inName, "RECREATE");
+      TTree t("t", "t");
+      double x = 0.;
+      int i = 0;
+      auto bx = t.Branch("x", &x);
+      auto bi = t.Branch("i", &i);
+      // Small baskets so that the cloner transfers many of them.
+      bx->SetBasketSize(512);
+      bi->SetBasketSize(512);
+      for (int e = 0; e < nEntries; ++e) {
+         x = 1.5 * e;
+         i = e;
+         t.Fill();
+      }
+      t.Write();
+      f.Close();
+   }
+
+   {
+      TFile fin(inName);
+      auto tin = fin.Get<TTree>("t");
+      ASSERT_NE(tin, nullptr);
+      TFile fout(outName, "RECREATE");
+      auto tout = tin->CloneTree(-1, "fast");
+      ASSERT_NE(tout, nullptr);
+      tout->Write();
+      fout.Close();
+   }
+
+   TFile f(outName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   EXPECT_EQ(t->GetEntries(), nEntries);
+   double x = 0.;
+   int i = 0;
+   t->SetBranchAddress("x", &x);
+   t->SetBranchAddress("i", &i);
+   for (int e = 0; e < nEntries; ++e) {
+      t->GetEntry(e);
+      EXPECT_DOUBLE_EQ(x, 1.5 * e);
+      EXPECT_EQ(i, e);
+   }
+   f.Close();
+   gSystem->Unlink(inName);
+   gSystem->Unlink(outName);
+}
+
 //# 8720
 TEST(TChainImplicitMT, propagateToTTree)
 {
@@ -0,0 +1,46 @@
+#include "TEntryList.h"
+
+#include "gtest/gtest.h"
+
+// Sparse list spanning several blocks: the first block keeps the bit
+// representation, the earlier ones are optimized to the list representation
+// when the next block is started.
+TEST(TEntryList, containsRangeSparse)
+{
+   TEntryList elist;
+   elist.Enter(5);
+   elist.Enter(100);
+   elist.Enter(70000);
+
+   EXPECT_FALSE(elist.ContainsRange(0, 4));
+   EXPECT_TRUE(elist.ContainsRange(4, 5));
+   EXPECT_TRUE(elist.ContainsRange(5, 5));
+   EXPECT_FALSE(elist.ContainsRange(6, 99));
+   EXPECT_TRUE(elist.ContainsRange(6, 100));
+   EXPECT_FALSE(elist.ContainsRange(101, 69999));
+   EXPECT_TRUE(elist.ContainsRange(69999, 70001));
+   EXPECT_FALSE(elist.ContainsRange(70001, 200000));
+   EXPECT_TRUE(elist.ContainsRange(0, 1000000));
+}
+
+// Dense list: the optimized storage keeps the entries that do *not* pass.
+TEST(TEntryList, containsRangeDense)
+{
+   TEntryList elist;
+   for (Long64_t i = 0; i < 64000; ++i) {
+      if (i == 10 || i == 20)
+         continue;
+      elist.Enter(i);
+   }
+   // Starting the next block optimizes the storage of the first one.
+   elist.Enter(64001);
+
+   EXPECT_FALSE(elist.ContainsRange(10, 10));
+   EXPECT_FALSE(elist.ContainsRange(20, 20));
+   EXPECT_TRUE(elist.ContainsRange(9, 11));
+   EXPECT_TRUE(elist.ContainsRange(10, 20));
+   EXPECT_TRUE(elist.ContainsRange(0, 9));
+   EXPECT_TRUE(elist.ContainsRange(21, 63999));
+   EXPECT_FALSE(elist.ContainsRange(64002, 64500));
+   EXPECT_TRUE(elist.ContainsRange(63999, 64001));
+}
@@ -29,6 +29,7 @@
 #pragma link C++ class ROOT::Experimental::TTreeReaderFast+;
 #pragma link C++ class TTreeTableInterface;
 #pragma link C++ class TSimpleAnalysis+;
+#pragma link C++ class TTreeCutRegistry+;
 #ifndef _MSC_VER
 #pragma link C++ class TMPWorkerTree+;
 #pragma link C++ class ROOT::TTreeProcessorMP-;
@@ -92,6 +92,8 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static bool fgCacheClusterBoundaries;
+   static bool fgAsyncPrefetching;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
@@ -118,6 +120,12 @@ public:
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+
+   static void SetClusterBoundariesCaching(bool cache);
+   static bool GetClusterBoundariesCaching();
+
+   static void SetAsyncPrefetching(bool enable);
+   static bool GetAsyncPrefetching();
 };
 
 } // End of namespace ROOT
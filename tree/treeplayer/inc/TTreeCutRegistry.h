@@ -0,0 +1,50 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeCutRegistry
+#define ROOT_TTreeCutRegistry
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TTreeCutRegistry                                                     //
+//                                                                      //
+// A registry of named selection expressions that can be applied to a   //
+// TTree or TChain in a single pass, producing one TEntryList per cut.  //
+// This replaces one TTree::Draw(">>elist", cut) pass per cut when      //
+// skimming with many selections.                                       //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include <RtypesCore.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class TEntryList;
+class TTree;
+
+class TTreeCutRegistry {
+   /// The registered cuts as (name, expression) pairs, in registration order.
+   std::vector<std::pair<std::string, std::string>> fCuts;
+
+public:
+   TTreeCutRegistry() = default;
+
+   Bool_t AddCut(const char *name, const char *expression);
+   Int_t GetNCuts() const { return fCuts.size(); }
+   const char *GetCutName(Int_t i) const;
+   const char *GetCutExpression(const char *name) const;
+
+   std::vector<std::unique_ptr<TEntryList>> MakeEntryLists(TTree &tree) const;
+};
+
+#endif
@@ -109,6 +109,7 @@ protected:
    TObjArray   fBranches;         ///<!  List of branches to read.  Similar to fLeaves but duplicates are zeroed out.
    bool        fQuickLoad;        ///<!  If true, branch GetEntry is only called when the entry number changes.
    bool        fNeedLoading;      ///<!  If true, the current entry has not been loaded yet.
+   bool        fAllScalarDirect;  ///<!  If true, every leaf is a scalar read directly, enabling a faster evaluation loop.
 
    Int_t       fNdimensions[kMAXCODES];               ///< Number of array dimensions in each leaf
    Int_t       fFixedSizes[kMAXCODES][kMAXFORMDIM];   ///< Physical sizes of lower dimensions for each leaf
@@ -42,6 +42,15 @@ public:
    /// Returns the `sizeof` of the collection value type. Returns 0 in case the value size could not be retrieved.
    std::size_t GetValueSize() const { return fImpl ? fImpl->GetValueSize(GetProxy()) : 0; }
 
+   /// For a branch holding a collection of collections, fill `innerData` with the address of each inner
+   /// collection's contiguous payload and `offsets` with the cumulative element counts (`GetSize() + 1` entries,
+   /// starting at 0) in a single call, avoiding one virtual dispatch per inner element. Returns false if the
+   /// branch content does not support bulk extraction (see TVirtualCollectionProxy::GetNestedData()).
+   bool GetNestedData(std::vector<void *> &innerData, std::vector<UInt_t> &offsets) const
+   {
+      return fImpl ? fImpl->GetNestedData(GetProxy(), innerData, offsets) : false;
+   }
+
 protected:
    void *UntypedAt(std::size_t idx) const { return fImpl->At(GetProxy(), idx); }
    void CreateProxy() override;
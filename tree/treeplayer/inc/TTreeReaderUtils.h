@@ -27,6 +27,7 @@
 #include "TTreeReaderValue.h"
 
 #include <string>
+#include <vector>
 
 class TDictionary;
 class TTree;
@@ -95,6 +96,12 @@ namespace Internal {
       virtual void* At(Detail::TBranchProxy*, size_t /*idx*/) = 0;
       virtual bool IsContiguous(Detail::TBranchProxy *) = 0;
       virtual std::size_t GetValueSize(Detail::TBranchProxy *) = 0;
+      // Bulk access to a collection of collections; readers backed by a collection
+      // proxy forward to TVirtualCollectionProxy::GetNestedData().
+      virtual bool GetNestedData(Detail::TBranchProxy *, std::vector<void *> &, std::vector<UInt_t> &)
+      {
+         return false;
+      }
    };
 
 }
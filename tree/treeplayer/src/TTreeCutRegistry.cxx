@@ -0,0 +1,131 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TTreeCutRegistry
+A registry of named selection expressions applied to a TTree in one pass.
+
+Skim factories that produce one entry list per selection via
+`TTree::Draw(">>elist", cut)` read the data once per cut. With a
+TTreeCutRegistry the cuts are defined once by name, all formulas are compiled
+against the tree layout a single time, and one loop over the entries fills one
+TEntryList per cut:
+
+~~~{.cpp}
+TTreeCutRegistry cuts;
+cuts.AddCut("highpt", "pt > 50");
+cuts.AddCut("central", "abs(eta) < 1.5");
+auto entryLists = cuts.MakeEntryLists(*tree);
+~~~
+
+The same registry can be applied to any number of trees or chains with the
+same layout; the formulas are re-bound to each tree in MakeEntryLists().
+An entry is selected if any instance of an array-valued expression passes,
+matching the entry-level semantics of `TTree::Draw(">>elist", cut)`.
+*/
+
+#include "TTreeCutRegistry.h"
+
+#include "TEntryList.h"
+#include "TError.h"
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register a selection expression under the given name.
+/// Returns false and leaves the registry unchanged if the name or expression
+/// is empty or a cut with this name is already registered.
+
+Bool_t TTreeCutRegistry::AddCut(const char *name, const char *expression)
+{
+   if (!name || !*name || !expression || !*expression) {
+      ::Error("TTreeCutRegistry::AddCut", "cut name and expression must not be empty");
+      return kFALSE;
+   }
+   if (GetCutExpression(name)) {
+      ::Error("TTreeCutRegistry::AddCut", "a cut named \"%s\" is already registered", name);
+      return kFALSE;
+   }
+   fCuts.emplace_back(name, expression);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the i-th registered cut, in registration order, or
+/// nullptr if the index is out of range.
+
+const char *TTreeCutRegistry::GetCutName(Int_t i) const
+{
+   if (i < 0 || i >= static_cast<Int_t>(fCuts.size()))
+      return nullptr;
+   return fCuts[i].first.c_str();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the expression registered under the given name, or nullptr if no
+/// cut with this name is registered.
+
+const char *TTreeCutRegistry::GetCutExpression(const char *name) const
+{
+   for (const auto &cut : fCuts) {
+      if (cut.first == name)
+         return cut.second.c_str();
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Apply all registered cuts to the tree in a single pass over its entries.
+/// Returns one TEntryList per cut, in registration order, named after the cut
+/// with the expression as title. On an invalid expression an empty vector is
+/// returned and an error is emitted.
+
+std::vector<std::unique_ptr<TEntryList>> TTreeCutRegistry::MakeEntryLists(TTree &tree) const
+{
+   std::vector<std::unique_ptr<TEntryList>> entryLists;
+   std::vector<std::unique_ptr<TTreeFormula>> formulas;
+   entryLists.reserve(fCuts.size());
+   formulas.reserve(fCuts.size());
+
+   for (const auto &cut : fCuts) {
+      auto formula = std::make_unique<TTreeFormula>(cut.first.c_str(), cut.second.c_str(), &tree);
+      if (formula->GetNdim() == 0) {
+         ::Error("TTreeCutRegistry::MakeEntryLists", "invalid expression for cut \"%s\": %s", cut.first.c_str(),
+                 cut.second.c_str());
+         return {};
+      }
+      formula->SetQuickLoad(kTRUE);
+      formulas.emplace_back(std::move(formula));
+      entryLists.emplace_back(std::make_unique<TEntryList>(cut.first.c_str(), cut.second.c_str()));
+   }
+
+   const Long64_t nentries = tree.GetEntries();
+   Int_t currentTreeNumber = -1;
+   for (Long64_t entry = 0; entry < nentries; ++entry) {
+      if (tree.LoadTree(entry) < 0)
+         break;
+      if (tree.GetTreeNumber() != currentTreeNumber) {
+         // A chain switched to the next tree: re-bind the formula leaves
+         currentTreeNumber = tree.GetTreeNumber();
+         for (auto &formula : formulas)
+            formula->UpdateFormulaLeaves();
+      }
+      for (unsigned int i = 0; i < formulas.size(); ++i) {
+         const Int_t ndata = formulas[i]->GetNdata();
+         for (Int_t j = 0; j < ndata; ++j) {
+            if (formulas[i]->EvalInstance(j) != 0) {
+               entryLists[i]->Enter(entry, &tree);
+               break;
+            }
+         }
+      }
+   }
+
+   return entryLists;
+}
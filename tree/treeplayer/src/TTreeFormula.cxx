@@ -149,6 +149,7 @@ TTreeFormula::TTreeFormula(TRootIOCtor*): ROOT::v5::TFormula(), fQuickLoad(false
    fManager      = nullptr;
    fMultiplicity = 0;
    fConstLD      = nullptr;
+   fAllScalarDirect = false;
 
    Int_t j,k;
    for (j=0; j<kMAXCODES; j++) {
@@ -199,6 +200,7 @@ void TTreeFormula::Init(const char*name, const char* expression)
    fAxis         = nullptr;
    fHasCast      = false;
    fConstLD      = nullptr;
+   fAllScalarDirect = false;
    Int_t i,j,k;
    fManager      = new TTreeFormulaManager;
    fManager->Add(this);
@@ -304,6 +306,29 @@ void TTreeFormula::Init(const char*name, const char* expression)
       fBranches.AddAtAndExpand(branch,k);
    }
 
+   // Check whether every referenced leaf is a plain scalar read directly from
+   // its branch and no operation can skip the evaluation of an operand.  In
+   // that case EvalInstance loads all the branches in one pass and skips the
+   // per operand instance calculation (the instance is always zero).
+   fAllScalarDirect = (fNcodes > 0) && !fHasCast && (fMultiplicity == 0);
+   for (k = 0; k < fNcodes && fAllScalarDirect; k++) {
+      if (fLookupType[k] != kDirect || fNdimensions[k] != 0 || fCodes[k] < 0 ||
+          k > fLeaves.GetLast() || !fLeaves.UncheckedAt(k) || IsLeafString(k)) {
+         fAllScalarDirect = false;
+      }
+   }
+   for (i = 0; i < fNoper && fAllScalarDirect; i++) {
+      const Int_t action = GetAction(i);
+      // Jumps and boolean optimization skip operands, hence also skip the
+      // (lazy) loading of the corresponding branches.
+      if (action == kJump || action == kJumpIf || action == kBoolOptimize ||
+          action == kAlias || action == kAliasString ||
+          action == kAlternate || action == kAlternateString ||
+          action == kMinIf || action == kMaxIf) {
+         fAllScalarDirect = false;
+      }
+   }
+
    if (IsInteger(false)) SetBit(kIsInteger);
 
    if (TestBit(TTreeFormula::kNeedEntries)) {
@@ -4133,7 +4158,21 @@ T TTreeFormula::EvalInstance(Int_t instance, const char *stringStackArg[])
    const char **stringStack = stringStackArg?stringStackArg:stringStackLocal;
 
    const bool willLoad = (instance==0 || fNeedLoading); fNeedLoading = false;
-   if (willLoad) fDidBooleanOptimization = false;
+   if (willLoad) {
+      fDidBooleanOptimization = false;
+      if (fAllScalarDirect) {
+         // Every leaf is a scalar read directly and every operand is always
+         // evaluated (see Init): load the branches in one pass so that the
+         // loop below does not need to check for loading at each operand.
+         for (Int_t code = 0; code < fNcodes; ++code) {
+            TBranch *branch = (TBranch*)fBranches.UncheckedAt(code);
+            if (branch && branch->GetTree()) {
+               Long64_t treeEntry = branch->GetTree()->GetReadEntry();
+               R__LoadBranch(branch,treeEntry,fQuickLoad);
+            }
+         }
+      }
+   }
 
    Int_t pos  = 0;
    Int_t pos2 = 0;
@@ -4358,7 +4397,12 @@ T TTreeFormula::EvalInstance(Int_t instance, const char *stringStackArg[])
                case kMin:          tab[pos++] = FindMin<T>((TTreeFormula*)fAliases.UncheckedAt(i)); continue;
                case kMax:          tab[pos++] = FindMax<T>((TTreeFormula*)fAliases.UncheckedAt(i)); continue;
 
-               case kDirect:     { TT_EVAL_INIT_LOOP; tab[pos++] = leaf->GetTypedValue<T>(real_instance); continue; }
+               case kDirect:     { if (fAllScalarDirect) {
+                                      // The branch was loaded up front and the real instance is zero.
+                                      tab[pos++] = ((TLeaf*)fLeaves.UncheckedAt(code))->GetTypedValue<T>(0);
+                                      continue;
+                                   }
+                                   TT_EVAL_INIT_LOOP; tab[pos++] = leaf->GetTypedValue<T>(real_instance); continue; }
                case kMethod:     { TT_EVAL_INIT_LOOP; tab[pos++] = GetValueFromMethod(code,leaf); continue; }
                case kDataMember: { TT_EVAL_INIT_LOOP; tab[pos++] = ((TFormLeafInfo*)fDataMembers.UncheckedAt(code))->
                                           GetTypedValue<T>(leaf,real_instance); continue; }
@@ -19,7 +19,14 @@ A Tree Index with majorname and minorname.
 #include "TTree.h"
 #include "TBuffer.h"
 #include "TMath.h"
+#include "TROOT.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
 #include <cstring> // std::strlen
 
 ClassImp(TTreeIndex);
@@ -201,17 +208,61 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
       tmp_major[i] = GetAndRangeCheck(true, i);
       tmp_minor[i] = GetAndRangeCheck(false, i);
    }
+   // Detect whether the tree is already ordered in (major, minor), as is
+   // typical for run/event numbers recorded in acquisition order.
+   bool alreadySorted = true;
+   for (i = 1; i < fN && alreadySorted; i++) {
+      alreadySorted = tmp_major[i] > tmp_major[i - 1] ||
+                      (tmp_major[i] == tmp_major[i - 1] && tmp_minor[i] >= tmp_minor[i - 1]);
+   }
    fIndex = new Long64_t[fN];
    for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
-   //TMath::Sort(fN,w,fIndex,0);
-   fIndexValues = new Long64_t[fN];
-   fIndexValuesMinor = new Long64_t[fN];
+   if (alreadySorted) {
+      // The identity permutation is the sorted order: adopt the value arrays
+      // as they are. No sort and no permuted copies are needed, which keeps
+      // the peak memory at three arrays per entry instead of five.
+      fIndexValues = tmp_major;
+      fIndexValuesMinor = tmp_minor;
+      tmp_major = nullptr;
+      tmp_minor = nullptr;
+   } else {
+      IndexSortComparator comp(tmp_major, tmp_minor);
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && fN > 1000000) {
+         // Sort blocks of the permutation in parallel, then merge the
+         // neighbouring sorted runs pairwise, also in parallel.
+         ROOT::TThreadExecutor pool;
+         const UInt_t nBlocks = pool.GetPoolSize();
+         std::vector<Long64_t> bounds(nBlocks + 1);
+         for (UInt_t b = 0; b <= nBlocks; ++b)
+            bounds[b] = (fN * b) / nBlocks;
+         pool.Foreach([&](UInt_t b) { std::sort(fIndex + bounds[b], fIndex + bounds[b + 1], comp); },
+                      ROOT::TSeqU(nBlocks));
+         for (UInt_t width = 1; width < nBlocks; width *= 2) {
+            std::vector<UInt_t> firsts;
+            for (UInt_t b = 0; b + width < nBlocks; b += 2 * width)
+               firsts.push_back(b);
+            pool.Foreach(
+               [&](UInt_t b) {
+                  const UInt_t last = std::min(b + 2 * width, nBlocks);
+                  std::inplace_merge(fIndex + bounds[b], fIndex + bounds[b + width], fIndex + bounds[last], comp);
+               },
+               firsts);
+         }
+      } else
+#endif
+         std::sort(fIndex, fIndex + fN, comp);
+      //TMath::Sort(fN,w,fIndex,0);
+      fIndexValues = new Long64_t[fN];
+      fIndexValuesMinor = new Long64_t[fN];
+      for (i = 0; i < fN; i++) {
+         fIndexValues[i] = tmp_major[fIndex[i]];
+         fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
+      }
+   }
    bool duplicatedKeys = false;
-   for (i = 0; i < fN; i++) {
-      fIndexValues[i] = tmp_major[fIndex[i]];
-      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
-      const bool checkDuplicates = i > 0 && (!duplicatedKeys || gDebug >= 1);
+   for (i = 1; i < fN; i++) {
+      const bool checkDuplicates = !duplicatedKeys || gDebug >= 1;
       if (checkDuplicates) {
          if (fIndexValues[i - 1] == fIndexValues[i] && fIndexValuesMinor[i - 1] == fIndexValuesMinor[i]) {
             Error("TTreeIndex",
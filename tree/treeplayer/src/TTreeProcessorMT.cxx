@@ -25,7 +25,11 @@ objects.
 */
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
+#include "TEnv.h"
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
@@ -35,6 +39,27 @@ namespace {
 
 using EntryRange = std::pair<Long64_t, Long64_t>;
 
+/// Scoped enabling of TFile.AsyncPrefetching, so that the TTreeCaches created by the
+/// worker threads during the event loop spawn a TFilePrefetch background reader.
+/// See TTreeProcessorMT::SetAsyncPrefetching.
+class TAsyncPrefetchingRAII {
+   Int_t fPreviousValue;
+   bool fActive;
+
+public:
+   TAsyncPrefetchingRAII(bool enable)
+      : fPreviousValue(gEnv->GetValue("TFile.AsyncPrefetching", 0)), fActive(enable)
+   {
+      if (fActive)
+         gEnv->SetValue("TFile.AsyncPrefetching", 1);
+   }
+   ~TAsyncPrefetchingRAII()
+   {
+      if (fActive)
+         gEnv->SetValue("TFile.AsyncPrefetching", fPreviousValue);
+   }
+};
+
 // note that this routine assumes global entry numbers
 bool ClustersAreSortedAndContiguous(const std::vector<std::vector<EntryRange>> &cls)
 {
@@ -124,6 +149,48 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
+// Cluster boundaries (in file-local entry numbers) and number of entries of one file's tree.
+struct RawClusters {
+   std::vector<EntryRange> fClusters;
+   Long64_t fEntries = 0ll;
+};
+
+// Process-wide cache of cluster boundaries, keyed by "treename/filename". Only
+// populated and queried if TTreeProcessorMT::GetClusterBoundariesCaching() is true.
+std::mutex gClusterCacheMutex;
+std::unordered_map<std::string, RawClusters> gClusterCache;
+
+////////////////////////////////////////////////////////////////////////
+/// Open the file and read the cluster boundaries and the number of entries of the given tree.
+RawClusters ReadClusters(const std::string &treeName, const std::string &fileName)
+{
+   std::unique_ptr<TFile> f(TFile::Open(
+      fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
+   if (!f || f->IsZombie()) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+   auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+
+   if (!t) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
+                       "\" from file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+
+   // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+   t->ResetBit(kMustCleanup);
+   ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
+
+   RawClusters result;
+   result.fEntries = t->GetEntries();
+   auto clusterIter = t->GetClusterIterator(0);
+   Long64_t clusterStart = 0ll;
+   while ((clusterStart = clusterIter()) < result.fEntries)
+      result.fClusters.emplace_back(EntryRange{clusterStart, clusterIter.GetNextEntry()});
+   return result;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
 ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
@@ -143,30 +210,24 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
       const auto &fileName = fileNames[i];
       const auto &treeName = treeNames[i];
 
-      std::unique_ptr<TFile> f(TFile::Open(
-         fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
-      if (!f || f->IsZombie()) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
+      RawClusters raw;
+      if (TTreeProcessorMT::GetClusterBoundariesCaching()) {
+         const std::string key = treeName + "/" + fileName;
+         std::lock_guard<std::mutex> lock(gClusterCacheMutex);
+         auto cacheIt = gClusterCache.find(key);
+         if (cacheIt == gClusterCache.end())
+            cacheIt = gClusterCache.emplace(key, ReadClusters(treeName, fileName)).first;
+         raw = cacheIt->second;
+      } else {
+         raw = ReadClusters(treeName, fileName);
       }
-      auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
 
-      if (!t) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
-                          "\" from file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-
-      // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
-      t->ResetBit(kMustCleanup);
-      ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
-      auto clusterIter = t->GetClusterIterator(0);
-      Long64_t clusterStart = 0ll, clusterEnd = 0ll;
-      const Long64_t entries = t->GetEntries();
+      const Long64_t entries = raw.fEntries;
       // Iterate over the clusters in the current file
       std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
-         clusterEnd = clusterIter.GetNextEntry();
+      for (const auto &cluster : raw.fClusters) {
+         if (rangeEndReached)
+            break;
          // Currently, if a user specified a range, the clusters will be only globally obtained
          // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
          // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
@@ -176,8 +237,8 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
          // tree is added, i.e.: currentStart is now 200 and currentEnd is 250 (locally from 100 to 150).
          // Lastly, the last tree would take entries from 250 to 300 (or from 0 to 50 locally).
          // The current file's offset to start and end is added to make them (chain) global
-         const auto currentStart = std::max(clusterStart + offset, range.first);
-         const auto currentEnd = std::min(clusterEnd + offset, range.second);
+         const auto currentStart = std::max(cluster.first + offset, range.first);
+         const auto currentEnd = std::min(cluster.second + offset, range.second);
          // This is not satified if the desired start is larger than the last entry of some cluster
          // In this case, this cluster is not going to be processes further
          if (currentStart < currentEnd)
@@ -249,6 +310,8 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+bool TTreeProcessorMT::fgCacheClusterBoundaries = false;
+bool TTreeProcessorMT::fgAsyncPrefetching = false;
 
 namespace Internal {
 
@@ -515,6 +578,10 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
    std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
 
+   // The workers' TTreeCaches are created while the loops below run, so this is the
+   // window during which the async prefetching setting must be active.
+   TAsyncPrefetchingRAII asyncPrefetchGuard(fgAsyncPrefetching);
+
    if (shouldRetrieveAllClusters)
       fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
    else
@@ -549,3 +616,56 @@ void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Return whether caching of cluster boundaries is enabled (false by default).
+bool TTreeProcessorMT::GetClusterBoundariesCaching()
+{
+   return fgCacheClusterBoundaries;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Enable or disable process-wide caching of cluster boundaries.
+/// \param[in] cache Whether cluster boundaries should be cached.
+///
+/// Before the parallel processing starts, every file of the dataset is opened once to
+/// read the cluster boundaries and the number of entries of its tree, which drive the
+/// task splitting. For large datasets served over the network this discovery can take
+/// a significant amount of time. If caching is enabled, the boundaries read during the
+/// first processing of a given tree/file pair are reused by later processings in the
+/// same program, e.g. event loops of a data frame that was already run, and the files
+/// are not opened again. The cache is never invalidated: do not enable it if the input
+/// files might be overwritten while the program runs.
+void TTreeProcessorMT::SetClusterBoundariesCaching(bool cache)
+{
+   fgCacheClusterBoundaries = cache;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Return whether asynchronous basket prefetching is enabled (false by default).
+bool TTreeProcessorMT::GetAsyncPrefetching()
+{
+   return fgAsyncPrefetching;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Enable or disable asynchronous basket prefetching during Process.
+/// \param[in] enable Whether the workers' caches should prefetch asynchronously.
+///
+/// By default each worker thread blocks while the baskets of its current cache
+/// window are fetched from storage. With asynchronous prefetching enabled, the
+/// TTreeCache of every remote file opened during Process is backed by a
+/// TFilePrefetch background reader, so the fetch of the next block of baskets
+/// is in flight while the worker decompresses and deserializes the current
+/// one. With N worker threads this keeps up to 2N requests outstanding, which
+/// can hide a large fraction of the latency of wide-area or otherwise
+/// high-latency connections. The setting has no effect on local files, whose
+/// reads stay synchronous.
+///
+/// The setting is applied by temporarily activating `TFile.AsyncPrefetching`
+/// (see TFileCacheRead) for the duration of Process, so it also affects files
+/// that other threads of the application open during that window.
+void TTreeProcessorMT::SetAsyncPrefetching(bool enable)
+{
+   fgAsyncPrefetching = enable;
+}
@@ -254,6 +254,16 @@ TTreeReader::~TTreeReader()
    if (fTree && fNotify.IsLinked())
       fNotify.RemoveLink(*fTree);
 
+   if (fEntryList && fTree && fEntryStatus != kEntryNoTree && fTree->GetTree()) {
+      // The cache must not keep a pointer to our entry list once we are gone.
+      if (const auto curFile = fTree->GetCurrentFile()) {
+         if (auto tc = fTree->GetTree()->GetReadCache(curFile)) {
+            if (tc->GetEntryList() == fEntryList)
+               tc->SetEntryList(nullptr);
+         }
+      }
+   }
+
    if (fEntryStatus != kEntryNoTree && !TestBit(kBitIsExternalTree)) {
       // a plain TTree is automatically added to the current directory,
       // do not delete it here
@@ -414,12 +424,16 @@ bool TTreeReader::SetProxies()
    // https://sft.its.cern.ch/jira/browse/ROOT-9773?focusedCommentId=87837
    if (fProxiesSet) {
       const auto curFile = fTree->GetCurrentFile();
-      if (curFile && fTree->GetTree()->GetReadCache(curFile, true)) {
+      if (auto tc = curFile ? fTree->GetTree()->GetReadCache(curFile, true) : nullptr) {
          if (!(-1LL == fEndEntry && 0ULL == fBeginEntry)) {
             // We need to avoid to pass -1 as end entry to the SetCacheEntryRange method
             const auto lastEntry = (-1LL == fEndEntry) ? fTree->GetEntriesFast() : fEndEntry;
             fTree->SetCacheEntryRange(fBeginEntry, lastEntry);
          }
+         if (fEntryList) {
+            // Let the cache skip the baskets that contain no selected entries.
+            tc->SetEntryList(fEntryList);
+         }
          for (auto value : fValues) {
             if (value->GetProxy())
                fTree->AddBranchToCache(value->GetProxy()->GetBranchName(), true);
@@ -164,6 +164,15 @@ public:
       auto cp = GetCP(proxy);
       return GetCPValueSize(*cp);
    }
+
+   bool GetNestedData(ROOT::Detail::TBranchProxy *proxy, std::vector<void *> &innerData,
+                      std::vector<UInt_t> &offsets) override
+   {
+      TVirtualCollectionProxy *myCollectionProxy = GetCP(proxy);
+      if (!myCollectionProxy)
+         return false;
+      return myCollectionProxy->GetNestedData(innerData, offsets);
+   }
 };
 
 class TCollectionLessSTLReader final : public TVirtualCollectionReader {
@@ -229,6 +238,18 @@ public:
       auto cp = GetCP(proxy);
       return GetCPValueSize(*cp);
    }
+
+   bool GetNestedData(ROOT::Detail::TBranchProxy *proxy, std::vector<void *> &innerData,
+                      std::vector<UInt_t> &offsets) override
+   {
+      TVirtualCollectionProxy *myCollectionProxy = GetCP(proxy);
+      if (!myCollectionProxy)
+         return false;
+      // See At(): re-push the current object so the proxy operates on it.
+      myCollectionProxy->PopProxy();
+      myCollectionProxy->PushProxy(proxy->GetWhere());
+      return myCollectionProxy->GetNestedData(innerData, offsets);
+   }
 };
 
 // Reader interface for leaf list
@@ -29,6 +29,58 @@ TEST(TTreeReaderArray, Vector)
    EXPECT_FLOAT_EQ(17.f, vec[0]);
 }
 
+TEST(TTreeReaderArray, GetNestedData)
+{
+   TTree *tree = new TTree("TTreeReaderArrayTree", "In-memory test tree");
+   std::vector<std::vector<float>> vecvecf{{1.f, 2.f}, {}, {3.f, 4.f, 5.f}};
+   tree->Branch("vecvec", &vecvecf);
+
+   tree->Fill();
+   tree->Fill();
+
+   tree->ResetBranchAddresses();
+
+   TTreeReader tr(tree);
+   TTreeReaderArray<std::vector<float>> vecvec(tr, "vecvec");
+
+   tr.SetEntry(1);
+
+   std::vector<void *> innerData;
+   std::vector<UInt_t> offsets;
+   ASSERT_TRUE(vecvec.GetNestedData(innerData, offsets));
+   ASSERT_EQ(3u, innerData.size());
+   ASSERT_EQ(4u, offsets.size());
+   EXPECT_EQ(0u, offsets[0]);
+   EXPECT_EQ(2u, offsets[1]);
+   EXPECT_EQ(2u, offsets[2]);
+   EXPECT_EQ(5u, offsets[3]);
+   EXPECT_FLOAT_EQ(1.f, static_cast<float *>(innerData[0])[0]);
+   EXPECT_FLOAT_EQ(2.f, static_cast<float *>(innerData[0])[1]);
+   EXPECT_FLOAT_EQ(3.f, static_cast<float *>(innerData[2])[0]);
+   EXPECT_FLOAT_EQ(5.f, static_cast<float *>(innerData[2])[2]);
+}
+
+TEST(TTreeReaderArray, GetNestedDataFlat)
+{
+   // A flat collection has no inner collections to extract.
+   TTree *tree = new TTree("TTreeReaderArrayTree", "In-memory test tree");
+   std::vector<float> vecf{17.f, 18.f, 19.f};
+   tree->Branch("vec", &vecf);
+
+   tree->Fill();
+
+   tree->ResetBranchAddresses();
+
+   TTreeReader tr(tree);
+   TTreeReaderArray<float> vec(tr, "vec");
+
+   tr.SetEntry(0);
+
+   std::vector<void *> innerData;
+   std::vector<UInt_t> offsets;
+   EXPECT_FALSE(vec.GetNestedData(innerData, offsets));
+}
+
 TEST(TTreeReaderArray, MultiReaders)
 {
    // See https://root.cern/phpBB3/viewtopic.php?f=3&t=22790
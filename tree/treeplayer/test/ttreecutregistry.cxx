@@ -0,0 +1,84 @@
+#include "ROOT/TestSupport.hxx"
+
+#include "TDirectory.h"
+#include "TEntryList.h"
+#include "TTree.h"
+#include "TTreeCutRegistry.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(TTreeCutRegistry, AddCut)
+{
+   TTreeCutRegistry cuts;
+   EXPECT_EQ(0, cuts.GetNCuts());
+
+   EXPECT_TRUE(cuts.AddCut("highx", "x > 50"));
+   EXPECT_TRUE(cuts.AddCut("evenx", "Int_t(x) % 2 == 0"));
+   EXPECT_EQ(2, cuts.GetNCuts());
+   EXPECT_STREQ("highx", cuts.GetCutName(0));
+   EXPECT_STREQ("evenx", cuts.GetCutName(1));
+   EXPECT_STREQ("x > 50", cuts.GetCutExpression("highx"));
+   EXPECT_EQ(nullptr, cuts.GetCutExpression("nosuchcut"));
+
+   // Duplicate names and empty arguments are rejected
+   EXPECT_FALSE(cuts.AddCut("highx", "x > 60"));
+   EXPECT_FALSE(cuts.AddCut("", "x > 60"));
+   EXPECT_FALSE(cuts.AddCut("emptyexpr", ""));
+   EXPECT_EQ(2, cuts.GetNCuts());
+}
+
+TEST(TTreeCutRegistry, SinglePassEntryLists)
+{
+   TTree tree("t", "t");
+   Double_t x = 0.;
+   tree.Branch("x", &x, "x/D");
+   for (int i = 0; i < 100; ++i) {
+      x = i;
+      tree.Fill();
+   }
+
+   TTreeCutRegistry cuts;
+   cuts.AddCut("highx", "x > 50");
+   cuts.AddCut("evenx", "Int_t(x) % 2 == 0");
+   cuts.AddCut("none", "x < 0");
+
+   auto entryLists = cuts.MakeEntryLists(tree);
+   ASSERT_EQ(3u, entryLists.size());
+
+   EXPECT_STREQ("highx", entryLists[0]->GetName());
+   EXPECT_STREQ("x > 50", entryLists[0]->GetTitle());
+   EXPECT_EQ(49, entryLists[0]->GetN());
+   EXPECT_EQ(51, entryLists[0]->GetEntry(0));
+
+   EXPECT_EQ(50, entryLists[1]->GetN());
+   EXPECT_EQ(0, entryLists[1]->GetEntry(0));
+   EXPECT_EQ(2, entryLists[1]->GetEntry(1));
+
+   EXPECT_EQ(0, entryLists[2]->GetN());
+
+   // The single-pass result must match what TTree::Draw(">>elist", cut) produces
+   tree.Draw(">>draw_elist", "x > 50", "goff");
+   auto drawList = static_cast<TEntryList *>(gDirectory->Get("draw_elist"));
+   ASSERT_NE(nullptr, drawList);
+   EXPECT_EQ(drawList->GetN(), entryLists[0]->GetN());
+   for (Long64_t i = 0; i < drawList->GetN(); ++i)
+      EXPECT_EQ(drawList->GetEntry(i), entryLists[0]->GetEntry(i));
+}
+
+TEST(TTreeCutRegistry, InvalidExpression)
+{
+   TTree tree("t", "t");
+   Double_t x = 0.;
+   tree.Branch("x", &x, "x/D");
+   tree.Fill();
+
+   TTreeCutRegistry cuts;
+   cuts.AddCut("bad", "nosuchbranch > 0");
+
+   ROOT::TestSupport::CheckDiagsRAII diags;
+   diags.requiredDiag(kError, "TTreeFormula::Compile", "Bad numerical expression", false);
+   diags.requiredDiag(kError, "TTreeCutRegistry::MakeEntryLists", "invalid expression", false);
+   EXPECT_TRUE(cuts.MakeEntryLists(tree).empty());
+}
@@ -0,0 +1,65 @@
+#include "TMath.h"
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+const int kNEntries = 10;
+
+// Build an in-memory tree with scalar branches (x, y) and an array branch.
+std::unique_ptr<TTree> MakeFormulaTree()
+{
+   auto t = std::make_unique<TTree>("t", "t");
+   double x;
+   int y;
+   float arr[3];
+   t->Branch("x", &x);
+   t->Branch("y", &y);
+   t->Branch("arr", arr, "arr[3]/F");
+   for (int i = 0; i < kNEntries; ++i) {
+      x = 0.25 * i;
+      y = i - 4;
+      for (int j = 0; j < 3; ++j)
+         arr[j] = 10.f * i + j;
+      t->Fill();
+   }
+   return t;
+}
+
+// Formulas over scalar leaves read directly go through the one-pass branch
+// loading in EvalInstance; check they evaluate as expected.
+TEST(TTreeFormulaScalar, ScalarExpressions)
+{
+   auto t = MakeFormulaTree();
+   TTreeFormula lin("lin", "x + 2*y - 1", t.get());
+   TTreeFormula fun("fun", "sqrt(x)*y", t.get());
+   for (int i = 0; i < kNEntries; ++i) {
+      t->LoadTree(i);
+      const double x = 0.25 * i;
+      const int y = i - 4;
+      ASSERT_GT(lin.GetNdata(), 0);
+      EXPECT_DOUBLE_EQ(lin.EvalInstance(0), x + 2 * y - 1);
+      ASSERT_GT(fun.GetNdata(), 0);
+      EXPECT_DOUBLE_EQ(fun.EvalInstance(0), TMath::Sqrt(x) * y);
+   }
+}
+
+// Boolean optimization and array leaves take the general evaluation path;
+// make sure mixing them with scalar leaves still evaluates correctly.
+TEST(TTreeFormulaScalar, GeneralPathExpressions)
+{
+   auto t = MakeFormulaTree();
+   TTreeFormula cut("cut", "x > 1 && y < 4", t.get());
+   TTreeFormula mix("mix", "arr[1] + x", t.get());
+   for (int i = 0; i < kNEntries; ++i) {
+      t->LoadTree(i);
+      const double x = 0.25 * i;
+      const int y = i - 4;
+      ASSERT_GT(cut.GetNdata(), 0);
+      EXPECT_DOUBLE_EQ(cut.EvalInstance(0), (x > 1 && y < 4) ? 1. : 0.);
+      ASSERT_GT(mix.GetNdata(), 0);
+      EXPECT_DOUBLE_EQ(mix.EvalInstance(0), (10. * i + 1) + x);
+   }
+}
@@ -0,0 +1,71 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include "gtest/gtest.h"
+
+const int kNRuns = 5;
+const int kNEvents = 20;
+
+// Fill a tree with (run, event) pairs, either in increasing order or shuffled
+// through a fixed permutation (37 is coprime with the number of entries).
+void FillIndexableTree(const char *fname, bool sorted)
+{
+   TFile f(fname, "RECREATE");
+   TTree t("t", "t");
+   Long64_t run, event;
+   int val;
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+   t.Branch("val", &val);
+   const int n = kNRuns * kNEvents;
+   for (int i = 0; i < n; ++i) {
+      const int j = sorted ? i : (i * 37) % n;
+      run = j / kNEvents + 1;
+      event = j % kNEvents;
+      val = j;
+      t.Fill();
+   }
+   t.Write();
+   f.Close();
+}
+
+void CheckIndexLookups(const char *fname)
+{
+   TFile f(fname);
+   auto *t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   t->BuildIndex("run", "event");
+   auto *idx = dynamic_cast<TTreeIndex *>(t->GetTreeIndex());
+   ASSERT_NE(idx, nullptr);
+   EXPECT_EQ(idx->GetN(), t->GetEntries());
+
+   int val;
+   t->SetBranchAddress("val", &val);
+   for (int r = 1; r <= kNRuns; ++r) {
+      for (int e = 0; e < kNEvents; ++e) {
+         ASSERT_GE(t->GetEntryWithIndex(r, e), 0);
+         EXPECT_EQ(val, (r - 1) * kNEvents + e);
+      }
+   }
+   EXPECT_EQ(idx->GetEntryNumberWithIndex(kNRuns + 1, 0), -1);
+}
+
+// The index build detects trees already ordered in (major, minor) and skips
+// the sort; make sure the lookups behave the same in both code paths.
+TEST(TTreeIndexSorted, AlreadySortedTree)
+{
+   const auto fname = "ttreeindex_sorted.root";
+   FillIndexableTree(fname, true);
+   CheckIndexLookups(fname);
+   gSystem->Unlink(fname);
+}
+
+TEST(TTreeIndexSorted, UnsortedTree)
+{
+   const auto fname = "ttreeindex_unsorted.root";
+   FillIndexableTree(fname, false);
+   CheckIndexLookups(fname);
+   gSystem->Unlink(fname);
+}